@@ -0,0 +1,204 @@
+// blobbufferfactory.cpp                                              -*-C++-*-
+
+// This program measures the throughput of
+// 'bdlbb::ThreadCachingBlobBufferFactory', with and without preallocated
+// buffers, against 'bdlbb::PooledBlobBufferFactory' with 1 to 64 threads
+// sharing one factory object.  Each thread keeps a window of live buffers,
+// and repeatedly releases one and allocates another in its place.  In the
+// "remote" workload each thread releases the buffers allocated by its
+// neighbor, so that every buffer is released by a thread other than the one
+// that allocated it.
+//
+// Usage: blobbufferfactory [<maximum number of threads>
+//                          [<operations per thread> [<buffer size>]]]
+
+#include <bdlbb_blob.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlbb_threadcachingblobbufferfactory.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+enum { k_WINDOW = 256 };  // live buffers per thread
+
+struct Shared {
+    // This 'struct' holds the state shared by the threads of one run.
+
+    bdlbb::BlobBufferFactory       *d_factory_p;      // factory under test
+    bslmt::Barrier                 *d_ready_p;        // waits for the windows
+    bslmt::Barrier                 *d_start_p;        // releases the threads
+                                                      // together
+    bslmt::Barrier                 *d_stop_p;         // waits for the threads
+    bsl::vector<bdlbb::BlobBuffer> *d_windows_p;      // 'k_WINDOW' buffers
+                                                      // per thread
+    int                             d_numThreads;     // number of threads
+    int                             d_numOperations;  // per thread
+    bool                            d_remote;         // release the
+                                                      // neighbor's buffers
+};
+
+struct Worker {
+    // This 'struct' identifies one thread of a run.
+
+    Shared *d_shared_p;  // state of the run
+    int     d_index;     // index of this thread
+};
+
+unsigned int nextRandom(unsigned int *seed)
+    // Advance the specified 'seed' and return its new value.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+extern "C" void *work(void *arg)
+    // Perform the work of the thread described by the specified 'arg' (the
+    // address of a 'Worker').
+{
+    Worker                   *worker  = static_cast<Worker *>(arg);
+    Shared&                   shared  = *worker->d_shared_p;
+    bdlbb::BlobBufferFactory *factory = shared.d_factory_p;
+    const int                 owner   = shared.d_remote
+                                ? (worker->d_index + 1) % shared.d_numThreads
+                                : worker->d_index;
+    bdlbb::BlobBuffer        *window  =
+                                   &(*shared.d_windows_p)[owner * k_WINDOW];
+    unsigned int              seed    = 1u + worker->d_index;
+
+    // Each thread fills its own window, then works on the window of 'owner'.
+    // Replacing a buffer releases the one it held, and touching the new
+    // buffer reflects that a buffer is allocated to be written.
+
+    bdlbb::BlobBuffer *own = &(*shared.d_windows_p)[worker->d_index
+                                                                * k_WINDOW];
+    for (int i = 0; i < k_WINDOW; ++i) {
+        factory->allocate(own + i);
+    }
+
+    shared.d_ready_p->wait();
+    shared.d_start_p->wait();
+
+    for (int i = 0; i < shared.d_numOperations; ++i) {
+        const unsigned int slot = nextRandom(&seed) % k_WINDOW;
+        factory->allocate(window + slot);
+        window[slot].data()[0] = static_cast<char>(i);
+    }
+
+    shared.d_stop_p->wait();
+
+    for (int i = 0; i < k_WINDOW; ++i) {
+        window[i].reset();
+    }
+    return 0;
+}
+
+double run(bdlbb::BlobBufferFactory *factory,
+           int                       numThreads,
+           int                       numOperations,
+           bool                      remote)
+    // Return the number of millions of allocate/release pairs per second
+    // performed by the specified 'numThreads' threads, each performing the
+    // specified 'numOperations' pairs on the specified 'factory', with
+    // buffers released by the allocating thread unless the specified 'remote'
+    // is 'true'.
+{
+    bslmt::Barrier                 ready(numThreads + 1);
+    bslmt::Barrier                 start(numThreads + 1);
+    bslmt::Barrier                 stop(numThreads + 1);
+    bsl::vector<bdlbb::BlobBuffer> windows(numThreads * k_WINDOW);
+    bsl::vector<Worker>            workers(numThreads);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+    Shared shared = { factory, &ready, &start, &stop, &windows,
+                      numThreads, numOperations, remote };
+
+    for (int i = 0; i < numThreads; ++i) {
+        workers[i].d_shared_p = &shared;
+        workers[i].d_index    = i;
+        bslmt::ThreadUtil::create(&handles[i], work, &workers[i]);
+    }
+
+    ready.wait();
+    bsls::Stopwatch timer;
+    timer.start();
+    start.wait();
+    stop.wait();
+    timer.stop();
+
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+
+    return static_cast<double>(numThreads) * numOperations
+         / timer.elapsedTime() / 1e6;
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    const int maxThreads    = argc > 1 ? bsl::atoi(argv[1]) : 64;
+    const int numOperations = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+    const int bufferSize    = argc > 3 ? bsl::atoi(argv[3]) : 4096;
+
+    bsl::printf("Buffers of %d bytes\n\n", bufferSize);
+
+    for (int remote = 0; remote < 2; ++remote) {
+        bsl::printf("%s releases, millions of allocate/release pairs per "
+                    "second\n",
+                    remote ? "Remote" : "Local");
+        bsl::printf("%8s %16s %16s %16s\n",
+                    "threads", "ThreadCaching", "Preallocated", "Pooled");
+
+        for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+            double result[3];
+            {
+                bdlbb::ThreadCachingBlobBufferFactory factory(bufferSize);
+                result[0] = run(&factory, numThreads, numOperations, remote);
+            }
+            {
+                // Preallocate the windows and what the caches may hold.
+
+                bdlbb::ThreadCachingBlobBufferFactory factory(
+                                             bufferSize,
+                                             numThreads * (k_WINDOW + 64));
+                result[1] = run(&factory, numThreads, numOperations, remote);
+            }
+            {
+                bdlbb::PooledBlobBufferFactory factory(bufferSize);
+                result[2] = run(&factory, numThreads, numOperations, remote);
+            }
+
+            bsl::printf("%8d %16.1f %16.1f %16.1f\n",
+                        numThreads, result[0], result[1], result[2]);
+        }
+        bsl::printf("\n");
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
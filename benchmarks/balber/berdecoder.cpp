@@ -0,0 +1,156 @@
+// berdecoder.cpp                                                     -*-C++-*-
+
+// This program measures the throughput of 'balber::BerDecoder' decoding
+// messages of the types generated in 'balb_testmessages', each encoded once
+// by 'balber::BerEncoder' and then decoded repeatedly from each of the inputs
+// that the decoder accepts: a 'bsl::streambuf' over the encoding, a
+// contiguous buffer, an 'bdlbb::InBlobStreamBuf', and a 'bdlbb::Blob' whose
+// buffers are of a specified size.  The fastest of several trials is reported
+// for each input.
+//
+// Usage: berdecoder [<decodings per message> [<blob buffer size>]]
+
+#include <balb_testmessages.h>
+
+#include <balber_berdecoder.h>
+#include <balber_berencoder.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include "../common/testmessageutil.h"
+
+using namespace BloombergLP;
+
+namespace {
+
+enum { k_NUM_TRIALS = 5 };  // timed runs per input, of which the fastest is
+                            // reported
+
+template <class TYPE>
+void measure(const char *name, const TYPE& value, int reps, int bufferSize)
+    // Print the number of times per second, and of megabytes per second, that
+    // the BER encoding of the specified 'value' is decoded from each input,
+    // decoding it the specified 'reps' times with each in each trial, and
+    // using blob buffers of the specified 'bufferSize'.
+{
+    bdlsb::MemOutStreamBuf osb;
+    balber::BerEncoder     encoder;
+    if (0 != encoder.encode(&osb, value)) {
+        bsl::printf("%s: encoding failed\n", name);
+        return;                                                       // RETURN
+    }
+    const char *data   = osb.data();
+    const int   length = static_cast<int>(osb.length());
+
+    bdlbb::PooledBlobBufferFactory factory(bufferSize);
+    bdlbb::Blob                    blob(&factory);
+    bdlbb::BlobUtil::append(&blob, data, length);
+
+    balber::BerDecoderOptions options;
+    double                    result[4] = { 0, 0, 0, 0 };
+
+    for (int trial = 0; trial < k_NUM_TRIALS * 4; ++trial) {
+        const int       input = trial % 4;
+        TYPE            decoded;
+        bsls::Stopwatch timer;
+        int             rc = 0;
+
+        timer.start();
+        for (int i = 0; i < reps; ++i) {
+            balber::BerDecoder decoder(&options);
+
+            switch (input) {
+              case 0: {
+                bdlsb::FixedMemInStreamBuf isb(data, length);
+                rc |= decoder.decode(&isb, &decoded);
+              } break;
+              case 1: {
+                rc |= decoder.decode(data, length, &decoded);
+              } break;
+              case 2: {
+                bdlbb::InBlobStreamBuf isb(&blob);
+                rc |= decoder.decode(&isb, &decoded);
+              } break;
+              default: {
+                rc |= decoder.decode(blob, &decoded);
+              } break;
+            }
+        }
+        timer.stop();
+
+        if (0 != rc || !(value == decoded)) {
+            bsl::printf("%s: decoding failed\n", name);
+            return;                                                   // RETURN
+        }
+        const double rate = reps / timer.elapsedTime();
+        if (rate > result[input]) {
+            result[input] = rate;
+        }
+    }
+
+    bsl::printf("%-8s %8d", name, length);
+    for (int input = 0; input < 4; ++input) {
+        bsl::printf(" %10.0f %6.1f",
+                    result[input],
+                    result[input] * length / (1024 * 1024));
+    }
+    bsl::printf("\n");
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    const int reps       = argc > 1 ? bsl::atoi(argv[1]) : 20000;
+    const int bufferSize = argc > 2 ? bsl::atoi(argv[2]) : 4096;
+
+    bsl::printf("Decodings per second and MB per second, blob buffers of %d "
+                "bytes\n\n",
+                bufferSize);
+    bsl::printf("%-8s %8s %17s %17s %17s %17s\n",
+                "message", "bytes",
+                "streambuf", "buffer", "InBlobStreamBuf", "blob");
+
+    balb::Request small;
+    benchmarks::TestMessageUtil::makeSmall(&small);
+    measure("small", small, reps * 10, bufferSize);
+
+    balb::Sequence4 medium;
+    benchmarks::TestMessageUtil::makeLarge(&medium, 16);
+    measure("medium", medium, reps, bufferSize);
+
+    balb::Sequence4 large;
+    benchmarks::TestMessageUtil::makeLarge(&large, 256);
+    measure("large", large, reps / 10, bufferSize);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
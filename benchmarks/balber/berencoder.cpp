@@ -0,0 +1,202 @@
+// berencoder.cpp                                                     -*-C++-*-
+
+// This program measures the throughput of 'balber::BerEncoder', and the number
+// of memory allocations it causes, encoding messages of the types generated
+// in 'balb_testmessages' to each kind of output: a new
+// 'bdlsb::MemOutStreamBuf' for each encoding (the most common use), a reused
+// 'bdlsb::MemOutStreamBuf', a 'bdlsb::FixedMemOutStreamBuf' over a buffer
+// allocated in advance, and a new 'bdlbb::Blob' for each encoding, whose
+// buffers, of a specified size, are supplied by a
+// 'bdlbb::PooledBlobBufferFactory'.  The fastest of several trials is
+// reported for each output.
+//
+// Usage: berencoder [<encodings per message> [<blob buffer size>]]
+
+#include <balb_testmessages.h>
+
+#include <balber_berencoder.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+
+#include <bdlsb_fixedmemoutstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include "../common/testmessageutil.h"
+
+using namespace BloombergLP;
+
+namespace {
+
+enum { k_NUM_OUTPUTS = 4 };  // kinds of output measured
+
+enum { k_NUM_TRIALS = 5 };   // timed runs per output, of which the fastest is
+                             // reported
+
+template <class TYPE>
+int encode(int                             output,
+           const TYPE&                     value,
+           bdlsb::MemOutStreamBuf         *reused,
+           char                           *buffer,
+           int                             bufferLength,
+           bdlbb::PooledBlobBufferFactory *factory,
+           bslma::Allocator               *allocator)
+    // Encode the specified 'value' to the specified kind of 'output', using
+    // the specified 'reused' stream buffer, 'buffer' of the specified
+    // 'bufferLength', or blob buffer 'factory', as appropriate, and the
+    // specified 'allocator' to supply memory (or the default allocator if
+    // 'allocator' is 0).  Return the number of bytes of the encoding, or -1
+    // on failure.
+{
+    balber::BerEncoder encoder(0, allocator);
+
+    switch (output) {
+      case 0: {
+        bdlsb::MemOutStreamBuf osb(allocator);
+        return 0 == encoder.encode(&osb, value)
+               ? static_cast<int>(osb.length())
+               : -1;                                                  // RETURN
+      }
+      case 1: {
+        reused->pubseekpos(0);
+        return 0 == encoder.encode(reused, value)
+               ? static_cast<int>(reused->length())
+               : -1;                                                  // RETURN
+      }
+      case 2: {
+        bdlsb::FixedMemOutStreamBuf osb(buffer, bufferLength);
+        return 0 == encoder.encode(&osb, value)
+               ? static_cast<int>(osb.length())
+               : -1;                                                  // RETURN
+      }
+      default: {
+        bdlbb::Blob blob(factory, allocator);
+        return 0 == encoder.encode(&blob, value) ? blob.length() : -1;
+                                                                      // RETURN
+      }
+    }
+}
+
+template <class TYPE>
+void measure(const char *name, const TYPE& value, int reps, int bufferSize)
+    // Print the number of times per second that the specified 'value' is
+    // encoded to each kind of output, encoding it the specified 'reps' times
+    // to each in each trial and using blob buffers of the specified
+    // 'bufferSize', followed by the number of memory allocations per encoding
+    // to each.
+{
+    enum { k_BUFFER_LENGTH = 1024 * 1024 };
+
+    static char buffer[k_BUFFER_LENGTH];
+
+    double rate[k_NUM_OUTPUTS]        = { 0, 0, 0, 0 };
+    double allocations[k_NUM_OUTPUTS] = { 0, 0, 0, 0 };
+    int    length                     = -1;
+
+    // Count the allocations, through a test allocator, once the reused stream
+    // buffer and the blob buffer factory have reached their steady state.
+
+    bslma::TestAllocator           counter;
+    bdlsb::MemOutStreamBuf         countedReused(&counter);
+    bdlbb::PooledBlobBufferFactory countedFactory(bufferSize, &counter);
+
+    for (int output = 0; output < k_NUM_OUTPUTS; ++output) {
+        encode(output, value, &countedReused, buffer, k_BUFFER_LENGTH,
+               &countedFactory, &counter);
+
+        const bsls::Types::Int64 before = counter.numAllocations();
+        for (int i = 0; i < 100; ++i) {
+            length = encode(output, value, &countedReused, buffer,
+                            k_BUFFER_LENGTH, &countedFactory, &counter);
+        }
+        allocations[output] = (counter.numAllocations() - before) / 100.0;
+
+        if (length < 0) {
+            bsl::printf("%s: encoding failed\n", name);
+            return;                                                   // RETURN
+        }
+    }
+
+    // Measure the throughput with the default allocator.
+
+    bdlsb::MemOutStreamBuf         reused;
+    bdlbb::PooledBlobBufferFactory factory(bufferSize);
+
+    for (int trial = 0; trial < k_NUM_TRIALS * k_NUM_OUTPUTS; ++trial) {
+        const int       output = trial % k_NUM_OUTPUTS;
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int i = 0; i < reps; ++i) {
+            encode(output, value, &reused, buffer, k_BUFFER_LENGTH, &factory,
+                   0);
+        }
+        timer.stop();
+
+        const double result = reps / timer.elapsedTime();
+        if (result > rate[output]) {
+            rate[output] = result;
+        }
+    }
+
+    bsl::printf("%-8s %8d", name, length);
+    for (int output = 0; output < k_NUM_OUTPUTS; ++output) {
+        bsl::printf(" %10.0f %6.1f", rate[output], allocations[output]);
+    }
+    bsl::printf("\n");
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    const int reps       = argc > 1 ? bsl::atoi(argv[1]) : 20000;
+    const int bufferSize = argc > 2 ? bsl::atoi(argv[2]) : 4096;
+
+    bsl::printf("Encodings per second and allocations per encoding, blob "
+                "buffers of %d bytes\n\n",
+                bufferSize);
+    bsl::printf("%-8s %8s %17s %17s %17s %17s\n",
+                "message", "bytes",
+                "MemOutStreamBuf", "reused", "FixedMemOut", "blob");
+
+    balb::Request small;
+    benchmarks::TestMessageUtil::makeSmall(&small);
+    measure("small", small, reps * 10, bufferSize);
+
+    balb::Sequence4 medium;
+    benchmarks::TestMessageUtil::makeLarge(&medium, 16);
+    measure("medium", medium, reps, bufferSize);
+
+    balb::Sequence4 large;
+    benchmarks::TestMessageUtil::makeLarge(&large, 256);
+    measure("large", large, reps / 10, bufferSize);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
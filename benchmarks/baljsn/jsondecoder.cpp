@@ -0,0 +1,134 @@
+// jsondecoder.cpp                                                    -*-C++-*-
+
+// This program measures the throughput of 'baljsn::Decoder' decoding messages
+// of the types generated in 'balb_testmessages', each encoded once by
+// 'baljsn::Encoder' in the compact style and then decoded repeatedly from a
+// 'bdlsb::FixedMemInStreamBuf'.  Besides the messages of the encoder
+// benchmark, two "wide" messages are decoded, in which every attribute of
+// sequences having many attributes ('balb::Sequence4' and 'balb::Sequence6')
+// is present, so that the lookup of attribute names is a significant part of
+// decoding.  The fastest of several trials is reported for each message.
+//
+// Usage: jsondecoder [<decodings per message>]
+
+#include <balb_testmessages.h>
+
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+#include <baljsn_encoder.h>
+#include <baljsn_encoderoptions.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include "../common/testmessageutil.h"
+
+using namespace BloombergLP;
+
+namespace {
+
+enum { k_NUM_TRIALS = 5 };  // timed runs per message, of which the fastest
+                            // is reported
+
+template <class TYPE>
+void measure(const char *name, const TYPE& value, int reps)
+    // Print the number of times per second, and of megabytes per second, that
+    // the compact JSON encoding of the specified 'value' is decoded, decoding
+    // it the specified 'reps' times in each trial.
+{
+    bdlsb::MemOutStreamBuf osb;
+    baljsn::Encoder        encoder;
+    if (0 != encoder.encode(&osb, value, baljsn::EncoderOptions())) {
+        bsl::printf("%s: encoding failed\n", name);
+        return;                                                       // RETURN
+    }
+    const char *data   = osb.data();
+    const int   length = static_cast<int>(osb.length());
+
+    const baljsn::DecoderOptions options;
+    double                       result = 0;
+
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        TYPE            decoded;
+        bsls::Stopwatch timer;
+        int             rc = 0;
+
+        timer.start();
+        for (int i = 0; i < reps; ++i) {
+            baljsn::Decoder            decoder;
+            bdlsb::FixedMemInStreamBuf isb(data, length);
+            rc |= decoder.decode(&isb, &decoded, options);
+        }
+        timer.stop();
+
+        if (0 != rc || !(value == decoded)) {
+            bsl::printf("%s: decoding failed\n", name);
+            return;                                                   // RETURN
+        }
+        const double rate = reps / timer.elapsedTime();
+        if (rate > result) {
+            result = rate;
+        }
+    }
+
+    bsl::printf("%-8s %8d %12.0f %8.1f\n",
+                name,
+                length,
+                result,
+                result * length / (1024 * 1024));
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    const int reps = argc > 1 ? bsl::atoi(argv[1]) : 20000;
+
+    bsl::printf("%-8s %8s %12s %8s\n",
+                "message", "bytes", "decodings/s", "MB/s");
+
+    balb::Request small;
+    benchmarks::TestMessageUtil::makeSmall(&small);
+    measure("small", small, reps * 10);
+
+    balb::Sequence4 medium;
+    benchmarks::TestMessageUtil::makeLarge(&medium, 16);
+    measure("medium", medium, reps);
+
+    balb::Sequence4 large;
+    benchmarks::TestMessageUtil::makeLarge(&large, 256);
+    measure("large", large, reps / 10);
+
+    balb::Sequence4 wide4;
+    benchmarks::TestMessageUtil::makeWide(&wide4);
+    measure("wide4", wide4, reps * 2);
+
+    balb::Sequence6 wide6;
+    benchmarks::TestMessageUtil::makeWide(&wide6);
+    measure("wide6", wide6, reps * 5);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,185 @@
+// xmldecoder.cpp                                                     -*-C++-*-
+
+// This program measures the throughput of 'balxml::Decoder' decoding messages
+// of the types generated in 'balb_testmessages', each encoded once by
+// 'balxml::Encoder' and then decoded repeatedly from a
+// 'bdlsb::FixedMemInStreamBuf', using a 'balxml::MiniReader'.  Besides
+// messages holding arrays of most primitive types, two "wide" messages are
+// decoded, in which every attribute of sequences having many attributes
+// ('balb::Sequence4' and 'balb::Sequence6') is present, so that the lookup of
+// attribute names is a significant part of decoding, and documents of about a
+// megabyte, in the compact and the pretty styles, are decoded, so that
+// scanning the markup is.  The throughput of the 'balxml::MiniReader' alone,
+// reading every node of each message, is also reported.  The fastest of
+// several trials is reported for each measurement.
+//
+// Usage: xmldecoder [<decodings per message>]
+
+#include <balb_testmessages.h>
+
+#include <balxml_decoder.h>
+#include <balxml_decoderoptions.h>
+#include <balxml_encoder.h>
+#include <balxml_encoderoptions.h>
+#include <balxml_errorinfo.h>
+#include <balxml_minireader.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include "../common/testmessageutil.h"
+
+using namespace BloombergLP;
+
+namespace {
+
+enum { k_NUM_TRIALS = 5 };  // timed runs per message, of which the fastest
+                            // is reported
+
+template <class TYPE>
+void measure(const char   *name,
+             const TYPE&   value,
+             int           reps,
+             bool          pretty = false)
+    // Print the number of times per second, and of megabytes per second, that
+    // the XML encoding of the specified 'value' is decoded, decoding it the
+    // specified 'reps' times in each trial, followed by the number of
+    // megabytes per second that a 'balxml::MiniReader' reads it.  Optionally
+    // specify 'pretty' to encode 'value' in the pretty style, indented and
+    // having one element on each line; otherwise, it is encoded in the
+    // compact style.
+{
+    balxml::EncoderOptions encoderOptions;
+    if (pretty) {
+        encoderOptions.setEncodingStyle(balxml::EncodingStyle::e_PRETTY);
+    }
+
+    bdlsb::MemOutStreamBuf osb;
+    balxml::Encoder        encoder(&encoderOptions);
+    if (0 != encoder.encode(&osb, value)) {
+        bsl::printf("%s: encoding failed\n", name);
+        return;                                                       // RETURN
+    }
+    const char *data   = osb.data();
+    const int   length = static_cast<int>(osb.length());
+
+    const balxml::DecoderOptions options;
+    balxml::MiniReader           reader;
+    balxml::ErrorInfo            errorInfo;
+    double                       result     = 0;
+    double                       readerRate = 0;
+
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        bsls::Stopwatch timer;
+        int             rc = 0;
+
+        timer.start();
+        for (int i = 0; i < reps; ++i) {
+            bdlsb::FixedMemInStreamBuf isb(data, length);
+            reader.open(&isb, 0, 0);
+            while (0 == (rc = reader.advanceToNextNode())) {
+            }
+            reader.close();
+        }
+        timer.stop();
+
+        if (1 != rc) {
+            bsl::printf("%s: reading failed\n", name);
+            return;                                                   // RETURN
+        }
+        const double rate = reps / timer.elapsedTime();
+        if (rate > readerRate) {
+            readerRate = rate;
+        }
+    }
+
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        TYPE            decoded;
+        bsls::Stopwatch timer;
+        int             rc = 0;
+
+        timer.start();
+        for (int i = 0; i < reps; ++i) {
+            balxml::Decoder            decoder(&options, &reader, &errorInfo);
+            bdlsb::FixedMemInStreamBuf isb(data, length);
+            rc |= decoder.decode(&isb, &decoded);
+        }
+        timer.stop();
+
+        if (0 != rc || !(value == decoded)) {
+            bsl::printf("%s: decoding failed\n", name);
+            return;                                                   // RETURN
+        }
+        const double rate = reps / timer.elapsedTime();
+        if (rate > result) {
+            result = rate;
+        }
+    }
+
+    bsl::printf("%-8s %8d %12.0f %8.1f %10.1f\n",
+                name,
+                length,
+                result,
+                result * length / (1024 * 1024),
+                readerRate * length / (1024 * 1024));
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    const int reps = argc > 1 ? bsl::atoi(argv[1]) : 20000;
+
+    bsl::printf("%-8s %8s %12s %8s %10s\n",
+                "message", "bytes", "decodings/s", "MB/s", "reader MB/s");
+
+    balb::Request small;
+    benchmarks::TestMessageUtil::makeSmall(&small);
+    measure("small", small, reps * 10);
+
+    balb::Sequence4 medium;
+    benchmarks::TestMessageUtil::makeLarge(&medium, 16);
+    measure("medium", medium, reps);
+
+    balb::Sequence4 large;
+    benchmarks::TestMessageUtil::makeLarge(&large, 256);
+    measure("large", large, reps / 10);
+
+    balb::Sequence4 wide4;
+    benchmarks::TestMessageUtil::makeWide(&wide4);
+    measure("wide4", wide4, reps * 2);
+
+    balb::Sequence6 wide6;
+    benchmarks::TestMessageUtil::makeWide(&wide6);
+    measure("wide6", wide6, reps * 5);
+
+    balb::Sequence4 huge;
+    benchmarks::TestMessageUtil::makeLarge(&huge, 4096);
+    measure("huge", huge, reps / 200 + 1);
+    measure("pretty", huge, reps / 200 + 1, true);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
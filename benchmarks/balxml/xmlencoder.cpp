@@ -0,0 +1,206 @@
+// xmlencoder.cpp                                                     -*-C++-*-
+
+// This program measures the throughput of 'balxml::Encoder', and the number of
+// memory allocations it causes, encoding messages of the types generated in
+// 'balb_testmessages' in the compact and the pretty styles to each kind of
+// output: a new 'bdlsb::MemOutStreamBuf' for each encoding (the most common
+// use), a reused 'bdlsb::MemOutStreamBuf', and a 'bdlsb::FixedMemOutStreamBuf'
+// over a buffer allocated in advance.  The fastest of several trials is
+// reported for each output.
+//
+// Usage: xmlencoder [<encodings per message>]
+
+#include <balb_testmessages.h>
+
+#include <balxml_encoder.h>
+#include <balxml_encoderoptions.h>
+#include <balxml_encodingstyle.h>
+
+#include <bdlsb_fixedmemoutstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#include "../common/testmessageutil.h"
+
+using namespace BloombergLP;
+
+namespace {
+
+enum { k_NUM_OUTPUTS = 3 };  // kinds of output measured
+
+enum { k_NUM_TRIALS = 5 };   // timed runs per output, of which the fastest is
+                             // reported
+
+template <class TYPE>
+int encode(int                            output,
+           const TYPE&                    value,
+           const balxml::EncoderOptions&  options,
+           bdlsb::MemOutStreamBuf        *reused,
+           char                          *buffer,
+           int                            bufferLength,
+           bslma::Allocator              *allocator)
+    // Encode the specified 'value' with the specified 'options' to the
+    // specified kind of 'output', using the specified 'reused' stream buffer
+    // or 'buffer' of the specified 'bufferLength', as appropriate, and the
+    // specified 'allocator' to supply memory.  Return the number of bytes of the encoding, or -1
+    // on failure.
+{
+    balxml::Encoder encoder(&options, allocator);
+
+    switch (output) {
+      case 0: {
+        bdlsb::MemOutStreamBuf osb(allocator);
+        return 0 == encoder.encode(&osb, value)
+               ? static_cast<int>(osb.length())
+               : -1;                                                  // RETURN
+      }
+      case 1: {
+        reused->pubseekpos(0);
+        return 0 == encoder.encode(reused, value)
+               ? static_cast<int>(reused->length())
+               : -1;                                                  // RETURN
+      }
+      default: {
+        bdlsb::FixedMemOutStreamBuf osb(buffer, bufferLength);
+        return 0 == encoder.encode(&osb, value)
+               ? static_cast<int>(osb.length())
+               : -1;                                                  // RETURN
+      }
+    }
+}
+
+template <class TYPE>
+void measure(const char  *name,
+             const TYPE&  value,
+             int          reps,
+             bool         pretty = false)
+    // Print the number of times per second that the specified 'value' is
+    // encoded to each kind of output, encoding it the specified 'reps' times
+    // to each in each trial, followed by the number of memory allocations per
+    // encoding to each.  Optionally specify 'pretty' to encode 'value' in the
+    // pretty style, indented and having one element on each line; otherwise,
+    // it is encoded in the compact style.
+{
+    enum { k_BUFFER_LENGTH = 4 * 1024 * 1024 };
+
+    static char buffer[k_BUFFER_LENGTH];
+
+    balxml::EncoderOptions options;
+    if (pretty) {
+        options.setEncodingStyle(balxml::EncodingStyle::e_PRETTY);
+    }
+
+    double rate[k_NUM_OUTPUTS]        = { 0, 0, 0 };
+    double allocations[k_NUM_OUTPUTS] = { 0, 0, 0 };
+    int    length                     = -1;
+
+    // Count the allocations, through a test allocator that is also installed
+    // as the default allocator, once the reused stream buffer has reached its
+    // steady state.
+
+    bslma::TestAllocator         counter;
+    bslma::DefaultAllocatorGuard guard(&counter);
+    bdlsb::MemOutStreamBuf       countedReused(&counter);
+
+    for (int output = 0; output < k_NUM_OUTPUTS; ++output) {
+        encode(output, value, options, &countedReused, buffer,
+               k_BUFFER_LENGTH, &counter);
+
+        const bsls::Types::Int64 before = counter.numAllocations();
+        for (int i = 0; i < 10; ++i) {
+            length = encode(output, value, options, &countedReused, buffer,
+                            k_BUFFER_LENGTH, &counter);
+        }
+        allocations[output] = (counter.numAllocations() - before) / 10.0;
+
+        if (length < 0) {
+            bsl::printf("%s: encoding failed\n", name);
+            return;                                                   // RETURN
+        }
+    }
+
+    // Measure the throughput with the global allocator.
+
+    bslma::Allocator       *global = &bslma::NewDeleteAllocator::singleton();
+    bdlsb::MemOutStreamBuf  reused(global);
+
+    for (int trial = 0; trial < k_NUM_TRIALS * k_NUM_OUTPUTS; ++trial) {
+        const int       output = trial % k_NUM_OUTPUTS;
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int i = 0; i < reps; ++i) {
+            encode(output, value, options, &reused, buffer, k_BUFFER_LENGTH,
+                   global);
+        }
+        timer.stop();
+
+        const double result = reps / timer.elapsedTime();
+        if (result > rate[output]) {
+            rate[output] = result;
+        }
+    }
+
+    bsl::printf("%-8s %8d", name, length);
+    for (int output = 0; output < k_NUM_OUTPUTS; ++output) {
+        bsl::printf(" %10.0f %6.1f", rate[output], allocations[output]);
+    }
+    bsl::printf(" %8.1f\n", rate[2] * length / (1024 * 1024));
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    const int reps = argc > 1 ? bsl::atoi(argv[1]) : 20000;
+
+    bsl::printf("Encodings per second and allocations per encoding\n\n");
+    bsl::printf("%-8s %8s %17s %17s %17s %8s\n",
+                "message", "bytes",
+                "MemOutStreamBuf", "reused", "FixedMemOut", "MB/s");
+
+    balb::Request small;
+    benchmarks::TestMessageUtil::makeSmall(&small);
+    measure("small", small, reps * 10);
+
+    balb::Sequence4 medium;
+    benchmarks::TestMessageUtil::makeLarge(&medium, 16);
+    measure("medium", medium, reps);
+
+    balb::Sequence4 large;
+    benchmarks::TestMessageUtil::makeLarge(&large, 256);
+    measure("large", large, reps / 10);
+    measure("pretty", large, reps / 10, true);
+
+    balb::Sequence4 wide;
+    benchmarks::TestMessageUtil::makeWide(&wide);
+    measure("wide", wide, reps * 2);
+
+    return 0;
+}
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
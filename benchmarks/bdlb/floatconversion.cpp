@@ -0,0 +1,238 @@
+// floatconversion.cpp                                                -*-C++-*-
+
+// This program measures the throughput of 'bdlb::FloatConversionUtil', which
+// parses and formats 'double' values without copying, allocating, or
+// consulting the locale, against the standard library functions that it
+// replaces: 'strtod' for parsing (on a null-terminated copy of the text, as
+// its callers must make), and 'snprintf' and 'bsl::ostream' for formatting.
+// Two sets of values are converted: the values of random bit patterns (which
+// mostly need 16 or 17 significant digits), and decimal values having at
+// most 6 significant digits, as found in most messages.  The fastest of
+// several trials is reported for each conversion, in millions of conversions
+// per second.
+//
+// Usage: floatconversion [<conversions> [<distinct values>]]
+
+#include <bdlb_floatconversionutil.h>
+
+#include <bdlsb_fixedmemoutstreambuf.h>
+
+#include <bslstl_stringref.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iomanip.h>
+#include <bsl_ostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+enum { k_NUM_TRIALS = 5 };   // timed runs per conversion, of which the
+                             // fastest is reported
+
+enum { k_TEXT_LENGTH = 32 };  // space for the text of one value
+
+typedef bdlb::FloatConversionUtil Util;
+
+enum Conversion {
+    e_STRTOD,
+    e_PARSE_DOUBLE,
+    e_SNPRINTF_17G,
+    e_OSTREAM_17,
+    e_FORMAT_SHORTEST,
+    e_SNPRINTF_15G,
+    e_FORMAT_GENERAL_15,
+    k_NUM_CONVERSIONS
+};
+
+const char *const k_NAMES[k_NUM_CONVERSIONS] = {
+    "strtod",
+    "parseDouble",
+    "snprintf %.17g",
+    "ostream 17",
+    "formatShortest",
+    "snprintf %.15g",
+    "formatGeneral 15"
+};
+
+bsls::Types::Uint64 nextRandom(bsls::Types::Uint64 *seed)
+    // Advance the specified 'seed' and return its new value.
+{
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *seed;
+}
+
+void makeValues(bsl::vector<double> *values, int numValues, bool decimal)
+    // Load into the specified 'values' the specified 'numValues' values, of
+    // random finite bit patterns if the specified 'decimal' is 'false', and
+    // of random decimal values of at most 6 significant digits otherwise.
+{
+    bsls::Types::Uint64 seed = 12345;
+
+    values->clear();
+    while (static_cast<int>(values->size()) < numValues) {
+        const bsls::Types::Uint64 bits = nextRandom(&seed);
+        double                    value;
+        if (decimal) {
+            const int digits   = static_cast<int>(bits % 1000000);
+            const int exponent = static_cast<int>((bits >> 32) % 9) - 6;
+            value = digits;
+            for (int i = 0; i < exponent; ++i) {
+                value *= 10;
+            }
+            for (int i = 0; i > exponent; --i) {
+                value /= 10;
+            }
+        }
+        else {
+            bsl::memcpy(&value, &bits, sizeof value);
+            if (value != value || value - value != 0) {
+                continue;                                           // CONTINUE
+            }
+        }
+        values->push_back(value);
+    }
+}
+
+double convert(Conversion                 conversion,
+               const bsl::vector<double>& values,
+               const bsl::vector<char>&   texts,
+               int                        numConversions)
+    // Perform the specified 'conversion' the specified 'numConversions'
+    // times, cycling through the specified 'values' and their null-terminated
+    // shortest 'texts', each of 'k_TEXT_LENGTH' characters, and return the
+    // number of millions of conversions per second.
+{
+    const int numValues = static_cast<int>(values.size());
+    char      buffer[k_TEXT_LENGTH];
+    double    sum       = 0;
+
+    bdlsb::FixedMemOutStreamBuf streamBuf(buffer, sizeof buffer);
+    bsl::ostream                stream(&streamBuf);
+    stream << bsl::setprecision(17);
+
+    bsls::Stopwatch timer;
+    timer.start();
+
+    for (int i = 0; i < numConversions; ++i) {
+        const int   index = i % numValues;
+        const char *text  = &texts[index * k_TEXT_LENGTH];
+
+        switch (conversion) {
+          case e_STRTOD: {
+            const bsl::size_t length = bsl::strlen(text);
+            bsl::memcpy(buffer, text, length + 1);
+            sum += bsl::strtod(buffer, 0);
+          } break;
+          case e_PARSE_DOUBLE: {
+            double value = 0;
+            Util::parseDouble(&value, bslstl::StringRef(text));
+            sum += value;
+          } break;
+          case e_SNPRINTF_17G: {
+            sum += bsl::snprintf(buffer, sizeof buffer, "%.17g",
+                                 values[index]);
+          } break;
+          case e_OSTREAM_17: {
+            streamBuf.pubseekpos(0);
+            stream << values[index];
+            sum += static_cast<double>(streamBuf.length());
+          } break;
+          case e_FORMAT_SHORTEST: {
+            sum += Util::formatShortest(buffer, values[index]);
+          } break;
+          case e_SNPRINTF_15G: {
+            sum += bsl::snprintf(buffer, sizeof buffer, "%.15g",
+                                 values[index]);
+          } break;
+          default: {
+            sum += Util::formatGeneral(buffer, values[index], 15);
+          } break;
+        }
+    }
+
+    timer.stop();
+
+    if (sum == 0.123456789) {
+        // Make use of the results, so that they are not optimized away.
+
+        bsl::printf("\n");
+    }
+    return numConversions / timer.elapsedTime() / 1e6;
+}
+
+void measure(const char *name, int numConversions, int numValues, bool decimal)
+    // Print the number of millions of conversions per second of each
+    // conversion, performing the specified 'numConversions' conversions of
+    // the specified 'numValues' values, of the kind indicated by the
+    // specified 'decimal', described by the specified 'name'.
+{
+    bsl::vector<double> values;
+    makeValues(&values, numValues, decimal);
+
+    bsl::vector<char> texts(values.size() * k_TEXT_LENGTH);
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        char      *text   = &texts[i * k_TEXT_LENGTH];
+        const int  length = Util::formatShortest(text, values[i]);
+        text[length] = '\0';
+    }
+
+    double rate[k_NUM_CONVERSIONS] = { 0 };
+    for (int trial = 0; trial < k_NUM_TRIALS * k_NUM_CONVERSIONS; ++trial) {
+        const Conversion conversion =
+                           static_cast<Conversion>(trial % k_NUM_CONVERSIONS);
+
+        const double result = convert(conversion,
+                                      values,
+                                      texts,
+                                      numConversions);
+        if (result > rate[conversion]) {
+            rate[conversion] = result;
+        }
+    }
+
+    bsl::printf("%s values, millions of conversions per second\n", name);
+    for (int i = 0; i < k_NUM_CONVERSIONS; ++i) {
+        bsl::printf("    %-20s %8.2f\n", k_NAMES[i], rate[i]);
+    }
+    bsl::printf("\n");
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    const int numConversions = argc > 1 ? bsl::atoi(argv[1]) : 10000000;
+    const int numValues      = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+    bsl::printf("%d conversions of %d distinct values\n\n",
+                numConversions,
+                numValues);
+
+    measure("Random", numConversions, numValues, false);
+    measure("Decimal", numConversions, numValues, true);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
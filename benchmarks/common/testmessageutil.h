@@ -0,0 +1,169 @@
+// testmessageutil.h                                                  -*-C++-*-
+#ifndef INCLUDED_TESTMESSAGEUTIL
+#define INCLUDED_TESTMESSAGEUTIL
+
+// This header provides the messages, of the types generated in
+// 'balb_testmessages', on which the codec benchmarks are measured, so that
+// the BER, JSON, and XML benchmarks encode and decode the same values.  It is
+// included by relative path from each benchmark program, and needs no build
+// settings other than those of the program.
+
+#include <balb_testmessages.h>
+
+#include <bdlb_nullablevalue.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace benchmarks {
+
+                           // ======================
+                           // struct TestMessageUtil
+                           // ======================
+
+struct TestMessageUtil {
+    // This 'struct' provides a namespace for functions that load the messages
+    // used by the codec benchmarks.
+
+    // CLASS METHODS
+    static void makeLarge(balb::Sequence4 *value, int size);
+        // Load into the specified 'value' a message having arrays of the
+        // specified 'size' of most of the primitive types supported by the
+        // codecs, and 'size / 4' nested sequences.
+
+    static void makeSequence3(balb::Sequence3 *value, int index);
+        // Load into the specified 'value' a 'balb::Sequence3' whose contents
+        // depend on the specified 'index'.
+
+    static void makeSmall(balb::Request *value);
+        // Load into the specified 'value' a small request, with one string and
+        // one integer.
+
+    static void makeWide(balb::Sequence4 *value);
+        // Load into the specified 'value' a message in which each of the 19
+        // attributes of 'balb::Sequence4' is present, with short values.
+
+    static void makeWide(balb::Sequence6 *value);
+        // Load into the specified 'value' a message in which each of the 15
+        // attributes of 'balb::Sequence6' is present, with short values.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // struct TestMessageUtil
+                           // ----------------------
+
+// CLASS METHODS
+inline
+void TestMessageUtil::makeLarge(balb::Sequence4 *value, int size)
+{
+    const bdlt::DatetimeTz datetime(bdlt::Datetime(2020, 6, 1, 12, 30, 45,
+                                                   123),
+                                    -240);
+
+    value->element1().resize(size / 4);
+    for (int i = 0; i < size / 4; ++i) {
+        makeSequence3(&value->element1()[i], i);
+    }
+    value->element9()  = "a string of a modest length";
+    value->element10() = 3.25;
+    value->element11().assign(size * 8, 'x');
+    value->element12() = 123456;
+    for (int i = 0; i < size; ++i) {
+        value->element14().push_back(0 == i % 3);
+        value->element15().push_back(i * 1.5);
+        value->element16().push_back(bsl::vector<char>(32, 'y'));
+        value->element17().push_back(i * 1237);
+        value->element18().push_back(datetime);
+        value->element19().push_back(balb::CustomString("custom"));
+    }
+}
+
+inline
+void TestMessageUtil::makeSequence3(balb::Sequence3 *value, int index)
+{
+    for (int i = 0; i < 4; ++i) {
+        const int city = (index + i) % 3;
+        value->element1().push_back(
+                                 static_cast<balb::Enumerated::Value>(city));
+        value->element2().push_back(bsl::string("an element of some length"));
+    }
+    value->element3().makeValue(0 == index % 2);
+    value->element4().makeValue(bsl::string("optional string"));
+}
+
+inline
+void TestMessageUtil::makeSmall(balb::Request *value)
+{
+    balb::SimpleRequest& request = value->makeSimpleRequest();
+    request.data()           = "The quick brown fox jumps over the lazy dog";
+    request.responseLength() = 1024;
+}
+
+inline
+void TestMessageUtil::makeWide(balb::Sequence4 *value)
+{
+    const bdlt::DatetimeTz datetime(bdlt::Datetime(2020, 6, 1, 12, 30, 45,
+                                                   123),
+                                    -240);
+
+    makeLarge(value, 4);
+    value->element2().resize(1);
+    value->element2()[0].makeSelection1(42);
+    value->element3().makeValue(bsl::vector<char>(3, 'z'));
+    value->element4().makeValue(7);
+    value->element5().makeValue(datetime);
+    value->element6().makeValue(balb::CustomString("custom"));
+    value->element7().makeValue(balb::Enumerated::NEW_YORK);
+    value->element8()  = true;
+    value->element13() = balb::Enumerated::LONDON;
+}
+
+inline
+void TestMessageUtil::makeWide(balb::Sequence6 *value)
+{
+    value->element1().makeValue(1);
+    value->element2().makeValue(balb::CustomString("custom"));
+    value->element3().makeValue(balb::CustomInt(3));
+    value->element4()  = 4;
+    value->element5()  = 5;
+    value->element6().push_back(bdlb::NullableValue<balb::CustomInt>(
+                                                          balb::CustomInt(6)));
+    value->element7()  = balb::CustomString("seven");
+    value->element8()  = balb::CustomInt(8);
+    value->element9().makeValue(9);
+    value->element10().assign(4, 10);
+    value->element11().push_back(balb::CustomString("eleven"));
+    value->element12().push_back(12);
+    value->element13().push_back(bdlb::NullableValue<unsigned char>(13));
+    value->element14().push_back(balb::CustomInt(14));
+    value->element15().push_back(bdlb::NullableValue<unsigned int>(15));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -24,9 +24,20 @@ BSLS_IDENT("$Id: $")
 // that contains a parameterized 'decode' function.  The 'decode' function
 // decodes data read from a specified stream and loads the corresponding object
 // to an object of the parameterized type.  The 'decode' method is overloaded
-// for two types of input streams:
+// for four types of input:
 //: o 'bsl::streambuf'
 //: o 'bsl::istream'
+//: o a contiguous buffer
+//: o 'bdlbb::Blob'
+//
+// The decoder reads most of its input a byte at a time through the inline,
+// non-virtual 'sbumpc' of 'bsl::streambuf', which calls a virtual function
+// only when it reaches the end of the get area of the stream buffer.  Its
+// performance therefore depends on the size of that get area.  The overloads
+// taking a buffer or a blob read the whole of a contiguous buffer, or of each
+// buffer of a blob, through a single get area, and are the fastest way to
+// decode data that is already in memory.  Strings and octet strings are read
+// in bulk, by a single 'sgetn' each.
 //
 // This class decodes objects based on the X.690 BER specification and is
 // restricted to types supported by the 'bdlat' framework.
@@ -110,6 +121,10 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_variant.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bsls_assert.h>
@@ -265,6 +280,23 @@ class BerDecoder {
         // Return 0 on success, and a non-zero value otherwise.  If the
         // decoding fails 'stream' will be invalidated.
 
+    template <typename TYPE>
+    int decode(const char *buffer, int length, TYPE *variable);
+        // Decode an object of parameterized 'TYPE' from the specified 'buffer'
+        // of the specified 'length' and load the result into the specified
+        // 'variable'.  Return 0 on success, and a non-zero value otherwise.
+        // The behavior is undefined unless '0 <= length'.  Note that the
+        // whole of 'buffer' is read through a single get area, so that no
+        // byte of the encoding is read through a virtual function.
+
+    template <typename TYPE>
+    int decode(const bdlbb::Blob& blob, TYPE *variable);
+        // Decode an object of parameterized 'TYPE' from the data of the
+        // specified 'blob' and load the result into the specified 'variable'.
+        // Return 0 on success, and a non-zero value otherwise.  Note that the
+        // data of each buffer of 'blob' is read in place, through a single
+        // get area, without being copied.
+
     void setNumUnknownElementsSkipped(int value);
         // Set the number of unknown elements skipped by the decoder during the
         // current decoding operation to the specified 'value'.  The behavior
@@ -626,6 +658,24 @@ int BerDecoder::decode(bsl::istream& stream, TYPE *variable)
     return 0;
 }
 
+template <typename TYPE>
+inline
+int BerDecoder::decode(const char *buffer, int length, TYPE *variable)
+{
+    BSLS_ASSERT(0 <= length);
+
+    bdlsb::FixedMemInStreamBuf streamBuf(buffer, length);
+    return this->decode(&streamBuf, variable);
+}
+
+template <typename TYPE>
+inline
+int BerDecoder::decode(const bdlbb::Blob& blob, TYPE *variable)
+{
+    bdlbb::InBlobStreamBuf streamBuf(&blob);
+    return this->decode(&streamBuf, variable);
+}
+
 template <typename TYPE>
 int BerDecoder::decode(bsl::streambuf *streamBuf, TYPE *variable)
 {
@@ -21,6 +21,10 @@
 #include <bdlsb_memoutstreambuf.h>      // for testing only
 #include <bdlsb_fixedmeminstreambuf.h>  // for testing only
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
 #include <bslma_allocator.h>
 
 #include <bsls_objectbuffer.h>
@@ -12277,7 +12281,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 21: {
+      case 22: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   Extracted from component header file.
@@ -12302,6 +12306,105 @@ int main(int argc, char *argv[])
 
         if (verbose) bsl::cout << "\nEnd of test." << bsl::endl;
       } break;
+      case 21: {
+        // --------------------------------------------------------------------
+        // TESTING decoding from buffers and blobs
+        //
+        // Concerns:
+        //: 1 Decoding from a contiguous buffer, or from a blob, produces the
+        //:   same value as decoding from a stream buffer over the same data.
+        //:
+        //: 2 Decoding from a blob succeeds whatever the size of its buffers,
+        //:   including when headers, strings, and values span two buffers.
+        //:
+        //: 3 Decoding from a truncated buffer or blob fails.
+        //:
+        //: 4 Decoding from a buffer or a blob leaves the decoder usable.
+        //
+        // Plan:
+        //: 1 Encode a 'test::TimingRequest' holding a 'test::BigRecord', and
+        //:   decode it from a buffer over the encoding, and from blobs of
+        //:   buffers of various sizes, with the same decoder.  Verify the
+        //:   decoded values.  (C-1..2, 4)
+        //:
+        //: 2 Decode the same encoding from a buffer, and a blob, one byte
+        //:   shorter than the encoding, and verify that decoding fails.  (C-3)
+        //
+        // Testing:
+        //   int decode(const char *buffer, int length, TYPE *variable);
+        //   int decode(const bdlbb::Blob& blob, TYPE *variable);
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            bsl::cout << "\nTesting decoding from buffers and blobs"
+                      << "\n======================================="
+                      << bsl::endl;
+
+        test::BasicRecord basicRec;
+        basicRec.i1() = 11;
+        basicRec.i2() = 22;
+        basicRec.dt() = bdlt::DatetimeTz(
+                  bdlt::Datetime(bdlt::Date(2007, 9, 3), bdlt::Time(16, 30)),
+                  0);
+        basicRec.s()  = "The quick brown fox jumped over the lazy dog.";
+
+        test::BigRecord bigRec;
+        bigRec.name() = "This record is so big, it has its own gravity.";
+        for (int i = 0; i < 20; ++i) {
+            bigRec.array().push_back(basicRec);
+        }
+
+        test::TimingRequest request;
+        request.makeBig(bigRec);
+
+        bdlsb::MemOutStreamBuf osb;
+        ASSERT(0 == encoder.encode(&osb, request));
+
+        const char *DATA   = osb.data();
+        const int   LENGTH = static_cast<int>(osb.length());
+
+        if (veryVerbose) { P(LENGTH) }
+
+        balber::BerDecoder decoder;
+
+        if (verbose) bsl::cout << "\nDecoding from a buffer." << bsl::endl;
+        {
+            test::TimingRequest value;
+            ASSERT(0 == decoder.decode(DATA, LENGTH, &value));
+            ASSERT(request == value);
+
+            ASSERT(0 != decoder.decode(DATA, LENGTH - 1, &value));
+            ASSERT(0 != decoder.decode(DATA, 0, &value));
+
+            ASSERT(0 == decoder.decode(DATA, LENGTH, &value));
+            ASSERT(request == value);
+        }
+
+        if (verbose) bsl::cout << "\nDecoding from a blob." << bsl::endl;
+        {
+            static const int SIZES[] = { 1, 2, 3, 7, 64, 1000, 100000 };
+            const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                const int SIZE = SIZES[i];
+
+                if (veryVerbose) { P(SIZE) }
+
+                bdlbb::SimpleBlobBufferFactory factory(SIZE, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+                bdlbb::BlobUtil::append(&blob, DATA, LENGTH);
+
+                test::TimingRequest value;
+                ASSERTV(SIZE, 0 == decoder.decode(blob, &value));
+                ASSERTV(SIZE, request == value);
+
+                blob.setLength(LENGTH - 1);
+                ASSERTV(SIZE, 0 != decoder.decode(blob, &value));
+            }
+        }
+
+        if (verbose) bsl::cout << "\nEnd of test." << bsl::endl;
+      } break;
       case 20: {
         // --------------------------------------------------------------------
         // TESTING decoding sequences of maximum size
@@ -17247,7 +17350,6 @@ int main(int argc, char *argv[])
         ASSERT(*inRequests == request);
         elapsed = stopwatch.elapsedTime();
         ASSERT(elapsed > 0);
-        delete[] inRequests;
 
         bsl::cout << "    balber::BerDecoder: "
                   << elapsed          << " seconds, "
@@ -24,9 +24,17 @@ BSLS_IDENT("$Id: $")
 // that contains a parameterized 'encode' function.  The 'encode' function
 // encodes data read from a specified stream and loads the corresponding object
 // to an object of the parameterized type.  The 'encode' method is overloaded
-// for two types of input streams:
+// for three types of output:
 //: o 'bsl::streambuf'
-//: o 'bsl::istream'
+//: o 'bsl::ostream'
+//: o 'bdlbb::Blob'
+//
+// Constructed values (sequences, choices, and arrays) are encoded with the
+// indefinite length form, terminated by "end-of-content" octets, so that the
+// encoder writes every octet exactly once, in order, and never needs to know
+// the length of contents before writing them.  The encoder therefore does no
+// buffering of its own: an encoding is written directly to the stream buffer,
+// or to the buffers of the blob, supplied by the caller.
 //
 // This component encodes objects based on the X.690 BER specification.  It can
 // only be used with types supported by the 'bdlat' framework.
@@ -188,6 +196,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bsl_string.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bsls_objectbuffer.h>
@@ -408,6 +419,14 @@ class BerEncoder {
         // 'stream'.  Return 0 on success, and a non-zero value otherwise.  If
         // the encoding fails 'stream' will be invalidated.
 
+    template <typename TYPE>
+    int encode(bdlbb::Blob *blob, const TYPE& value);
+        // Encode the specified non-modifiable 'value' at the end of the
+        // specified 'blob', writing it directly into the buffers of 'blob',
+        // which are obtained from the blob buffer factory of 'blob' as needed.
+        // Return 0 on success, and a non-zero value otherwise.  If the
+        // encoding fails, the data appended to 'blob' is unspecified.
+
     // ACCESSORS
     const BerEncoderOptions *options() const;
         // Return address of the options.
@@ -719,6 +738,16 @@ int BerEncoder::encode(bsl::ostream& stream, const TYPE& value)
     return 0;
 }
 
+template <typename TYPE>
+inline
+int BerEncoder::encode(bdlbb::Blob *blob, const TYPE& value)
+{
+    BSLS_ASSERT(blob);
+
+    bdlbb::OutBlobStreamBuf streamBuf(blob);
+    return this->encode(&streamBuf, value);
+}
+
 // PRIVATE MANIPULATORS
 template <typename TYPE>
 int BerEncoder::encodeImpl(const TYPE&                value,
@@ -21,6 +21,10 @@
 #include <bdlsb_memoutstreambuf.h>
 #include <bdlsb_fixedmeminstreambuf.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
 #include <bdlt_date.h>
 #include <bdlt_datetime.h>
 #include <bdlt_time.h>
@@ -31,6 +35,7 @@
 
 #include <bslim_testutil.h>
 #include <bslma_allocator.h>
+#include <bslma_testallocator.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_stopwatch.h>
 #include <bsls_types.h>
@@ -9349,7 +9354,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -9373,6 +9378,91 @@ int main(int argc, char *argv[])
         usageExample();
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'encode' to a blob
+        //
+        // Concerns:
+        //: 1 Encoding to a blob produces the same octets as encoding to a
+        //:   stream buffer, whatever the size of the buffers of the blob.
+        //:
+        //: 2 The encoding is appended to the data already in the blob, which
+        //:   is left unchanged.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Encode a 'test::TimingRequest' holding a 'test::BigRecord' to a
+        //:   'bdlsb::MemOutStreamBuf', and to blobs of buffers of various
+        //:   sizes, initially empty or not, supplied by a test allocator.
+        //:   Verify the data of each blob.  (C-1..3)
+        //
+        // Testing:
+        //   int encode(bdlbb::Blob *blob, const TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING 'encode' to a blob"
+                               << "\n=========================="
+                               << bsl::endl;
+
+        test::BasicRecord basicRec;
+        basicRec.i1() = 11;
+        basicRec.i2() = 22;
+        basicRec.dt() = bdlt::DatetimeTz(
+                  bdlt::Datetime(bdlt::Date(2007, 9, 3), bdlt::Time(16, 30)),
+                  0);
+        basicRec.s()  = "The quick brown fox jumped over the lazy dog.";
+
+        test::BigRecord bigRec;
+        bigRec.name() = "This record is so big, it has its own gravity.";
+        for (int i = 0; i < 20; ++i) {
+            bigRec.array().push_back(basicRec);
+        }
+
+        test::TimingRequest request;
+        request.makeBig(bigRec);
+
+        bdlsb::MemOutStreamBuf osb;
+        ASSERT(0 == encoder.encode(&osb, request));
+
+        const bsl::string EXPECTED(osb.data(), osb.length());
+        const bsl::string PREFIX("prefix");
+
+        if (veryVerbose) { P(EXPECTED.length()) }
+
+        static const int SIZES[] = { 1, 2, 3, 7, 64, 1000, 100000 };
+        const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE = SIZES[i];
+
+            for (int withPrefix = 0; withPrefix < 2; ++withPrefix) {
+                if (veryVerbose) { P_(SIZE) P(withPrefix) }
+
+                bdlbb::SimpleBlobBufferFactory factory(SIZE, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+
+                const bsl::string EXP = withPrefix ? PREFIX + EXPECTED
+                                                   : EXPECTED;
+                if (withPrefix) {
+                    bdlbb::BlobUtil::append(&blob,
+                                            PREFIX.data(),
+                                            static_cast<int>(PREFIX.length()));
+                }
+
+                balber::BerEncoder blobEncoder;
+                ASSERTV(SIZE, 0 == blobEncoder.encode(&blob, request));
+                ASSERTV(SIZE, static_cast<int>(EXP.length()) == blob.length());
+
+                bsl::string result(blob.length(), '\0');
+                bdlbb::BlobUtil::copy(&result[0], blob, 0, blob.length());
+                ASSERTV(SIZE, EXP == result);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING 'encode' for date/time components
@@ -331,6 +331,15 @@ struct BerUtil_Imp {
       , e_MAX_INTEGER_LENGTH      = 9
       , e_INDEFINITE_LENGTH_OCTET = 0x80  // value that indicates an indefinite
                                           // length
+      , e_LONG_FORM_LENGTH_FLAG   = 0x80  // flag of a "long-form" length
+      , e_TAG_CLASS_MASK          = 0xC0  // tag class  in the first octet
+      , e_TAG_TYPE_MASK           = 0x20  // tag type   in the first octet
+      , e_TAG_NUMBER_MASK         = 0x1f  // tag number in the first octet
+      , e_MAX_TAG_NUMBER_IN_ONE_OCTET = 30
+                                          // the maximum tag number of a tag
+                                          // of one octet
+      , e_MAX_SHORT_FORM_LENGTH   = 127   // the maximum length that is
+                                          // transmitted in the short form
 
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       , INDEFINITE_LENGTH       = e_INDEFINITE_LENGTH
@@ -356,6 +365,31 @@ struct BerUtil_Imp {
     static int getLength(bsl::streambuf *streamBuf,
                          int            *result,
                          int            *accumNumBytesConsumed);
+        // Decode the length octets from the specified 'streamBuf' as
+        // described by 'BerUtil::getLength'.  Note that a length transmitted
+        // in the short form, which is that of nearly every element, is
+        // decoded inline, and any other by 'getLongFormLength'.
+
+    static int getLongFormLength(bsl::streambuf *streamBuf,
+                                 int             firstOctet,
+                                 int            *result,
+                                 int            *accumNumBytesConsumed);
+        // Decode the length octets following the specified 'firstOctet',
+        // already read from the specified 'streamBuf' and already counted in
+        // the specified 'accumNumBytesConsumed', of a length that is either
+        // indefinite or transmitted in the long form, and load the result
+        // into the specified 'result'.  Return 0 on success, and a non-zero
+        // value otherwise.
+
+    static int getTagNumberOctets(bsl::streambuf *streamBuf,
+                                  int            *tagNumber,
+                                  int            *accumNumBytesConsumed);
+        // Decode the tag number octets following a first identifier octet
+        // that announces a tag number of more than one octet from the
+        // specified 'streamBuf', and load the result into the specified
+        // 'tagNumber'.  Add the number of bytes consumed to the specified
+        // 'accumNumBytesConsumed'.  Return 0 on success, and a non-zero value
+        // otherwise.
 
     template <typename TYPE>
     static int getValue(
@@ -512,6 +546,23 @@ struct BerUtil_Imp {
     static int putIntegerValue(bsl::streambuf *streamBuf, TYPE value);
 
     static int putLength(bsl::streambuf *streamBuf, int length);
+        // Encode the specified 'length' to the specified 'streamBuf' as
+        // described by 'BerUtil::putLength'.  Note that a length of up to
+        // 'e_MAX_SHORT_FORM_LENGTH' is encoded inline, and any other by
+        // 'putLongFormLength'.
+
+    static int putLongFormLength(bsl::streambuf *streamBuf, int length);
+        // Encode the specified 'length' to the specified 'streamBuf' in the
+        // long form.  Return 0 on success, and a non-zero value otherwise.
+        // The behavior is undefined unless
+        // 'e_MAX_SHORT_FORM_LENGTH < length'.
+
+    static int putTagNumberOctets(bsl::streambuf *streamBuf, int tagNumber);
+        // Encode the octets of the specified 'tagNumber' that follow a first
+        // identifier octet announcing a tag number of more than one octet to
+        // the specified 'streamBuf'.  Return 0 on success, and a non-zero
+        // value otherwise.  The behavior is undefined unless
+        // 'e_MAX_TAG_NUMBER_IN_ONE_OCTET < tagNumber'.
 
     static int putStringValue(bsl::streambuf *streamBuf,
                               const char     *value,
@@ -675,6 +726,41 @@ int BerUtil::getEndOfContentOctets(bsl::streambuf *streamBuf,
          : k__FAILURE;
 }
 
+inline
+int BerUtil::getIdentifierOctets(
+                                bsl::streambuf         *streamBuf,
+                                BerConstants::TagClass *tagClass,
+                                BerConstants::TagType  *tagType,
+                                int                    *tagNumber,
+                                int                    *accumNumBytesConsumed)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    const int nextOctet = streamBuf->sbumpc();
+    if (bsl::streambuf::traits_type::eof() == nextOctet) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    ++*accumNumBytesConsumed;
+
+    *tagClass = static_cast<BerConstants::TagClass>(
+                                   nextOctet & BerUtil_Imp::e_TAG_CLASS_MASK);
+    *tagType  = static_cast<BerConstants::TagType>(
+                                    nextOctet & BerUtil_Imp::e_TAG_TYPE_MASK);
+
+    if (BerUtil_Imp::e_TAG_NUMBER_MASK !=
+                                (nextOctet & BerUtil_Imp::e_TAG_NUMBER_MASK)) {
+        // The tag number fits in a single octet.
+
+        *tagNumber = nextOctet & BerUtil_Imp::e_TAG_NUMBER_MASK;
+        return k_SUCCESS;                                             // RETURN
+    }
+
+    return BerUtil_Imp::getTagNumberOctets(streamBuf,
+                                           tagNumber,
+                                           accumNumBytesConsumed);
+}
+
 inline
 int BerUtil::getLength(bsl::streambuf *streamBuf,
                             int       *result,
@@ -742,6 +828,41 @@ int BerUtil::putIndefiniteLengthOctet(bsl::streambuf *streamBuf)
          : k_FAILURE;
 }
 
+inline
+int BerUtil::putIdentifierOctets(bsl::streambuf         *streamBuf,
+                                 BerConstants::TagClass  tagClass,
+                                 BerConstants::TagType   tagType,
+                                 int                     tagNumber)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    if (tagNumber < 0) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    if (tagNumber <= BerUtil_Imp::e_MAX_TAG_NUMBER_IN_ONE_OCTET) {
+        const unsigned char octet = static_cast<unsigned char>(tagClass
+                                                               | tagType
+                                                               | tagNumber);
+
+        return octet == streamBuf->sputc(octet) ? k_SUCCESS
+                                                : k_FAILURE;          // RETURN
+    }
+
+    // Send multiple identifier octets.
+
+    const unsigned char firstOctet = static_cast<unsigned char>(
+                                      tagClass
+                                    | tagType
+                                    | BerUtil_Imp::e_TAG_NUMBER_MASK);
+
+    if (firstOctet != streamBuf->sputc(firstOctet)) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    return BerUtil_Imp::putTagNumberOctets(streamBuf, tagNumber);
+}
+
 inline
 int BerUtil::putLength(bsl::streambuf *streamBuf, int length)
 {
@@ -811,6 +932,33 @@ int BerUtil_Imp::getIntegerValue(bsl::streambuf *streamBuf,
     return k_SUCCESS;
 }
 
+inline
+int BerUtil_Imp::getLength(bsl::streambuf *streamBuf,
+                           int            *result,
+                           int            *accumNumBytesConsumed)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    const int nextOctet = streamBuf->sbumpc();
+    if (bsl::streambuf::traits_type::eof() == nextOctet) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    ++*accumNumBytesConsumed;
+
+    if (!(nextOctet & e_LONG_FORM_LENGTH_FLAG)) {
+        // Length has been transmitted in short form.
+
+        *result = nextOctet;
+        return k_SUCCESS;                                             // RETURN
+    }
+
+    return getLongFormLength(streamBuf,
+                             nextOctet,
+                             result,
+                             accumNumBytesConsumed);
+}
+
 template <typename TYPE>
 inline
 int BerUtil_Imp::getValue(bsl::streambuf           *streamBuf,
@@ -1074,6 +1222,24 @@ int BerUtil_Imp::putIntegerGivenLength(bsl::streambuf *streamBuf,
 #endif
 }
 
+inline
+int BerUtil_Imp::putLength(bsl::streambuf *streamBuf, int length)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    if (length < 0) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    if (length <= e_MAX_SHORT_FORM_LENGTH) {
+        return length == streamBuf->sputc(static_cast<char>(length))
+             ? k_SUCCESS
+             : k_FAILURE;                                             // RETURN
+    }
+
+    return putLongFormLength(streamBuf, length);
+}
+
 template <typename TYPE>
 inline
 int BerUtil_Imp::putIntegerValue(bsl::streambuf *streamBuf,
@@ -15,11 +15,22 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, 'baljsn::Decoder', for
 // decoding value-semantic objects in the JSON format.  In particular, the
 // 'class' contains a parameterized 'decode' function that decodes an object
-// from a specified stream.  There are two overloaded versions of this
+// from a specified input.  There are four overloaded versions of this
 // function:
 //
 //: o one that reads from a 'bsl::streambuf'
 //: o one that reads from a 'bsl::istream'
+//: o one that reads from a contiguous buffer of characters
+//: o one that reads from a 'bdlbb::Blob'
+//
+// Input supplied in a contiguous buffer is tokenized in place, without first
+// being copied into an internal buffer, and the text of each value is
+// converted directly from that buffer; e.g., a string value that contains no
+// escape sequences is assigned to its target 'bsl::string' with a single
+// copy.  A 'bdlbb::Blob' having at most one data buffer is decoded in the same
+// way, and one having several data buffers is read through a
+// 'bdlbb::InBlobStreamBuf'.  Decoding from a 'bsl::streambuf' or a
+// 'bsl::istream' is appropriate when the input is not already in memory.
 //
 // This component can be used with types that support the 'bdeat' framework
 // (see the 'bdeat' package for details), which is a compile-time interface for
@@ -136,11 +147,15 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_formattingmode.h>
 #include <bdlat_selectioninfo.h>
 #include <bdlat_sequencefunctions.h>
+#include <bdlat_sequenceplan.h>
 #include <bdlat_typecategory.h>
 #include <bdlat_valuetypefunctions.h>
 
 #include <bdlb_printmethods.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
 #include <bdlma_localsequentialallocator.h>
 
 #include <bslmf_assert.h>
@@ -214,6 +229,13 @@ class Decoder {
         // formatting mode as specified in 'bdlat_FormattingMode'.  Note that
         // 'ANY_CATEGORY' shall be a tag-type defined in 'bdlat_TypeCategory'.
 
+    template <class TYPE>
+    int decodeDocument(TYPE *value, const DecoderOptions& options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON document that the tokenizer owned by this object has been
+        // reset to read, using the specified 'options'.  Return 0 on success,
+        // and a non-zero value otherwise.
+
     int skipUnknownElement(const bslstl::StringRef& elementName);
         // Skip the unknown element specified by 'elementName' by discarding
         // all the data associated with it and advancing the parser to the next
@@ -269,6 +291,34 @@ class Decoder {
         // if decoding is successful, will attempt to update the input position
         // of 'stream' to the last unprocessed byte.
 
+    template <class TYPE>
+    int decode(const char            *buffer,
+               bsl::size_t            length,
+               TYPE                  *value,
+               const DecoderOptions&  options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON data in the specified 'length' characters starting at the
+        // specified 'buffer' address, using the specified 'options'.  'TYPE'
+        // shall be a 'bdeat'-compatible sequence, choice, or array type, or a
+        // 'bdeat'-compatible dynamic type referring to one of those types.
+        // Return 0 on success, and a non-zero value otherwise.  The behavior
+        // is undefined unless 'buffer' refers to at least 'length'
+        // characters.  Note that the data is decoded in place, without being
+        // copied to an intermediate buffer.
+
+    template <class TYPE>
+    int decode(const bdlbb::Blob&     blob,
+               TYPE                  *value,
+               const DecoderOptions&  options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON data in the specified 'blob', using the specified
+        // 'options'.  'TYPE' shall be a 'bdeat'-compatible sequence, choice,
+        // or array type, or a 'bdeat'-compatible dynamic type referring to one
+        // of those types.  Return 0 on success, and a non-zero value
+        // otherwise.  Note that if 'blob' has at most one data buffer, the
+        // data is decoded in place, without being copied to an intermediate
+        // buffer.
+
     template <class TYPE>
     int decode(bsl::streambuf *streamBuf, TYPE *value);
         // Decode an object of (template parameter) 'TYPE' from the specified
@@ -382,13 +432,13 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
         // This is an anonymous element.  Do not read anything and instead
         // decode into the corresponding sub-element.
 
-        if (bdlat_SequenceFunctions::hasAttribute(
+        if (bdlat_SequencePlanUtil::hasAttribute(
                                    *value,
                                    d_elementName.data(),
                                    static_cast<int>(d_elementName.length()))) {
             Decoder_ElementVisitor visitor = { this, mode };
 
-            if (0 != bdlat_SequenceFunctions::manipulateAttribute(
+            if (0 != bdlat_SequencePlanUtil::manipulateAttribute(
                                    value,
                                    visitor,
                                    d_elementName.data(),
@@ -443,7 +493,7 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
                 return -1;                                            // RETURN
             }
 
-            if (bdlat_SequenceFunctions::hasAttribute(
+            if (bdlat_SequencePlanUtil::hasAttribute(
                                      *value,
                                      elementName.data(),
                                      static_cast<int>(elementName.length()))) {
@@ -458,7 +508,7 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
 
                 Decoder_ElementVisitor visitor = { this, mode };
 
-                if (0 != bdlat_SequenceFunctions::manipulateAttribute(
+                if (0 != bdlat_SequencePlanUtil::manipulateAttribute(
                                    value,
                                    visitor,
                                    d_elementName.data(),
@@ -862,27 +912,9 @@ int Decoder::decodeImp(TYPE *, ANY_CATEGORY)
     return -1;
 }
 
-// CREATORS
-inline
-Decoder::Decoder(bslma::Allocator *basicAllocator)
-: d_logStream(basicAllocator)
-, d_tokenizer(basicAllocator)
-, d_elementName(basicAllocator)
-, d_currentDepth(0)
-, d_maxDepth(0)
-, d_skipUnknownElements(false)
-{
-}
-
-// MANIPULATORS
 template <class TYPE>
-int Decoder::decode(bsl::streambuf        *streamBuf,
-                    TYPE                  *value,
-                    const DecoderOptions&  options)
+int Decoder::decodeDocument(TYPE *value, const DecoderOptions& options)
 {
-    BSLS_ASSERT(streamBuf);
-    BSLS_ASSERT(value);
-
     d_logStream.clear();
     d_logStream.str("");
 
@@ -897,7 +929,6 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
         return -1;                                                    // RETURN
     }
 
-    d_tokenizer.reset(streamBuf);
     d_tokenizer.setAllowStandAloneValues(false);
     d_tokenizer.setAllowHeterogenousArrays(false);
 
@@ -912,6 +943,7 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
 
     bdlat_ValueTypeFunctions::reset(value);
 
+    d_currentDepth        = 0;
     d_maxDepth            = options.maxDepth();
     d_skipUnknownElements = options.skipUnknownElements();
 
@@ -922,6 +954,32 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
     return rc;
 }
 
+// CREATORS
+inline
+Decoder::Decoder(bslma::Allocator *basicAllocator)
+: d_logStream(basicAllocator)
+, d_tokenizer(basicAllocator)
+, d_elementName(basicAllocator)
+, d_currentDepth(0)
+, d_maxDepth(0)
+, d_skipUnknownElements(false)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Decoder::decode(bsl::streambuf        *streamBuf,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(streamBuf);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(streamBuf);
+
+    return decodeDocument(value, options);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf        *streamBuf,
                     TYPE                  *value,
@@ -957,6 +1015,36 @@ int Decoder::decode(bsl::istream&          stream,
     return decode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Decoder::decode(const char            *buffer,
+                    bsl::size_t            length,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(buffer || 0 == length);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(buffer, length);
+
+    return decodeDocument(value, options);
+}
+
+template <class TYPE>
+int Decoder::decode(const bdlbb::Blob&     blob,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(value);
+
+    if (1 < blob.numDataBuffers()) {
+        bdlbb::InBlobStreamBuf streamBuf(&blob);
+        return decode(&streamBuf, value, options);                    // RETURN
+    }
+
+    const char *data = blob.numDataBuffers() ? blob.buffer(0).data() : 0;
+    return decode(data, blob.length(), value, options);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf *streamBuf, TYPE *value)
 {
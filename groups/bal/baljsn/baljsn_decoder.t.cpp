@@ -17,6 +17,10 @@
 #include <bdlsb_fixedmeminstreambuf.h>
 #include <bsl_sstream.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
 #include <bdlde_utf8util.h>
 #include <bdlsb_fixedmeminstreambuf.h>
 
@@ -28,6 +32,12 @@
 
 #include <bslmt_threadutil.h>
 
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
 // These header are for testing only and the hierarchy level of 'baljsn' was
 // increase because of them.  They should be remove when possible.
 #include <balb_testmessages.h>
@@ -72,14 +82,18 @@ using bsl::endl;
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, &options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, &options);
+// [ 9] int decode(const char *buffer, size_t length, TYPE *v, options);
+// [ 9] int decode(const bdlbb::Blob& blob, TYPE *v, options);
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 // [ 5] MULTI-THREADING TEST CASE
 // [ 6] DRQS 43702912
+// [-1] PERFORMANCE: DECODING THROUGHPUT
+// [-2] PERFORMANCE: DECODING FROM MEMORY
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -37665,6 +37679,43 @@ struct IsEnumeration<test::Enumeration0> {
 }  // close enterprise namespace
 
 
+// ============================================================================
+//                          PERFORMANCE TEST HELPERS
+// ----------------------------------------------------------------------------
+
+bsl::string makeEmployeeJson(int numFriends, bool pretty)
+    // Return the JSON text of a 'case4::Employee' object having the specified
+    // 'numFriends' friends, each having a name that contains escaped
+    // characters, laid out on multiple indented lines if the specified
+    // 'pretty' is 'true', and without whitespace otherwise.
+{
+    const char *NL     = pretty ? "\n" : "";
+    const char *INDENT = pretty ? "        " : "";
+    const char *COLON  = pretty ? " : " : ":";
+
+    bsl::ostringstream oss;
+    oss << "{" << NL
+        << INDENT << "\"name\"" << COLON << "\"Employee Name\"," << NL
+        << INDENT << "\"age\"" << COLON << "42," << NL
+        << INDENT << "\"ids\"" << COLON << "[";
+    for (int i = 0; i < 100; ++i) {
+        oss << (i ? "," : "") << 1000000 + i;
+    }
+    oss << "]," << NL
+        << INDENT << "\"friends\"" << COLON << "[" << NL;
+    for (int i = 0; i < numFriends; ++i) {
+        oss << INDENT << INDENT << (i ? "," : "") << "{"
+            << "\"name\"" << COLON
+            << "\"Friend number " << i
+            << " of the employee, with \\\"quoted\\\" nickname\","
+            << "\"ids\"" << COLON << "[" << i << "," << i * 7
+            << "," << i * 13 << "]}" << NL;
+    }
+    oss << INDENT << "]" << NL << "}";
+
+    return oss.str();
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -37678,7 +37729,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -37785,6 +37836,148 @@ int main(int argc, char *argv[])
     ASSERT(21              == employee.age());
 //..
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING FROM CONTIGUOUS BUFFERS AND BLOBS
+        //
+        // Concerns:
+        //: 1 Decoding from a contiguous buffer or a 'bdlbb::Blob' produces
+        //:   the same value as decoding the same data from a 'streambuf'.
+        //:
+        //: 2 Blobs with one data buffer, and with many data buffers, are
+        //:   supported.
+        //:
+        //: 3 No data beyond the specified length of a buffer is read.
+        //:
+        //: 4 Truncated and empty input is reported as an error.
+        //
+        // Plan:
+        //: 1 Construct the expected 'balb::FeatureTestMessage' objects from
+        //:   their XML representation.
+        //:
+        //: 2 For each pretty and compact JSON message, decode the message
+        //:   from a buffer that is followed by invalid JSON, from a blob
+        //:   having a single data buffer, and from blobs having data buffers
+        //:   of 7 and 64 bytes, and verify that each result equals the
+        //:   expected object.  (C-1..3)
+        //:
+        //: 3 Decode several proper prefixes of each compact message from a
+        //:   buffer and a blob and verify that decoding fails.  Decode an
+        //:   empty buffer and an empty blob and verify that decoding fails.
+        //:   (C-4)
+        //
+        // Testing:
+        //   int decode(const char *buffer, size_t length, TYPE *v, options);
+        //   int decode(const bdlbb::Blob& blob, TYPE *v, options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                        << endl
+                        << "TESTING DECODING FROM CONTIGUOUS BUFFERS AND BLOBS"
+                        << endl
+                        << "=================================================="
+                        << endl;
+
+        bsl::vector<balb::FeatureTestMessage> testObjects;
+        constructFeatureTestMessage(&testObjects);
+
+        const int BUFFER_SIZES[] = { 7, 64 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                   / sizeof *BUFFER_SIZES;
+
+        baljsn::DecoderOptions options;
+        baljsn::Decoder        decoder;
+
+        for (int fi = 0; fi < 2; ++fi) {
+            const int NUM_MESSAGES = fi ? NUM_JSON_COMPACT_MESSAGES
+                                        : NUM_JSON_PRETTY_MESSAGES;
+
+            for (int ti = 0; ti < NUM_MESSAGES; ++ti) {
+                const int         LINE   = fi
+                                         ? JSON_COMPACT_MESSAGES[ti].d_line
+                                         : JSON_PRETTY_MESSAGES[ti].d_line;
+                const bsl::string INPUT  = fi
+                                         ? JSON_COMPACT_MESSAGES[ti].d_input_p
+                                         : JSON_PRETTY_MESSAGES[ti].d_input_p;
+                const int         LENGTH = static_cast<int>(INPUT.length());
+                const balb::FeatureTestMessage& EXP = testObjects[ti];
+
+                if (veryVerbose) { P_(fi) P(LINE) }
+
+                {
+                    const bsl::string BUFFER = INPUT + "{]";
+
+                    balb::FeatureTestMessage value;
+
+                    const int rc = decoder.decode(BUFFER.data(),
+                                                  INPUT.length(),
+                                                  &value,
+                                                  options);
+                    ASSERTV(LINE, decoder.loggedMessages(), rc, 0 == rc);
+                    ASSERTV(LINE, EXP, value, EXP == value);
+                }
+
+                {
+                    bdlbb::SimpleBlobBufferFactory factory(LENGTH + 1);
+                    bdlbb::Blob                    blob(&factory);
+                    bdlbb::BlobUtil::append(&blob, INPUT.data(), LENGTH);
+                    ASSERTV(LINE, 1 == blob.numDataBuffers());
+
+                    balb::FeatureTestMessage value;
+
+                    const int rc = decoder.decode(blob, &value, options);
+                    ASSERTV(LINE, decoder.loggedMessages(), rc, 0 == rc);
+                    ASSERTV(LINE, EXP, value, EXP == value);
+                }
+
+                for (int bi = 0; bi < NUM_BUFFER_SIZES; ++bi) {
+                    const int BUFFER_SIZE = BUFFER_SIZES[bi];
+
+                    bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+                    bdlbb::Blob                    blob(&factory);
+                    bdlbb::BlobUtil::append(&blob, INPUT.data(), LENGTH);
+
+                    balb::FeatureTestMessage value;
+
+                    const int rc = decoder.decode(blob, &value, options);
+                    ASSERTV(LINE, BUFFER_SIZE, decoder.loggedMessages(), rc,
+                            0 == rc);
+                    ASSERTV(LINE, BUFFER_SIZE, EXP, value, EXP == value);
+                }
+
+                if (fi) {
+                    for (int len = 0; len < LENGTH; len += 1 + len / 2) {
+                        balb::FeatureTestMessage value;
+
+                        int rc = decoder.decode(INPUT.data(),
+                                                len,
+                                                &value,
+                                                options);
+                        ASSERTV(LINE, len, rc, 0 != rc);
+
+                        bdlbb::SimpleBlobBufferFactory factory(7);
+                        bdlbb::Blob                    blob(&factory);
+                        bdlbb::BlobUtil::append(&blob, INPUT.data(), len);
+
+                        rc = decoder.decode(blob, &value, options);
+                        ASSERTV(LINE, len, rc, 0 != rc);
+                    }
+                }
+            }
+        }
+
+        {
+            balb::FeatureTestMessage value;
+
+            ASSERT(0 != decoder.decode(static_cast<const char *>(0),
+                                       0,
+                                       &value,
+                                       options));
+
+            bdlbb::Blob blob;
+            ASSERT(0 != decoder.decode(blob, &value, options));
+        }
+      } break;
       case 8: {
         // ------------------------------------------------------------------
         // TESTING CLEARING OF LOGGED MESSAGES ON DECODE CALLS
@@ -40199,6 +40392,246 @@ int main(int argc, char *argv[])
             ASSERT(21            == bob.age());
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: DECODING THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the rate, in MB/s, at which 'baljsn::Decoder' decodes
+        //:   payloads of realistic shape and size.
+        //
+        // Plan:
+        //: 1 Decode each of the pretty and compact feature test messages
+        //:   repeatedly, and report the aggregate throughput for each format.
+        //:
+        //: 2 Generate a large (about 64KB) 'case4::Employee' document having
+        //:   many friends with long names, in pretty and compact form, decode
+        //:   it repeatedly, and report the throughput for each form.
+        //:
+        //: 3 The number of repetitions may be specified as the second
+        //:   command-line argument.
+        //
+        // Testing:
+        //   PERFORMANCE: DECODING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: DECODING THROUGHPUT" << endl
+                          << "================================" << endl;
+
+        const int NUM_REPS = argc > 2 && atoi(argv[2]) > 0
+                           ? atoi(argv[2])
+                           : 50;
+
+        baljsn::DecoderOptions options;
+
+        {
+            const char *FORMAT[] = { "pretty ", "compact" };
+
+            for (int fi = 0; fi < 2; ++fi) {
+                bsl::vector<bsl::string> messages;
+                bsl::size_t              numBytes = 0;
+
+                const int NUM_MESSAGES = fi ? NUM_JSON_COMPACT_MESSAGES
+                                            : NUM_JSON_PRETTY_MESSAGES;
+                for (int ti = 0; ti < NUM_MESSAGES; ++ti) {
+                    messages.push_back(fi
+                                       ? JSON_COMPACT_MESSAGES[ti].d_input_p
+                                       : JSON_PRETTY_MESSAGES[ti].d_input_p);
+                    numBytes += messages.back().length();
+                }
+
+                baljsn::Decoder decoder;
+                bsls::Stopwatch timer;
+                timer.start();
+
+                for (int rep = 0; rep < NUM_REPS; ++rep) {
+                    for (bsl::size_t ti = 0; ti < messages.size(); ++ti) {
+                        balb::FeatureTestMessage   value;
+                        bdlsb::FixedMemInStreamBuf isb(messages[ti].data(),
+                                                       messages[ti].length());
+
+                        const int rc = decoder.decode(&isb, &value, options);
+                        ASSERTV(ti, rc, 0 == rc);
+                    }
+                }
+
+                timer.stop();
+
+                const double MB = static_cast<double>(numBytes) * NUM_REPS
+                                / (1024.0 * 1024.0);
+                cout << "feature test messages, " << FORMAT[fi] << ": "
+                     << messages.size() << " messages, " << numBytes
+                     << " bytes, " << MB / timer.elapsedTime() << " MB/s"
+                     << endl;
+            }
+        }
+
+        {
+            const int NUM_FRIENDS = 400;
+
+            for (int fi = 0; fi < 2; ++fi) {
+                const bsl::string INPUT = makeEmployeeJson(NUM_FRIENDS, !fi);
+
+                baljsn::Decoder decoder;
+                bsls::Stopwatch timer;
+                timer.start();
+
+                for (int rep = 0; rep < NUM_REPS * 10; ++rep) {
+                    case4::Employee            value;
+                    bdlsb::FixedMemInStreamBuf isb(INPUT.data(),
+                                                   INPUT.length());
+
+                    const int rc = decoder.decode(&isb, &value, options);
+                    ASSERTV(rc, decoder.loggedMessages(), 0 == rc);
+                    ASSERTV(NUM_FRIENDS == static_cast<int>(
+                                                      value.friends().size()));
+                }
+
+                timer.stop();
+
+                const double MB = static_cast<double>(INPUT.length())
+                                * NUM_REPS * 10 / (1024.0 * 1024.0);
+                cout << "large employee, " << (fi ? "compact" : "pretty ")
+                     << ": " << INPUT.length() << " bytes, "
+                     << MB / timer.elapsedTime() << " MB/s" << endl;
+            }
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: DECODING FROM MEMORY
+        //
+        // Concerns:
+        //: 1 Report the time taken, and the number of memory allocations
+        //:   made, to decode a document that is already in memory, for each
+        //:   form of input accepted by 'decode'.
+        //
+        // Plan:
+        //: 1 Install a test allocator as the default allocator.
+        //:
+        //: 2 Generate a large, compact 'case4::Employee' document, and decode
+        //:   it repeatedly from each of: a 'bsl::istringstream' constructed
+        //:   from the document, a 'bdlsb::FixedMemInStreamBuf', a contiguous
+        //:   buffer, a blob having a single data buffer, and a blob having
+        //:   4KB data buffers.  Report the mean time per decode and the mean
+        //:   number of allocations per decode, and, for reference, the number
+        //:   of allocations made by copying the decoded object.
+        //:
+        //: 3 The number of repetitions may be specified as the second
+        //:   command-line argument.
+        //
+        // Testing:
+        //   PERFORMANCE: DECODING FROM MEMORY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: DECODING FROM MEMORY" << endl
+                          << "=================================" << endl;
+
+        const int NUM_REPS = argc > 2 && atoi(argv[2]) > 0
+                           ? atoi(argv[2])
+                           : 500;
+
+        const int         NUM_FRIENDS = 400;
+        const bsl::string INPUT       = makeEmployeeJson(NUM_FRIENDS, false);
+        const int         LENGTH      = static_cast<int>(INPUT.length());
+
+        bdlbb::SimpleBlobBufferFactory singleFactory(LENGTH);
+        bdlbb::Blob                    singleBlob(&singleFactory);
+        bdlbb::BlobUtil::append(&singleBlob, INPUT.data(), LENGTH);
+
+        bdlbb::SimpleBlobBufferFactory chainFactory(4096);
+        bdlbb::Blob                    chainBlob(&chainFactory);
+        bdlbb::BlobUtil::append(&chainBlob, INPUT.data(), LENGTH);
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        baljsn::DecoderOptions options;
+
+        // Copy a decoded object to measure the number of allocations needed
+        // just to hold the decoded value.
+
+        bsls::Types::Int64 numCopyAllocations;
+        {
+            baljsn::Decoder decoder;
+            case4::Employee value;
+            ASSERT(0 == decoder.decode(INPUT.data(),
+                                       INPUT.length(),
+                                       &value,
+                                       options));
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = da.numAllocations();
+            case4::Employee          copy(value);
+            numCopyAllocations = da.numAllocations() - NUM_ALLOCATIONS;
+        }
+
+        static const char *METHOD[] = {
+            "istringstream       ",
+            "FixedMemInStreamBuf ",
+            "contiguous buffer   ",
+            "single-buffer blob  ",
+            "4KB-buffer blob     ",
+        };
+        const int NUM_METHODS = sizeof METHOD / sizeof *METHOD;
+
+        cout << "document: " << LENGTH << " bytes; "
+             << "allocations to copy the decoded object: "
+             << numCopyAllocations << endl;
+
+        for (int mi = 0; mi < NUM_METHODS; ++mi) {
+            baljsn::Decoder decoder;
+            bsls::Stopwatch timer;
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = da.numAllocations();
+
+            timer.start();
+
+            for (int rep = 0; rep < NUM_REPS; ++rep) {
+                case4::Employee value;
+
+                int rc = -1;
+                switch (mi) {
+                  case 0: {
+                    bsl::istringstream iss(INPUT);
+                    rc = decoder.decode(iss, &value, options);
+                  } break;
+                  case 1: {
+                    bdlsb::FixedMemInStreamBuf isb(INPUT.data(),
+                                                   INPUT.length());
+                    rc = decoder.decode(&isb, &value, options);
+                  } break;
+                  case 2: {
+                    rc = decoder.decode(INPUT.data(),
+                                        INPUT.length(),
+                                        &value,
+                                        options);
+                  } break;
+                  case 3: {
+                    rc = decoder.decode(singleBlob, &value, options);
+                  } break;
+                  case 4: {
+                    rc = decoder.decode(chainBlob, &value, options);
+                  } break;
+                }
+                ASSERTV(mi, rc, decoder.loggedMessages(), 0 == rc);
+                ASSERTV(mi, NUM_FRIENDS == static_cast<int>(
+                                                      value.friends().size()));
+            }
+
+            timer.stop();
+
+            const double numAllocations =
+                           static_cast<double>(da.numAllocations()
+                                                           - NUM_ALLOCATIONS)
+                         / NUM_REPS;
+
+            cout << METHOD[mi] << ": "
+                 << timer.elapsedTime() * 1.0e6 / NUM_REPS << " us/decode, "
+                 << numAllocations << " allocations/decode" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
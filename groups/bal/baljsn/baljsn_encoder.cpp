@@ -19,7 +19,6 @@ int Encoder_EncodeImpl::encodeImp(const bsl::vector<char>&  value,
                                   bdlat_TypeCategory::Array)
 {
     bsl::string base64String;
-    bdlde::Base64Encoder encoder(0);
     base64String.resize(
        bdlde::Base64Encoder::encodedLength(static_cast<int>(value.size()), 0));
 
@@ -27,21 +26,11 @@ int Encoder_EncodeImpl::encodeImp(const bsl::vector<char>&  value,
 
     BSLS_ASSERT(0 == (base64String.length() & 0x03));
 
-    int numOut;
-    int numIn;
-    int rc = encoder.convert(base64String.begin(),
-                             &numOut,
-                             &numIn,
-                             value.begin(),
-                             value.end());
-
-    if (rc < 0) {
-        return rc;                                                    // RETURN
-    }
-
-    rc = encoder.endConvert(base64String.begin() + numOut);
-    if (rc < 0) {
-        return rc;                                                    // RETURN
+    if (!value.empty()) {
+        bdlde::Base64Encoder::encode(&base64String[0],
+                                     &value[0],
+                                     value.size(),
+                                     0);
     }
 
     return encode(base64String, 0);
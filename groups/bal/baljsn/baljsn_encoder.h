@@ -20,6 +20,14 @@ BSLS_IDENT("$Id: $")
 //
 //: o one that writes to a 'bsl::streambuf'
 //: o one that writes to an 'bsl::ostream'
+//: o one that writes to a 'bdlbb::Blob'
+//
+// An encoding is written, in order and without intermediate copies, to the
+// output supplied by the caller.  To encode into a growable contiguous
+// buffer, supply a 'bdlsb::MemOutStreamBuf' (which may be reused for several
+// encodings); to encode into a buffer of known size, a
+// 'bdlsb::FixedMemOutStreamBuf'; and to encode into the buffers of a
+// 'bdlbb::Blob', obtained from its factory as needed, the blob itself.
 //
 // This component can be used with types that support the 'bdlat' framework
 // (see the 'bdlat' package for details), which is a compile-time interface for
@@ -147,6 +155,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_print.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
 #include <bsls_assert.h>
 #include <bsls_types.h>
 
@@ -232,6 +243,25 @@ class Encoder {
         // type, or a 'bdlat'-compatible dynamic type referring to one of those
         // types.  Return 0 on success, and a non-zero value otherwise.
 
+    template <class TYPE>
+    int encode(bdlbb::Blob           *blob,
+               const TYPE&            value,
+               const EncoderOptions&  options);
+    template <class TYPE>
+    int encode(bdlbb::Blob           *blob,
+               const TYPE&            value,
+               const EncoderOptions  *options);
+        // Encode the specified 'value', of (template parameter) 'TYPE', in the
+        // JSON format using the specified 'options' at the end of the
+        // specified 'blob', writing it directly into the buffers of 'blob',
+        // which are obtained from the blob buffer factory of 'blob' as needed.
+        // Specifying a nullptr 'options' is equivalent to passing a
+        // default-constructed EncoderOptions in 'options'.  'TYPE' shall be a
+        // 'bdlat'-compatible sequence, choice, or array type, or a
+        // 'bdlat'-compatible dynamic type referring to one of those types.
+        // Return 0 on success, and a non-zero value otherwise.  If the
+        // encoding fails, the data appended to 'blob' is unspecified.
+
     template <class TYPE>
     int encode(bsl::streambuf *streamBuf, const TYPE& value);
         // Encode the specified 'value' of (template parameter) 'TYPE' into the
@@ -336,6 +366,33 @@ class Encoder_EncodeImpl {
         // 'bdlat' category and 'mode' is a valid formatting mode as specified
         // in 'bdlat_FormattingMode'.
 
+    int encodeInteger(bsls::Types::Int64 value);
+    int encodeInteger(bsls::Types::Uint64 value);
+        // Encode the specified integer 'value' into JSON onto the 'streambuf'
+        // supplied at construction.  Return 0 on success and a non-zero value
+        // otherwise.
+
+    int encodeSimpleValue(bool                value);
+    int encodeSimpleValue(char                value);
+    int encodeSimpleValue(signed char         value);
+    int encodeSimpleValue(unsigned char       value);
+    int encodeSimpleValue(short               value);
+    int encodeSimpleValue(unsigned short      value);
+    int encodeSimpleValue(int                 value);
+    int encodeSimpleValue(unsigned int        value);
+    int encodeSimpleValue(bsls::Types::Int64  value);
+    int encodeSimpleValue(bsls::Types::Uint64 value);
+    template <class TYPE>
+    int encodeSimpleValue(const TYPE& value);
+        // Encode the specified 'value' of a 'bdlat' Simple type into JSON onto
+        // the 'streambuf' supplied at construction.  Return 0 on success and a
+        // non-zero value otherwise.  Note that, in the compact style, integers
+        // and booleans are written directly to the stream buffer, with the
+        // same text as the formatter would write on the stream of this
+        // object, whose formatting flags are never changed; in the pretty
+        // style, they are written by the formatter, which indents array
+        // elements.
+
   public:
     // CREATORS
     Encoder_EncodeImpl(Encoder               *encoder,
@@ -619,6 +676,27 @@ int Encoder::encode(bsl::ostream&         stream,
     return encode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+inline
+int Encoder::encode(bdlbb::Blob           *blob,
+                    const TYPE&            value,
+                    const EncoderOptions&  options)
+{
+    BSLS_ASSERT(blob);
+
+    bdlbb::OutBlobStreamBuf streamBuf(blob);
+    return this->encode(&streamBuf, value, options);
+}
+
+template <class TYPE>
+int Encoder::encode(bdlbb::Blob           *blob,
+                    const TYPE&            value,
+                    const EncoderOptions  *options)
+{
+    EncoderOptions localOpts;
+    return encode(blob, value, options ? *options : localOpts);
+}
+
 // ACCESSORS
 inline
 bsl::string Encoder::loggedMessages() const
@@ -702,6 +780,110 @@ inline
 int Encoder_EncodeImpl::encodeImp(const TYPE&                value,
                                   int,
                                   bdlat_TypeCategory::Simple)
+{
+    return encodeSimpleValue(value);
+}
+
+inline
+int Encoder_EncodeImpl::encodeInteger(bsls::Types::Int64 value)
+{
+    if (baljsn::EncoderOptions::e_PRETTY ==
+                                         d_encoderOptions_p->encodingStyle()) {
+        return d_formatter.putValue(value, d_encoderOptions_p);       // RETURN
+    }
+
+    PrintUtil::writeInteger(d_outputStream, value);
+    return 0;
+}
+
+inline
+int Encoder_EncodeImpl::encodeInteger(bsls::Types::Uint64 value)
+{
+    if (baljsn::EncoderOptions::e_PRETTY ==
+                                         d_encoderOptions_p->encodingStyle()) {
+        return d_formatter.putValue(value, d_encoderOptions_p);       // RETURN
+    }
+
+    PrintUtil::writeInteger(d_outputStream, value);
+    return 0;
+}
+
+inline
+int Encoder_EncodeImpl::encodeSimpleValue(bool value)
+{
+    if (baljsn::EncoderOptions::e_PRETTY ==
+                                         d_encoderOptions_p->encodingStyle()) {
+        return d_formatter.putValue(value, d_encoderOptions_p);       // RETURN
+    }
+
+    if (value) {
+        PrintUtil::write(d_outputStream, "true", 4);
+    }
+    else {
+        PrintUtil::write(d_outputStream, "false", 5);
+    }
+    return 0;
+}
+
+inline
+int Encoder_EncodeImpl::encodeSimpleValue(char value)
+{
+    signed char tmp(value);  // Note that 'char' is unsigned on IBM.
+
+    return encodeInteger(static_cast<bsls::Types::Int64>(tmp));
+}
+
+inline
+int Encoder_EncodeImpl::encodeSimpleValue(signed char value)
+{
+    return encodeInteger(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+int Encoder_EncodeImpl::encodeSimpleValue(unsigned char value)
+{
+    return encodeInteger(static_cast<bsls::Types::Uint64>(value));
+}
+
+inline
+int Encoder_EncodeImpl::encodeSimpleValue(short value)
+{
+    return encodeInteger(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+int Encoder_EncodeImpl::encodeSimpleValue(unsigned short value)
+{
+    return encodeInteger(static_cast<bsls::Types::Uint64>(value));
+}
+
+inline
+int Encoder_EncodeImpl::encodeSimpleValue(int value)
+{
+    return encodeInteger(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+int Encoder_EncodeImpl::encodeSimpleValue(unsigned int value)
+{
+    return encodeInteger(static_cast<bsls::Types::Uint64>(value));
+}
+
+inline
+int Encoder_EncodeImpl::encodeSimpleValue(bsls::Types::Int64 value)
+{
+    return encodeInteger(value);
+}
+
+inline
+int Encoder_EncodeImpl::encodeSimpleValue(bsls::Types::Uint64 value)
+{
+    return encodeInteger(value);
+}
+
+template <class TYPE>
+inline
+int Encoder_EncodeImpl::encodeSimpleValue(const TYPE& value)
 {
     return d_formatter.putValue(value, d_encoderOptions_p);
 }
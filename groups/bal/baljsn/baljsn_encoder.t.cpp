@@ -18,6 +18,9 @@
 
 #include <bdlde_utf8util.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
 #include <bdlsb_fixedmeminstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 
@@ -84,6 +87,8 @@ using bsl::endl;
 // [13] int encode(bsl::ostream& stream, const TYPE& v, options);
 // [13] int encode(bsl::streambuf *streamBuf, const TYPE& v, &options);
 // [13] int encode(bsl::ostream& stream, const TYPE& v, &options);
+// [13] int encode(bdlbb::Blob *blob, const TYPE& v, options);
+// [13] int encode(bdlbb::Blob *blob, const TYPE& v, &options);
 //
 // ACCESSORS
 // [13] bsl::string loggedMessages() const;
@@ -30729,12 +30734,18 @@ int main(int argc, char *argv[])
         //:     'encodeNullElements' option.
         //:
         //:   4 Compare the generated JSON with the expected JSON.
+        //:
+        //:   5 Encode the object into a 'bdlbb::Blob' having small buffers,
+        //:     so that the output spans several buffers, and compare the
+        //:     contents of the blob with the expected JSON.
         //
         // Testing:
         //   int encode(bsl::streambuf *streamBuf, const TYPE& v, options);
         //   int encode(bsl::ostream& stream, const TYPE& v, options);
         //   int encode(bsl::streambuf *streamBuf, const TYPE& v, &options);
         //   int encode(bsl::ostream& stream, const TYPE& v, &options);
+        //   int encode(bdlbb::Blob *blob, const TYPE& v, options);
+        //   int encode(bdlbb::Blob *blob, const TYPE& v, &options);
         // --------------------------------------------------------------------
 
         typedef Options::EncodingStyle Style;
@@ -31158,6 +31169,26 @@ int main(int argc, char *argv[])
                 ASSERTV(0 == encoder.encode(oss, object, &mO));
                 ASSERTV(LINE, oss.str(), EXP, oss.str() == EXP);
             }
+            for (int usePointer = 0; usePointer < 2; ++usePointer) {
+                bdlbb::SimpleBlobBufferFactory factory(7);
+                bdlbb::Blob                    blob(&factory);
+
+                const int rc = usePointer
+                             ? encoder.encode(&blob, object, &mO)
+                             : encoder.encode(&blob, object, mO);
+                ASSERTV(LINE, usePointer, rc, 0 == rc);
+
+                bsl::string result;
+                for (int i = 0; i < blob.numDataBuffers(); ++i) {
+                    const int length = i + 1 == blob.numDataBuffers()
+                                     ? blob.lastDataBufferLength()
+                                     : blob.buffer(i).size();
+                    result.append(blob.buffer(i).data(), length);
+                }
+                ASSERTV(LINE, usePointer, blob.length(),
+                        static_cast<int>(EXP.length()) == blob.length());
+                ASSERTV(LINE, usePointer, result, EXP, result == EXP);
+            }
         }
       } break;
       case 12: {
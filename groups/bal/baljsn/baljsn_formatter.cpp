@@ -47,10 +47,10 @@ void Formatter::openObject()
         indent();
     }
 
-    d_outputStream << '{';
+    PrintUtil::put(d_outputStream, '{');
 
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
+        PrintUtil::put(d_outputStream, '\n');
         ++d_indentLevel;
         d_callSequence.append(false);
     }
@@ -60,14 +60,14 @@ void Formatter::closeObject()
 {
     if (d_usePrettyStyle) {
         --d_indentLevel;
-        d_outputStream << '\n';
+        PrintUtil::put(d_outputStream, '\n');
         indent();
 
         BSLS_ASSERT(false == isArrayElement());
         d_callSequence.remove(d_callSequence.length() - 1);
     }
 
-    d_outputStream << '}';
+    PrintUtil::put(d_outputStream, '}');
 }
 
 void Formatter::openArray(bool formatAsEmptyArrayFlag)
@@ -77,10 +77,10 @@ void Formatter::openArray(bool formatAsEmptyArrayFlag)
         indent();
     }
 
-    d_outputStream << '[';
+    PrintUtil::put(d_outputStream, '[');
 
     if (d_usePrettyStyle && !formatAsEmptyArrayFlag) {
-        d_outputStream << '\n';
+        PrintUtil::put(d_outputStream, '\n');
         ++d_indentLevel;
         d_callSequence.append(true);
     }
@@ -90,17 +90,17 @@ void Formatter::closeArray(bool formatAsEmptyArrayFlag)
 {
     if (d_usePrettyStyle && !formatAsEmptyArrayFlag) {
         --d_indentLevel;
-        d_outputStream << '\n';
+        PrintUtil::put(d_outputStream, '\n');
         indent();
 
         BSLS_ASSERT(true == isArrayElement());
         d_callSequence.remove(d_callSequence.length() - 1);
     }
 
-    d_outputStream << ']';
+    PrintUtil::put(d_outputStream, ']');
 }
 
-int Formatter::openMember(const bsl::string& name)
+int Formatter::openMember(const bslstl::StringRef& name)
 {
     if (d_usePrettyStyle) {
         indent();
@@ -111,24 +111,29 @@ int Formatter::openMember(const bsl::string& name)
         return rc;                                                    // RETURN
     }
 
-    d_outputStream << (d_usePrettyStyle ? " : " : ":");
+    if (d_usePrettyStyle) {
+        PrintUtil::write(d_outputStream, " : ", 3);
+    }
+    else {
+        PrintUtil::put(d_outputStream, ':');
+    }
 
     return 0;
 }
 
 void Formatter::closeMember()
 {
-    d_outputStream << ',';
+    PrintUtil::put(d_outputStream, ',');
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
+        PrintUtil::put(d_outputStream, '\n');
     }
 }
 
 void Formatter::addArrayElementSeparator()
 {
-    d_outputStream << ',';
+    PrintUtil::put(d_outputStream, ',');
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
+        PrintUtil::put(d_outputStream, '\n');
     }
 }
 
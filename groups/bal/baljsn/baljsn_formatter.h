@@ -194,6 +194,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #include <bsls_review.h>
 
+#include <bslstl_stringref.h>
+
 namespace BloombergLP {
 namespace baljsn {
 
@@ -303,11 +305,14 @@ class Formatter {
         // relevant only if this formatter encodes in the pretty style and is
         // ignored otherwise.
 
-    int openMember(const bsl::string& name);
+    int openMember(const bslstl::StringRef& name);
         // Print onto the stream supplied at construction the sequence of
         // characters designating the start of a member (referred to as a
         // "name/value pair" in JSON) having the specified 'name'.  Return 0 on
-        // success and a non-zero value otherwise.
+        // success and a non-zero value otherwise.  Note that 'name' was
+        // formerly taken as a 'const bsl::string&'; calls passing a
+        // 'bsl::string' or a null-terminated string are unaffected, but
+        // pointers to this member function must be updated.
 
     void putNullValue();
         // Print onto the stream supplied at construction the value
@@ -364,7 +369,7 @@ void Formatter::putNullValue()
     if (d_usePrettyStyle && isArrayElement()) {
         indent();
     }
-    d_outputStream << "null";
+    d_outputStream.write("null", 4);
 }
 
 template <class TYPE>
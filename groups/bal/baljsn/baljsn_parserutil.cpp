@@ -10,6 +10,7 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bdlde_charconvertutf32.h>
 
 #include <bdlb_chartype.h>
+#include <bdlb_floatconversionutil.h>
 #include <bdlb_string.h>
 
 #include <bdldfp_decimalutil.h>
@@ -21,7 +22,6 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bsl_algorithm.h>
 #include <bsl_cmath.h>
 #include <bsl_cctype.h>
-#include <bsl_cerrno.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iosfwd.h>
@@ -150,7 +150,12 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
         return -1;                                                    // RETURN
     }
 
+    // The unescaped value is never longer than its quoted representation, so
+    // reserving that length up front avoids any reallocation while the value
+    // is assembled.
+
     value->clear();
+    value->reserve(data.length() - 1);
 
     ++iter;
     while (iter < end) {
@@ -287,7 +292,15 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
             return 0;                                                 // RETURN
         }
         else {
-            *value += *iter;
+            // Append the entire run of characters that need no unescaping.
+
+            const char *runEnd = iter + 1;
+            while (runEnd < end && '"' != *runEnd && '\\' != *runEnd) {
+                ++runEnd;
+            }
+            value->append(iter, runEnd);
+            iter = runEnd;
+            continue;
         }
         ++iter;
     }
@@ -366,27 +379,29 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
         return loadInfOrNan(value, data);                             // RETURN
     }
 
-    const int k_MAX_STRING_LENGTH = 63;
-    char      buffer[k_MAX_STRING_LENGTH + 1];
-
-    bdlma::BufferedSequentialAllocator allocator(buffer,
-                                                 k_MAX_STRING_LENGTH + 1);
-    bsl::string                        dataString(data.data(),
-                                                  data.length(),
-                                                  &allocator);
-
-    char   *endPtr = 0;
-    errno          = 0;
-    double  tmp    = bsl::strtod(dataString.c_str(), &endPtr);
+    // 'FloatConversionUtil' parses the number in place, with no copy, and
+    // fails unless all of 'data' is consumed.
 
-    if (endPtr    != dataString.end()
-     || (0        == tmp && 0 != errno)
+    double tmp;
+    if (0 != bdlb::FloatConversionUtil::parseDouble(&tmp, data)
      ||  HUGE_VAL == tmp
      || -HUGE_VAL == tmp
-     || !bsl::isdigit(*(dataString.end() - 1))) {
+     || !bsl::isdigit(static_cast<unsigned char>(data[data.length() - 1]))) {
         return -1;                                                    // RETURN
     }
 
+    if (0 == tmp) {
+        // Reject a non-zero number too small to be represented (underflow).
+
+        for (const char *p = data.begin();
+             p != data.end() && 'e' != *p && 'E' != *p;
+             ++p) {
+            if ('1' <= *p && *p <= '9') {
+                return -1;                                            // RETURN
+            }
+        }
+    }
+
     *value = tmp;
     return 0;
 }
@@ -623,23 +638,26 @@ int ParserUtil::getValue(bsl::vector<char> *value,
 
     value->clear();
 
-    bdlde::Base64Decoder base64Decoder(true);
-    bsl::back_insert_iterator<bsl::vector<char> > outputIterator(*value);
-
-    rc = base64Decoder.convert(outputIterator,
-                               base64String.begin(),
-                               base64String.end());
-
-    if (rc < 0) {
-        return rc;                                                    // RETURN
+    if (base64String.empty()) {
+        return 0;                                                     // RETURN
     }
 
-    rc = base64Decoder.endConvert(outputIterator);
+    value->resize(bdlde::Base64Decoder::maxDecodedLength(
+                                   static_cast<int>(base64String.length())));
+
+    bsl::size_t numOut;
+    rc = bdlde::Base64Decoder::decode(&(*value)[0],
+                                      &numOut,
+                                      base64String.data(),
+                                      base64String.length(),
+                                      true);
 
     if (rc < 0) {
         return rc;                                                    // RETURN
     }
 
+    value->resize(numOut);
+
     return 0;
 }
 }  // close package namespace
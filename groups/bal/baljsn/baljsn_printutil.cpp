@@ -7,27 +7,98 @@ BSLS_IDENT_RCSID(baljsn_printutil_cpp,"$Id$ $CSID$")
 #include <bdlde_base64encoder.h>
 #include <bdlde_utf8util.h>
 
-#include <bsls_annotation.h>
+#include <bsls_types.h>
 
+#include <bsl_cstring.h>
 #include <bsl_sstream.h>
 
 namespace BloombergLP {
 namespace {
 
-inline
-void writeEscapedChar(bsl::ostream&   stream,
-                      const char    **currentStart,
-                      const char     *iter,
-                      const char      value)
-    // Write the sequence of characters in the range specified by
-    // '[*currentStart, iter)' to the specified 'stream' followed by the escape
-    // character ('\\') and the specified 'value' character.  After that update
-    // '*currentStart' to point to the address following 'iter'.
+const char k_ESCAPES[256] = {
+    // The character following the backslash in the escape sequence of each
+    // character that must be escaped in a JSON string ('u' for the sequences
+    // that end with the four hexadecimal digits of the character), indexed
+    // by the character (as an 'unsigned char'), or 0 for each character that
+    // is written as is.
+
+     'u',  'u',  'u',  'u',  'u',  'u',  'u',  'u',  // 0x00
+     'b',  't',  'n',  'u',  'f',  'r',  'u',  'u',  // 0x08
+     'u',  'u',  'u',  'u',  'u',  'u',  'u',  'u',  // 0x10
+     'u',  'u',  'u',  'u',  'u',  'u',  'u',  'u',  // 0x18
+       0,    0,  '"',    0,    0,    0,    0,    0,  // 0x20
+       0,    0,    0,    0,    0,    0,    0,  '/',  // 0x28
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x30
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x38
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x40
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x48
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x50
+       0,    0,    0,    0, '\\',    0,    0,    0,  // 0x58
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x60
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x68
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x70
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x78
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x80
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x88
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x90
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0x98
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0xA0
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0xA8
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0xB0
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0xB8
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0xC0
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0xC8
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0xD0
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0xD8
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0xE0
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0xE8
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0xF0
+       0,    0,    0,    0,    0,    0,    0,    0,  // 0xF8
+};
+
+const char k_DIGIT_PAIRS[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233"
+    "34353637383940414243444546474849505152535455565758596061626364656667"
+    "6869707172737475767778798081828384858687888990919293949596979899";
+    // The two decimal digits of each value from 0 to 99.
+
+bool isAscii(const char *data, bsl::size_t length)
+    // Return 'true' if none of the specified 'length' characters starting at
+    // the specified 'data' has its high bit set, and 'false' otherwise.  Note
+    // that text consisting of such characters is valid UTF-8.
 {
-    stream.write(*currentStart, iter - *currentStart);
-    stream.put('\\');
-    stream.put(value);
-    *currentStart = iter + 1;
+    bsls::Types::Uint64 bits = 0;
+    for (; length >= sizeof bits; data += sizeof bits, length -= sizeof bits) {
+        bsls::Types::Uint64 word;
+        bsl::memcpy(&word, data, sizeof word);
+        bits |= word;
+    }
+    for (; 0 < length; ++data, --length) {
+        bits |= static_cast<unsigned char>(*data);
+    }
+    return 0 == (bits & 0x8080808080808080ULL);
+}
+
+char *formatUnsigned(char *end, bsls::Types::Uint64 value)
+    // Write the decimal digits of the specified 'value' into the characters
+    // that precede the specified 'end', and return the address of the first
+    // digit written.
+{
+    while (value >= 100) {
+        const unsigned int pair = static_cast<unsigned int>(value % 100) * 2;
+        value /= 100;
+        *--end = k_DIGIT_PAIRS[pair + 1];
+        *--end = k_DIGIT_PAIRS[pair];
+    }
+    if (value >= 10) {
+        const unsigned int pair = static_cast<unsigned int>(value) * 2;
+        *--end = k_DIGIT_PAIRS[pair + 1];
+        *--end = k_DIGIT_PAIRS[pair];
+    }
+    else {
+        *--end = static_cast<char>('0' + value);
+    }
+    return end;
 }
 
 }  // close unnamed namespace
@@ -38,104 +109,75 @@ namespace baljsn {
                               // class PrintUtil
                               // ---------------
 
+// CLASS METHODS
+void PrintUtil::writeInteger(bsl::ostream& stream, bsls::Types::Int64 value)
+{
+    char  buffer[24];
+    char *end   = buffer + sizeof buffer;
+    char *begin = formatUnsigned(end,
+                                 value < 0
+                                 ? 0 - static_cast<bsls::Types::Uint64>(value)
+                                 : static_cast<bsls::Types::Uint64>(value));
+    if (value < 0) {
+        *--begin = '-';
+    }
+    write(stream, begin, end - begin);
+}
+
+void PrintUtil::writeInteger(bsl::ostream& stream, bsls::Types::Uint64 value)
+{
+    char  buffer[24];
+    char *end   = buffer + sizeof buffer;
+    char *begin = formatUnsigned(end, value);
+    write(stream, begin, end - begin);
+}
+
 int PrintUtil::printString(bsl::ostream&            stream,
                            const bslstl::StringRef& value)
 {
-    if (!bdlde::Utf8Util::isValid(value.data(),
+    if (!isAscii(value.data(), value.length())
+     && !bdlde::Utf8Util::isValid(value.data(),
                                   static_cast<int>(value.length()))) {
         return -1;                                                    // RETURN
     }
 
-    stream.put('"');
-
-    const char *currentStart = value.data();
-    const char *iter      = value.data();
-    const char *end       = value.data() + value.length();
-
-    while (iter < end) {
-        switch (*iter) {
-          case '"':  BSLS_ANNOTATION_FALLTHROUGH;
-          case '\\': BSLS_ANNOTATION_FALLTHROUGH;
-          case '/': {
-            writeEscapedChar(stream, &currentStart, iter, *iter);
-          } break;
-          case '\b': {
-            writeEscapedChar(stream, &currentStart, iter, 'b');
-          } break;
-          case '\f': {
-            writeEscapedChar(stream, &currentStart, iter, 'f');
-          } break;
-          case '\n': {
-            writeEscapedChar(stream, &currentStart, iter, 'n');
-          } break;
-          case '\r': {
-            writeEscapedChar(stream, &currentStart, iter, 'r');
-          } break;
-          case '\t': {
-            writeEscapedChar(stream, &currentStart, iter, 't');
-          } break;
-
-          // control characters
-
-          case '\x00': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x01': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x02': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x03': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x04': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x05': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x06': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x07': BSLS_ANNOTATION_FALLTHROUGH;
-          // Backspace       ('\b') handled above
-//        case '\x08': BSLS_ANNOTATION_FALLTHROUGH;
-          // Horizontal tab  ('\t') handled above
-//        case '\x09': BSLS_ANNOTATION_FALLTHROUGH;
-          // New line        ('\n') handled above
-//        case '\x0A': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x0B': BSLS_ANNOTATION_FALLTHROUGH;
-          // Form feed       ('\f') handled above
-//        case '\x0C': BSLS_ANNOTATION_FALLTHROUGH;
-          // Carriage return ('\r') handled above
-//        case '\x0D': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x0E': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x0F': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x10': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x11': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x12': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x13': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x14': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x15': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x16': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x17': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x18': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x19': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x1A': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x1B': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x1C': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x1D': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x1E': BSLS_ANNOTATION_FALLTHROUGH;
-          case '\x1F': {
-            writeEscapedChar(stream, &currentStart, iter, 'u');
-
-            const char *k_HEX_BYTES = "0123456789abcdef";
-
-            const int k_BUF_SIZE = 4;
-            char      buffer[k_BUF_SIZE] ;
-
-            buffer[0] = '0';
-            buffer[1] = '0';
-            buffer[2] = k_HEX_BYTES[(*iter & 0xF0) >> 4];
-            buffer[3] = k_HEX_BYTES[ *iter & 0x0F];
-
-            stream.write(buffer, k_BUF_SIZE);
-            currentStart = iter + 1;
-          }
+    put(stream, '"');
+
+    // Write each run of characters that need no escaping with a single write,
+    // followed by the escape sequence of the character that ends the run.
+
+    const char *runStart = value.data();
+    const char *iter     = value.data();
+    const char *end      = value.data() + value.length();
+
+    for (; iter < end; ++iter) {
+        const char escape = k_ESCAPES[static_cast<unsigned char>(*iter)];
+        if (0 == escape) {
+            continue;                                               // CONTINUE
+        }
+
+        if (runStart != iter) {
+            write(stream, runStart, iter - runStart);
         }
-        ++iter;
+        runStart = iter + 1;
+
+        char sequence[6] = { '\\', escape, '0', '0', 0, 0 };
+        if ('u' == escape) {
+            static const char k_HEX_DIGITS[] = "0123456789abcdef";
 
+            sequence[4] = k_HEX_DIGITS[(*iter & 0xF0) >> 4];
+            sequence[5] = k_HEX_DIGITS[ *iter & 0x0F];
+            write(stream, sequence, 6);
+        }
+        else {
+            write(stream, sequence, 2);
+        }
     }
 
-    stream.write(currentStart, end - currentStart);
-    stream.put('"');
+    if (runStart != end) {
+        write(stream, runStart, end - runStart);
+    }
+    put(stream, '"');
 
     return 0;
 }
@@ -169,9 +211,9 @@ int PrintUtil::printValue(bsl::ostream&         stream,
       } break;
       default: {
         if (options && options->encodeQuotedDecimal64()) {
-            stream.put('"');
+            put(stream, '"');
             stream << value;
-            stream.put('"');
+            put(stream, '"');
         }
         else {
             stream << value;
@@ -18,6 +18,12 @@ BSLS_IDENT("$Id: $")
 // overloaded for all 'bdeat' Simple types.  The following table describes the
 // format in which various Simple types are encoded.
 //
+// The low-level functions 'put', 'write', and 'writeInteger' write text
+// directly to the stream buffer of a stream.  'writeInteger' does not consult
+// the formatting flags or the locale of the stream, and is meant for streams
+// whose formatting state is known to be the default (such as the one used by
+// 'baljsn::Encoder'); 'printValue' honors the formatting state of the stream.
+//
 // Refer to the details of the JSON encoding format supported by this utility
 // in the package documentation file (doc/baljsn.txt).
 //
@@ -82,6 +88,7 @@ BSLS_IDENT("$Id: $")
 #include <baljsn_encoderoptions.h>
 
 #include <bdlb_float.h>
+#include <bdlb_floatconversionutil.h>
 
 #include <bdldfp_decimal.h>
 #include <bdldfp_decimalconvertutil.h>
@@ -143,8 +150,27 @@ struct PrintUtil {
         // Encode the specified string 'value' into JSON format and output the
         // result to the specified 'stream'.
 
-  public:
-    // CLASS METHODS
+    static void put(bsl::ostream& stream, char character);
+    static void write(bsl::ostream&    stream,
+                      const char      *data,
+                      bsl::streamsize  length);
+        // Write the specified 'character', or the specified 'length'
+        // characters starting at the specified 'data', directly to the stream
+        // buffer of the specified 'stream', and set 'badbit' in the state of
+        // 'stream' if they cannot all be written.  Do nothing unless 'stream'
+        // is in a good state.  Note that, unlike the unformatted output
+        // functions of 'bsl::ostream', these functions construct no sentry,
+        // and that 'put' usually stores the character without a virtual
+        // call.
+
+    static void writeInteger(bsl::ostream& stream, bsls::Types::Int64 value);
+    static void writeInteger(bsl::ostream& stream, bsls::Types::Uint64 value);
+        // Write the decimal text of the specified 'value' to the specified
+        // 'stream' as 'write' does.  Note that, unlike 'printValue', these
+        // functions consult neither the formatting flags (e.g., 'hex' or
+        // 'showpos') nor the locale of 'stream', so that they are suitable
+        // only for streams in their default state.
+
     static int printValue(bsl::ostream&         stream,
                           bool                  value,
                           const EncoderOptions *options = 0);
@@ -246,6 +272,32 @@ int PrintUtil::maxStreamPrecision<double>(
 }
 
 // CLASS METHODS
+inline
+void PrintUtil::put(bsl::ostream& stream, char character)
+{
+    if (!stream.good()) {
+        return;                                                       // RETURN
+    }
+
+    if (bsl::ostream::traits_type::eof() == stream.rdbuf()->sputc(character)) {
+        stream.setstate(bsl::ios_base::badbit);
+    }
+}
+
+inline
+void PrintUtil::write(bsl::ostream&    stream,
+                      const char      *data,
+                      bsl::streamsize  length)
+{
+    if (!stream.good()) {
+        return;                                                       // RETURN
+    }
+
+    if (length != stream.rdbuf()->sputn(data, length)) {
+        stream.setstate(bsl::ios_base::badbit);
+    }
+}
+
 template <class TYPE>
 inline
 int PrintUtil::printDateAndTime(bsl::ostream&         stream,
@@ -299,23 +351,13 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         }
       } break;
       default: {
-        const int k_SIZE = 32;
-        char      buffer[k_SIZE];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+        char      buffer[bdlb::FloatConversionUtil::k_MAX_FORMATTED_LENGTH];
+        const int len = bdlb::FloatConversionUtil::formatGeneral(
+                                            buffer,
+                                            value,
+                                            maxStreamPrecision<TYPE>(options));
 
-        const int len = snprintf(buffer,
-                                 k_SIZE,
-                                 "%-1.*g",
-                                 maxStreamPrecision<TYPE>(options),
-                                 value);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-        stream.write(buffer, len);
+        write(stream, buffer, len);
       }
     }
     return 0;
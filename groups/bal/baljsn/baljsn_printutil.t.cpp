@@ -3,6 +3,8 @@
 
 #include <bdldfp_decimal.h>
 
+#include <bdlsb_fixedmemoutstreambuf.h>
+
 #include <bdlt_date.h>
 #include <bdlt_datetime.h>
 #include <bdlt_datetimetz.h>
@@ -63,9 +65,13 @@ using bsl::endl;
 // [ 5] static int printValue(bsl::ostream& s, const bdlt::DatetimeTz&   v);
 // [ 5] static int printValue(bsl::ostream& s, const bdldfp::Decimal64&  v);
 // [ 6] static int printValue(bsl::ostream& s, const bdlt::DatetimeInterval v);
+// [ 8] static void put(bsl::ostream& s, char c);
+// [ 8] static void write(bsl::ostream& s, const char *d, streamsize l);
+// [ 8] static void writeInteger(bsl::ostream& s, bsls::Types::Int64  v);
+// [ 8] static void writeInteger(bsl::ostream& s, bsls::Types::Uint64 v);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -251,7 +257,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -329,6 +335,136 @@ int main(int argc, char *argv[])
 //  }
 //..
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // LOW-LEVEL OUTPUT
+        //
+        // Concerns:
+        //: 1 'put', 'write', and 'writeInteger' write the expected text,
+        //:   including the extreme integer values.
+        //:
+        //: 2 'writeInteger' ignores the formatting flags of the stream, and
+        //:   'printValue' for integers and booleans honors them.
+        //:
+        //: 3 A write that fails sets 'badbit', and nothing is written to a
+        //:   stream that is not in a good state.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, write a set of integers with
+        //:   'writeInteger' and verify the text.  (C-1)
+        //:
+        //: 2 Set 'hex', 'showpos', and a field width on a stream, and verify
+        //:   the text of 'writeInteger' and of 'printValue'.  (C-2)
+        //:
+        //: 3 Write to a stream on a fixed-size buffer that is too small, and
+        //:   to a stream whose 'failbit' is set, and verify the state and the
+        //:   text of the stream.  (C-3)
+        //
+        // Testing:
+        //   static void put(bsl::ostream& s, char c);
+        //   static void write(bsl::ostream& s, const char *d, streamsize l);
+        //   static void writeInteger(bsl::ostream& s, bsls::Types::Int64  v);
+        //   static void writeInteger(bsl::ostream& s, bsls::Types::Uint64 v);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOW-LEVEL OUTPUT" << endl
+                          << "================" << endl;
+
+        typedef bsls::Types::Int64  Int64;
+        typedef bsls::Types::Uint64 Uint64;
+
+        if (verbose) cout << "\nTesting 'writeInteger'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                Int64       d_value;
+                const char *d_expected;
+            } DATA[] = {
+                //LINE  VALUE                    EXPECTED
+                //----  -----------------------  ----------------------
+                { L_,   0,                       "0"                    },
+                { L_,   9,                       "9"                    },
+                { L_,   10,                      "10"                   },
+                { L_,   -99,                     "-99"                  },
+                { L_,   100,                     "100"                  },
+                { L_,   -12345,                  "-12345"               },
+                { L_,   LLONG_MAX,               "9223372036854775807"  },
+                { L_,   LLONG_MIN,               "-9223372036854775808" },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const Int64       VALUE    = DATA[ti].d_value;
+                const bsl::string EXPECTED = DATA[ti].d_expected;
+
+                bsl::ostringstream oss;
+                Obj::writeInteger(oss, VALUE);
+                ASSERTV(LINE, oss.str(), EXPECTED == oss.str());
+            }
+
+            bsl::ostringstream oss;
+            Obj::writeInteger(oss, ULLONG_MAX);
+            ASSERTV(oss.str(), "18446744073709551615" == oss.str());
+        }
+
+        if (verbose) cout << "\nTesting stream flags." << endl;
+        {
+            bsl::ostringstream oss;
+            oss << bsl::hex << bsl::showpos;
+
+            Obj::writeInteger(oss, static_cast<Int64>(255));
+            Obj::put(oss, ' ');
+            Obj::writeInteger(oss, static_cast<Uint64>(255));
+            ASSERTV(oss.str(), "255 255" == oss.str());
+
+            oss.str("");
+            Obj::printValue(oss, 255);
+            ASSERTV(oss.str(), "ff" == oss.str());
+
+            oss.str("");
+            oss << bsl::dec;
+            Obj::printValue(oss, 255);
+            ASSERTV(oss.str(), "+255" == oss.str());
+
+            oss.str("");
+            oss << bsl::noshowpos;
+            oss.width(6);
+            Obj::printValue(oss, true);
+            ASSERTV(oss.str(), "  true" == oss.str());
+        }
+
+        if (verbose) cout << "\nTesting failures." << endl;
+        {
+            char                        buffer[4];
+            bdlsb::FixedMemOutStreamBuf sb(buffer, sizeof buffer);
+            bsl::ostream                os(&sb);
+
+            Obj::write(os, "abc", 3);
+            ASSERT(os.good());
+            Obj::write(os, "de", 2);
+            ASSERT(os.bad());
+            ASSERT(4 == sb.length());
+            Obj::put(os, 'f');
+            ASSERT(4 == sb.length());
+
+            bdlsb::FixedMemOutStreamBuf sb2(buffer, sizeof buffer);
+            bsl::ostream                os2(&sb2);
+
+            Obj::writeInteger(os2, static_cast<Int64>(12345));
+            ASSERT(os2.bad());
+
+            bsl::ostringstream oss;
+            Obj::write(oss, "ab", 2);
+            oss.setstate(bsl::ios_base::failbit);
+            Obj::write(oss, "cd", 2);
+            Obj::put(oss, 'e');
+            Obj::writeInteger(oss, static_cast<Int64>(1));
+            ASSERTV(oss.str(), "ab" == oss.str());
+            ASSERT(!oss.bad());
+        }
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // ENCODING 'INF' AND 'NaN' FLOATING POINT VALUES
@@ -4,14 +4,21 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
-#include <bdlb_chartype.h>
+#include <bdlb_bitutil.h>
 
-#include <bsl_cstring.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstdint.h>
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
 
 #include <baljsn_parserutil.h>                 // for testing only
 
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define U_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
 // IMPLEMENTATION NOTES
 // --------------------
 // The following table provides the various transitions that need to be handled
@@ -52,12 +59,185 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 //   END_OBJECT                   '}'         ']'              END_ARRAY
 //   END_ARRAY                    ']'         ']'              END_ARRAY
 //..
+//
+///Character Scanning
+///------------------
+// Nearly all of the time spent tokenizing is spent looking for the end of a
+// run of characters: the end of a run of whitespace, the closing '"' of a
+// string (or a '\' that escapes the next character), or the end of an
+// unquoted value.  These searches are performed by the 'find*' functions
+// below, which, when SSE2 is available, classify 16 characters at a time by
+// comparing them against each character of interest, and use the resulting
+// bit mask to locate the first match.  Escape-free runs of a string are
+// therefore skipped in a handful of instructions, and the resulting value is
+// still referred to (not copied) by the 'bslstl::StringRef' returned by
+// 'value'.  The remaining (fewer than 16) characters of a buffer, and all
+// characters on platforms without SSE2, are classified one at a time.
+//
+// Note that the whitespace characters are those matched by
+// 'bdlb::CharType::isSpace' (' ', and '\t' through '\r'), and that an unquoted
+// value is terminated by whitespace, a token character ("{}[]:,"), or a null
+// character (as the tokenizer has always treated embedded null characters).
 
 namespace BloombergLP {
 namespace {
 
-    static const char *WHITESPACE = " \n\t\v\f\r";
-    static const char *TOKENS     = "{}[]:,";
+inline
+bool isWhitespace(char character)
+{
+    // Return 'true' if the specified 'character' is a whitespace character,
+    // and 'false' otherwise.
+
+    return ' ' == character
+        || static_cast<unsigned char>(character - '\t') <= '\r' - '\t';
+}
+
+inline
+bool isValueTerminator(char character)
+{
+    // Return 'true' if the specified 'character' terminates an unquoted
+    // value, and 'false' otherwise.
+
+    switch (character) {
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+      case '\0': {
+        return true;                                                  // RETURN
+      }
+    }
+    return isWhitespace(character);
+}
+
+#ifdef U_USE_SSE2
+inline
+__m128i whitespaceMask(__m128i characters)
+{
+    // Return a mask having all bits set in each byte position for which the
+    // corresponding byte of the specified 'characters' is a whitespace
+    // character, and no bits set otherwise.
+
+    const __m128i low  = _mm_set1_epi8('\t');
+    const __m128i high = _mm_set1_epi8('\r');
+
+    // 'characters' is in '[low .. high]' if clamping it to that range (using
+    // unsigned comparisons) does not change it.
+
+    const __m128i inRange = _mm_and_si128(
+             _mm_cmpeq_epi8(_mm_max_epu8(characters, low),  characters),
+             _mm_cmpeq_epi8(_mm_min_epu8(characters, high), characters));
+
+    return _mm_or_si128(inRange,
+                        _mm_cmpeq_epi8(characters, _mm_set1_epi8(' ')));
+}
+
+inline
+int firstSetBit(int mask)
+{
+    // Return the index of the lowest-order set bit in the specified non-zero
+    // 'mask'.
+
+    return bdlb::BitUtil::numTrailingUnsetBits(
+                                            static_cast<bsl::uint32_t>(mask));
+}
+#endif
+
+const char *findNonWhitespace(const char *begin, const char *end)
+{
+    // Return the address of the first character in the specified range
+    // '[begin .. end)' that is not a whitespace character, or 'end' if there
+    // is no such character.
+
+#ifdef U_USE_SSE2
+    for (; end - begin >= 16; begin += 16) {
+        const __m128i characters =
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+        const int mask = ~_mm_movemask_epi8(whitespaceMask(characters))
+                       & 0xFFFF;
+        if (mask) {
+            return begin + firstSetBit(mask);                         // RETURN
+        }
+    }
+#endif
+
+    while (begin < end && isWhitespace(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *findQuoteOrBackslash(const char *begin, const char *end)
+{
+    // Return the address of the first '"' or '\' character in the specified
+    // range '[begin .. end)', or 'end' if there is no such character.
+
+#ifdef U_USE_SSE2
+    const __m128i quote     = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+
+    for (; end - begin >= 16; begin += 16) {
+        const __m128i characters =
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+        const __m128i match = _mm_or_si128(
+                                       _mm_cmpeq_epi8(characters, quote),
+                                       _mm_cmpeq_epi8(characters, backslash));
+        const int     mask  = _mm_movemask_epi8(match);
+        if (mask) {
+            return begin + firstSetBit(mask);                         // RETURN
+        }
+    }
+#endif
+
+    while (begin < end && '"' != *begin && '\\' != *begin) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *findValueTerminator(const char *begin, const char *end)
+{
+    // Return the address of the first character in the specified range
+    // '[begin .. end)' that terminates an unquoted value, or 'end' if there
+    // is no such character.
+
+#ifdef U_USE_SSE2
+    // '[' and ']' differ from '{' and '}' only in the 0x20 bit, so setting
+    // that bit lets two comparisons find all four brackets.
+
+    const __m128i caseBit      = _mm_set1_epi8(0x20);
+    const __m128i openBrace    = _mm_set1_epi8('{');
+    const __m128i closeBrace   = _mm_set1_epi8('}');
+    const __m128i colon        = _mm_set1_epi8(':');
+    const __m128i comma        = _mm_set1_epi8(',');
+    const __m128i zero         = _mm_setzero_si128();
+
+    for (; end - begin >= 16; begin += 16) {
+        const __m128i characters =
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+        const __m128i folded = _mm_or_si128(characters, caseBit);
+
+        __m128i match = whitespaceMask(characters);
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(folded, openBrace));
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(folded, closeBrace));
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(characters, colon));
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(characters, comma));
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(characters, zero));
+
+        const int mask = _mm_movemask_epi8(match);
+        if (mask) {
+            return begin + firstSetBit(mask);                         // RETURN
+        }
+    }
+#endif
+
+    while (begin < end && !isValueTerminator(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
 
 }  // close unnamed namespace
 
@@ -70,6 +250,10 @@ namespace baljsn {
 // PRIVATE MANIPULATORS
 int Tokenizer::reloadStringBuffer()
 {
+    if (!d_streambuf_p) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
     const int numRead =
                      static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[0],
@@ -81,6 +265,10 @@ int Tokenizer::reloadStringBuffer()
 
 int Tokenizer::expandBufferForLargeValue()
 {
+    if (!d_streambuf_p) {
+        return -1;                                                    // RETURN
+    }
+
     const bsl::string::size_type currLength = d_stringBuffer.length();
     d_stringBuffer.resize(currLength + k_MAX_STRING_SIZE);
 
@@ -93,6 +281,10 @@ int Tokenizer::expandBufferForLargeValue()
 
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (!d_streambuf_p) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -112,11 +304,14 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
-            break;
+        if (d_cursor < bufferLength()) {
+            const char *begin = bufferData();
+            const char *end   = begin + bufferLength();
+            const char *pos   = findNonWhitespace(begin + d_cursor, end);
+            if (end != pos) {
+                d_cursor = pos - begin;
+                break;
+            }
         }
 
         const int numRead = reloadStringBuffer();
@@ -129,64 +324,65 @@ int Tokenizer::skipWhitespace()
 
 int Tokenizer::extractStringValue()
 {
-    bool firstTime    = true;
-    char previousChar = 0;
+    bool firstTime = true;
+    bool escaped   = false;  // 'true' if the next character is escaped
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
+        const char *begin = bufferData();
+        const char *end   = begin + bufferLength();
+        const char *iter  = begin + d_valueIter;
+
+        while (iter < end) {
+            if (escaped) {
+                escaped = false;
+                ++iter;
+                continue;
+            }
 
-            if ('\\' == d_stringBuffer[d_valueIter]
-             && '\\' == previousChar) {
-                previousChar = 0;
+            iter = findQuoteOrBackslash(iter, end);
+            if (end == iter) {
+                break;
             }
-            else {
-                previousChar = d_stringBuffer[d_valueIter];
+
+            if ('"' == *iter) {
+                d_valueIter = iter - begin;
+                d_valueEnd  = d_valueIter;
+                return 0;                                             // RETURN
             }
 
-            ++d_valueIter;
+            escaped = true;
+            ++iter;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        d_valueIter = iter - begin;
 
-            // There isn't enough room in the internal buffer to hold the
-            // value.  If this is the first time through the loop, we move the
-            // current sequence of characters being processed to the front of
-            // the internal buffer, otherwise we must expand the internal
-            // buffer to hold additional characters.  If we are at the
-            // beginning of the string buffer then we dont need to move any
-            // characters and we simply expand the string buffer.
-
-            if (0 == d_valueBegin) {
-                firstTime = false;
-            }
+        // There isn't enough room in the internal buffer to hold the value.
+        // If this is the first time through the loop, we move the current
+        // sequence of characters being processed to the front of the internal
+        // buffer, otherwise we must expand the internal buffer to hold
+        // additional characters.  If we are at the beginning of the string
+        // buffer then we dont need to move any characters and we simply
+        // expand the string buffer.
 
-            if (firstTime) {
-                const int numRead = moveValueCharsToStartAndReloadBuffer();
-                if (0 == numRead) {
-                    return -1;                                        // RETURN
-                }
+        if (0 == d_valueBegin) {
+            firstTime = false;
+        }
 
-                firstTime = false;
-            }
-            else {
-                const int rc = expandBufferForLargeValue();
-                if (rc) {
-                    return rc;                                        // RETURN
-                }
+        if (firstTime) {
+            const int numRead = moveValueCharsToStartAndReloadBuffer();
+            if (0 == numRead) {
+                return -1;                                            // RETURN
             }
+
+            firstTime = false;
         }
         else {
-            if ('\\' == previousChar) {
-                ++d_valueIter;
-                previousChar = 0;
-                continue;
+            const int rc = expandBufferForLargeValue();
+            if (rc) {
+                return rc;                                            // RETURN
             }
-            d_valueEnd = d_valueIter;
-            return 0;                                                 // RETURN
         }
     }
-    return 0;
 }
 
 int Tokenizer::skipNonWhitespaceOrTillToken()
@@ -194,13 +390,14 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
+        if (d_valueIter < bufferLength()) {
+            const char *begin = bufferData();
+            const char *end   = begin + bufferLength();
+            d_valueIter = findValueTerminator(begin + d_valueIter, end)
+                        - begin;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= bufferLength()) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -239,7 +436,7 @@ int Tokenizer::advanceToNextToken()
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= bufferLength()) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -258,7 +455,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        switch (d_stringBuffer[d_cursor]) {
+        switch (bufferData()[d_cursor]) {
           case '{': {
             if ((e_ELEMENT_NAME == d_tokenType && ':' == previousChar)
              || e_START_ARRAY   == d_tokenType
@@ -572,7 +769,7 @@ int Tokenizer::advanceToNextToken()
 
 int Tokenizer::resetStreamBufGetPointer()
 {
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (!d_streambuf_p || d_cursor >= d_stringBuffer.size()) {
         return 0;                                                     // RETURN
     }
 
@@ -590,8 +787,8 @@ int Tokenizer::value(bslstl::StringRef *data) const
 {
     if ((e_ELEMENT_NAME == d_tokenType || e_ELEMENT_VALUE == d_tokenType) &&
         d_valueBegin != d_valueEnd) {
-        data->assign(&d_stringBuffer[d_valueBegin],
-                     &d_stringBuffer[d_valueEnd]);
+        data->assign(bufferData() + d_valueBegin,
+                     bufferData() + d_valueEnd);
         return 0;                                                     // RETURN
     }
     return -1;
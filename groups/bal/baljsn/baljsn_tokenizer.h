@@ -19,6 +19,11 @@ BSLS_IDENT("$Id: $")
 // 'bsl::streambuf' containing JSON data with a tokenizer object and then call
 // the 'advanceToNextToken' function to extract individual data values.
 //
+// Alternatively, 'reset' can associate a tokenizer with JSON data held in a
+// contiguous buffer.  Such data is tokenized in place: it is not copied into
+// the internal buffer of the tokenizer, and the string references supplied by
+// the 'value' accessor refer directly into the client's buffer.
+//
 // This 'class' was created to be used by other components in the 'baljsn'
 // package and in most cases clients should use the 'baljsn_decoder' component
 // instead of using this 'class'.
@@ -208,7 +213,20 @@ class Tokenizer {
 
     bsl::streambuf                      *d_streambuf_p;     // streambuf
                                                             // (held, not
-                                                            // owned)
+                                                            // owned), or 0
+                                                            // if reading
+                                                            // contiguous
+                                                            // input
+
+    const char                          *d_input_p;         // contiguous
+                                                            // input (held,
+                                                            // not owned), or
+                                                            // 0 if reading
+                                                            // the streambuf
+
+    bsl::size_t                          d_inputLength;     // length of
+                                                            // contiguous
+                                                            // input
 
     bsl::size_t                          d_cursor;          // current cursor
 
@@ -287,6 +305,14 @@ class Tokenizer {
         // Returns the top context from the 'd_contextStack' stack without
         // popping.  The behavior is undefined if 'd_contextStack' is empty.
 
+    const char *bufferData() const;
+        // Return the address of the characters being tokenized: the
+        // contiguous input if one was supplied to 'reset', and the internal
+        // string buffer otherwise.
+
+    bsl::size_t bufferLength() const;
+        // Return the number of characters at 'bufferData()'.
+
     // Not implemented:
     Tokenizer(const Tokenizer&);
 
@@ -307,6 +333,17 @@ class Tokenizer {
         // 'advanceToNextToken' is called.  Note that this function does not
         // change the value of the 'allowStandAloneValues' option.
 
+    void reset(const char *data, bsl::size_t length);
+        // Reset this tokenizer to read the specified 'length' characters of
+        // JSON data starting at the specified 'data' address.  The data is
+        // tokenized in place, without being copied, and the string references
+        // returned by the 'value' accessor refer directly into 'data'.  The
+        // behavior is undefined unless 'data' refers to at least 'length'
+        // characters that remain valid and unmodified until this tokenizer is
+        // reset or destroyed.  Note that the reader will not be on a valid
+        // node until 'advanceToNextToken' is called.  Note that this function
+        // does not change the value of the 'allowStandAloneValues' option.
+
     int advanceToNextToken();
         // Move to the next token in the data steam.  Return 0 on success and a
         // non-zero value otherwise.  Note that each call to
@@ -323,7 +360,8 @@ class Tokenizer {
         // from where this object stopped.  Also note that this call implies
         // the end of processing for this object and any subsequent methods
         // invoked on this object should only be done after calling 'reset' and
-        // specifying a new 'streambuf'.
+        // specifying a new 'streambuf'.  If this tokenizer is reading
+        // contiguous input, this method has no effect and returns 0.
 
     void setAllowStandAloneValues(bool value);
         // Set the 'allowStandAloneValues' option to the specified 'value'.  If
@@ -392,6 +430,18 @@ Tokenizer::ContextType Tokenizer::context() const
     return ret;
 }
 
+inline
+const char *Tokenizer::bufferData() const
+{
+    return d_input_p ? d_input_p : d_stringBuffer.data();
+}
+
+inline
+bsl::size_t Tokenizer::bufferLength() const
+{
+    return d_input_p ? d_inputLength : d_stringBuffer.length();
+}
+
 // CREATORS
 inline
 Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
@@ -399,6 +449,8 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 , d_stackAllocator(d_stackBuffer.buffer(), k_STACKBUFSIZE, basicAllocator)
 , d_stringBuffer(&d_allocator)
 , d_streambuf_p(0)
+, d_input_p(0)
+, d_inputLength(0)
 , d_cursor(0)
 , d_valueBegin(0)
 , d_valueEnd(0)
@@ -424,6 +476,8 @@ inline
 void Tokenizer::reset(bsl::streambuf *streambuf)
 {
     d_streambuf_p = streambuf;
+    d_input_p     = 0;
+    d_inputLength = 0;
     d_stringBuffer.clear();
     d_cursor      = 0;
     d_valueBegin  = 0;
@@ -435,6 +489,16 @@ void Tokenizer::reset(bsl::streambuf *streambuf)
     pushContext(e_OBJECT_CONTEXT);
 }
 
+inline
+void Tokenizer::reset(const char *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    reset(static_cast<bsl::streambuf *>(0));
+    d_input_p     = data;
+    d_inputLength = length;
+}
+
 inline
 void Tokenizer::setAllowStandAloneValues(bool value)
 {
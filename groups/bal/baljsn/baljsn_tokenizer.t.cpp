@@ -49,6 +49,7 @@ using bsl::endl;
 //
 // MANIPULATORS
 // [ 9] void reset(bsl::streambuf &streamBuf);
+// [18] void reset(const char *data, bsl::size_t length);
 // [12] void resetStreamBufGetPointer();
 // [13] void setAllowStandAloneValues(bool value);
 // [14] void setAllowHeterogenousArrays(bool value);
@@ -61,7 +62,8 @@ using bsl::endl;
 // [ 3] int value(bslstl::StringRef *data) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [17] USAGE EXAMPLE
+// [17] CONCERN: CHARACTER RUNS OF ALL LENGTHS AND ALIGNMENTS
+// [19] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -196,7 +198,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 17: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -318,6 +320,366 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING 'reset(const char *data, bsl::size_t length)'
+        //
+        // Concerns:
+        //: 1 A tokenizer reset to contiguous input produces the same sequence
+        //:   of tokens and values as one reset to a 'streambuf' holding the
+        //:   same data.
+        //:
+        //: 2 The values supplied by 'value' refer directly into the input.
+        //:
+        //: 3 Truncated input is reported as an error, and no data beyond the
+        //:   specified length is read.
+        //:
+        //: 4 Values longer than the internal buffer are supported.
+        //:
+        //: 5 'resetStreamBufGetPointer' has no effect and returns 0.
+        //:
+        //: 6 A tokenizer can be reset between 'streambuf' and contiguous
+        //:   input.
+        //:
+        //: 7 No memory is allocated.
+        //
+        // Plan:
+        //: 1 For a table of JSON documents, tokenize each document both from
+        //:   a 'bdlsb::FixedMemInStreamBuf' and in place, and verify that the
+        //:   token types, return codes, and values match, and that each value
+        //:   refers into the input.  Alternate the kind of input used with a
+        //:   single tokenizer object.  (C-1..2, 6)
+        //:
+        //: 2 Tokenize every proper prefix of each document in place from a
+        //:   buffer whose following character would complete the document,
+        //:   and verify that the same tokens are produced as when tokenizing
+        //:   that prefix from a 'streambuf'.  (C-3)
+        //:
+        //: 3 Tokenize a document having a string value larger than the
+        //:   internal buffer.  (C-4)
+        //:
+        //: 4 Call 'resetStreamBufGetPointer' after tokenizing in place.  (C-5)
+        //:
+        //: 5 Use a test allocator to verify that no memory is allocated by
+        //:   the tokenizer reading contiguous input.  (C-7)
+        //
+        // Testing:
+        //   void reset(const char *data, bsl::size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "TESTING 'reset(const char *data, bsl::size_t length)'"
+                 << endl
+                 << "====================================================="
+                 << endl;
+
+        static const char *DATA[] = {
+            "{}",
+            "[]",
+            " { \"a\" : 1 } ",
+            "{\"name\":\"value\",\"n\":-1.5e10,\"b\":true,\"z\":null}",
+            "{\n  \"list\" : [ 1, 2, 3 ],\n  \"obj\" : { \"x\" : \"y\" }\n}",
+            "[{\"a\":\"\\\"esc\\\\aped\\\"\"},{\"b\":[[],{}]}]",
+            "{\"a\":1,,}",
+            "{\"a\"}",
+            "1234",
+            "\"standalone\"",
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator ta("contiguous", veryVeryVerbose);
+        bslma::TestAllocator sa("streambuf",  veryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+        Obj mY(&sa);  const Obj& Y = mY;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const bsl::string INPUT = DATA[ti];
+
+            for (bsl::size_t len = INPUT.length(); len > 0; --len) {
+                if (veryVerbose) { P_(ti) P(len) }
+
+                // Place the prefix in a buffer followed by the remaining
+                // characters, which must not be read.
+
+                const char *BEGIN = INPUT.data();
+
+                bdlsb::FixedMemInStreamBuf isb(BEGIN, len);
+                mY.reset(&isb);
+
+                if (len & 1) {
+                    bdlsb::FixedMemInStreamBuf other(BEGIN, len);
+                    mX.reset(&other);
+                    mX.advanceToNextToken();
+                }
+                mX.reset(BEGIN, len);
+
+                const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+                for (int i = 0; i < 100; ++i) {
+                    const int rcX = mX.advanceToNextToken();
+                    const int rcY = mY.advanceToNextToken();
+
+                    ASSERTV(ti, len, i, rcX, rcY, rcX == rcY);
+                    ASSERTV(ti, len, i, X.tokenType(), Y.tokenType(),
+                            X.tokenType() == Y.tokenType());
+
+                    bslstl::StringRef valueX;
+                    bslstl::StringRef valueY;
+                    const int vrcX = X.value(&valueX);
+                    const int vrcY = Y.value(&valueY);
+
+                    ASSERTV(ti, len, i, vrcX, vrcY, vrcX == vrcY);
+                    if (0 == vrcX) {
+                        ASSERTV(ti, len, i, valueX, valueY, valueX == valueY);
+                        ASSERTV(ti, len, i, BEGIN <= valueX.begin());
+                        ASSERTV(ti, len, i, valueX.end() <= BEGIN + len);
+                    }
+
+                    if (rcX) {
+                        break;
+                    }
+                }
+
+                ASSERTV(ti, len, 0 == mX.resetStreamBufGetPointer());
+                ASSERTV(ti, len, NUM_ALLOCATIONS == ta.numAllocations());
+            }
+        }
+
+        if (verbose) cout << "\nTesting values larger than the buffer."
+                          << endl;
+        {
+            const bsl::string TEXT(3 * 8 * 1024 + 7, 'x');
+            const bsl::string INPUT = "{\"" + TEXT + "\":\"" + TEXT + "\"}";
+
+            const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            mX.reset(INPUT.data(), INPUT.length());
+
+            bslstl::StringRef value;
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_START_OBJECT == X.tokenType());
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_NAME == X.tokenType());
+            ASSERT(0 == X.value(&value));
+            ASSERT(TEXT == value);
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_VALUE == X.tokenType());
+            ASSERT(0 == X.value(&value));
+            ASSERT("\"" + TEXT + "\"" == value);
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_END_OBJECT == X.tokenType());
+
+            ASSERT(0 != mX.advanceToNextToken());
+
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+        }
+      } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // CONCERN: CHARACTER RUNS OF ALL LENGTHS AND ALIGNMENTS
+        //   The tokenizer locates the end of runs of whitespace, of string
+        //   characters, and of unquoted value characters several characters
+        //   at a time where the platform allows it.
+        //
+        // Concerns:
+        //: 1 A run of whitespace of any length, at any offset in the input,
+        //:   and made up of any of the whitespace characters, is skipped.
+        //:
+        //: 2 The end of a string of any length is found at any offset, and
+        //:   escaped '"' and '\' characters at any position in the string are
+        //:   not mistaken for its end.
+        //:
+        //: 3 An unquoted value of any length is terminated by each of the
+        //:   whitespace characters, each of the token characters, and the
+        //:   null character.
+        //:
+        //: 4 Runs that span a reload of the internal buffer are handled
+        //:   correctly.
+        //
+        // Plan:
+        //: 1 For every combination of a leading offset and a run length
+        //:   covering several multiples of 16 characters, tokenize an array
+        //:   containing a run of whitespace, a string value, and a number, and
+        //:   verify the resulting tokens and values.  (C-1)
+        //:
+        //: 2 For every string length and position in the string, replace the
+        //:   character at that position by an escaped '"' or '\' and verify
+        //:   the value of the string.  (C-2)
+        //:
+        //: 3 For every unquoted value length and every terminating character,
+        //:   verify the value of the element.  (C-3)
+        //:
+        //: 4 Repeat P-2 and P-3 for values that straddle the size of the
+        //:   internal buffer.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: CHARACTER RUNS OF ALL LENGTHS AND ALIGNMENTS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "CONCERN: CHARACTER RUNS OF ALL LENGTHS AND ALIGNMENTS"
+                   << endl
+                   << "===================================================="
+                   << endl;
+
+        const char   WHITESPACE[]   = " \t\n\v\f\r";
+        const int    NUM_WHITESPACE = sizeof WHITESPACE - 1;
+        const char   TERMINATORS[]  = " \t\n\v\f\r{}[]:,";
+        const int    NUM_TERMINATORS = sizeof TERMINATORS - 1;
+        const int    MAX_LENGTH     = 50;
+        const int    BUFFER_SIZE    = 8 * 1024;
+
+        if (verbose) cout << "\nTesting whitespace, strings and numbers."
+                          << endl;
+        {
+            for (int offset = 0; offset < 16; ++offset) {
+                for (int length = 0; length < MAX_LENGTH; ++length) {
+                    bsl::string spaces;
+                    for (int i = 0; i < length; ++i) {
+                        spaces += WHITESPACE[(i + offset) % NUM_WHITESPACE];
+                    }
+                    const bsl::string text(length, 'a');
+                    const bsl::string number(length + 1, '1');
+
+                    const bsl::string INPUT = bsl::string(offset, ' ')
+                                            + "[" + spaces + "\"" + text
+                                            + "\"" + spaces + "," + spaces
+                                            + number + spaces + "]";
+
+                    bdlsb::FixedMemInStreamBuf isb(INPUT.data(),
+                                                   INPUT.length());
+
+                    Obj mX;  const Obj& X = mX;
+                    mX.reset(&isb);
+
+                    bslstl::StringRef value;
+
+                    ASSERTV(offset, length, 0 == mX.advanceToNextToken());
+                    ASSERTV(offset, length,
+                            Obj::e_START_ARRAY == X.tokenType());
+
+                    ASSERTV(offset, length, 0 == mX.advanceToNextToken());
+                    ASSERTV(offset, length,
+                            Obj::e_ELEMENT_VALUE == X.tokenType());
+                    ASSERTV(offset, length, 0 == X.value(&value));
+                    ASSERTV(offset, length, value,
+                            "\"" + text + "\"" == value);
+
+                    ASSERTV(offset, length, 0 == mX.advanceToNextToken());
+                    ASSERTV(offset, length,
+                            Obj::e_ELEMENT_VALUE == X.tokenType());
+                    ASSERTV(offset, length, 0 == X.value(&value));
+                    ASSERTV(offset, length, value, number == value);
+
+                    ASSERTV(offset, length, 0 == mX.advanceToNextToken());
+                    ASSERTV(offset, length,
+                            Obj::e_END_ARRAY == X.tokenType());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting escaped characters in strings."
+                          << endl;
+        {
+            const int BASE_LENGTHS[] = { 0, BUFFER_SIZE - 40 };
+
+            for (int bi = 0; bi < 2; ++bi) {
+                const int BASE = BASE_LENGTHS[bi];
+
+                for (int length = 1; length < MAX_LENGTH; ++length) {
+                    for (int pos = 0; pos < length; ++pos) {
+                        for (int ei = 0; ei < 2; ++ei) {
+                            const char ESCAPED = ei ? '\\' : '"';
+
+                            bsl::string text(BASE + length, 'b');
+                            text[BASE + pos] = ESCAPED;
+                            text.insert(BASE + pos, 1, '\\');
+
+                            const bsl::string INPUT =
+                                        "{\"" + text + "\":\"" + text + "\"}";
+
+                            bdlsb::FixedMemInStreamBuf isb(INPUT.data(),
+                                                           INPUT.length());
+
+                            Obj mX;  const Obj& X = mX;
+                            mX.reset(&isb);
+
+                            bslstl::StringRef value;
+
+                            ASSERTV(BASE, length, pos,
+                                    0 == mX.advanceToNextToken());
+
+                            ASSERTV(BASE, length, pos,
+                                    0 == mX.advanceToNextToken());
+                            ASSERTV(BASE, length, pos,
+                                    Obj::e_ELEMENT_NAME == X.tokenType());
+                            ASSERTV(BASE, length, pos, 0 == X.value(&value));
+                            ASSERTV(BASE, length, pos, text == value);
+
+                            ASSERTV(BASE, length, pos,
+                                    0 == mX.advanceToNextToken());
+                            ASSERTV(BASE, length, pos,
+                                    Obj::e_ELEMENT_VALUE == X.tokenType());
+                            ASSERTV(BASE, length, pos, 0 == X.value(&value));
+                            ASSERTV(BASE, length, pos,
+                                    "\"" + text + "\"" == value);
+
+                            ASSERTV(BASE, length, pos,
+                                    0 == mX.advanceToNextToken());
+                            ASSERTV(BASE, length, pos,
+                                    Obj::e_END_OBJECT == X.tokenType());
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting unquoted value terminators." << endl;
+        {
+            const int BASE_LENGTHS[] = { 0, BUFFER_SIZE - 40 };
+
+            for (int bi = 0; bi < 2; ++bi) {
+                const int BASE = BASE_LENGTHS[bi];
+
+                for (int length = 1; length < MAX_LENGTH; ++length) {
+                    for (int ti = 0; ti <= NUM_TERMINATORS; ++ti) {
+                        const char TERMINATOR = ti < NUM_TERMINATORS
+                                              ? TERMINATORS[ti]
+                                              : '\0';
+
+                        const bsl::string number(BASE + length, '2');
+
+                        bsl::string INPUT = "[" + number;
+                        INPUT += TERMINATOR;
+                        INPUT += "]";
+
+                        bdlsb::FixedMemInStreamBuf isb(INPUT.data(),
+                                                       INPUT.length());
+
+                        Obj mX;  const Obj& X = mX;
+                        mX.reset(&isb);
+
+                        bslstl::StringRef value;
+
+                        ASSERTV(BASE, length, ti,
+                                0 == mX.advanceToNextToken());
+
+                        ASSERTV(BASE, length, ti,
+                                0 == mX.advanceToNextToken());
+                        ASSERTV(BASE, length, ti,
+                                Obj::e_ELEMENT_VALUE == X.tokenType());
+                        ASSERTV(BASE, length, ti, 0 == X.value(&value));
+                        ASSERTV(BASE, length, ti, number == value);
+                    }
+                }
+            }
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // TESTING that arrays of heterogenous types are handled correctly
@@ -9,17 +9,26 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 #include <ball_loggermanagerconfiguration.h>  // for testing only
 #include <ball_streamobserver.h>              // for testing only
 
+#include <bdlb_bitutil.h>
+#include <bdlcc_singleproducersingleconsumerboundedqueue.h>
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
 #include <bdls_processutil.h>
 #include <bdlt_currenttime.h>
 
 #include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
+#include <bslmf_movableref.h>
 #include <bslmt_lockguard.h>
+#include <bslmt_once.h>
 #include <bslmt_threadattributes.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_timeutil.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
@@ -34,6 +43,49 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 // thread is restarted, 'shutdownThread' clears the queue in order to simplify
 // the implementation.  Alternative designs are possible, but are not perceived
 // to be worth the added complexity.
+//
+// With 'e_PER_THREAD_QUEUES', each publishing thread owns an
+// 'AsyncFileObserver_ThreadQueue' per observer to which it publishes.  The
+// publishing thread is the only producer of its queue, and the publication
+// thread (or, while no publication thread is running, the thread holding
+// 'd_mutex') is the only consumer.  The 'e_END' record is not needed:
+// 'stopThread' sets 'd_stoppingFlag' and posts 'd_idleSemaphore', and the
+// thread exits after a final pass over the queues.
+//
+// When a pass over the queues publishes no record, the publication thread sets
+// 'd_idleFlag', checks (again) that every queue is empty, and then waits on
+// 'd_idleSemaphore'.  After appending a record to its queue, 'publish' posts
+// 'd_idleSemaphore' if it is the first to clear 'd_idleFlag'.  The publication
+// thread stores to 'd_idleFlag' before checking the queues, and 'publish'
+// loads 'd_idleFlag' after the read-modify-write operation that makes the
+// record readable, both with sequential consistency; so either the
+// publication thread sees the record, or 'publish' sees the flag, and a record
+// is never left on a queue while the publication thread waits.  The flag is
+// loaded before it is cleared, so that 'publish' performs no read-modify-write
+// operation on the flag (shared by all publishing threads) unless the
+// publication thread is idle.  A surplus post merely causes one additional
+// pass over the queues.
+//
+// The queues of a thread are found through a single, process-wide,
+// thread-specific key whose value is a singly-linked list of the queues of the
+// calling thread (most recently used first), so that a thread publishing to
+// several observers does not repeatedly create queues, and so that the cleanup
+// function of the key remains valid for the life of the process.  A queue is
+// reference counted: one reference is held by the thread (and released on
+// thread exit), and one by the observer (and released by the publication
+// thread once the thread's reference has been released and the queue has been
+// drained, or when the observer is destroyed).  A queue, and the records
+// buffer of its queue, are supplied by the global allocator, since the
+// reference of a thread may be the last one released, after the observer (and
+// possibly the allocator of the observer) has been destroyed.  A queue records
+// the unique identifier of its observer, so a queue left behind by a destroyed
+// observer is never mistaken for the queue of a new observer allocated at the
+// same address; such queues are removed from the list of a thread the next
+// time it searches the list.
+//
+// The publish latency histogram has 8 buckets for each power of two (and one
+// bucket for each latency below 8 nanoseconds), so that the upper bound of a
+// bucket exceeds its lower bound by at most 12.5%.
 
 namespace BloombergLP {
 namespace ball {
@@ -42,11 +94,64 @@ namespace {
 
 enum {
     k_DEFAULT_FIXED_QUEUE_SIZE = 8192,
-    k_FORCE_WARN_THRESHOLD     = 5000
+    k_FORCE_WARN_THRESHOLD     = 5000,
+
+    k_MAX_BATCH_SIZE           = 256,   // maximum number of records written
+                                        // by a call to 'publishBatch'
+
+    k_SUB_BUCKET_BITS          = 3      // log2 of the number of latency
+                                        // buckets for each power of two
 };
 
 static const char *const k_LOG_CATEGORY = "BALL.ASYNCFILEOBSERVER";
 
+bsls::AtomicOperations::AtomicTypes::Uint64 s_lastObserverId;
+    // the identifier most recently assigned to an observer
+
+bslmt::ThreadUtil::Key                       s_threadQueuesKey;
+    // the key of the thread-specific list of queues
+
+int latencyBucket(bsls::Types::Int64 nanoseconds)
+    // Return the index of the publish latency histogram bucket for the
+    // specified 'nanoseconds'.
+{
+    const int k_SUB_BUCKETS = 1 << k_SUB_BUCKET_BITS;
+
+    if (nanoseconds < k_SUB_BUCKETS) {
+        return nanoseconds < 0 ? 0 : static_cast<int>(nanoseconds);   // RETURN
+    }
+
+    const bsl::uint64_t value = static_cast<bsl::uint64_t>(nanoseconds);
+    const int           msb   = 63 - bdlb::BitUtil::numLeadingUnsetBits(value);
+    const int           shift = msb - k_SUB_BUCKET_BITS;
+    const int           sub   = static_cast<int>(value >> shift)
+                              & (k_SUB_BUCKETS - 1);
+
+    return (shift + 1) * k_SUB_BUCKETS + sub;
+}
+
+bsls::Types::Int64 latencyBucketUpperBound(int bucket)
+    // Return the largest latency, in nanoseconds, in the publish latency
+    // histogram bucket having the specified 'bucket' index.
+{
+    const int k_SUB_BUCKETS = 1 << k_SUB_BUCKET_BITS;
+
+    if (bucket < k_SUB_BUCKETS) {
+        return bucket;                                                // RETURN
+    }
+
+    const int msb   = bucket / k_SUB_BUCKETS + k_SUB_BUCKET_BITS - 1;
+    const int sub   = bucket % k_SUB_BUCKETS;
+    const int shift = msb - k_SUB_BUCKET_BITS;
+
+    const bsls::Types::Uint64 lower =
+                     static_cast<bsls::Types::Uint64>(k_SUB_BUCKETS + sub)
+                                                                     << shift;
+
+    return static_cast<bsls::Types::Int64>(
+                   lower + (static_cast<bsls::Types::Uint64>(1) << shift) - 1);
+}
+
 static void populateWarnRecord(ball::Record *record,
                                int           lineNumber,
                                int           numDropped)
@@ -61,6 +166,174 @@ static void populateWarnRecord(ball::Record *record,
     os << "Dropped " << numDropped << " log records." << bsl::ends;
 }
 
+}  // close unnamed namespace
+
+                    // ===================================
+                    // class AsyncFileObserver_ThreadQueue
+                    // ===================================
+
+class AsyncFileObserver_ThreadQueue {
+    // This class implements the queue of log records published by one thread
+    // to one async file observer, shared by the publishing thread and the
+    // observer.
+
+    // PRIVATE TYPES
+    typedef bdlcc::SingleProducerSingleConsumerBoundedQueue<
+                                              AsyncFileObserver_Record> Queue;
+
+    // DATA
+    Queue                          d_queue;          // queued records
+
+    bsls::AtomicInt                d_refCount;       // number of references
+                                                     // (thread and observer)
+
+    bsls::Types::Uint64            d_observerId;     // identifier of owning
+                                                     // observer
+
+    AsyncFileObserver_ThreadQueue *d_next_p;         // next queue of the same
+                                                     // thread; accessed only
+                                                     // by that thread
+
+    bslma::Allocator              *d_allocator_p;    // memory allocator (held,
+                                                     // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    AsyncFileObserver_ThreadQueue(const AsyncFileObserver_ThreadQueue&);
+    AsyncFileObserver_ThreadQueue& operator=(
+                                         const AsyncFileObserver_ThreadQueue&);
+
+  public:
+    // CLASS METHODS
+    static void release(AsyncFileObserver_ThreadQueue *queue);
+        // Release a reference to the specified 'queue', and destroy 'queue'
+        // and return its memory to its allocator if no references remain.
+
+    static void releaseOnThreadExit(void *queues);
+        // Release the references of the exiting thread to each queue in the
+        // specified 'queues' list.  Note that this function is the cleanup
+        // function of 's_threadQueuesKey'.
+
+    // CREATORS
+    AsyncFileObserver_ThreadQueue(bsls::Types::Uint64  observerId,
+                                  bsl::size_t          capacity,
+                                  bslma::Allocator    *basicAllocator);
+        // Create a queue of the specified 'capacity' records, owned by the
+        // observer having the specified 'observerId' and referenced by both
+        // that observer and the calling thread, using the specified
+        // 'basicAllocator' to supply memory.
+
+    // MANIPULATORS
+    AsyncFileObserver_ThreadQueue *next();
+        // Return the address of the next queue of the thread owning this
+        // queue, or 0 if this is the last.
+
+    Queue& queue();
+        // Return a reference providing modifiable access to the records of
+        // this queue.
+
+    void setNext(AsyncFileObserver_ThreadQueue *next);
+        // Set the next queue of the thread owning this queue to the specified
+        // 'next'.
+
+    // ACCESSORS
+    bool isShared() const;
+        // Return 'true' if both the publishing thread and the observer
+        // reference this queue, and 'false' otherwise.
+
+    bsls::Types::Uint64 observerId() const;
+        // Return the identifier of the observer that owns this queue.
+};
+
+                    // -----------------------------------
+                    // class AsyncFileObserver_ThreadQueue
+                    // -----------------------------------
+
+// CLASS METHODS
+void AsyncFileObserver_ThreadQueue::release(
+                                          AsyncFileObserver_ThreadQueue *queue)
+{
+    BSLS_ASSERT(queue);
+
+    if (0 == queue->d_refCount.subtractAcqRel(1)) {
+        bslma::Allocator *allocator = queue->d_allocator_p;
+        allocator->deleteObject(queue);
+    }
+}
+
+void AsyncFileObserver_ThreadQueue::releaseOnThreadExit(void *queues)
+{
+    AsyncFileObserver_ThreadQueue *queue =
+                          static_cast<AsyncFileObserver_ThreadQueue *>(queues);
+    while (queue) {
+        AsyncFileObserver_ThreadQueue *next = queue->d_next_p;
+        release(queue);
+        queue = next;
+    }
+}
+
+// CREATORS
+AsyncFileObserver_ThreadQueue::AsyncFileObserver_ThreadQueue(
+                                       bsls::Types::Uint64  observerId,
+                                       bsl::size_t          capacity,
+                                       bslma::Allocator    *basicAllocator)
+: d_queue(capacity, basicAllocator)
+, d_refCount(2)
+, d_observerId(observerId)
+, d_next_p(0)
+, d_allocator_p(basicAllocator)
+{
+}
+
+// MANIPULATORS
+inline
+AsyncFileObserver_ThreadQueue *AsyncFileObserver_ThreadQueue::next()
+{
+    return d_next_p;
+}
+
+inline
+AsyncFileObserver_ThreadQueue::Queue& AsyncFileObserver_ThreadQueue::queue()
+{
+    return d_queue;
+}
+
+inline
+void AsyncFileObserver_ThreadQueue::setNext(
+                                           AsyncFileObserver_ThreadQueue *next)
+{
+    d_next_p = next;
+}
+
+// ACCESSORS
+inline
+bool AsyncFileObserver_ThreadQueue::isShared() const
+{
+    return 1 < d_refCount.loadAcquire();
+}
+
+inline
+bsls::Types::Uint64 AsyncFileObserver_ThreadQueue::observerId() const
+{
+    return d_observerId;
+}
+
+namespace {
+
+const bslmt::ThreadUtil::Key& threadQueuesKey()
+    // Return the process-wide key of the thread-specific list of queues,
+    // creating it on first use.
+{
+    BSLMT_ONCE_DO {
+        int rc = bslmt::ThreadUtil::createKey(
+                         &s_threadQueuesKey,
+                         &AsyncFileObserver_ThreadQueue::releaseOnThreadExit);
+        BSLS_ASSERT_OPT(0 == rc);
+        (void)rc;
+    }
+    return s_threadQueuesKey;
+}
+
 }  // close unnamed namespace
 
                        // -----------------------
@@ -68,6 +341,88 @@ static void populateWarnRecord(ball::Record *record,
                        // -----------------------
 
 // PRIVATE MANIPULATORS
+AsyncFileObserver_ThreadQueue *AsyncFileObserver::acquireThreadQueue()
+{
+    BSLS_ASSERT(e_PER_THREAD_QUEUES == d_queueBackend);
+
+    const bslmt::ThreadUtil::Key& key = threadQueuesKey();
+
+    AsyncFileObserver_ThreadQueue *head =
+                                 static_cast<AsyncFileObserver_ThreadQueue *>(
+                                          bslmt::ThreadUtil::getSpecific(key));
+
+    if (head && d_id == head->observerId()) {
+        return head;                                                  // RETURN
+    }
+
+    // Search the list of the calling thread, removing the queues of destroyed
+    // observers.
+
+    AsyncFileObserver_ThreadQueue *result = 0;
+    AsyncFileObserver_ThreadQueue *prev   = 0;
+    AsyncFileObserver_ThreadQueue *queue  = head;
+
+    while (queue) {
+        AsyncFileObserver_ThreadQueue *next = queue->next();
+
+        if (d_id == queue->observerId() || !queue->isShared()) {
+            if (prev) {
+                prev->setNext(next);
+            }
+            else {
+                head = next;
+            }
+
+            if (d_id == queue->observerId()) {
+                result = queue;
+            }
+            else {
+                AsyncFileObserver_ThreadQueue::release(queue);
+            }
+        }
+        else {
+            prev = queue;
+        }
+        queue = next;
+    }
+
+    if (!result) {
+        // The calling thread may release the last reference to the queue
+        // after this observer is destroyed (see implementation notes).
+
+        bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+        result = new (*allocator) AsyncFileObserver_ThreadQueue(
+                                                         d_id,
+                                                         d_threadQueueCapacity,
+                                                         allocator);
+
+        bslma::RawDeleterProctor<AsyncFileObserver_ThreadQueue,
+                                 bslma::Allocator> proctor(result, allocator);
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_threadQueuesMutex);
+            d_threadQueues.push_back(result);
+        }
+        proctor.release();
+    }
+
+    // Move the queue to the front of the list of the calling thread.
+
+    result->setNext(head);
+    bslmt::ThreadUtil::setSpecific(key, result);
+
+    return result;
+}
+
+void AsyncFileObserver::clearThreadQueues()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadQueuesMutex);
+
+    for (bsl::size_t i = 0; i < d_threadQueues.size(); ++i) {
+        d_threadQueues[i]->queue().removeAll();
+    }
+}
+
 void AsyncFileObserver::logDroppedMessageWarning(int numDropped)
 {
     // Log the record, unconditionally, to the file observer (i.e., without
@@ -98,6 +453,8 @@ void AsyncFileObserver::publishThreadEntryPoint()
         else {
             d_fileObserver.publish(*asyncRecord.d_record,
                                    asyncRecord.d_context);
+            recordPublishLatency(asyncRecord.d_enqueueTime,
+                                 bsls::TimeUtil::getTimer());
         }
 
         // Publish the count of dropped records.  To avoid repeatedly
@@ -120,6 +477,137 @@ void AsyncFileObserver::publishThreadEntryPoint()
     }
 }
 
+void AsyncFileObserver::publishThreadQueues()
+{
+    d_droppedRecordWarning.fixedFields().setThreadID(
+                                          bslmt::ThreadUtil::selfIdAsUint64());
+
+    ThreadQueues                          queues(d_allocator_p);
+    bsl::vector<AsyncFileObserver_Record> batch(d_allocator_p);
+    bsl::vector<const Record *>           records(d_allocator_p);
+
+    batch.reserve(k_MAX_BATCH_SIZE);
+    records.reserve(k_MAX_BATCH_SIZE);
+
+    AsyncFileObserver_Record asyncRecord;
+
+    while (!d_shuttingDownFlag) {
+        // Once asked to stop, make a final pass publishing (only) the records
+        // that are on each queue when the queue is visited, so that the
+        // thread stops even if records are published continuously.
+
+        const bool isFinalPass = d_stoppingFlag;
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_threadQueuesMutex);
+            queues.assign(d_threadQueues.begin(), d_threadQueues.end());
+        }
+
+        int numPublished = 0;
+
+        for (bsl::size_t i = 0; i < queues.size() && !d_shuttingDownFlag;
+                                                                         ++i) {
+            AsyncFileObserver_ThreadQueue *queue = queues[i];
+
+            // Determine whether the queue is abandoned *before* draining it,
+            // so that every record published before the thread exited is
+            // written before the queue is reclaimed.
+
+            const bool isAbandoned = !queue->isShared();
+
+            bsl::size_t remaining = isFinalPass
+                                  ? queue->queue().numElements()
+                                  : static_cast<bsl::size_t>(-1);
+            bool        isEmpty   = false;
+
+            while (!isEmpty && 0 < remaining && !d_shuttingDownFlag) {
+                while (batch.size() < k_MAX_BATCH_SIZE && 0 < remaining) {
+                    if (0 != queue->queue().tryPopFront(&asyncRecord)) {
+                        isEmpty = true;
+                        break;
+                    }
+                    --remaining;
+                    batch.push_back(bslmf::MovableRefUtil::move(asyncRecord));
+                    records.push_back(batch.back().d_record.get());
+                }
+
+                if (batch.empty()) {
+                    break;
+                }
+
+                d_fileObserver.publishBatch(records.data(),
+                                            static_cast<int>(records.size()));
+
+                const bsls::Types::Int64 now = bsls::TimeUtil::getTimer();
+                for (bsl::size_t j = 0; j < batch.size(); ++j) {
+                    recordPublishLatency(batch[j].d_enqueueTime, now);
+                }
+
+                numPublished += static_cast<int>(batch.size());
+                batch.clear();
+                records.clear();
+            }
+
+            if (isAbandoned && queue->queue().isEmpty()) {
+                {
+                    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadQueuesMutex);
+                    d_threadQueues.erase(bsl::find(d_threadQueues.begin(),
+                                                   d_threadQueues.end(),
+                                                   queue));
+                }
+                AsyncFileObserver_ThreadQueue::release(queue);
+            }
+        }
+
+        // Publish the count of dropped records once all of the queues have
+        // been drained, when a sufficient number of records have been
+        // dropped, or when the observer is stopping or shutting down, so the
+        // information is not lost.
+
+        if (0 < d_dropCount.loadRelaxed()) {
+            if (0 == numPublished
+            ||  d_dropCount.loadRelaxed() >= k_FORCE_WARN_THRESHOLD
+            ||  isFinalPass
+            ||  d_shuttingDownFlag) {
+                logDroppedMessageWarning(d_dropCount.swap(0));
+            }
+        }
+
+        if (isFinalPass) {
+            break;
+        }
+
+        if (0 == numPublished) {
+            // Announce that this thread is idle *before* checking the queues
+            // (including those registered since this pass began) for the last
+            // time (see implementation notes).
+
+            d_idleFlag = true;
+
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_threadQueuesMutex);
+                queues.assign(d_threadQueues.begin(), d_threadQueues.end());
+            }
+
+            bool isIdle = !d_stoppingFlag && !d_shuttingDownFlag;
+            for (bsl::size_t i = 0; isIdle && i < queues.size(); ++i) {
+                isIdle = queues[i]->queue().isEmpty();
+            }
+
+            if (isIdle) {
+                d_idleSemaphore.wait();
+            }
+            d_idleFlag = false;
+        }
+    }
+}
+
+void AsyncFileObserver::recordPublishLatency(bsls::Types::Int64 enqueueTime,
+                                             bsls::Types::Int64 now)
+{
+    d_latencyCounts[latencyBucket(now - enqueueTime)].addRelaxed(1);
+}
+
 int AsyncFileObserver::startThread()
 {
     if (bslmt::ThreadUtil::invalidHandle() == d_threadHandle) {
@@ -133,6 +621,17 @@ int AsyncFileObserver::startThread()
 
 int AsyncFileObserver::stopThread()
 {
+    if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle
+     && e_PER_THREAD_QUEUES == d_queueBackend) {
+        d_stoppingFlag = true;
+        d_idleSemaphore.post();
+
+        int ret = bslmt::ThreadUtil::join(d_threadHandle);
+        d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+        d_stoppingFlag = false;
+        return ret;                                                   // RETURN
+    }
+
     if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
         // Push an empty record with 'e_END' set in context.
 
@@ -167,6 +666,7 @@ int AsyncFileObserver::shutdownThread()
     // 'stopThread'.
 
     d_recordQueue.removeAll();
+    clearThreadQueues();
     d_shuttingDownFlag = 0;
     return ret;
 }
@@ -176,11 +676,17 @@ void AsyncFileObserver::construct()
     d_threadHandle     = bslmt::ThreadUtil::invalidHandle();
     d_shuttingDownFlag = 0;
     d_dropCount        = 0;
+    d_id               = bsls::AtomicOperations::addUint64NvAcqRel(
+                                                         &s_lastObserverId, 1);
 
     d_publishThreadEntryPoint = bsl::function<void()>(
             bsl::allocator_arg_t(),
             bsl::allocator<bsl::function<void()> >(d_allocator_p),
-            bdlf::MemFnUtil::memFn(&AsyncFileObserver::publishThreadEntryPoint,
+            e_PER_THREAD_QUEUES == d_queueBackend
+            ? bdlf::MemFnUtil::memFn(&AsyncFileObserver::publishThreadQueues,
+                                     this)
+            : bdlf::MemFnUtil::memFn(
+                                   &AsyncFileObserver::publishThreadEntryPoint,
                                    this));
     d_droppedRecordWarning.fixedFields().setFileName(__FILE__);
     d_droppedRecordWarning.fixedFields().setCategory(k_LOG_CATEGORY);
@@ -196,6 +702,13 @@ AsyncFileObserver::AsyncFileObserver(bslma::Allocator *basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_queueBackend(e_FIXED_QUEUE)
+, d_threadQueueCapacity(0)
+, d_threadQueues(basicAllocator)
+, d_stoppingFlag(false)
+, d_idleFlag(false)
+, d_idleSemaphore()
+, d_numDropped(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -208,6 +721,13 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_queueBackend(e_FIXED_QUEUE)
+, d_threadQueueCapacity(0)
+, d_threadQueues(basicAllocator)
+, d_stoppingFlag(false)
+, d_idleFlag(false)
+, d_idleSemaphore()
+, d_numDropped(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -221,6 +741,13 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_queueBackend(e_FIXED_QUEUE)
+, d_threadQueueCapacity(0)
+, d_threadQueues(basicAllocator)
+, d_stoppingFlag(false)
+, d_idleFlag(false)
+, d_idleSemaphore()
+, d_numDropped(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -235,6 +762,13 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
+, d_queueBackend(e_FIXED_QUEUE)
+, d_threadQueueCapacity(0)
+, d_threadQueues(basicAllocator)
+, d_stoppingFlag(false)
+, d_idleFlag(false)
+, d_idleSemaphore()
+, d_numDropped(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -251,14 +785,84 @@ AsyncFileObserver::AsyncFileObserver(
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
 , d_droppedRecordWarning(basicAllocator)
+, d_queueBackend(e_FIXED_QUEUE)
+, d_threadQueueCapacity(0)
+, d_threadQueues(basicAllocator)
+, d_stoppingFlag(false)
+, d_idleFlag(false)
+, d_idleSemaphore()
+, d_numDropped(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
 }
 
+AsyncFileObserver::AsyncFileObserver(
+                             Severity::Level   stdoutThreshold,
+                             bool              publishInLocalTime,
+                             int               maxRecordQueueSize,
+                             Severity::Level   dropRecordsOnFullQueueThreshold,
+                             QueueBackend      queueBackend,
+                             bslma::Allocator *basicAllocator)
+: d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
+, d_recordQueue(e_PER_THREAD_QUEUES == queueBackend ? 1 : maxRecordQueueSize,
+                basicAllocator)
+, d_shuttingDownFlag(0)
+, d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
+, d_droppedRecordWarning(basicAllocator)
+, d_queueBackend(queueBackend)
+, d_threadQueueCapacity(maxRecordQueueSize)
+, d_threadQueues(basicAllocator)
+, d_stoppingFlag(false)
+, d_idleFlag(false)
+, d_idleSemaphore()
+, d_numDropped(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < maxRecordQueueSize);
+
+    construct();
+}
+
 AsyncFileObserver::~AsyncFileObserver()
 {
     stopPublicationThread();
+
+    if (e_PER_THREAD_QUEUES != d_queueBackend) {
+        return;                                                       // RETURN
+    }
+
+    // Remove the queue of the calling thread (if any) from its list, so that
+    // the queue is reclaimed now rather than when the thread exits.
+
+    const bslmt::ThreadUtil::Key& key = threadQueuesKey();
+
+    AsyncFileObserver_ThreadQueue *prev  = 0;
+    AsyncFileObserver_ThreadQueue *queue =
+                                 static_cast<AsyncFileObserver_ThreadQueue *>(
+                                          bslmt::ThreadUtil::getSpecific(key));
+    while (queue && d_id != queue->observerId()) {
+        prev  = queue;
+        queue = queue->next();
+    }
+    if (queue) {
+        if (prev) {
+            prev->setNext(queue->next());
+        }
+        else {
+            bslmt::ThreadUtil::setSpecific(key, queue->next());
+        }
+        AsyncFileObserver_ThreadQueue::release(queue);
+    }
+
+    // Release the records remaining on the queues (published after the
+    // publication thread was stopped), and the references of this observer.
+
+    clearThreadQueues();
+
+    for (bsl::size_t i = 0; i < d_threadQueues.size(); ++i) {
+        AsyncFileObserver_ThreadQueue::release(d_threadQueues[i]);
+    }
 }
 
 // MANIPULATORS
@@ -269,12 +873,37 @@ void AsyncFileObserver::publish(const bsl::shared_ptr<const Record>& record,
 
     AsyncFileObserver_Record asyncRecord;
 
-    asyncRecord.d_record  = record;
-    asyncRecord.d_context = context;
+    asyncRecord.d_record      = record;
+    asyncRecord.d_context     = context;
+    asyncRecord.d_enqueueTime = bsls::TimeUtil::getTimer();
+
+    const bool mayDrop = record->fixedFields().severity()
+                                           > d_dropRecordsOnFullQueueThreshold;
 
-    if (record->fixedFields().severity() > d_dropRecordsOnFullQueueThreshold) {
+    if (e_PER_THREAD_QUEUES == d_queueBackend) {
+        AsyncFileObserver_ThreadQueue *queue = acquireThreadQueue();
+
+        if (mayDrop) {
+            if (0 != queue->queue().tryPushBack(
+                               bslmf::MovableRefUtil::move(asyncRecord))) {
+                d_dropCount.addRelaxed(1);
+                d_numDropped.addRelaxed(1);
+            }
+        }
+        else {
+            queue->queue().pushBack(bslmf::MovableRefUtil::move(asyncRecord));
+        }
+
+        if (d_idleFlag && d_idleFlag.testAndSwap(true, false)) {
+            d_idleSemaphore.post();
+        }
+        return;                                                       // RETURN
+    }
+
+    if (mayDrop) {
         if (0 != d_recordQueue.tryPushBack(asyncRecord)) {
             d_dropCount.addRelaxed(1);
+            d_numDropped.addRelaxed(1);
         }
     }
     else {
@@ -291,6 +920,16 @@ void AsyncFileObserver::releaseRecords()
     }
     else {
         d_recordQueue.removeAll();
+        clearThreadQueues();
+    }
+}
+
+void AsyncFileObserver::resetStatistics()
+{
+    d_numDropped.storeRelaxed(0);
+
+    for (int i = 0; i < k_NUM_LATENCY_BUCKETS; ++i) {
+        d_latencyCounts[i].storeRelaxed(0);
     }
 }
 
@@ -312,6 +951,69 @@ int AsyncFileObserver::stopPublicationThread()
     return stopThread();
 }
 
+// ACCESSORS
+bsls::Types::Uint64 AsyncFileObserver::numPublishedRecords() const
+{
+    bsls::Types::Uint64 result = 0;
+
+    for (int i = 0; i < k_NUM_LATENCY_BUCKETS; ++i) {
+        result += d_latencyCounts[i].loadRelaxed();
+    }
+    return result;
+}
+
+bsls::Types::Int64 AsyncFileObserver::publishLatency(double percentile) const
+{
+    BSLS_ASSERT(0.0 <= percentile);
+    BSLS_ASSERT(percentile <= 1.0);
+
+    bsls::Types::Uint64 counts[k_NUM_LATENCY_BUCKETS];
+    bsls::Types::Uint64 total = 0;
+
+    for (int i = 0; i < k_NUM_LATENCY_BUCKETS; ++i) {
+        counts[i]  = d_latencyCounts[i].loadRelaxed();
+        total     += counts[i];
+    }
+
+    if (0 == total) {
+        return 0;                                                     // RETURN
+    }
+
+    // Find the first bucket at which the cumulative count reaches the
+    // requested rank (at least 1).
+
+    const double        exactRank = percentile * static_cast<double>(total);
+    bsls::Types::Uint64 rank      = static_cast<bsls::Types::Uint64>(
+                                                                    exactRank);
+    if (static_cast<double>(rank) < exactRank || 0 == rank) {
+        ++rank;
+    }
+
+    bsls::Types::Uint64 cumulative = 0;
+    for (int i = 0; i < k_NUM_LATENCY_BUCKETS; ++i) {
+        cumulative += counts[i];
+        if (cumulative >= rank) {
+            return latencyBucketUpperBound(i);                        // RETURN
+        }
+    }
+    return latencyBucketUpperBound(k_NUM_LATENCY_BUCKETS - 1);
+}
+
+int AsyncFileObserver::recordQueueLength() const
+{
+    if (e_PER_THREAD_QUEUES != d_queueBackend) {
+        return d_recordQueue.length();                                // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadQueuesMutex);
+
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_threadQueues.size(); ++i) {
+        result += d_threadQueues[i]->queue().numElements();
+    }
+    return static_cast<int>(result);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -45,6 +45,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableStdoutLoggingPrefix
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              resetStatistics
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setLogFormat
@@ -58,6 +59,10 @@ BSLS_IDENT("$Id: $")
 //                         |              isPublicationThreadRunning
 //                         |              isPublishInLocalTimeEnabled
 //                         |              isStdoutLoggingPrefixEnabled
+//                         |              numDroppedRecords
+//                         |              numPublishedRecords
+//                         |              publishLatency
+//                         |              queueBackend
 //                         |              recordQueueLength
 //                         |              rotationLifetime
 //                         |              rotationSize
@@ -96,6 +101,7 @@ BSLS_IDENT("$Id: $")
 // +-----------------------+---------------------------------+
 // | Log Record Queue      | maxRecordQueueSize              |
 // |                       | dropRecordsOnFullQueueThreshold |
+// |                       | queueBackend                    |
 // +-----------------------+---------------------------------+
 //
 // +-------------+-----------------------------+------------------------------+
@@ -125,6 +131,10 @@ BSLS_IDENT("$Id: $")
 // | Thread      | stopPublicationThread       |                              |
 // | Management  | shutdownPublicationThread   |                              |
 // +-------------+-----------------------------+------------------------------+
+// | Statistics  | resetStatistics             | numDroppedRecords            |
+// |             |                             | numPublishedRecords          |
+// |             |                             | publishLatency               |
+// +-------------+-----------------------------+------------------------------+
 //..
 // In general, a 'ball::AsyncFileObserver' object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -162,7 +172,57 @@ BSLS_IDENT("$Id: $")
 // periodically publishing a warning (i.e., an internally generated log record
 // with severity 'e_WARN') that reports the number of dropped records.  The
 // record count is reset to 0 after each such warning is published, so each
-// dropped record is counted only once.
+// dropped record is counted only once.  The total number of records dropped
+// since construction (or since the most recent call to 'resetStatistics') is
+// also available from the 'numDroppedRecords' accessor.
+//
+///Record Queue Backends
+///- - - - - - - - - - -
+// By default, the log record queue is a single 'bdlcc::FixedQueue' shared by
+// all threads calling 'publish' ('e_FIXED_QUEUE').  Alternatively,
+// 'e_PER_THREAD_QUEUES' may be supplied for the 'queueBackend' constructor
+// argument, in which case each thread that calls 'publish' is given its own
+// single-producer, single-consumer queue (having a capacity of
+// 'maxRecordQueueSize' records), and the publication thread drains all of
+// these queues.  Enqueuing a record then involves no contention between
+// publishing threads, and the publication thread writes the records that it
+// removes from the queues in batches, flushing the log file (and 'stdout')
+// once per batch rather than once per record (see
+// 'FileObserver::publishBatch').  The trade-offs of 'e_PER_THREAD_QUEUES'
+// are:
+//
+//: o Records published by a single thread are written in the order in which
+//:   they were published, but records published by different threads may be
+//:   written in a different order than that in which they were published.
+//:
+//: o The memory used by the queues is proportional to the number of threads
+//:   that publish records.  The queues are supplied by the global allocator
+//:   (not by the allocator of the observer), since a thread may exit after
+//:   the observer is destroyed.  The queue of a thread that exits while the
+//:   observer exists is reclaimed by the publication thread (the next time it
+//:   visits the queues); otherwise, the queue is reclaimed when the observer
+//:   is destroyed, or, if the thread is still running then, when the thread
+//:   exits.
+//:
+//: o An idle publication thread blocks until a record is published to any of
+//:   the queues.  Consequently, a thread that publishes a record while the
+//:   publication thread is idle wakes the publication thread.
+//
+// The drop policy (see 'dropRecordsOnFullQueueThreshold' above) applies to
+// each per-thread queue individually, and 'recordQueueLength' returns the
+// total number of records on all of the queues.
+//
+///Publication Statistics
+///- - - - - - - - - - -
+// An async file observer records, for each record written by the publication
+// thread, the *publish latency* of the record: the time elapsed from the call
+// to 'publish' that received the record until the record has been written.
+// The 'publishLatency' accessor returns an upper bound on a given percentile
+// of the latencies recorded (e.g., 'publishLatency(0.99)' returns the "p99"
+// latency), accurate to within 12.5%, and 'numPublishedRecords' returns the
+// number of latencies recorded.  Together with 'numDroppedRecords', these
+// statistics are cumulative since construction, or since the most recent call
+// to 'resetStatistics'.
 //
 ///Log Record Formatting
 ///---------------------
@@ -480,17 +540,23 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
 #include <bslmt_threadutil.h>
 
 #include <bsls_atomic.h>
+#include <bsls_types.h>
 
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace ball {
 
+class AsyncFileObserver_ThreadQueue;
+
                           // ===============================
                           // struct AsyncFileObserver_Record
                           // ===============================
@@ -500,8 +566,11 @@ struct AsyncFileObserver_Record {
     // only.  This 'struct' holds a log record and its associated context.
 
     // PUBLIC DATA
-    bsl::shared_ptr<const Record> d_record;   // log record
-    Context                       d_context;  // context of log record
+    bsl::shared_ptr<const Record> d_record;       // log record
+    Context                       d_context;      // context of log record
+    bsls::Types::Int64            d_enqueueTime;  // time at which the record
+                                                  // was received, as returned
+                                                  // by 'bsls::TimeUtil'
 };
 
                           // =======================
@@ -515,6 +584,29 @@ class AsyncFileObserver : public Observer {
     // can operate on an object concurrently.  This class is exception-neutral
     // with no guarantee of rollback.  In no event is memory leaked.
 
+  public:
+    // TYPES
+    enum QueueBackend {
+        // Enumeration of the implementations of the log record queue (see
+        // {Record Queue Backends}).
+
+        e_FIXED_QUEUE,       // a single fixed-size queue shared by all
+                             // publishing threads (default)
+
+        e_PER_THREAD_QUEUES  // a fixed-size, single-producer queue for each
+                             // publishing thread
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::vector<AsyncFileObserver_ThreadQueue *> ThreadQueues;
+
+    enum {
+        k_NUM_LATENCY_BUCKETS = 488  // number of buckets of the publish
+                                     // latency histogram; see
+                                     // 'recordPublishLatency'
+    };
+
     // DATA
     FileObserver                   d_fileObserver;   // forward most public
                                                      // method calls to this
@@ -557,6 +649,51 @@ class AsyncFileObserver : public Observer {
 
     mutable bslmt::Mutex           d_mutex;          // serialize operations
 
+    QueueBackend                   d_queueBackend;   // implementation of the
+                                                     // record queue
+
+    bsl::size_t                    d_threadQueueCapacity;
+                                                     // capacity of each queue
+                                                     // in 'd_threadQueues'
+
+    bsls::Types::Uint64            d_id;             // unique identifier of
+                                                     // this observer, used to
+                                                     // find the queue of the
+                                                     // calling thread
+
+    ThreadQueues                   d_threadQueues;   // queues of publishing
+                                                     // threads (each holding a
+                                                     // reference) when
+                                                     // 'e_PER_THREAD_QUEUES'
+
+    mutable bslmt::Mutex           d_threadQueuesMutex;
+                                                     // serialize access to
+                                                     // 'd_threadQueues'
+
+    bsls::AtomicBool               d_stoppingFlag;   // flag that indicates the
+                                                     // publication thread is
+                                                     // to stop once the queues
+                                                     // are empty (used only
+                                                     // with per-thread queues)
+
+    bsls::AtomicBool               d_idleFlag;       // flag that indicates the
+                                                     // publication thread
+                                                     // found the queues empty
+                                                     // and waits (or is about
+                                                     // to wait) on
+                                                     // 'd_idleSemaphore'
+
+    bslmt::Semaphore               d_idleSemaphore;  // posted to wake an idle
+                                                     // publication thread
+
+    bsls::AtomicUint64             d_numDropped;     // number of dropped
+                                                     // records since the
+                                                     // statistics were reset
+
+    bsls::AtomicUint64             d_latencyCounts[k_NUM_LATENCY_BUCKETS];
+                                                     // histogram of publish
+                                                     // latencies
+
     bslma::Allocator              *d_allocator_p;    // memory allocator (held,
                                                      // not owned)
 
@@ -571,6 +708,17 @@ class AsyncFileObserver : public Observer {
         // constructor overloads.  Note that this method should be removed when
         // C++11 constructor chaining is available on all supported platforms.
 
+    AsyncFileObserver_ThreadQueue *acquireThreadQueue();
+        // Return the queue of the calling thread, creating and registering it
+        // with this observer if the calling thread has not yet published a
+        // record to this observer.  The behavior is undefined unless
+        // 'e_PER_THREAD_QUEUES == d_queueBackend'.
+
+    void clearThreadQueues();
+        // Discard all records on the queues in 'd_threadQueues'.  The
+        // behavior is undefined unless no publication thread is running and
+        // the calling thread holds a lock on 'd_mutex'.
+
     void logDroppedMessageWarning(int numDropped);
         // Synchronously log a record to the underlying file observer
         // indicating that the specified 'numDropped' number of records have
@@ -585,6 +733,22 @@ class AsyncFileObserver : public Observer {
         // thread-safe.  Note that this function is the entry point for the
         // publication thread.
 
+    void publishThreadQueues();
+        // Publish records from the per-thread queues, in batches, to the log
+        // file and 'stdout', until signaled to stop, and reclaim the queues
+        // of threads that have exited, blocking on 'd_idleSemaphore' while
+        // all of the queues are empty.  The behavior is undefined if this
+        // method is invoked concurrently from multiple threads.  Note that
+        // this function is the entry point for the publication thread when
+        // 'e_PER_THREAD_QUEUES == d_queueBackend'.
+
+    void recordPublishLatency(bsls::Types::Int64 enqueueTime,
+                              bsls::Types::Int64 now);
+        // Add to the publish latency histogram of this observer the latency
+        // of a record received by 'publish' at the specified 'enqueueTime' and
+        // written at the specified 'now'.  The behavior is undefined if this
+        // method is invoked concurrently from multiple threads.
+
     int shutdownThread();
         // Stop the publication thread and discard all currently queued log
         // records.  Return 0 on success, and a non-zero value if there is an
@@ -674,6 +838,12 @@ class AsyncFileObserver : public Observer {
                       int               maxRecordQueueSize,
                       Severity::Level   dropRecordsOnFullQueueThreshold,
                       bslma::Allocator *basicAllocator = 0);
+    AsyncFileObserver(Severity::Level   stdoutThreshold,
+                      bool              publishInLocalTime,
+                      int               maxRecordQueueSize,
+                      Severity::Level   dropRecordsOnFullQueueThreshold,
+                      QueueBackend      queueBackend,
+                      bslma::Allocator *basicAllocator = 0);
         // Create an async file observer that asynchronously publishes log
         // records to 'stdout' if their severity is at least as severe as the
         // specified 'stdoutThreshold' level, and has file logging initially
@@ -689,11 +859,18 @@ class AsyncFileObserver : public Observer {
         // this threshold will block the calling thread if the queue is full,
         // until space is available.  If 'dropRecordsOnFullQueueThreshold' is
         // not specified, all records received while the queue is full are
-        // discarded.  (See {Log Record Queue} for further information.)
-        // Optionally specify a 'basicAllocator' used to supply memory.  If
-        // 'basicAllocator' is 0, the currently installed default allocator is
-        // used.  Note that independent default record formats are in effect
-        // for 'stdout' and file logging (see 'setLogFormat').
+        // discarded.  Optionally specify a 'queueBackend' indicating the
+        // implementation of the queue; if 'queueBackend' is
+        // 'e_PER_THREAD_QUEUES', each publishing thread has a queue of its own
+        // having the specified 'maxRecordQueueSize'.  If 'queueBackend' is not
+        // specified, 'e_FIXED_QUEUE' is used.  (See {Log Record Queue} for
+        // further information.)  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  Note that the per-thread queues, which
+        // may outlive this object, are supplied by the global allocator (see
+        // 'bslma::Default::globalAllocator').  Also note that independent
+        // default record formats are in effect for 'stdout' and file logging
+        // (see 'setLogFormat').
 
     ~AsyncFileObserver();
         // Publish all records that were on the record queue upon entry if a
@@ -820,6 +997,12 @@ class AsyncFileObserver : public Observer {
         // previously provided shared pointers must be released.  Also note
         // that all currently queued records are discarded.
 
+    void resetStatistics();
+        // Reset the count of dropped records and the publish latency
+        // histogram of this async file observer (see {Publication
+        // Statistics}).  Note that records published concurrently with a call
+        // to this method may or may not be reflected in the statistics.
+
     void rotateOnSize(int size);
         // Set this async file observer to perform log file rotation when the
         // size of the file exceeds the specified 'size' (in kilobytes).  This
@@ -955,9 +1138,36 @@ class AsyncFileObserver : public Observer {
         // !DEPRECATED!: Use 'bdlt::LocalTimeOffset' instead.
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
+    bsls::Types::Uint64 numDroppedRecords() const;
+        // Return the number of records that have been dropped by this async
+        // file observer, because its record queue was full, since
+        // construction or the most recent call to 'resetStatistics'.
+
+    bsls::Types::Uint64 numPublishedRecords() const;
+        // Return the number of records that have been written by the
+        // publication thread of this async file observer since construction or
+        // the most recent call to 'resetStatistics'.
+
+    bsls::Types::Int64 publishLatency(double percentile) const;
+        // Return an upper bound, in nanoseconds, on the specified 'percentile'
+        // of the publish latencies of the records written by the publication
+        // thread of this async file observer since construction or the most
+        // recent call to 'resetStatistics', or 0 if no records have been
+        // written.  The publish latency of a record is the time from its
+        // receipt by 'publish' until it has been written to the log file and
+        // 'stdout'.  The returned value exceeds the exact percentile by at
+        // most 12.5%.  The behavior is undefined unless
+        // '0.0 <= percentile <= 1.0'.  Note that, e.g., 'publishLatency(0.99)'
+        // returns the 99th-percentile ("p99") publish latency.
+
+    QueueBackend queueBackend() const;
+        // Return the implementation of the record queue of this async file
+        // observer.
+
     int recordQueueLength() const;
-        // Return the number of log records currently on the record queue of
-        // this async file observer.
+        // Return the number of log records currently on the record queue (or,
+        // if 'queueBackend' is 'e_PER_THREAD_QUEUES', on all of the record
+        // queues) of this async file observer.
 
     bdlt::DatetimeInterval rotationLifetime() const;
         // Return the log file lifetime that will trigger a file rotation by
@@ -1133,9 +1343,15 @@ bdlt::DatetimeInterval AsyncFileObserver::localTimeOffset() const
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
 inline
-int AsyncFileObserver::recordQueueLength() const
+bsls::Types::Uint64 AsyncFileObserver::numDroppedRecords() const
+{
+    return d_numDropped.loadRelaxed();
+}
+
+inline
+AsyncFileObserver::QueueBackend AsyncFileObserver::queueBackend() const
 {
-    return d_recordQueue.length();
+    return d_queueBackend;
 }
 
 inline
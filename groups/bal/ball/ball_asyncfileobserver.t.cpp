@@ -19,15 +19,20 @@
 
 #include <bslim_testutil.h>
 
+#include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_semaphore.h>
+
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
@@ -39,6 +44,7 @@
 #include <bsl_iomanip.h>     // 'setfill'
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>    // 'unsetenv'
 
@@ -84,6 +90,7 @@ using bsl::flush;
 // [ X] AsyncFileObserver(ball::Severity::Level, bool, bslma::Allocator *);
 // [ 5] AsyncFileObserver(Severity::Level, bool, int, bslma::Allocator *);
 // [ 5] AsyncFileObserver(Severity, bool, int, Severity, Allocator *);
+// [12] AsyncFileObserver(Severity, bool, int, Severity, QueueBackend, *);
 // [ 2] ~AsyncFileObserver();
 //
 // MANIPULATORS
@@ -99,6 +106,7 @@ using bsl::flush;
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
 // [ 4] void releaseRecords();
+// [13] void resetStatistics();
 // [ 6] void forceRotation();
 // [ 6] void rotateOnSize(int size);
 // [ 6] void rotateOnTimeInterval(const DatetimeInterval timeInterval);
@@ -118,6 +126,10 @@ using bsl::flush;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 1] bool isStdoutLoggingPrefixEnabled() const;
 // [ 1] bool isUserFieldsLoggingEnabled() const;
+// [13] Uint64 numDroppedRecords() const;
+// [13] Uint64 numPublishedRecords() const;
+// [13] Int64 publishLatency(double percentile) const;
+// [12] QueueBackend queueBackend() const;
 // [11] int recordQueueLength() const;
 // [ 6] bdlt::DatetimeInterval rotationLifetime() const;
 // [ 6] int rotationSize() const;
@@ -128,7 +140,9 @@ using bsl::flush;
 // [ 7] CONCERN: LOGGING TO A FAILING STREAM
 // [ 5] CONCERN: LOG MESSAGE DROP
 // [ 9] CONCERN: ROTATION
-// [12] USAGE EXAMPLE
+// [12] CONCERN: PER-THREAD QUEUES
+// [14] USAGE EXAMPLE
+// [-1] PERFORMANCE: QUEUE BACKENDS
 
 // Note assert and debug macros all output to 'cerr' instead of cout, unlike
 // most other test drivers.  This is necessary because test case 2 plays tricks
@@ -603,6 +617,109 @@ extern "C" void *workerThread2(void *arg)
     return 0;
 }
 
+struct PublishArgs {
+    // This 'struct' holds the arguments of 'publishThread'.
+
+    ball::AsyncFileObserver *d_observer_p;    // observer to publish to
+    int                      d_numRecords;    // number of records to publish
+    bsls::Types::Int64       d_elapsedTime;   // time spent publishing (set by
+                                              // 'publishThread')
+};
+
+extern "C" void *publishThread(void *arg)
+    // Publish 'd_numRecords' records to 'd_observer_p' of the 'PublishArgs'
+    // object at the specified 'arg' address, directly (i.e., not through the
+    // logger manager), and load the time taken into 'd_elapsedTime'.
+{
+    PublishArgs *args = static_cast<PublishArgs *>(arg);
+
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace(0);
+    record->fixedFields().setSeverity(ball::Severity::e_INFO);
+    record->fixedFields().setCategory("ball::AsyncFileObserverTest");
+    record->fixedFields().setFileName(__FILE__);
+    record->fixedFields().setLineNumber(__LINE__);
+    record->fixedFields().setThreadID(bslmt::ThreadUtil::selfIdAsUint64());
+    record->fixedFields().setMessage(
+                                  "ball::AsyncFileObserver Concurrency Test.");
+
+    ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+    for (int i = 0; i < args->d_numRecords; ++i) {
+        args->d_observer_p->publish(record, context);
+    }
+
+    args->d_elapsedTime = bsls::TimeUtil::getTimer() - start;
+    return 0;
+}
+
+void publishInParallel(ball::AsyncFileObserver *observer,
+                       int                      numThreads,
+                       int                      numRecords,
+                       bsls::Types::Int64      *maxElapsedTime = 0)
+    // Create the specified 'numThreads', each publishing the specified
+    // 'numRecords' records to the specified 'observer', and wait for the
+    // threads to complete.  Optionally specify 'maxElapsedTime' to be loaded
+    // with the longest time (in nanoseconds) taken by a thread to publish its
+    // records.
+{
+    bsl::vector<bslmt::ThreadUtil::Handle> threads(numThreads);
+    bsl::vector<PublishArgs>               args(numThreads);
+
+    for (int i = 0; i < numThreads; ++i) {
+        args[i].d_observer_p  = observer;
+        args[i].d_numRecords  = numRecords;
+        args[i].d_elapsedTime = 0;
+
+        ASSERT(0 == bslmt::ThreadUtil::create(&threads[i],
+                                              publishThread,
+                                              &args[i]));
+    }
+
+    bsls::Types::Int64 maxTime = 0;
+    for (int i = 0; i < numThreads; ++i) {
+        ASSERT(0 == bslmt::ThreadUtil::join(threads[i]));
+        if (args[i].d_elapsedTime > maxTime) {
+            maxTime = args[i].d_elapsedTime;
+        }
+    }
+
+    if (maxElapsedTime) {
+        *maxElapsedTime = maxTime;
+    }
+}
+
+struct OutlivingPublisherArgs {
+    // This 'struct' holds the arguments of 'outlivingPublisherThread'.
+
+    ball::AsyncFileObserver *d_observer_p;    // observer to publish to
+    bslmt::Semaphore         d_published;     // posted once published
+    bslmt::Semaphore         d_destroyed;     // posted once 'd_observer_p'
+                                              // is destroyed
+};
+
+extern "C" void *outlivingPublisherThread(void *arg)
+    // Publish a record to 'd_observer_p' of the 'OutlivingPublisherArgs'
+    // object at the specified 'arg' address, post 'd_published', and return
+    // once 'd_destroyed' has been posted.
+{
+    OutlivingPublisherArgs *args = static_cast<OutlivingPublisherArgs *>(arg);
+
+    {
+        bsl::shared_ptr<ball::Record> record;
+        record.createInplace(0);
+        record->fixedFields().setSeverity(ball::Severity::e_INFO);
+
+        args->d_observer_p->publish(record, ball::Context());
+    }
+
+    args->d_published.post();
+    args->d_destroyed.wait();
+    return 0;
+}
+
 }  // close namespace BALL_ASYNCFILEOBSERVER_TEST_CONCURRENCY
 
 //=============================================================================
@@ -623,7 +740,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 12: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -775,6 +892,517 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING PUBLICATION STATISTICS
+        //
+        // Concerns:
+        //:  1 'numPublishedRecords' counts every record written by the
+        //:    publication thread, for both queue backends.
+        //:
+        //:  2 'numDroppedRecords' counts every record dropped because the
+        //:    record queue was full, and is not reset by the periodic dropped
+        //:    record warning.
+        //:
+        //:  3 'publishLatency' returns 0 if no records were written, is
+        //:    non-decreasing in its argument, and is bounded by the elapsed
+        //:    time.
+        //:
+        //:  4 'resetStatistics' resets all of the statistics.
+        //:
+        //:  5 The statistics are 0 following construction.
+        //
+        // Plan:
+        //:  1 For each queue backend, verify the statistics of a new observer.
+        //:    (C-5)
+        //:
+        //:  2 Publish a number of records without a publication thread, such
+        //:    that some are dropped, and verify 'numDroppedRecords'.  (C-2)
+        //:
+        //:  3 Start and stop the publication thread and verify
+        //:    'numPublishedRecords' and the values of 'publishLatency' for a
+        //:    range of percentiles.  (C-1, 3)
+        //:
+        //:  4 Call 'resetStatistics' and verify all statistics are 0.  (C-4)
+        //
+        // Testing:
+        //   void resetStatistics();
+        //   Uint64 numDroppedRecords() const;
+        //   Uint64 numPublishedRecords() const;
+        //   Int64 publishLatency(double percentile) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING PUBLICATION STATISTICS"
+                          << "\n==============================" << endl;
+
+        const Obj::QueueBackend BACKENDS[] = { Obj::e_FIXED_QUEUE,
+                                               Obj::e_PER_THREAD_QUEUES };
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const Obj::QueueBackend BACKEND = BACKENDS[ti];
+
+            if (veryVerbose) { T_ P(BACKEND) }
+
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            enum { k_QUEUE_SIZE = 64, k_NUM_RECORDS = 100 };
+
+            {
+                Obj        mX(ball::Severity::e_OFF,
+                              false,
+                              k_QUEUE_SIZE,
+                              ball::Severity::e_OFF,
+                              BACKEND,
+                              &ta);
+                const Obj& X = mX;
+
+                ASSERTV(BACKEND, BACKEND == X.queueBackend());
+                ASSERTV(BACKEND, 0 == X.numDroppedRecords());
+                ASSERTV(BACKEND, 0 == X.numPublishedRecords());
+                ASSERTV(BACKEND, 0 == X.publishLatency(0.5));
+                ASSERTV(BACKEND, 0 == X.publishLatency(1.0));
+
+                bsl::shared_ptr<ball::Record> record;
+                record.createInplace(&ta);
+                record->fixedFields().setSeverity(ball::Severity::e_INFO);
+                ball::Context context;
+
+                const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+                for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                    mX.publish(record, context);
+                }
+
+                ASSERTV(BACKEND, X.recordQueueLength(),
+                        k_QUEUE_SIZE == X.recordQueueLength());
+                ASSERTV(BACKEND, X.numDroppedRecords(),
+                        k_NUM_RECORDS - k_QUEUE_SIZE == X.numDroppedRecords());
+
+                mX.enableFileLogging(fileName.c_str());
+
+                ASSERT(0 == mX.startPublicationThread());
+                ASSERT(0 == mX.stopPublicationThread());
+
+                const bsls::Types::Int64 elapsed =
+                                          bsls::TimeUtil::getTimer() - start;
+
+                mX.disableFileLogging();
+
+                // Note that the dropped record warning is written to the file
+                // but is not counted.
+
+                ASSERTV(BACKEND, countLoggedRecords(fileName),
+                        k_QUEUE_SIZE + 1 == countLoggedRecords(fileName));
+
+                ASSERTV(BACKEND, X.numPublishedRecords(),
+                        k_QUEUE_SIZE == X.numPublishedRecords());
+                ASSERTV(BACKEND, X.numDroppedRecords(),
+                        k_NUM_RECORDS - k_QUEUE_SIZE == X.numDroppedRecords());
+
+                const double PERCENTILES[] = { 0.0, 0.1, 0.5, 0.9, 0.99, 1.0 };
+
+                bsls::Types::Int64 prev = 0;
+                for (int i = 0; i < 6; ++i) {
+                    const double             PERCENTILE = PERCENTILES[i];
+                    const bsls::Types::Int64 latency    =
+                                                  X.publishLatency(PERCENTILE);
+
+                    if (veryVeryVerbose) {
+                        T_ T_ P_(PERCENTILE) P(latency)
+                    }
+
+                    ASSERTV(BACKEND, i, latency, 0 < latency);
+                    ASSERTV(BACKEND, i, prev, latency, prev <= latency);
+                    ASSERTV(BACKEND, i, elapsed, latency,
+                            latency <= elapsed + elapsed / 8);
+                    prev = latency;
+                }
+
+                mX.resetStatistics();
+
+                ASSERTV(BACKEND, 0 == X.numDroppedRecords());
+                ASSERTV(BACKEND, 0 == X.numPublishedRecords());
+                ASSERTV(BACKEND, 0 == X.publishLatency(0.99));
+            }
+            ASSERTV(BACKEND, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING PER-THREAD QUEUES
+        //
+        // Concerns:
+        //:  1 An observer created with 'e_PER_THREAD_QUEUES' reports that
+        //:    backend, and an observer created with any other constructor
+        //:    reports 'e_FIXED_QUEUE'.
+        //:
+        //:  2 Records published by any number of threads are all written.
+        //:
+        //:  3 'recordQueueLength' reports the total number of records on the
+        //:    queues of all threads.
+        //:
+        //:  4 The capacity of each queue is 'maxRecordQueueSize', and the drop
+        //:    policy applies to each queue.
+        //:
+        //:  5 'stopPublicationThread' publishes the queued records, and
+        //:    'shutdownPublicationThread' and 'releaseRecords' discard them.
+        //:
+        //:  6 A thread may publish to several observers, in any order, and
+        //:    an observer may be destroyed while a thread that published to it
+        //:    is still running.
+        //:
+        //:  7 The queues of exited threads are reclaimed, and no memory is
+        //:    leaked.
+        //:
+        //:  8 The queues are supplied by the global allocator, and the queue
+        //:    of a thread that outlives the observer is reclaimed when the
+        //:    thread exits.
+        //:
+        //:  9 A record published while the publication thread is idle is
+        //:    written without stopping the publication thread.
+        //
+        // Plan:
+        //:  1 Verify 'queueBackend' for observers created by each constructor.
+        //:    (C-1)
+        //:
+        //:  2 Publish records from several threads without a publication
+        //:    thread, verify 'recordQueueLength' and the dropped count, then
+        //:    start and stop the publication thread and verify the log file.
+        //:    (C-3..5)
+        //:
+        //:  3 Publish a large number of records from several threads, using
+        //:    a blocking drop threshold, while the publication thread runs,
+        //:    and verify that all records are written.  (C-2, 7)
+        //:
+        //:  4 From one thread, alternately publish to two observers, destroy
+        //:    one, and continue to publish to the other.  (C-6)
+        //:
+        //:  5 Use a test allocator throughout to detect leaks.  (C-7)
+        //:
+        //:  6 Install a test allocator as the global allocator.  Publish from
+        //:    a thread, destroy the observer while the thread is running, and
+        //:    verify that the memory of the queue is returned to the global
+        //:    allocator once the thread exits.  (C-8)
+        //:
+        //:  7 Start the publication thread, let it become idle, publish a
+        //:    record, and verify that the record is written while the
+        //:    publication thread is still running.  (C-9)
+        //
+        // Testing:
+        //   AsyncFileObserver(Severity, bool, int, Severity, QueueBackend, *);
+        //   QueueBackend queueBackend() const;
+        //   CONCERN: PER-THREAD QUEUES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING PER-THREAD QUEUES"
+                          << "\n=========================" << endl;
+
+        using namespace BALL_ASYNCFILEOBSERVER_TEST_CONCURRENCY;
+
+        if (veryVerbose) cout << "\tTesting 'queueBackend'." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mA(&ta);
+            Obj mB(ball::Severity::e_WARN, false, 16, ball::Severity::e_OFF,
+                   &ta);
+            Obj mC(ball::Severity::e_WARN, false, 16, ball::Severity::e_OFF,
+                   Obj::e_FIXED_QUEUE, &ta);
+            Obj mD(ball::Severity::e_WARN, false, 16, ball::Severity::e_OFF,
+                   Obj::e_PER_THREAD_QUEUES, &ta);
+
+            ASSERT(Obj::e_FIXED_QUEUE       == mA.queueBackend());
+            ASSERT(Obj::e_FIXED_QUEUE       == mB.queueBackend());
+            ASSERT(Obj::e_FIXED_QUEUE       == mC.queueBackend());
+            ASSERT(Obj::e_PER_THREAD_QUEUES == mD.queueBackend());
+        }
+
+        if (veryVerbose) cout << "\tTesting queue capacity." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            enum { k_QUEUE_SIZE = 50, k_NUM_THREADS = 4, k_NUM_RECORDS = 80 };
+
+            {
+                Obj        mX(ball::Severity::e_OFF,
+                              false,
+                              k_QUEUE_SIZE,
+                              ball::Severity::e_OFF,
+                              Obj::e_PER_THREAD_QUEUES,
+                              &ta);
+                const Obj& X = mX;
+
+                publishInParallel(&mX, k_NUM_THREADS, k_NUM_RECORDS);
+
+                ASSERTV(X.recordQueueLength(),
+                        k_NUM_THREADS * k_QUEUE_SIZE == X.recordQueueLength());
+                ASSERTV(X.numDroppedRecords(),
+                        k_NUM_THREADS * (k_NUM_RECORDS - k_QUEUE_SIZE)
+                                                    == X.numDroppedRecords());
+
+                mX.enableFileLogging(fileName.c_str());
+
+                ASSERT(0 == mX.startPublicationThread());
+                ASSERT(0 == mX.stopPublicationThread());
+                ASSERT(false == X.isPublicationThreadRunning());
+
+                ASSERTV(X.recordQueueLength(), 0 == X.recordQueueLength());
+
+                mX.disableFileLogging();
+
+                // One additional record for the dropped record warning.
+
+                ASSERTV(countLoggedRecords(fileName),
+                        k_NUM_THREADS * k_QUEUE_SIZE + 1
+                                              == countLoggedRecords(fileName));
+
+                // Records published after the publication thread has stopped
+                // are discarded by 'releaseRecords' and
+                // 'shutdownPublicationThread'.
+
+                publishInParallel(&mX, k_NUM_THREADS, 10);
+                ASSERTV(X.recordQueueLength(),
+                        k_NUM_THREADS * 10 == X.recordQueueLength());
+
+                mX.releaseRecords();
+                ASSERTV(X.recordQueueLength(), 0 == X.recordQueueLength());
+
+                publishInParallel(&mX, k_NUM_THREADS, 10);
+                ASSERT(0 == mX.startPublicationThread());
+                ASSERT(0 == mX.shutdownPublicationThread());
+                ASSERTV(X.recordQueueLength(), 0 == X.recordQueueLength());
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (veryVerbose) cout << "\tTesting concurrent publication." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            enum { k_NUM_THREADS = 6, k_NUM_RECORDS = 20000 };
+
+            {
+                Obj        mX(ball::Severity::e_OFF,
+                              false,
+                              256,
+                              ball::Severity::e_TRACE,
+                              Obj::e_PER_THREAD_QUEUES,
+                              &ta);
+                const Obj& X = mX;
+
+                mX.setLogFormat("%t %m\n", "%t %m\n");
+                mX.enableFileLogging(fileName.c_str());
+                ASSERT(0 == mX.startPublicationThread());
+
+                publishInParallel(&mX, k_NUM_THREADS, k_NUM_RECORDS);
+
+                ASSERT(0 == mX.stopPublicationThread());
+                mX.disableFileLogging();
+
+                ASSERTV(X.numDroppedRecords(), 0 == X.numDroppedRecords());
+                ASSERTV(X.numPublishedRecords(),
+                        k_NUM_THREADS * k_NUM_RECORDS
+                                                  == X.numPublishedRecords());
+
+                // Each record occupies one line with this format.
+
+                ASSERTV(countLoggedRecords(fileName),
+                        k_NUM_THREADS * k_NUM_RECORDS / 2
+                                              == countLoggedRecords(fileName));
+
+                // The publication thread reclaims the queues of the exited
+                // threads; one more (short) run lets it observe that.
+
+                ASSERT(0 == mX.startPublicationThread());
+                bslmt::ThreadUtil::microSleep(20000);
+                ASSERT(0 == mX.stopPublicationThread());
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (veryVerbose) cout << "\tTesting several observers." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileNameA(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileNameA, "testLogA");
+
+            bsl::string fileNameB(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileNameB, "testLogB");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta);
+            record->fixedFields().setSeverity(ball::Severity::e_INFO);
+            ball::Context context;
+
+            {
+                Obj mA(ball::Severity::e_OFF, false, 100,
+                       ball::Severity::e_TRACE, Obj::e_PER_THREAD_QUEUES, &ta);
+
+                mA.enableFileLogging(fileNameA.c_str());
+                ASSERT(0 == mA.startPublicationThread());
+
+                {
+                    Obj mB(ball::Severity::e_OFF, false, 100,
+                           ball::Severity::e_TRACE, Obj::e_PER_THREAD_QUEUES,
+                           &ta);
+
+                    mB.enableFileLogging(fileNameB.c_str());
+                    ASSERT(0 == mB.startPublicationThread());
+
+                    for (int i = 0; i < 50; ++i) {
+                        mA.publish(record, context);
+                        mB.publish(record, context);
+                    }
+
+                    ASSERT(0 == mB.stopPublicationThread());
+                    mB.disableFileLogging();
+
+                    ASSERTV(countLoggedRecords(fileNameB),
+                            50 == countLoggedRecords(fileNameB));
+                }
+
+                // Create an observer (likely at the same address) after the
+                // destruction of 'mB'.
+
+                Obj mC(ball::Severity::e_OFF, false, 100,
+                       ball::Severity::e_TRACE, Obj::e_PER_THREAD_QUEUES, &ta);
+                const Obj& C = mC;
+
+                for (int i = 0; i < 50; ++i) {
+                    mA.publish(record, context);
+                    mC.publish(record, context);
+                }
+
+                ASSERTV(C.recordQueueLength(), 50 == C.recordQueueLength());
+
+                ASSERT(0 == mA.stopPublicationThread());
+                mA.disableFileLogging();
+
+                ASSERTV(countLoggedRecords(fileNameA),
+                        100 == countLoggedRecords(fileNameA));
+            }
+            record.reset();
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (veryVerbose) cout << "\tTesting a thread outliving the observer."
+                              << endl;
+        {
+            bslma::TestAllocator  ga("global", veryVeryVeryVerbose);
+            bslma::Allocator     *prevGlobal =
+                                      bslma::Default::setGlobalAllocator(&ga);
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            OutlivingPublisherArgs    args;
+            bslmt::ThreadUtil::Handle handle;
+            bsls::Types::Int64        numGlobalBlocks = 0;
+            {
+                Obj mX(ball::Severity::e_OFF, false, 100,
+                       ball::Severity::e_TRACE, Obj::e_PER_THREAD_QUEUES, &ta);
+                const Obj& X = mX;
+
+                args.d_observer_p = &mX;
+
+                numGlobalBlocks = ga.numBlocksInUse();
+
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                                     &handle,
+                                                     outlivingPublisherThread,
+                                                     &args));
+                args.d_published.wait();
+
+                ASSERTV(X.recordQueueLength(), 1 == X.recordQueueLength());
+                ASSERTV(numGlobalBlocks,   ga.numBlocksInUse(),
+                        numGlobalBlocks  < ga.numBlocksInUse());
+            }
+
+            // The observer has released the record and its references; only
+            // the thread references the queue now.
+
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+            args.d_destroyed.post();
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(numGlobalBlocks,   ga.numBlocksInUse(),
+                    numGlobalBlocks == ga.numBlocksInUse());
+
+            bslma::Default::setGlobalAllocator(prevGlobal);
+        }
+
+        if (veryVerbose) cout << "\tTesting waking the publication thread."
+                              << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta);
+            record->fixedFields().setSeverity(ball::Severity::e_INFO);
+            ball::Context context;
+
+            {
+                Obj mX(ball::Severity::e_OFF, false, 100,
+                       ball::Severity::e_TRACE, Obj::e_PER_THREAD_QUEUES, &ta);
+                const Obj& X = mX;
+
+                mX.enableFileLogging(fileName.c_str());
+                ASSERT(0 == mX.startPublicationThread());
+
+                for (int i = 1; i <= 3; ++i) {
+                    const bsls::Types::Uint64 EXP = i;
+
+                    // Let the publication thread become idle.
+
+                    bslmt::ThreadUtil::microSleep(50000);
+
+                    mX.publish(record, context);
+
+                    // Wait (for up to 10 seconds) for the record to be
+                    // written.
+
+                    for (int j = 0; j < 1000 && X.numPublishedRecords() < EXP;
+                                                                         ++j) {
+                        bslmt::ThreadUtil::microSleep(10000);
+                    }
+                    ASSERTV(i, X.numPublishedRecords(),
+                            EXP == X.numPublishedRecords());
+                }
+                ASSERT(true == X.isPublicationThreadRunning());
+
+                ASSERT(0 == mX.stopPublicationThread());
+                mX.disableFileLogging();
+
+                ASSERTV(countLoggedRecords(fileName),
+                        3 == countLoggedRecords(fileName));
+            }
+            record.reset();
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING 'recordQueueLength'
@@ -3513,6 +4141,78 @@ int main(int argc, char *argv[])
         }
         fclose(stdout);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: QUEUE BACKENDS
+        //
+        // Concerns:
+        //:  1 Compare the throughput of 'publish', the number of dropped
+        //:    records, and the publish latency of the two queue backends when
+        //:    several threads publish records in a burst.
+        //
+        // Plan:
+        //:  1 For each queue backend, publish the specified number of records
+        //:    (default 200000) from each of the specified number of threads
+        //:    (default 4) to an observer logging to a file, and report the
+        //:    publication rate and the statistics of the observer.
+        //
+        // Testing:
+        //   PERFORMANCE: QUEUE BACKENDS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE: QUEUE BACKENDS"
+                          << "\n===========================" << endl;
+
+        using namespace BALL_ASYNCFILEOBSERVER_TEST_CONCURRENCY;
+
+        const int numThreads = argc > 2 ? atoi(argv[2]) : 4;
+        const int numRecords = argc > 3 ? atoi(argv[3]) : 200000;
+
+        const Obj::QueueBackend BACKENDS[] = { Obj::e_FIXED_QUEUE,
+                                               Obj::e_PER_THREAD_QUEUES };
+        const char *const       NAMES[]    = { "e_FIXED_QUEUE",
+                                               "e_PER_THREAD_QUEUES" };
+
+        for (int ti = 0; ti < 2; ++ti) {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   8192,
+                   ball::Severity::e_OFF,
+                   BACKENDS[ti]);
+
+            mX.enableFileLogging(fileName.c_str());
+            ASSERT(0 == mX.startPublicationThread());
+
+            bsls::Types::Int64 elapsed = 0;
+            publishInParallel(&mX, numThreads, numRecords, &elapsed);
+
+            ASSERT(0 == mX.stopPublicationThread());
+            mX.disableFileLogging();
+
+            const double total = static_cast<double>(numThreads)
+                               * static_cast<double>(numRecords);
+
+            cout << NAMES[ti] << ":\n"
+                 << "\tpublish rate:   "
+                 << total / (static_cast<double>(elapsed) * 1.0e-9)
+                 << " records/s\n"
+                 << "\tpublished:      " << mX.numPublishedRecords() << '\n'
+                 << "\tdropped:        " << mX.numDroppedRecords() << '\n'
+                 << "\tp50 latency:    " << mX.publishLatency(0.5)
+                 << " ns\n"
+                 << "\tp99 latency:    " << mX.publishLatency(0.99)
+                 << " ns\n"
+                 << "\tp99.9 latency:  " << mX.publishLatency(0.999)
+                 << " ns\n"
+                 << "\tmax latency:    " << mX.publishLatency(1.0)
+                 << " ns" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
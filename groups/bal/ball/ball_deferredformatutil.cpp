@@ -0,0 +1,649 @@
+// ball_deferredformatutil.cpp                                        -*-C++-*-
+#include <ball_deferredformatutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredformatutil_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Each encoded argument is a one-byte 'ArgumentType' tag followed by its
+// payload, copied with 'memcpy' so that no alignment is required of the
+// buffer:
+//..
+//  e_SIGNED, e_UNSIGNED, e_POINTER: 8 bytes
+//  e_DOUBLE:                        'sizeof(double)' bytes
+//  e_LONG_DOUBLE:                   'sizeof(long double)' bytes
+//  e_STRING:                        4-byte length, characters, null byte
+//..
+// 'render' copies each conversion specification of the format into a small
+// buffer, replacing any length modifier with one matching the (64-bit) type
+// that is actually passed to 'snprintf', after first converting the encoded
+// value to the type designated by the original length modifier.  For example,
+// "%hx" applied to an encoded 'int' of -1 is rendered by converting -1 to
+// 'unsigned short', and then passing that value, as 'unsigned long long', to
+// 'snprintf' with the specification "%llx".  The result, "ffff", is the same
+// as that of 'printf("%hx", -1)'.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+namespace u {
+
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::Uint64  Uint64;
+typedef bsls::Types::IntPtr  IntPtr;
+typedef bsls::Types::UintPtr UintPtr;
+
+typedef DeferredFormatUtil   Util;
+
+enum {
+    k_SPEC_CAPACITY = 64,   // maximum length of a rewritten conversion
+                            // specification, including the null byte
+
+    k_TEXT_CAPACITY = 128   // size of the stack buffer into which a single
+                            // conversion is formatted before being appended
+};
+
+enum LengthModifier {
+    // Enumerate the length modifiers of a conversion specification.
+
+    e_NONE,
+    e_HH,
+    e_H,
+    e_L,
+    e_LL,
+    e_J,
+    e_Z,
+    e_T,
+    e_BIG_L
+};
+
+template <class TYPE>
+inline
+bsl::size_t encodeScalar(char        *buffer,
+                         bsl::size_t  capacity,
+                         char         type,
+                         TYPE         value)
+    // Write the specified 'type' tag followed by the bytes of the specified
+    // 'value' to the specified 'buffer' having the specified 'capacity', and
+    // return the number of bytes written, or 0 if 'capacity' is insufficient.
+{
+    if (capacity < 1 + sizeof value) {
+        return 0;                                                     // RETURN
+    }
+
+    *buffer = type;
+    bsl::memcpy(buffer + 1, &value, sizeof value);
+
+    return 1 + sizeof value;
+}
+
+struct Argument {
+    // This 'struct' holds a single decoded argument.
+
+    // DATA
+    int          d_type;        // 'DeferredFormatUtil::ArgumentType'
+    Uint64       d_bits;        // value if integral or pointer
+    double       d_double;      // value if 'e_DOUBLE'
+    long double  d_longDouble;  // value if 'e_LONG_DOUBLE'
+    const char  *d_string_p;    // value if 'e_STRING'
+};
+
+class ArgumentReader {
+    // This class provides a mechanism for decoding, in order, the arguments
+    // held in a buffer written by 'DeferredFormatUtil::encode'.
+
+    // DATA
+    const char *d_cursor_p;  // next argument to decode
+    const char *d_end_p;     // end of the buffer
+
+    // PRIVATE MANIPULATORS
+    template <class TYPE>
+    bool readScalar(TYPE *value);
+        // Load into the specified 'value' the bytes at the cursor and advance
+        // the cursor past them.  Return 'true' on success, and 'false' (with
+        // no effect) if too few bytes remain.
+
+  public:
+    // CREATORS
+    ArgumentReader(const char *arguments, bsl::size_t length)
+        // Create a reader for the arguments encoded in the specified
+        // 'arguments' buffer having the specified 'length'.
+    : d_cursor_p(arguments)
+    , d_end_p(arguments + length)
+    {
+    }
+
+    // MANIPULATORS
+    bool next(Argument *argument);
+        // Decode the next argument into the specified 'argument' and return
+        // 'true', or return 'false' if no complete argument remains.
+};
+
+template <class TYPE>
+bool ArgumentReader::readScalar(TYPE *value)
+{
+    if (static_cast<bsl::size_t>(d_end_p - d_cursor_p) < sizeof *value) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::memcpy(value, d_cursor_p, sizeof *value);
+    d_cursor_p += sizeof *value;
+
+    return true;
+}
+
+bool ArgumentReader::next(Argument *argument)
+{
+    if (d_cursor_p == d_end_p) {
+        return false;                                                 // RETURN
+    }
+
+    argument->d_type = *d_cursor_p++;
+
+    bool ok;
+    switch (argument->d_type) {
+      case Util::e_SIGNED:
+      case Util::e_UNSIGNED:
+      case Util::e_POINTER: {
+        ok = readScalar(&argument->d_bits);
+      } break;
+      case Util::e_DOUBLE: {
+        ok = readScalar(&argument->d_double);
+      } break;
+      case Util::e_LONG_DOUBLE: {
+        ok = readScalar(&argument->d_longDouble);
+      } break;
+      case Util::e_STRING: {
+        unsigned int length;
+        ok = readScalar(&length)
+          && static_cast<bsl::size_t>(d_end_p - d_cursor_p) > length;
+        if (ok) {
+            argument->d_string_p  = d_cursor_p;
+            d_cursor_p           += length + 1;
+        }
+      } break;
+      default: {
+        ok = false;
+      }
+    }
+
+    if (!ok) {
+        // The buffer is malformed or truncated; consume nothing more.
+
+        d_cursor_p = d_end_p;
+    }
+    return ok;
+}
+
+Int64 toSigned(const Argument& argument)
+    // Return the value of the specified 'argument' converted to 'Int64'.
+{
+    switch (argument.d_type) {
+      case Util::e_DOUBLE: {
+        return static_cast<Int64>(argument.d_double);                 // RETURN
+      }
+      case Util::e_LONG_DOUBLE: {
+        return static_cast<Int64>(argument.d_longDouble);             // RETURN
+      }
+      case Util::e_STRING: {
+        return 0;                                                     // RETURN
+      }
+    }
+    return static_cast<Int64>(argument.d_bits);
+}
+
+long double toLongDouble(const Argument& argument)
+    // Return the value of the specified 'argument' converted to
+    // 'long double'.
+{
+    switch (argument.d_type) {
+      case Util::e_SIGNED: {
+        return static_cast<long double>(toSigned(argument));          // RETURN
+      }
+      case Util::e_DOUBLE: {
+        return argument.d_double;                                     // RETURN
+      }
+      case Util::e_LONG_DOUBLE: {
+        return argument.d_longDouble;                                 // RETURN
+      }
+      case Util::e_STRING: {
+        return 0;                                                     // RETURN
+      }
+    }
+    return static_cast<long double>(argument.d_bits);
+}
+
+template <class TYPE>
+void appendFormatted(bsl::string *result, const char *spec, TYPE value)
+    // Append to the specified 'result' the text produced by 'snprintf' for
+    // the specified single conversion 'spec' and 'value'.
+{
+    char      text[k_TEXT_CAPACITY];
+    const int length = bsl::snprintf(text, sizeof text, spec, value);
+
+    if (length < 0) {
+        return;                                                       // RETURN
+    }
+
+    if (length < static_cast<int>(sizeof text)) {
+        result->append(text, length);
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t offset = result->length();
+    result->resize(offset + length + 1);
+    bsl::snprintf(&(*result)[offset], length + 1, spec, value);
+    result->resize(offset + length);
+}
+
+void appendNatural(bsl::string *result, const Argument& argument)
+    // Append to the specified 'result' the text representation of the
+    // specified 'argument' in a form appropriate to its encoded type.  Note
+    // that this function is used when the conversion specifier does not match
+    // the encoded type of the argument.
+{
+    switch (argument.d_type) {
+      case Util::e_SIGNED: {
+        appendFormatted(result,
+                        "%lld",
+                        static_cast<long long>(toSigned(argument)));
+      } break;
+      case Util::e_UNSIGNED: {
+        appendFormatted(result,
+                        "%llu",
+                        static_cast<unsigned long long>(argument.d_bits));
+      } break;
+      case Util::e_DOUBLE: {
+        appendFormatted(result, "%g", argument.d_double);
+      } break;
+      case Util::e_LONG_DOUBLE: {
+        appendFormatted(result, "%Lg", argument.d_longDouble);
+      } break;
+      case Util::e_POINTER: {
+        appendFormatted(result,
+                        "%p",
+                        reinterpret_cast<const void *>(
+                                      static_cast<UintPtr>(argument.d_bits)));
+      } break;
+      case Util::e_STRING: {
+        result->append(argument.d_string_p);
+      } break;
+    }
+}
+
+long long convertSigned(Int64 value, LengthModifier modifier)
+    // Return the specified 'value' converted to the signed type designated by
+    // the specified length 'modifier', then to 'long long'.
+{
+    switch (modifier) {
+      case e_HH:   return static_cast<signed char>(value);            // RETURN
+      case e_H:    return static_cast<short>(value);                  // RETURN
+      case e_NONE: return static_cast<int>(value);                    // RETURN
+      case e_L:    return static_cast<long>(value);                   // RETURN
+      case e_Z:
+      case e_T:    return static_cast<IntPtr>(value);                 // RETURN
+      default:     return value;                                      // RETURN
+    }
+}
+
+unsigned long long convertUnsigned(Int64 value, LengthModifier modifier)
+    // Return the specified 'value' converted to the unsigned type designated
+    // by the specified length 'modifier', then to 'unsigned long long'.
+{
+    switch (modifier) {
+      case e_HH:   return static_cast<unsigned char>(value);          // RETURN
+      case e_H:    return static_cast<unsigned short>(value);         // RETURN
+      case e_NONE: return static_cast<unsigned int>(value);           // RETURN
+      case e_L:    return static_cast<unsigned long>(value);          // RETURN
+      case e_Z:
+      case e_T:    return static_cast<UintPtr>(value);                // RETURN
+      default:     return static_cast<Uint64>(value);                 // RETURN
+    }
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                          // -------------------------
+                          // struct DeferredFormatUtil
+                          // -------------------------
+
+// PRIVATE CLASS METHODS
+bsl::size_t DeferredFormatUtil::encodeSigned(char               *buffer,
+                                             bsl::size_t         capacity,
+                                             bsls::Types::Int64  value)
+{
+    BSLS_ASSERT(buffer || 0 == capacity);
+
+    return u::encodeScalar(buffer, capacity, e_SIGNED, value);
+}
+
+bsl::size_t DeferredFormatUtil::encodeUnsigned(char                *buffer,
+                                               bsl::size_t          capacity,
+                                               bsls::Types::Uint64  value)
+{
+    BSLS_ASSERT(buffer || 0 == capacity);
+
+    return u::encodeScalar(buffer, capacity, e_UNSIGNED, value);
+}
+
+bsl::size_t DeferredFormatUtil::encodePointer(char        *buffer,
+                                              bsl::size_t  capacity,
+                                              const void  *value)
+{
+    BSLS_ASSERT(buffer || 0 == capacity);
+
+    return u::encodeScalar(buffer,
+                           capacity,
+                           e_POINTER,
+                           static_cast<u::Uint64>(
+                                       reinterpret_cast<u::UintPtr>(value)));
+}
+
+// CLASS METHODS
+bsl::size_t DeferredFormatUtil::encode(char        *buffer,
+                                       bsl::size_t  capacity,
+                                       double       value)
+{
+    BSLS_ASSERT(buffer || 0 == capacity);
+
+    return u::encodeScalar(buffer, capacity, e_DOUBLE, value);
+}
+
+bsl::size_t DeferredFormatUtil::encode(char        *buffer,
+                                       bsl::size_t  capacity,
+                                       long double  value)
+{
+    BSLS_ASSERT(buffer || 0 == capacity);
+
+    return u::encodeScalar(buffer, capacity, e_LONG_DOUBLE, value);
+}
+
+bsl::size_t DeferredFormatUtil::encode(char        *buffer,
+                                       bsl::size_t  capacity,
+                                       const char  *value)
+{
+    BSLS_ASSERT(buffer || 0 == capacity);
+
+    if (capacity < k_MIN_STRING_LENGTH) {
+        return 0;                                                     // RETURN
+    }
+
+    if (0 == value) {
+        value = "(null)";
+    }
+
+    const bsl::size_t maxLength = capacity - k_MIN_STRING_LENGTH;
+    bsl::size_t       length    = 0;
+    while (length < maxLength && value[length]) {
+        ++length;
+    }
+
+    const unsigned int length32 = static_cast<unsigned int>(length);
+
+    buffer[0] = e_STRING;
+    bsl::memcpy(buffer + 1, &length32, sizeof length32);
+    bsl::memcpy(buffer + 1 + sizeof length32, value, length);
+    buffer[1 + sizeof length32 + length] = '\0';
+
+    return k_MIN_STRING_LENGTH + length;
+}
+
+void DeferredFormatUtil::render(bsl::string *result,
+                                const char  *format,
+                                const char  *arguments,
+                                bsl::size_t  length)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(format);
+    BSLS_ASSERT(arguments || 0 == length);
+
+    u::ArgumentReader reader(arguments, length);
+    u::Argument       argument;
+
+    const char *literal = format;
+    while (true) {
+        const char *percent = bsl::strchr(literal, '%');
+        if (0 == percent) {
+            result->append(literal);
+            return;                                                   // RETURN
+        }
+        result->append(literal, percent);
+
+        const char *cursor = percent + 1;
+        if ('%' == *cursor) {
+            result->push_back('%');
+            literal = cursor + 1;
+            continue;
+        }
+
+        // Copy the flags, field width, and precision into 'spec', consuming
+        // an argument for each '*'.
+
+        char  spec[u::k_SPEC_CAPACITY];
+        char *specEnd = spec;
+        bool  missing = false;
+
+        *specEnd++ = '%';
+        while (*cursor && bsl::strchr("-+ #0'", *cursor)
+                                        && specEnd < spec + 16) {
+            *specEnd++ = *cursor++;
+        }
+
+        for (int part = 0; part < 2; ++part) {
+            if (1 == part) {
+                if ('.' != *cursor) {
+                    break;
+                }
+                ++cursor;
+            }
+
+            if ('*' == *cursor) {
+                ++cursor;
+                if (!reader.next(&argument)) {
+                    missing = true;
+                    continue;
+                }
+                const int value = static_cast<int>(u::toSigned(argument));
+                if (0 == part || 0 <= value) {
+                    specEnd += bsl::sprintf(specEnd,
+                                            0 == part ? "%d" : ".%d",
+                                            value);
+                }
+            }
+            else {
+                if (1 == part) {
+                    *specEnd++ = '.';
+                }
+                for (int digits = 0; '0' <= *cursor && *cursor <= '9';
+                                                                ++digits) {
+                    if (digits < 9) {
+                        *specEnd++ = *cursor;
+                    }
+                    ++cursor;
+                }
+            }
+        }
+
+        // Parse the length modifier.
+
+        u::LengthModifier modifier = u::e_NONE;
+        switch (*cursor) {
+          case 'h': {
+            ++cursor;
+            modifier = 'h' == *cursor ? (++cursor, u::e_HH) : u::e_H;
+          } break;
+          case 'l': {
+            ++cursor;
+            modifier = 'l' == *cursor ? (++cursor, u::e_LL) : u::e_L;
+          } break;
+          case 'q': {
+            ++cursor;
+            modifier = u::e_LL;
+          } break;
+          case 'j': {
+            ++cursor;
+            modifier = u::e_J;
+          } break;
+          case 'z': {
+            ++cursor;
+            modifier = u::e_Z;
+          } break;
+          case 't': {
+            ++cursor;
+            modifier = u::e_T;
+          } break;
+          case 'L': {
+            ++cursor;
+            modifier = u::e_BIG_L;
+          } break;
+        }
+
+        const char conversion = *cursor;
+        if ('\0' == conversion) {
+            // Incomplete conversion specification.
+
+            result->append(percent);
+            return;                                                   // RETURN
+        }
+        literal = cursor + 1;
+
+        if (!bsl::strchr("diouxXcsfFeEgGaApn", conversion)) {
+            // Unknown conversion specifier.
+
+            result->append(percent, literal);
+            continue;
+        }
+
+        if (missing || !reader.next(&argument)) {
+            result->append(percent, literal);
+            continue;
+        }
+
+        const bool isString = DeferredFormatUtil::e_STRING == argument.d_type;
+
+        switch (conversion) {
+          case 'd':
+          case 'i': {
+            if (isString) {
+                u::appendNatural(result, argument);
+                break;
+            }
+            specEnd[0] = 'l';
+            specEnd[1] = 'l';
+            specEnd[2] = conversion;
+            specEnd[3] = '\0';
+            u::appendFormatted(result,
+                               spec,
+                               u::convertSigned(u::toSigned(argument),
+                                                modifier));
+          } break;
+          case 'o':
+          case 'u':
+          case 'x':
+          case 'X': {
+            if (isString) {
+                u::appendNatural(result, argument);
+                break;
+            }
+            specEnd[0] = 'l';
+            specEnd[1] = 'l';
+            specEnd[2] = conversion;
+            specEnd[3] = '\0';
+            u::appendFormatted(result,
+                               spec,
+                               u::convertUnsigned(u::toSigned(argument),
+                                                  modifier));
+          } break;
+          case 'c': {
+            if (isString) {
+                u::appendNatural(result, argument);
+                break;
+            }
+            specEnd[0] = 'c';
+            specEnd[1] = '\0';
+            u::appendFormatted(result,
+                               spec,
+                               static_cast<int>(u::toSigned(argument)));
+          } break;
+          case 'f':
+          case 'F':
+          case 'e':
+          case 'E':
+          case 'g':
+          case 'G':
+          case 'a':
+          case 'A': {
+            if (isString) {
+                u::appendNatural(result, argument);
+                break;
+            }
+            if (u::e_BIG_L == modifier) {
+                specEnd[0] = 'L';
+                specEnd[1] = conversion;
+                specEnd[2] = '\0';
+                u::appendFormatted(result, spec, u::toLongDouble(argument));
+            }
+            else {
+                specEnd[0] = conversion;
+                specEnd[1] = '\0';
+                u::appendFormatted(result,
+                                   spec,
+                                   static_cast<double>(
+                                                  u::toLongDouble(argument)));
+            }
+          } break;
+          case 's': {
+            if (!isString) {
+                u::appendNatural(result, argument);
+                break;
+            }
+            specEnd[0] = 's';
+            specEnd[1] = '\0';
+            u::appendFormatted(result, spec, argument.d_string_p);
+          } break;
+          case 'p': {
+            if (isString) {
+                u::appendNatural(result, argument);
+                break;
+            }
+            specEnd[0] = 'p';
+            specEnd[1] = '\0';
+            u::appendFormatted(result,
+                               spec,
+                               reinterpret_cast<const void *>(
+                                static_cast<u::UintPtr>(
+                                                u::toSigned(argument))));
+          } break;
+          case 'n': {
+            // Consume the argument and write nothing.
+          } break;
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,296 @@
+// ball_deferredformatutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDFORMATUTIL
+#define INCLUDED_BALL_DEFERREDFORMATUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide binary capture and deferred rendering of 'printf' args.
+//
+//@CLASSES:
+//  ball::DeferredFormatUtil: namespace for deferred 'printf' formatting
+//
+//@SEE_ALSO: ball_deferredlogger, ball_log
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'ball::DeferredFormatUtil', that splits 'printf'-style formatting into two
+// steps: 'encode', which appends the value of a single argument to a buffer
+// in a compact binary form, and 'render', which later interprets a 'printf'
+// format string against a sequence of encoded arguments, appending the
+// resulting text to a string.  Encoding an argument is a type-directed copy
+// of at most a few bytes (or, for a string, of its characters), so the cost
+// of formatting can be moved off of a latency-sensitive thread (see
+// 'ball_deferredlogger').
+//
+///Supported Arguments
+///-------------------
+// 'encode' is overloaded for the types that can be passed to a 'printf'-style
+// function after the default argument promotions: 'int', 'long',
+// 'long long', their 'unsigned' counterparts, 'double', 'long double',
+// null-terminated strings, and pointers.  Smaller integral types, 'bool',
+// unscoped enumerations, and 'float' are promoted exactly as they would be
+// when passed to 'printf'.  Integral values are encoded as 64-bit values and
+// are converted by 'render' to the type implied by the length modifier and
+// conversion specifier of the corresponding conversion specification, so the
+// rendered text is the same as that produced by 'printf' for the same format
+// and arguments.  The characters of a string are copied (a null pointer is
+// encoded as the string "(null)"); all other values are copied bitwise.
+//
+// 'render' supports the conversion specifiers 'd', 'i', 'o', 'u', 'x', 'X',
+// 'c', 'e', 'E', 'f', 'F', 'g', 'G', 'a', 'A', 's', 'p', and '%', with any
+// flags, field width, precision (including '*'), and length modifier.  The
+// 'n' conversion specifier consumes its argument and writes nothing.  A
+// conversion specification for which no argument was encoded (e.g., because
+// the buffer supplied to 'encode' was exhausted) is rendered verbatim.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting a Message Later
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that a latency-sensitive thread needs to describe an event, but
+// that the text of the description is needed only later, by another thread.
+//
+// First, the latency-sensitive thread encodes the arguments of the message
+// into a buffer, advancing past each encoded argument:
+//..
+//  char        buffer[128];
+//  bsl::size_t length = 0;
+//
+//  const char *format = "order %d: %s %u @ %.2f";
+//
+//  length += ball::DeferredFormatUtil::encode(buffer + length,
+//                                             sizeof buffer - length,
+//                                             12345);
+//  length += ball::DeferredFormatUtil::encode(buffer + length,
+//                                             sizeof buffer - length,
+//                                             "BUY");
+//  length += ball::DeferredFormatUtil::encode(buffer + length,
+//                                             sizeof buffer - length,
+//                                             100u);
+//  length += ball::DeferredFormatUtil::encode(buffer + length,
+//                                             sizeof buffer - length,
+//                                             99.5);
+//..
+// Then, the format string (which must outlive the encoded arguments; a string
+// literal is typical) and the encoded bytes are handed to another thread.
+// Finally, that thread renders the message:
+//..
+//  bsl::string message;
+//  ball::DeferredFormatUtil::render(&message, format, buffer, length);
+//
+//  assert("order 12345: BUY 100 @ 99.50" == message);
+//..
+
+#include <balscm_version.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                          // =========================
+                          // struct DeferredFormatUtil
+                          // =========================
+
+struct DeferredFormatUtil {
+    // This 'struct' provides a namespace for utility functions that capture
+    // the arguments of a 'printf'-style format in a compact binary form, and
+    // that later render a format string and such captured arguments as text.
+
+    // TYPES
+    enum ArgumentType {
+        // Enumerate the tags identifying the kind of each encoded argument.
+
+        e_SIGNED      = 1,  // signed integral value, as 'Int64'
+        e_UNSIGNED    = 2,  // unsigned integral value, as 'Uint64'
+        e_DOUBLE      = 3,  // 'double' value
+        e_LONG_DOUBLE = 4,  // 'long double' value
+        e_POINTER     = 5,  // pointer value, as 'Uint64'
+        e_STRING      = 6   // 32-bit length, characters, and a null byte
+    };
+
+    enum {
+        k_MIN_STRING_LENGTH = 6  // minimum number of bytes required to encode
+                                 // (an empty) string
+    };
+
+  private:
+    // PRIVATE CLASS METHODS
+    static bsl::size_t encodeSigned(char               *buffer,
+                                    bsl::size_t         capacity,
+                                    bsls::Types::Int64  value);
+        // Encode the specified signed 'value' into the specified 'buffer'
+        // having the specified 'capacity', and return the number of bytes
+        // written, or 0 (having written nothing) if 'capacity' is
+        // insufficient.
+
+    static bsl::size_t encodeUnsigned(char                *buffer,
+                                      bsl::size_t          capacity,
+                                      bsls::Types::Uint64  value);
+        // Encode the specified unsigned 'value' into the specified 'buffer'
+        // having the specified 'capacity', and return the number of bytes
+        // written, or 0 (having written nothing) if 'capacity' is
+        // insufficient.
+
+    static bsl::size_t encodePointer(char        *buffer,
+                                     bsl::size_t  capacity,
+                                     const void  *value);
+        // Encode the specified pointer 'value' into the specified 'buffer'
+        // having the specified 'capacity', and return the number of bytes
+        // written, or 0 (having written nothing) if 'capacity' is
+        // insufficient.
+
+  public:
+    // CLASS METHODS
+    static bsl::size_t encode(char *buffer, bsl::size_t capacity, int value);
+    static bsl::size_t encode(char        *buffer,
+                              bsl::size_t  capacity,
+                              long         value);
+    static bsl::size_t encode(char        *buffer,
+                              bsl::size_t  capacity,
+                              long long    value);
+    static bsl::size_t encode(char         *buffer,
+                              bsl::size_t   capacity,
+                              unsigned int  value);
+    static bsl::size_t encode(char          *buffer,
+                              bsl::size_t    capacity,
+                              unsigned long  value);
+    static bsl::size_t encode(char               *buffer,
+                              bsl::size_t         capacity,
+                              unsigned long long  value);
+    static bsl::size_t encode(char        *buffer,
+                              bsl::size_t  capacity,
+                              double       value);
+    static bsl::size_t encode(char        *buffer,
+                              bsl::size_t  capacity,
+                              long double  value);
+        // Append the specified 'value' to the specified 'buffer' having the
+        // specified 'capacity' in the binary form understood by 'render', and
+        // return the number of bytes written.  If 'capacity' is insufficient
+        // to encode 'value', write nothing and return 0.
+
+    static bsl::size_t encode(char        *buffer,
+                              bsl::size_t  capacity,
+                              const char  *value);
+        // Append the specified null-terminated string 'value' to the specified
+        // 'buffer' having the specified 'capacity' in the binary form
+        // understood by 'render', and return the number of bytes written.  If
+        // 'value' is 0, encode the string "(null)".  If 'capacity' is
+        // insufficient for all of the characters of 'value', encode as many
+        // of the leading characters as fit.  If 'capacity' is less than
+        // 'k_MIN_STRING_LENGTH', write nothing and return 0.
+
+    template <class TYPE>
+    static bsl::size_t encode(char        *buffer,
+                              bsl::size_t  capacity,
+                              const TYPE  *value);
+        // Append the specified pointer 'value' to the specified 'buffer'
+        // having the specified 'capacity' in the binary form understood by
+        // 'render', and return the number of bytes written.  If 'capacity' is
+        // insufficient to encode 'value', write nothing and return 0.  Note
+        // that the object referred to by 'value', if any, is not accessed.
+
+    static void render(bsl::string *result,
+                       const char  *format,
+                       const char  *arguments,
+                       bsl::size_t  length);
+        // Append to the specified 'result' the text produced by formatting the
+        // arguments encoded in the specified 'arguments' buffer of the
+        // specified 'length' according to the specified 'printf'-style
+        // 'format'.  A conversion specification in 'format' for which no
+        // encoded argument remains is appended verbatim.  The behavior is
+        // undefined unless 'arguments' holds the concatenation of the bytes
+        // written by a sequence of calls to 'encode'.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                          // -------------------------
+                          // struct DeferredFormatUtil
+                          // -------------------------
+
+// CLASS METHODS
+inline
+bsl::size_t DeferredFormatUtil::encode(char        *buffer,
+                                       bsl::size_t  capacity,
+                                       int          value)
+{
+    return encodeSigned(buffer, capacity, value);
+}
+
+inline
+bsl::size_t DeferredFormatUtil::encode(char        *buffer,
+                                       bsl::size_t  capacity,
+                                       long         value)
+{
+    return encodeSigned(buffer, capacity, value);
+}
+
+inline
+bsl::size_t DeferredFormatUtil::encode(char        *buffer,
+                                       bsl::size_t  capacity,
+                                       long long    value)
+{
+    return encodeSigned(buffer, capacity, value);
+}
+
+inline
+bsl::size_t DeferredFormatUtil::encode(char         *buffer,
+                                       bsl::size_t   capacity,
+                                       unsigned int  value)
+{
+    return encodeUnsigned(buffer, capacity, value);
+}
+
+inline
+bsl::size_t DeferredFormatUtil::encode(char          *buffer,
+                                       bsl::size_t    capacity,
+                                       unsigned long  value)
+{
+    return encodeUnsigned(buffer, capacity, value);
+}
+
+inline
+bsl::size_t DeferredFormatUtil::encode(char               *buffer,
+                                       bsl::size_t         capacity,
+                                       unsigned long long  value)
+{
+    return encodeUnsigned(buffer, capacity, value);
+}
+
+template <class TYPE>
+inline
+bsl::size_t DeferredFormatUtil::encode(char        *buffer,
+                                       bsl::size_t  capacity,
+                                       const TYPE  *value)
+{
+    return encodePointer(buffer, capacity, value);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
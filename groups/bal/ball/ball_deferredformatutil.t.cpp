@@ -0,0 +1,679 @@
+// ball_deferredformatutil.t.cpp                                      -*-C++-*-
+#include <ball_deferredformatutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                TEST PLAN
+//-----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// The component under test is a utility whose 'encode' overloads write a
+// tagged binary form of a single argument, and whose 'render' function
+// interprets a 'printf' format against such encoded arguments.  We first
+// verify the number of bytes written by each 'encode' overload, including
+// when the capacity is insufficient, and then verify that 'render' produces
+// exactly the text that 'snprintf' produces for a broad table of formats and
+// argument types.  Finally, we verify the documented behavior of 'render'
+// for missing arguments and malformed conversion specifications.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] size_t encode(char *, size_t, int);
+// [ 2] size_t encode(char *, size_t, long);
+// [ 2] size_t encode(char *, size_t, long long);
+// [ 2] size_t encode(char *, size_t, unsigned int);
+// [ 2] size_t encode(char *, size_t, unsigned long);
+// [ 2] size_t encode(char *, size_t, unsigned long long);
+// [ 2] size_t encode(char *, size_t, double);
+// [ 2] size_t encode(char *, size_t, long double);
+// [ 2] size_t encode(char *, size_t, const char *);
+// [ 2] size_t encode(char *, size_t, const TYPE *);
+// [ 3] void render(string *, const char *, const char *, size_t);
+// [ 4] void render(string *, const char *, const char *, size_t);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::DeferredFormatUtil Util;
+
+static bool verbose;
+static bool veryVerbose;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+template <class TYPE>
+void testRender(int line, const char *format, TYPE value)
+    // Verify that rendering the specified 'format' with the specified 'value'
+    // produces the same text as 'snprintf', reporting failures against the
+    // specified 'line'.
+{
+    char        buffer[256];
+    bsl::size_t length = Util::encode(buffer, sizeof buffer, value);
+    ASSERTV(line, 0 < length);
+
+    bsl::string result;
+    Util::render(&result, format, buffer, length);
+
+    char expected[256];
+    bsl::snprintf(expected, sizeof expected, format, value);
+
+    if (veryVerbose) {
+        T_ P_(line) P_(format) P_(result) P(expected)
+    }
+    ASSERTV(line, format, result, expected, expected == result);
+}
+
+template <class TYPE1, class TYPE2>
+void testRender(int line, const char *format, TYPE1 value1, TYPE2 value2)
+    // Verify that rendering the specified 'format' with the specified
+    // 'value1' and 'value2' produces the same text as 'snprintf', reporting
+    // failures against the specified 'line'.
+{
+    char        buffer[256];
+    bsl::size_t length = Util::encode(buffer, sizeof buffer, value1);
+    length += Util::encode(buffer + length, sizeof buffer - length, value2);
+
+    bsl::string result;
+    Util::render(&result, format, buffer, length);
+
+    char expected[256];
+    bsl::snprintf(expected, sizeof expected, format, value1, value2);
+
+    if (veryVerbose) {
+        T_ P_(line) P_(format) P_(result) P(expected)
+    }
+    ASSERTV(line, format, result, expected, expected == result);
+}
+
+template <class TYPE1, class TYPE2, class TYPE3>
+void testRender(int         line,
+                const char *format,
+                TYPE1       value1,
+                TYPE2       value2,
+                TYPE3       value3)
+    // Verify that rendering the specified 'format' with the specified
+    // 'value1', 'value2', and 'value3' produces the same text as 'snprintf',
+    // reporting failures against the specified 'line'.
+{
+    char        buffer[256];
+    bsl::size_t length = Util::encode(buffer, sizeof buffer, value1);
+    length += Util::encode(buffer + length, sizeof buffer - length, value2);
+    length += Util::encode(buffer + length, sizeof buffer - length, value3);
+
+    bsl::string result;
+    Util::render(&result, format, buffer, length);
+
+    char expected[256];
+    bsl::snprintf(expected, sizeof expected, format, value1, value2, value3);
+
+    if (veryVerbose) {
+        T_ P_(line) P_(format) P_(result) P(expected)
+    }
+    ASSERTV(line, format, result, expected, expected == result);
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test    = argc > 1 ? atoi(argv[1]) : 0;
+    verbose     = argc > 2;
+    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file
+        //:   compiles, links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting a Message Later
+///- - - - - - - - - - - - - - - - - - -
+// Suppose that a latency-sensitive thread needs to describe an event, but
+// that the text of the description is needed only later, by another thread.
+//
+// First, the latency-sensitive thread encodes the arguments of the message
+// into a buffer, advancing past each encoded argument:
+//..
+    char        buffer[128];
+    bsl::size_t length = 0;
+
+    const char *format = "order %d: %s %u @ %.2f";
+
+    length += ball::DeferredFormatUtil::encode(buffer + length,
+                                               sizeof buffer - length,
+                                               12345);
+    length += ball::DeferredFormatUtil::encode(buffer + length,
+                                               sizeof buffer - length,
+                                               "BUY");
+    length += ball::DeferredFormatUtil::encode(buffer + length,
+                                               sizeof buffer - length,
+                                               100u);
+    length += ball::DeferredFormatUtil::encode(buffer + length,
+                                               sizeof buffer - length,
+                                               99.5);
+//..
+// Then, the format string (which must outlive the encoded arguments; a string
+// literal is typical) and the encoded bytes are handed to another thread.
+// Finally, that thread renders the message:
+//..
+    bsl::string message;
+    ball::DeferredFormatUtil::render(&message, format, buffer, length);
+
+    ASSERT("order 12345: BUY 100 @ 99.50" == message);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'render' EDGE CASES
+        //
+        // Concerns:
+        //: 1 A conversion specification with no remaining argument is
+        //:   rendered verbatim.
+        //:
+        //: 2 An unknown conversion specifier is rendered verbatim and does
+        //:   not consume an argument.
+        //:
+        //: 3 An incomplete trailing conversion specification is rendered
+        //:   verbatim.
+        //:
+        //: 4 '%n' consumes its argument and writes nothing.
+        //:
+        //: 5 A conversion specifier that does not match the type of the
+        //:   encoded argument renders the argument in a form appropriate to
+        //:   its type.
+        //:
+        //: 6 A conversion whose output exceeds the internal stack buffer is
+        //:   rendered completely.
+        //:
+        //: 7 'render' appends to 'result'.
+        //
+        // Plan:
+        //: 1 Render formats exhibiting each case and compare the results to
+        //:   the expected text.  (C-1..7)
+        //
+        // Testing:
+        //   void render(string *, const char *, const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'render' EDGE CASES" << endl
+                          << "===========================" << endl;
+
+        char        buffer[64];
+        bsl::size_t length = Util::encode(buffer, sizeof buffer, 7);
+
+        struct {
+            int         d_line;
+            const char *d_format_p;
+            const char *d_expected_p;
+        } DATA[] = {
+            //LINE  FORMAT               EXPECTED
+            //----  -------------------  -------------------
+            { L_,   "",                  ""                  },
+            { L_,   "abc",               "abc"               },
+            { L_,   "%%",                "%"                 },
+            { L_,   "%d",                "7"                 },
+            { L_,   "%d %d",             "7 %d"              },
+            { L_,   "%5.2d|%-3s|",       "   07|%-3s|"       },
+            { L_,   "%k %d",             "%k 7"              },
+            { L_,   "%d%",               "7%"                },
+            { L_,   "%d %5l",            "7 %5l"             },
+            { L_,   "%n%d",              "%d"                },
+            { L_,   "%s",                "7"                 },
+            { L_,   "%*d",               "%*d"               },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *FORMAT   = DATA[ti].d_format_p;
+            const char *EXPECTED = DATA[ti].d_expected_p;
+
+            bsl::string result;
+            Util::render(&result, FORMAT, buffer, length);
+
+            if (veryVerbose) { T_ P_(LINE) P_(FORMAT) P(result) }
+
+            ASSERTV(LINE, FORMAT, result, EXPECTED == result);
+        }
+
+        if (verbose) cout << "\tMismatched conversions\n";
+        {
+            length  = Util::encode(buffer, sizeof buffer, "str");
+            length += Util::encode(buffer + length,
+                                   sizeof buffer - length,
+                                   -3);
+
+            bsl::string result;
+            Util::render(&result, "%d %s", buffer, length);
+            ASSERTV(result, "str -3" == result);
+        }
+
+        if (verbose) cout << "\tLong conversions\n";
+        {
+            length = Util::encode(buffer, sizeof buffer, 42);
+
+            bsl::string result;
+            Util::render(&result, "%300d", buffer, length);
+            ASSERTV(result.length(), 300 == result.length());
+            ASSERT(bsl::string(298, ' ') + "42" == result);
+        }
+
+        if (verbose) cout << "\tAppending\n";
+        {
+            length = Util::encode(buffer, sizeof buffer, 42);
+
+            bsl::string result("x=");
+            Util::render(&result, "%d", buffer, length);
+            ASSERTV(result, "x=42" == result);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'render'
+        //
+        // Concerns:
+        //: 1 For every supported conversion specifier, flag, field width,
+        //:   precision, and length modifier, 'render' produces the same text
+        //:   as 'snprintf' given the same format and arguments.
+        //:
+        //: 2 Field width and precision given as '*' consume an argument.
+        //:
+        //: 3 Integral values are converted as directed by the length
+        //:   modifier, including narrowing and sign changes.
+        //
+        // Plan:
+        //: 1 For a table of formats and arguments of each supported type,
+        //:   encode the arguments, render the format, and compare the result
+        //:   to that of 'snprintf'.  (C-1..3)
+        //
+        // Testing:
+        //   void render(string *, const char *, const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'render'" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "\tSigned integral conversions\n";
+        {
+            testRender(L_, "%d", 0);
+            testRender(L_, "%d", -1);
+            testRender(L_, "%i", INT_MAX);
+            testRender(L_, "%d", INT_MIN);
+            testRender(L_, "[%5d]", 42);
+            testRender(L_, "[%-5d]", 42);
+            testRender(L_, "[%05d]", -42);
+            testRender(L_, "[%+d]", 42);
+            testRender(L_, "[% d]", 42);
+            testRender(L_, "[%.4d]", 42);
+            testRender(L_, "%ld", LONG_MIN);
+            testRender(L_, "%lld", LLONG_MAX);
+            testRender(L_, "%hd", 70000);
+            testRender(L_, "%hhd", 300);
+            testRender(L_, "%hhd", 'A');
+            testRender(L_, "%d", static_cast<short>(-7));
+            testRender(L_, "%d", true);
+            testRender(L_, "%d", 4000000000u);
+            testRender(L_, "%jd", static_cast<bsls::Types::Int64>(-5));
+            testRender(L_, "%zd", static_cast<bsl::size_t>(12));
+            testRender(L_, "%td", static_cast<bsls::Types::IntPtr>(-12));
+        }
+
+        if (verbose) cout << "\tUnsigned integral conversions\n";
+        {
+            testRender(L_, "%u", 0u);
+            testRender(L_, "%u", UINT_MAX);
+            testRender(L_, "%u", -1);
+            testRender(L_, "%x", -1);
+            testRender(L_, "%hx", -1);
+            testRender(L_, "%hhx", -1);
+            testRender(L_, "%lx", -1L);
+            testRender(L_, "%llX", ULLONG_MAX);
+            testRender(L_, "%#o", 8);
+            testRender(L_, "%#x", 255u);
+            testRender(L_, "[%08X]", 0xBEEFu);
+            testRender(L_, "%lu", ULONG_MAX);
+            testRender(L_, "%zu", static_cast<bsl::size_t>(-1));
+        }
+
+        if (verbose) cout << "\tCharacter conversions\n";
+        {
+            testRender(L_, "%c", 'x');
+            testRender(L_, "[%3c]", 'x');
+            testRender(L_, "[%-3c]", 'x');
+        }
+
+        if (verbose) cout << "\tFloating-point conversions\n";
+        {
+            testRender(L_, "%f", 3.25);
+            testRender(L_, "%.3f", 3.14159);
+            testRender(L_, "%10.2f", -2.5);
+            testRender(L_, "%e", 12345.678);
+            testRender(L_, "%E", 0.000123);
+            testRender(L_, "%g", 1e20);
+            testRender(L_, "%G", 1e-20);
+            testRender(L_, "%a", 1.0);
+            testRender(L_, "%f", 1.5f);
+            testRender(L_, "%lf", 2.5);
+            testRender(L_, "%Lf", 2.5L);
+            testRender(L_, "%.10Lg", 1.0L / 3);
+            testRender(L_, "%+.1e", -0.0);
+        }
+
+        if (verbose) cout << "\tString conversions\n";
+        {
+            char        array[] = "array";
+            const char *null    = 0;
+
+            testRender(L_, "%s", "");
+            testRender(L_, "%s", "hello");
+            testRender(L_, "[%10s]", "hello");
+            testRender(L_, "[%-10s]", "hello");
+            testRender(L_, "[%.3s]", "hello");
+            testRender(L_, "%s", array);
+            testRender(L_, "%s", static_cast<char *>(array));
+
+            bsl::string result;
+            char        buffer[32];
+            bsl::size_t length = Util::encode(buffer, sizeof buffer, null);
+            Util::render(&result, "%s", buffer, length);
+            ASSERTV(result, "(null)" == result);
+        }
+
+        if (verbose) cout << "\tPointer conversions\n";
+        {
+            int          value = 0;
+            const void  *cvp   = &value;
+            int         *ip    = &value;
+
+            testRender(L_, "%p", cvp);
+            testRender(L_, "%p", ip);
+            testRender(L_, "[%20p]", ip);
+        }
+
+        if (verbose) cout << "\tMultiple arguments and '*'\n";
+        {
+            testRender(L_, "%d/%s", 1, "two");
+            testRender(L_, "%s=%.2f", "pi", 3.14159);
+            testRender(L_, "[%*d]", 6, 42);
+            testRender(L_, "[%*d]", -6, 42);
+            testRender(L_, "[%.*f]", 2, 3.14159);
+            testRender(L_, "[%.*f]", -2, 3.14159);
+            testRender(L_, "[%*.*f]", 9, 3, 3.14159);
+            testRender(L_, "%c%c%c", 'a', 'b', 'c');
+            testRender(L_, "%llu %ld %u", 1ULL, -2L, 3u);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'encode'
+        //
+        // Concerns:
+        //: 1 Each overload writes a one-byte tag followed by the bytes of the
+        //:   value, and returns the number of bytes written.
+        //:
+        //: 2 If the capacity is insufficient, a scalar is not written and 0
+        //:   is returned.
+        //:
+        //: 3 A string is truncated to fit, and is not written (0 is
+        //:   returned) only if the capacity is less than
+        //:   'k_MIN_STRING_LENGTH'.
+        //:
+        //: 4 Arguments that are promoted by 'printf' (e.g., 'char', 'short',
+        //:   'float') select the overload for the promoted type.
+        //
+        // Plan:
+        //: 1 Encode values of each type with sufficient and insufficient
+        //:   capacity, and verify the return value and the tag.  (C-1..4)
+        //
+        // Testing:
+        //   size_t encode(char *, size_t, int);
+        //   size_t encode(char *, size_t, long);
+        //   size_t encode(char *, size_t, long long);
+        //   size_t encode(char *, size_t, unsigned int);
+        //   size_t encode(char *, size_t, unsigned long);
+        //   size_t encode(char *, size_t, unsigned long long);
+        //   size_t encode(char *, size_t, double);
+        //   size_t encode(char *, size_t, long double);
+        //   size_t encode(char *, size_t, const char *);
+        //   size_t encode(char *, size_t, const TYPE *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'encode'" << endl
+                          << "================" << endl;
+
+        char buffer[64];
+        int  value = 0;
+
+        const bsl::size_t LD = 1 + sizeof(long double);
+
+        struct {
+            int         d_line;
+            bsl::size_t d_length;
+            int         d_type;
+        } DATA[] = {
+            { L_, Util::encode(buffer, 64, 1),               Util::e_SIGNED  },
+            { L_, Util::encode(buffer, 64, 1L),              Util::e_SIGNED  },
+            { L_, Util::encode(buffer, 64, 1LL),             Util::e_SIGNED  },
+            { L_, Util::encode(buffer, 64, 'c'),             Util::e_SIGNED  },
+            { L_, Util::encode(buffer, 64, true),            Util::e_SIGNED  },
+            { L_, Util::encode(buffer, 64,
+                               static_cast<short>(1)),       Util::e_SIGNED  },
+            { L_, Util::encode(buffer, 64, 1u),              Util::e_UNSIGNED},
+            { L_, Util::encode(buffer, 64, 1UL),             Util::e_UNSIGNED},
+            { L_, Util::encode(buffer, 64, 1ULL),            Util::e_UNSIGNED},
+            { L_, Util::encode(buffer, 64, 1.0),             Util::e_DOUBLE  },
+            { L_, Util::encode(buffer, 64, 1.0f),            Util::e_DOUBLE  },
+            { L_, Util::encode(buffer, 64, &value),          Util::e_POINTER },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+
+            ASSERTV(LINE, DATA[ti].d_length, 9 == DATA[ti].d_length);
+        }
+
+        if (verbose) cout << "\tTags\n";
+        {
+            Util::encode(buffer, sizeof buffer, 1);
+            ASSERT(Util::e_SIGNED == buffer[0]);
+
+            Util::encode(buffer, sizeof buffer, 1u);
+            ASSERT(Util::e_UNSIGNED == buffer[0]);
+
+            Util::encode(buffer, sizeof buffer, 1.0f);
+            ASSERT(Util::e_DOUBLE == buffer[0]);
+
+            ASSERT(LD == Util::encode(buffer, sizeof buffer, 1.0L));
+            ASSERT(Util::e_LONG_DOUBLE == buffer[0]);
+
+            Util::encode(buffer, sizeof buffer, static_cast<void *>(buffer));
+            ASSERT(Util::e_POINTER == buffer[0]);
+
+            ASSERT(Util::k_MIN_STRING_LENGTH + 3 ==
+                                      Util::encode(buffer, 64, "abc"));
+            ASSERT(Util::e_STRING == buffer[0]);
+            ASSERT(0 == bsl::strcmp("abc", buffer + 5));
+        }
+
+        if (verbose) cout << "\tInsufficient capacity\n";
+        {
+            ASSERT(0 == Util::encode(buffer, 8, 1));
+            ASSERT(9 == Util::encode(buffer, 9, 1));
+            ASSERT(0 == Util::encode(buffer, 8, 1u));
+            ASSERT(0 == Util::encode(buffer, 8, 1.0));
+            ASSERT(0 == Util::encode(buffer, LD - 1, 1.0L));
+            ASSERT(0 == Util::encode(buffer, 8, &value));
+            ASSERT(0 == Util::encode(buffer, 0, 1));
+
+            ASSERT(0 == Util::encode(buffer,
+                                     Util::k_MIN_STRING_LENGTH - 1,
+                                     "abc"));
+
+            for (bsl::size_t capacity  = Util::k_MIN_STRING_LENGTH;
+                             capacity <= Util::k_MIN_STRING_LENGTH + 5;
+                           ++capacity) {
+                const bsl::size_t EXP_LENGTH =
+                        bsl::min<bsl::size_t>(capacity - 6, 3);
+
+                ASSERTV(capacity,
+                        6 + EXP_LENGTH ==
+                                      Util::encode(buffer, capacity, "abc"));
+                ASSERTV(capacity,
+                        EXP_LENGTH == bsl::strlen(buffer + 5));
+
+                bsl::string result;
+                Util::render(&result, "%s", buffer, 6 + EXP_LENGTH);
+                ASSERTV(capacity,
+                        bsl::string("abc", EXP_LENGTH) == result);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing.
+        //
+        // Plan:
+        //: 1 Encode a few arguments, render a format, and verify the result.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        char        buffer[64];
+        bsl::size_t length = 0;
+
+        length += Util::encode(buffer + length, sizeof buffer - length, 1);
+        length += Util::encode(buffer + length, sizeof buffer - length, "b");
+        length += Util::encode(buffer + length, sizeof buffer - length, 2.5);
+
+        bsl::string result;
+        Util::render(&result, "%d %s %.1f", buffer, length);
+        ASSERTV(result, "1 b 2.5" == result);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,829 @@
+// ball_deferredlogger.cpp                                            -*-C++-*-
+#include <ball_deferredlogger.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredlogger_cpp,"$Id$ $CSID$")
+
+#include <ball_context.h>
+#include <ball_recordattributes.h>
+#include <ball_transmission.h>
+
+#include <bdlf_memfn.h>
+#include <bdls_processutil.h>
+#include <bdlt_currenttime.h>
+#include <bdlt_epochutil.h>
+
+#include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_once.h>
+#include <bslmt_threadattributes.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Each thread that captures records into a 'DeferredLogger' owns a
+// 'DeferredLogger_Ring', a single-producer, single-consumer ring buffer of
+// bytes.  The capturing thread is the only producer; the consumer is whichever
+// thread holds 'd_publishMutex' (normally the publication thread, but also
+// 'flush' and a capturing thread whose ring is full).  A ring holds a
+// sequence of entries, each comprising an 'EntryHeader' followed by the
+// encoded arguments of the record, and padded to a multiple of 8 bytes.  An
+// entry never straddles the end of the ring: if an entry does not fit before
+// the end, a header having a size of 0 marks the remainder of the ring as
+// padding and the entry is written at the beginning.  The read and write
+// indices increase monotonically, and are reduced modulo the (power of two)
+// capacity of the ring to obtain offsets.
+//
+// The ring of a thread is found through a single, process-wide,
+// thread-specific key (rather than a key per logger) so that the key, and
+// hence the cleanup function that runs on thread exit, remains valid for the
+// life of the process.  A ring is reference counted: one reference is held by
+// the thread (and released on thread exit, or when the thread captures into a
+// different logger), and one by the logger (and released when the logger
+// observes that the thread's reference has been released and the ring has been
+// drained, or when the logger is destroyed).  A ring (and its buffer) is
+// supplied by the global allocator, since the reference of a thread may be the
+// last one released, after the logger (and possibly the allocator of the
+// logger) has been destroyed.  A ring records the unique identifier of its
+// logger, so a ring left behind by a destroyed logger is never mistaken for
+// the ring of a new logger allocated at the same address.
+//
+// When a pass over the rings publishes no record, the publication thread sets
+// 'd_idleFlag', checks (again) that every ring is empty, and then waits on
+// 'd_idleSemaphore'.  After appending an entry to its ring, 'capture' posts
+// 'd_idleSemaphore' if it is the first to clear 'd_idleFlag'.  The store to
+// 'd_writeIndex' that makes an entry readable is sequentially consistent, as
+// are the accesses to 'd_idleFlag' and the load of 'd_writeIndex' by
+// 'isEmpty', so either the publication thread sees the entry or 'capture' sees
+// the flag, and an entry is never left in a ring while the publication thread
+// waits.  The flag is loaded before it is cleared, so that 'capture' performs
+// no read-modify-write operation on the flag (shared by all capturing
+// threads) unless the publication thread is idle.  A surplus post merely
+// causes one additional pass over the rings.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+enum {
+    k_ENTRY_ALIGNMENT = 8  // alignment of entries in a ring
+};
+
+static const char *const k_LOG_CATEGORY = "BALL.DEFERREDLOGGER";
+
+bsls::AtomicOperations::AtomicTypes::Pointer s_defaultLogger;
+    // the address of the default logger, or 0
+
+bsls::AtomicOperations::AtomicTypes::Uint64  s_lastLoggerId;
+    // the identifier most recently assigned to a logger
+
+bslmt::ThreadUtil::Key                        s_ringKey;
+    // the key of the thread-specific ring pointer
+
+struct EntryHeader {
+    // This 'struct' describes the fixed-size prefix of each entry in a ring.
+
+    unsigned int         d_size;             // size of the entry including
+                                             // header and padding; 0 denotes
+                                             // padding to the end of the ring
+    unsigned int         d_argumentsLength;  // size of encoded arguments
+    int                  d_severity;         // severity of the record
+    int                  d_lineNumber;       // source line number
+    bsls::Types::Int64   d_seconds;          // timestamp, seconds since epoch
+    int                  d_nanoseconds;      // timestamp, nanoseconds
+    const Category      *d_category_p;       // category of the record
+    const char          *d_fileName_p;       // source file name
+    const char          *d_format_p;         // 'printf' format
+};
+
+}  // close unnamed namespace
+
+                         // =========================
+                         // class DeferredLogger_Ring
+                         // =========================
+
+class DeferredLogger_Ring {
+    // This class implements a single-producer, single-consumer ring buffer of
+    // log record entries, shared by a capturing thread and a deferred logger.
+
+    // DATA
+    bsls::AtomicUint64   d_writeIndex;       // index of next byte to write;
+                                             // modified only by the producer
+
+    bsls::Types::Uint64  d_cachedReadIndex;  // producer's most recent
+                                             // observation of 'd_readIndex'
+
+    char                 d_producerPad[64];  // separate producer and consumer
+                                             // cache lines
+
+    bsls::AtomicUint64   d_readIndex;        // index of next byte to read;
+                                             // modified only by the consumer
+
+    char                 d_consumerPad[64];  // separate consumer data from
+                                             // shared data
+
+    bsls::AtomicInt      d_refCount;         // number of references (thread
+                                             // and logger)
+
+    bsls::Types::Uint64  d_loggerId;         // identifier of owning logger
+
+    bsls::Types::Uint64  d_threadId;         // identifier of capturing thread
+
+    bsl::size_t          d_capacity;         // size of 'd_buffer_p'; a power
+                                             // of two
+
+    char                *d_buffer_p;         // ring storage (owned)
+
+    bslma::Allocator    *d_allocator_p;      // memory allocator (held, not
+                                             // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    DeferredLogger_Ring(const DeferredLogger_Ring&);
+    DeferredLogger_Ring& operator=(const DeferredLogger_Ring&);
+
+  public:
+    // CLASS METHODS
+    static void release(DeferredLogger_Ring *ring);
+        // Release a reference to the specified 'ring', and destroy 'ring' and
+        // return its memory to its allocator if no references remain.
+
+    static void releaseOnThreadExit(void *ring);
+        // Release the reference of the exiting thread to the specified
+        // 'ring'.  Note that this function is the cleanup function of
+        // 's_ringKey'.
+
+    // CREATORS
+    DeferredLogger_Ring(bsls::Types::Uint64  loggerId,
+                        bsl::size_t          capacity,
+                        bslma::Allocator    *basicAllocator);
+        // Create a ring of the specified 'capacity' bytes, owned by the
+        // logger having the specified 'loggerId' and referenced by both that
+        // logger and the calling thread, using the specified 'basicAllocator'
+        // to supply memory.  The behavior is undefined unless 'capacity' is a
+        // power of two.
+
+    ~DeferredLogger_Ring();
+        // Destroy this object.
+
+    // MANIPULATORS
+    const char *front();
+        // Return the address of the first entry in this ring, or 0 if this
+        // ring is empty.  The behavior is undefined unless the calling thread
+        // is the consumer.
+
+    void popFront(unsigned int size);
+        // Remove from this ring the first entry, having the specified 'size'.
+        // The behavior is undefined unless the calling thread is the consumer
+        // and 'size' is the value returned by 'front'.
+
+    bool pushBack(EntryHeader *header,
+                  const char  *arguments,
+                  bsl::size_t  length);
+        // Append to this ring an entry having the specified 'header' and the
+        // specified 'arguments' of the specified 'length', and return 'true';
+        // or, if this ring has insufficient space, return 'false' with no
+        // effect.  Load the size of the entry into 'header->d_size'.  The
+        // behavior is undefined unless the calling thread is the producer.
+
+    // ACCESSORS
+    bool isAbandoned() const;
+        // Return 'true' if the capturing thread no longer references this
+        // ring, and 'false' otherwise.  The behavior is undefined unless the
+        // owning logger has not released its reference to this ring.
+
+    bool isEmpty() const;
+        // Return 'true' if every byte written to this ring has been read, and
+        // 'false' otherwise.
+
+    bsls::Types::Uint64 loggerId() const;
+        // Return the identifier of the logger that owns this ring.
+
+    bsls::Types::Uint64 threadId() const;
+        // Return the identifier of the thread that created this ring.
+};
+
+                         // -------------------------
+                         // class DeferredLogger_Ring
+                         // -------------------------
+
+// CLASS METHODS
+void DeferredLogger_Ring::release(DeferredLogger_Ring *ring)
+{
+    BSLS_ASSERT(ring);
+
+    if (0 == ring->d_refCount.subtractAcqRel(1)) {
+        bslma::Allocator *allocator = ring->d_allocator_p;
+        allocator->deleteObject(ring);
+    }
+}
+
+void DeferredLogger_Ring::releaseOnThreadExit(void *ring)
+{
+    if (ring) {
+        release(static_cast<DeferredLogger_Ring *>(ring));
+    }
+}
+
+// CREATORS
+DeferredLogger_Ring::DeferredLogger_Ring(bsls::Types::Uint64  loggerId,
+                                         bsl::size_t          capacity,
+                                         bslma::Allocator    *basicAllocator)
+: d_writeIndex(0)
+, d_cachedReadIndex(0)
+, d_readIndex(0)
+, d_refCount(2)
+, d_loggerId(loggerId)
+, d_threadId(bslmt::ThreadUtil::selfIdAsUint64())
+, d_capacity(capacity)
+, d_buffer_p(static_cast<char *>(basicAllocator->allocate(capacity)))
+, d_allocator_p(basicAllocator)
+{
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+}
+
+DeferredLogger_Ring::~DeferredLogger_Ring()
+{
+    d_allocator_p->deallocate(d_buffer_p);
+}
+
+// MANIPULATORS
+const char *DeferredLogger_Ring::front()
+{
+    bsls::Types::Uint64       readIndex  = d_readIndex.loadRelaxed();
+    const bsls::Types::Uint64 writeIndex = d_writeIndex.loadAcquire();
+
+    while (readIndex != writeIndex) {
+        const bsl::size_t offset = static_cast<bsl::size_t>(readIndex)
+                                 & (d_capacity - 1);
+        const char       *entry  = d_buffer_p + offset;
+
+        unsigned int size;
+        bsl::memcpy(&size, entry, sizeof size);
+
+        if (0 != size) {
+            return entry;                                             // RETURN
+        }
+
+        // Skip the padding at the end of the ring.
+
+        readIndex += d_capacity - offset;
+        d_readIndex.storeRelease(readIndex);
+    }
+    return 0;
+}
+
+void DeferredLogger_Ring::popFront(unsigned int size)
+{
+    d_readIndex.storeRelease(d_readIndex.loadRelaxed() + size);
+}
+
+bool DeferredLogger_Ring::pushBack(EntryHeader *header,
+                                   const char  *arguments,
+                                   bsl::size_t  length)
+{
+    BSLS_ASSERT(header);
+
+    const bsl::size_t size = (sizeof *header + length + k_ENTRY_ALIGNMENT - 1)
+                           & ~static_cast<bsl::size_t>(k_ENTRY_ALIGNMENT - 1);
+
+    bsls::Types::Uint64 writeIndex = d_writeIndex.loadRelaxed();
+    bsl::size_t         offset     = static_cast<bsl::size_t>(writeIndex)
+                                   & (d_capacity - 1);
+    const bsl::size_t   tail       = d_capacity - offset;
+    const bsl::size_t   required   = size <= tail ? size : tail + size;
+
+    if (writeIndex + required - d_cachedReadIndex > d_capacity) {
+        d_cachedReadIndex = d_readIndex.loadAcquire();
+        if (writeIndex + required - d_cachedReadIndex > d_capacity) {
+            return false;                                             // RETURN
+        }
+    }
+
+    if (size > tail) {
+        const unsigned int padding = 0;
+        bsl::memcpy(d_buffer_p + offset, &padding, sizeof padding);
+        writeIndex += tail;
+        offset      = 0;
+    }
+
+    header->d_size            = static_cast<unsigned int>(size);
+    header->d_argumentsLength = static_cast<unsigned int>(length);
+
+    bsl::memcpy(d_buffer_p + offset, header, sizeof *header);
+    bsl::memcpy(d_buffer_p + offset + sizeof *header, arguments, length);
+
+    // A sequentially consistent store, so that 'capture' observes
+    // 'd_idleFlag' only after the entry is visible (see implementation notes).
+
+    d_writeIndex = writeIndex + size;
+    return true;
+}
+
+// ACCESSORS
+bool DeferredLogger_Ring::isAbandoned() const
+{
+    return 1 == d_refCount.loadAcquire();
+}
+
+bool DeferredLogger_Ring::isEmpty() const
+{
+    // Load 'd_readIndex' first: it never exceeds 'd_writeIndex', so equal
+    // values mean that the ring was empty when 'd_writeIndex' was loaded.
+
+    const bsls::Types::Uint64 readIndex = d_readIndex.loadAcquire();
+
+    return readIndex == d_writeIndex;
+}
+
+bsls::Types::Uint64 DeferredLogger_Ring::loggerId() const
+{
+    return d_loggerId;
+}
+
+bsls::Types::Uint64 DeferredLogger_Ring::threadId() const
+{
+    return d_threadId;
+}
+
+namespace {
+
+const bslmt::ThreadUtil::Key& ringKey()
+    // Return the process-wide key of the thread-specific ring pointer,
+    // creating it on first use.
+{
+    BSLMT_ONCE_DO {
+        int rc = bslmt::ThreadUtil::createKey(
+                                    &s_ringKey,
+                                    &DeferredLogger_Ring::releaseOnThreadExit);
+        BSLS_ASSERT_OPT(0 == rc);
+        (void)rc;
+    }
+    return s_ringKey;
+}
+
+bsl::size_t roundUpToPowerOfTwo(bsl::size_t value)
+    // Return the smallest power of two that is not less than the specified
+    // 'value'.
+{
+    bsl::size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+                            // --------------------
+                            // class DeferredLogger
+                            // --------------------
+
+// CLASS METHODS
+DeferredLogger *DeferredLogger::defaultLogger()
+{
+    return static_cast<DeferredLogger *>(
+                      bsls::AtomicOperations::getPtrAcquire(&s_defaultLogger));
+}
+
+void DeferredLogger::setDefaultLogger(DeferredLogger *logger)
+{
+    bsls::AtomicOperations::setPtrRelease(&s_defaultLogger, logger);
+}
+
+// PRIVATE MANIPULATORS
+DeferredLogger_Ring *DeferredLogger::acquireRing()
+{
+    const bslmt::ThreadUtil::Key& key = ringKey();
+
+    DeferredLogger_Ring *ring = static_cast<DeferredLogger_Ring *>(
+                                          bslmt::ThreadUtil::getSpecific(key));
+
+    if (ring && d_id == ring->loggerId()) {
+        return ring;                                                  // RETURN
+    }
+
+    // The calling thread may release the last reference to the ring after
+    // this logger is destroyed (see implementation notes).
+
+    bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+    DeferredLogger_Ring *newRing = new (*allocator)
+                          DeferredLogger_Ring(d_id, d_bufferSize, allocator);
+
+    bslma::RawDeleterProctor<DeferredLogger_Ring, bslma::Allocator> proctor(
+                                                                    newRing,
+                                                                    allocator);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_ringsMutex);
+        d_rings.push_back(newRing);
+    }
+    proctor.release();
+
+    bslmt::ThreadUtil::setSpecific(key, newRing);
+
+    if (ring) {
+        // The calling thread previously captured into a different logger;
+        // release its reference to the ring of that logger.
+
+        DeferredLogger_Ring::release(ring);
+    }
+    return newRing;
+}
+
+void DeferredLogger::logDroppedMessageWarning(int numDropped)
+{
+    if (!d_record || 1 < d_record.use_count()) {
+        d_record.createInplace(d_allocator_p, d_allocator_p);
+    }
+
+    RecordAttributes& attributes = d_record->fixedFields();
+
+    attributes.setCategory(k_LOG_CATEGORY);
+    attributes.setFileName(__FILE__);
+    attributes.setLineNumber(__LINE__);
+    attributes.setSeverity(Severity::e_WARN);
+    attributes.setTimestamp(bdlt::CurrentTime::utc());
+    attributes.setProcessID(d_processId);
+    attributes.setThreadID(bslmt::ThreadUtil::selfIdAsUint64());
+    attributes.messageStreamBuf().pubseekpos(0);
+
+    bsl::ostream os(&attributes.messageStreamBuf());
+    os << "Dropped " << numDropped << " log records." << bsl::flush;
+
+    d_observer->publish(d_record, Context(Transmission::e_PASSTHROUGH, 0, 1));
+}
+
+int DeferredLogger::publishRing(DeferredLogger_Ring *ring)
+{
+    BSLS_ASSERT(ring);
+
+    int numPublished = 0;
+
+    while (const char *entry = ring->front()) {
+        EntryHeader header;
+        bsl::memcpy(&header, entry, sizeof header);
+
+        d_message.clear();
+        DeferredFormatUtil::render(&d_message,
+                                   header.d_format_p,
+                                   entry + sizeof header,
+                                   header.d_argumentsLength);
+
+        // The entry is no longer needed; make its space available to the
+        // capturing thread before publishing.
+
+        ring->popFront(header.d_size);
+
+        if (!d_record || 1 < d_record.use_count()) {
+            // The observer retains the previously published record.
+
+            d_record.createInplace(d_allocator_p, d_allocator_p);
+        }
+
+        RecordAttributes& attributes = d_record->fixedFields();
+
+        attributes.setCategory(header.d_category_p->categoryName());
+        attributes.setFileName(header.d_fileName_p);
+        attributes.setLineNumber(header.d_lineNumber);
+        attributes.setSeverity(header.d_severity);
+        attributes.setTimestamp(bdlt::EpochUtil::convertFromTimeInterval(
+                                  bsls::TimeInterval(header.d_seconds,
+                                                     header.d_nanoseconds)));
+        attributes.setProcessID(d_processId);
+        attributes.setThreadID(ring->threadId());
+        attributes.messageStreamBuf().pubseekpos(0);
+        attributes.messageStreamBuf().sputn(
+                            d_message.data(),
+                            static_cast<bsl::streamsize>(d_message.length()));
+
+        d_observer->publish(d_record,
+                            Context(Transmission::e_PASSTHROUGH, 0, 1));
+        ++numPublished;
+    }
+    return numPublished;
+}
+
+int DeferredLogger::publishRecords()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_ringsMutex);
+        d_ringsSnapshot.assign(d_rings.begin(), d_rings.end());
+    }
+
+    int numPublished = 0;
+
+    for (bsl::size_t i = 0; i < d_ringsSnapshot.size(); ++i) {
+        DeferredLogger_Ring *ring = d_ringsSnapshot[i];
+
+        // Determine whether the ring is abandoned *before* draining it, so
+        // that every record captured before the thread released the ring is
+        // published before the ring is reclaimed.
+
+        const bool isAbandoned = ring->isAbandoned();
+
+        numPublished += publishRing(ring);
+
+        if (isAbandoned) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_ringsMutex);
+                d_rings.erase(bsl::find(d_rings.begin(), d_rings.end(), ring));
+            }
+            DeferredLogger_Ring::release(ring);
+        }
+    }
+
+    if (0 < d_dropCount.loadRelaxed()) {
+        logDroppedMessageWarning(d_dropCount.swap(0));
+    }
+    return numPublished;
+}
+
+void DeferredLogger::publishThreadEntryPoint()
+{
+    while (!d_stopFlag) {
+        bool isIdle;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_publishMutex);
+
+            isIdle = 0 == publishRecords();
+
+            if (isIdle) {
+                // Announce that this thread is idle *before* checking the
+                // rings (including those registered since 'publishRecords'
+                // began) for the last time (see implementation notes).
+
+                d_idleFlag = true;
+
+                {
+                    bslmt::LockGuard<bslmt::Mutex> ringsGuard(&d_ringsMutex);
+                    d_ringsSnapshot.assign(d_rings.begin(), d_rings.end());
+                }
+
+                isIdle = !d_stopFlag;
+                for (bsl::size_t i = 0; isIdle && i < d_ringsSnapshot.size();
+                                                                         ++i) {
+                    isIdle = d_ringsSnapshot[i]->isEmpty();
+                }
+            }
+        }
+
+        if (isIdle) {
+            d_idleSemaphore.wait();
+        }
+        d_idleFlag = false;
+    }
+
+    // Publish the records captured before the thread was asked to stop.
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_publishMutex);
+    publishRecords();
+}
+
+// CREATORS
+DeferredLogger::DeferredLogger(const bsl::shared_ptr<Observer>& observer,
+                               bslma::Allocator                *basicAllocator)
+: d_observer(observer)
+, d_id(bsls::AtomicOperations::addUint64NvAcqRel(&s_lastLoggerId, 1))
+, d_bufferSize(k_DEFAULT_BUFFER_SIZE)
+, d_dropRecordsOnFullThreshold(Severity::e_OFF)
+, d_rings(basicAllocator)
+, d_ringsSnapshot(basicAllocator)
+, d_message(basicAllocator)
+, d_processId(bdls::ProcessUtil::getProcessId())
+, d_dropCount(0)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_stopFlag(false)
+, d_idleFlag(false)
+, d_idleSemaphore()
+, d_publishThreadEntryPoint(
+        bsl::allocator_arg_t(),
+        bsl::allocator<bsl::function<void()> >(basicAllocator),
+        bdlf::MemFnUtil::memFn(&DeferredLogger::publishThreadEntryPoint, this))
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+}
+
+DeferredLogger::DeferredLogger(const bsl::shared_ptr<Observer>& observer,
+                               bsl::size_t                      bufferSize,
+                               bslma::Allocator                *basicAllocator)
+: d_observer(observer)
+, d_id(bsls::AtomicOperations::addUint64NvAcqRel(&s_lastLoggerId, 1))
+, d_bufferSize(roundUpToPowerOfTwo(
+                      bsl::max<bsl::size_t>(bufferSize, k_MIN_BUFFER_SIZE)))
+, d_dropRecordsOnFullThreshold(Severity::e_OFF)
+, d_rings(basicAllocator)
+, d_ringsSnapshot(basicAllocator)
+, d_message(basicAllocator)
+, d_processId(bdls::ProcessUtil::getProcessId())
+, d_dropCount(0)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_stopFlag(false)
+, d_idleFlag(false)
+, d_idleSemaphore()
+, d_publishThreadEntryPoint(
+        bsl::allocator_arg_t(),
+        bsl::allocator<bsl::function<void()> >(basicAllocator),
+        bdlf::MemFnUtil::memFn(&DeferredLogger::publishThreadEntryPoint, this))
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+}
+
+DeferredLogger::DeferredLogger(
+                 const bsl::shared_ptr<Observer>&  observer,
+                 bsl::size_t                       bufferSize,
+                 Severity::Level                   dropRecordsOnFullThreshold,
+                 bslma::Allocator                 *basicAllocator)
+: d_observer(observer)
+, d_id(bsls::AtomicOperations::addUint64NvAcqRel(&s_lastLoggerId, 1))
+, d_bufferSize(roundUpToPowerOfTwo(
+                      bsl::max<bsl::size_t>(bufferSize, k_MIN_BUFFER_SIZE)))
+, d_dropRecordsOnFullThreshold(dropRecordsOnFullThreshold)
+, d_rings(basicAllocator)
+, d_ringsSnapshot(basicAllocator)
+, d_message(basicAllocator)
+, d_processId(bdls::ProcessUtil::getProcessId())
+, d_dropCount(0)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_stopFlag(false)
+, d_idleFlag(false)
+, d_idleSemaphore()
+, d_publishThreadEntryPoint(
+        bsl::allocator_arg_t(),
+        bsl::allocator<bsl::function<void()> >(basicAllocator),
+        bdlf::MemFnUtil::memFn(&DeferredLogger::publishThreadEntryPoint, this))
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+}
+
+DeferredLogger::~DeferredLogger()
+{
+    stopPublicationThread();
+    flush();
+
+    bsls::AtomicOperations::testAndSwapPtrAcqRel(&s_defaultLogger, this, 0);
+
+    // Release the reference of the calling thread to its ring (if any), so
+    // that the ring is reclaimed now rather than when the thread exits.
+
+    const bslmt::ThreadUtil::Key& key = ringKey();
+
+    DeferredLogger_Ring *ring = static_cast<DeferredLogger_Ring *>(
+                                          bslmt::ThreadUtil::getSpecific(key));
+    if (ring && d_id == ring->loggerId()) {
+        bslmt::ThreadUtil::setSpecific(key, 0);
+        DeferredLogger_Ring::release(ring);
+    }
+
+    for (bsl::size_t i = 0; i < d_rings.size(); ++i) {
+        DeferredLogger_Ring::release(d_rings[i]);
+    }
+}
+
+// MANIPULATORS
+void DeferredLogger::capture(const Category *category,
+                             int             severity,
+                             const char     *fileName,
+                             int             lineNumber,
+                             const char     *format,
+                             const char     *arguments,
+                             bsl::size_t     length)
+{
+    BSLS_ASSERT(category);
+    BSLS_ASSERT(fileName);
+    BSLS_ASSERT(format);
+    BSLS_ASSERT(length <= DeferredLogger_Capture::k_ARGUMENTS_CAPACITY);
+
+    DeferredLogger_Ring *ring = acquireRing();
+
+    const bsls::TimeInterval now = bsls::SystemTime::nowRealtimeClock();
+
+    EntryHeader header;
+    header.d_severity    = severity;
+    header.d_lineNumber  = lineNumber;
+    header.d_seconds     = now.seconds();
+    header.d_nanoseconds = now.nanoseconds();
+    header.d_category_p  = category;
+    header.d_fileName_p  = fileName;
+    header.d_format_p    = format;
+
+    if (!ring->pushBack(&header, arguments, length)) {
+        if (severity > d_dropRecordsOnFullThreshold) {
+            d_dropCount.addRelaxed(1);
+            return;                                                   // RETURN
+        }
+
+        // The ring is full: make room by publishing its records on this
+        // thread.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_publishMutex);
+        publishRing(ring);
+
+        bool rc = ring->pushBack(&header, arguments, length);
+        BSLS_ASSERT(rc);
+        (void)rc;
+    }
+
+    if (d_idleFlag && d_idleFlag.testAndSwap(true, false)) {
+        d_idleSemaphore.post();
+    }
+}
+
+void DeferredLogger::flush()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_publishMutex);
+    publishRecords();
+}
+
+int DeferredLogger::startPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadMutex);
+
+    if (bslmt::ThreadUtil::invalidHandle() == d_threadHandle) {
+        d_stopFlag.storeRelaxed(false);
+
+        bslmt::ThreadAttributes attr;
+        return bslmt::ThreadUtil::create(&d_threadHandle,
+                                         attr,
+                                         d_publishThreadEntryPoint);  // RETURN
+    }
+    return 0;
+}
+
+int DeferredLogger::stopPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadMutex);
+
+    if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
+        d_stopFlag = true;
+        d_idleSemaphore.post();
+
+        int rc = bslmt::ThreadUtil::join(d_threadHandle);
+        d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+        return rc;                                                    // RETURN
+    }
+    return 0;
+}
+
+                        // ----------------------------
+                        // class DeferredLogger_Capture
+                        // ----------------------------
+
+// CREATORS
+DeferredLogger_Capture::~DeferredLogger_Capture()
+{
+    DeferredLogger *logger = DeferredLogger::defaultLogger();
+
+    if (logger && d_category_p) {
+        logger->capture(d_category_p,
+                        d_severity,
+                        d_fileName_p,
+                        d_lineNumber,
+                        d_format_p,
+                        d_arguments,
+                        d_length);
+        return;                                                       // RETURN
+    }
+
+    // There is no deferred logger: format and log the record synchronously,
+    // as 'BALL_LOGVA' would.
+
+    bsl::string message;
+    DeferredFormatUtil::render(&message, d_format_p, d_arguments, d_length);
+
+    Record *record = Log::getRecord(d_category_p, d_fileName_p, d_lineNumber);
+    record->fixedFields().setMessage(message.c_str());
+    Log::logMessage(d_category_p, d_severity, record);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,665 @@
+// ball_deferredlogger.h                                              -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDLOGGER
+#define INCLUDED_BALL_DEFERREDLOGGER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a logger that defers message formatting to another thread.
+//
+//@CLASSES:
+//  ball::DeferredLogger: logger capturing 'printf' arguments for later use
+//
+//@MACROS:
+//  BALL_LOGDEFERRED(SEVERITY, MSG, ...): log 'MSG' deferring its formatting
+//  BALL_LOGDEFERRED_TRACE(MSG, ...): log at 'e_TRACE' deferring formatting
+//  BALL_LOGDEFERRED_DEBUG(MSG, ...): log at 'e_DEBUG' deferring formatting
+//  BALL_LOGDEFERRED_INFO(MSG, ...): log at 'e_INFO' deferring formatting
+//  BALL_LOGDEFERRED_WARN(MSG, ...): log at 'e_WARN' deferring formatting
+//  BALL_LOGDEFERRED_ERROR(MSG, ...): log at 'e_ERROR' deferring formatting
+//  BALL_LOGDEFERRED_FATAL(MSG, ...): log at 'e_FATAL' deferring formatting
+//
+//@SEE_ALSO: ball_deferredformatutil, ball_log, ball_asyncfileobserver
+//
+//@DESCRIPTION: This component provides a mechanism, 'ball::DeferredLogger',
+// and a suite of 'printf'-style macros that together move the cost of
+// formatting a log message, and of publishing the resulting record, off of
+// the logging thread.  A 'BALL_LOGDEFERRED_*' macro consults the category
+// thresholds of the logger manager singleton exactly as the corresponding
+// 'BALL_LOGVA_*' macro does.  If the record is to be logged, however, the
+// macro does not format the message; instead, it copies the format string
+// pointer, the source location, the severity, a timestamp, and a compact
+// binary encoding of each argument (see 'ball_deferredformatutil') into a
+// buffer owned by the calling thread.  A publication thread owned by the
+// 'ball::DeferredLogger' later renders each captured message, populates a
+// 'ball::Record', and publishes that record to the observer supplied at
+// construction (e.g., a 'ball::FileObserver', which formats the record
+// according to its 'ball::RecordStringFormatter').
+//
+// Deferred logging is appropriate for threads whose latency matters more
+// than the immediacy of their log output: the work done on the logging
+// thread is a threshold check, a handful of small copies, and a read of the
+// real-time clock.  It comes with the following restrictions:
+//
+//: o The format string must be a string literal (or otherwise outlive the
+//:   publication of the record), because only its address is captured.
+//:
+//: o Each argument must be of a type accepted by
+//:   'ball::DeferredFormatUtil::encode'.  The arguments are checked against
+//:   the format string at compile time (on compilers that support such
+//:   checking) exactly as for 'BALL_LOGVA'.  The characters of a string
+//:   argument are copied when the record is captured.
+//:
+//: o The arguments of a single record occupy at most
+//:   'DeferredLogger_Capture::k_ARGUMENTS_CAPACITY' bytes; a string argument
+//:   that does not fit is truncated, and a conversion for which no argument
+//:   fits is rendered verbatim.
+//:
+//: o A captured record is published directly to the observer whenever the
+//:   category is enabled for its severity (i.e., the "Pass" semantics of the
+//:   logger manager are applied to every such record).  Deferred records are
+//:   not stored in the record buffer of the logger manager, do not trigger
+//:   the publication of that buffer, and do not carry user fields.
+//:
+//: o The logger manager singleton (which owns the categories) must outlive
+//:   the publication of every captured record, so a 'ball::DeferredLogger'
+//:   must be destroyed (or flushed and its publication thread stopped) before
+//:   the logger manager is destroyed.
+//
+// The macros capture into the logger installed by 'setDefaultLogger'.  If no
+// default logger is installed, they format and log the message synchronously
+// through the logger manager, as 'BALL_LOGVA' does.
+//
+///Buffering and Ordering
+///----------------------
+// Each thread that captures records into a 'ball::DeferredLogger' is given
+// its own single-producer, single-consumer ring buffer of the size specified
+// at construction.  Capturing a record therefore involves no locking and no
+// contention with other threads.  The publication thread repeatedly visits
+// every ring, publishing the records it finds; when no records are found it
+// blocks until a thread captures a record.  Records captured by a single
+// thread are published in the order in which they were captured; no order is
+// imposed on records captured by different threads (though each record
+// carries its capture timestamp).
+//
+// The rings are supplied by the global allocator (see
+// 'bslma::Default::globalAllocator'), not by the allocator of the logger,
+// since a thread may exit after the logger is destroyed.  The ring of a thread
+// that exits while the logger exists is reclaimed once the records remaining
+// in the ring have been published (the next time the publication thread, or
+// 'flush', visits the rings); otherwise, the ring is reclaimed when the logger
+// is destroyed, or, if the thread is still running then, when the thread
+// exits.
+//
+// If a thread's ring is full when a record is captured, the record is dropped
+// if its severity is less severe than the "drop threshold" supplied at
+// construction; otherwise the capturing thread itself publishes the records
+// in its ring to make room, which blocks the thread for the time it takes to
+// do so.  As for 'ball::AsyncFileObserver', the default drop threshold is
+// 'ball::Severity::e_OFF', so that by default every record captured into a
+// full ring is dropped; a drop threshold of 'ball::Severity::e_TRACE' ensures
+// that no record is dropped.  The number of dropped records is reported by a
+// 'e_WARN' record published to the observer.
+//
+///Thread Safety
+///-------------
+// 'ball::DeferredLogger' is fully thread-safe, meaning that all
+// non-creator methods can be safely called from multiple threads
+// concurrently.  The observer supplied at construction is invoked by at most
+// one thread at a time.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Logging from a Latency-Sensitive Thread
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that an order-processing thread must log each order that it
+// handles, but must not spend the time required to format those messages.
+//
+// First, we initialize the logger manager singleton, which supplies the
+// category thresholds consulted by the 'BALL_LOGDEFERRED' macros:
+//..
+//  ball::LoggerManagerConfiguration configuration;
+//  configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_WARN,
+//                                                 ball::Severity::e_INFO,
+//                                                 ball::Severity::e_OFF,
+//                                                 ball::Severity::e_OFF);
+//
+//  ball::LoggerManagerScopedGuard guard(configuration);
+//..
+// Then, we create the observer to which deferred records are published, and
+// a deferred logger, which we install as the default logger used by the
+// macros:
+//..
+//  bsl::shared_ptr<ball::TestObserver> observer(
+//                                        new ball::TestObserver(&bsl::cout));
+//
+//  ball::DeferredLogger logger(observer);
+//  ball::DeferredLogger::setDefaultLogger(&logger);
+//
+//  int rc = logger.startPublicationThread();
+//  assert(0 == rc);
+//..
+// Next, the order-processing thread logs an order using the deferred
+// analogue of 'BALL_LOGVA_INFO'.  Only the arguments are copied here:
+//..
+//  BALL_LOG_SET_CATEGORY("ORDERS");
+//
+//  BALL_LOGDEFERRED_INFO("order %d: %s %u @ %.2f", 12345, "BUY", 100u, 99.5);
+//..
+// Finally, we stop the publication thread, which publishes every captured
+// record before returning, and uninstall the default logger:
+//..
+//  logger.stopPublicationThread();
+//
+//  assert(1 == observer->numPublishedRecords());
+//  assert(0 == bsl::strcmp("order 12345: BUY 100 @ 99.50",
+//                          observer->lastPublishedRecord().fixedFields()
+//                                                             .message()));
+//
+//  ball::DeferredLogger::setDefaultLogger(0);
+//..
+
+#include <balscm_version.h>
+
+#include <ball_category.h>
+#include <ball_deferredformatutil.h>
+#include <ball_log.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_severity.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+                        // =========================
+                        // Deferred 'printf' Macros
+                        // =========================
+
+#define BALL_LOGDEFERRED(SEVERITY, ...)                                       \
+do {                                                                          \
+    const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =        \
+                         ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER); \
+    if (ball_log_cAtEgOrYhOlDeR->threshold() >= (SEVERITY) &&                 \
+           BloombergLP::ball::Log::isCategoryEnabled(ball_log_cAtEgOrYhOlDeR, \
+                                                     (SEVERITY))) {           \
+        BloombergLP::ball::DeferredLogger_Capture ball_log_cApTuRe(           \
+                                       ball_log_cAtEgOrYhOlDeR->category(),   \
+                                       __FILE__,                              \
+                                       __LINE__,                              \
+                                       (SEVERITY));                           \
+        (void)(ball_log_cApTuRe << __VA_ARGS__);                              \
+        if (false) {                                                          \
+            BloombergLP::ball::Log::format(0, 0, __VA_ARGS__);                \
+        }                                                                     \
+    }                                                                         \
+} while(0)
+
+#define BALL_LOGDEFERRED_TRACE(...)                                           \
+    BALL_LOGDEFERRED_CONST_IMP(BloombergLP::ball::Severity::e_TRACE,          \
+                               __VA_ARGS__)
+
+#define BALL_LOGDEFERRED_DEBUG(...)                                           \
+    BALL_LOGDEFERRED_CONST_IMP(BloombergLP::ball::Severity::e_DEBUG,          \
+                               __VA_ARGS__)
+
+#define BALL_LOGDEFERRED_INFO( ...)                                           \
+    BALL_LOGDEFERRED_CONST_IMP(BloombergLP::ball::Severity::e_INFO,           \
+                               __VA_ARGS__)
+
+#define BALL_LOGDEFERRED_WARN( ...)                                           \
+    BALL_LOGDEFERRED_CONST_IMP(BloombergLP::ball::Severity::e_WARN,           \
+                               __VA_ARGS__)
+
+#define BALL_LOGDEFERRED_ERROR(...)                                           \
+    BALL_LOGDEFERRED_CONST_IMP(BloombergLP::ball::Severity::e_ERROR,          \
+                               __VA_ARGS__)
+
+#define BALL_LOGDEFERRED_FATAL(...)                                           \
+    BALL_LOGDEFERRED_CONST_IMP(BloombergLP::ball::Severity::e_FATAL,          \
+                               __VA_ARGS__)
+
+                 // ====================================
+                 // Implementation Details: Do *NOT* Use
+                 // ====================================
+
+// BALL_LOGDEFERRED_CONST_IMP requires its first argument to be a compile-time
+// constant, while all the others may be variables.  The first argument of
+// '__VA_ARGS__' (the format) is consumed by 'operator<<', and each of the
+// remaining arguments by 'operator,', of 'DeferredLogger_Capture'.  The
+// unevaluated call to 'Log::format' allows the compiler to check the
+// arguments against the format.
+
+#define BALL_LOGDEFERRED_CONST_IMP(SEVERITY, ...)                             \
+do {                                                                          \
+    if (const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =    \
+               BloombergLP::ball::Log::categoryHolderIfEnabled<(SEVERITY)>(   \
+                      ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER))) { \
+        BloombergLP::ball::DeferredLogger_Capture ball_log_cApTuRe(           \
+                                       ball_log_cAtEgOrYhOlDeR->category(),   \
+                                       __FILE__,                              \
+                                       __LINE__,                              \
+                                       (SEVERITY));                           \
+        (void)(ball_log_cApTuRe << __VA_ARGS__);                              \
+        if (false) {                                                          \
+            BloombergLP::ball::Log::format(0, 0, __VA_ARGS__);                \
+        }                                                                     \
+    }                                                                         \
+} while(0)
+
+namespace BloombergLP {
+namespace ball {
+
+class DeferredLogger_Ring;
+
+                            // ====================
+                            // class DeferredLogger
+                            // ====================
+
+class DeferredLogger {
+    // This class captures log records, with their 'printf'-style arguments in
+    // an unformatted binary form, into per-thread ring buffers, and renders
+    // and publishes those records to an observer on a separate publication
+    // thread.  This class is fully thread-safe.
+
+    // DATA
+    bsl::shared_ptr<Observer>           d_observer;       // destination of
+                                                          // published records
+
+    bsls::Types::Uint64                 d_id;             // unique identifier
+                                                          // of this logger
+
+    bsl::size_t                         d_bufferSize;     // size (in bytes) of
+                                                          // each thread's ring
+
+    Severity::Level                     d_dropRecordsOnFullThreshold;
+                                                          // records with
+                                                          // severity below
+                                                          // this threshold are
+                                                          // dropped when a
+                                                          // ring is full
+
+    bsl::vector<DeferredLogger_Ring *>  d_rings;          // rings of all
+                                                          // threads that have
+                                                          // captured records
+
+    bslmt::Mutex                        d_ringsMutex;     // protects 'd_rings'
+
+    bsl::vector<DeferredLogger_Ring *>  d_ringsSnapshot;  // rings visited by
+                                                          // the current
+                                                          // 'publishRecords'
+
+    bslmt::Mutex                        d_publishMutex;   // serialize
+                                                          // publication
+
+    bsl::shared_ptr<Record>             d_record;         // record reused for
+                                                          // publication when
+                                                          // not shared
+
+    bsl::string                         d_message;        // scratch space for
+                                                          // rendered messages
+
+    int                                 d_processId;      // cached process id
+
+    bsls::AtomicInt                     d_dropCount;      // number of dropped
+                                                          // records; reset to
+                                                          // 0 each time the
+                                                          // count is published
+
+    bslmt::ThreadUtil::Handle           d_threadHandle;   // handle of the
+                                                          // publication thread
+
+    bsls::AtomicBool                    d_stopFlag;       // 'true' if the
+                                                          // publication thread
+                                                          // should stop
+
+    bsls::AtomicBool                    d_idleFlag;       // 'true' if the
+                                                          // publication thread
+                                                          // found the rings
+                                                          // empty and waits
+                                                          // (or is about to
+                                                          // wait) on
+                                                          // 'd_idleSemaphore'
+
+    bslmt::Semaphore                    d_idleSemaphore;  // posted to wake an
+                                                          // idle publication
+                                                          // thread
+
+    bsl::function<void()>               d_publishThreadEntryPoint;
+                                                          // publication thread
+                                                          // entry point
+
+    bslmt::Mutex                        d_threadMutex;    // serialize starting
+                                                          // and stopping
+
+    bslma::Allocator                   *d_allocator_p;    // memory allocator
+                                                          // (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    DeferredLogger(const DeferredLogger&);
+    DeferredLogger& operator=(const DeferredLogger&);
+
+    // PRIVATE MANIPULATORS
+    DeferredLogger_Ring *acquireRing();
+        // Return the address of the ring of the calling thread for this
+        // logger, creating and registering it if necessary.
+
+    void logDroppedMessageWarning(int numDropped);
+        // Publish to the observer a record indicating that the specified
+        // 'numDropped' records have been dropped since the last such warning
+        // was published.  The behavior is undefined unless the calling thread
+        // holds a lock on 'd_publishMutex'.
+
+    int publishRing(DeferredLogger_Ring *ring);
+        // Publish every record in the specified 'ring', and return the number
+        // of records published.  The behavior is undefined unless the calling
+        // thread holds a lock on 'd_publishMutex'.
+
+    int publishRecords();
+        // Publish every record in the ring of every thread, reclaim the rings
+        // of threads that have exited, publish the count of dropped records
+        // (if any), and return the number of records published.  The behavior
+        // is undefined unless the calling thread holds a lock on
+        // 'd_publishMutex'.
+
+    void publishThreadEntryPoint();
+        // Publish records until signaled to stop, blocking on
+        // 'd_idleSemaphore' while every ring is empty, and then publish the
+        // records that remain.  Note that this function is the entry point
+        // for the publication thread.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_DEFAULT_BUFFER_SIZE = 64 * 1024,  // default per-thread ring size
+
+        k_MIN_BUFFER_SIZE     =  4 * 1024   // minimum per-thread ring size
+    };
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DeferredLogger, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static DeferredLogger *defaultLogger();
+        // Return the address of the logger installed by 'setDefaultLogger',
+        // or 0 if no logger is installed.
+
+    static void setDefaultLogger(DeferredLogger *logger);
+        // Install the specified 'logger' as the logger into which the
+        // 'BALL_LOGDEFERRED' macros capture records, or uninstall the current
+        // default logger if 'logger' is 0.  The behavior is undefined if this
+        // method is called while another thread is using the
+        // 'BALL_LOGDEFERRED' macros, or unless 'logger' is 0 or remains valid
+        // until it is uninstalled.  Note that the destructor of the default
+        // logger uninstalls it.
+
+    // CREATORS
+    explicit
+    DeferredLogger(const bsl::shared_ptr<Observer>&  observer,
+                   bslma::Allocator                 *basicAllocator = 0);
+    DeferredLogger(const bsl::shared_ptr<Observer>&  observer,
+                   bsl::size_t                       bufferSize,
+                   bslma::Allocator                 *basicAllocator = 0);
+    DeferredLogger(
+                 const bsl::shared_ptr<Observer>&  observer,
+                 bsl::size_t                       bufferSize,
+                 Severity::Level                   dropRecordsOnFullThreshold,
+                 bslma::Allocator                 *basicAllocator = 0);
+        // Create a deferred logger that publishes records to the specified
+        // 'observer', giving each thread that captures records a ring buffer
+        // of the optionally specified 'bufferSize' bytes, rounded up to a
+        // power of two.  If 'bufferSize' is not specified,
+        // 'k_DEFAULT_BUFFER_SIZE' is used; a 'bufferSize' smaller than
+        // 'k_MIN_BUFFER_SIZE' is taken to be 'k_MIN_BUFFER_SIZE'.  Optionally
+        // specify a 'dropRecordsOnFullThreshold' below which records are
+        // dropped (rather than the capturing thread publishing the records in
+        // its ring) when the ring of the capturing thread is full.  If
+        // 'dropRecordsOnFullThreshold' is not specified, 'Severity::e_OFF' is
+        // used (i.e., all such records are dropped).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  Note that the
+        // rings of the capturing threads, which may outlive this object, are
+        // supplied by the global allocator.  Also note that the publication
+        // thread is not started by this constructor.
+
+    ~DeferredLogger();
+        // Stop the publication thread (if any), publish all captured records,
+        // uninstall this logger if it is the default logger, and destroy this
+        // object.  The behavior is undefined if any thread captures a record
+        // into this logger during or after its destruction.  Note that the
+        // ring of a thread (other than the calling thread) that captured
+        // records into this logger is returned to the global allocator only
+        // when that thread exits or captures a record into another logger.
+
+    // MANIPULATORS
+    void capture(const Category *category,
+                 int             severity,
+                 const char     *fileName,
+                 int             lineNumber,
+                 const char     *format,
+                 const char     *arguments,
+                 bsl::size_t     length);
+        // Capture into the ring of the calling thread a record having the
+        // specified 'category', 'severity', 'fileName', and 'lineNumber', the
+        // current time as its timestamp, and a message to be rendered by
+        // 'DeferredFormatUtil::render' from the specified 'format' and the
+        // specified 'arguments' of the specified 'length'.  If the ring is
+        // full, drop the record if 'severity' is less severe than the drop
+        // threshold, and publish the records in the ring to make room
+        // otherwise.  The behavior is undefined unless 'category', 'fileName',
+        // and 'format' remain valid until the record is published,
+        // 'arguments' holds the concatenation of the bytes written by a
+        // sequence of calls to 'DeferredFormatUtil::encode', and 'length' is
+        // at most 'DeferredLogger_Capture::k_ARGUMENTS_CAPACITY'.
+
+    void flush();
+        // Publish every record captured (by any thread) before this method
+        // was called.
+
+    int startPublicationThread();
+        // Start a publication thread to publish captured records.  If a
+        // publication thread is already active, this operation has no effect.
+        // Return 0 on success, and a non-zero value otherwise.
+
+    int stopPublicationThread();
+        // Stop the publication thread after every record captured before this
+        // method was called has been published.  If there is no publication
+        // thread this operation has no effect.  Return 0 on success, and a
+        // non-zero value if there is an error joining the publication thread.
+
+    // ACCESSORS
+    bsl::size_t bufferSize() const;
+        // Return the size (in bytes) of the ring buffer of each thread that
+        // captures records into this logger.
+
+    Severity::Level dropRecordsOnFullThreshold() const;
+        // Return the severity threshold below which records are dropped when
+        // the ring of the capturing thread is full.
+
+    bool isPublicationThreadRunning() const;
+        // Return 'true' if a publication thread is running, and 'false'
+        // otherwise.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the memory allocator used by this object.
+};
+
+                        // ============================
+                        // class DeferredLogger_Capture
+                        // ============================
+
+class DeferredLogger_Capture {
+    // This class, used only by the 'BALL_LOGDEFERRED' macros, accumulates the
+    // format and the encoded arguments of a single record, and captures the
+    // record into the default deferred logger upon destruction.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_ARGUMENTS_CAPACITY = 512  // maximum size (in bytes) of the encoded
+                                    // arguments of a record
+    };
+
+  private:
+    // DATA
+    const Category *d_category_p;                    // category of the record
+    const char     *d_fileName_p;                    // source file name
+    int             d_lineNumber;                    // source line number
+    int             d_severity;                      // severity of the record
+    const char     *d_format_p;                      // 'printf' format
+    bsl::size_t     d_length;                        // bytes of 'd_arguments'
+                                                     // in use
+    bsl::size_t     d_capacity;                      // bytes of 'd_arguments'
+                                                     // available; 0 once an
+                                                     // argument did not fit
+    char            d_arguments[k_ARGUMENTS_CAPACITY];
+                                                     // encoded arguments
+
+    // NOT IMPLEMENTED
+    DeferredLogger_Capture(const DeferredLogger_Capture&);
+    DeferredLogger_Capture& operator=(const DeferredLogger_Capture&);
+
+  public:
+    // CREATORS
+    DeferredLogger_Capture(const Category *category,
+                           const char     *fileName,
+                           int             lineNumber,
+                           int             severity);
+        // Create a capture object for a record having the specified
+        // 'category', 'fileName', 'lineNumber', and 'severity'.
+
+    ~DeferredLogger_Capture();
+        // Capture the record accumulated by this object into the default
+        // deferred logger, or, if there is no default logger, format the
+        // record and log it synchronously via 'Log::logMessage'.
+
+    // MANIPULATORS
+    DeferredLogger_Capture& operator<<(const char *format);
+        // Set the format of the record to the specified 'format', and return
+        // a reference providing modifiable access to this object.
+
+    template <class TYPE>
+    DeferredLogger_Capture& operator,(const TYPE& value);
+        // Append the specified 'value' to the arguments of the record, and
+        // return a reference providing modifiable access to this object.  If
+        // 'value' does not fit, it and all subsequent arguments are ignored
+        // (except that a string is truncated to fit).
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class DeferredLogger_Capture
+                        // ----------------------------
+
+// CREATORS
+inline
+DeferredLogger_Capture::DeferredLogger_Capture(const Category *category,
+                                               const char     *fileName,
+                                               int             lineNumber,
+                                               int             severity)
+: d_category_p(category)
+, d_fileName_p(fileName)
+, d_lineNumber(lineNumber)
+, d_severity(severity)
+, d_format_p("")
+, d_length(0)
+, d_capacity(k_ARGUMENTS_CAPACITY)
+{
+}
+
+// MANIPULATORS
+inline
+DeferredLogger_Capture& DeferredLogger_Capture::operator<<(const char *format)
+{
+    d_format_p = format;
+    return *this;
+}
+
+template <class TYPE>
+inline
+DeferredLogger_Capture& DeferredLogger_Capture::operator,(const TYPE& value)
+{
+    const bsl::size_t length = DeferredFormatUtil::encode(
+                                                        d_arguments + d_length,
+                                                        d_capacity - d_length,
+                                                        value);
+    if (0 == length) {
+        d_capacity = d_length;
+    }
+    d_length += length;
+    return *this;
+}
+
+                            // --------------------
+                            // class DeferredLogger
+                            // --------------------
+
+// ACCESSORS
+inline
+bsl::size_t DeferredLogger::bufferSize() const
+{
+    return d_bufferSize;
+}
+
+inline
+Severity::Level DeferredLogger::dropRecordsOnFullThreshold() const
+{
+    return d_dropRecordsOnFullThreshold;
+}
+
+inline
+bool DeferredLogger::isPublicationThreadRunning() const
+{
+    return bslmt::ThreadUtil::invalidHandle() != d_threadHandle;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *DeferredLogger::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
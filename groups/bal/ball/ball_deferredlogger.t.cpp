@@ -0,0 +1,1297 @@
+// ball_deferredlogger.t.cpp                                          -*-C++-*-
+#include <ball_deferredlogger.h>
+
+#include <ball_asyncfileobserver.h>
+#include <ball_context.h>
+#include <ball_fileobserver.h>
+#include <ball_log.h>
+#include <ball_loggermanager.h>
+#include <ball_loggermanagerconfiguration.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_testobserver.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_processutil.h>
+#include <bdlt_currenttime.h>
+#include <bdlt_datetime.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                TEST PLAN
+//-----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// The component under test is a mechanism that captures log records into
+// per-thread ring buffers and publishes them to an observer, together with a
+// suite of macros that capture into the default such mechanism.  We verify
+// the fields of published records using an observer that retains every record
+// it receives, verify that records captured by each thread are published in
+// order when several threads capture concurrently, verify the behavior when a
+// ring is full (both with and without a drop threshold), and verify that the
+// rings of exited threads are reclaimed.  The macros are verified to respect
+// the category thresholds and to fall back to synchronous logging when no
+// default logger is installed.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] DeferredLogger *defaultLogger();
+// [ 2] void setDefaultLogger(DeferredLogger *logger);
+//
+// CREATORS
+// [ 5] DeferredLogger(const shared_ptr<Observer>&, Allocator *);
+// [ 5] DeferredLogger(const shared_ptr<Observer>&, size_t, Allocator *);
+// [ 5] DeferredLogger(const shared_ptr<Observer>&, size_t, Level, Alloc *);
+// [ 5] ~DeferredLogger();
+//
+// MANIPULATORS
+// [ 2] void capture(const Category *, int, const char *, int, ...);
+// [ 3] void flush();
+// [ 5] int startPublicationThread();
+// [ 5] int stopPublicationThread();
+//
+// ACCESSORS
+// [ 5] size_t bufferSize() const;
+// [ 5] Severity::Level dropRecordsOnFullThreshold() const;
+// [ 5] bool isPublicationThreadRunning() const;
+// [ 5] bslma::Allocator *allocator() const;
+//
+// MACROS
+// [ 2] BALL_LOGDEFERRED(SEVERITY, MSG, ...)
+// [ 2] BALL_LOGDEFERRED_TRACE(MSG, ...)
+// [ 2] BALL_LOGDEFERRED_DEBUG(MSG, ...)
+// [ 2] BALL_LOGDEFERRED_INFO(MSG, ...)
+// [ 2] BALL_LOGDEFERRED_WARN(MSG, ...)
+// [ 2] BALL_LOGDEFERRED_ERROR(MSG, ...)
+// [ 2] BALL_LOGDEFERRED_FATAL(MSG, ...)
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENCY TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: LATENCY DISTRIBUTION
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::DeferredLogger Obj;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+struct PublishedRecord {
+    // This 'struct' holds the fields of a published record that are of
+    // interest to this test driver.
+
+    bsl::string         d_category;
+    bsl::string         d_fileName;
+    int                 d_lineNumber;
+    int                 d_severity;
+    bsls::Types::Uint64 d_threadId;
+    int                 d_processId;
+    bdlt::Datetime      d_timestamp;
+    bsl::string         d_message;
+};
+
+class CollectingObserver : public ball::Observer {
+    // This class implements the 'ball::Observer' protocol by retaining the
+    // fields of every record it is given.
+
+    // DATA
+    bsl::vector<PublishedRecord> d_records;
+    mutable bslmt::Mutex         d_mutex;
+
+  public:
+    // CREATORS
+    CollectingObserver()
+    {
+    }
+
+    ~CollectingObserver()
+    {
+    }
+
+    // MANIPULATORS
+    using ball::Observer::publish;
+
+    void publish(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context&                       context)
+    {
+        publish(*record, context);
+    }
+
+    void publish(const ball::Record& record, const ball::Context&)
+    {
+        const ball::RecordAttributes& attributes = record.fixedFields();
+
+        PublishedRecord published;
+        published.d_category   = attributes.category();
+        published.d_fileName   = attributes.fileName();
+        published.d_lineNumber = attributes.lineNumber();
+        published.d_severity   = attributes.severity();
+        published.d_threadId   = attributes.threadID();
+        published.d_processId  = attributes.processID();
+        published.d_timestamp  = attributes.timestamp();
+        published.d_message    = attributes.messageRef();
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_records.push_back(published);
+    }
+
+    void reset()
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_records.clear();
+    }
+
+    // ACCESSORS
+    int numRecords() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return static_cast<int>(d_records.size());
+    }
+
+    PublishedRecord record(int index) const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_records[index];
+    }
+};
+
+class SilentObserver : public ball::Observer {
+    // This class implements the 'ball::Observer' protocol by discarding
+    // every record it is given.
+
+  public:
+    // MANIPULATORS
+    using ball::Observer::publish;
+
+    void publish(const ball::Record&, const ball::Context&)
+    {
+    }
+};
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                      CONCURRENCY TEST (CASE 4)
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_4 {
+
+enum {
+    k_NUM_THREADS           = 6,
+    k_NUM_RECORDS_PER_THREAD = 20000
+};
+
+struct Capturer {
+    // This functor captures 'k_NUM_RECORDS_PER_THREAD' records identifying
+    // the thread and the sequence number of each record.
+
+    int d_threadIndex;
+
+    void operator()() const
+    {
+        BALL_LOG_SET_CATEGORY("TEST.CONCURRENCY");
+
+        for (int i = 0; i < k_NUM_RECORDS_PER_THREAD; ++i) {
+            BALL_LOGDEFERRED_INFO("%d %d %s", d_threadIndex, i, "abc");
+        }
+    }
+};
+
+struct OutlivingCapturer {
+    // This functor captures a record, posts 'd_captured_p', and returns once
+    // 'd_destroyed_p' has been posted.
+
+    bslmt::Semaphore *d_captured_p;
+    bslmt::Semaphore *d_destroyed_p;
+
+    void operator()() const
+    {
+        BALL_LOG_SET_CATEGORY("TEST.CONCURRENCY");
+
+        BALL_LOGDEFERRED_INFO("%s", "outliving");
+
+        d_captured_p->post();
+        d_destroyed_p->wait();
+    }
+};
+
+}  // close namespace TEST_CASE_4
+
+//=============================================================================
+//                      PERFORMANCE TEST (CASE -1)
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_MINUS_1 {
+
+void reportLatencies(const char                      *label,
+                     bsl::vector<bsls::Types::Int64> *latencies)
+    // Sort the specified 'latencies' (in nanoseconds) and print a summary of
+    // their distribution, identified by the specified 'label'.
+{
+    bsl::sort(latencies->begin(), latencies->end());
+
+    const bsl::size_t n = latencies->size();
+
+    bsl::printf("%-28s p50 %6lld  p90 %6lld  p99 %6lld  p99.9 %7lld"
+                "  max %8lld (ns)\n",
+                label,
+                static_cast<long long>((*latencies)[n / 2]),
+                static_cast<long long>((*latencies)[n * 9 / 10]),
+                static_cast<long long>((*latencies)[n * 99 / 100]),
+                static_cast<long long>((*latencies)[n * 999 / 1000]),
+                static_cast<long long>((*latencies)[n - 1]));
+}
+
+}  // close namespace TEST_CASE_MINUS_1
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test        = argc > 1 ? atoi(argv[1]) : 0;
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::Default::setDefaultAllocator(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file
+        //:   compiles, links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bsl::ostringstream out;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Logging from a Latency-Sensitive Thread
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that an order-processing thread must log each order that it
+// handles, but must not spend the time required to format those messages.
+//
+// First, we initialize the logger manager singleton, which supplies the
+// category thresholds consulted by the 'BALL_LOGDEFERRED' macros:
+//..
+    ball::LoggerManagerConfiguration configuration;
+    configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_WARN,
+                                                   ball::Severity::e_INFO,
+                                                   ball::Severity::e_OFF,
+                                                   ball::Severity::e_OFF);
+
+    ball::LoggerManagerScopedGuard guard(configuration);
+//..
+// Then, we create the observer to which deferred records are published, and
+// a deferred logger, which we install as the default logger used by the
+// macros:
+//..
+    bsl::shared_ptr<ball::TestObserver> observer(
+                                          new ball::TestObserver(&out));
+
+    ball::DeferredLogger logger(observer);
+    ball::DeferredLogger::setDefaultLogger(&logger);
+
+    int rc = logger.startPublicationThread();
+    ASSERT(0 == rc);
+//..
+// Next, the order-processing thread logs an order using the deferred
+// analogue of 'BALL_LOGVA_INFO'.  Only the arguments are copied here:
+//..
+    BALL_LOG_SET_CATEGORY("ORDERS");
+
+    BALL_LOGDEFERRED_INFO("order %d: %s %u @ %.2f", 12345, "BUY", 100u, 99.5);
+//..
+// Finally, we stop the publication thread, which publishes every captured
+// record before returning, and uninstall the default logger:
+//..
+    logger.stopPublicationThread();
+
+    ASSERT(1 == observer->numPublishedRecords());
+    ASSERT(0 == bsl::strcmp("order 12345: BUY 100 @ 99.50",
+                            observer->lastPublishedRecord().fixedFields()
+                                                               .message()));
+
+    ball::DeferredLogger::setDefaultLogger(0);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CREATORS, PUBLICATION THREAD, AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor sets the buffer size (rounded up to a power of
+        //:   two and at least 'k_MIN_BUFFER_SIZE') and the drop threshold,
+        //:   and uses the supplied allocator.
+        //:
+        //: 2 The publication thread publishes captured records without a
+        //:   call to 'flush', and 'stopPublicationThread' publishes all
+        //:   records captured before it was called.
+        //:
+        //: 3 Starting a running thread, or stopping a stopped thread, has no
+        //:   effect, and the thread can be restarted.
+        //:
+        //: 4 The destructor publishes every captured record, uninstalls the
+        //:   logger if it is the default, and releases all memory.
+        //:
+        //: 5 A record captured while the publication thread is idle is
+        //:   published without stopping the publication thread.
+        //
+        // Plan:
+        //: 1 Construct loggers with each constructor and verify the
+        //:   accessors.  (C-1)
+        //:
+        //: 2 Capture records with and without a running publication thread,
+        //:   starting and stopping the thread repeatedly, and verify the
+        //:   published records.  (C-2..3)
+        //:
+        //: 3 Destroy a logger with captured, unpublished records, and verify
+        //:   that they are published, the default logger is uninstalled, and
+        //:   the test allocator reports no memory in use.  (C-4)
+        //:
+        //: 4 Repeatedly let the publication thread become idle, capture a
+        //:   record, and verify that the record is published while the
+        //:   publication thread is still running.  (C-5)
+        //
+        // Testing:
+        //   DeferredLogger(const shared_ptr<Observer>&, Allocator *);
+        //   DeferredLogger(const shared_ptr<Observer>&, size_t, Allocator *);
+        //   DeferredLogger(const shared_ptr<Observer>&, size_t, Level, ...);
+        //   ~DeferredLogger();
+        //   int startPublicationThread();
+        //   int stopPublicationThread();
+        //   size_t bufferSize() const;
+        //   Severity::Level dropRecordsOnFullThreshold() const;
+        //   bool isPublicationThreadRunning() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "CREATORS, PUBLICATION THREAD, AND ACCESSORS" << endl
+                 << "===========================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        bsl::shared_ptr<CollectingObserver> observer =
+                                     bsl::make_shared<CollectingObserver>();
+
+        if (verbose) cout << "\tConstructors and accessors\n";
+        {
+            Obj mX(observer, &ta);  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_BUFFER_SIZE == X.bufferSize());
+            ASSERT(ball::Severity::e_OFF == X.dropRecordsOnFullThreshold());
+            ASSERT(&ta == X.allocator());
+            ASSERT(false == X.isPublicationThreadRunning());
+
+            Obj mY(observer, 5000, &ta);  const Obj& Y = mY;
+            ASSERT(8192 == Y.bufferSize());
+            ASSERT(ball::Severity::e_OFF == Y.dropRecordsOnFullThreshold());
+
+            Obj mZ(observer, 10, ball::Severity::e_WARN, &ta);
+            const Obj& Z = mZ;
+            ASSERT(Obj::k_MIN_BUFFER_SIZE == Z.bufferSize());
+            ASSERT(ball::Severity::e_WARN == Z.dropRecordsOnFullThreshold());
+
+            Obj mW(observer);  const Obj& W = mW;
+            ASSERT(&defaultAllocator == W.allocator());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        ball::LoggerManagerConfiguration configuration;
+        ASSERT(0 == configuration.setDefaultThresholdLevelsIfValid(
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_TRACE,
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_OFF));
+        ball::LoggerManagerScopedGuard guard(configuration);
+
+        BALL_LOG_SET_CATEGORY("TEST.CASE5");
+
+        if (verbose) cout << "\tPublication thread\n";
+        {
+            Obj mX(observer, &ta);  const Obj& X = mX;
+            Obj::setDefaultLogger(&mX);
+
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERT(false == X.isPublicationThreadRunning());
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(true  == X.isPublicationThreadRunning());
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(true  == X.isPublicationThreadRunning());
+
+            BALL_LOGDEFERRED_INFO("first");
+
+            for (int i = 0; i < 5000 && 0 == observer->numRecords(); ++i) {
+                bslmt::ThreadUtil::microSleep(1000);
+            }
+            ASSERT(1 == observer->numRecords());
+
+            for (int i = 0; i < 100; ++i) {
+                BALL_LOGDEFERRED_INFO("%d", i);
+            }
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERT(false == X.isPublicationThreadRunning());
+            ASSERTV(observer->numRecords(), 101 == observer->numRecords());
+            ASSERT(0 == mX.stopPublicationThread());
+
+            BALL_LOGDEFERRED_INFO("second");
+            ASSERT(101 == observer->numRecords());
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERTV(observer->numRecords(), 102 == observer->numRecords());
+            ASSERT("second" == observer->record(101).d_message);
+
+            BALL_LOGDEFERRED_INFO("third");
+            ASSERT(102 == observer->numRecords());
+        }
+        ASSERTV(observer->numRecords(), 103 == observer->numRecords());
+        ASSERT("third" == observer->record(102).d_message);
+        ASSERT(0 == Obj::defaultLogger());
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tWaking the publication thread\n";
+        {
+            observer->reset();
+
+            Obj mX(observer, &ta);  const Obj& X = mX;
+            Obj::setDefaultLogger(&mX);
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            for (int i = 1; i <= 3; ++i) {
+                // Let the publication thread become idle.
+
+                bslmt::ThreadUtil::microSleep(50000);
+
+                BALL_LOGDEFERRED_INFO("%d", i);
+
+                // Wait (for up to 10 seconds) for the record to be published.
+
+                for (int j = 0; j < 1000 && observer->numRecords() < i; ++j) {
+                    bslmt::ThreadUtil::microSleep(10000);
+                }
+                ASSERTV(i, observer->numRecords(),
+                        i == observer->numRecords());
+            }
+            ASSERT(true == X.isPublicationThreadRunning());
+        }
+        ASSERT(0 == Obj::defaultLogger());
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tDestroying a logger that is not the default\n";
+        {
+            Obj mX(observer, &ta);
+            Obj mY(observer, &ta);
+
+            Obj::setDefaultLogger(&mX);
+            { Obj mZ(observer, &ta); }
+            ASSERT(&mX == Obj::defaultLogger());
+
+            Obj::setDefaultLogger(&mY);
+        }
+        ASSERT(0 == Obj::defaultLogger());
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Records captured concurrently by several threads are all
+        //:   published.
+        //:
+        //: 2 The records captured by each thread are published in the order
+        //:   in which they were captured, and carry that thread's id.
+        //:
+        //: 3 The ring of each thread is reclaimed once the thread has exited
+        //:   and its records have been published.
+        //:
+        //: 4 The rings are supplied by the global allocator, and the ring of a
+        //:   thread that outlives the logger is reclaimed when the thread
+        //:   exits.
+        //
+        // Plan:
+        //: 1 With a small buffer size and a running publication thread, have
+        //:   several threads each capture a sequence of numbered records.
+        //:   After joining the threads and stopping the publication thread,
+        //:   verify the count and the per-thread order of the published
+        //:   records, and that no ring memory remains in use.  (C-1..3)
+        //:
+        //: 2 Capture a record from a thread, destroy the logger while the
+        //:   thread is running, and verify that the memory of the ring is
+        //:   returned to the global allocator (a test allocator installed in
+        //:   'main') once the thread exits.  (C-4)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        using namespace TEST_CASE_4;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        ball::LoggerManagerConfiguration configuration;
+        ASSERT(0 == configuration.setDefaultThresholdLevelsIfValid(
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_INFO,
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_OFF));
+        ball::LoggerManagerScopedGuard guard(configuration);
+
+        bsl::shared_ptr<CollectingObserver> observer =
+                                     bsl::make_shared<CollectingObserver>();
+
+        Obj mX(observer,
+               Obj::k_MIN_BUFFER_SIZE,
+               ball::Severity::e_TRACE,
+               &ta);
+        Obj::setDefaultLogger(&mX);
+
+        for (int round = 0; round < 2; ++round) {
+            observer->reset();
+
+            const bsls::Types::Int64 NUM_GLOBAL_BYTES =
+                                              globalAllocator.numBytesInUse();
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            bsls::Types::Uint64       threadIds[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                Capturer capturer = { i };
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], capturer));
+                threadIds[i] = bslmt::ThreadUtil::idAsUint64(
+                                   bslmt::ThreadUtil::handleToId(handles[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            ASSERT(0 == mX.stopPublicationThread());
+
+            // A second pass reclaims any ring whose thread exited after the
+            // first pass examined it.
+
+            mX.flush();
+
+            const int NUM_RECORDS = observer->numRecords();
+            ASSERTV(round, NUM_RECORDS,
+                    k_NUM_THREADS * k_NUM_RECORDS_PER_THREAD == NUM_RECORDS);
+
+            int next[k_NUM_THREADS] = { 0 };
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                const PublishedRecord record = observer->record(i);
+
+                int threadIndex = -1;
+                int sequence    = -1;
+                ASSERT(2 == bsl::sscanf(record.d_message.c_str(),
+                                        "%d %d",
+                                        &threadIndex,
+                                        &sequence));
+
+                if (threadIndex < 0 || k_NUM_THREADS <= threadIndex) {
+                    ASSERTV(threadIndex, false);
+                    continue;
+                }
+                ASSERTV(threadIndex, sequence, next[threadIndex],
+                        next[threadIndex] == sequence);
+                ASSERTV(threadIndex,
+                        threadIds[threadIndex] == record.d_threadId);
+                next[threadIndex] = sequence + 1;
+            }
+
+            // No ring buffer is still allocated.  (Allocations by the logger
+            // manager, e.g., for the category on the first round, account for
+            // any increase.)
+
+            ASSERTV(round, NUM_GLOBAL_BYTES, globalAllocator.numBytesInUse(),
+                    globalAllocator.numBytesInUse() - NUM_GLOBAL_BYTES
+                                                    < Obj::k_MIN_BUFFER_SIZE);
+        }
+
+        if (verbose) cout << "\tThread outliving the logger\n";
+        {
+            observer->reset();
+
+            bslmt::Semaphore          captured;
+            bslmt::Semaphore          destroyed;
+            bslmt::ThreadUtil::Handle handle;
+
+            const bsls::Types::Int64 NUM_GLOBAL_BYTES =
+                                              globalAllocator.numBytesInUse();
+            {
+                Obj mY(observer,
+                       Obj::k_MIN_BUFFER_SIZE,
+                       ball::Severity::e_TRACE,
+                       &ta);
+                Obj::setDefaultLogger(&mY);
+
+                OutlivingCapturer capturer = { &captured, &destroyed };
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle, capturer));
+                captured.wait();
+
+                ASSERTV(NUM_GLOBAL_BYTES, globalAllocator.numBytesInUse(),
+                        NUM_GLOBAL_BYTES + Obj::k_MIN_BUFFER_SIZE
+                                            < globalAllocator.numBytesInUse());
+            }
+
+            // The destructor published the record, and the thread still
+            // references (only) its ring.
+
+            ASSERTV(observer->numRecords(), 1 == observer->numRecords());
+            ASSERTV(NUM_GLOBAL_BYTES, globalAllocator.numBytesInUse(),
+                    NUM_GLOBAL_BYTES + Obj::k_MIN_BUFFER_SIZE
+                                            < globalAllocator.numBytesInUse());
+
+            destroyed.post();
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(NUM_GLOBAL_BYTES, globalAllocator.numBytesInUse(),
+                    NUM_GLOBAL_BYTES == globalAllocator.numBytesInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // FULL RING BUFFER
+        //
+        // Concerns:
+        //: 1 When the ring of the capturing thread is full and the severity
+        //:   of the record is at least as severe as the drop threshold (in
+        //:   particular, when the drop threshold is 'e_TRACE'), the capturing
+        //:   thread publishes the records in its ring, and no record is lost
+        //:   or reordered.
+        //:
+        //: 2 When the ring is full and the severity of the record is less
+        //:   severe than the drop threshold, the record is dropped, and the
+        //:   number of dropped records is later published in a 'e_WARN'
+        //:   record.
+        //:
+        //: 3 'flush' publishes every captured record.
+        //
+        // Plan:
+        //: 1 Without a publication thread, capture many more records than
+        //:   fit in a minimum-sized ring, then 'flush', and verify the
+        //:   records published.  (C-1..3)
+        //
+        // Testing:
+        //   void flush();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FULL RING BUFFER" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        ball::LoggerManagerConfiguration configuration;
+        ASSERT(0 == configuration.setDefaultThresholdLevelsIfValid(
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_TRACE,
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_OFF));
+        ball::LoggerManagerScopedGuard guard(configuration);
+
+        BALL_LOG_SET_CATEGORY("TEST.CASE3");
+
+        bsl::shared_ptr<CollectingObserver> observer =
+                                     bsl::make_shared<CollectingObserver>();
+
+        const int NUM_RECORDS = 1000;
+
+        if (verbose) cout << "\tNo records dropped\n";
+        {
+            Obj mX(observer,
+                   Obj::k_MIN_BUFFER_SIZE,
+                   ball::Severity::e_TRACE,
+                   &ta);
+            Obj::setDefaultLogger(&mX);
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                BALL_LOGDEFERRED_TRACE("%d %s", i, "trace");
+            }
+            ASSERT(0 < observer->numRecords());
+            ASSERT(NUM_RECORDS > observer->numRecords());
+
+            mX.flush();
+
+            ASSERTV(observer->numRecords(),
+                    NUM_RECORDS == observer->numRecords());
+
+            for (int i = 0; i < observer->numRecords(); ++i) {
+                bsl::ostringstream expected;
+                expected << i << " trace";
+                ASSERTV(i, expected.str() == observer->record(i).d_message);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tDrop threshold\n";
+        {
+            observer->reset();
+
+            Obj mX(observer,
+                   Obj::k_MIN_BUFFER_SIZE,
+                   ball::Severity::e_WARN,
+                   &ta);
+            Obj::setDefaultLogger(&mX);
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                BALL_LOGDEFERRED_INFO("%d", i);
+            }
+            ASSERT(0 == observer->numRecords());
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                BALL_LOGDEFERRED_WARN("%d", i);
+            }
+
+            mX.flush();
+
+            int numInfo = 0;
+            int numWarn = 0;
+            int numDropped = -1;
+
+            for (int i = 0; i < observer->numRecords(); ++i) {
+                const PublishedRecord record = observer->record(i);
+
+                if ("BALL.DEFERREDLOGGER" == record.d_category) {
+                    ASSERT(ball::Severity::e_WARN == record.d_severity);
+                    ASSERT(1 == bsl::sscanf(record.d_message.c_str(),
+                                            "Dropped %d log records.",
+                                            &numDropped));
+                    ASSERTV(i, observer->numRecords(),
+                            i == observer->numRecords() - 1);
+                }
+                else if (ball::Severity::e_INFO == record.d_severity) {
+                    ASSERTV(i, numInfo, record.d_message,
+                            bsl::atoi(record.d_message.c_str()) == numInfo);
+                    ++numInfo;
+                }
+                else {
+                    ASSERTV(i, numWarn, record.d_message,
+                            bsl::atoi(record.d_message.c_str()) == numWarn);
+                    ++numWarn;
+                }
+            }
+
+            if (veryVerbose) { T_ P_(numInfo) P_(numWarn) P(numDropped) }
+
+            ASSERT(0           < numInfo);
+            ASSERT(NUM_RECORDS == numInfo + numDropped);
+            ASSERT(NUM_RECORDS == numWarn);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // MACROS AND 'capture'
+        //
+        // Concerns:
+        //: 1 Each macro captures a record only if the category is enabled for
+        //:   its severity.
+        //:
+        //: 2 A published record carries the category, file name, line
+        //:   number, severity, thread id, process id, and an approximately
+        //:   current timestamp of the capture, and the rendered message.
+        //:
+        //: 3 A string argument that does not fit is truncated, and a
+        //:   conversion for which no argument fits is rendered verbatim.
+        //:
+        //: 4 If there is no default logger, the macros log synchronously via
+        //:   the logger manager.
+        //:
+        //: 5 'capture' may be called directly.
+        //
+        // Plan:
+        //: 1 Register an observer with the logger manager and install a
+        //:   default logger publishing to another observer.  Use each macro
+        //:   at, above, and below the category threshold, and verify the
+        //:   records published by each observer.  (C-1..5)
+        //
+        // Testing:
+        //   DeferredLogger *defaultLogger();
+        //   void setDefaultLogger(DeferredLogger *logger);
+        //   void capture(const Category *, int, const char *, int, ...);
+        //   BALL_LOGDEFERRED(SEVERITY, MSG, ...)
+        //   BALL_LOGDEFERRED_TRACE(MSG, ...)
+        //   BALL_LOGDEFERRED_DEBUG(MSG, ...)
+        //   BALL_LOGDEFERRED_INFO(MSG, ...)
+        //   BALL_LOGDEFERRED_WARN(MSG, ...)
+        //   BALL_LOGDEFERRED_ERROR(MSG, ...)
+        //   BALL_LOGDEFERRED_FATAL(MSG, ...)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MACROS AND 'capture'" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        ball::LoggerManagerConfiguration configuration;
+        ASSERT(0 == configuration.setDefaultThresholdLevelsIfValid(
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_INFO,
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_OFF));
+        ball::LoggerManagerScopedGuard guard(configuration);
+
+        bsl::shared_ptr<CollectingObserver> managerObserver =
+                                     bsl::make_shared<CollectingObserver>();
+        ASSERT(0 == ball::LoggerManager::singleton().registerObserver(
+                                                               managerObserver,
+                                                               "collecting"));
+
+        bsl::shared_ptr<CollectingObserver> observer =
+                                     bsl::make_shared<CollectingObserver>();
+
+        BALL_LOG_SET_CATEGORY("TEST.CASE2");
+
+        {
+            Obj mX(observer, &ta);
+
+            ASSERT(0 == Obj::defaultLogger());
+            Obj::setDefaultLogger(&mX);
+            ASSERT(&mX == Obj::defaultLogger());
+
+            if (verbose) cout << "\tThresholds\n";
+
+            const bdlt::Datetime before = bdlt::CurrentTime::utc();
+
+            BALL_LOGDEFERRED_TRACE("trace %d", 1);
+            BALL_LOGDEFERRED_DEBUG("debug %d", 2);
+            const int INFO_LINE = L_ + 1;
+            BALL_LOGDEFERRED_INFO("info %d", 3);
+            BALL_LOGDEFERRED_WARN("warn %d", 4);
+            BALL_LOGDEFERRED_ERROR("error %d", 5);
+            BALL_LOGDEFERRED_FATAL("fatal %d", 6);
+
+            int severity = ball::Severity::e_DEBUG;
+            BALL_LOGDEFERRED(severity, "variable %d", 7);
+            severity = ball::Severity::e_WARN;
+            BALL_LOGDEFERRED(severity, "variable %d", 8);
+
+            mX.flush();
+
+            const bdlt::Datetime after = bdlt::CurrentTime::utc();
+
+            ASSERTV(observer->numRecords(), 5 == observer->numRecords());
+            ASSERT(0 == managerObserver->numRecords());
+
+            const char *EXP_MESSAGES[] = {
+                "info 3", "warn 4", "error 5", "fatal 6", "variable 8"
+            };
+            const int EXP_SEVERITIES[] = {
+                ball::Severity::e_INFO,
+                ball::Severity::e_WARN,
+                ball::Severity::e_ERROR,
+                ball::Severity::e_FATAL,
+                ball::Severity::e_WARN
+            };
+
+            for (int i = 0; i < 5 && i < observer->numRecords(); ++i) {
+                const PublishedRecord record = observer->record(i);
+
+                ASSERTV(i, record.d_message, EXP_MESSAGES[i] ==
+                                                             record.d_message);
+                ASSERTV(i, EXP_SEVERITIES[i] == record.d_severity);
+                ASSERTV(i, "TEST.CASE2" == record.d_category);
+                ASSERTV(i, __FILE__ == record.d_fileName);
+                ASSERTV(i, bslmt::ThreadUtil::selfIdAsUint64() ==
+                                                            record.d_threadId);
+                ASSERTV(i, bdls::ProcessUtil::getProcessId() ==
+                                                           record.d_processId);
+                ASSERTV(i, before <= record.d_timestamp);
+                ASSERTV(i, after  >= record.d_timestamp);
+            }
+            ASSERTV(observer->record(0).d_lineNumber,
+                    INFO_LINE == observer->record(0).d_lineNumber);
+
+            if (verbose) cout << "\tArguments\n";
+
+            observer->reset();
+
+            const bsl::string LONG(1000, 'x');
+
+            BALL_LOGDEFERRED_INFO("no arguments");
+            BALL_LOGDEFERRED_INFO("%s %d", LONG.c_str(), 5);
+            BALL_LOGDEFERRED_INFO("%c%hd%lu%p|%5.1f|%-4s|",
+                                  'a',
+                                  static_cast<short>(-2),
+                                  3UL,
+                                  static_cast<void *>(0),
+                                  2.25,
+                                  "s");
+
+            mX.flush();
+
+            ASSERT(3 == observer->numRecords());
+            ASSERT("no arguments" == observer->record(0).d_message);
+
+            const bsl::string& truncated = observer->record(1).d_message;
+            ASSERTV(truncated.length(), 1000 > truncated.length());
+            ASSERT(truncated.length() > 400);
+            ASSERT(bsl::string(truncated.length() - 3, 'x') + " %d" ==
+                                                                  truncated);
+
+            char expected[64];
+            bsl::snprintf(expected, sizeof expected,
+                          "%c%hd%lu%p|%5.1f|%-4s|",
+                          'a',
+                          static_cast<short>(-2),
+                          3UL,
+                          static_cast<void *>(0),
+                          2.25,
+                          "s");
+            ASSERTV(observer->record(2).d_message, expected,
+                    expected == observer->record(2).d_message);
+
+            if (verbose) cout << "\t'capture'\n";
+
+            observer->reset();
+
+            char        arguments[32];
+            bsl::size_t length = ball::DeferredFormatUtil::encode(
+                                                            arguments,
+                                                            sizeof arguments,
+                                                            42);
+            mX.capture(BALL_LOG_CATEGORY,
+                       ball::Severity::e_ERROR,
+                       "file.cpp",
+                       17,
+                       "direct %d",
+                       arguments,
+                       length);
+            mX.flush();
+
+            ASSERT(1 == observer->numRecords());
+            ASSERT("direct 42"  == observer->record(0).d_message);
+            ASSERT("file.cpp"   == observer->record(0).d_fileName);
+            ASSERT(17           == observer->record(0).d_lineNumber);
+            ASSERT(ball::Severity::e_ERROR == observer->record(0).d_severity);
+
+            if (verbose) cout << "\tNo default logger\n";
+
+            observer->reset();
+
+            Obj::setDefaultLogger(0);
+            ASSERT(0 == Obj::defaultLogger());
+
+            BALL_LOGDEFERRED_DEBUG("sync %d", 1);
+            const int SYNC_LINE = L_ + 1;
+            BALL_LOGDEFERRED_WARN("sync %d %s", 2, "two");
+
+            mX.flush();
+
+            ASSERT(0 == observer->numRecords());
+            ASSERTV(managerObserver->numRecords(),
+                    1 == managerObserver->numRecords());
+            if (1 == managerObserver->numRecords()) {
+                const PublishedRecord record = managerObserver->record(0);
+
+                ASSERTV(record.d_message, "sync 2 two" == record.d_message);
+                ASSERT(ball::Severity::e_WARN == record.d_severity);
+                ASSERT("TEST.CASE2" == record.d_category);
+                ASSERT(SYNC_LINE == record.d_lineNumber);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        ball::LoggerManager::singleton().deregisterObserver("collecting");
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing.
+        //
+        // Plan:
+        //: 1 Capture a few records, flush, and verify the published records.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        ball::LoggerManagerConfiguration configuration;
+        ASSERT(0 == configuration.setDefaultThresholdLevelsIfValid(
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_INFO,
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_OFF));
+        ball::LoggerManagerScopedGuard guard(configuration);
+
+        bsl::shared_ptr<CollectingObserver> observer =
+                                     bsl::make_shared<CollectingObserver>();
+        {
+            Obj mX(observer, &ta);
+            Obj::setDefaultLogger(&mX);
+
+            BALL_LOG_SET_CATEGORY("BREATHING");
+
+            BALL_LOGDEFERRED_INFO("hello %s %d", "world", 1);
+            BALL_LOGDEFERRED_DEBUG("not logged");
+            BALL_LOGDEFERRED_WARN("%.1f", 2.5);
+
+            ASSERT(0 == observer->numRecords());
+
+            mX.flush();
+
+            ASSERT(2 == observer->numRecords());
+            ASSERT("hello world 1" == observer->record(0).d_message);
+            ASSERT("2.5"           == observer->record(1).d_message);
+            ASSERT("BREATHING"     == observer->record(0).d_category);
+
+            ASSERT(0 == mX.startPublicationThread());
+            BALL_LOGDEFERRED_ERROR("threaded");
+        }
+        ASSERT(3 == observer->numRecords());
+        ASSERT("threaded" == observer->record(2).d_message);
+        ASSERT(0 == Obj::defaultLogger());
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: LATENCY DISTRIBUTION
+        //
+        // Concerns:
+        //: 1 The latency of a deferred logging call, as seen by the logging
+        //:   thread, is lower (in both the median and the tail) than that of
+        //:   the corresponding 'BALL_LOGVA' call publishing to an
+        //:   asynchronous file observer.
+        //
+        // Plan:
+        //: 1 Time each of a large number of 'BALL_LOGVA_INFO' calls, with a
+        //:   'ball::AsyncFileObserver' registered with the logger manager,
+        //:   and each of the same number of 'BALL_LOGDEFERRED_INFO' calls,
+        //:   with a 'ball::DeferredLogger' publishing to a
+        //:   'ball::FileObserver'.  Both observers write to a temporary file.
+        //:   Report the percentiles of the distribution of each.
+        //:
+        //: 2 Optionally specify the number of calls as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: LATENCY DISTRIBUTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: LATENCY DISTRIBUTION" << endl
+                          << "======================================" << endl;
+
+        using namespace TEST_CASE_MINUS_1;
+
+        const int NUM_CALLS = argc > 2 ? bsl::atoi(argv[2]) : 200000;
+
+        bsl::ostringstream fileNameStream;
+        fileNameStream << "ball_deferredlogger.t."
+                       << bdls::ProcessUtil::getProcessId() << ".log";
+        const bsl::string fileName = fileNameStream.str();
+
+        ball::LoggerManagerConfiguration configuration;
+        ASSERT(0 == configuration.setDefaultThresholdLevelsIfValid(
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_INFO,
+                                                     ball::Severity::e_OFF,
+                                                     ball::Severity::e_OFF));
+        ball::LoggerManagerScopedGuard guard(configuration);
+
+        BALL_LOG_SET_CATEGORY("PERFORMANCE");
+
+        bsl::vector<bsls::Types::Int64> latencies(NUM_CALLS);
+
+        {
+            bsl::shared_ptr<ball::AsyncFileObserver> asyncObserver =
+                 bsl::make_shared<ball::AsyncFileObserver>(
+                                                        ball::Severity::e_OFF,
+                                                        false,
+                                                        NUM_CALLS + 1);
+            ASSERT(0 == asyncObserver->enableFileLogging(fileName.c_str()));
+            asyncObserver->startPublicationThread();
+
+            ASSERT(0 == ball::LoggerManager::singleton().registerObserver(
+                                                                 asyncObserver,
+                                                                 "async"));
+
+            for (int i = 0; i < NUM_CALLS; ++i) {
+                const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+                BALL_LOGVA_INFO("order %d: %s %u @ %.2f",
+                                i, "BUY", 100u, 99.5);
+                latencies[i] = bsls::TimeUtil::getTimer() - start;
+            }
+            reportLatencies("BALL_LOGVA_INFO (async):", &latencies);
+
+            asyncObserver->stopPublicationThread();
+            ball::LoggerManager::singleton().deregisterObserver("async");
+            asyncObserver->disableFileLogging();
+        }
+        bdls::FilesystemUtil::remove(fileName);
+
+        {
+            bsl::shared_ptr<ball::FileObserver> fileObserver =
+                  bsl::make_shared<ball::FileObserver>(ball::Severity::e_OFF);
+            ASSERT(0 == fileObserver->enableFileLogging(fileName.c_str()));
+
+            Obj mX(fileObserver);
+            Obj::setDefaultLogger(&mX);
+            ASSERT(0 == mX.startPublicationThread());
+
+            for (int i = 0; i < NUM_CALLS; ++i) {
+                const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+                BALL_LOGDEFERRED_INFO("order %d: %s %u @ %.2f",
+                                      i, "BUY", 100u, 99.5);
+                latencies[i] = bsls::TimeUtil::getTimer() - start;
+            }
+            reportLatencies("BALL_LOGDEFERRED_INFO:", &latencies);
+
+            mX.stopPublicationThread();
+            fileObserver->disableFileLogging();
+        }
+        bdls::FilesystemUtil::remove(fileName);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -30,6 +30,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableStdoutLoggingPrefix
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setOnFileRotationCallback
@@ -625,6 +626,17 @@ class FileObserver : public Observer {
         // 'record' is at least as severe as the value returned by
         // 'stdoutThreshold'.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified 'numRecords' log records in the array
+        // addressed by the specified 'records' by writing them, in order, to
+        // the current log file if file logging is enabled for this file
+        // observer, and writing those whose severity is at least as severe as
+        // the value returned by 'stdoutThreshold' to 'stdout'.  The log file
+        // and 'stdout' are each flushed once per call rather than once per
+        // record (see 'FileObserver2::publishBatch').  The behavior is
+        // undefined unless '0 <= numRecords' and 'records' refers to an array
+        // of at least 'numRecords' valid addresses.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
@@ -50,6 +50,7 @@
 #include <bsl_memory.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdio.h>
 #include <bsl_c_stdlib.h>    // 'unsetenv'
@@ -111,6 +112,7 @@ using bsl::flush;
 // [ 1] void enableUserFieldsLogging();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
+// [ 7] void publishBatch(const Record *const *, int);
 // [ 2] void forceRotation();
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
 // [ 2] void rotateOnSize(int size);
@@ -136,7 +138,7 @@ using bsl::flush;
 // [ 6] CONCERN: 'FileObserver' can be created using 'allocate_shared'.
 // [ 5] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [ 4] CONCERN: ROTATION CALLBACK INVOCATION
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 
 // Note assert and debug macros all output to cerr instead of cout, unlike
 // most other test drivers.  This is necessary because test case 1 plays
@@ -687,7 +689,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -800,6 +802,124 @@ int main(int argc, char *argv[])
         observer->disableSizeRotation();
 //..
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes to 'stdout' exactly those records of the
+        //:   batch whose severity is at least as severe as 'stdoutThreshold',
+        //:   formatted as they would be by 'publish'.
+        //:
+        //: 2 'publishBatch' writes every record of the batch to the log file,
+        //:   formatted as they would be by 'publish'.
+        //
+        // Plan:
+        //: 1 Redirect 'stdout' to a file, publish a sequence of records having
+        //:   various severities using 'publish' and then using
+        //:   'publishBatch', and compare the output of the two.  (C-1)
+        //:
+        //: 2 Repeat P-1 for the log file output of two observers.  (C-2)
+        //
+        // Testing:
+        //   void publishBatch(const Record *const *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string stdoutName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&stdoutName, "stdout.log");
+        {
+            const FILE *out = stdout;
+            ASSERT(out == freopen(stdoutName.c_str(), "w", stdout));
+            fflush(stdout);
+        }
+
+        const ball::Severity::Level SEVERITIES[] = {
+            ball::Severity::e_INFO,
+            ball::Severity::e_WARN,
+            ball::Severity::e_TRACE,
+            ball::Severity::e_ERROR,
+            ball::Severity::e_DEBUG,
+            ball::Severity::e_FATAL,
+        };
+        const int NUM_RECORDS = static_cast<int>(sizeof SEVERITIES
+                                                 / sizeof *SEVERITIES);
+
+        bsl::vector<bsl::shared_ptr<ball::Record> > records(&ta);
+        bsl::vector<const ball::Record *>           batch(&ta);
+
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            bsl::ostringstream message;
+            message << "batch record " << i;
+
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        3 + i,
+                                        "CATEGORY",
+                                        SEVERITIES[i],
+                                        message.str().c_str());
+
+            records.push_back(bsl::make_shared<ball::Record>(
+                                                         attr,
+                                                         ball::UserFields()));
+            batch.push_back(records.back().get());
+        }
+
+        ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        bsl::string singleName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&singleName, "single.log");
+
+        bsl::string batchName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&batchName, "batch.log");
+
+        Obj single(ball::Severity::e_WARN, &ta);
+        Obj batched(ball::Severity::e_WARN, &ta);
+
+        ASSERT(0 == single.enableFileLogging(singleName.c_str()));
+        ASSERT(0 == batched.enableFileLogging(batchName.c_str()));
+
+        FsUtil::Offset offset = FsUtil::getFileSize(stdoutName);
+
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            single.publish(*records[i], context);
+        }
+        const bsl::string singleStdout = readPartialFile(stdoutName, offset);
+
+        offset = FsUtil::getFileSize(stdoutName);
+
+        batched.publishBatch(batch.data(), NUM_RECORDS);
+        const bsl::string batchStdout = readPartialFile(stdoutName, offset);
+
+        if (veryVerbose) { P(batchStdout); }
+
+        ASSERTV(singleStdout, batchStdout, singleStdout == batchStdout);
+
+        ASSERT(bsl::string::npos != batchStdout.find("batch record 1"));
+        ASSERT(bsl::string::npos != batchStdout.find("batch record 3"));
+        ASSERT(bsl::string::npos != batchStdout.find("batch record 5"));
+        ASSERT(bsl::string::npos == batchStdout.find("batch record 0"));
+        ASSERT(bsl::string::npos == batchStdout.find("batch record 2"));
+        ASSERT(bsl::string::npos == batchStdout.find("batch record 4"));
+
+        single.disableFileLogging();
+        batched.disableFileLogging();
+
+        const bsl::string singleFile = readPartialFile(singleName, 0);
+        const bsl::string batchFile  = readPartialFile(batchName,  0);
+
+        ASSERTV(singleFile, batchFile, singleFile == batchFile);
+        ASSERT(bsl::string::npos != batchFile.find("batch record 0"));
+        ASSERT(bsl::string::npos != batchFile.find("batch record 5"));
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // CONSTRUCTOR, MAKE_SHARED, AND ALLOCATE_SHARED TEST
@@ -21,12 +21,16 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bdls_filesystemutil.h>
 #include <bdls_processutil.h>
 
+#include <bdlsb_memoutstreambuf.h>
+
 #include <bdlt_currenttime.h>
 #include <bdlt_date.h>
 #include <bdlt_intervalconversionutil.h>
 #include <bdlt_localtimeoffset.h>
 #include <bdlt_time.h>
 
+#include <bslma_allocator.h>
+
 #include <bslmt_lockguard.h>
 
 #include <bsls_assert.h>
@@ -43,6 +47,8 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_errno.h>
 #include <bsl_c_time.h>
@@ -726,6 +732,81 @@ void FileObserver2::publish(const Record& record, const Context&)
     }
 }
 
+void FileObserver2::publishBatch(const Record *const *records, int numRecords)
+{
+    BSLS_ASSERT(0 <= numRecords);
+    BSLS_ASSERT(records || 0 == numRecords);
+
+    typedef bsl::pair<int, bsl::string> Rotation;
+
+    bslma::Allocator *allocator = d_logFileName.get_allocator().mechanism();
+
+    bsl::vector<Rotation> rotations(allocator);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        // The formatting functor may flush the stream it is supplied, so each
+        // record is formatted into a memory buffer and then copied to the
+        // (buffered) file stream, which is flushed once at the end.
+
+        bdlsb::MemOutStreamBuf recordBuffer(allocator);
+        bsl::ostream           recordStream(&recordBuffer);
+
+        for (int i = 0; i < numRecords; ++i) {
+            const Record& record = *records[i];
+
+            bsl::string rotatedFileName(allocator);
+            int         rotationStatus = rotateIfNecessary(
+                                             &rotatedFileName,
+                                             record.fixedFields().timestamp());
+            if (0 >= rotationStatus) {
+                rotations.push_back(Rotation(rotationStatus, rotatedFileName));
+            }
+
+            if (!d_logStreamBuf.isOpened()) {
+                continue;                                           // CONTINUE
+            }
+
+            recordBuffer.pubseekpos(0);
+            d_logFileFunctor(recordStream, record);
+            d_logOutStream.write(recordBuffer.data(),
+                                 recordBuffer.length());
+        }
+
+        if (d_logStreamBuf.isOpened()) {
+            d_logOutStream.flush();
+
+            if (!d_logOutStream) {
+                char errorBuffer[256];
+
+                snprintf(errorBuffer,
+                         sizeof errorBuffer,
+                         "Error on file stream for %s: %s.",
+                         d_logFileName.c_str(),
+                         bsl::strerror(getErrorCode()));
+                bsls::Log::platformDefaultMessageHandler(
+                                                    bsls::LogSeverity::e_ERROR,
+                                                    __FILE__,
+                                                    __LINE__,
+                                                    errorBuffer);
+
+                d_logStreamBuf.clear();
+            }
+        }
+    }
+
+    if (!rotations.empty()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+
+        if (d_onRotationCb) {
+            for (bsl::size_t i = 0; i < rotations.size(); ++i) {
+                d_onRotationCb(rotations[i].first, rotations[i].second);
+            }
+        }
+    }
+}
+
 void FileObserver2::rotateOnLifetime(
                                     const bdlt::DatetimeInterval& timeInterval)
 {
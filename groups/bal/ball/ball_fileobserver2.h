@@ -30,6 +30,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableFileLogging
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setLogFileFunctor
@@ -565,6 +566,20 @@ class FileObserver2 : public Observer {
         // enabled for this file observer.  The method has no effect if file
         // logging is not enabled, in which case 'record' is dropped.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified 'numRecords' log records in the array
+        // addressed by the specified 'records' by writing them, in order, to
+        // the current log file if file logging is enabled for this file
+        // observer.  The method has no effect if file logging is not enabled,
+        // in which case the records are dropped.  The rotation rules are
+        // evaluated before each record is written, exactly as for 'publish',
+        // but the log file is flushed only once, after the last record has
+        // been written.  The behavior is undefined unless '0 <= numRecords'
+        // and 'records' refers to an array of at least 'numRecords' valid
+        // addresses.  Note that this method writes the same bytes as
+        // 'numRecords' consecutive calls to 'publish', using substantially
+        // fewer system calls.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
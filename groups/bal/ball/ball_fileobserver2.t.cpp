@@ -51,7 +51,9 @@
 #include <bsl_ctime.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
+#include <bsl_memory.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <glob.h>
@@ -101,6 +103,7 @@ using bsl::flush;
 // [ 1] void enablePublishInLocalTime();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
+// [14] void publishBatch(const Record *const *, int);
 // [ 2] void forceRotation();
 // [ 2] void rotateOnSize(int size);
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
@@ -116,7 +119,8 @@ using bsl::flush;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
+// [14] void publishBatch(const Record *const *, int);
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -712,7 +716,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -788,6 +792,157 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes exactly the same bytes to the log file as
+        //:   the equivalent sequence of calls to 'publish'.
+        //:
+        //: 2 An empty batch has no effect.
+        //:
+        //: 3 Records are dropped if file logging is not enabled.
+        //:
+        //: 4 Rotation rules are evaluated for each record of a batch, and the
+        //:   rotation callback is invoked (outside the lock) for each rotation
+        //:   performed.
+        //
+        // Plan:
+        //: 1 Publish a sequence of records to one observer using 'publish' and
+        //:   to another observer using 'publishBatch', and compare the log
+        //:   files.  (C-1)
+        //:
+        //: 2 Publish an empty batch and verify the log file is unchanged.
+        //:   (C-2)
+        //:
+        //: 3 Publish a batch to an observer without file logging enabled.
+        //:   (C-3)
+        //:
+        //: 4 Enable rotation-on-size with a small limit and a rotation
+        //:   callback, publish a batch larger than the limit, and verify the
+        //:   callback is invoked and that no record is lost.  (C-4)
+        //
+        // Testing:
+        //   void publishBatch(const Record *const *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        enum { k_NUM_RECORDS = 12 };
+
+        bsl::vector<bsl::shared_ptr<ball::Record> > records(&ta);
+        bsl::vector<const ball::Record *>           batch(&ta);
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::ostringstream message;
+            message << "batch record " << i << ' '
+                    << bsl::string(48, static_cast<char>('a' + i));
+
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        3 + i,
+                                        "CATEGORY",
+                                        ball::Severity::e_INFO,
+                                        message.str().c_str());
+
+            records.push_back(bsl::make_shared<ball::Record>(
+                                                         attr,
+                                                         ball::UserFields()));
+            batch.push_back(records.back().get());
+        }
+
+        ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        if (verbose) cout << "\tComparing with 'publish'." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string singleName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&singleName, "single.log");
+
+            bsl::string batchName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&batchName, "batch.log");
+
+            Obj single(&ta);
+            Obj batched(&ta);
+
+            ASSERT(0 == single.enableFileLogging(singleName.c_str()));
+            ASSERT(0 == batched.enableFileLogging(batchName.c_str()));
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                single.publish(*records[i], context);
+            }
+            batched.publishBatch(batch.data(), k_NUM_RECORDS);
+
+            bsl::string singleContent(&ta);
+            bsl::string batchContent(&ta);
+
+            readFileIntoString(__LINE__, singleName, singleContent);
+            readFileIntoString(__LINE__, batchName, batchContent);
+
+            if (veryVerbose) { P(batchContent); }
+
+            ASSERT(!batchContent.empty());
+            ASSERTV(singleContent, batchContent,
+                    singleContent == batchContent);
+
+            batched.publishBatch(batch.data(), 0);
+
+            bsl::string emptyBatchContent(&ta);
+            readFileIntoString(__LINE__, batchName, emptyBatchContent);
+            ASSERT(batchContent == emptyBatchContent);
+
+            single.disableFileLogging();
+            batched.disableFileLogging();
+        }
+
+        if (verbose) cout << "\tFile logging disabled." << endl;
+        {
+            Obj mX(&ta);
+
+            mX.publishBatch(batch.data(), k_NUM_RECORDS);
+            ASSERT(false == mX.isFileLoggingEnabled());
+        }
+
+        if (verbose) cout << "\tRotation within a batch." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "rotate.log");
+
+            RotCb cb(&ta);
+            Obj   mX(&ta);
+
+            mX.setOnFileRotationCallback(cb);
+            mX.rotateOnSize(1);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            mX.publishBatch(batch.data(), k_NUM_RECORDS);
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(),         0 == cb.status());
+
+            mX.disableFileLogging();
+
+            // The records before the rotation are in the rotated file, and
+            // the remaining records are in the new log file.
+
+            int numLines = getNumLines(cb.rotatedFileName().c_str())
+                         + getNumLines(fileName.c_str());
+
+            // Each record occupies two lines in the default format.
+
+            ASSERTV(numLines, 2 * k_NUM_RECORDS == numLines);
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 123123158
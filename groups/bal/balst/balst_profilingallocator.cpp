@@ -0,0 +1,412 @@
+// balst_profilingallocator.cpp                                       -*-C++-*-
+#include <balst_profilingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balst_profilingallocator_cpp,"$Id$ $CSID$")
+
+#include <balst_stacktrace.h>
+#include <balst_stacktraceutil.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bslma_default.h>
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_fstream.h>
+#include <bsl_ios.h>
+#include <bsl_iomanip.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Every block is preceded by a 'Header' that, for a sampled block, holds the
+// address of its call site in the map of sites, and its size.  Map nodes are
+// never removed while the allocator exists, so the address remains valid
+// until the block is freed.
+//
+// The decision to sample is made without a lock: 'd_numBytesRequested' is
+// advanced atomically, and the one allocation that moves it across a multiple
+// of the interval is sampled.  Only sampled allocations, and the release of
+// sampled blocks, take the mutex.
+//
+// The printing functions copy the profile under the mutex, using the
+// underlying allocator, and format the copy after releasing it, so that
+// writing to a stream that allocates from this allocator does not deadlock.
+
+namespace BloombergLP {
+namespace balst {
+namespace {
+
+typedef bsls::StackAddressUtil AddressUtil;
+
+enum {
+    k_SKIPPED_FRAMES = AddressUtil::k_IGNORE_FRAMES + 1
+        // frames, at the top of each captured stack, that are within this
+        // allocator: 'getStackAddresses' itself on some platforms, and
+        // 'allocate'
+};
+
+union Header {
+    // This 'union' precedes every block, and is as large as the maximal
+    // alignment so that the block that follows it is maximally aligned.
+
+    struct {
+        void                   *d_site_p;  // site of a sampled block, or 0
+        bsls::Types::size_type  d_size;    // size of a sampled block
+    }                                    d_data;
+    bsls::AlignmentUtil::MaxAlignedType  d_align;
+};
+
+BSLMF_ASSERT(0 == sizeof(Header) % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+
+inline
+double estimatedBlocks(bsls::Types::size_type size,
+                       bsls::Types::Int64     samplingInterval)
+    // Return the number of blocks represented by a sampled block of the
+    // specified 'size' when sampling once per the specified
+    // 'samplingInterval' bytes.
+{
+    const double blocks = static_cast<double>(samplingInterval)
+                        / static_cast<double>(size);
+    return blocks < 1.0 ? 1.0 : blocks;
+}
+
+inline
+bsls::Types::Int64 estimatedBytes(bsls::Types::size_type size,
+                                  bsls::Types::Int64     samplingInterval)
+    // Return the number of bytes represented by a sampled block of the
+    // specified 'size' when sampling once per the specified
+    // 'samplingInterval' bytes.
+{
+    const bsls::Types::Int64 bytes = static_cast<bsls::Types::Int64>(size);
+    return bytes < samplingInterval ? samplingInterval : bytes;
+}
+
+inline
+bsls::Types::Int64 round(double value)
+    // Return the specified non-negative 'value' rounded to the nearest
+    // integer.
+{
+    return static_cast<bsls::Types::Int64>(value + 0.5);
+}
+
+template <class PAIR>
+struct IsLarger {
+    // This functor orders copies of the entries of the map of call sites from
+    // the largest to the smallest.
+
+    bool operator()(const PAIR& lhs, const PAIR& rhs) const
+        // Return 'true' if the specified 'lhs' has more bytes in use than the
+        // specified 'rhs', or as many in use and more allocated, and 'false'
+        // otherwise.
+    {
+        if (lhs.second.d_bytesInUse != rhs.second.d_bytesInUse) {
+            return lhs.second.d_bytesInUse > rhs.second.d_bytesInUse; // RETURN
+        }
+        return lhs.second.d_bytesAllocated > rhs.second.d_bytesAllocated;
+    }
+};
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class ProfilingAllocator
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+ProfilingAllocator::CallSite *
+ProfilingAllocator::recordSample(const void * const *frames,
+                                 int                 numFrames,
+                                 size_type           size)
+{
+    const double             blocks = estimatedBlocks(size,
+                                                      d_samplingInterval);
+    const bsls::Types::Int64 bytes  = estimatedBytes(size, d_samplingInterval);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    CallSite *site = 0;
+
+    BSLS_TRY {
+        Stack stack(frames, frames + numFrames, d_allocator_p);
+
+        CallSiteMap::iterator it = d_callSites.find(stack);
+        if (d_callSites.end() == it) {
+            const CallSite        empty = { 0, 0.0, 0, 0.0, 0 };
+            CallSiteMap::value_type value(stack, empty, d_allocator_p);
+
+            it = d_callSites.insert(value).first;
+        }
+        site = &it->second;
+    }
+    BSLS_CATCH(...) {
+        return 0;                                                     // RETURN
+    }
+
+    ++site->d_numSamples;
+    site->d_blocksAllocated += blocks;
+    site->d_bytesAllocated  += bytes;
+    site->d_blocksInUse     += blocks;
+    site->d_bytesInUse      += bytes;
+
+    d_numSamples.addRelaxed(1);
+
+    return site;
+}
+
+// CREATORS
+ProfilingAllocator::ProfilingAllocator(bslma::Allocator *basicAllocator)
+: d_numBytesRequested(0)
+, d_samplingInterval(k_DEFAULT_SAMPLING_INTERVAL)
+, d_numRecordedFrames(k_DEFAULT_NUM_RECORDED_FRAMES)
+, d_numSamples(0)
+, d_callSites(basicAllocator)
+, d_demangleFlag(true)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+ProfilingAllocator::ProfilingAllocator(bsls::Types::Int64  samplingInterval,
+                                       bslma::Allocator   *basicAllocator)
+: d_numBytesRequested(0)
+, d_samplingInterval(samplingInterval)
+, d_numRecordedFrames(k_DEFAULT_NUM_RECORDED_FRAMES)
+, d_numSamples(0)
+, d_callSites(basicAllocator)
+, d_demangleFlag(true)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= samplingInterval);
+}
+
+ProfilingAllocator::ProfilingAllocator(bsls::Types::Int64  samplingInterval,
+                                       int                 numRecordedFrames,
+                                       bslma::Allocator   *basicAllocator)
+: d_numBytesRequested(0)
+, d_samplingInterval(samplingInterval)
+, d_numRecordedFrames(numRecordedFrames)
+, d_numSamples(0)
+, d_callSites(basicAllocator)
+, d_demangleFlag(true)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= samplingInterval);
+    BSLS_ASSERT(1 <= numRecordedFrames);
+    BSLS_ASSERT(numRecordedFrames <= k_MAX_NUM_RECORDED_FRAMES);
+}
+
+ProfilingAllocator::~ProfilingAllocator()
+{
+}
+
+// MANIPULATORS
+void *ProfilingAllocator::allocate(size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    Header *header = static_cast<Header *>(d_allocator_p->allocate(
+                                                       sizeof(Header) + size));
+    header->d_data.d_site_p = 0;
+
+    const bsls::Types::Int64 after  = d_numBytesRequested.addRelaxed(
+                                       static_cast<bsls::Types::Int64>(size));
+    const bsls::Types::Int64 before = after
+                                    - static_cast<bsls::Types::Int64>(size);
+
+    if (before / d_samplingInterval != after / d_samplingInterval) {
+        void *frames[k_MAX_NUM_RECORDED_FRAMES + k_SKIPPED_FRAMES];
+
+        int numFrames = AddressUtil::getStackAddresses(
+                                       frames,
+                                       d_numRecordedFrames + k_SKIPPED_FRAMES);
+        numFrames = numFrames < k_SKIPPED_FRAMES
+                  ? 0
+                  : numFrames - k_SKIPPED_FRAMES;
+
+        header->d_data.d_site_p = recordSample(frames + k_SKIPPED_FRAMES,
+                                               numFrames,
+                                               size);
+        header->d_data.d_size   = size;
+    }
+
+    return header + 1;
+}
+
+void ProfilingAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    Header *header = static_cast<Header *>(address) - 1;
+
+    if (header->d_data.d_site_p) {
+        CallSite *site = static_cast<CallSite *>(header->d_data.d_site_p);
+
+        const double             blocks = estimatedBlocks(
+                                                        header->d_data.d_size,
+                                                        d_samplingInterval);
+        const bsls::Types::Int64 bytes  = estimatedBytes(
+                                                        header->d_data.d_size,
+                                                        d_samplingInterval);
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        site->d_blocksInUse -= blocks;
+        site->d_bytesInUse  -= bytes;
+    }
+
+    d_allocator_p->deallocate(header);
+}
+
+// ACCESSORS
+int ProfilingAllocator::numCallSites() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return static_cast<int>(d_callSites.size());
+}
+
+bsl::ostream& ProfilingAllocator::printHeapProfile(bsl::ostream& stream) const
+{
+    typedef bsl::vector<bsl::pair<Stack, CallSite> > Sites;
+
+    Sites sites(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        sites.assign(d_callSites.begin(), d_callSites.end());
+    }
+
+    bsls::Types::Int64 blocksInUse     = 0;
+    bsls::Types::Int64 bytesInUse      = 0;
+    bsls::Types::Int64 blocksAllocated = 0;
+    bsls::Types::Int64 bytesAllocated  = 0;
+
+    for (Sites::const_iterator it = sites.begin(); it != sites.end(); ++it) {
+        blocksInUse     += round(it->second.d_blocksInUse);
+        bytesInUse      += it->second.d_bytesInUse;
+        blocksAllocated += round(it->second.d_blocksAllocated);
+        bytesAllocated  += it->second.d_bytesAllocated;
+    }
+
+    const bsl::ios_base::fmtflags flags = stream.flags();
+
+    stream << bsl::dec
+           << "heap profile: " << bsl::setw(6) << blocksInUse
+           << ": "             << bsl::setw(8) << bytesInUse
+           << " ["             << bsl::setw(6) << blocksAllocated
+           << ": "             << bsl::setw(8) << bytesAllocated
+           << "] @ heapprofile\n";
+
+    for (Sites::const_iterator it = sites.begin(); it != sites.end(); ++it) {
+        stream << bsl::setw(6) << round(it->second.d_blocksInUse)
+               << ": "         << bsl::setw(8) << it->second.d_bytesInUse
+               << " ["         << bsl::setw(6)
+                               << round(it->second.d_blocksAllocated)
+               << ": "         << bsl::setw(8) << it->second.d_bytesAllocated
+               << "] @"        << bsl::hex;
+
+        for (Stack::const_iterator frame  = it->first.begin();
+                                   frame != it->first.end();
+                                 ++frame) {
+            stream << " 0x" << reinterpret_cast<bsls::Types::UintPtr>(*frame);
+        }
+        stream << bsl::dec << '\n';
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bsl::ifstream maps("/proc/self/maps");
+    if (maps) {
+        stream << "\nMAPPED_LIBRARIES:\n" << maps.rdbuf();
+    }
+#endif
+
+    stream.flags(flags);
+    return stream;
+}
+
+bsl::ostream& ProfilingAllocator::printReport(bsl::ostream& stream,
+                                              int           maxNumCallSites)
+                                                                          const
+{
+    typedef bsl::vector<bsl::pair<Stack, CallSite> > Sites;
+
+    Sites sites(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        sites.assign(d_callSites.begin(), d_callSites.end());
+    }
+
+    bsl::sort(sites.begin(), sites.end(), IsLarger<Sites::value_type>());
+
+    const int numReported = 0 <= maxNumCallSites
+                         && maxNumCallSites < static_cast<int>(sites.size())
+                          ? maxNumCallSites
+                          : static_cast<int>(sites.size());
+
+    stream << "Heap profile: " << sites.size() << " call site(s), "
+           << numSamples() << " sample(s), one per " << d_samplingInterval
+           << " byte(s) allocated.\n";
+
+    StackTrace st(d_allocator_p);
+    for (int i = 0; i < numReported; ++i) {
+        const Stack&    stack = sites[i].first;
+        const CallSite& site  = sites[i].second;
+
+        stream << "----------------------------------------"
+               << "---------------------------------------\n"
+               << "Call site " << i + 1 << ": "
+               << round(site.d_blocksInUse) << " block(s), "
+               << site.d_bytesInUse << " byte(s) in use; "
+               << round(site.d_blocksAllocated) << " block(s), "
+               << site.d_bytesAllocated << " byte(s) allocated; "
+               << site.d_numSamples << " sample(s).\n";
+
+        const int rc = stack.empty()
+                     ? -1
+                     : StackTraceUtil::loadStackTraceFromAddressArray(
+                                                &st,
+                                                stack.data(),
+                                                static_cast<int>(stack.size()),
+                                                d_demangleFlag);
+        if (rc || 0 == st.length()) {
+            stream << "... stack trace failed ...\n";
+        }
+        else {
+            StackTraceUtil::printFormatted(stream, st);
+        }
+        st.removeAll();
+    }
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,360 @@
+// balst_profilingallocator.h                                         -*-C++-*-
+#ifndef INCLUDED_BALST_PROFILINGALLOCATOR
+#define INCLUDED_BALST_PROFILINGALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator that samples allocations by call site.
+//
+//@CLASSES:
+//  balst::ProfilingAllocator: sampling allocator building a heap profile
+//
+//@SEE_ALSO: balst_stacktracetestallocator, balst_stacktraceutil
+//
+//@DESCRIPTION: This component provides an allocator,
+// 'balst::ProfilingAllocator', that implements the 'bslma::Allocator'
+// protocol by forwarding every request to an underlying allocator supplied at
+// construction, and that records, for a sample of the allocations, the call
+// stack from which they were made.  Sampled allocations are aggregated by call
+// stack ("call site") into a heap profile that reports, for each site, an
+// estimate of the number of blocks and bytes allocated from it in total, and
+// of those still in use.
+//..
+//                    ,-------------------------.
+//                   ( balst::ProfilingAllocator )
+//                    `-------------------------'
+//                                 |        ctor/dtor
+//                                 |        numCallSites
+//                                 |        numSamples
+//                                 |        printHeapProfile
+//                                 |        printReport
+//                                 |        samplingInterval
+//                                 |        setDemanglingPreferredFlag
+//                                 V
+//                         ,----------------.
+//                        ( bslma::Allocator )
+//                         `----------------'
+//                                          allocate
+//                                          deallocate
+//..
+// Unlike 'balst::StackTraceTestAllocator', which records the stack of every
+// allocation to report leaks, 'balst::ProfilingAllocator' is meant to be left
+// in place in production processes to find where memory is allocated.
+//
+///Sampling
+///--------
+// The allocator counts the bytes requested from it, and samples the
+// allocation during which the count crosses a multiple of the sampling
+// interval (512K bytes by default) supplied at construction.  An allocation of
+// 's' bytes is thus sampled with a probability of about 's / interval', and
+// every allocation at least as large as the interval is sampled.  Each sample
+// stands for 'interval / s' blocks (at least 1) and 'max(s, interval)' bytes,
+// so that the totals reported for each site estimate those of all the
+// allocations made from that site.  The estimates improve with the number of
+// samples taken from a site; sites allocating less than the interval in total
+// may not appear at all.  Note that sampling is systematic, not random, and
+// may therefore be biased for programs whose allocations follow a pattern
+// repeating with a period close to the interval.  A sampling interval of 1
+// records every allocation.
+//
+///Overhead
+///--------
+// An allocation that is not sampled costs one atomic addition in addition to
+// the work of the underlying allocator; a sampled allocation also captures the
+// call stack (see 'bsls::StackAddressUtil') and updates the profile under a
+// mutex.  Every block carries a header of
+// 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT' bytes, identifying the site of a
+// sampled block so that its release is accounted for.  Stack addresses are
+// resolved to symbols only when 'printReport' is called.
+//
+///Heap Profile Format
+///-------------------
+// 'printHeapProfile' writes the profile in the text format of the heap
+// profiler of 'gperftools', which 'pprof' reads.  The first line gives the
+// totals, and each following line gives the blocks and bytes in use, then the
+// blocks and bytes allocated, from a site, followed by the stack addresses of
+// the site, innermost first:
+//..
+//  heap profile:     34:  1277952 [    56:  2098176] @ heapprofile
+//      32:   524288 [    32:   524288] @ 0x4174b6 0x41838f 0x40e5a1
+//       2:   753664 [    24:  1573888] @ 0x4175f0 0x40e5a1
+//..
+// On Linux, the memory map of the process is appended so that 'pprof' can
+// symbolize the addresses.  Note that the estimated counts in the profile are
+// already scaled, so that 'pprof' must not scale them further.  'printReport'
+// writes a human-readable report of the sites, largest first, symbolized by
+// 'balst::StackTraceUtil'.
+//
+///Thread Safety
+///-------------
+// 'balst::ProfilingAllocator' is *fully thread-safe*, meaning that any
+// operation can be called on the *same* object from any number of threads,
+// provided that the allocator supplied at construction is fully thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding Where Memory Is Allocated
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service reads records into a cache, and that we want to know
+// which code paths account for the memory it uses.
+//
+// First, we define the two functions that allocate in our service:
+//..
+//  void *readRecord(bslma::Allocator *allocator)
+//      // Return a record allocated from the specified 'allocator'.
+//  {
+//      return allocator->allocate(1000);
+//  }
+//
+//  void *readIndex(bslma::Allocator *allocator)
+//      // Return an index allocated from the specified 'allocator'.
+//  {
+//      return allocator->allocate(100000);
+//  }
+//..
+// Then, we create a profiling allocator, sampling one allocation per 64K
+// bytes, in front of the allocator of the service:
+//..
+//  balst::ProfilingAllocator profiler(64 * 1024);
+//..
+// Next, the service runs, allocating many records and indices:
+//..
+//  bsl::vector<void *> blocks;
+//  for (int i = 0; i < 10000; ++i) {
+//      blocks.push_back(readRecord(&profiler));
+//      if (0 == i % 100) {
+//          blocks.push_back(readIndex(&profiler));
+//      }
+//  }
+//  assert(2 <= profiler.numCallSites());
+//..
+// Then, we write the heap profile to a file for 'pprof':
+//..
+//  bsl::ofstream profile("service.heap");
+//  profiler.printHeapProfile(profile);
+//..
+// Now, we may inspect it with 'pprof --text service service.heap', or look
+// at a report of the sites, which shows about 10000 blocks and 10M bytes in
+// use from 'readRecord', and 100 blocks and 10M bytes from 'readIndex':
+//..
+//  profiler.printReport(bsl::cout);
+//..
+// Finally, the service frees its memory:
+//..
+//  for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+//      profiler.deallocate(blocks[i]);
+//  }
+//..
+
+#include <balscm_version.h>
+
+#include <bslmt_mutex.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_map.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balst {
+
+                          // ========================
+                          // class ProfilingAllocator
+                          // ========================
+
+class ProfilingAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol by forwarding to
+    // an underlying allocator, recording the call stack of a sample of the
+    // allocations and aggregating the samples by call stack into a heap
+    // profile.
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        k_DEFAULT_SAMPLING_INTERVAL = 512 * 1024,
+                                    // bytes allocated per sample by default
+
+        k_DEFAULT_NUM_RECORDED_FRAMES = 32,
+                                    // frames recorded per sample by default
+
+        k_MAX_NUM_RECORDED_FRAMES = 128
+                                    // largest number of frames recorded
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct CallSite {
+        // This 'struct' holds the estimated statistics of one call site.
+
+        bsls::Types::Int64 d_numSamples;       // samples taken
+        double             d_blocksAllocated;  // estimated blocks allocated
+        bsls::Types::Int64 d_bytesAllocated;   // estimated bytes allocated
+        double             d_blocksInUse;      // estimated blocks in use
+        bsls::Types::Int64 d_bytesInUse;       // estimated bytes in use
+    };
+
+    typedef bsl::vector<const void *>      Stack;
+    typedef bsl::map<Stack, CallSite>      CallSiteMap;
+
+    // DATA
+    bsls::AtomicInt64         d_numBytesRequested;  // running total of bytes
+                                                    // requested, determining
+                                                    // the samples
+
+    const bsls::Types::Int64  d_samplingInterval;   // bytes per sample
+
+    const int                 d_numRecordedFrames;  // frames per sample
+
+    bsls::AtomicInt64         d_numSamples;         // samples taken
+
+    mutable bslmt::Mutex      d_mutex;              // guards 'd_callSites'
+
+    CallSiteMap               d_callSites;          // statistics per stack
+
+    bool                      d_demangleFlag;       // 'true' if symbols are to
+                                                    // be demangled
+
+    bslma::Allocator         *d_allocator_p;        // underlying allocator
+                                                    // (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ProfilingAllocator(const ProfilingAllocator&);
+    ProfilingAllocator& operator=(const ProfilingAllocator&);
+
+    // PRIVATE MANIPULATORS
+    CallSite *recordSample(const void * const *frames,
+                           int                 numFrames,
+                           size_type           size);
+        // Add a sample of an allocation of the specified 'size' bytes to the
+        // call site having the specified 'numFrames' stack 'frames', and
+        // return the address of that site.  Return 0, with no effect, if the
+        // site could not be recorded.
+
+  public:
+    // CREATORS
+    explicit
+    ProfilingAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    ProfilingAllocator(bsls::Types::Int64  samplingInterval,
+                       bslma::Allocator   *basicAllocator = 0);
+    ProfilingAllocator(bsls::Types::Int64  samplingInterval,
+                       int                 numRecordedFrames,
+                       bslma::Allocator   *basicAllocator = 0);
+        // Create a profiling allocator.  Optionally specify
+        // 'samplingInterval', the average number of bytes allocated per
+        // sample.  If 'samplingInterval' is not specified,
+        // 'k_DEFAULT_SAMPLING_INTERVAL' is used.  Optionally specify
+        // 'numRecordedFrames', the largest number of stack frames recorded
+        // per sample.  If 'numRecordedFrames' is not specified,
+        // 'k_DEFAULT_NUM_RECORDED_FRAMES' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory, both that returned by
+        // 'allocate' and that used to hold the profile.  If 'basicAllocator'
+        // is 0, the currently installed default allocator is used.  The
+        // behavior is undefined unless '1 <= samplingInterval' and
+        // '1 <= numRecordedFrames <= k_MAX_NUM_RECORDED_FRAMES'.
+
+    virtual ~ProfilingAllocator();
+        // Destroy this allocator.  The behavior is undefined unless all memory
+        // allocated through this allocator has been deallocated.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a maximally-aligned block of memory of at
+        // least the specified 'size' (in bytes), allocated from the
+        // underlying allocator, recording the call stack if the allocation is
+        // sampled.  If 'size' is 0, a null pointer is returned with no other
+        // effect.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the
+        // underlying allocator, removing it from the blocks in use of its call
+        // site if it was sampled.  If 'address' is 0, this function has no
+        // effect.  The behavior is undefined unless 'address' was allocated
+        // by this allocator and has not already been deallocated.
+
+    void setDemanglingPreferredFlag(bool value);
+        // Set the flag indicating whether 'printReport' attempts to demangle
+        // symbol names to the specified 'value'.  The flag is initially
+        // 'true'.  Note that some platforms always, or never, demangle.
+
+    // ACCESSORS
+    int numCallSites() const;
+        // Return the number of distinct call stacks sampled.
+
+    bsls::Types::Int64 numSamples() const;
+        // Return the number of allocations sampled.
+
+    bsl::ostream& printHeapProfile(bsl::ostream& stream) const;
+        // Write the heap profile in the format of the 'gperftools' heap
+        // profiler to the specified 'stream', and return 'stream'.  See
+        // {Heap Profile Format}.
+
+    bsl::ostream& printReport(bsl::ostream& stream,
+                              int           maxNumCallSites = -1) const;
+        // Write to the specified 'stream' a human-readable report of the call
+        // sites, in decreasing order of estimated bytes in use and then of
+        // estimated bytes allocated, with their symbolized call stacks, and
+        // return 'stream'.  Optionally specify 'maxNumCallSites', the largest
+        // number of sites reported.  If 'maxNumCallSites' is negative or not
+        // specified, all sites are reported.
+
+    bsls::Types::Int64 samplingInterval() const;
+        // Return the average number of bytes allocated per sample.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class ProfilingAllocator
+                          // ------------------------
+
+// MANIPULATORS
+inline
+void ProfilingAllocator::setDemanglingPreferredFlag(bool value)
+{
+    d_demangleFlag = value;
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 ProfilingAllocator::numSamples() const
+{
+    return d_numSamples.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 ProfilingAllocator::samplingInterval() const
+{
+    return d_samplingInterval;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
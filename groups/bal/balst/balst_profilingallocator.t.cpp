@@ -0,0 +1,1066 @@
+// balst_profilingallocator.t.cpp                                     -*-C++-*-
+#include <balst_profilingallocator.h>
+
+#include <balst_objectfileformat.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'balst::ProfilingAllocator' forwards every request to an underlying
+// allocator and records a sample of the allocations by call stack.  We test
+// that the blocks it returns are usable and are returned to the underlying
+// allocator, that the allocations sampled are those expected for the
+// interval, that samples from different call stacks form different sites,
+// that the estimates of the profile are close to the actual counts, and that
+// the profile is written in the format that 'pprof' reads and in a report
+// whose stacks are symbolized.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ProfilingAllocator(Allocator *ba = 0);
+// [ 2] ProfilingAllocator(Int64 samplingInterval, Allocator *ba = 0);
+// [ 2] ProfilingAllocator(Int64 interval, int frames, Allocator *ba = 0);
+// [ 2] ~ProfilingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 6] void setDemanglingPreferredFlag(bool value);
+//
+// ACCESSORS
+// [ 3] int numCallSites() const;
+// [ 3] Int64 numSamples() const;
+// [ 5] ostream& printHeapProfile(ostream& stream) const;
+// [ 6] ostream& printReport(ostream& stream, int maxNumCallSites) const;
+// [ 2] Int64 samplingInterval() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: The estimates of the profile are close to actual counts.
+// [ 7] CONCERN: The allocator is thread-safe.
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: OVERHEAD OF SAMPLING
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(expr) BSLS_ASSERTTEST_ASSERT_FAIL(expr)
+#define ASSERT_PASS(expr) BSLS_ASSERTTEST_ASSERT_PASS(expr)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balst::ProfilingAllocator Obj;
+typedef bsls::Types::Int64        Int64;
+
+static const int k_MAX_ALIGNMENT = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                         HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct Totals {
+    // This 'struct' holds the counts of one line of a heap profile.
+
+    Int64 d_blocksInUse;
+    Int64 d_bytesInUse;
+    Int64 d_blocksAllocated;
+    Int64 d_bytesAllocated;
+};
+
+bool parseCounts(Totals *result, const char *line)
+    // Load into the specified 'result' the counts at the start of the
+    // specified 'line' of a heap profile (after the "heap profile:" prefix of
+    // the first line, if any).  Return 'true' on success, and 'false'
+    // otherwise.
+{
+    static const char prefix[] = "heap profile:";
+    if (0 == bsl::strncmp(line, prefix, sizeof prefix - 1)) {
+        line += sizeof prefix - 1;
+    }
+    long long a, b, c, d;
+    if (4 != bsl::sscanf(line, " %lld: %lld [ %lld: %lld]", &a, &b, &c, &d)) {
+        return false;                                                 // RETURN
+    }
+    result->d_blocksInUse     = a;
+    result->d_bytesInUse      = b;
+    result->d_blocksAllocated = c;
+    result->d_bytesAllocated  = d;
+    return true;
+}
+
+bool profileTotals(Totals *result, const Obj& allocator)
+    // Load into the specified 'result' the totals of the heap profile of the
+    // specified 'allocator'.  Return 'true' on success, and 'false'
+    // otherwise.
+{
+    bsl::ostringstream stream;
+    allocator.printHeapProfile(stream);
+
+    bsl::string line;
+    bsl::istringstream input(stream.str());
+    return bsl::getline(input, line) && parseCounts(result, line.c_str());
+}
+
+bool isClose(Int64 estimate, Int64 actual, double tolerance)
+    // Return 'true' if the specified 'estimate' is within the specified
+    // 'tolerance', as a fraction, of the specified 'actual', and 'false'
+    // otherwise.
+{
+    const double error = static_cast<double>(estimate - actual);
+    return (error < 0 ? -error : error) <= tolerance * actual;
+}
+
+int numCallsA = 0;
+int numCallsB = 0;
+    // The two sites count their calls so that their code differs, and cannot
+    // be folded into one function by the linker.
+
+void *allocateFromSiteA(bslma::Allocator *allocator, int size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'allocator'.
+{
+    void *block = allocator->allocate(size);
+    ++numCallsA;
+    return block;
+}
+
+void *allocateFromSiteB(bslma::Allocator *allocator, int size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'allocator'.
+{
+    void *block = allocator->allocate(size);
+    ++numCallsB;
+    return block;
+}
+
+typedef void *(*AllocateFunction)(bslma::Allocator *, int);
+
+AllocateFunction volatile siteA = &allocateFromSiteA;
+AllocateFunction volatile siteB = &allocateFromSiteB;
+    // The sites are called through these pointers, so that they are not
+    // inlined.
+
+void allocateFromSites(void             **blocks,
+                       bslma::Allocator  *allocator,
+                       const char        *sites,
+                       const int         *sizes)
+    // Load into the specified 'blocks' the blocks of the specified 'sizes'
+    // allocated from the specified 'allocator' by the sites named by the
+    // characters ('A' or 'B') of the specified 'sites'.  The calls to all the
+    // sites are made from a single point, so that allocations from a site
+    // have the same call stack.
+{
+    for (int i = 0; sites[i]; ++i) {
+        blocks[i] = ('A' == sites[i] ? siteA : siteB)(allocator, sizes[i]);
+    }
+}
+
+                            // =================
+                            // struct StressTest
+                            // =================
+
+struct StressTest {
+    // This 'struct' describes the work of one thread of the concurrency test.
+
+    Obj *d_allocator_p;      // allocator under test
+    int  d_numIterations;    // blocks allocated and freed
+    int  d_errors;           // corrupted blocks found
+};
+
+extern "C" void *stress(void *arg)
+    // Allocate, fill, check, and free blocks from the allocator of the
+    // specified 'arg' (the address of a 'StressTest'), alternating between
+    // two call sites.
+{
+    StressTest *test = static_cast<StressTest *>(arg);
+
+    enum { k_WINDOW = 32 };
+
+    void *blocks[k_WINDOW] = { 0 };
+    int   sizes[k_WINDOW]  = { 0 };
+
+    for (int i = 0; i < test->d_numIterations; ++i) {
+        const int slot = i % k_WINDOW;
+        if (blocks[slot]) {
+            const unsigned char *p =
+                                static_cast<unsigned char *>(blocks[slot]);
+            for (int j = 0; j < sizes[slot]; ++j) {
+                if (p[j] != static_cast<unsigned char>(slot)) {
+                    ++test->d_errors;
+                    break;
+                }
+            }
+            test->d_allocator_p->deallocate(blocks[slot]);
+        }
+        sizes[slot]  = 1 + i % 200;
+        blocks[slot] = (i & 1 ? siteA : siteB)(test->d_allocator_p,
+                                               sizes[slot]);
+        bsl::memset(blocks[slot], slot, sizes[slot]);
+    }
+    for (int slot = 0; slot < k_WINDOW; ++slot) {
+        test->d_allocator_p->deallocate(blocks[slot]);
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding Where Memory Is Allocated
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service reads records into a cache, and that we want to know
+// which code paths account for the memory it uses.
+//
+// First, we define the two functions that allocate in our service:
+//..
+    void *readRecord(bslma::Allocator *allocator)
+        // Return a record allocated from the specified 'allocator'.
+    {
+        return allocator->allocate(1000);
+    }
+
+    void *readIndex(bslma::Allocator *allocator)
+        // Return an index allocated from the specified 'allocator'.
+    {
+        return allocator->allocate(100000);
+    }
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bsl::ostringstream report;
+
+// Then, we create a profiling allocator, sampling one allocation per 64K
+// bytes, in front of the allocator of the service:
+//..
+    balst::ProfilingAllocator profiler(64 * 1024);
+//..
+// Next, the service runs, allocating many records and indices:
+//..
+    bsl::vector<void *> blocks;
+    for (int i = 0; i < 10000; ++i) {
+        blocks.push_back(readRecord(&profiler));
+        if (0 == i % 100) {
+            blocks.push_back(readIndex(&profiler));
+        }
+    }
+    ASSERT(2 <= profiler.numCallSites());
+//..
+// Then, we write the heap profile to a file for 'pprof':
+//..
+    bsl::ofstream profile("service.heap");
+    profiler.printHeapProfile(profile);
+//..
+// Now, we may inspect it with 'pprof --text service service.heap', or look
+// at a report of the sites, which shows about 10000 blocks and 10M bytes in
+// use from 'readRecord', and 100 blocks and 10M bytes from 'readIndex':
+//..
+    profiler.printReport(veryVerbose ? bsl::cout : report);
+//..
+// Finally, the service frees its memory:
+//..
+    for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+        profiler.deallocate(blocks[i]);
+    }
+//..
+
+        profile.close();
+        bsl::remove("service.heap");
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'allocate' and 'deallocate' return usable,
+        //:   distinct blocks.
+        //:
+        //: 2 The samples taken by concurrent threads are all recorded, and
+        //:   are removed from the blocks in use when freed.
+        //
+        // Plan:
+        //: 1 Let several threads allocate, fill, check, and free blocks from
+        //:   two call sites.  (C-1)
+        //:
+        //: 2 Verify that the number of samples is that expected for the
+        //:   bytes allocated, and that no block remains in use in the profile
+        //:   or the underlying allocator.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: The allocator is thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 20000 };
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            const Int64 INTERVAL = 1000;
+
+            Obj mX(INTERVAL, &ta);  const Obj& X = mX;
+
+            StressTest tests[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                tests[i].d_allocator_p   = &mX;
+                tests[i].d_numIterations = k_NUM_ITERATIONS;
+                tests[i].d_errors        = 0;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      stress,
+                                                      &tests[i]));
+            }
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                ASSERTV(i, tests[i].d_errors, 0 == tests[i].d_errors);
+            }
+
+            // Each thread allocates the sizes 1 to 200 in turn.
+
+            Int64 bytesPerThread = 0;
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                bytesPerThread += 1 + i % 200;
+            }
+            const Int64 EXP = bytesPerThread * k_NUM_THREADS / INTERVAL;
+
+            if (veryVerbose) { P_(EXP) P(X.numSamples()) }
+            ASSERTV(EXP, X.numSamples(), EXP == X.numSamples());
+            ASSERT(2 <= X.numCallSites());
+
+            Totals totals;
+            ASSERT(profileTotals(&totals, X));
+            ASSERT(0 == totals.d_blocksInUse);
+            ASSERT(0 == totals.d_bytesInUse);
+            ASSERT(isClose(totals.d_bytesAllocated,
+                           bytesPerThread * k_NUM_THREADS,
+                           0.1));
+
+            ASSERT(ta.numBlocksInUse() <= X.numCallSites() * 2);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'printReport'
+        //
+        // Concerns:
+        //: 1 The report lists the sites from the largest in use to the
+        //:   smallest, with their counts.
+        //:
+        //: 2 At most 'maxNumCallSites' sites are reported, if specified.
+        //:
+        //: 3 Where stack traces are supported, the stacks are symbolized.
+        //
+        // Plan:
+        //: 1 Allocate more memory from one site than from the other with a
+        //:   sampling interval of 1, and verify the order and counts of the
+        //:   sites in the report.  (C-1)
+        //:
+        //: 2 Print reports with a limit of 1 site.  (C-2)
+        //:
+        //: 3 On platforms using the ELF resolver, verify that the names of
+        //:   the functions allocating appear in the report.  (C-3)
+        //
+        // Testing:
+        //   ostream& printReport(ostream& stream, int maxNumCallSites) const;
+        //   void setDemanglingPreferredFlag(bool value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'printReport'" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            const int SIZES[] = { 100, 1000, 200 };
+            void     *blocks[3];
+            allocateFromSites(blocks, &mX, "ABA", SIZES);
+
+            bsl::ostringstream stream;
+            X.printReport(stream);
+            const bsl::string& REPORT = stream.str();
+            if (veryVerbose) cout << REPORT;
+
+            ASSERT(bsl::string::npos != REPORT.find("2 call site(s)"));
+            ASSERT(bsl::string::npos != REPORT.find("3 sample(s)"));
+
+            const bsl::size_t SITE_1 = REPORT.find("Call site 1: 1 block(s), "
+                                                   "1000 byte(s) in use");
+            const bsl::size_t SITE_2 = REPORT.find("Call site 2: 2 block(s), "
+                                                   "300 byte(s) in use");
+            ASSERT(bsl::string::npos != SITE_1);
+            ASSERT(bsl::string::npos != SITE_2);
+            ASSERT(SITE_1 < SITE_2);
+
+#if defined(BALST_OBJECTFILEFORMAT_RESOLVER_ELF)
+            const bsl::size_t NAME_A = REPORT.find("allocateFromSiteA");
+            const bsl::size_t NAME_B = REPORT.find("allocateFromSiteB");
+            ASSERTV(REPORT, bsl::string::npos != NAME_A);
+            ASSERTV(REPORT, bsl::string::npos != NAME_B);
+            ASSERT(SITE_1 < NAME_B && NAME_B < SITE_2 && SITE_2 < NAME_A);
+#endif
+
+            mX.setDemanglingPreferredFlag(false);
+
+            stream.str("");
+            X.printReport(stream, 1);
+            ASSERT(bsl::string::npos != stream.str().find("Call site 1"));
+            ASSERT(bsl::string::npos == stream.str().find("Call site 2"));
+
+            stream.str("");
+            X.printReport(stream, 0);
+            ASSERT(bsl::string::npos == stream.str().find("Call site 1"));
+
+            for (int i = 0; i < 3; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'printHeapProfile'
+        //
+        // Concerns:
+        //: 1 The first line gives the totals of the sites in the format of
+        //:   the 'gperftools' heap profiler.
+        //:
+        //: 2 Each site is written on a line giving its counts and its stack
+        //:   addresses in hexadecimal.
+        //:
+        //: 3 On Linux, the memory map of the process follows the sites.
+        //:
+        //: 4 The format flags of the stream are unchanged.
+        //
+        // Plan:
+        //: 1 Allocate from two sites with a sampling interval of 1, write the
+        //:   profile, and parse and verify each line.  (C-1..3)
+        //:
+        //: 2 Verify the flags of the stream after writing.  (C-4)
+        //
+        // Testing:
+        //   ostream& printHeapProfile(ostream& stream) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'printHeapProfile'" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            const int SIZES[] = { 100, 1000, 200 };
+            void     *blocks[3];
+            allocateFromSites(blocks, &mX, "ABA", SIZES);
+            mX.deallocate(blocks[2]);
+
+            bsl::ostringstream stream;
+            stream << bsl::hex;
+            const bsl::ios_base::fmtflags FLAGS = stream.flags();
+            X.printHeapProfile(stream);
+            ASSERT(FLAGS == stream.flags());
+
+            if (veryVerbose) cout << stream.str();
+
+            bsl::istringstream input(stream.str());
+            bsl::string        line;
+
+            ASSERT(bsl::getline(input, line));
+            ASSERTV(line, 0 == line.find("heap profile: "));
+            ASSERTV(line, line.size() - 15 == line.find("] @ heapprofile"));
+
+            Totals totals;
+            ASSERT(parseCounts(&totals, line.c_str()));
+            ASSERT(2    == totals.d_blocksInUse);
+            ASSERT(1100 == totals.d_bytesInUse);
+            ASSERT(3    == totals.d_blocksAllocated);
+            ASSERT(1300 == totals.d_bytesAllocated);
+
+            Totals sum = { 0, 0, 0, 0 };
+            int    numSites = 0;
+            while (bsl::getline(input, line) && !line.empty()) {
+                Totals site;
+                ASSERTV(line, parseCounts(&site, line.c_str()));
+                sum.d_blocksInUse     += site.d_blocksInUse;
+                sum.d_bytesInUse      += site.d_bytesInUse;
+                sum.d_blocksAllocated += site.d_blocksAllocated;
+                sum.d_bytesAllocated  += site.d_bytesAllocated;
+
+                const bsl::size_t AT = line.find("] @ 0x");
+                ASSERTV(line, bsl::string::npos != AT);
+                ASSERTV(line, bsl::string::npos ==
+                     line.find_first_not_of(" 0123456789abcdefx", AT + 3));
+                ++numSites;
+            }
+            ASSERT(2 == numSites);
+            ASSERT(totals.d_blocksInUse     == sum.d_blocksInUse);
+            ASSERT(totals.d_bytesInUse      == sum.d_bytesInUse);
+            ASSERT(totals.d_blocksAllocated == sum.d_blocksAllocated);
+            ASSERT(totals.d_bytesAllocated  == sum.d_bytesAllocated);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERT(bsl::getline(input, line));
+            ASSERTV(line, "MAPPED_LIBRARIES:" == line);
+            ASSERT(bsl::getline(input, line));
+            ASSERTV(line, bsl::string::npos != line.find('-'));
+#endif
+
+            mX.deallocate(blocks[0]);
+            mX.deallocate(blocks[1]);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SAMPLING ESTIMATES
+        //
+        // Concerns:
+        //: 1 One allocation is sampled per interval of bytes requested.
+        //:
+        //: 2 The estimated blocks and bytes, allocated and in use, are close
+        //:   to the actual counts for small blocks.
+        //:
+        //: 3 Blocks at least as large as the interval are always sampled, and
+        //:   their counts are exact.
+        //
+        // Plan:
+        //: 1 Allocate many small blocks of several sizes, free half of them,
+        //:   and compare the numbers of samples and the totals of the profile
+        //:   with the actual counts.  (C-1..2)
+        //:
+        //: 2 Allocate and free large blocks, and verify the totals.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: The estimates of the profile are close to actual counts.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SAMPLING ESTIMATES" << endl
+                          << "==================" << endl;
+
+        if (verbose) cout << "\tSmall blocks." << endl;
+
+        const int SIZES[]   = { 8, 24, 100, 1000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int   SIZE       = SIZES[ti];
+            const Int64 INTERVAL   = 4096;
+            const int   NUM_BLOCKS = 100000;
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(INTERVAL, &ta);  const Obj& X = mX;
+
+                bsl::vector<void *> blocks(&ta);
+                blocks.reserve(NUM_BLOCKS);
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    blocks.push_back(siteA(&mX, SIZE));
+                }
+
+                const Int64 BYTES = static_cast<Int64>(SIZE) * NUM_BLOCKS;
+
+                ASSERTV(SIZE, BYTES / INTERVAL == X.numSamples());
+                ASSERTV(SIZE, 1 == X.numCallSites());
+
+                for (int i = 0; i < NUM_BLOCKS / 2; ++i) {
+                    mX.deallocate(blocks[i]);
+                }
+
+                Totals totals;
+                ASSERT(profileTotals(&totals, X));
+
+                if (veryVerbose) {
+                    P_(SIZE) P_(totals.d_blocksAllocated)
+                    P(totals.d_bytesAllocated)
+                    P_(SIZE) P_(totals.d_blocksInUse) P(totals.d_bytesInUse)
+                }
+
+                ASSERTV(SIZE, isClose(totals.d_blocksAllocated,
+                                      NUM_BLOCKS,
+                                      0.05));
+                ASSERTV(SIZE, isClose(totals.d_bytesAllocated, BYTES, 0.05));
+                ASSERTV(SIZE, isClose(totals.d_blocksInUse,
+                                      NUM_BLOCKS / 2,
+                                      0.05));
+                ASSERTV(SIZE, isClose(totals.d_bytesInUse, BYTES / 2, 0.05));
+
+                for (int i = NUM_BLOCKS / 2; i < NUM_BLOCKS; ++i) {
+                    mX.deallocate(blocks[i]);
+                }
+
+                ASSERT(profileTotals(&totals, X));
+                ASSERTV(SIZE, 0 == totals.d_blocksInUse);
+                ASSERTV(SIZE, 0 == totals.d_bytesInUse);
+            }
+            ASSERTV(SIZE, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tLarge blocks." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+
+            Obj mX(1000, &ta);  const Obj& X = mX;
+
+            const int SIZES[] = { 1000, 5000, 1001 };
+            void     *blocks[3];
+            allocateFromSites(blocks, &mX, "AAB", SIZES);
+            ASSERT(3 == X.numSamples());
+            ASSERT(2 == X.numCallSites());
+
+            mX.deallocate(blocks[1]);
+
+            Totals totals;
+            ASSERT(profileTotals(&totals, X));
+            ASSERT(2    == totals.d_blocksInUse);
+            ASSERT(2001 == totals.d_bytesInUse);
+            ASSERT(3    == totals.d_blocksAllocated);
+            ASSERT(7001 == totals.d_bytesAllocated);
+
+            mX.deallocate(blocks[0]);
+            mX.deallocate(blocks[2]);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned, writable block of the
+        //:   requested size, obtained from the underlying allocator, and
+        //:   'deallocate' returns it.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 Allocations from the same call stack form one site, and those
+        //:   from different stacks form different sites.
+        //:
+        //: 4 Memory used to hold the profile comes from the underlying
+        //:   allocator, and no memory comes from the default allocator.
+        //
+        // Plan:
+        //: 1 With a sampling interval of 1, allocate blocks of many sizes
+        //:   from two functions, writing each, and check the alignment, the
+        //:   blocks in use of the underlying allocator, the number of
+        //:   samples, and the number of sites.  (C-1..4)
+        //:
+        //: 2 Call 'allocate(0)' and 'deallocate(0)'.  (C-2)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   int numCallSites() const;
+        //   Int64 numSamples() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            ASSERT(0 == X.numSamples());
+
+            const int   NUM_BLOCKS = 200;
+            void       *blocks[NUM_BLOCKS];
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                const int SIZE = 1 + i * 7;
+
+                blocks[i] = (i % 2 ? siteA : siteB)(&mX, SIZE);
+                ASSERTV(i, 0 == reinterpret_cast<bsls::Types::UintPtr>(
+                                                 blocks[i]) % k_MAX_ALIGNMENT);
+                bsl::memset(blocks[i], 0xa5, SIZE);
+
+                ASSERTV(i, i + 1 == X.numSamples());
+            }
+            ASSERT(2 == X.numCallSites());
+
+            const Int64 NUM_IN_USE = ta.numBlocksInUse();
+            ASSERT(NUM_BLOCKS < NUM_IN_USE);
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERT(NUM_IN_USE - NUM_BLOCKS == ta.numBlocksInUse());
+            ASSERT(2 == X.numCallSites());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\tSites of the same function." << endl;
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            void *blocks[10];
+            for (int i = 0; i < 10; ++i) {
+                blocks[i] = siteA(&mX, 16);
+            }
+            ASSERT(10 == X.numSamples());
+            ASSERT(1  == X.numCallSites());
+
+            void *other = mX.allocate(16);   // another call stack
+            ASSERT(2 == X.numCallSites());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            mX.deallocate(other);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND 'samplingInterval'
+        //
+        // Concerns:
+        //: 1 The sampling interval is that supplied, or the default.
+        //:
+        //: 2 The supplied allocator, or the default allocator, supplies
+        //:   memory.
+        //:
+        //: 3 A new allocator has no samples and no sites.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create allocators with each constructor and check the accessors
+        //:   and the allocator used.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   ProfilingAllocator(Allocator *ba = 0);
+        //   ProfilingAllocator(Int64 samplingInterval, Allocator *ba = 0);
+        //   ProfilingAllocator(Int64 interval, int frames, Allocator *ba = 0);
+        //   ~ProfilingAllocator();
+        //   Int64 samplingInterval() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND 'samplingInterval'" << endl
+                          << "===============================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_SAMPLING_INTERVAL == X.samplingInterval());
+            ASSERT(0 == X.numSamples());
+            ASSERT(0 == X.numCallSites());
+
+            void *p = mX.allocate(1);
+            ASSERT(1 == da.numBlocksInUse());
+            mX.deallocate(p);
+        }
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_SAMPLING_INTERVAL == X.samplingInterval());
+
+            void *p = mX.allocate(1);
+            ASSERT(1 == ta.numBlocksInUse());
+            mX.deallocate(p);
+        }
+        {
+            Obj mX(12345, &ta);  const Obj& X = mX;
+
+            ASSERT(12345 == X.samplingInterval());
+            ASSERT(0     == X.numSamples());
+
+            void *p = mX.allocate(12345);
+            ASSERT(1 == X.numSamples());
+            mX.deallocate(p);
+        }
+        {
+            Obj mX(1, 1, &ta);  const Obj& X = mX;
+
+            ASSERT(1 == X.samplingInterval());
+
+            // With one frame recorded, all the allocations from one function
+            // form one site, wherever that function is called from.
+
+            void *p = siteA(&mX, 10);
+            void *q = siteA(&mX, 10);
+
+            ASSERT(2 == X.numSamples());
+            ASSERT(1 == X.numCallSites());
+            mX.deallocate(p);
+            mX.deallocate(q);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(0, &ta));
+            ASSERT_PASS(Obj(1, &ta));
+            ASSERT_FAIL(Obj(1, 0, &ta));
+            ASSERT_PASS(Obj(1, 1, &ta));
+            ASSERT_PASS(Obj(1, Obj::k_MAX_NUM_RECORDED_FRAMES, &ta));
+            ASSERT_FAIL(Obj(1, Obj::k_MAX_NUM_RECORDED_FRAMES + 1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and free blocks, and print the profile.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(100, &ta);  const Obj& X = mX;
+
+            void *a = mX.allocate(50);
+            ASSERT(0 == X.numSamples());
+
+            void *b = mX.allocate(50);
+            ASSERT(1 == X.numSamples());
+            ASSERT(1 == X.numCallSites());
+
+            bsl::ostringstream stream;
+            X.printHeapProfile(stream);
+            ASSERT(0 == stream.str().find("heap profile:"));
+
+            stream.str("");
+            X.printReport(stream);
+            ASSERT(bsl::string::npos != stream.str().find("Call site 1"));
+
+            if (veryVerbose) cout << stream.str();
+
+            mX.deallocate(a);
+            mX.deallocate(b);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: OVERHEAD OF SAMPLING
+        //
+        // Concerns:
+        //: 1 Allocations that are not sampled cost little more than those of
+        //:   the underlying allocator.
+        //
+        // Plan:
+        //: 1 Time pairs of 'allocate' and 'deallocate' of 64 bytes on the
+        //:   new/delete allocator directly, and through profiling allocators
+        //:   having several sampling intervals.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: OVERHEAD OF SAMPLING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: OVERHEAD OF SAMPLING" << endl
+                          << "=================================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 10000000;
+
+        const Int64 INTERVALS[] = { 0, 512 * 1024, 64 * 1024, 4096, 64 };
+        const int   NUM_DATA    = static_cast<int>(sizeof INTERVALS
+                                                   / sizeof *INTERVALS);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const Int64 INTERVAL = INTERVALS[ti];
+
+            bslma::Allocator *underlying = bslma::Default::globalAllocator();
+            Obj               profiler(INTERVAL ? INTERVAL : 1, underlying);
+            bslma::Allocator *allocator  = INTERVAL ? &profiler : underlying;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                allocator->deallocate(siteA(allocator, 64));
+            }
+            timer.stop();
+
+            cout << (INTERVAL ? "interval " : "no profiler")
+                 << (INTERVAL ? bsl::to_string(INTERVAL) : bsl::string())
+                 << ": " << timer.elapsedTime() * 1e9 / NUM_ITERATIONS
+                 << " ns per pair, " << profiler.numSamples()
+                 << " samples" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
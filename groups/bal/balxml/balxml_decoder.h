@@ -270,6 +270,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_formattingmode.h>
 #include <bdlat_nullablevaluefunctions.h>
 #include <bdlat_sequencefunctions.h>
+#include <bdlat_sequenceplan.h>
 #include <bdlat_typecategory.h>
 #include <bdlat_valuetypefunctions.h>
 
@@ -2424,10 +2425,10 @@ int Decoder_SequenceContext<TYPE>::parseAttribute(const char  *name,
 
     Decoder_ParseAttribute visitor(decoder, name, value, lenValue);
 
-    if (0 != bdlat_SequenceFunctions::manipulateAttribute(d_object_p,
-                                                          visitor,
-                                                          name,
-                                                          lenName)) {
+    if (0 != bdlat_SequencePlanUtil::manipulateAttribute(d_object_p,
+                                                         visitor,
+                                                         name,
+                                                         lenName)) {
         if (visitor.failed()) {
             return k_FAILURE;                                         // RETURN
         }
@@ -2446,9 +2447,9 @@ int Decoder_SequenceContext<TYPE>::parseSubElement(const char *elementName,
     const int lenName = static_cast<int>(bsl::strlen(elementName));
 
     if (decoder->options()->skipUnknownElements()
-     && false == bdlat_SequenceFunctions::hasAttribute(*d_object_p,
-                                                       elementName,
-                                                       lenName)) {
+     && false == bdlat_SequencePlanUtil::hasAttribute(*d_object_p,
+                                                      elementName,
+                                                      lenName)) {
         decoder->setNumUnknownElementsSkipped(
                                      decoder->numUnknownElementsSkipped() + 1);
         Decoder_UnknownElementContext unknownElement;
@@ -2457,10 +2458,10 @@ int Decoder_SequenceContext<TYPE>::parseSubElement(const char *elementName,
 
     Decoder_ParseSequenceSubElement visitor(decoder, elementName, lenName);
 
-    return bdlat_SequenceFunctions::manipulateAttribute(d_object_p,
-                                                        visitor,
-                                                        elementName,
-                                                        lenName);
+    return bdlat_SequencePlanUtil::manipulateAttribute(d_object_p,
+                                                       visitor,
+                                                       elementName,
+                                                       lenName);
 }
 
                      // ---------------------------------
@@ -2979,7 +2980,7 @@ int Decoder_ParseObject::executeImp(
 
     if (formattingMode & bdlat_FormattingMode::e_UNTAGGED) {
         if (d_decoder->options()->skipUnknownElements()
-         && false == bdlat_SequenceFunctions::hasAttribute(
+         && false == bdlat_SequencePlanUtil::hasAttribute(
                                                 *object,
                                                 d_elementName_p,
                                                 static_cast<int>(d_lenName))) {
@@ -2989,7 +2990,7 @@ int Decoder_ParseObject::executeImp(
             return unknownElement.beginParse(d_decoder);              // RETURN
         }
 
-        return bdlat_SequenceFunctions::manipulateAttribute(
+        return bdlat_SequencePlanUtil::manipulateAttribute(
                                                   object,
                                                   *this,
                                                   d_elementName_p,
@@ -25373,6 +25373,15 @@ int bdlat_sequenceManipulateAttribute(
     return -1;
 }
 
+template <class VALUE_TYPE, class MANIPULATOR>
+int bdlat_sequenceManipulateAttribute(
+                    TestTaggedValue<FailToManipulateSequenceTag, VALUE_TYPE> *,
+                    MANIPULATOR&                                              ,
+                    int)
+{
+    return -1;
+}
+
 template <class VALUE_TYPE, class MANIPULATOR>
 int bdlat_typeCategoryManipulateSequence(
   TestTaggedValue<FailToManipulateSequenceTag, TestDynamicType<VALUE_TYPE> > *,
@@ -927,7 +927,8 @@ int Encoder::encode(bsl::streambuf *buffer, const TYPE& object)
     Formatter formatter(buffer,
          bCompact ?  0 : d_options->initialIndentLevel(),
          bCompact ?  0 : d_options->spacesPerLevel(),
-         bCompact ? -1 : d_options->wrapColumn());
+         bCompact ? -1 : d_options->wrapColumn(),
+         d_allocator);
 
     const int rc = encode(formatter, object);
 
@@ -952,7 +953,8 @@ bsl::ostream& Encoder::encode(bsl::ostream& stream, const TYPE& object)
     Formatter formatter(stream,
          bCompact ?  0 : d_options->initialIndentLevel(),
          bCompact ?  0 : d_options->spacesPerLevel(),
-         bCompact ? -1 : d_options->wrapColumn());
+         bCompact ? -1 : d_options->wrapColumn(),
+         d_allocator);
 
     encode(formatter, object);
 
@@ -12,8 +12,6 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balxml_formatter_cpp,"$Id$ $CSID$")
 
-#include <bdlb_print.h>
-
 #include <bsls_assert.h>
 
 #include <bsl_cstring.h>
@@ -186,14 +184,16 @@ void Formatter::addValidCommentImpl(
         isOnSeparateLine = true;
     }
     else {
-        d_outputStream << ' ';
+        put(' ');
         ++d_column;
     }
 
-    d_outputStream << openMarker << comment << closeMarker;
+    put(openMarker);
+    put(comment);
+    put(closeMarker);
 
     if (isOnSeparateLine) {
-        d_outputStream << '\n';
+        put('\n');
         d_column = 0;
     }
     else {
@@ -208,13 +208,52 @@ void Formatter::indent()
     }
 
     if (0 != d_column) {
-        d_outputStream << '\n';
+        put('\n');
     }
 
-    bdlb::Print::indent(d_outputStream, d_indentLevel, d_spacesPerLevel);
+    static const char k_SPACES[] = "                                "
+                                   "                                ";
+        // 64 spaces, written in chunks rather than one at a time
+
+    int numSpaces = d_indentLevel * (d_spacesPerLevel < 0 ? -d_spacesPerLevel
+                                                          : d_spacesPerLevel);
+    while (numSpaces > 0) {
+        const int chunk = bsl::min(numSpaces,
+                                   static_cast<int>(sizeof k_SPACES - 1));
+        put(bslstl::StringRef(k_SPACES, chunk));
+        numSpaces -= chunk;
+    }
     d_column = d_indentLevel * d_spacesPerLevel;
 }
 
+void Formatter::putCloseTag(const bslstl::StringRef& name)
+{
+    enum { k_MAX_SHORT_NAME_LENGTH = 125 };  // fits, with "</>", in 128
+
+    if (name.length() > k_MAX_SHORT_NAME_LENGTH) {
+        put('<');
+        put('/');
+        put(name);
+        put('>');
+        return;                                                       // RETURN
+    }
+
+    // Render the whole tag so that it is written to the stream buffer with a
+    // single (virtual) 'sputn', rather than one for the name and one for the
+    // punctuation around it.
+
+    char        tag[k_MAX_SHORT_NAME_LENGTH + 3];
+    bsl::size_t length = 0;
+
+    tag[length++] = '<';
+    tag[length++] = '/';
+    bsl::memcpy(tag + length, name.data(), name.length());
+    length += name.length();
+    tag[length++] = '>';
+
+    put(bslstl::StringRef(tag, length));
+}
+
 void Formatter::doAddAttribute(const bslstl::StringRef& name,
                                const bslstl::StringRef& value)
 {
@@ -230,10 +269,14 @@ void Formatter::doAddAttribute(const bslstl::StringRef& name,
         --attrLen;
     }
     else {
-        d_outputStream << ' ';
+        put(' ');
     }
 
-    d_outputStream << name << "=\"" << value << '"';
+    put(name);
+    put('=');
+    put('"');
+    put(value);
+    put('"');
     d_column += attrLen;
 }
 
@@ -277,12 +320,12 @@ void Formatter::doAddData(const bslstl::StringRef& value, bool addSpace)
           // false
 
         if (addSpace && !d_isFirstDataAtLine) {
-            d_outputStream << ' ';
+            put(' ');
             ++d_column;
         }
     } // End if (do wrapping)
 
-    d_outputStream << value;
+    put(value);
     d_column += valueLen;
     d_isFirstData = false;
     d_isFirstDataAtLine = false;
@@ -298,7 +341,8 @@ void Formatter::openElement(const bslstl::StringRef& name,
     closeTagIfOpen();
 
     indent();
-    d_outputStream << '<' << name;
+    put('<');
+    put(name);
     d_column += 1 + static_cast<int>(name.length());
 
     if (d_wrapColumn >= 0) {
@@ -322,7 +366,8 @@ void Formatter::closeElement(const bslstl::StringRef& name)
 
     if (e_IN_TAG == d_state) {
         // Empty element (may have attributes but no data).
-        d_outputStream << "/>";
+        put('/');
+        put('>');
         d_column += 2;
     }
     else {
@@ -332,7 +377,7 @@ void Formatter::closeElement(const bslstl::StringRef& name)
             // Indent this line.
             indent();
         }
-        d_outputStream << "</" << name << '>';
+        putCloseTag(name);
         d_column += 3 + static_cast<int>(name.length());
     }
 
@@ -345,7 +390,7 @@ void Formatter::closeElement(const bslstl::StringRef& name)
     }
     else {
         // Non-compact mode: Add newline at end of element.
-        d_outputStream << '\n';
+        put('\n');
         d_column = 0;
         d_isFirstDataAtLine = true;
 
@@ -366,9 +411,11 @@ void Formatter::addHeader(const bslstl::StringRef& encoding)
     // TBD escape encoding?
     static const char startHeader[] = "<?xml version=\"1.0\" encoding=\"";
     static const char endHeader[]   = "\" ?>";
-    d_outputStream << startHeader << encoding << endHeader;
+    put(startHeader);
+    put(encoding);
+    put(endHeader);
     if (d_wrapColumn >= 0) {
-        d_outputStream << '\n';
+        put('\n');
         d_column = 0;
     }
     else {
@@ -381,6 +381,19 @@ class Formatter {
         // level.  If cursor is currently at column 0, indent only, otherwise,
         // go to a new line and indent.
 
+    void put(char character);
+    void put(const bslstl::StringRef& string);
+        // Write the specified 'character' or 'string' directly to the stream
+        // buffer of the output stream, and set 'badbit' in the state of that
+        // stream if it cannot be written in full.  Do nothing unless the
+        // stream is in a good state.  Note that, unlike the formatted output
+        // operators of the stream, these functions neither construct a sentry
+        // nor honor the width of the stream.
+
+    void putCloseTag(const bslstl::StringRef& name);
+        // Write the closing tag, '</name>', of the element of the specified
+        // 'name' to the stream buffer of the output stream as by 'put'.
+
   public:
     // CREATORS
     Formatter(bsl::streambuf   *output,
@@ -629,11 +642,38 @@ balxml::Formatter::WhitespaceType balxml::Formatter::ElemContext::ws() const
 
 namespace balxml {
 // PRIVATE MANIPULATORS
+inline
+void Formatter::put(char character)
+{
+    if (!d_outputStream.good()) {
+        return;                                                       // RETURN
+    }
+
+    if (bsl::ostream::traits_type::eof() ==
+                                   d_outputStream.rdbuf()->sputc(character)) {
+        d_outputStream.setstate(bsl::ios_base::badbit);
+    }
+}
+
+inline
+void Formatter::put(const bslstl::StringRef& string)
+{
+    if (!d_outputStream.good()) {
+        return;                                                       // RETURN
+    }
+
+    const bsl::streamsize length = static_cast<bsl::streamsize>(
+                                                              string.length());
+    if (length != d_outputStream.rdbuf()->sputn(string.data(), length)) {
+        d_outputStream.setstate(bsl::ios_base::badbit);
+    }
+}
+
 inline
 void Formatter::closeTagIfOpen()
 {
     if (e_IN_TAG == d_state) {
-        d_outputStream << '>';
+        put('>');
         ++d_column;
         d_state = e_BETWEEN_TAGS;
     }
@@ -673,12 +713,15 @@ void Formatter::addAttribute(const bslstl::StringRef& name,
     }
     else {
         // Blast attribute to stream without line-wrapping
-        d_outputStream << ' ' << name << "=\"";
+        put(' ');
+        put(name);
+        put('=');
+        put('"');
         TypesPrintUtil::print(d_outputStream,
                               value,
                               formattingMode,
                               &d_encoderOptions);
-        d_outputStream << '"';
+        put('"');
         d_column += static_cast<int>(name.length()) + 4;
                                            // Minimum output if value is empty.
     }
@@ -745,7 +788,7 @@ void Formatter::addListData(const TYPE& value, int formattingMode)
     else {
         // Blast data to stream without line-wrapping
         if (!d_isFirstData) {
-            d_outputStream << ' ';
+            put(' ');
         }
         TypesPrintUtil::print(d_outputStream,
                               value,
@@ -773,9 +816,9 @@ void Formatter::addBlankLine()
 {
     closeTagIfOpen();
     if (d_column > 0) {
-        d_outputStream << '\n';
+        put('\n');
     }
-    d_outputStream << '\n';
+    put('\n');
     d_column = 0;
 }
 
@@ -783,7 +826,7 @@ inline
 void Formatter::addNewline()
 {
     closeTagIfOpen();
-    d_outputStream << '\n';
+    put('\n');
     d_column = 0;
 }
 
@@ -9,6 +9,7 @@
 
 #include <balxml_formatter.h>
 
+#include <bdlsb_fixedmemoutstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 #include <bdlt_datetime.h>
 #include <bdlt_date.h>
@@ -21,6 +22,8 @@
 
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
@@ -543,7 +546,7 @@ int main(int argc, char *argv[])
 
       } break;
 #endif
-      case 23: {
+      case 24: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         // --------------------------------------------------------------------
@@ -721,6 +724,97 @@ int main(int argc, char *argv[])
 //..
       } break;
 
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING writing to a stream buffer
+        //
+        // Concerns:
+        //: 1 That tags, attributes, and data are written in full, in the
+        //:   compact and the pretty styles, including closing tags of
+        //:   elements having names of any length.
+        //:
+        //: 2 That the stream is invalidated once its stream buffer cannot
+        //:   accept all of the output, and that nothing more is written to it.
+        //
+        // Plan:
+        //: 1 For element names of lengths around the longest closing tag that
+        //:   is written at once, in the compact style and in the pretty style
+        //:   with a wrap column that is never reached, format an element
+        //:   having an attribute and data into a 'bdlsb::MemOutStreamBuf', and
+        //:   verify the output.  (C-1)
+        //:
+        //: 2 Format the same document into each prefix of a
+        //:   'bdlsb::FixedMemOutStreamBuf' too short to hold it, and verify
+        //:   that 'status' is non-zero and that the buffer holds a prefix of
+        //:   the expected output.  (C-2)
+        //
+        // Testing:
+        //   void openElement(const bslstl::StringRef& name, ws);
+        //   void closeElement(const bslstl::StringRef& name);
+        //   int status() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) {
+            bsl::cout << "\nTESTING writing to a stream buffer" << bsl::endl;
+        }
+
+        const int LENGTHS[] = { 1, 2, 63, 64, 65, 124, 125, 126, 127, 300 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::string name(LENGTHS[ti], 'n');
+
+            for (int wrapColumn = -1; wrapColumn <= 1000; wrapColumn += 1001) {
+                // A wrap column of 1000 is never reached, so that the pretty
+                // output has no wrapped attributes.
+
+                const bsl::string EXP = -1 == wrapColumn
+                                      ? "<r><" + name + " a=\"&amp;\">d&lt;"
+                                        "</" + name + "></r>"
+                                      : "<r>\n    <" + name + " a=\"&amp;\">"
+                                        "d&lt;</" + name + ">\n</r>\n";
+
+                bdlsb::MemOutStreamBuf sb;
+                balxml::Formatter      mX(&sb, 0, 4, wrapColumn);
+
+                mX.openElement("r");
+                mX.openElement(name);
+                mX.addAttribute("a", "&");
+                mX.addData("d<");
+                mX.closeElement(name);
+                mX.closeElement("r");
+
+                const bsl::string result(sb.data(), sb.length());
+                ASSERTV(LENGTHS[ti], wrapColumn, 0 == mX.status());
+                ASSERTV(LENGTHS[ti], wrapColumn, result, EXP == result);
+
+                for (bsl::size_t size = 0; size < EXP.length(); ++size) {
+                    bsl::vector<char>           buffer(EXP.length(), 'X');
+                    bdlsb::FixedMemOutStreamBuf fsb(buffer.data(), size);
+                    balxml::Formatter           mY(&fsb, 0, 4, wrapColumn);
+
+                    mY.openElement("r");
+                    mY.openElement(name);
+                    mY.addAttribute("a", "&");
+                    mY.addData("d<");
+                    mY.closeElement(name);
+                    mY.closeElement("r");
+
+                    ASSERTV(LENGTHS[ti], wrapColumn, size, 0 != mY.status());
+                    ASSERTV(LENGTHS[ti], wrapColumn, size,
+                            static_cast<bsl::size_t>(fsb.length()) <= size);
+                    ASSERTV(LENGTHS[ti], wrapColumn, size,
+                            0 == bsl::memcmp(buffer.data(),
+                                             EXP.data(),
+                                             fsb.length()));
+                    ASSERTV(LENGTHS[ti], wrapColumn, size,
+                            bsl::string(EXP.length() - size, 'X') ==
+                                 bsl::string(buffer.data() + size,
+                                             EXP.length() - size));
+                }
+            }
+        }
+      } break;
       case 22: {
         // --------------------------------------------------------------------
         // TESTING that add* functions invalidate the stream on failure
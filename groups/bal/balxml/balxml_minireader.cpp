@@ -14,12 +14,21 @@ BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 
 #include <balxml_errorinfo.h>
 
+#include <bdlb_bitutil.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>  // for 'swap'
 #include <bsl_cctype.h>
 #include <bsl_climits.h>
-#include <bsl_cstring.h>    // for 'strlen', 'strcspn', 'memcmp'
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>    // for 'strlen', 'strchr', 'memcmp'
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define U_USE_SSE2 1
+#include <emmintrin.h>
+#endif
 
 // IMPLEMENTATION NOTES
 // --------------------
@@ -106,9 +115,169 @@ BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 //     v
 //    END
 //..
+//
+///Character Scanning
+///------------------
+// Most of the time spent reading is spent looking for the end of a run of
+// characters: the end of a run of spaces, or the next character of a small set
+// ('<', '>', a quote, a space, ...).  These searches are performed by the
+// 'find*' functions below, which, when SSE2 is available, compare 16
+// characters at a time against each character of interest, and use the
+// resulting bit mask to locate the first match; the remaining (fewer than 16)
+// characters of the buffer, and all characters on platforms without SSE2, are
+// compared one at a time.  Each search also stops at '\n' (so that line
+// numbers are maintained) and at a null character (as the 'bsl::strcspn'
+// calls they replace did).
+//
+// Text nodes are scanned for '&' at the same time as for the '<' ending them,
+// so that character references are replaced (in place) only in the text
+// nodes that have them.
 
 namespace {
 
+inline
+bool isBlank(char character)
+{
+    // Return 'true' if the specified 'character' is ' ', '\t', or '\r', and
+    // 'false' otherwise.
+
+    return ' ' == character || '\t' == character || '\r' == character;
+}
+
+inline
+bool isSpace(char character)
+{
+    // Return 'true' if the specified 'character' is one of the XML whitespace
+    // characters (' ', '\t', '\r', and '\n'), and 'false' otherwise.
+
+    return isBlank(character) || '\n' == character;
+}
+
+#ifdef U_USE_SSE2
+inline
+__m128i load(const char *begin)
+{
+    // Return the 16 characters starting at the specified 'begin'.
+
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+}
+
+inline
+__m128i match(__m128i characters, char character)
+{
+    // Return a mask having all bits set in each byte position for which the
+    // corresponding byte of the specified 'characters' is the specified
+    // 'character', and no bits set otherwise.
+
+    return _mm_cmpeq_epi8(characters, _mm_set1_epi8(character));
+}
+
+inline
+int firstSetBit(int mask)
+{
+    // Return the index of the lowest-order set bit in the specified non-zero
+    // 'mask'.
+
+    return BloombergLP::bdlb::BitUtil::numTrailingUnsetBits(
+                                            static_cast<bsl::uint32_t>(mask));
+}
+#endif
+
+char *findNonBlank(char *begin, char *end)
+{
+    // Return the address of the first character in the specified range
+    // '[begin .. end)' that is not ' ', '\t', or '\r', or 'end' if there is
+    // no such character.
+
+#ifdef U_USE_SSE2
+    for (; end - begin >= 16; begin += 16) {
+        const __m128i characters = load(begin);
+        const __m128i blank      = _mm_or_si128(
+                                   _mm_or_si128(match(characters, ' '),
+                                                match(characters, '\t')),
+                                   match(characters, '\r'));
+        const int     mask       = ~_mm_movemask_epi8(blank) & 0xFFFF;
+        if (mask) {
+            return begin + firstSetBit(mask);                         // RETURN
+        }
+    }
+#endif
+
+    while (begin < end && isBlank(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+char *findSymbolOrNewLine(char *begin, char *end, char symbol1, char symbol2)
+{
+    // Return the address of the first character in the specified range
+    // '[begin .. end)' that is the specified 'symbol1' or 'symbol2', '\n', or
+    // a null character, or 'end' if there is no such character.
+
+#ifdef U_USE_SSE2
+    for (; end - begin >= 16; begin += 16) {
+        const __m128i characters = load(begin);
+        const __m128i found      = _mm_or_si128(
+                             _mm_or_si128(match(characters, symbol1),
+                                          match(characters, symbol2)),
+                             _mm_or_si128(match(characters, '\n'),
+                                          match(characters, '\0')));
+        const int     mask       = _mm_movemask_epi8(found);
+        if (mask) {
+            return begin + firstSetBit(mask);                         // RETURN
+        }
+    }
+#endif
+
+    while (begin < end
+        && symbol1 != *begin
+        && symbol2 != *begin
+        && '\n'    != *begin
+        && '\0'    != *begin) {
+        ++begin;
+    }
+    return begin;
+}
+
+char *findSymbolOrSpace(char *begin, char *end, char symbol1, char symbol2)
+{
+    // Return the address of the first character in the specified range
+    // '[begin .. end)' that is the specified 'symbol1' or 'symbol2', a
+    // whitespace character, or a null character, or 'end' if there is no such
+    // character.
+
+#ifdef U_USE_SSE2
+    for (; end - begin >= 16; begin += 16) {
+        const __m128i characters = load(begin);
+        const __m128i space      = _mm_or_si128(
+                                   _mm_or_si128(match(characters, ' '),
+                                                match(characters, '\t')),
+                                   _mm_or_si128(match(characters, '\r'),
+                                                match(characters, '\n')));
+        const __m128i found      = _mm_or_si128(
+                             space,
+                             _mm_or_si128(
+                                    _mm_or_si128(match(characters, symbol1),
+                                                 match(characters, symbol2)),
+                                    match(characters, '\0')));
+        const int     mask       = _mm_movemask_epi8(found);
+        if (mask) {
+            return begin + firstSetBit(mask);                         // RETURN
+        }
+    }
+#endif
+
+    while (begin < end
+        && symbol1 != *begin
+        && symbol2 != *begin
+        && '\0'    != *begin
+        && !isSpace(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
 inline
 const char* nonNullStr(const char *s)
     // Return the specified 's' if 's' != 0, or "" otherwise.  Never returns a
@@ -896,13 +1065,10 @@ MiniReader::searchCommentCDataOrEndElementName(const bsl::string& name)
 {
     BSLS_ASSERT(!name.empty());
 
-    static const char strSet[] = "\n<";
-
     while (1) {
         StringType type = e_STRINGTYPE_NONE;
 
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr += len;
+        d_scanPtr = findSymbolOrNewLine(d_scanPtr, d_endPtr, '<', '<');
         if (d_scanPtr == d_endPtr) { // No chars from 'strSet' found.
             if (readInput() == 0) {
                 d_scanPtr = d_endPtr;
@@ -992,13 +1158,10 @@ MiniReader::searchElementName(const bsl::string& name)
 {
     BSLS_ASSERT(!name.empty());
 
-    static const char strSet[] = { "\n<" };
-
     while (1) {
         StringType type = e_STRINGTYPE_NONE;
 
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr += len;
+        d_scanPtr = findSymbolOrNewLine(d_scanPtr, d_endPtr, '<', '<');
         if (d_scanPtr == d_endPtr) { // No chars from 'strSet' found.
             if (readInput() == 0) {
                 d_scanPtr = d_endPtr;
@@ -1235,8 +1398,7 @@ MiniReader::skipSpaces()
     while (1) {
 
         // skip SPACE, TAB, CR chars
-        size_t len = bsl::strspn(d_scanPtr, "\r\t ");
-        d_scanPtr +=len;
+        d_scanPtr = findNonBlank(d_scanPtr, d_endPtr);
 
         if (checkForNewLine()) {
             ++d_scanPtr;          //skip NL
@@ -1257,12 +1419,9 @@ MiniReader::skipSpaces()
 int
 MiniReader::scanForSymbol(char symbol)
 {
-    char strSet [] = { symbol, '\n', '\0' };
-
     while (1) {
         // find 'symbol' or NL
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = findSymbolOrNewLine(d_scanPtr, d_endPtr, symbol, symbol);
 
         if (symbol == *d_scanPtr) {
             return symbol;                                            // RETURN
@@ -1286,14 +1445,45 @@ MiniReader::scanForSymbol(char symbol)
 }
 
 int
-MiniReader::scanForSymbolOrSpace(char symbol)
+MiniReader::scanForTextEnd(bool *hasReferences)
 {
-    char strSet[] = { symbol, '\n', '\r', '\t', ' ', '\0' };
+    while (1) {
+        // find '<', '&', or NL
+        d_scanPtr = findSymbolOrNewLine(d_scanPtr, d_endPtr, '<', '&');
+
+        if ('<' == *d_scanPtr) {
+            return '<';                                               // RETURN
+        }
+
+        if ('&' == *d_scanPtr) {
+            *hasReferences = true;
+            ++d_scanPtr;          //skip '&'
+            continue;
+        }
+
+        if (checkForNewLine()) {
+            ++d_scanPtr;        //skip NL
+            continue;
+        }
+
+        if (d_scanPtr < d_endPtr) {
+            break;
+        }
+
+        if (readInput() == 0) {
+            return 0;                                                 // RETURN
+        }
+    }
 
+    return *d_scanPtr;
+}
+
+int
+MiniReader::scanForSymbolOrSpace(char symbol)
+{
     while (1) {
         // find 'symbol' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = findSymbolOrSpace(d_scanPtr, d_endPtr, symbol, symbol);
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -1309,14 +1499,9 @@ MiniReader::scanForSymbolOrSpace(char symbol)
 int
 MiniReader::scanForSymbolOrSpace(char symbol1, char symbol2)
 {
-    char strSet [] = {
-        symbol1, symbol2,  '\n', '\r', '\t', ' ', '\0'
-    };
-
     while (1) {
         // find 'symbol1' or 'symbol2' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = findSymbolOrSpace(d_scanPtr, d_endPtr, symbol1, symbol2);
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -1406,7 +1591,11 @@ MiniReader::preAdvance()
       } break;
     }
     currentNode().reset();
-    d_errorInfo.reset();
+    if (!d_errorInfo.isNoError()) {
+        // 'd_errorInfo' is modified only when an error or warning is set.
+
+        d_errorInfo.reset();
+    }
 }
 
 void
@@ -1475,7 +1664,9 @@ MiniReader::scanText()
         return 0;                                                     // RETURN
     }
 
-    ch = scanForSymbol('<');
+    bool hasReferences = false;
+
+    ch = scanForTextEnd(&hasReferences);
     if (ch == '<') {
 
         node.d_endPos = getCurrentPosition();
@@ -1486,7 +1677,9 @@ MiniReader::scanText()
         node.d_type = e_NODE_TYPE_TEXT;
         d_state = ST_TAG_BEGIN;
 
-        replaceCharReferences(const_cast<char *>(node.d_value));
+        if (hasReferences) {
+            replaceCharReferences(const_cast<char *>(node.d_value));
+        }
         return 0;                                                     // RETURN
     }
 
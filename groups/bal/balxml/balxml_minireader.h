@@ -521,6 +521,14 @@ class MiniReader :  public Reader {
         // the symbol is not found, the current position is set to end and
         // returned value is zero.
 
+    int   scanForTextEnd(bool *hasReferences);
+        // Scan for the '<' character ending a text node and set the current
+        // position to it.  Return the character at the new current position.
+        // If '<' is not found, the current position is set to end and
+        // returned value is zero.  Set the specified 'hasReferences' to
+        // 'true' if an '&' character is passed, and leave it unchanged
+        // otherwise.
+
     int   scanForSymbolOrSpace(char symbol1, char symbol2);
     int   scanForSymbolOrSpace(char symbol);
         // Scan one of the specified 'symbol', 'symbol1', or 'symbol2'
@@ -75,30 +75,32 @@ using namespace bsl;
 //
 // [14] advanceToEndNodeRawBare()
 //
-// [15] MiniReader(basicAllocator)
-// [15] MiniReader(bufSize, basicAllocator)
-// [15] ~MiniReader()
-// [15] setPrefixStack(balxml::PrefixStack *prefixes)
-// [15] prefixStack()
-// [15] open()
-// [15] isOpen()
-// [15] documentEncoding()
-// [15] nodeType()
-// [15] nodeName()
-// [15] nodeHasValue()
-// [15] nodeValue()
-// [15] nodeDepth()
-// [15] numAttributes()
-// [15] isEmptyElement()
-// [15] advanceToNextNode()
-// [15] lookupAttribute(ElemAtt a, int index)
-// [15] lookupAttribute(ElemAtt a, char *qname)
-// [15] lookupAttribute(ElemAtt a, char *localname, char *nsUri)
-// [15] lookupAttribute(ElemAtt a, char *localname, int nsId)
+// [15] SCANNING RUNS OF CHARACTERS
+//
+// [16] MiniReader(basicAllocator)
+// [16] MiniReader(bufSize, basicAllocator)
+// [16] ~MiniReader()
+// [16] setPrefixStack(balxml::PrefixStack *prefixes)
+// [16] prefixStack()
+// [16] open()
+// [16] isOpen()
+// [16] documentEncoding()
+// [16] nodeType()
+// [16] nodeName()
+// [16] nodeHasValue()
+// [16] nodeValue()
+// [16] nodeDepth()
+// [16] numAttributes()
+// [16] isEmptyElement()
+// [16] advanceToNextNode()
+// [16] lookupAttribute(ElemAtt a, int index)
+// [16] lookupAttribute(ElemAtt a, char *qname)
+// [16] lookupAttribute(ElemAtt a, char *localname, char *nsUri)
+// [16] lookupAttribute(ElemAtt a, char *localname, int nsId)
 //-----------------------------------------------------------------------------
 // [-1] INTERACTIVE TEST
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -812,7 +814,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -856,6 +858,135 @@ int main(int argc, char *argv[])
 
       } break;
 
+      case 15: {
+        // --------------------------------------------------------------------
+        // SCANNING RUNS OF CHARACTERS
+        //
+        // Concerns:
+        //: 1 Element names, attribute values, text, and runs of spaces of
+        //:   any length, shorter or longer than the blocks of characters
+        //:   compared at once, are found in full.
+        //:
+        //: 2 Character references are replaced in text and attribute values
+        //:   having them, and text and values without them are unchanged.
+        //:
+        //: 3 New lines are counted wherever they appear.
+        //:
+        //: 4 Runs that are split across refills of the reader's buffer are
+        //:   found in full.
+        //
+        // Plan:
+        //: 1 For each length up to 40, build a document having elements
+        //:   whose names, attribute values, text, and preceding runs of ' ',
+        //:   '\t', and '\r' have about that length, some having character
+        //:   references and new lines, and read it with readers having the
+        //:   default and the smallest buffer size, checking each node and,
+        //:   at the end, the line number.  (C-1..4)
+        //
+        // Testing:
+        //   SCANNING RUNS OF CHARACTERS
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nSCANNING RUNS OF CHARACTERS"
+                               << "\n===========================" << bsl::endl;
+
+        enum { k_MAX_LENGTH = 40, k_NUM_ELEMENTS = 40 };
+
+        for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+            const bsl::string name  = "n" + bsl::string(length, 'x');
+            const bsl::string value(length, 'v');
+            const bsl::string text(length, 't');
+
+            bsl::string blanks;
+            for (int i = 0; i < length; ++i) {
+                blanks += " \t\r"[i % 3];
+            }
+
+            bsl::string doc = "<r>";
+            int         numNewLines = 0;
+            for (int k = 0; k < k_NUM_ELEMENTS; ++k) {
+                doc += blanks;
+                doc += "<" + name + " a='" + value;
+                doc += 1 == k % 2 ? "&amp;" : "";
+                doc += "v'>" + text;
+                doc += 1 == k % 2 ? "&lt;" : "";
+                doc += 2 == k % 4 ? "\nline" : "";
+                doc += "t</" + name + ">\n";
+                numNewLines += 2 == k % 4 ? 2 : 1;
+            }
+            doc += "</r>";
+
+            for (int bufSize = 0; bufSize < 2; ++bufSize) {
+                if (veryVerbose) { P_(length) P(bufSize) }
+
+                balxml::NamespaceRegistry namespaces;
+                balxml::PrefixStack       prefixStack(&namespaces);
+                Obj                       mX(bufSize ? 1 : 8192);
+
+                mX.setPrefixStack(&prefixStack);
+                ASSERTV(length, 0 == mX.open(doc.data(), doc.size()));
+
+                int rc = advancePastWhiteSpace(mX);
+                ASSERTV(length, rc, 0 == rc);
+                ASSERTV(length, !bsl::strcmp(mX.nodeName(), "r"));
+
+                for (int k = 0; k < k_NUM_ELEMENTS; ++k) {
+                    const bsl::string expValue =
+                                       value + (1 == k % 2 ? "&" : "") + "v";
+                    const bsl::string expText  =
+                                       text
+                                     + (1 == k % 2 ? "<" : "")
+                                     + (2 == k % 4 ? "\nline" : "")
+                                     + "t";
+
+                    rc = advancePastWhiteSpace(mX);
+                    ASSERTV(length, k, rc, 0 == rc);
+                    ASSERTV(length, k,
+                            balxml::Reader::e_NODE_TYPE_ELEMENT ==
+                                                               mX.nodeType());
+                    ASSERTV(length, k, mX.nodeName(),
+                            name == mX.nodeName());
+                    ASSERTV(length, k, 1 == mX.numAttributes());
+
+                    ElementAttribute attribute;
+                    ASSERTV(length, k, 0 == mX.lookupAttribute(&attribute, 0));
+                    ASSERTV(length, k, !bsl::strcmp(attribute.qualifiedName(),
+                                                    "a"));
+                    ASSERTV(length, k, attribute.value(),
+                            expValue == attribute.value());
+
+                    rc = advancePastWhiteSpace(mX);
+                    ASSERTV(length, k, rc, 0 == rc);
+                    ASSERTV(length, k,
+                            balxml::Reader::e_NODE_TYPE_TEXT == mX.nodeType());
+                    ASSERTV(length, k, mX.nodeValue(),
+                            expText == mX.nodeValue());
+
+                    rc = advancePastWhiteSpace(mX);
+                    ASSERTV(length, k, rc, 0 == rc);
+                    ASSERTV(length, k,
+                            balxml::Reader::e_NODE_TYPE_END_ELEMENT ==
+                                                               mX.nodeType());
+                    ASSERTV(length, k, name == mX.nodeName());
+                }
+
+                rc = advancePastWhiteSpace(mX);
+                ASSERTV(length, rc, 0 == rc);
+                ASSERTV(length,
+                        balxml::Reader::e_NODE_TYPE_END_ELEMENT ==
+                                                               mX.nodeType());
+                ASSERTV(length, !bsl::strcmp(mX.nodeName(), "r"));
+
+                rc = mX.advanceToNextNode();
+                ASSERTV(length, rc, 1 == rc);
+                ASSERTV(length, mX.getLineNumber(), numNewLines,
+                        numNewLines + 1 == mX.getLineNumber());
+
+                mX.close();
+            }
+        }
+      } break;
+
       case 14: {
         // --------------------------------------------------------------------
         // ADVANCE TO END NODE RAW BARE TEST
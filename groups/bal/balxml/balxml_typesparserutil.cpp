@@ -17,6 +17,8 @@ BSLS_IDENT_RCSID(balxml_typesparserutil_cpp,"$Id$ $CSID$")
 #include <balxml_base64parser.h>
 #include <balxml_hexparser.h>
 
+#include <bdlb_floatconversionutil.h>
+
 #include <bdlsb_fixedmeminstreambuf.h>
 
 #include <bdldfp_decimalutil.h>
@@ -176,6 +178,29 @@ int parseDouble(double     *result,
         return BAEXML_FAILURE;                                        // RETURN
     }
 
+    // Plain decimal numbers are parsed in place.  Other forms (special values,
+    // hexadecimal numbers, and numbers with leading whitespace) are left to
+    // 'parseDoubleImpl'.
+
+    double value;
+    if (0 == bdlb::FloatConversionUtil::parseDouble(
+                                   &value,
+                                   bslstl::StringRef(input, inputLength))) {
+        if (formatDecimal && (bsl::memchr(input, 'e', inputLength)
+                           || bsl::memchr(input, 'E', inputLength))) {
+            // Exponential notation is not allowed.
+            return BAEXML_FAILURE;                                    // RETURN
+        }
+
+        if (value - value != 0) {
+            // Overflow is an error.
+            return BAEXML_FAILURE;                                    // RETURN
+        }
+
+        *result = value;
+        return BAEXML_SUCCESS;                                        // RETURN
+    }
+
     if (inputLength < BUFLEN) {
         // Use a fixed-length buffer for efficiency.
         char  buffer[BUFLEN];
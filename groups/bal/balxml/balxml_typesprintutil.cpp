@@ -12,6 +12,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 
+#include <bdlb_floatconversionutil.h>
 #include <bdlb_print.h>
 #include <bdlde_base64encoder.h>
 #include <bdldfp_decimalutil.h>
@@ -20,11 +21,12 @@ BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cfloat.h>
+#include <bsl_cstddef.h>
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>
-#include <bsl_iterator.h>
 
 namespace BloombergLP {
 
@@ -33,35 +35,51 @@ namespace u {
 
 // HELPER FUNCTIONS
 
-template <class INPUT_ITERATOR>
 bsl::ostream& encodeBase64(bsl::ostream&  stream,
-                           INPUT_ITERATOR begin,
-                           INPUT_ITERATOR end)
-    // Write the base64 encoding of the character sequence defined by the
-    // specified 'begin' and 'end' iterators into the specified 'stream' and
-    // return 'stream'.  Each instantiation of this private function is called
-    // only once (by the functions below) and can thus be inlined without
-    // causing code bloat.
+                           const char    *data,
+                           bsl::size_t    length)
+    // Write the base64 encoding of the specified 'data' having the specified
+    // 'length' into the specified 'stream' and return 'stream'.
 {
-    bdlde::Base64Encoder base64Encoder(0);  // 0 means do not insert CRLF
+    // Encode in chunks of a whole number of 3-byte quanta so that each chunk
+    // is encoded without padding (except, possibly, the last one).
 
-    {
-        bsl::ostreambuf_iterator<char> outputIterator(stream);
+    enum { k_CHUNK_LENGTH = 3 * 1024 };
 
-        int status = base64Encoder.convert(outputIterator, begin, end);
-        (void)status; BSLS_ASSERT(0 == status);  // nothing should be retained
-    }
+    char buffer[k_CHUNK_LENGTH / 3 * 4];
 
-    {
-        bsl::ostreambuf_iterator<char> outputIterator(stream);
+    while (length) {
+        const bsl::size_t chunkLength = bsl::min<bsl::size_t>(length,
+                                                              k_CHUNK_LENGTH);
+        const bsl::size_t numOut = bdlde::Base64Encoder::encode(
+                                                   buffer,
+                                                   data,
+                                                   chunkLength,
+                                                   0);  // 0 means no CRLF
+        stream.write(buffer, numOut);
 
-        int status = base64Encoder.endConvert(outputIterator);
-        (void)status; BSLS_ASSERT(0 == status);  // nothing should be retained
+        data   += chunkLength;
+        length -= chunkLength;
     }
 
     return stream;
 }
 
+void write(bsl::ostream& stream, const char *data, bsl::ptrdiff_t length)
+    // Write the specified 'data' having the specified 'length' directly to
+    // the stream buffer of the specified 'stream', and set 'badbit' in the
+    // state of 'stream' if it cannot be written in full.  Do nothing unless
+    // 'stream' is in a good state.
+{
+    if (0 == length || !stream.good()) {
+        return;                                                       // RETURN
+    }
+
+    if (length != stream.rdbuf()->sputn(data, length)) {
+        stream.setstate(bsl::ios_base::badbit);
+    }
+}
+
 const char *printTextReplacingXMLEscapes(
                                      bsl::ostream&                 stream,
                                      const char                   *data,
@@ -80,11 +98,12 @@ const char *printTextReplacingXMLEscapes(
     // IMPLEMENTATION NOTE: This implementation does not buffer the output, for
     // two reasons.  The first is that most ostream's are buffered already.
     // The second is that most of the input will be simply copied, in-between
-    // two XML escapes, so that the 'stream.write()' method can readily be used
-    // on the input buffer.  If there are a lot of XML escapes, the text
-    // transcription of these escapes will take time already so the extra time
-    // taken by these small 'stream.write()' operations (even if these are
-    // virtual function calls) should not unduly slow down the program.
+    // two XML escapes, so that each run can readily be written from the input
+    // buffer with a single 'write()' to the stream buffer.  If there are a lot
+    // of XML escapes, the text transcription of these escapes will take time
+    // already so the extra time taken by these small 'write()' operations
+    // (even if these are virtual function calls) should not unduly slow down
+    // the program.
 
     // For efficiency, we use a table-driven implementation.
 
@@ -372,11 +391,22 @@ const char *printTextReplacingXMLEscapes(
                                              : (const char *)-1;
 
     while (data < end) {
+        // Skip the run of printable characters, which in most text is all of
+        // it, in a loop that does nothing else.
+
+        while (data < end
+            && PRINTABLE_ASCII == ESCAPED_CHARS_TABLE[(unsigned char)*data]) {
+            ++data;
+        }
+        if (!(data < end)) {
+            break;
+        }
+
         // The logic is to test if the current character should interrupt the
         // current run of printable characters and, if so, flush the run to the
         // stream, output the special character, and continue.  For efficiency,
-        // we replicate the calls to 'stream.write(...)' in order to perform a
-        // single test per character.
+        // we replicate the calls to 'write(...)' in order to perform a single
+        // test per character.
 
         switch (ESCAPED_CHARS_TABLE[(unsigned char)*data]) {
           case END_OF_STRING: {
@@ -385,7 +415,7 @@ const char *printTextReplacingXMLEscapes(
             // success.  Otherwise we should treat as unencodable.
 
             if (dataLength == -1) {
-                stream.write(runBegin, data - runBegin);
+                write(stream, runBegin, data - runBegin);
                 return 0;                                             // RETURN
             }
           } BSLA_FALLTHROUGH;
@@ -396,7 +426,7 @@ const char *printTextReplacingXMLEscapes(
             // explicitly say so.
 
             if (!options || !options->allowControlCharacters()) {
-                stream.write(runBegin, data - runBegin);
+                write(stream, runBegin, data - runBegin);
                 stream.setstate(bsl::ios_base::failbit);
                 return data;  // error position                       // RETURN
             }
@@ -406,50 +436,50 @@ const char *printTextReplacingXMLEscapes(
             // Unencodable characters are simply not allowed.  Flush current
             // run and exit.
 
-            stream.write(runBegin, data - runBegin);
+            write(stream, runBegin, data - runBegin);
             stream.setstate(bsl::ios_base::failbit);
             return data;  // error position                           // RETURN
           } break;
 
           case AMPERSAND: {
-            stream.write(runBegin, data - runBegin);
+            write(stream, runBegin, data - runBegin);
             static const char amp[] = "&amp;";
-            stream.write(amp, sizeof(amp) - 1);
+            write(stream, amp, sizeof(amp) - 1);
             runBegin = ++data;
           } break;
 
           case LESS_THAN: {
-            stream.write(runBegin, data - runBegin);
+            write(stream, runBegin, data - runBegin);
             static const char lt[] = "&lt;";
-            stream.write(lt, sizeof(lt) - 1);
+            write(stream, lt, sizeof(lt) - 1);
             runBegin = ++data;
           } break;
 
           case GREATER_THAN: {
-            stream.write(runBegin, data - runBegin);
+            write(stream, runBegin, data - runBegin);
             static const char gt[] = "&gt;";
-            stream.write(gt, sizeof(gt) - 1);
+            write(stream, gt, sizeof(gt) - 1);
             runBegin = ++data;
           } break;
 
           case APOSTROPHE: {
-            stream.write(runBegin, data - runBegin);
+            write(stream, runBegin, data - runBegin);
             static const char apos[] = "&apos;";
-            stream.write(apos, sizeof(apos) - 1);
+            write(stream, apos, sizeof(apos) - 1);
             runBegin = ++data;
           } break;
 
           case QUOTE: {
-            stream.write(runBegin, data - runBegin);
+            write(stream, runBegin, data - runBegin);
             static const char quot[] = "&quot;";
-            stream.write(quot, sizeof(quot) - 1);
+            write(stream, quot, sizeof(quot) - 1);
             runBegin = ++data;
           } break;
 
           // In remaining cases, including default, do not interrupt current
           // run, in other words, do not issue:
           //..
-          //  stream.write(runBegin, data - runBegin);
+          //  write(stream, runBegin, data - runBegin);
           //..
           // Simply move on while keeping 'runBegin' pegged to the beginning
           // of the run.
@@ -460,7 +490,7 @@ const char *printTextReplacingXMLEscapes(
             // run and exit.
 
             if (!(data + 1 < end) || (*(data + 1) & 0xc0) != 0x80) {
-                stream.write(runBegin, data - runBegin);
+                write(stream, runBegin, data - runBegin);
                 stream.setstate(bsl::ios_base::failbit);
                 return data;  // error position                       // RETURN
             }
@@ -474,7 +504,7 @@ const char *printTextReplacingXMLEscapes(
 
             if (!(data + 2 < end) || (*(data + 1) & 0xc0) != 0x80
                                   || (*(data + 2) & 0xc0) != 0x80) {
-                stream.write(runBegin, data - runBegin);
+                write(stream, runBegin, data - runBegin);
                 stream.setstate(bsl::ios_base::failbit);
                 return data;  // error position                       // RETURN
             }
@@ -489,7 +519,7 @@ const char *printTextReplacingXMLEscapes(
 
             if (!(data + 2 < end) || (*(data + 1) & 0xe0) != 0xa0
                                   || (*(data + 2) & 0xc0) != 0x80) {
-                stream.write(runBegin, data - runBegin);
+                write(stream, runBegin, data - runBegin);
                 stream.setstate(bsl::ios_base::failbit);
                 return data;  // error position                       // RETURN
             }
@@ -504,7 +534,7 @@ const char *printTextReplacingXMLEscapes(
 
             if (!(data + 2 < end) || (*(data + 1) & 0xe0) != 0x80
                                   || (*(data + 2) & 0xc0) != 0x80) {
-                stream.write(runBegin, data - runBegin);
+                write(stream, runBegin, data - runBegin);
                 stream.setstate(bsl::ios_base::failbit);
                 return data;  // error position                       // RETURN
             }
@@ -519,7 +549,7 @@ const char *printTextReplacingXMLEscapes(
             if (!(data + 3 < end) || (*(data + 1) & 0xc0) != 0x80
                                   || (*(data + 2) & 0xc0) != 0x80
                                   || (*(data + 3) & 0xc0) != 0x80) {
-                stream.write(runBegin, data - runBegin);
+                write(stream, runBegin, data - runBegin);
                 stream.setstate(bsl::ios_base::failbit);
                 return data;  // error position                       // RETURN
             }
@@ -535,7 +565,7 @@ const char *printTextReplacingXMLEscapes(
             if (!(data + 3 < end)
              || !((*(data + 1) & 0xc0) == 0x80 && (*(data + 1) & 0x90) != 0x00)
              || (*(data + 2) & 0xc0) != 0x80 || (*(data + 3) & 0xc0) != 0x80) {
-                stream.write(runBegin, data - runBegin);
+                write(stream, runBegin, data - runBegin);
                 stream.setstate(bsl::ios_base::failbit);
                 return data;  // error position                       // RETURN
             }
@@ -551,7 +581,7 @@ const char *printTextReplacingXMLEscapes(
             if (!(data + 3 < end) || (*(data + 1) & 0xf0) != 0x80
                                   || (*(data + 2) & 0xc0) != 0x80
                                   || (*(data + 3) & 0xc0) != 0x80) {
-                stream.write(runBegin, data - runBegin);
+                write(stream, runBegin, data - runBegin);
                 stream.setstate(bsl::ios_base::failbit);
                 return data;  // error position                       // RETURN
             }
@@ -567,7 +597,7 @@ const char *printTextReplacingXMLEscapes(
 
     // Flush the rest of the printable characters in the buffer to stream.
 
-    stream.write(runBegin, data - runBegin);
+    write(stream, runBegin, data - runBegin);
     return 0;
 }
 
@@ -797,7 +827,7 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&               stream,
                                 bdlat_TypeCategory::Simple)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream, object.data(), object.length());
 }
 
 bsl::ostream&
@@ -807,7 +837,7 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&               stream,
                                 bdlat_TypeCategory::Simple)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream, object.data(), object.length());
 }
 
 bsl::ostream&
@@ -817,7 +847,9 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&              stream,
                                 bdlat_TypeCategory::Array)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream,
+                           object.empty() ? 0 : &object[0],
+                           object.size());
 }
 
 // HEX FUNCTIONS
@@ -986,24 +1018,13 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
-
-        char buffer[FLT_DIG + 20];  // buffer with headroom
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len =
-                    bsl::sprintf(buffer, "%.*g", FLT_DIG + 1, (double) object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
+        // Write the text of "%.*g" with 'FLT_DIG + 1' significant digits,
+        // without calling 'sprintf'.
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+        char      buffer[bdlb::FloatConversionUtil::k_MAX_FORMATTED_LENGTH];
+        const int len = bdlb::FloatConversionUtil::formatGeneral(buffer,
+                                                                 object,
+                                                                 FLT_DIG + 1);
 
         stream.write(buffer, len);
       } break;
@@ -1032,23 +1053,14 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Write the shortest text that is parsed back to 'object', in the
+        // notation of the "%.*g" format with 'DBL_DIG + 1' digits, which was
+        // used before.
 
-        char buffer[DBL_DIG + 20];  // buffer with headroom
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len = bsl::sprintf(buffer, "%.*g", DBL_DIG + 1, object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+        char      buffer[bdlb::FloatConversionUtil::k_MAX_FORMATTED_LENGTH];
+        const int len = bdlb::FloatConversionUtil::formatShortest(buffer,
+                                                                  object,
+                                                                  DBL_DIG + 1);
 
         stream.write(buffer, len);
       } break;
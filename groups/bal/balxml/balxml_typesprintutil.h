@@ -105,6 +105,19 @@ BSLS_IDENT("$Id: $")
 //      Enumeration                         TEXT
 //..
 //
+///Default Formatting of 'double'
+///------------------------------
+// 'printDefault' writes a finite 'double' with the shortest significant
+// digits that are parsed back to the same value, in the notation of the
+// "%.16g" format of 'printf': scientific notation ('d.ddde+XX') if the decimal
+// exponent of the value is less than -4 or at least 16, and fixed notation
+// otherwise.  Earlier versions wrote the text of "%.16g" itself, which may
+// lose the value, so that some values are now written differently (e.g.,
+// '0.1 + 0.2' is written as "0.30000000000000004" instead of "0.3", and the
+// smallest subnormal value as "5e-324" instead of "4.940656458412465e-324").
+// The notation of a value is unchanged.  Infinities and NaNs are written as
+// "+INF", "-INF", and "NaN".
+//
 ///Behavior of 'printText' on Non-Valid Strings
 ///--------------------------------------------
 // The output of 'printText' will always be valid XML 1.0 with UTF-8 encoding.
@@ -1710,6 +1710,28 @@ int main(int argc, char *argv[])
                 { L_,     1.0,        "1"              },
                 { L_,123456789012345.0, "123456789012345"},
                 { L_,1.23456789012345e105,"1.23456789012345e+105"  },
+
+                // round trip
+                { L_,     0.1 + 0.2,  "0.30000000000000004"        },
+                { L_,     1.0 / 3,    "0.3333333333333333"         },
+                { L_,1.7976931348623157e308,"1.7976931348623157e+308"},
+
+                // large integers
+                { L_,9007199254740993.0, "9007199254740992"        },
+                { L_,1e16,            "1e+16"                      },
+                { L_,12345678901234568.0,"1.2345678901234568e+16"  },
+                { L_,123456789012345678.0,"1.2345678901234568e+17" },
+
+                // subnormal
+                { L_,4.9406564584124654e-324, "5e-324"             },
+                { L_,2.2250738585072009e-308,"2.225073858507201e-308"},
+
+                // notation switch
+                { L_,     0.0001,     "0.0001"                     },
+                { L_,     0.00001,    "1e-05"                      },
+                { L_,     1e15,       "1000000000000000"           },
+                { L_,9999999999999998.0, "9999999999999998"        },
+
                 { L_,  bsl::numeric_limits<double>::infinity(), "+INF"},
                 { L_, -bsl::numeric_limits<double>::infinity(), "-INF"},
                 { L_,  bsl::numeric_limits<double>::signaling_NaN(), "NaN"},
@@ -1726,6 +1748,11 @@ int main(int argc, char *argv[])
                 Util::printDefault(ss, INPUT);
 
                 LOOP2_ASSERT(LINE, ss.str(), RESULT == ss.str());
+
+                if (bdlb::Float::isFinite(INPUT)) {
+                    LOOP2_ASSERT(LINE, ss.str(),
+                                 INPUT == bsl::strtod(ss.str().c_str(), 0));
+                }
             }
         }
 
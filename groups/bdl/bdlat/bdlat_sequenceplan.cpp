@@ -0,0 +1,84 @@
+// bdlat_sequenceplan.cpp                                             -*-C++-*-
+#include <bdlat_sequenceplan.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlat_sequenceplan_cpp,"$Id$ $CSID$")
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+
+namespace {
+
+enum { k_MIN_NUM_SLOTS = 8 };  // size of the smallest hash table
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class bdlat_SequencePlan
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+void bdlat_SequencePlan::insertSlot(int index)
+{
+    const bdlat_AttributeInfo& info = d_attributes[index].d_info;
+    const bsl::size_t          mask = d_slots.size() - 1;
+
+    bsl::size_t slot = hash(info.name(), info.nameLength()) & mask;
+    while (0 != d_slots[slot]) {
+        const bdlat_AttributeInfo& other =
+                                       d_attributes[d_slots[slot] - 1].d_info;
+        if (other.nameLength() == info.nameLength()
+         && 0 == bsl::memcmp(other.name(), info.name(), info.nameLength())) {
+            // Keep the attribute added first.
+
+            return;                                                   // RETURN
+        }
+        slot = (slot + 1) & mask;
+    }
+    d_slots[slot] = index + 1;
+}
+
+// MANIPULATORS
+void bdlat_SequencePlan::addAttribute(const bdlat_AttributeInfo& info,
+                                      bool                       isNullable)
+{
+    Attribute attribute = { info, isNullable };
+    d_attributes.push_back(attribute);
+
+    const int numAttributes = static_cast<int>(d_attributes.size());
+
+    if (2 * d_attributes.size() <= d_slots.size()) {
+        insertSlot(numAttributes - 1);
+        return;                                                       // RETURN
+    }
+
+    // Keep the hash table at most half full, so that probes are short.
+
+    bsl::size_t numSlots = k_MIN_NUM_SLOTS;
+    while (numSlots < 2 * d_attributes.size()) {
+        numSlots *= 2;
+    }
+    d_slots.assign(numSlots, 0);
+    for (int i = 0; i < numAttributes; ++i) {
+        insertSlot(i);
+    }
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,602 @@
+// bdlat_sequenceplan.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLAT_SEQUENCEPLAN
+#define INCLUDED_BDLAT_SEQUENCEPLAN
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a cached per-type index of the attributes of sequences.
+//
+//@CLASSES:
+//  bdlat_SequencePlan: hash index of the attributes of a "sequence" type
+//  bdlat_SequencePlanUtil: namespace for finding attributes through plans
+//
+//@SEE_ALSO: bdlat_sequencefunctions, bdlat_attributeinfo
+//
+//@DESCRIPTION: This component provides a class, 'bdlat_SequencePlan', that
+// indexes the attributes of a "sequence" type by name, and a utility
+// 'struct', 'bdlat_SequencePlanUtil', that builds such a plan once for each
+// generated "sequence" type and uses it to find and manipulate attributes by
+// name.
+//
+// Decoders of textual formats, such as XML and JSON, identify the attributes
+// of a sequence by name, and the name lookup of generated types
+// ('lookupAttributeInfo') compares the name with the name of each attribute
+// in turn.  For sequences having many attributes, this comparison can take a
+// significant part of the decoding time, and it is often done twice for each
+// element: once to find whether the attribute exists, and once more to
+// manipulate it.  A 'bdlat_SequencePlan' finds an attribute from its name in
+// a hash table, and records, for each attribute, its 'bdlat_AttributeInfo'
+// (that includes its formatting mode) and whether it is of a "nullable" type.
+//
+///Plans and Their Lifetime
+///------------------------
+// 'bdlat_SequencePlanUtil::plan' returns the plan of types having the
+// 'bdlat_TypeTraitBasicSequence' trait (i.e., of types generated by
+// 'bas_codegen.pl'), whose attributes do not depend on the object.  The plan
+// of such a type is built from the attributes reported by
+// 'bdlat_SequenceFunctions::accessAttributes' for the first object of the
+// type that is supplied, and is then shared, unmodified, by all threads for
+// the lifetime of the program: it is allocated from the global allocator, and
+// never deallocated.  Other "sequence" types, such as dynamic
+// types, have no plan.
+//
+///Name Lookup
+///-----------
+// 'bdlat_SequencePlanUtil::hasAttribute' and
+// 'bdlat_SequencePlanUtil::manipulateAttribute' have the contracts of the
+// functions of the same names in 'bdlat_SequenceFunctions', in place of which
+// they can be called.  If the type has a plan, and the name is exactly that
+// of one of its attributes, the attribute is found in the plan, and is
+// manipulated through its id, which generated types resolve with a 'switch'
+// statement.  Otherwise, the functions of 'bdlat_SequenceFunctions' are
+// called with the name, so that the names accepted by a type are unchanged:
+// for example, the case-insensitive names accepted by some generated types,
+// and the names of the selections of anonymous choices that some generated
+// types accept as names of the attribute holding the choice, are still found.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Manipulating an Attribute Named in a Message
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are writing a decoder that reads the names of the
+// attributes of a sequence from a message, and must then decode the value
+// following each name into the attribute of that name.
+//
+// First, we define a manipulator that loads an integer value into an
+// attribute (a real decoder would parse the value from the message):
+//..
+//  struct LoadValue {
+//      // This 'struct' provides a manipulator that loads 'd_value' into
+//      // the integer attributes of a sequence.
+//
+//      // DATA
+//      int d_value;  // value to load
+//
+//      // MANIPULATORS
+//      int operator()(int *attribute, const bdlat_AttributeInfo&)
+//          // Load 'd_value' into the specified 'attribute' and return 0.
+//      {
+//          *attribute = d_value;
+//          return 0;
+//      }
+//
+//      template <class TYPE>
+//      int operator()(TYPE *, const bdlat_AttributeInfo&)
+//          // Return a non-zero value.
+//      {
+//          return -1;
+//      }
+//  };
+//..
+// Then, we write a function that manipulates the attribute having a given
+// name, calling 'bdlat_SequencePlanUtil::manipulateAttribute' where we would
+// otherwise call 'bdlat_SequenceFunctions::manipulateAttribute':
+//..
+//  template <class TYPE>
+//  int loadAttribute(TYPE *object, const char *name, int value)
+//      // Load the specified 'value' into the attribute of the specified
+//      // 'object' having the specified 'name'.  Return 0 on success, and a
+//      // non-zero value if 'object' has no such integer attribute.
+//  {
+//      LoadValue manipulator = { value };
+//      return bdlat_SequencePlanUtil::manipulateAttribute(
+//                                        object,
+//                                        manipulator,
+//                                        name,
+//                                        static_cast<int>(bsl::strlen(name)));
+//  }
+//..
+// Finally, we use this function to set an attribute of a generated type,
+// 'test::Employee', having the integer attribute 'age':
+//..
+//  test::Employee employee;
+//
+//  assert(0 == loadAttribute(&employee, "age", 21));
+//  assert(21 == employee.age());
+//
+//  assert(0 != loadAttribute(&employee, "salary", 1000));
+//..
+// Note that the first call built the plan of 'test::Employee', which the
+// second call, and all later calls in any thread, use.
+
+#include <bdlscm_version.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typecategory.h>
+#include <bdlat_typetraits.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_integralconstant.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+
+                          // ========================
+                          // class bdlat_SequencePlan
+                          // ========================
+
+class bdlat_SequencePlan {
+    // This class provides an index of the attributes of a "sequence" type,
+    // holding the information about each attribute, and a hash table that
+    // finds an attribute from its name.
+
+    // PRIVATE TYPES
+    struct Attribute {
+        // This 'struct' holds what a plan records about one attribute.
+
+        bdlat_AttributeInfo d_info;        // information about the attribute
+        bool                d_isNullable;  // 'true' if the attribute is of a
+                                           // "nullable" type
+    };
+
+    // DATA
+    bsl::vector<Attribute> d_attributes;  // attributes, in the order added
+
+    bsl::vector<int>       d_slots;       // open-addressing hash table of
+                                          // 1 + the index of an attribute
+                                          // in 'd_attributes', or 0 for an
+                                          // empty slot, whose size is a
+                                          // power of 2
+
+    // PRIVATE CLASS METHODS
+    static unsigned int hash(const char *name, int nameLength);
+        // Return the hash value of the specified 'name' having the specified
+        // 'nameLength'.
+
+    // PRIVATE MANIPULATORS
+    void insertSlot(int index);
+        // Insert into the hash table of this plan the attribute at the
+        // specified 'index'.  The behavior is undefined unless the hash table
+        // has an empty slot.
+
+    // NOT IMPLEMENTED
+    bdlat_SequencePlan(const bdlat_SequencePlan&);
+    bdlat_SequencePlan& operator=(const bdlat_SequencePlan&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(bdlat_SequencePlan,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit bdlat_SequencePlan(bslma::Allocator *basicAllocator = 0);
+        // Create a plan having no attributes.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! ~bdlat_SequencePlan() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void addAttribute(const bdlat_AttributeInfo& info, bool isNullable);
+        // Add to this plan an attribute described by the specified 'info',
+        // that is of a "nullable" type if the specified 'isNullable' is
+        // 'true'.  The behavior is undefined unless the name of 'info'
+        // remains valid for the lifetime of this plan.  Note that if several
+        // attributes have the same name, 'lookupIndex' finds the first one
+        // added.
+
+    // ACCESSORS
+    const bdlat_AttributeInfo& attributeInfo(int index) const;
+        // Return a reference providing non-modifiable access to the
+        // information about the attribute at the specified 'index' in this
+        // plan.  The behavior is undefined unless
+        // '0 <= index < numAttributes()'.
+
+    bool isNullable(int index) const;
+        // Return 'true' if the attribute at the specified 'index' in this
+        // plan is of a "nullable" type, and 'false' otherwise.  The behavior
+        // is undefined unless '0 <= index < numAttributes()'.
+
+    int lookupIndex(const char *name, int nameLength) const;
+        // Return the index in this plan of the attribute whose name is the
+        // specified 'name' having the specified 'nameLength', compared
+        // case-sensitively, and -1 if there is no such attribute.  The
+        // behavior is undefined unless '0 <= nameLength', and 'name' refers
+        // to at least 'nameLength' characters.
+
+    int numAttributes() const;
+        // Return the number of attributes in this plan.
+};
+
+                       // ============================
+                       // struct bdlat_SequencePlanUtil
+                       // ============================
+
+struct bdlat_SequencePlanUtil {
+    // This 'struct' provides a namespace for functions that build and cache
+    // the plan of a "sequence" type, and that find the attributes of a
+    // sequence through its plan.
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class TYPE>
+    static const bdlat_SequencePlan *planImp(const TYPE& object,
+                                             bsl::true_type);
+    template <class TYPE>
+    static const bdlat_SequencePlan *planImp(const TYPE& object,
+                                             bsl::false_type);
+        // Return the plan of 'TYPE', built from the specified 'object' on
+        // the first call, for types having the 'bdlat_TypeTraitBasicSequence'
+        // trait, and 0 for other types.
+
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttributeImp(TYPE         *object,
+                                      MANIPULATOR&  manipulator,
+                                      const char   *attributeName,
+                                      int           attributeNameLength,
+                                      bsl::true_type);
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttributeImp(TYPE         *object,
+                                      MANIPULATOR&  manipulator,
+                                      const char   *attributeName,
+                                      int           attributeNameLength,
+                                      bsl::false_type);
+        // Invoke the specified 'manipulator' on the attribute of the
+        // specified 'object' having the specified 'attributeName' of the
+        // specified 'attributeNameLength', found through the plan of 'TYPE'
+        // for types having the 'bdlat_TypeTraitBasicSequence' trait, and by
+        // 'object' for other types, and return the result of the invocation,
+        // or a non-zero value if the attribute is not found.
+
+  public:
+    // CLASS METHODS
+    template <class TYPE>
+    static bool hasAttribute(const TYPE&  object,
+                             const char  *attributeName,
+                             int          attributeNameLength);
+        // Return 'true' if the specified 'object' has an attribute having the
+        // specified 'attributeName' of the specified 'attributeNameLength',
+        // and 'false' otherwise.  The name is looked up in the plan of
+        // 'TYPE', and, if 'TYPE' has no plan or the name is not exactly that
+        // of one of its attributes, by
+        // 'bdlat_SequenceFunctions::hasAttribute'.  The behavior is undefined
+        // unless 'TYPE' is a "sequence" type.
+
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttribute(TYPE         *object,
+                                   MANIPULATOR&  manipulator,
+                                   const char   *attributeName,
+                                   int           attributeNameLength);
+        // Invoke the specified 'manipulator' on the address of the
+        // (modifiable) attribute of the specified 'object' having the
+        // specified 'attributeName' of the specified 'attributeNameLength',
+        // supplying 'manipulator' with the corresponding attribute
+        // information structure.  Return a non-zero value if the attribute is
+        // not found, and the value returned from the invocation of
+        // 'manipulator' otherwise.  If the name is exactly that of an
+        // attribute in the plan of 'TYPE', the attribute is manipulated
+        // through its id; otherwise, it is manipulated through
+        // 'bdlat_SequenceFunctions::manipulateAttribute' with the name.  The
+        // behavior is undefined unless 'TYPE' is a "sequence" type.
+
+    template <class TYPE>
+    static const bdlat_SequencePlan *plan(const TYPE& object);
+        // Return the address of the plan of 'TYPE', building it from the
+        // attributes of the specified 'object' if this is the first call for
+        // 'TYPE', if 'TYPE' has the 'bdlat_TypeTraitBasicSequence' trait, and
+        // 0 otherwise.  The behavior is undefined unless 'TYPE' is a
+        // "sequence" type.  Note that the plan is shared by all threads, and
+        // is never destroyed.
+};
+
+                      // ================================
+                      // class bdlat_SequencePlan_Builder
+                      // ================================
+
+class bdlat_SequencePlan_Builder {
+    // This component-private class provides an accessor that adds to a plan
+    // each attribute on which it is invoked.
+
+    // DATA
+    bdlat_SequencePlan *d_plan_p;  // plan to build (held, not owned)
+
+  public:
+    // CREATORS
+    explicit bdlat_SequencePlan_Builder(bdlat_SequencePlan *plan);
+        // Create a builder that adds attributes to the specified 'plan'.
+
+    // MANIPULATORS
+    template <class TYPE>
+    int operator()(const TYPE& attribute, const bdlat_AttributeInfo& info);
+        // Add to the plan of this builder the specified 'attribute' described
+        // by the specified 'info', and return 0.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class bdlat_SequencePlan
+                          // ------------------------
+
+// PRIVATE CLASS METHODS
+inline
+unsigned int bdlat_SequencePlan::hash(const char *name, int nameLength)
+{
+    // Hash only the length and the first and last characters, which, unlike
+    // the common prefixes of generated names (e.g., "element1", "element2"),
+    // tell most attribute names apart, so that the hash takes the same time
+    // for names of any length.
+
+    if (0 == nameLength) {
+        return 0;                                                     // RETURN
+    }
+
+    const unsigned int first = static_cast<unsigned char>(name[0]);
+    const unsigned int last  = static_cast<unsigned char>(
+                                                        name[nameLength - 1]);
+
+    return (first * 31 + static_cast<unsigned int>(nameLength)) * 31 + last;
+}
+
+// CREATORS
+inline
+bdlat_SequencePlan::bdlat_SequencePlan(bslma::Allocator *basicAllocator)
+: d_attributes(basicAllocator)
+, d_slots(basicAllocator)
+{
+}
+
+// ACCESSORS
+inline
+const bdlat_AttributeInfo& bdlat_SequencePlan::attributeInfo(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numAttributes());
+
+    return d_attributes[index].d_info;
+}
+
+inline
+bool bdlat_SequencePlan::isNullable(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numAttributes());
+
+    return d_attributes[index].d_isNullable;
+}
+
+inline
+int bdlat_SequencePlan::lookupIndex(const char *name, int nameLength) const
+{
+    BSLS_ASSERT(name || 0 == nameLength);
+    BSLS_ASSERT(0 <= nameLength);
+
+    if (d_slots.empty()) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t mask = d_slots.size() - 1;
+
+    bsl::size_t slot = hash(name, nameLength) & mask;
+    while (0 != d_slots[slot]) {
+        const int                  index = d_slots[slot] - 1;
+        const bdlat_AttributeInfo& info  = d_attributes[index].d_info;
+        if (info.nameLength() == nameLength
+         && 0 == bsl::memcmp(info.name(), name, nameLength)) {
+            return index;                                             // RETURN
+        }
+        slot = (slot + 1) & mask;
+    }
+    return -1;
+}
+
+inline
+int bdlat_SequencePlan::numAttributes() const
+{
+    return static_cast<int>(d_attributes.size());
+}
+
+                       // ----------------------------
+                       // struct bdlat_SequencePlanUtil
+                       // ----------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+const bdlat_SequencePlan *bdlat_SequencePlanUtil::planImp(const TYPE& object,
+                                                          bsl::true_type)
+{
+    static bsls::AtomicOperations::AtomicTypes::Pointer s_plan = { 0 };
+
+    const bdlat_SequencePlan *result = static_cast<const bdlat_SequencePlan *>(
+                             bsls::AtomicOperations::getPtrAcquire(&s_plan));
+    if (result) {
+        return result;                                                // RETURN
+    }
+
+    // Build a plan, and publish it unless another thread published one first.
+
+    bslma::Allocator   *allocator = bslma::Default::globalAllocator();
+    bdlat_SequencePlan *newPlan   = new (*allocator) bdlat_SequencePlan(
+                                                                   allocator);
+
+    bdlat_SequencePlan_Builder builder(newPlan);
+    bdlat_SequenceFunctions::accessAttributes(object, builder);
+
+    result = static_cast<const bdlat_SequencePlan *>(
+              bsls::AtomicOperations::testAndSwapPtrAcqRel(&s_plan,
+                                                           0,
+                                                           newPlan));
+    if (result) {
+        allocator->deleteObject(newPlan);
+        return result;                                                // RETURN
+    }
+    return newPlan;
+}
+
+template <class TYPE>
+inline
+const bdlat_SequencePlan *bdlat_SequencePlanUtil::planImp(const TYPE&,
+                                                          bsl::false_type)
+{
+    return 0;
+}
+
+template <class TYPE, class MANIPULATOR>
+inline
+int bdlat_SequencePlanUtil::manipulateAttributeImp(
+                                          TYPE         *object,
+                                          MANIPULATOR&  manipulator,
+                                          const char   *attributeName,
+                                          int           attributeNameLength,
+                                          bsl::true_type)
+{
+    const bdlat_SequencePlan *sequencePlan = planImp(*object,
+                                                     bsl::true_type());
+
+    const int index = sequencePlan->lookupIndex(attributeName,
+                                                attributeNameLength);
+    if (0 <= index) {
+        return bdlat_SequenceFunctions::manipulateAttribute(
+                                      object,
+                                      manipulator,
+                                      sequencePlan->attributeInfo(index).id());
+                                                                      // RETURN
+    }
+
+    return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                        manipulator,
+                                                        attributeName,
+                                                        attributeNameLength);
+}
+
+template <class TYPE, class MANIPULATOR>
+inline
+int bdlat_SequencePlanUtil::manipulateAttributeImp(
+                                          TYPE         *object,
+                                          MANIPULATOR&  manipulator,
+                                          const char   *attributeName,
+                                          int           attributeNameLength,
+                                          bsl::false_type)
+{
+    return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                        manipulator,
+                                                        attributeName,
+                                                        attributeNameLength);
+}
+
+// CLASS METHODS
+template <class TYPE>
+inline
+bool bdlat_SequencePlanUtil::hasAttribute(const TYPE&  object,
+                                          const char  *attributeName,
+                                          int          attributeNameLength)
+{
+    const bdlat_SequencePlan *sequencePlan = plan(object);
+
+    return (sequencePlan
+         && 0 <= sequencePlan->lookupIndex(attributeName,
+                                           attributeNameLength))
+        || bdlat_SequenceFunctions::hasAttribute(object,
+                                                 attributeName,
+                                                 attributeNameLength);
+}
+
+template <class TYPE, class MANIPULATOR>
+inline
+int bdlat_SequencePlanUtil::manipulateAttribute(
+                                         TYPE         *object,
+                                         MANIPULATOR&  manipulator,
+                                         const char   *attributeName,
+                                         int           attributeNameLength)
+{
+    BSLS_ASSERT(object);
+
+    return manipulateAttributeImp(
+                                 object,
+                                 manipulator,
+                                 attributeName,
+                                 attributeNameLength,
+                                 typename bdlat_IsBasicSequence<TYPE>::type());
+}
+
+template <class TYPE>
+inline
+const bdlat_SequencePlan *bdlat_SequencePlanUtil::plan(const TYPE& object)
+{
+    return planImp(object, typename bdlat_IsBasicSequence<TYPE>::type());
+}
+
+                      // --------------------------------
+                      // class bdlat_SequencePlan_Builder
+                      // --------------------------------
+
+// CREATORS
+inline
+bdlat_SequencePlan_Builder::bdlat_SequencePlan_Builder(
+                                                      bdlat_SequencePlan *plan)
+: d_plan_p(plan)
+{
+    BSLS_ASSERT(plan);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int bdlat_SequencePlan_Builder::operator()(const TYPE&,
+                                           const bdlat_AttributeInfo& info)
+{
+    typedef bdlat_TypeCategory::Select<TYPE> Selector;
+
+    const bool isNullable = bdlat_TypeCategory::e_NULLABLE_VALUE_CATEGORY ==
+                                     static_cast<int>(Selector::e_SELECTION);
+
+    d_plan_p->addAttribute(info, isNullable);
+    return 0;
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,919 @@
+// bdlat_sequenceplan.t.cpp                                           -*-C++-*-
+#include <bdlat_sequenceplan.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_formattingmode.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typetraits.h>
+
+#include <bdlb_nullablevalue.h>
+#include <bdlb_string.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlat_SequencePlan' is tested by adding attributes described by tables of
+// names, and checking that each name, and only these names, are found, in
+// plans having few and many attributes (so that the hash table is resized).
+// 'bdlat_SequencePlanUtil' is tested with a type imitating a generated
+// sequence, whose name lookup is case-insensitive as that of some generated
+// types, and with a type plugged into 'bdlat' that has no plan.
+//-----------------------------------------------------------------------------
+// bdlat_SequencePlan
+// [ 2] explicit bdlat_SequencePlan(bslma::Allocator *basicAllocator = 0);
+// [ 2] void addAttribute(const bdlat_AttributeInfo&, bool isNullable);
+// [ 2] const bdlat_AttributeInfo& attributeInfo(int index) const;
+// [ 2] bool isNullable(int index) const;
+// [ 2] int lookupIndex(const char *name, int nameLength) const;
+// [ 2] int numAttributes() const;
+//
+// bdlat_SequencePlanUtil
+// [ 3] const bdlat_SequencePlan *plan(const TYPE& object);
+// [ 4] bool hasAttribute(const TYPE&, const char *, int);
+// [ 4] int manipulateAttribute(TYPE *, MANIPULATOR&, const char *, int);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlat_SequencePlan     Obj;
+typedef bdlat_SequencePlanUtil Util;
+
+// ============================================================================
+//                  GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace test {
+
+                               // ==============
+                               // class Employee
+                               // ==============
+
+class Employee {
+    // This class imitates a "sequence" type generated by 'bas_codegen.pl',
+    // whose name lookup is case-insensitive.  The ids of its attributes
+    // differ from their indices.
+
+    // DATA
+    bsl::string                      d_name;
+    int                              d_age;
+    bdlb::NullableValue<bsl::string> d_title;
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_NAME  = 10,
+        ATTRIBUTE_ID_AGE   = 20,
+        ATTRIBUTE_ID_TITLE = 30
+    };
+
+    enum { NUM_ATTRIBUTES = 3 };
+
+    // CONSTANTS
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+    // CLASS DATA
+    static int s_numNameLookups;  // calls of 'lookupAttributeInfo' by name
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Employee, bdlat_IsBasicSequence);
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(int id);
+        // Return the information about the attribute having the specified
+        // 'id', or 0 if there is no such attribute.
+
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                       const char *name,
+                                                       int         nameLength);
+        // Return the information about the attribute having the specified
+        // 'name' of the specified 'nameLength', compared case-insensitively,
+        // or 0 if there is no such attribute, and increment
+        // 's_numNameLookups'.
+
+    // CREATORS
+    Employee()
+    : d_name()
+    , d_age(0)
+    , d_title()
+    {
+    }
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'id', and return the result, or return -1 if there is no
+        // such attribute.
+    {
+        switch (id) {
+          case ATTRIBUTE_ID_NAME:
+            return manipulator(&d_name, ATTRIBUTE_INFO_ARRAY[0]);     // RETURN
+          case ATTRIBUTE_ID_AGE:
+            return manipulator(&d_age, ATTRIBUTE_INFO_ARRAY[1]);      // RETURN
+          case ATTRIBUTE_ID_TITLE:
+            return manipulator(&d_title, ATTRIBUTE_INFO_ARRAY[2]);    // RETURN
+          default:
+            return -1;                                                // RETURN
+        }
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'name' of the specified 'nameLength', and return the
+        // result, or return -1 if there is no such attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? manipulateAttribute(manipulator, info->d_id) : -1;
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttributes(MANIPULATOR& manipulator)
+        // Invoke the specified 'manipulator' on each attribute in turn, until
+        // an invocation returns a non-zero value, and return the value of the
+        // last invocation.
+    {
+        int rc = manipulator(&d_name, ATTRIBUTE_INFO_ARRAY[0]);
+        if (0 == rc) {
+            rc = manipulator(&d_age, ATTRIBUTE_INFO_ARRAY[1]);
+        }
+        if (0 == rc) {
+            rc = manipulator(&d_title, ATTRIBUTE_INFO_ARRAY[2]);
+        }
+        return rc;
+    }
+
+    // ACCESSORS
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR& accessor, int id) const
+        // Invoke the specified 'accessor' on the attribute having the
+        // specified 'id', and return the result, or return -1 if there is no
+        // such attribute.
+    {
+        switch (id) {
+          case ATTRIBUTE_ID_NAME:
+            return accessor(d_name, ATTRIBUTE_INFO_ARRAY[0]);         // RETURN
+          case ATTRIBUTE_ID_AGE:
+            return accessor(d_age, ATTRIBUTE_INFO_ARRAY[1]);          // RETURN
+          case ATTRIBUTE_ID_TITLE:
+            return accessor(d_title, ATTRIBUTE_INFO_ARRAY[2]);        // RETURN
+          default:
+            return -1;                                                // RETURN
+        }
+    }
+
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR&   accessor,
+                        const char *name,
+                        int         nameLength) const
+        // Invoke the specified 'accessor' on the attribute having the
+        // specified 'name' of the specified 'nameLength', and return the
+        // result, or return -1 if there is no such attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? accessAttribute(accessor, info->d_id) : -1;
+    }
+
+    template <class ACCESSOR>
+    int accessAttributes(ACCESSOR& accessor) const
+        // Invoke the specified 'accessor' on each attribute in turn, until an
+        // invocation returns a non-zero value, and return the value of the
+        // last invocation.
+    {
+        int rc = accessor(d_name, ATTRIBUTE_INFO_ARRAY[0]);
+        if (0 == rc) {
+            rc = accessor(d_age, ATTRIBUTE_INFO_ARRAY[1]);
+        }
+        if (0 == rc) {
+            rc = accessor(d_title, ATTRIBUTE_INFO_ARRAY[2]);
+        }
+        return rc;
+    }
+
+    int age() const
+        // Return the age of this employee.
+    {
+        return d_age;
+    }
+};
+
+const bdlat_AttributeInfo Employee::ATTRIBUTE_INFO_ARRAY[] = {
+    {
+        ATTRIBUTE_ID_NAME,
+        "name",
+        sizeof("name") - 1,
+        "",
+        bdlat_FormattingMode::e_TEXT
+    },
+    {
+        ATTRIBUTE_ID_AGE,
+        "age",
+        sizeof("age") - 1,
+        "",
+        bdlat_FormattingMode::e_DEC
+    },
+    {
+        ATTRIBUTE_ID_TITLE,
+        "title",
+        sizeof("title") - 1,
+        "",
+        bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_NILLABLE
+    }
+};
+
+const bdlat_AttributeInfo *Employee::lookupAttributeInfo(int id)
+{
+    for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+        if (id == ATTRIBUTE_INFO_ARRAY[i].d_id) {
+            return &ATTRIBUTE_INFO_ARRAY[i];                          // RETURN
+        }
+    }
+    return 0;
+}
+
+int Employee::s_numNameLookups = 0;
+
+const bdlat_AttributeInfo *Employee::lookupAttributeInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+{
+    ++s_numNameLookups;
+
+    for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+        if (bdlb::String::areEqualCaseless(ATTRIBUTE_INFO_ARRAY[i].d_name_p,
+                                           name,
+                                           nameLength)) {
+            return &ATTRIBUTE_INFO_ARRAY[i];                          // RETURN
+        }
+    }
+    return 0;
+}
+
+                                // ===========
+                                // class Point
+                                // ===========
+
+class Point {
+    // This class provides a "sequence" type plugged into 'bdlat' through
+    // 'bdlat_sequence*' functions, having the attributes "x" and "y".
+
+  public:
+    // DATA
+    int d_x;
+    int d_y;
+};
+
+const bdlat_AttributeInfo k_POINT_INFO[] = {
+    { 1, "x", 1, "", bdlat_FormattingMode::e_DEC },
+    { 2, "y", 1, "", bdlat_FormattingMode::e_DEC }
+};
+
+bool bdlat_sequenceHasAttribute(const Point&,
+                                const char   *name,
+                                int           nameLength)
+    // Return 'true' if the specified 'name' of the specified 'nameLength' is
+    // "x" or "y", and 'false' otherwise.
+{
+    return 1 == nameLength && ('x' == name[0] || 'y' == name[0]);
+}
+
+template <class MANIPULATOR>
+int bdlat_sequenceManipulateAttribute(Point        *object,
+                                      MANIPULATOR&  manipulator,
+                                      const char   *name,
+                                      int           nameLength)
+    // Invoke the specified 'manipulator' on the attribute of the specified
+    // 'object' having the specified 'name' of the specified 'nameLength', and
+    // return the result, or return -1 if there is no such attribute.
+{
+    if (!bdlat_sequenceHasAttribute(*object, name, nameLength)) {
+        return -1;                                                    // RETURN
+    }
+    return 'x' == name[0] ? manipulator(&object->d_x, k_POINT_INFO[0])
+                          : manipulator(&object->d_y, k_POINT_INFO[1]);
+}
+
+template <class ACCESSOR>
+int bdlat_sequenceAccessAttribute(const Point&  object,
+                                  ACCESSOR&     accessor,
+                                  const char   *name,
+                                  int           nameLength)
+    // Invoke the specified 'accessor' on the attribute of the specified
+    // 'object' having the specified 'name' of the specified 'nameLength', and
+    // return the result, or return -1 if there is no such attribute.
+{
+    if (!bdlat_sequenceHasAttribute(object, name, nameLength)) {
+        return -1;                                                    // RETURN
+    }
+    return 'x' == name[0] ? accessor(object.d_x, k_POINT_INFO[0])
+                          : accessor(object.d_y, k_POINT_INFO[1]);
+}
+
+                               // ============
+                               // struct GetId
+                               // ============
+
+struct GetId {
+    // This 'struct' provides a manipulator that records the id of the
+    // attribute on which it is invoked.
+
+    // DATA
+    int d_id;  // id of the last attribute manipulated
+
+    // MANIPULATORS
+    template <class TYPE>
+    int operator()(TYPE *, const bdlat_AttributeInfo& info)
+        // Record the id in the specified 'info' and return 0.
+    {
+        d_id = info.d_id;
+        return 0;
+    }
+};
+
+}  // close namespace test
+
+namespace BloombergLP {
+namespace bdlat_SequenceFunctions {
+
+template <>
+struct IsSequence<test::Point> {
+    enum { VALUE = 1 };
+};
+
+}  // close namespace bdlat_SequenceFunctions
+}  // close enterprise namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Manipulating an Attribute Named in a Message
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are writing a decoder that reads the names of the
+// attributes of a sequence from a message, and must then decode the value
+// following each name into the attribute of that name.
+//
+// First, we define a manipulator that loads an integer value into an
+// attribute (a real decoder would parse the value from the message):
+//..
+    struct LoadValue {
+        // This 'struct' provides a manipulator that loads 'd_value' into
+        // the integer attributes of a sequence.
+
+        // DATA
+        int d_value;  // value to load
+
+        // MANIPULATORS
+        int operator()(int *attribute, const bdlat_AttributeInfo&)
+            // Load 'd_value' into the specified 'attribute' and return 0.
+        {
+            *attribute = d_value;
+            return 0;
+        }
+
+        template <class TYPE>
+        int operator()(TYPE *, const bdlat_AttributeInfo&)
+            // Return a non-zero value.
+        {
+            return -1;
+        }
+    };
+//..
+// Then, we write a function that manipulates the attribute having a given
+// name, calling 'bdlat_SequencePlanUtil::manipulateAttribute' where we would
+// otherwise call 'bdlat_SequenceFunctions::manipulateAttribute':
+//..
+    template <class TYPE>
+    int loadAttribute(TYPE *object, const char *name, int value)
+        // Load the specified 'value' into the attribute of the specified
+        // 'object' having the specified 'name'.  Return 0 on success, and a
+        // non-zero value if 'object' has no such integer attribute.
+    {
+        LoadValue manipulator = { value };
+        return bdlat_SequencePlanUtil::manipulateAttribute(
+                                          object,
+                                          manipulator,
+                                          name,
+                                          static_cast<int>(bsl::strlen(name)));
+    }
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test    = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Finally, we use this function to set an attribute of a generated type,
+// 'test::Employee', having the integer attribute 'age':
+//..
+    test::Employee employee;
+
+    ASSERT(0 == loadAttribute(&employee, "age", 21));
+    ASSERT(21 == employee.age());
+
+    ASSERT(0 != loadAttribute(&employee, "salary", 1000));
+//..
+// Note that the first call built the plan of 'test::Employee', which the
+// second call, and all later calls in any thread, use.
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'hasAttribute' AND 'manipulateAttribute'
+        //
+        // Concerns:
+        //: 1 The exact names of the attributes of a type having a plan are
+        //:   found in the plan, without calling the type's own lookup, and
+        //:   the attributes having those names are manipulated.
+        //:
+        //: 2 Names that the type accepts but that are not exactly the name of
+        //:   an attribute, such as names differing in case, are found by the
+        //:   type's own lookup.
+        //:
+        //: 3 Unknown names are not found, and no attribute is manipulated.
+        //:
+        //: 4 The names of the attributes of a type having no plan are found
+        //:   by the type's own lookup.
+        //:
+        //: 5 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Using a table of names, accepted or not, look up each name in an
+        //:   object of a type imitating a generated type, whose name lookup
+        //:   is case-insensitive and counts its calls, manipulate the
+        //:   attribute having that name with a manipulator recording the id
+        //:   of the attribute, and check the results and the number of calls
+        //:   of the type's lookup.  (C-1..3)
+        //:
+        //: 2 Look up and manipulate names in an object of a type plugged into
+        //:   'bdlat'.  (C-4)
+        //:
+        //: 3 Install a test allocator as the default allocator, and check
+        //:   that it is not used.  (C-5)
+        //
+        // Testing:
+        //   bool hasAttribute(const TYPE&, const char *, int);
+        //   int manipulateAttribute(TYPE *, MANIPULATOR&, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                       << "TESTING 'hasAttribute' AND 'manipulateAttribute'"
+                       << endl
+                       << "================================================"
+                       << endl;
+
+        bslma::TestAllocator         da("default");
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        static const struct {
+            int         d_line;   // source line number
+            const char *d_name;   // name to look up
+            int         d_id;     // expected id, or -1 if not found
+            bool        d_exact;  // 'true' if found in the plan
+        } DATA[] = {
+            //LINE  NAME       ID   EXACT
+            //----  -------    --   -----
+            { L_,   "name",    10,  true  },
+            { L_,   "age",     20,  true  },
+            { L_,   "title",   30,  true  },
+            { L_,   "NAME",    10,  false },
+            { L_,   "Age",     20,  false },
+            { L_,   "tItLe",   30,  false },
+            { L_,   "",        -1,  false },
+            { L_,   "nam",     -1,  false },
+            { L_,   "names",   -1,  false },
+            { L_,   "salary",  -1,  false },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        test::Employee mX;  const test::Employee& X = mX;
+
+        // Build the plan before counting the calls of the type's lookup.
+
+        ASSERT(0 != Util::plan(X));
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *NAME   = DATA[ti].d_name;
+            const int   ID     = DATA[ti].d_id;
+            const bool  EXACT  = DATA[ti].d_exact;
+            const int   LENGTH = static_cast<int>(bsl::strlen(NAME));
+
+            if (verbose) { P_(LINE) P_(NAME) P_(ID) P(EXACT) }
+
+            test::Employee::s_numNameLookups = 0;
+
+            ASSERTV(LINE, (0 <= ID) == Util::hasAttribute(X, NAME, LENGTH));
+
+            ASSERTV(LINE,
+                    test::Employee::s_numNameLookups,
+                    (EXACT ? 0 : 1) == test::Employee::s_numNameLookups);
+
+            test::GetId manipulator = { -99 };
+            const int   rc          = Util::manipulateAttribute(&mX,
+                                                                manipulator,
+                                                                NAME,
+                                                                LENGTH);
+            if (0 <= ID) {
+                ASSERTV(LINE, rc, 0 == rc);
+                ASSERTV(LINE, manipulator.d_id, ID, ID == manipulator.d_id);
+            }
+            else {
+                ASSERTV(LINE, rc, 0 != rc);
+                ASSERTV(LINE, manipulator.d_id, -99 == manipulator.d_id);
+            }
+
+            ASSERTV(LINE,
+                    test::Employee::s_numNameLookups,
+                    (EXACT ? 0 : 2) == test::Employee::s_numNameLookups);
+        }
+
+        test::Point mP = { 3, 4 };  const test::Point& P = mP;
+
+        ASSERT(Util::hasAttribute(P, "x", 1));
+        ASSERT(Util::hasAttribute(P, "y", 1));
+        ASSERT(!Util::hasAttribute(P, "z", 1));
+
+        test::GetId manipulator = { -99 };
+        ASSERT(0 == Util::manipulateAttribute(&mP, manipulator, "x", 1));
+        ASSERTV(manipulator.d_id, 1 == manipulator.d_id);
+        ASSERT(0 == Util::manipulateAttribute(&mP, manipulator, "y", 1));
+        ASSERTV(manipulator.d_id, 2 == manipulator.d_id);
+
+        manipulator.d_id = -99;
+        ASSERT(0 != Util::manipulateAttribute(&mP, manipulator, "z", 1));
+        ASSERTV(manipulator.d_id, -99 == manipulator.d_id);
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'plan'
+        //
+        // Concerns:
+        //: 1 A type having the 'bdlat_TypeTraitBasicSequence' trait has a
+        //:   plan, holding the information about each of its attributes, in
+        //:   order, and whether each is of a "nullable" type.
+        //:
+        //: 2 The plan is built once: later calls, with any object, return
+        //:   the same plan.
+        //:
+        //: 3 A type plugged into 'bdlat' without that trait has no plan.
+        //:
+        //: 4 The plan is not allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Obtain the plan of a type imitating a generated type, and check
+        //:   its contents against the attribute information of the type.
+        //:   (C-1)
+        //:
+        //: 2 Obtain the plan again, from another object, and check that it
+        //:   is the same.  (C-2)
+        //:
+        //: 3 Check that the plan of a plugged-in type is 0.  (C-3)
+        //:
+        //: 4 Install a test allocator as the default allocator, and check
+        //:   that it is not used.  (C-4)
+        //
+        // Testing:
+        //   const bdlat_SequencePlan *plan(const TYPE& object);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'plan'" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator         da("default");
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        const test::Employee employee;
+
+        const Obj *plan = Util::plan(employee);
+        ASSERT(0 != plan);
+        ASSERTV(plan->numAttributes(), 3 == plan->numAttributes());
+
+        for (int i = 0; i < plan->numAttributes(); ++i) {
+            const bdlat_AttributeInfo& EXP =
+                                       test::Employee::ATTRIBUTE_INFO_ARRAY[i];
+            const bdlat_AttributeInfo& info = plan->attributeInfo(i);
+
+            ASSERTV(i, EXP.d_id == info.d_id);
+            ASSERTV(i, EXP.d_name_p == info.d_name_p);
+            ASSERTV(i, EXP.d_nameLength == info.d_nameLength);
+            ASSERTV(i, EXP.d_formattingMode == info.d_formattingMode);
+            ASSERTV(i, (2 == i) == plan->isNullable(i));
+            ASSERTV(i, i == plan->lookupIndex(EXP.d_name_p,
+                                              EXP.d_nameLength));
+        }
+
+        const test::Employee other;
+        ASSERT(plan == Util::plan(other));
+        ASSERT(plan == Util::plan(employee));
+
+        const test::Point point = { 3, 4 };
+        ASSERT(0 == Util::plan(point));
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'bdlat_SequencePlan'
+        //
+        // Concerns:
+        //: 1 Each attribute added is found by its exact name, and its index
+        //:   is that of the order in which it was added.
+        //:
+        //: 2 Names that are not those of attributes, including prefixes,
+        //:   extensions, names differing in case, and the empty name, are not
+        //:   found.
+        //:
+        //: 3 The information and the nullability of each attribute are kept.
+        //:
+        //: 4 Plans having many attributes, whose hash tables are resized as
+        //:   attributes are added, work as plans having few.
+        //:
+        //: 5 If two attributes have the same name, the first one is found.
+        //:
+        //: 6 Memory is allocated from the supplied allocator only.
+        //
+        // Plan:
+        //: 1 For each number of attributes up to 100, create a plan having
+        //:   attributes named "a0", "a1", ... whose ids are distinct from
+        //:   their indices, and check that every name added, and no other, is
+        //:   found, and the information recorded for each.  (C-1..4)
+        //:
+        //: 2 Add an attribute having the name of an existing one, and check
+        //:   that the first is still found.  (C-5)
+        //:
+        //: 3 Supply a test allocator, install another as the default
+        //:   allocator, and check their use.  (C-6)
+        //
+        // Testing:
+        //   explicit bdlat_SequencePlan(bslma::Allocator *basicAllocator = 0);
+        //   void addAttribute(const bdlat_AttributeInfo&, bool isNullable);
+        //   const bdlat_AttributeInfo& attributeInfo(int index) const;
+        //   bool isNullable(int index) const;
+        //   int lookupIndex(const char *name, int nameLength) const;
+        //   int numAttributes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'bdlat_SequencePlan'" << endl
+                          << "============================" << endl;
+
+        enum { k_MAX_ATTRIBUTES = 100 };
+
+        bslma::TestAllocator         da("default");
+        bslma::DefaultAllocatorGuard guard(&da);
+        bslma::TestAllocator         oa("object");
+
+        // The names must outlive the plans.
+
+        bsl::vector<bsl::string> names(&oa);
+        for (int i = 0; i < k_MAX_ATTRIBUTES; ++i) {
+            char buffer[16];
+            bsl::sprintf(buffer, "a%d", i);
+            names.push_back(buffer);
+        }
+
+        for (int n = 0; n <= k_MAX_ATTRIBUTES; ++n) {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERTV(n, 0 == X.numAttributes());
+
+            for (int i = 0; i < n; ++i) {
+                bdlat_AttributeInfo info;
+                info.d_id             = 1000 + 7 * i;
+                info.d_name_p         = names[i].c_str();
+                info.d_nameLength     = static_cast<int>(names[i].length());
+                info.d_annotation_p   = "";
+                info.d_formattingMode = i % 3;
+
+                mX.addAttribute(info, 0 == i % 2);
+            }
+            ASSERTV(n, X.numAttributes(), n == X.numAttributes());
+
+            for (int i = 0; i < n; ++i) {
+                const char *NAME   = names[i].c_str();
+                const int   LENGTH = static_cast<int>(names[i].length());
+
+                ASSERTV(n, i, i == X.lookupIndex(NAME, LENGTH));
+
+                const bdlat_AttributeInfo& info = X.attributeInfo(i);
+                ASSERTV(n, i, 1000 + 7 * i == info.d_id);
+                ASSERTV(n, i, NAME == info.d_name_p);
+                ASSERTV(n, i, LENGTH == info.d_nameLength);
+                ASSERTV(n, i, i % 3 == info.d_formattingMode);
+                ASSERTV(n, i, (0 == i % 2) == X.isNullable(i));
+            }
+
+            for (int i = n; i < k_MAX_ATTRIBUTES; ++i) {
+                const char *NAME   = names[i].c_str();
+                const int   LENGTH = static_cast<int>(names[i].length());
+
+                ASSERTV(n, i, -1 == X.lookupIndex(NAME, LENGTH));
+            }
+
+            ASSERTV(n, -1 == X.lookupIndex("", 0));
+            ASSERTV(n, -1 == X.lookupIndex("a", 1));
+            ASSERTV(n, -1 == X.lookupIndex("A0", 2));
+            ASSERTV(n, -1 == X.lookupIndex("a0 ", 3));
+            ASSERTV(n, -1 == X.lookupIndex("a0a", 3));
+
+            if (0 < n) {
+                // Look up a name that is not null-terminated.
+
+                ASSERTV(n, 0 == X.lookupIndex("a0a", 2));
+
+                bdlat_AttributeInfo info = X.attributeInfo(0);
+                info.d_id = -1;
+                mX.addAttribute(info, false);
+
+                ASSERTV(n, n + 1 == X.numAttributes());
+                ASSERTV(n, 0 == X.lookupIndex(names[0].c_str(), 2));
+                ASSERTV(n, -1 == X.attributeInfo(n).d_id);
+            }
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        ASSERTV(oa.numBlocksTotal(), 0 < oa.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Build a plan having a few attributes, and look up names.
+        //:
+        //: 2 Look up names in an object of a generated-like type.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bdlat_AttributeInfo INFO[] = {
+            { 5, "first",  5, "", bdlat_FormattingMode::e_DEFAULT },
+            { 6, "second", 6, "", bdlat_FormattingMode::e_DEFAULT }
+        };
+
+        Obj mX;  const Obj& X = mX;
+        mX.addAttribute(INFO[0], false);
+        mX.addAttribute(INFO[1], true);
+
+        ASSERT(2 == X.numAttributes());
+        ASSERT(0 == X.lookupIndex("first", 5));
+        ASSERT(1 == X.lookupIndex("second", 6));
+        ASSERT(-1 == X.lookupIndex("third", 5));
+        ASSERT(!X.isNullable(0));
+        ASSERT(X.isNullable(1));
+
+        test::Employee employee;
+
+        ASSERT(Util::hasAttribute(employee, "title", 5));
+
+        test::GetId manipulator = { 0 };
+        ASSERT(0 == Util::manipulateAttribute(&employee,
+                                              manipulator,
+                                              "title",
+                                              5));
+        ASSERT(30 == manipulator.d_id);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
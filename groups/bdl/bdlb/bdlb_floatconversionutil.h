@@ -0,0 +1,241 @@
+// bdlb_floatconversionutil.h                                         -*-C++-*-
+#ifndef INCLUDED_BDLB_FLOATCONVERSIONUTIL
+#define INCLUDED_BDLB_FLOATCONVERSIONUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide locale-independent conversions between text and 'double'.
+//
+//@CLASSES:
+//  bdlb::FloatConversionUtil: namespace for 'double' parsing and formatting
+//
+//@SEE_ALSO: bdlb_numericparseutil
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bdlb::FloatConversionUtil', that serves as a namespace for functions that
+// convert decimal text to 'double' values, and 'double' values to decimal
+// text.  These functions neither depend on the current locale nor allocate
+// memory, and they work directly on the characters supplied by the caller:
+// the text parsed need not be null-terminated, and formatted text is written
+// into a caller-supplied buffer.
+//
+///Parsing
+///-------
+// 'parseDouble' accepts the decimal floating-point syntax accepted by
+// 'strtod', with the grammar:
+//..
+//  <DOUBLE>   ::= <SIGN>? <MANTISSA> <EXPONENT>?
+//  <SIGN>     ::= + | -
+//  <MANTISSA> ::= <DIGIT>+ (. <DIGIT>*)? | . <DIGIT>+
+//  <EXPONENT> ::= (e | E) <SIGN>? <DIGIT>+
+//  <DIGIT>    ::= [0123456789]
+//..
+// and loads the 'double' nearest to the value of the text (ties are resolved
+// to the value having an even significand), as 'strtod' does.  Values too
+// large to be represented result in an infinity, and values too small, in a
+// zero or in a subnormal value.  Leading whitespace, hexadecimal
+// floating-point numbers, and the text of infinities and NaNs are not
+// accepted.
+//
+// Almost all inputs are converted by one of two exact methods: Clinger's fast
+// path when both the significand and the power of ten are exactly
+// representable as 'double' values, and otherwise the Eisel-Lemire algorithm
+// (as in the 'fast_float' library), which multiplies the (at most 19)
+// leading significant digits by a 128-bit approximation of the power of ten.
+// In the rare cases that this approximation is not sufficient to decide the
+// rounding, for example for a value very close to halfway between two
+// 'double' values written with more than 19 significant digits, the
+// significant digits are handed to 'strtod' in a local buffer, in a form that
+// does not depend on the locale.
+//
+///Formatting
+///----------
+// 'formatShortest' writes the shortest decimal text that 'parseDouble' (or
+// 'strtod') converts back to exactly the same 'double' value, choosing among
+// texts of the same length the one nearest to the value, as done by the Ryu
+// algorithm (Ulf Adams, "Ryu: Fast Float-to-String Conversion", PLDI 2018).
+// By default, the notation is that of the "%.17g" format of 'printf':
+// scientific notation ('d.ddde+XX') is used if the decimal exponent of the
+// value is less than -4 or at least 17, and fixed notation otherwise.  An
+// overload takes the precision whose "%.*g" notation to use instead, so that,
+// e.g., text formerly written with "%.16g" keeps its notation (1e16 is still
+// written as "1e+16") while gaining the digits that identify the value.
+//
+// 'formatGeneral' writes exactly the text that 'printf' produces for the
+// "%.*g" format with a given precision (a number of significant digits of at
+// most 17), except that the decimal point is always '.'.  For all but
+// subnormal values, the digits are computed exactly by the scaling step of
+// Ryu, and no call is made to 'printf'.
+//
+// Both functions write "inf", "-inf", "nan", or "-nan" for infinities and
+// NaNs, and neither writes a null terminator.  A buffer of
+// 'k_MAX_FORMATTED_LENGTH' characters is always sufficient.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Converting a Value to Text and Back
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to write a 'double' into a text message in a way that
+// does not lose precision, and to read it back.
+//
+// First, we format the value into a local buffer, with the fewest digits
+// that identify it:
+//..
+//  const double value = 0.1 + 0.2;
+//
+//  char      buffer[bdlb::FloatConversionUtil::k_MAX_FORMATTED_LENGTH];
+//  const int length = bdlb::FloatConversionUtil::formatShortest(buffer,
+//                                                               value);
+//
+//  assert(bslstl::StringRef("0.30000000000000004") ==
+//                                      bslstl::StringRef(buffer, length));
+//..
+// Then, we format the same value with 15 significant digits, as "%.15g"
+// would, which is easier to read but does not identify the value:
+//..
+//  const int shortLength = bdlb::FloatConversionUtil::formatGeneral(buffer,
+//                                                                   value,
+//                                                                   15);
+//
+//  assert(bslstl::StringRef("0.3") == bslstl::StringRef(buffer,
+//                                                       shortLength));
+//..
+// Next, we parse a message holding the first text, followed by other text
+// that is not part of the number:
+//..
+//  const bslstl::StringRef message("0.30000000000000004,next");
+//
+//  double            parsed;
+//  bslstl::StringRef remainder;
+//  int               rc = bdlb::FloatConversionUtil::parseDouble(&parsed,
+//                                                                &remainder,
+//                                                                message);
+//  assert(0 == rc);
+//..
+// Finally, we observe that we obtained the original value, and the position
+// of the remaining text:
+//..
+//  assert(value == parsed);
+//  assert(bslstl::StringRef(",next") == remainder);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslstl_stringref.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+                        // ==========================
+                        // struct FloatConversionUtil
+                        // ==========================
+
+struct FloatConversionUtil {
+    // This 'struct' provides a namespace for locale-independent and
+    // allocation-free conversions between decimal text and 'double' values.
+
+    // TYPES
+    enum {
+        k_MAX_FORMATTED_LENGTH = 24  // maximum number of characters written
+                                     // by 'formatShortest' and
+                                     // 'formatGeneral'
+    };
+
+    // CLASS METHODS
+    static int formatGeneral(char *buffer, double value, int precision);
+        // Write into the specified 'buffer' the text that 'printf' produces
+        // for the specified 'value' with the "%.*g" format and the specified
+        // 'precision', except that the decimal point is always '.', and
+        // return the number of characters written.  Infinities and NaNs are
+        // written as "inf", "-inf", "nan", or "-nan".  No null terminator is
+        // written.  The behavior is undefined unless 'buffer' has room for at
+        // least 'k_MAX_FORMATTED_LENGTH' characters, and
+        // '1 <= precision <= 17'.
+
+    static int formatShortest(char *buffer, double value);
+    static int formatShortest(char   *buffer,
+                              double  value,
+                              int     notationPrecision);
+        // Write into the specified 'buffer' the shortest decimal text that
+        // is converted back to the specified 'value' by 'parseDouble', using
+        // the notation of the "%.*g" format of 'printf' with the optionally
+        // specified 'notationPrecision' (17 if not specified), and return the
+        // number of characters written.  That is, scientific notation is used
+        // if the decimal exponent of 'value' is less than -4 or at least
+        // 'notationPrecision', and fixed notation otherwise.  Infinities and
+        // NaNs are written as "inf", "-inf", "nan", or "-nan".  No null
+        // terminator is written.  The behavior is undefined unless 'buffer'
+        // has room for at least 'k_MAX_FORMATTED_LENGTH' characters, and
+        // '1 <= notationPrecision <= 17'.
+
+    static int parseDouble(double                   *result,
+                           const bslstl::StringRef&  input);
+    static int parseDouble(double                   *result,
+                           bslstl::StringRef        *remainder,
+                           const bslstl::StringRef&  input);
+        // Parse the longest prefix of the specified 'input' that matches
+        // the <DOUBLE> rule of the grammar given in the component
+        // documentation, and load into the specified 'result' the 'double'
+        // value nearest to the value of that prefix.  Optionally specify
+        // 'remainder', in which to load the part of 'input' that follows the
+        // prefix; if 'remainder' is not specified, the prefix must be all of
+        // 'input'.  Return 0 on success, and a non-zero value (with no effect
+        // on 'result' and 'remainder') if 'input' does not start with text
+        // matching <DOUBLE>, or if 'remainder' is not specified and text
+        // follows the prefix.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // --------------------------
+                        // struct FloatConversionUtil
+                        // --------------------------
+
+// CLASS METHODS
+inline
+int FloatConversionUtil::formatShortest(char *buffer, double value)
+{
+    return formatShortest(buffer, value, 17);
+}
+
+inline
+int FloatConversionUtil::parseDouble(double                   *result,
+                                     const bslstl::StringRef&  input)
+{
+    bslstl::StringRef remainder;
+    double            value;
+
+    const int rc = parseDouble(&value, &remainder, input);
+    if (0 != rc || !remainder.empty()) {
+        return -1;                                                    // RETURN
+    }
+
+    *result = value;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,815 @@
+// bdlb_floatconversionutil.t.cpp                                     -*-C++-*-
+#include <bdlb_floatconversionutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The functions of this component are tested against the standard library
+// functions that they replace: 'strtod' for 'parseDouble', and 'sprintf' with
+// the "%.*g" format for 'formatGeneral'.  'formatShortest' is tested by
+// parsing its output back and by comparing the number of digits that it
+// writes with the smallest precision for which "%.*g" round-trips.  Each
+// function is tested with tables of corner cases, and with large numbers of
+// pseudo-random values covering the whole range of 'double'.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] int formatGeneral(char *buffer, double value, int precision);
+// [ 3] int formatShortest(char *buffer, double value);
+// [ 3] int formatShortest(char *buffer, double value, int notationPrec);
+// [ 2] int parseDouble(double *result, const StringRef& input);
+// [ 2] int parseDouble(double *result, StringRef *rest, const StringRef& in);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::FloatConversionUtil Util;
+typedef bsls::Types::Uint64       Uint64;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+Uint64 nextRandom(Uint64 *seed)
+    // Advance the specified 'seed' and return its new value, mixed.
+{
+    *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+    Uint64 result = *seed;
+    result ^= result >> 33;
+    result *= 0xff51afd7ed558ccdULL;
+    result ^= result >> 33;
+    return result;
+}
+
+static
+double randomDouble(Uint64 *seed)
+    // Return a finite 'double' obtained from the specified 'seed': the value
+    // of a random bit pattern, or of one having a small exponent or a zero
+    // exponent field (a subnormal value).
+{
+    for (;;) {
+        Uint64       bits = nextRandom(seed);
+        const Uint64 kind = bits % 4;
+
+        if (1 == kind) {
+            bits = (bits & 0x800fffffffffffffULL)
+                 | ((0x3ffULL + nextRandom(seed) % 80 - 40) << 52);
+        }
+        else if (2 == kind) {
+            bits &= 0x800fffffffffffffULL;
+        }
+
+        double value;
+        bsl::memcpy(&value, &bits, sizeof value);
+        if (value == value && value - value == 0) {
+            return value;                                             // RETURN
+        }
+    }
+}
+
+static
+bool isSame(double lhs, double rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same
+    // representation, and 'false' otherwise.
+{
+    return 0 == bsl::memcmp(&lhs, &rhs, sizeof lhs);
+}
+
+static
+int numSignificantDigits(const char *text)
+    // Return the number of significant digits in the specified decimal
+    // 'text', not counting leading and trailing zeros.
+{
+    bsl::string digits;
+    for (; *text && 'e' != *text; ++text) {
+        if ('0' <= *text && *text <= '9') {
+            digits += *text;
+        }
+    }
+
+    const bsl::size_t first = digits.find_first_not_of('0');
+    if (bsl::string::npos == first) {
+        return 0;                                                     // RETURN
+    }
+    return static_cast<int>(digits.find_last_not_of('0') - first + 1);
+}
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Converting a Value to Text and Back
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to write a 'double' into a text message in a way that
+// does not lose precision, and to read it back.
+//
+// First, we format the value into a local buffer, with the fewest digits
+// that identify it:
+//..
+    const double value = 0.1 + 0.2;
+
+    char      buffer[bdlb::FloatConversionUtil::k_MAX_FORMATTED_LENGTH];
+    const int length = bdlb::FloatConversionUtil::formatShortest(buffer,
+                                                                 value);
+
+    ASSERT(bslstl::StringRef("0.30000000000000004") ==
+                                        bslstl::StringRef(buffer, length));
+//..
+// Then, we format the same value with 15 significant digits, as "%.15g"
+// would, which is easier to read but does not identify the value:
+//..
+    const int shortLength = bdlb::FloatConversionUtil::formatGeneral(buffer,
+                                                                     value,
+                                                                     15);
+
+    ASSERT(bslstl::StringRef("0.3") == bslstl::StringRef(buffer,
+                                                         shortLength));
+//..
+// Next, we parse a message holding the first text, followed by other text
+// that is not part of the number:
+//..
+    const bslstl::StringRef message("0.30000000000000004,next");
+
+    double            parsed;
+    bslstl::StringRef remainder;
+    int               rc = bdlb::FloatConversionUtil::parseDouble(&parsed,
+                                                                  &remainder,
+                                                                  message);
+    ASSERT(0 == rc);
+//..
+// Finally, we observe that we obtained the original value, and the position
+// of the remaining text:
+//..
+    ASSERT(value == parsed);
+    ASSERT(bslstl::StringRef(",next") == remainder);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'formatGeneral'
+        //
+        // Concerns:
+        //: 1 The text written is that of 'sprintf' with the "%.*g" format and
+        //:   the same precision, for all precisions from 1 to 17, including
+        //:   the choice of notation and the removal of trailing zeros.
+        //:
+        //: 2 Rounding to the precision is exact, with ties (which are
+        //:   possible only if the value is exactly representable with one
+        //:   more digit) resolved to even.
+        //:
+        //: 3 Rounding that carries into a new leading digit increments the
+        //:   exponent, and may change the notation.
+        //:
+        //: 4 Zeros, infinities, NaNs, and subnormal values are written
+        //:   correctly.
+        //:
+        //: 5 No more than 'k_MAX_FORMATTED_LENGTH' characters are written.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, format a set of values chosen
+        //:   for C-2..4 with a given precision, and verify the text.  (C-2..4)
+        //:
+        //: 2 Format a large number of pseudo-random values with each
+        //:   precision, and compare the text with that of 'sprintf', and the
+        //:   length with 'k_MAX_FORMATTED_LENGTH'.  (C-1, 5)
+        //
+        // Testing:
+        //   int formatGeneral(char *buffer, double value, int precision);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'formatGeneral'" << endl
+                          << "=======================" << endl;
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+        const double NaN = bsl::numeric_limits<double>::quiet_NaN();
+
+        static const struct {
+            int         d_line;       // source line number
+            double      d_value;      // value to format
+            int         d_precision;  // number of significant digits
+            const char *d_expected;   // expected text
+        } DATA[] = {
+            //LINE VALUE                    PREC EXPECTED
+            //---- ------------------------ ---- -------------------------
+            { L_, 0.0,                      15, "0"                       },
+            { L_, -0.0,                     15, "-0"                      },
+            { L_, INF,                      15, "inf"                     },
+            { L_, -INF,                     15, "-inf"                    },
+            { L_, NaN,                      15, "nan"                     },
+            { L_, 1.0,                       1, "1"                       },
+            { L_, -1.5,                     17, "-1.5"                    },
+            { L_, 0.1,                      17, "0.10000000000000001"     },
+            { L_, 0.1,                      16, "0.1"                     },
+            { L_, 0.0001,                   15, "0.0001"                  },
+            { L_, 0.00001,                  15, "1e-05"                   },
+            { L_, 123456.0,                  6, "123456"                  },
+            { L_, 1234567.0,                 6, "1.23457e+06"             },
+            { L_, 999999.5,                  6, "1e+06"                   },
+            { L_, 99999.95,                  6, "99999.9"                 },
+            { L_, 0.5,                       1, "0.5"                     },
+            { L_, 2.5,                       1, "2"                       },
+            { L_, 3.5,                       1, "4"                       },
+            { L_, 0.125,                     2, "0.12"                    },
+            { L_, 0.375,                     2, "0.38"                    },
+            { L_, 1e100,                    15, "1e+100"                  },
+            { L_, 1.7976931348623157e308,   17, "1.7976931348623157e+308" },
+            { L_, 1.7976931348623157e308,   15, "1.79769313486232e+308"   },
+            { L_, 2.2250738585072014e-308,  17, "2.2250738585072014e-308" },
+            { L_, 4.9406564584124654e-324,  17, "4.9406564584124654e-324" },
+            { L_, 4.9406564584124654e-324,   1, "5e-324"                  },
+            { L_, -2.2250738585072009e-308, 16, "-2.225073858507201e-308" },
+            { L_, 9007199254740993.0,       17, "9007199254740992"        },
+            { L_, 123456789012345678.0,     17, "1.2345678901234568e+17"  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) cout << "\nTesting a table of values." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int     LINE      = DATA[ti].d_line;
+            const double  VALUE     = DATA[ti].d_value;
+            const int     PRECISION = DATA[ti].d_precision;
+            const string  EXPECTED  = DATA[ti].d_expected;
+
+            char      buffer[Util::k_MAX_FORMATTED_LENGTH];
+            const int length = Util::formatGeneral(buffer, VALUE, PRECISION);
+
+            const string RESULT(buffer, length);
+
+            if (veryVerbose) { P_(LINE) P_(PRECISION) P(RESULT) }
+
+            ASSERTV(LINE, EXPECTED, RESULT, EXPECTED == RESULT);
+        }
+
+        if (verbose) cout << "\nComparing with 'sprintf'." << endl;
+
+        Uint64 seed = 0;
+        for (int i = 0; i < 20000; ++i) {
+            const double VALUE = randomDouble(&seed);
+
+            for (int precision = 1; precision <= 17; ++precision) {
+                char expected[64];
+                bsl::sprintf(expected, "%.*g", precision, VALUE);
+
+                char      buffer[Util::k_MAX_FORMATTED_LENGTH];
+                const int length = Util::formatGeneral(buffer,
+                                                       VALUE,
+                                                       precision);
+
+                const string RESULT(buffer, length);
+
+                ASSERTV(expected, RESULT, string(expected) == RESULT);
+                ASSERTV(length, length <= Util::k_MAX_FORMATTED_LENGTH);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'formatShortest'
+        //
+        // Concerns:
+        //: 1 The text written is parsed back to the same value.
+        //:
+        //: 2 The text has the fewest significant digits of any text that is
+        //:   parsed back to the same value.
+        //:
+        //: 3 The notation is that of the "%.17g" format of 'printf', or of
+        //:   the "%.*g" format with the 'notationPrecision', if specified.
+        //:
+        //: 4 Zeros, infinities, NaNs, and the extreme values are written
+        //:   correctly.
+        //:
+        //: 5 No more than 'k_MAX_FORMATTED_LENGTH' characters are written.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, format a set of values chosen
+        //:   for C-3..4, and verify the text.  (C-3..4)
+        //:
+        //: 2 Using the table-driven technique, format values whose decimal
+        //:   exponents are near the notation thresholds with several values
+        //:   of 'notationPrecision', and verify the text.  (C-3)
+        //:
+        //: 3 Format a large number of pseudo-random values, and verify that
+        //:   'strtod' parses the text back to the same value, that its number
+        //:   of significant digits is not greater than the smallest precision
+        //:   for which the "%.*g" format round-trips, and that its length is
+        //:   not greater than 'k_MAX_FORMATTED_LENGTH', also when the
+        //:   smallest 'notationPrecision' is specified.  (C-1..2, 5)
+        //
+        // Testing:
+        //   int formatShortest(char *buffer, double value);
+        //   int formatShortest(char *buffer, double value, int notationPrec);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'formatShortest'" << endl
+                          << "========================" << endl;
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+        const double NaN = bsl::numeric_limits<double>::quiet_NaN();
+
+        static const struct {
+            int         d_line;      // source line number
+            double      d_value;     // value to format
+            const char *d_expected;  // expected text
+        } DATA[] = {
+            //LINE  VALUE                      EXPECTED
+            //---- ------------------------ ---- -------------------------
+            { L_,   0.0,                       "0"                         },
+            { L_,   -0.0,                      "-0"                        },
+            { L_,   INF,                       "inf"                       },
+            { L_,   -INF,                      "-inf"                      },
+            { L_,   NaN,                       "nan"                       },
+            { L_,   1.0,                       "1"                         },
+            { L_,   -1.5,                      "-1.5"                      },
+            { L_,   0.1,                       "0.1"                       },
+            { L_,   0.3,                       "0.3"                       },
+            { L_,   0.1 + 0.2,                 "0.30000000000000004"       },
+            { L_,   1.0 / 3,                   "0.3333333333333333"        },
+            { L_,   0.0001,                    "0.0001"                    },
+            { L_,   0.00001,                   "1e-05"                     },
+            { L_,   123456.0,                  "123456"                    },
+            { L_,   1e16,                      "10000000000000000"         },
+            { L_,   1e17,                      "1e+17"                     },
+            { L_,   9007199254740993.0,        "9007199254740992"          },
+            { L_,   1.2345678901234566e-7,     "1.2345678901234566e-07"    },
+            { L_,   1e100,                     "1e+100"                    },
+            { L_,   1.7976931348623157e308,    "1.7976931348623157e+308"   },
+            { L_,   -1.7976931348623157e308,   "-1.7976931348623157e+308"  },
+            { L_,   2.2250738585072014e-308,   "2.2250738585072014e-308"   },
+            { L_,   4.9406564584124654e-324,   "5e-324"                    },
+            { L_,   2.9802322387695312e-8,     "2.9802322387695312e-08"    },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) cout << "\nTesting a table of values." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int     LINE     = DATA[ti].d_line;
+            const double  VALUE    = DATA[ti].d_value;
+            const string  EXPECTED = DATA[ti].d_expected;
+
+            char      buffer[Util::k_MAX_FORMATTED_LENGTH];
+            const int length = Util::formatShortest(buffer, VALUE);
+
+            const string RESULT(buffer, length);
+
+            if (veryVerbose) { P_(LINE) P(RESULT) }
+
+            ASSERTV(LINE, EXPECTED, RESULT, EXPECTED == RESULT);
+        }
+
+        if (verbose) cout << "\nTesting 'notationPrecision'." << endl;
+
+        static const struct {
+            int         d_line;       // source line number
+            double      d_value;      // value to format
+            int         d_precision;  // notation precision
+            const char *d_expected;   // expected text
+        } NOTATION_DATA[] = {
+            //LINE  VALUE                    PREC  EXPECTED
+            //---- ------------------------  ----  ------------------------
+            { L_,   1e16,                    17,   "10000000000000000"      },
+            { L_,   1e16,                    16,   "1e+16"                  },
+            { L_,   1e15,                    16,   "1000000000000000"       },
+            { L_,   9007199254740993.0,      16,   "9007199254740992"       },
+            { L_,   12345678901234568.0,     16,   "1.2345678901234568e+16" },
+            { L_,   123456789012345678.0,    16,   "1.2345678901234568e+17" },
+            { L_,   0.1 + 0.2,               16,   "0.30000000000000004"    },
+            { L_,   0.0001,                  16,   "0.0001"                 },
+            { L_,   0.00001,                 16,   "1e-05"                  },
+            { L_,   4.9406564584124654e-324, 16,   "5e-324"                 },
+            { L_,   -2.5,                     1,   "-2.5"                   },
+            { L_,   25.0,                     1,   "2.5e+01"                },
+            { L_,   123.0,                    3,   "123"                    },
+            { L_,   1234.0,                   3,   "1.234e+03"              },
+        };
+        const int NUM_NOTATION_DATA = sizeof  NOTATION_DATA
+                                    / sizeof *NOTATION_DATA;
+
+        for (int ti = 0; ti < NUM_NOTATION_DATA; ++ti) {
+            const int     LINE      = NOTATION_DATA[ti].d_line;
+            const double  VALUE     = NOTATION_DATA[ti].d_value;
+            const int     PRECISION = NOTATION_DATA[ti].d_precision;
+            const string  EXPECTED  = NOTATION_DATA[ti].d_expected;
+
+            char      buffer[Util::k_MAX_FORMATTED_LENGTH];
+            const int length = Util::formatShortest(buffer, VALUE, PRECISION);
+
+            const string RESULT(buffer, length);
+
+            if (veryVerbose) { P_(LINE) P_(PRECISION) P(RESULT) }
+
+            ASSERTV(LINE, EXPECTED, RESULT, EXPECTED == RESULT);
+        }
+
+        if (verbose) cout << "\nTesting round trips of random values."
+                          << endl;
+
+        Uint64 seed = 0;
+        for (int i = 0; i < 100000; ++i) {
+            const double VALUE = randomDouble(&seed);
+
+            char      buffer[Util::k_MAX_FORMATTED_LENGTH + 1];
+            const int length = Util::formatShortest(buffer, VALUE);
+            buffer[length] = '\0';
+
+            ASSERTV(buffer, isSame(VALUE, bsl::strtod(buffer, 0)));
+            ASSERTV(length, length <= Util::k_MAX_FORMATTED_LENGTH);
+
+            char      sciBuffer[Util::k_MAX_FORMATTED_LENGTH + 1];
+            const int sciLength = Util::formatShortest(sciBuffer, VALUE, 1);
+            sciBuffer[sciLength] = '\0';
+
+            ASSERTV(sciBuffer, isSame(VALUE, bsl::strtod(sciBuffer, 0)));
+            ASSERTV(sciLength, sciLength <= Util::k_MAX_FORMATTED_LENGTH);
+
+            int precision = 1;
+            for (; precision < 17; ++precision) {
+                char text[64];
+                bsl::sprintf(text, "%.*g", precision, VALUE);
+                if (isSame(VALUE, bsl::strtod(text, 0))) {
+                    break;
+                }
+            }
+            ASSERTV(buffer, precision,
+                    numSignificantDigits(buffer) <= precision);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'parseDouble'
+        //
+        // Concerns:
+        //: 1 The longest prefix matching the grammar is parsed, and an
+        //:   exponent without digits is not part of it.
+        //:
+        //: 2 Input not starting with a number (including leading whitespace,
+        //:   infinities, and NaNs) is rejected, with no effect on the
+        //:   arguments.
+        //:
+        //: 3 The value is that of 'strtod', including for halfway cases,
+        //:   values having more than 19 significant digits, overflow to
+        //:   infinity, and underflow to subnormal values and zero.
+        //:
+        //: 4 The input need not be null-terminated.
+        //:
+        //: 5 The overload without 'remainder' fails unless all of the input
+        //:   is parsed.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a set of texts, followed
+        //:   by a character that is not part of a number, and verify the
+        //:   status, the remainder, and the value (against 'strtod').
+        //:   (C-1..5)
+        //:
+        //: 2 Parse the shortest, 17-digit, and exponential texts of a large
+        //:   number of pseudo-random values, and of numbers having many
+        //:   digits, and compare with 'strtod'.  (C-3)
+        //
+        // Testing:
+        //   int parseDouble(double *result, const StringRef& input);
+        //   int parseDouble(double *, StringRef *, const StringRef&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'parseDouble'" << endl
+                          << "=====================" << endl;
+
+        static const struct {
+            int         d_line;    // source line number
+            const char *d_input;   // text to parse
+            int         d_length;  // expected length parsed, or -1 to fail
+        } DATA[] = {
+            //LINE  INPUT                                        LENGTH
+            //----  -------------------------------------------  ------
+            { L_,   "",                                              -1 },
+            { L_,   "+",                                             -1 },
+            { L_,   "-",                                             -1 },
+            { L_,   ".",                                             -1 },
+            { L_,   "-.",                                            -1 },
+            { L_,   "e1",                                            -1 },
+            { L_,   ".e1",                                           -1 },
+            { L_,   " 1",                                            -1 },
+            { L_,   "inf",                                           -1 },
+            { L_,   "NaN",                                           -1 },
+            { L_,   "0",                                              1 },
+            { L_,   "-0",                                             2 },
+            { L_,   "+1",                                             2 },
+            { L_,   "1.",                                             2 },
+            { L_,   ".5",                                             2 },
+            { L_,   "-.5",                                            3 },
+            { L_,   "1e",                                             1 },
+            { L_,   "1e+",                                            1 },
+            { L_,   "1E-",                                            1 },
+            { L_,   "1ex",                                            1 },
+            { L_,   "1e5",                                            3 },
+            { L_,   "1E+05",                                          5 },
+            { L_,   "2.5e-3",                                         6 },
+            { L_,   "0x1A",                                           1 },
+            { L_,   "123.456",                                        7 },
+            { L_,   "000000000000000000000000001",                   27 },
+            { L_,   "0.000000000000000000000000001",                 29 },
+            { L_,   "9007199254740993",                              16 },
+            { L_,   "9007199254740993.0000000000001",                30 },
+            { L_,   "12345678901234567890123456789",                 29 },
+            { L_,   "1e22",                                           4 },
+            { L_,   "1e23",                                           4 },
+            { L_,   "1.7976931348623157e308",                        22 },
+            { L_,   "1.7976931348623159e308",                        22 },
+            { L_,   "1e999999999",                                   11 },
+            { L_,   "2.2250738585072011e-308",                       23 },
+            { L_,   "2.4703282292062327e-324",                       23 },
+            { L_,   "2.4703282292062328e-324",                       23 },
+            { L_,   "1e-999999999",                                  12 },
+            { L_,   "0e999999999",                                   11 },
+            { L_,   "2.00000000000000011102230246251565404236316680908203125",
+                                                                     55 },
+            { L_,   "2.00000000000000011102230246251565404236316680908203124",
+                                                                     55 },
+            { L_,   "2.00000000000000011102230246251565404236316680908203126",
+                                                                     55 },
+            { L_,   "7.3177701707893310e+15",                        22 },
+            { L_,   "3.0540412624010880e-308",                       23 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) cout << "\nTesting a table of texts." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int     LINE   = DATA[ti].d_line;
+            const string  INPUT  = DATA[ti].d_input;
+            const int     LENGTH = DATA[ti].d_length;
+
+            // Follow the text by a character that is not part of it, and
+            // exclude it from the input.
+
+            const string            WITH_SUFFIX = INPUT + "x";
+            const bslstl::StringRef IN(WITH_SUFFIX.data(), INPUT.length());
+
+            double            result = 37.0;
+            bslstl::StringRef remainder("unchanged");
+
+            const int rc = Util::parseDouble(&result, &remainder, IN);
+
+            if (veryVerbose) { P_(LINE) P_(INPUT) P_(rc) P(result) }
+
+            if (LENGTH < 0) {
+                ASSERTV(LINE, rc, 0 != rc);
+                ASSERTV(LINE, result, 37.0 == result);
+                ASSERTV(LINE, bslstl::StringRef("unchanged") == remainder);
+                continue;
+            }
+
+            const double EXPECTED = bsl::strtod(
+                                             INPUT.substr(0, LENGTH).c_str(),
+                                             0);
+
+            ASSERTV(LINE, rc, 0 == rc);
+            ASSERTV(LINE, EXPECTED, result, isSame(EXPECTED, result));
+            ASSERTV(LINE, remainder.data() == IN.data() + LENGTH);
+            ASSERTV(LINE, remainder.length() == INPUT.length() - LENGTH);
+
+            double    whole = 37.0;
+            const int wholeRc = Util::parseDouble(&whole, IN);
+            if (static_cast<int>(INPUT.length()) == LENGTH) {
+                ASSERTV(LINE, wholeRc, 0 == wholeRc);
+                ASSERTV(LINE, isSame(EXPECTED, whole));
+            }
+            else {
+                ASSERTV(LINE, wholeRc, 0 != wholeRc);
+                ASSERTV(LINE, whole, 37.0 == whole);
+            }
+        }
+
+        if (verbose) cout << "\nComparing with 'strtod'." << endl;
+
+        Uint64 seed = 0;
+        for (int i = 0; i < 100000; ++i) {
+            const double VALUE = randomDouble(&seed);
+
+            char texts[3][64];
+            texts[0][Util::formatShortest(texts[0], VALUE)] = '\0';
+            bsl::sprintf(texts[1], "%.17g", VALUE);
+            bsl::sprintf(texts[2],
+                         "%.*e",
+                         static_cast<int>(nextRandom(&seed) % 25),
+                         VALUE);
+
+            for (int j = 0; j < 3; ++j) {
+                double    result;
+                const int rc = Util::parseDouble(&result, texts[j]);
+
+                ASSERTV(texts[j], rc, 0 == rc);
+                ASSERTV(texts[j],
+                        isSame(bsl::strtod(texts[j], 0), result));
+            }
+        }
+
+        if (verbose) cout << "\nComparing long texts with 'strtod'." << endl;
+
+        for (int i = 0; i < 20000; ++i) {
+            // Write random digits around a random decimal point, and an
+            // exponent, padded with up to 400 zeros on either side.
+
+            string text;
+            if (nextRandom(&seed) % 2) {
+                text += '-';
+            }
+            if (nextRandom(&seed) % 4 == 0) {
+                text += "0." + string(nextRandom(&seed) % 400, '0');
+            }
+            const int numDigits = static_cast<int>(nextRandom(&seed) % 40) + 1;
+            const int point     = static_cast<int>(nextRandom(&seed) % 40);
+            for (int j = 0; j < numDigits; ++j) {
+                if (j == point && string::npos == text.find('.')) {
+                    text += '.';
+                }
+                text += static_cast<char>('0' + nextRandom(&seed) % 10);
+            }
+            if (nextRandom(&seed) % 4 == 0) {
+                text += string(nextRandom(&seed) % 400, '0');
+            }
+            char exponent[16];
+            bsl::sprintf(exponent,
+                         "e%d",
+                         static_cast<int>(nextRandom(&seed) % 700) - 350);
+            text += exponent;
+
+            double    result;
+            const int rc = Util::parseDouble(&result, text);
+
+            ASSERTV(text, rc, 0 == rc);
+            ASSERTV(text, isSame(bsl::strtod(text.c_str(), 0), result));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format a few values, and parse the text back.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const double VALUES[] = { 0.0, 1.0, -2.5, 0.1, 1e-300, 6.02214076e23 };
+        const int    NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const double VALUE = VALUES[i];
+
+            char      buffer[Util::k_MAX_FORMATTED_LENGTH];
+            const int length = Util::formatShortest(buffer, VALUE);
+
+            double result;
+            ASSERTV(i, 0 == Util::parseDouble(
+                                         &result,
+                                         bslstl::StringRef(buffer, length)));
+            ASSERTV(i, VALUE, result, VALUE == result);
+
+            const int generalLength = Util::formatGeneral(buffer, VALUE, 17);
+            ASSERTV(i, 0 == Util::parseDouble(
+                                  &result,
+                                  bslstl::StringRef(buffer, generalLength)));
+            ASSERTV(i, VALUE, result, VALUE == result);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -5,6 +5,7 @@
 BSLS_IDENT_RCSID(bdlb_numericparseutil_cpp, "$Id$ $CSID$")
 
 #include <bdlb_chartype.h>
+#include <bdlb_floatconversionutil.h>
 
 #include <bslma_allocator.h>
 #include <bslma_default.h>
@@ -223,6 +224,29 @@ int NumericParseUtil::parseDouble(double                   *result,
         return -2;                                                    // RETURN
     }
 
+    // Decimal numbers, by far the most common input, are converted in place
+    // by 'FloatConversionUtil'.  Hexadecimal numbers, infinities, and NaNs are
+    // left to 'strtod', on a null-terminated copy of the input.
+
+    const char *digits = inputString.data();
+    const char *end    = digits + inputString.length();
+    if ('+' == *digits || '-' == *digits) {
+        ++digits;
+    }
+    const bool isHex = end - digits >= 2
+                    && '0' == digits[0]
+                    && ('x' == digits[1] || 'X' == digits[1]);
+
+    if (digits != end && !isHex && !CharType::isAlpha(*digits)) {
+        if (0 == FloatConversionUtil::parseDouble(result,
+                                                  remainder,
+                                                  inputString)) {
+            return 0;                                                 // RETURN
+        }
+        *remainder = inputString;
+        return -3;                                                    // RETURN
+    }
+
     static const size_type k_BUFFER_SIZE = 128;
 
     const bool             useLocalBuffer =
@@ -0,0 +1,389 @@
+// bdlbb_blobioutil.cpp                                               -*-C++-*-
+#include <bdlbb_blobioutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_blobioutil_cpp,"$Id$ $CSID$")
+
+#include <bdlbb_blobutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>
+
+#else
+
+#include <errno.h>       // 'errno', 'EINTR'
+#include <sys/types.h>   // 'ssize_t'
+#include <sys/uio.h>     // 'iovec', 'readv', 'writev', 'preadv', 'pwritev'
+#include <unistd.h>      // 'pread', 'pwrite'
+
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_FREEBSD)
+#define U_HAVE_PREADV 1
+#endif
+
+#endif
+
+namespace BloombergLP {
+namespace {
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+
+ssize_t systemReadv(int                              descriptor,
+                    const struct ::iovec            *iovecs,
+                    int                              numIovecs,
+                    const bdlbb::BlobIoUtil::Offset *fileOffset)
+    // Read into the specified 'numIovecs' buffers described by the specified
+    // 'iovecs' from the file having the specified 'descriptor', at the
+    // specified '*fileOffset' if 'fileOffset' is not 0 and at the file
+    // pointer otherwise.  Return the number of bytes read, or a negative
+    // value on error.  Retry the read if it is interrupted.
+{
+    ssize_t rc;
+
+    do {
+        if (!fileOffset) {
+            rc = ::readv(descriptor, iovecs, numIovecs);
+        }
+        else {
+#ifdef U_HAVE_PREADV
+            rc = ::preadv(descriptor, iovecs, numIovecs, *fileOffset);
+#else
+            // Emulate 'preadv' with one 'pread' per buffer, stopping at the
+            // first short read.
+
+            rc = 0;
+            for (int i = 0; i < numIovecs; ++i) {
+                const ssize_t n = ::pread(descriptor,
+                                          iovecs[i].iov_base,
+                                          iovecs[i].iov_len,
+                                          *fileOffset + rc);
+                if (n < 0) {
+                    rc = 0 == rc ? n : rc;
+                    break;
+                }
+                rc += n;
+                if (static_cast<bsl::size_t>(n) < iovecs[i].iov_len) {
+                    break;
+                }
+            }
+#endif
+        }
+    } while (rc < 0 && EINTR == errno);
+
+    return rc;
+}
+
+ssize_t systemWritev(int                              descriptor,
+                     const struct ::iovec            *iovecs,
+                     int                              numIovecs,
+                     const bdlbb::BlobIoUtil::Offset *fileOffset)
+    // Write the specified 'numIovecs' buffers described by the specified
+    // 'iovecs' to the file having the specified 'descriptor', at the
+    // specified '*fileOffset' if 'fileOffset' is not 0 and at the file
+    // pointer otherwise.  Return the number of bytes written, or a negative
+    // value on error.  Retry the write if it is interrupted.
+{
+    ssize_t rc;
+
+    do {
+        if (!fileOffset) {
+            rc = ::writev(descriptor, iovecs, numIovecs);
+        }
+        else {
+#ifdef U_HAVE_PREADV
+            rc = ::pwritev(descriptor, iovecs, numIovecs, *fileOffset);
+#else
+            // Emulate 'pwritev' with one 'pwrite' per buffer, stopping at the
+            // first short write.
+
+            rc = 0;
+            for (int i = 0; i < numIovecs; ++i) {
+                const ssize_t n = ::pwrite(descriptor,
+                                           iovecs[i].iov_base,
+                                           iovecs[i].iov_len,
+                                           *fileOffset + rc);
+                if (n < 0) {
+                    rc = 0 == rc ? n : rc;
+                    break;
+                }
+                rc += n;
+                if (static_cast<bsl::size_t>(n) < iovecs[i].iov_len) {
+                    break;
+                }
+            }
+#endif
+        }
+    } while (rc < 0 && EINTR == errno);
+
+    return rc;
+}
+
+#endif
+
+int readImp(bdlbb::BlobIoUtil::FileDescriptor  descriptor,
+            bdlbb::Blob                       *blob,
+            int                                maxNumBytes,
+            const bdlbb::BlobIoUtil::Offset   *fileOffset)
+    // Read at most the specified 'maxNumBytes' bytes from the file having the
+    // specified 'descriptor' into the specified 'blob' as documented for
+    // 'BlobIoUtil::read' if the specified 'fileOffset' is 0, and for
+    // 'BlobIoUtil::readAt' at '*fileOffset' otherwise.
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(0 < maxNumBytes);
+
+    const int length = blob->length();
+
+    if (blob->totalSize() - length < maxNumBytes) {
+        // Grow the blob with buffers from its factory, then restore its
+        // length, keeping the new buffers as capacity.
+
+        blob->setLength(length + maxNumBytes);
+        blob->setLength(length);
+    }
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    if (fileOffset
+     && 0 > bdls::FilesystemUtil::seek(
+                     descriptor,
+                     *fileOffset,
+                     bdls::FilesystemUtil::e_SEEK_FROM_BEGINNING)) {
+        return -1;                                                    // RETURN
+    }
+
+    // Read into each buffer in turn, stopping at the first short read.
+
+    const bsl::pair<int, int> place =
+                 bdlbb::BlobUtil::findBufferIndexAndOffset(*blob, length);
+    int numBytesRead = 0;
+
+    for (int i = place.first; numBytesRead < maxNumBytes; ++i) {
+        const bdlbb::BlobBuffer& buffer = blob->buffer(i);
+        const int                offset = i == place.first ? place.second : 0;
+        const int                size   = bsl::min(buffer.size() - offset,
+                                                   maxNumBytes - numBytesRead);
+
+        const int rc = bdls::FilesystemUtil::read(descriptor,
+                                                  buffer.data() + offset,
+                                                  size);
+        if (rc < 0) {
+            if (0 == numBytesRead) {
+                return rc;                                            // RETURN
+            }
+            break;
+        }
+        numBytesRead += rc;
+        if (rc < size) {
+            break;
+        }
+    }
+
+#else
+
+    struct ::iovec iovecs[bdlbb::BlobIoUtil::k_MAX_IOVECS];
+
+    const int numIovecs = bdlbb::BlobIoUtil::loadIovecs(
+                                             iovecs,
+                                             bdlbb::BlobIoUtil::k_MAX_IOVECS,
+                                             *blob,
+                                             length,
+                                             maxNumBytes);
+
+    const ssize_t rc = systemReadv(descriptor, iovecs, numIovecs, fileOffset);
+    if (rc < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    const int numBytesRead = static_cast<int>(rc);
+
+#endif
+
+    blob->setLength(length + numBytesRead);
+    return numBytesRead;
+}
+
+int writeImp(bdlbb::BlobIoUtil::FileDescriptor  descriptor,
+             bdlbb::Blob                       *blob,
+             const bdlbb::BlobIoUtil::Offset   *fileOffset)
+    // Write the data of the specified 'blob' to the file having the specified
+    // 'descriptor' as documented for 'BlobIoUtil::write' if the specified
+    // 'fileOffset' is 0, and for 'BlobIoUtil::writeAt' at '*fileOffset'
+    // otherwise.
+{
+    BSLS_ASSERT(blob);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    if (fileOffset
+     && 0 < blob->length()
+     && 0 > bdls::FilesystemUtil::seek(
+                     descriptor,
+                     *fileOffset,
+                     bdls::FilesystemUtil::e_SEEK_FROM_BEGINNING)) {
+        return -1;                                                    // RETURN
+    }
+
+#endif
+
+    int numBytesWritten = 0;
+
+    while (0 < blob->length()) {
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+        // Write the first buffer; the file pointer follows the data.
+
+        const bdlbb::BlobBuffer& buffer = blob->buffer(0);
+        const int                size   = bsl::min(buffer.size(),
+                                                   blob->length());
+        if (0 == size) {
+            blob->removeBuffer(0);
+            continue;
+        }
+
+        const int rc = bdls::FilesystemUtil::write(descriptor,
+                                                   buffer.data(),
+                                                   size);
+
+#else
+
+        struct ::iovec iovecs[bdlbb::BlobIoUtil::k_MAX_IOVECS];
+
+        const int numIovecs = bdlbb::BlobIoUtil::loadIovecs(
+                                             iovecs,
+                                             bdlbb::BlobIoUtil::k_MAX_IOVECS,
+                                             *blob,
+                                             0,
+                                             blob->length());
+
+        bdlbb::BlobIoUtil::Offset offset;
+        if (fileOffset) {
+            offset = *fileOffset + numBytesWritten;
+        }
+
+        const ssize_t rc = systemWritev(descriptor,
+                                        iovecs,
+                                        numIovecs,
+                                        fileOffset ? &offset : 0);
+
+#endif
+
+        if (rc <= 0) {
+            if (0 == numBytesWritten) {
+                return rc < 0 ? -1 : 0;                               // RETURN
+            }
+            break;
+        }
+
+        // Advance the blob past the bytes written.
+
+        bdlbb::BlobUtil::erase(blob, 0, static_cast<int>(rc));
+        numBytesWritten += static_cast<int>(rc);
+    }
+
+    return numBytesWritten;
+}
+
+}  // close unnamed namespace
+
+namespace bdlbb {
+
+                             // -----------------
+                             // struct BlobIoUtil
+                             // -----------------
+
+// CLASS METHODS
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+int BlobIoUtil::loadIovecs(struct ::iovec *iovecs,
+                           int             maxNumIovecs,
+                           const Blob&     blob,
+                           int             position,
+                           int             length)
+{
+    BSLS_ASSERT(iovecs);
+    BSLS_ASSERT(0 < maxNumIovecs);
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(position <= blob.totalSize() - length);
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::pair<int, int> place =
+                          BlobUtil::findBufferIndexAndOffset(blob, position);
+
+    int numIovecs = 0;
+    int offset    = place.second;
+
+    for (int i = place.first; 0 < length && numIovecs < maxNumIovecs; ++i) {
+        const BlobBuffer& buffer = blob.buffer(i);
+        const int         size   = bsl::min(buffer.size() - offset, length);
+
+        if (0 < size) {
+            iovecs[numIovecs].iov_base = buffer.data() + offset;
+            iovecs[numIovecs].iov_len  = size;
+            ++numIovecs;
+            length -= size;
+        }
+        offset = 0;
+    }
+
+    return numIovecs;
+}
+#endif
+
+int BlobIoUtil::read(FileDescriptor descriptor, Blob *blob, int maxNumBytes)
+{
+    return readImp(descriptor, blob, maxNumBytes, 0);
+}
+
+int BlobIoUtil::readAt(FileDescriptor  descriptor,
+                       Blob           *blob,
+                       int             maxNumBytes,
+                       Offset          fileOffset)
+{
+    BSLS_ASSERT(0 <= fileOffset);
+
+    return readImp(descriptor, blob, maxNumBytes, &fileOffset);
+}
+
+int BlobIoUtil::write(FileDescriptor descriptor, Blob *blob)
+{
+    return writeImp(descriptor, blob, 0);
+}
+
+int BlobIoUtil::writeAt(FileDescriptor  descriptor,
+                        Blob           *blob,
+                        Offset          fileOffset)
+{
+    BSLS_ASSERT(0 <= fileOffset);
+
+    return writeImp(descriptor, blob, &fileOffset);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
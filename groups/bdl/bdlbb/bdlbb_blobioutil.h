@@ -0,0 +1,221 @@
+// bdlbb_blobioutil.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLBB_BLOBIOUTIL
+#define INCLUDED_BDLBB_BLOBIOUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide scatter/gather I/O between blobs and file descriptors.
+//
+//@CLASSES:
+//  bdlbb::BlobIoUtil: namespace for scatter/gather I/O on 'bdlbb::Blob'
+//
+//@SEE_ALSO: bdlbb_blob, bdlbb_blobutil, bdls_filesystemutil
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlbb::BlobIoUtil', that
+// serves as a namespace for functions transferring data between a
+// 'bdlbb::Blob' and a 'bdls::FilesystemUtil::FileDescriptor' (a file, a pipe,
+// or a socket) without copying it: the buffers of the blob are described to
+// the system as an array of 'iovec' structures, so that all of them are
+// transferred in one system call ('readv', 'writev', 'preadv', or 'pwritev').
+//
+// The 'write' functions write the data of a blob and remove the bytes written
+// from the front of the blob, so that a partial write leaves in the blob
+// exactly the data remaining to be written, and the function can simply be
+// called again (for example, when a non-blocking socket becomes writable).
+// The 'read' functions read into the buffers of a blob past its length,
+// growing the blob with buffers from its 'bdlbb::BlobBufferFactory' as needed,
+// and then set the length of the blob to include the bytes read.
+//
+// On POSIX platforms, 'loadIovecs' exposes the construction of the 'iovec'
+// array describing a range of a blob, for clients issuing other
+// scatter/gather system calls (such as 'sendmsg').  On Windows, which has no
+// scatter/gather I/O on file descriptors, the functions issue one system call
+// per buffer, and the positioned functions move the file pointer.
+//
+// All functions return a negative value on error, in which case 'errno' (or
+// 'GetLastError' on Windows) describes the error.  An interrupted system
+// call ('EINTR') is retried.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a Message to a Pipe
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that we assemble a message in a blob, from buffers of a factory, and
+// that we must send it through a file descriptor without flattening it into
+// one contiguous buffer.
+//
+// First, we create a pipe:
+//..
+//  int fds[2];
+//  int rc = pipe(fds);
+//  assert(0 == rc);
+//..
+// Then, we build a message in a blob made of small buffers:
+//..
+//  bdlbb::SimpleBlobBufferFactory factory(16);
+//  bdlbb::Blob                    message(&factory);
+//
+//  const char text[] = "Scatter/gather I/O writes all buffers at once.";
+//  bdlbb::BlobUtil::append(&message, text, sizeof text);
+//  assert(3 == message.numDataBuffers());
+//..
+// Next, we write the message to the pipe.  The bytes written are removed from
+// the blob, so that a partial write would leave the rest of the message in it:
+//..
+//  rc = bdlbb::BlobIoUtil::write(fds[1], &message);
+//  assert(static_cast<int>(sizeof text) == rc);
+//  assert(0 == message.length());
+//..
+// Finally, we read the message from the other end of the pipe into another
+// blob, whose buffers are allocated by the factory as needed:
+//..
+//  bdlbb::Blob received(&factory);
+//
+//  rc = bdlbb::BlobIoUtil::read(fds[0], &received, 1024);
+//  assert(static_cast<int>(sizeof text) == rc);
+//  assert(static_cast<int>(sizeof text) == received.length());
+//
+//  char flat[sizeof text];
+//  bdlbb::BlobUtil::copy(flat, received, 0, sizeof text);
+//  assert(0 == bsl::memcmp(text, flat, sizeof text));
+//
+//  close(fds[0]);
+//  close(fds[1]);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlbb_blob.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bsls_platform.h>
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+struct iovec;
+#endif
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                             // =================
+                             // struct BlobIoUtil
+                             // =================
+
+struct BlobIoUtil {
+    // This 'struct' provides a namespace for functions transferring data
+    // between a 'Blob' and a file descriptor with scatter/gather I/O.
+
+    // TYPES
+    typedef bdls::FilesystemUtil::FileDescriptor FileDescriptor;
+        // 'FileDescriptor' is an alias for the native file handle of the
+        // platform.
+
+    typedef bdls::FilesystemUtil::Offset Offset;
+        // 'Offset' is an alias for a signed value representing a position in
+        // a file.
+
+    enum {
+        k_MAX_IOVECS = 64  // maximum number of buffers transferred by one
+                           // system call
+    };
+
+    // CLASS METHODS
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+    static int loadIovecs(struct ::iovec *iovecs,
+                          int             maxNumIovecs,
+                          const Blob&     blob,
+                          int             position,
+                          int             length);
+        // Load into the specified 'iovecs' array, having at least the
+        // specified 'maxNumIovecs' elements, the description of the specified
+        // 'length' bytes at the specified 'position' in the buffers of the
+        // specified 'blob', and return the number of elements loaded.  If
+        // the range spans more than 'maxNumIovecs' buffers, only its first
+        // 'maxNumIovecs' buffers are described.  Empty buffers are skipped.
+        // The behavior is undefined unless '0 < maxNumIovecs',
+        // '0 <= position', '0 <= length', and
+        // 'position + length <= blob.totalSize()'.  Note that the range may
+        // extend past 'blob.length()', into the capacity of 'blob'.
+#endif
+
+    static int read(FileDescriptor  descriptor,
+                    Blob           *blob,
+                    int             maxNumBytes);
+        // Read at most the specified 'maxNumBytes' bytes from the current
+        // position of the file having the specified 'descriptor' directly
+        // into the buffers of the specified 'blob', following its data, and
+        // increase the length of 'blob' by the number of bytes read.  Return
+        // the number of bytes read, 0 at the end of the file, or a negative
+        // value on error.  If 'blob' does not have the capacity for
+        // 'maxNumBytes' more bytes, it is first grown with buffers from its
+        // factory.  Note that fewer than 'maxNumBytes' bytes may be read even
+        // if more are to come (as from a pipe or a socket), and that 'blob'
+        // keeps the buffers in which no byte was read, as capacity.  The
+        // behavior is undefined unless '0 < maxNumBytes', and 'blob' has a
+        // factory or the capacity for 'maxNumBytes' more bytes.
+
+    static int readAt(FileDescriptor  descriptor,
+                      Blob           *blob,
+                      int             maxNumBytes,
+                      Offset          fileOffset);
+        // Read at most the specified 'maxNumBytes' bytes at the specified
+        // 'fileOffset' of the file having the specified 'descriptor' directly
+        // into the buffers of the specified 'blob', following its data, and
+        // increase the length of 'blob' by the number of bytes read.  Return
+        // the number of bytes read, 0 at the end of the file, or a negative
+        // value on error.  If 'blob' does not have the capacity for
+        // 'maxNumBytes' more bytes, it is first grown with buffers from its
+        // factory.  The file pointer is not moved, except on Windows.  The
+        // behavior is undefined unless '0 < maxNumBytes', '0 <= fileOffset',
+        // the file supports seeking, and 'blob' has a factory or the capacity
+        // for 'maxNumBytes' more bytes.
+
+    static int write(FileDescriptor descriptor, Blob *blob);
+        // Write the data of the specified 'blob' at the current position of
+        // the file having the specified 'descriptor', and remove the bytes
+        // written from the front of 'blob'.  Return the number of bytes
+        // written, or a negative value if an error occurred before any byte
+        // was written.  Partial writes are continued until all the data is
+        // written or the system reports an error; if an error occurs after
+        // some bytes were written (for example, because a non-blocking socket
+        // would block), the number of bytes written is returned and 'blob'
+        // holds the data remaining to be written.
+
+    static int writeAt(FileDescriptor  descriptor,
+                       Blob           *blob,
+                       Offset          fileOffset);
+        // Write the data of the specified 'blob' at the specified 'fileOffset'
+        // of the file having the specified 'descriptor', and remove the bytes
+        // written from the front of 'blob'.  Return the number of bytes
+        // written, or a negative value if an error occurred before any byte
+        // was written.  Partial writes are continued until all the data is
+        // written or the system reports an error, in which case 'blob' holds
+        // the data remaining to be written.  The file pointer is not moved,
+        // except on Windows.  The behavior is undefined unless
+        // '0 <= fileOffset' and the file supports seeking.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
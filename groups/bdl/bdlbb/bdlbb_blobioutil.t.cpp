@@ -0,0 +1,1030 @@
+// bdlbb_blobioutil.t.cpp                                             -*-C++-*-
+#include <bdlbb_blobioutil.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+#include <fcntl.h>       // 'fcntl', 'O_NONBLOCK'
+#include <sys/uio.h>     // 'iovec'
+#include <unistd.h>      // 'close', 'pipe'
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The functions of 'bdlbb::BlobIoUtil' transfer data between the buffers of a
+// blob and a file descriptor.  The concerns are that the 'iovec' arrays built
+// describe exactly the range requested, skipping empty buffers and limited to
+// the number of elements available; that reads land past the data of the blob
+// and grow it with buffers from its factory; that writes consume the blob,
+// also when it has more buffers than one system call can take and when the
+// write is partial; that the positioned variants use the offset requested
+// without moving the file pointer; and that errors are reported without
+// altering the blob.  Pipes are used on POSIX platforms to provoke short
+// reads and partial writes.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int loadIovecs(iovec *, int, const Blob&, int, int);
+// [ 3] int read(FileDescriptor, Blob *, int);
+// [ 5] int readAt(FileDescriptor, Blob *, int, Offset);
+// [ 4] int write(FileDescriptor, Blob *);
+// [ 5] int writeAt(FileDescriptor, Blob *, Offset);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: GATHER WRITE VS. ONE WRITE PER BUFFER
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::BlobIoUtil     Util;
+typedef bdls::FilesystemUtil  FsUtil;
+typedef Util::FileDescriptor  FileDescriptor;
+typedef Util::Offset          Offset;
+
+// ============================================================================
+//                         HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void fillBlob(bdlbb::Blob *blob, int length, char seed)
+    // Append to the specified 'blob' the specified 'length' bytes of a
+    // pattern derived from the specified 'seed'.
+{
+    for (int i = 0; i < length; ++i) {
+        const char c = static_cast<char>(seed + i % 61);
+        bdlbb::BlobUtil::append(blob, &c, 1);
+    }
+}
+
+bool checkBlob(const bdlbb::Blob& blob, int offset, int length, char seed)
+    // Return 'true' if the specified 'length' bytes at the specified 'offset'
+    // in the specified 'blob' hold the pattern written by 'fillBlob' for the
+    // specified 'seed', and 'false' otherwise.
+{
+    for (int i = 0; i < length; ++i) {
+        char c;
+        bdlbb::BlobUtil::copy(&c, blob, offset + i, 1);
+        if (c != static_cast<char>(seed + i % 61)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+FileDescriptor createTemporaryFile(bsl::string *path)
+    // Create a temporary file, load its path into the specified 'path', and
+    // return its descriptor.
+{
+    // 'bdls::FilesystemUtil' uses the default allocator for temporary
+    // strings; keep it off the default allocator monitored by the test cases.
+
+    bslma::DefaultAllocatorGuard guard(
+                                     &bslma::NewDeleteAllocator::singleton());
+
+    return FsUtil::createTemporaryFile(path, "bdlbb_blobioutil.t.");
+}
+
+void removeFile(const bsl::string& path)
+    // Remove the file having the specified 'path'.
+{
+    bslma::DefaultAllocatorGuard guard(
+                                     &bslma::NewDeleteAllocator::singleton());
+
+    FsUtil::remove(path);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+///Example 1: Writing a Message to a Pipe
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that we assemble a message in a blob, from buffers of a factory, and
+// that we must send it through a file descriptor without flattening it into
+// one contiguous buffer.
+//
+// First, we create a pipe:
+//..
+    int fds[2];
+    int rc = pipe(fds);
+    ASSERT(0 == rc);
+//..
+// Then, we build a message in a blob made of small buffers:
+//..
+    bdlbb::SimpleBlobBufferFactory factory(16);
+    bdlbb::Blob                    message(&factory);
+
+    const char text[] = "Scatter/gather I/O writes all buffers at once.";
+    bdlbb::BlobUtil::append(&message, text, sizeof text);
+    ASSERT(3 == message.numDataBuffers());
+//..
+// Next, we write the message to the pipe.  The bytes written are removed from
+// the blob, so that a partial write would leave the rest of the message in it:
+//..
+    rc = bdlbb::BlobIoUtil::write(fds[1], &message);
+    ASSERT(static_cast<int>(sizeof text) == rc);
+    ASSERT(0 == message.length());
+//..
+// Finally, we read the message from the other end of the pipe into another
+// blob, whose buffers are allocated by the factory as needed:
+//..
+    bdlbb::Blob received(&factory);
+
+    rc = bdlbb::BlobIoUtil::read(fds[0], &received, 1024);
+    ASSERT(static_cast<int>(sizeof text) == rc);
+    ASSERT(static_cast<int>(sizeof text) == received.length());
+
+    char flat[sizeof text];
+    bdlbb::BlobUtil::copy(flat, received, 0, sizeof text);
+    ASSERT(0 == bsl::memcmp(text, flat, sizeof text));
+
+    close(fds[0]);
+    close(fds[1]);
+//..
+#endif
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'readAt' AND 'writeAt'
+        //
+        // Concerns:
+        //: 1 'writeAt' writes the data of the blob at the offset requested,
+        //:   consumes the blob, and does not move the file pointer.
+        //:
+        //: 2 'readAt' reads the data at the offset requested into the blob,
+        //:   returns 0 past the end of the file, and does not move the file
+        //:   pointer.
+        //:
+        //: 3 Errors are reported with a negative value and leave the blob
+        //:   unchanged.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Write blobs of various shapes at various offsets of a temporary
+        //:   file, read them back at the same offsets into blobs of another
+        //:   shape, and verify the data and the file pointer.  (C-1..2)
+        //:
+        //: 2 Call the functions on a closed descriptor.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a negative offset (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   int readAt(FileDescriptor, Blob *, int, Offset);
+        //   int writeAt(FileDescriptor, Blob *, Offset);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'readAt' AND 'writeAt'" << endl
+                          << "======================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_bufferSize;    // size of the buffers written
+            int d_length;        // length written
+            int d_offset;        // offset in the file
+            int d_readSize;      // size of the buffers read into
+        } DATA[] = {
+            //LINE  BUFFER  LENGTH  OFFSET  READ
+            //----  ------  ------  ------  ----
+            { L_,      1,      1,      0,     1 },
+            { L_,      7,    100,      0,    64 },
+            { L_,     64,   1000,     13,     3 },
+            { L_,      3,   1000,   5000,  1024 },
+            { L_,     16,  10000,    100,    16 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE   = DATA[ti].d_line;
+            const int LENGTH = DATA[ti].d_length;
+            const int OFFSET = DATA[ti].d_offset;
+
+            bsl::string          path(&ta);
+            const FileDescriptor fd = createTemporaryFile(&path);
+            ASSERTV(LINE, FsUtil::k_INVALID_FD != fd);
+
+            bdlbb::SimpleBlobBufferFactory writeFactory(DATA[ti].d_bufferSize,
+                                                        &ta);
+            bdlbb::SimpleBlobBufferFactory readFactory(DATA[ti].d_readSize,
+                                                       &ta);
+            {
+                bdlbb::Blob source(&writeFactory, &ta);
+                fillBlob(&source, LENGTH, static_cast<char>(ti));
+
+                ASSERTV(LINE, LENGTH == Util::writeAt(fd, &source, OFFSET));
+                ASSERTV(LINE, 0 == source.length());
+                ASSERTV(LINE, 0 == FsUtil::seek(fd,
+                                                0,
+                                                FsUtil::e_SEEK_FROM_CURRENT));
+            }
+            {
+                bdlbb::Blob dest(&readFactory, &ta);
+
+                int total = 0;
+                while (total < LENGTH) {
+                    const int rc = Util::readAt(fd,
+                                                &dest,
+                                                LENGTH - total,
+                                                OFFSET + total);
+                    ASSERTV(LINE, rc, 0 < rc);
+                    if (rc <= 0) {
+                        break;
+                    }
+                    total += rc;
+                }
+                ASSERTV(LINE, LENGTH == dest.length());
+                ASSERTV(LINE, checkBlob(dest, 0, LENGTH,
+                                        static_cast<char>(ti)));
+
+                ASSERTV(LINE, 0 == Util::readAt(fd,
+                                                &dest,
+                                                10,
+                                                OFFSET + LENGTH));
+                ASSERTV(LINE, LENGTH == dest.length());
+                ASSERTV(LINE, 0 == FsUtil::seek(fd,
+                                                0,
+                                                FsUtil::e_SEEK_FROM_CURRENT));
+            }
+
+            FsUtil::close(fd);
+            removeFile(path);
+        }
+
+        if (verbose) cout << "\tTesting errors." << endl;
+        {
+            bsl::string          path(&ta);
+            const FileDescriptor fd = createTemporaryFile(&path);
+            FsUtil::close(fd);
+            removeFile(path);
+
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+            fillBlob(&blob, 20, 'a');
+
+            ASSERT(0 > Util::writeAt(fd, &blob, 0));
+            ASSERT(20 == blob.length());
+
+            ASSERT(0 > Util::readAt(fd, &blob, 10, 0));
+            ASSERT(20 == blob.length());
+            ASSERT(checkBlob(blob, 0, 20, 'a'));
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::string          path(&ta);
+            const FileDescriptor fd = createTemporaryFile(&path);
+
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            ASSERT_PASS(Util::readAt(fd, &blob, 1, 0));
+            ASSERT_FAIL(Util::readAt(fd, &blob, 1, -1));
+            ASSERT_FAIL(Util::readAt(fd, &blob, 0, 0));
+            ASSERT_FAIL(Util::readAt(fd, 0, 1, 0));
+            ASSERT_PASS(Util::writeAt(fd, &blob, 0));
+            ASSERT_FAIL(Util::writeAt(fd, &blob, -1));
+            ASSERT_FAIL(Util::writeAt(fd, 0, 0));
+
+            FsUtil::close(fd);
+            removeFile(path);
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'write'
+        //
+        // Concerns:
+        //: 1 'write' writes all the data of the blob, in order, and removes it
+        //:   from the blob, also when the blob has more buffers than one
+        //:   system call can take.
+        //:
+        //: 2 'write' writes the data of the blob only, not its capacity.
+        //:
+        //: 3 When the descriptor cannot take all the data, 'write' returns the
+        //:   number of bytes written and leaves the rest of the data in the
+        //:   blob, so that a later call writes the rest.
+        //:
+        //: 4 'write' of an empty blob returns 0, and an error before any byte
+        //:   is written is reported with a negative value, leaving the blob
+        //:   unchanged.
+        //
+        // Plan:
+        //: 1 Write blobs of various shapes to a temporary file, and verify the
+        //:   contents of the file and that the blobs are empty.  (C-1..2)
+        //:
+        //: 2 On POSIX platforms, write a blob larger than the capacity of a
+        //:   non-blocking pipe, verify the partial write, then drain the pipe
+        //:   and write the rest.  (C-3)
+        //:
+        //: 3 Write an empty blob, and a blob to a closed descriptor.  (C-4)
+        //
+        // Testing:
+        //   int write(FileDescriptor, Blob *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'write'" << endl
+                          << "=======" << endl;
+
+        static const struct {
+            int d_line;
+            int d_bufferSize;  // size of the buffers of the blob
+            int d_length;      // length of the blob
+            int d_capacity;    // extra capacity of the blob
+        } DATA[] = {
+            //LINE  BUFFER  LENGTH  CAPACITY
+            //----  ------  ------  --------
+            { L_,      1,      1,         0 },
+            { L_,      1,    200,         5 },
+            { L_,      7,   1000,       100 },
+            { L_,     16,    100,         0 },
+            { L_,   1000,   5000,       999 },
+            { L_,      1,  10000,         0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE   = DATA[ti].d_line;
+            const int LENGTH = DATA[ti].d_length;
+
+            bsl::string          path(&ta);
+            const FileDescriptor fd = createTemporaryFile(&path);
+            ASSERTV(LINE, FsUtil::k_INVALID_FD != fd);
+
+            bdlbb::SimpleBlobBufferFactory factory(DATA[ti].d_bufferSize,
+                                                   &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            fillBlob(&blob, LENGTH, static_cast<char>(ti));
+            blob.setLength(LENGTH + DATA[ti].d_capacity);
+            blob.setLength(LENGTH);
+
+            ASSERTV(LINE, LENGTH == Util::write(fd, &blob));
+            ASSERTV(LINE, 0 == blob.length());
+            ASSERTV(LINE, LENGTH == FsUtil::seek(fd,
+                                                 0,
+                                                 FsUtil::e_SEEK_FROM_CURRENT));
+
+            bsl::vector<char> contents(LENGTH + 1, &ta);
+            FsUtil::seek(fd, 0, FsUtil::e_SEEK_FROM_BEGINNING);
+            ASSERTV(LINE, LENGTH == FsUtil::read(fd,
+                                                 contents.data(),
+                                                 LENGTH + 1));
+
+            bdlbb::Blob expected(&factory, &ta);
+            fillBlob(&expected, LENGTH, static_cast<char>(ti));
+            ASSERTV(LINE, checkBlob(expected, 0, LENGTH,
+                                    static_cast<char>(ti)));
+
+            bsl::vector<char> flat(LENGTH, &ta);
+            bdlbb::BlobUtil::copy(flat.data(), expected, 0, LENGTH);
+            ASSERTV(LINE, 0 == bsl::memcmp(flat.data(),
+                                           contents.data(),
+                                           LENGTH));
+
+            FsUtil::close(fd);
+            removeFile(path);
+        }
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+        if (verbose) cout << "\tTesting partial writes." << endl;
+        {
+            int fds[2];
+            ASSERT(0 == pipe(fds));
+            ASSERT(0 == fcntl(fds[1], F_SETFL, O_NONBLOCK));
+
+            const int LENGTH = 1024 * 1024;  // more than a pipe holds
+
+            bdlbb::SimpleBlobBufferFactory factory(4096, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+            fillBlob(&blob, LENGTH, 'x');
+
+            const int written = Util::write(fds[1], &blob);
+            if (veryVerbose) { T_ P(written) }
+
+            ASSERTV(written, 0 < written && written < LENGTH);
+            ASSERTV(blob.length(), LENGTH - written == blob.length());
+
+            // The pipe is full: nothing more can be written.
+
+            ASSERT(0 > Util::write(fds[1], &blob));
+            ASSERT(LENGTH - written == blob.length());
+
+            // Drain the pipe while writing the rest.
+
+            bdlbb::Blob received(&factory, &ta);
+            while (received.length() < LENGTH) {
+                const int rc = Util::read(fds[0], &received, 65536);
+                ASSERTV(rc, 0 < rc);
+                if (rc <= 0) {
+                    break;
+                }
+                if (0 < blob.length()) {
+                    Util::write(fds[1], &blob);
+                }
+            }
+            ASSERT(0 == blob.length());
+            ASSERT(LENGTH == received.length());
+            ASSERT(checkBlob(received, 0, LENGTH, 'x'));
+
+            close(fds[0]);
+            close(fds[1]);
+        }
+#endif
+
+        if (verbose) cout << "\tTesting empty blobs and errors." << endl;
+        {
+            bsl::string          path(&ta);
+            const FileDescriptor fd = createTemporaryFile(&path);
+
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            ASSERT(0 == Util::write(fd, &blob));
+
+            FsUtil::close(fd);
+            removeFile(path);
+
+            fillBlob(&blob, 20, 'a');
+            ASSERT(0 > Util::write(fd, &blob));
+            ASSERT(20 == blob.length());
+            ASSERT(checkBlob(blob, 0, 20, 'a'));
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'read'
+        //
+        // Concerns:
+        //: 1 'read' reads into the buffers of the blob, following its data,
+        //:   including the rest of a partially filled buffer, and increases
+        //:   the length of the blob by the number of bytes read.
+        //:
+        //: 2 'read' grows the blob with buffers from its factory when it lacks
+        //:   the capacity for the bytes requested, and uses existing capacity
+        //:   otherwise.
+        //:
+        //: 3 'read' returns the number of bytes read, which may be fewer than
+        //:   requested, and 0 at the end of the file.
+        //:
+        //: 4 An error is reported with a negative value, leaving the length of
+        //:   the blob unchanged.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Write a pattern to a temporary file, and read it in chunks of
+        //:   various sizes into blobs of various shapes, some with existing
+        //:   data and capacity; verify the data, the lengths, and the number
+        //:   of buffers allocated.  (C-1..3)
+        //:
+        //: 2 Read from a closed descriptor.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   int read(FileDescriptor, Blob *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'read'" << endl
+                          << "======" << endl;
+
+        const int FILE_LENGTH = 5000;
+
+        bsl::string          path(&ta);
+        const FileDescriptor fd = createTemporaryFile(&path);
+        ASSERT(FsUtil::k_INVALID_FD != fd);
+        {
+            bdlbb::SimpleBlobBufferFactory factory(100, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+            fillBlob(&blob, FILE_LENGTH, 'r');
+            ASSERT(FILE_LENGTH == Util::write(fd, &blob));
+        }
+
+        static const struct {
+            int d_line;
+            int d_bufferSize;  // size of the buffers of the blob
+            int d_prefix;      // length of the data before the read
+            int d_capacity;    // extra capacity before the read
+            int d_chunk;       // bytes requested per read
+        } DATA[] = {
+            //LINE  BUFFER  PREFIX  CAPACITY  CHUNK
+            //----  ------  ------  --------  -----
+            { L_,      1,      0,        0,     1 },
+            { L_,      1,      3,       10,  5000 },
+            { L_,      7,      5,        0,   100 },
+            { L_,     16,     16,       16,    16 },
+            { L_,    100,     50,      100,   333 },
+            { L_,   1000,      0,     5000,  4999 },
+            { L_,   8192,      1,        0, 10000 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE     = DATA[ti].d_line;
+            const int BUFFER   = DATA[ti].d_bufferSize;
+            const int PREFIX   = DATA[ti].d_prefix;
+            const int CAPACITY = DATA[ti].d_capacity;
+            const int CHUNK    = DATA[ti].d_chunk;
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            fillBlob(&blob, PREFIX, 'p');
+            blob.setLength(PREFIX + CAPACITY);
+            blob.setLength(PREFIX);
+
+            ASSERTV(LINE, 0 == FsUtil::seek(fd,
+                                            0,
+                                            FsUtil::e_SEEK_FROM_BEGINNING));
+
+            int total = 0;
+            for (;;) {
+                const int totalSize = blob.totalSize();
+                const int rc        = Util::read(fd, &blob, CHUNK);
+
+                ASSERTV(LINE, rc, 0 <= rc && rc <= CHUNK);
+                if (rc <= 0) {
+                    break;
+                }
+                total += rc;
+                ASSERTV(LINE, PREFIX + total == blob.length());
+
+                // The blob grew only if it lacked the capacity.
+
+                const int needed = blob.length() - rc + CHUNK;
+                if (needed <= totalSize) {
+                    ASSERTV(LINE, totalSize == blob.totalSize());
+                }
+                else {
+                    ASSERTV(LINE, needed <= blob.totalSize());
+                    ASSERTV(LINE, needed + BUFFER > blob.totalSize());
+                }
+            }
+
+            ASSERTV(LINE, total, FILE_LENGTH == total);
+            ASSERTV(LINE, PREFIX + FILE_LENGTH == blob.length());
+            ASSERTV(LINE, checkBlob(blob, 0, PREFIX, 'p'));
+            ASSERTV(LINE, checkBlob(blob, PREFIX, FILE_LENGTH, 'r'));
+
+            // At the end of the file, nothing is read.
+
+            ASSERTV(LINE, 0 == Util::read(fd, &blob, CHUNK));
+            ASSERTV(LINE, PREFIX + FILE_LENGTH == blob.length());
+        }
+
+        if (verbose) cout << "\tTesting errors." << endl;
+        {
+            bsl::string          path2(&ta);
+            const FileDescriptor closedFd = createTemporaryFile(&path2);
+            FsUtil::close(closedFd);
+            removeFile(path2);
+
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+            fillBlob(&blob, 20, 'a');
+
+            ASSERT(0 > Util::read(closedFd, &blob, 10));
+            ASSERT(20 == blob.length());
+            ASSERT(checkBlob(blob, 0, 20, 'a'));
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(8, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            ASSERT_PASS(Util::read(fd, &blob, 1));
+            ASSERT_FAIL(Util::read(fd, &blob, 0));
+            ASSERT_FAIL(Util::read(fd, 0, 1));
+        }
+
+        FsUtil::close(fd);
+        removeFile(path);
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'loadIovecs'
+        //
+        // Concerns:
+        //: 1 The 'iovec' elements loaded describe, in order, exactly the bytes
+        //:   of the range requested, which may start and end anywhere in a
+        //:   buffer and may extend into the capacity of the blob.
+        //:
+        //: 2 Empty buffers are skipped.
+        //:
+        //: 3 No more than 'maxNumIovecs' elements are loaded, describing a
+        //:   prefix of the range.
+        //:
+        //: 4 An empty range loads no element.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For blobs of buffers of various sizes, including empty ones, and
+        //:   for every range of the blob and several values of
+        //:   'maxNumIovecs', compare the bytes described by the elements
+        //:   loaded with the bytes of the range.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   int loadIovecs(iovec *, int, const Blob&, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'loadIovecs'" << endl
+                          << "============" << endl;
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+        bdlbb::SimpleBlobBufferFactory factory(5, &ta);
+        bdlbb::Blob                    blob(&factory, &ta);
+
+        // Build a blob of buffers of sizes 5, 0, 1, 5, 0, 3, and 5, of which
+        // the last is capacity.
+
+        static const int SIZES[] = { 5, 0, 1, 5, 0, 3, 5 };
+        const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            bdlbb::BlobBuffer buffer;
+            factory.allocate(&buffer);
+            buffer.setSize(SIZES[i]);
+            if (i < NUM_SIZES - 1) {
+                blob.appendDataBuffer(buffer);
+            }
+            else {
+                blob.appendBuffer(buffer);
+            }
+        }
+        const int TOTAL = blob.totalSize();
+        ASSERT(19 == TOTAL);
+        ASSERT(14 == blob.length());
+
+        // Number the bytes, capacity included.
+
+        for (int i = 0, n = 0; i < blob.numBuffers(); ++i) {
+            for (int j = 0; j < blob.buffer(i).size(); ++j) {
+                blob.buffer(i).data()[j] = static_cast<char>(n++);
+            }
+        }
+
+        for (int position = 0; position <= TOTAL; ++position) {
+            for (int length = 0; position + length <= TOTAL; ++length) {
+                for (int maxNum = 1; maxNum <= 6; ++maxNum) {
+                    struct ::iovec iovecs[6];
+                    const int      numIovecs = Util::loadIovecs(iovecs,
+                                                                maxNum,
+                                                                blob,
+                                                                position,
+                                                                length);
+
+                    ASSERTV(position, length, maxNum,
+                            0 <= numIovecs && numIovecs <= maxNum);
+                    ASSERTV(position, length, maxNum,
+                            (0 == length) == (0 == numIovecs));
+
+                    // The elements describe consecutive bytes of the range.
+
+                    int next = position;
+                    for (int i = 0; i < numIovecs; ++i) {
+                        const char *base =
+                                 static_cast<const char *>(iovecs[i].iov_base);
+
+                        ASSERTV(position, length, maxNum, i,
+                                0 < iovecs[i].iov_len);
+                        for (bsl::size_t j = 0; j < iovecs[i].iov_len; ++j) {
+                            ASSERTV(position, length, maxNum, i, j,
+                                    next == base[j]);
+                            ++next;
+                        }
+                    }
+                    ASSERTV(position, length, maxNum,
+                            next <= position + length);
+
+                    // The whole range is described unless all the elements
+                    // are used.
+
+                    if (numIovecs < maxNum) {
+                        ASSERTV(position, length, maxNum,
+                                next == position + length);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            struct ::iovec iovecs[4];
+
+            ASSERT_PASS(Util::loadIovecs(iovecs, 4, blob, 0, TOTAL));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, 4, blob, 0, TOTAL + 1));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, 4, blob, 1, TOTAL));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, 4, blob, -1, 1));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, 4, blob, 0, -1));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, 0, blob, 0, 1));
+            ASSERT_FAIL(Util::loadIovecs(0, 4, blob, 0, 1));
+        }
+#endif
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a blob of several buffers to a temporary file, and read it
+        //:   back into another blob.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bsl::string          path(&ta);
+        const FileDescriptor fd = createTemporaryFile(&path);
+        ASSERT(FsUtil::k_INVALID_FD != fd);
+
+        bdlbb::SimpleBlobBufferFactory factory(10, &ta);
+
+        bdlbb::Blob source(&factory, &ta);
+        fillBlob(&source, 95, 'A');
+        ASSERT(10 == source.numDataBuffers());
+
+        ASSERT(95 == Util::write(fd, &source));
+        ASSERT(0  == source.length());
+
+        bdlbb::Blob dest(&factory, &ta);
+        ASSERT(95 == Util::readAt(fd, &dest, 200, 0));
+        ASSERT(95 == dest.length());
+        ASSERT(checkBlob(dest, 0, 95, 'A'));
+
+        FsUtil::close(fd);
+        removeFile(path);
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: GATHER WRITE VS. ONE WRITE PER BUFFER
+        //
+        // Concerns:
+        //: 1 Compare writing a blob with 'write' (one system call per 64
+        //:   buffers) against writing each of its buffers with
+        //:   'bdls::FilesystemUtil::write', and against flattening it into a
+        //:   contiguous buffer first.  Note that flattening remains cheaper
+        //:   for blobs of a few kilobytes, whose copy costs less than the
+        //:   bookkeeping of the gather write.
+        //
+        // Plan:
+        //: 1 Repeatedly write a blob of a length given as the third argument
+        //:   (by default, 4K) in buffers of a size given as the second
+        //:   argument (by default, 256 bytes) to a temporary file, with each
+        //:   method, and report the time per blob.
+        //
+        // Testing:
+        //   PERFORMANCE: GATHER WRITE VS. ONE WRITE PER BUFFER
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: GATHER WRITE VS. ONE WRITE PER BUFFER" << endl
+             << "==================================================" << endl;
+
+        const int BUFFER_SIZE = argc > 2 ? atoi(argv[2]) : 256;
+        const int LENGTH      = argc > 3 ? atoi(argv[3]) : 4096;
+        const int NUM_WRITES  = 200 * 1024 * 1024 / LENGTH;
+
+        bsl::string          path(&ta);
+        const FileDescriptor fd = createTemporaryFile(&path);
+        ASSERT(FsUtil::k_INVALID_FD != fd);
+
+        bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+        bdlbb::Blob                    message(&factory, &ta);
+        fillBlob(&message, LENGTH, 'm');
+
+        bsl::vector<char> flat(LENGTH, &ta);
+        bsls::Stopwatch   timer;
+
+        cout << "blob length: " << LENGTH
+             << ", buffer size: " << BUFFER_SIZE
+             << ", buffers per blob: " << message.numDataBuffers() << endl
+             << "microseconds per blob:" << endl;
+
+        timer.start();
+        for (int i = 0; i < NUM_WRITES; ++i) {
+            bdlbb::Blob blob(message, &ta);
+            Util::writeAt(fd, &blob, 0);
+        }
+        timer.stop();
+        cout << "\tBlobIoUtil::writeAt:        "
+             << timer.elapsedTime() * 1e6 / NUM_WRITES << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_WRITES; ++i) {
+            FsUtil::seek(fd, 0, FsUtil::e_SEEK_FROM_BEGINNING);
+            for (int j = 0; j < message.numDataBuffers(); ++j) {
+                const int size = j == message.numDataBuffers() - 1
+                               ? message.lastDataBufferLength()
+                               : message.buffer(j).size();
+                FsUtil::write(fd, message.buffer(j).data(), size);
+            }
+        }
+        timer.stop();
+        cout << "\tone write per buffer:       "
+             << timer.elapsedTime() * 1e6 / NUM_WRITES << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_WRITES; ++i) {
+            FsUtil::seek(fd, 0, FsUtil::e_SEEK_FROM_BEGINNING);
+            bdlbb::BlobUtil::copy(flat.data(), message, 0, LENGTH);
+            FsUtil::write(fd, flat.data(), LENGTH);
+        }
+        timer.stop();
+        cout << "\tcopy, then one write:       "
+             << timer.elapsedTime() * 1e6 / NUM_WRITES << endl;
+
+        FsUtil::close(fd);
+        removeFile(path);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
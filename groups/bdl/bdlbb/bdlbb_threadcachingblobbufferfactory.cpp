@@ -0,0 +1,551 @@
+// bdlbb_threadcachingblobbufferfactory.cpp                           -*-C++-*-
+#include <bdlbb_threadcachingblobbufferfactory.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_threadcachingblobbufferfactory_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslma_sharedptrrep.h>
+
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_memory.h>
+
+#include <new>       // placement 'new'
+#include <typeinfo>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Each block starts with a 'ThreadCachingBlobBufferFactory_Rep', the shared
+// pointer representation of the buffer that follows it.  The representation
+// is constructed once, when the block is created, and is never destroyed
+// until the memory of the block is released with the factory: when the last
+// reference to the buffer is released, 'disposeRep' returns the block to the
+// factory, and 'allocate' later resets its reference counts for a new
+// buffer.  While a block is free, its header links it into a list; the first
+// block of a list in the depot also links the list to the next list, and
+// records the number of blocks in the list.
+//
+// The cache of a thread holds a "loaded" list, from which blocks are taken
+// and to which they are returned, and a "spare" list, which is either empty
+// or full.  Having two lists ensures that a thread alternately allocating and
+// releasing a buffer at the boundary of a list does not go to the depot each
+// time.  A cache is small enough to be held in a block of the pool.
+
+namespace BloombergLP {
+namespace bdlbb {
+namespace {
+
+enum {
+    k_MIN_LIST_BLOCKS = 2,           // minimum number of blocks in a list
+
+    k_MAX_LIST_BLOCKS = 32,          // maximum number of blocks in a list
+
+    k_MAX_LIST_BYTES  = 256 * 1024   // maximum number of bytes in a list,
+                                     // unless 'k_MIN_LIST_BLOCKS' requires
+                                     // more
+};
+
+}  // close unnamed namespace
+
+                 // ========================================
+                 // class ThreadCachingBlobBufferFactory_Rep
+                 // ========================================
+
+class ThreadCachingBlobBufferFactory_Rep : public bslma::SharedPtrRep {
+    // This component-private class is the header of each block supplied by a
+    // 'ThreadCachingBlobBufferFactory': the shared pointer representation of
+    // the buffer following it in the block, which returns the block to the
+    // factory when the buffer is no longer referenced.
+
+  public:
+    // PUBLIC DATA
+    ThreadCachingBlobBufferFactory     *d_factory_p;   // factory owning the
+                                                       // block
+
+    ThreadCachingBlobBufferFactory_Rep *d_next_p;      // next block in the
+                                                       // same list
+
+    ThreadCachingBlobBufferFactory_Rep *d_nextList_p;  // first block of next
+                                                       // list in the depot
+
+    int                                 d_numBlocks;   // number of blocks in
+                                                       // a list in the depot
+
+    // CREATORS
+    explicit
+    ThreadCachingBlobBufferFactory_Rep(
+                                     ThreadCachingBlobBufferFactory *factory)
+        // Create the header of a block supplied by the specified 'factory'.
+    : d_factory_p(factory)
+    , d_next_p(0)
+    , d_nextList_p(0)
+    , d_numBlocks(0)
+    {
+    }
+
+    // MANIPULATORS
+    virtual void disposeObject()
+        // Do nothing: the buffer holds no object.
+    {
+    }
+
+    virtual void disposeRep()
+        // Return this block to the factory that supplied it.
+    {
+        d_factory_p->deallocate(this);
+    }
+
+    virtual void *getDeleter(const std::type_info&)
+        // Return 0: buffers have no deleter.
+    {
+        return 0;
+    }
+
+    // ACCESSORS
+    char *buffer() const;
+        // Return the address of the buffer following this header.
+
+    virtual void *originalPtr() const
+        // Return the address of the buffer following this header.
+    {
+        return buffer();
+    }
+};
+
+namespace {
+
+typedef ThreadCachingBlobBufferFactory_Rep Rep;
+
+const bsls::Types::size_type k_HEADER_SIZE =
+                         (sizeof(Rep) + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+                                                                          - 1)
+                         & ~static_cast<bsls::Types::size_type>(
+                                 bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1);
+    // offset of the buffer in a block
+
+}  // close unnamed namespace
+
+// ACCESSORS
+inline
+char *ThreadCachingBlobBufferFactory_Rep::buffer() const
+{
+    return const_cast<char *>(reinterpret_cast<const char *>(this))
+                                                               + k_HEADER_SIZE;
+}
+
+                 // =========================================
+                 // struct ThreadCachingBlobBufferFactory_List
+                 // =========================================
+
+struct ThreadCachingBlobBufferFactory_List {
+    // This component-private 'struct' describes a list of free blocks.
+
+    Rep *d_head_p;     // first block, or 0 if the list is empty
+    int  d_numBlocks;  // number of blocks in the list
+};
+
+namespace {
+
+typedef ThreadCachingBlobBufferFactory_List List;
+
+bsls::Types::size_type blockSize(int bufferSize)
+    // Return the size of the blocks holding buffers of the specified
+    // 'bufferSize', headers included, rounded up to the maximal alignment.
+{
+    return (k_HEADER_SIZE + bufferSize
+                          + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+         & ~static_cast<bsls::Types::size_type>(
+                                 bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1);
+}
+
+int maxListBlocks(int bufferSize)
+    // Return the number of blocks in a full list of blocks holding buffers of
+    // the specified 'bufferSize'.
+{
+    const bsls::Types::size_type numBlocks =
+                                      k_MAX_LIST_BYTES / blockSize(bufferSize);
+
+    return numBlocks < k_MIN_LIST_BLOCKS
+           ? k_MIN_LIST_BLOCKS
+           : numBlocks > k_MAX_LIST_BLOCKS
+           ? k_MAX_LIST_BLOCKS
+           : static_cast<int>(numBlocks);
+}
+
+inline
+Rep *popBlock(List *list)
+    // Remove the first block from the specified 'list' and return its
+    // address.  The behavior is undefined unless 'list' is not empty.
+{
+    Rep *block     = list->d_head_p;
+    list->d_head_p = block->d_next_p;
+    --list->d_numBlocks;
+    return block;
+}
+
+inline
+void pushBlock(List *list, Rep *block)
+    // Add the specified 'block' to the front of the specified 'list'.
+{
+    block->d_next_p = list->d_head_p;
+    list->d_head_p  = block;
+    ++list->d_numBlocks;
+}
+
+}  // close unnamed namespace
+
+                 // ==========================================
+                 // struct ThreadCachingBlobBufferFactory_Cache
+                 // ==========================================
+
+struct ThreadCachingBlobBufferFactory_Cache {
+    // This component-private 'struct' holds the free blocks cached by one
+    // thread for one factory.
+
+    // PUBLIC DATA
+    ThreadCachingBlobBufferFactory *d_factory_p;  // factory owning this cache
+    List                            d_loaded;     // loaded list
+    List                            d_spare;      // spare list
+
+    // CLASS METHODS
+    static void releaseOnThreadExit(void *cache)
+        // Return the blocks of the specified 'cache' to the depot, and free
+        // 'cache'.  Note that this function is the cleanup function of the
+        // thread-specific key of the factory.
+    {
+        if (cache) {
+            ThreadCachingBlobBufferFactory_Cache *object =
+                   static_cast<ThreadCachingBlobBufferFactory_Cache *>(cache);
+
+            object->flush();
+            object->d_factory_p->d_pool.deallocate(object);
+        }
+    }
+
+    // MANIPULATORS
+    void flush()
+        // Move the blocks of each list of this cache to the depot.
+    {
+        if (d_loaded.d_head_p) {
+            d_factory_p->pushToDepot(&d_loaded);
+        }
+        if (d_spare.d_head_p) {
+            d_factory_p->pushToDepot(&d_spare);
+        }
+    }
+};
+
+BSLMF_ASSERT(sizeof(ThreadCachingBlobBufferFactory_Cache) <= sizeof(Rep));
+
+namespace {
+
+typedef ThreadCachingBlobBufferFactory_Cache Cache;
+
+}  // close unnamed namespace
+
+                    // ------------------------------------
+                    // class ThreadCachingBlobBufferFactory
+                    // ------------------------------------
+
+// PRIVATE MANIPULATORS
+Rep *ThreadCachingBlobBufferFactory::allocateFromDepot(Cache *cache)
+{
+    if (!cache) {
+        cache = createCache();
+    }
+
+    if (cache) {
+        List *loaded = &cache->d_loaded;
+        List *spare  = &cache->d_spare;
+
+        if (spare->d_head_p) {
+            *loaded            = *spare;
+            spare->d_head_p    = 0;
+            spare->d_numBlocks = 0;
+        }
+        else {
+            popFromDepot(loaded);
+        }
+
+        if (loaded->d_head_p) {
+            return popBlock(loaded);                                  // RETURN
+        }
+    }
+    else {
+        // Without a cache, take a list from the depot, keep its first block,
+        // and return the others.
+
+        List list = { 0, 0 };
+        popFromDepot(&list);
+
+        if (list.d_head_p) {
+            Rep *block = popBlock(&list);
+            if (list.d_head_p) {
+                pushToDepot(&list);
+            }
+            return block;                                             // RETURN
+        }
+    }
+
+    Rep *block = new (d_pool.allocate()) Rep(this);
+    ++d_numBuffers;
+    return block;
+}
+
+Cache *ThreadCachingBlobBufferFactory::createCache()
+{
+    if (!d_hasKey) {
+        return 0;                                                     // RETURN
+    }
+
+    Cache *cache = static_cast<Cache *>(d_pool.allocate());
+
+    cache->d_factory_p         = this;
+    cache->d_loaded.d_head_p    = 0;
+    cache->d_loaded.d_numBlocks = 0;
+    cache->d_spare.d_head_p     = 0;
+    cache->d_spare.d_numBlocks  = 0;
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_key, cache)) {
+        d_pool.deallocate(cache);
+        return 0;                                                     // RETURN
+    }
+    return cache;
+}
+
+void ThreadCachingBlobBufferFactory::deallocate(Rep *block)
+{
+    Cache *cache = d_hasKey
+                   ? static_cast<Cache *>(
+                                       bslmt::ThreadUtil::getSpecific(d_key))
+                   : 0;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                     cache && cache->d_loaded.d_numBlocks < d_maxListBlocks)) {
+        pushBlock(&cache->d_loaded, block);
+        return;                                                       // RETURN
+    }
+
+    deallocateToDepot(block, cache);
+}
+
+void ThreadCachingBlobBufferFactory::deallocateToDepot(Rep   *block,
+                                                       Cache *cache)
+{
+    if (!cache) {
+        // Releasing a buffer must not throw, so should the cache fail to be
+        // created, the block is returned directly to the depot.
+
+        BSLS_TRY {
+            cache = createCache();
+        }
+        BSLS_CATCH(...) {
+            cache = 0;
+        }
+
+        if (!cache) {
+            List list = { 0, 0 };
+            pushBlock(&list, block);
+            pushToDepot(&list);
+            return;                                                   // RETURN
+        }
+    }
+
+    List *loaded = &cache->d_loaded;
+    List *spare  = &cache->d_spare;
+
+    if (loaded->d_numBlocks == d_maxListBlocks) {
+        if (spare->d_head_p) {
+            pushToDepot(spare);
+        }
+        *spare              = *loaded;
+        loaded->d_head_p    = 0;
+        loaded->d_numBlocks = 0;
+    }
+    pushBlock(loaded, block);
+}
+
+void ThreadCachingBlobBufferFactory::initialize()
+{
+    BSLS_ASSERT(0 < d_bufferSize);
+    BSLS_ASSERT(0 <= d_numPreallocated);
+
+    if (0 < d_numPreallocated) {
+        const bsls::Types::size_type size = blockSize(d_bufferSize);
+
+        d_slab_p = d_allocator_p->allocate(size * d_numPreallocated);
+
+        char *address = static_cast<char *>(d_slab_p);
+        List  list    = { 0, 0 };
+
+        for (int i = 0; i < d_numPreallocated; ++i, address += size) {
+            pushBlock(&list, new (address) Rep(this));
+
+            if (list.d_numBlocks == d_maxListBlocks) {
+                pushToDepot(&list);
+            }
+        }
+        if (list.d_head_p) {
+            pushToDepot(&list);
+        }
+
+        d_numBuffers = d_numPreallocated;
+    }
+
+    d_hasKey = 0 == bslmt::ThreadUtil::createKey(
+                                               &d_key,
+                                               &Cache::releaseOnThreadExit);
+}
+
+void ThreadCachingBlobBufferFactory::popFromDepot(List *list)
+{
+    BSLS_ASSERT(0 == list->d_head_p);
+
+    Rep *head;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_depotMutex);
+
+        head = d_depot_p;
+        if (head) {
+            d_depot_p = head->d_nextList_p;
+        }
+    }
+
+    if (head) {
+        list->d_head_p    = head;
+        list->d_numBlocks = head->d_numBlocks;
+    }
+}
+
+void ThreadCachingBlobBufferFactory::pushToDepot(List *list)
+{
+    BSLS_ASSERT(list->d_head_p);
+
+    Rep *head         = list->d_head_p;
+    head->d_numBlocks = list->d_numBlocks;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_depotMutex);
+
+        head->d_nextList_p = d_depot_p;
+        d_depot_p          = head;
+    }
+
+    list->d_head_p    = 0;
+    list->d_numBlocks = 0;
+}
+
+// CREATORS
+ThreadCachingBlobBufferFactory::ThreadCachingBlobBufferFactory(
+                                              int               bufferSize,
+                                              bslma::Allocator *basicAllocator)
+: d_bufferSize(bufferSize)
+, d_maxListBlocks(maxListBlocks(bufferSize))
+, d_pool(blockSize(bufferSize), basicAllocator)
+, d_slab_p(0)
+, d_numPreallocated(0)
+, d_numBuffers(0)
+, d_depot_p(0)
+, d_hasKey(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+ThreadCachingBlobBufferFactory::ThreadCachingBlobBufferFactory(
+                                  int               bufferSize,
+                                  int               numPreallocatedBuffers,
+                                  bslma::Allocator *basicAllocator)
+: d_bufferSize(bufferSize)
+, d_maxListBlocks(maxListBlocks(bufferSize))
+, d_pool(blockSize(bufferSize), basicAllocator)
+, d_slab_p(0)
+, d_numPreallocated(numPreallocatedBuffers)
+, d_numBuffers(0)
+, d_depot_p(0)
+, d_hasKey(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+ThreadCachingBlobBufferFactory::~ThreadCachingBlobBufferFactory()
+{
+    // Deleting the key ensures that the cleanup function will not run for
+    // threads exiting later.  The caches, and all the blocks not in the slab,
+    // are freed when the pool is destroyed.
+
+    if (d_hasKey) {
+        bslmt::ThreadUtil::deleteKey(d_key);
+    }
+
+    if (d_slab_p) {
+        d_allocator_p->deallocate(d_slab_p);
+    }
+}
+
+// MANIPULATORS
+void ThreadCachingBlobBufferFactory::allocate(BlobBuffer *buffer)
+{
+    BSLS_ASSERT(buffer);
+
+    Cache *cache = d_hasKey
+                   ? static_cast<Cache *>(
+                                       bslmt::ThreadUtil::getSpecific(d_key))
+                   : 0;
+
+    Rep *block;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(cache &&
+                                            cache->d_loaded.d_head_p)) {
+        block = popBlock(&cache->d_loaded);
+    }
+    else {
+        block = allocateFromDepot(cache);
+    }
+
+    // Swapping the new handle in, rather than assigning it, spares an
+    // increment and a decrement of the reference count.
+
+    block->resetCountsRaw(1, 0);
+
+    bsl::shared_ptr<char> handle(block->buffer(), block);
+    buffer->buffer().swap(handle);
+    buffer->setSize(d_bufferSize);
+}
+
+void ThreadCachingBlobBufferFactory::flushThreadCache()
+{
+    if (d_hasKey) {
+        Cache *cache = static_cast<Cache *>(
+                                       bslmt::ThreadUtil::getSpecific(d_key));
+        if (cache) {
+            cache->flush();
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,313 @@
+// bdlbb_threadcachingblobbufferfactory.h                             -*-C++-*-
+#ifndef INCLUDED_BDLBB_THREADCACHINGBLOBBUFFERFACTORY
+#define INCLUDED_BDLBB_THREADCACHINGBLOBBUFFERFACTORY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a blob buffer factory with per-thread buffer caches.
+//
+//@CLASSES:
+//  bdlbb::ThreadCachingBlobBufferFactory: factory caching buffers per thread
+//
+//@SEE_ALSO: bdlbb_pooledblobbufferfactory, bdlma_threadcachingallocator
+//
+//@DESCRIPTION: This component provides a thread-safe mechanism,
+// 'bdlbb::ThreadCachingBlobBufferFactory', that implements the
+// 'bdlbb::BlobBufferFactory' protocol and supplies 'bdlbb::BlobBuffer' objects
+// of a fixed size passed at construction.  It is intended for programs, such
+// as network servers, that allocate and release buffers at a high rate from
+// many threads.
+//
+// Like 'bdlbb::PooledBlobBufferFactory', this factory allocates the shared
+// pointer representation of each buffer together with the buffer itself, in
+// a single block.  Unlike it, the representation is a reference-counting
+// header private to this component that, when the last reference to the
+// buffer is released, returns the block to the factory instead of
+// deallocating it.  Released blocks are kept, fully constructed, in a cache
+// private to the releasing thread, and 'allocate' takes blocks from the cache
+// of the calling thread.  Most calls to 'allocate' therefore involve neither
+// a lock nor an atomic operation (other than those on the reference count of
+// the buffer), nor any memory shared with other threads.
+//
+// The cache of a thread holds up to two lists of free blocks.  When both are
+// full, a release moves one of them, in a single operation, to a *depot*
+// shared by all threads; when both are empty, 'allocate' takes a whole list
+// back from the depot, and obtains a new block from an internal
+// 'bdlma::ConcurrentPool' only if the depot, too, is empty.  A list holds up
+// to 32 blocks, and fewer for large buffers, so that a cache holds no more
+// than about 512K bytes.  A buffer released by a thread other than the one
+// that allocated it joins the cache of the releasing thread, so that a
+// program in which one thread allocates and another releases exchanges whole
+// lists of buffers rather than individual buffers.  When a thread exits, its
+// cache is returned to the depot; a thread that stops using the factory for a
+// long time may call 'flushThreadCache' to do the same.
+//
+///Preallocated Buffers
+///--------------------
+// A program whose working set of buffers is known may optionally specify, at
+// construction, a number of buffers to preallocate.  The blocks of those
+// buffers are then allocated as one contiguous slab and placed in the depot,
+// so that no memory is allocated, and no block is constructed, while the
+// working set does not exceed that number.  Should it be exceeded, buffers
+// are allocated as described above.
+//
+// Memory is returned to the underlying allocator only when the factory is
+// destroyed.
+//
+///Thread Safety
+///-------------
+// 'bdlbb::ThreadCachingBlobBufferFactory' is *fully thread-safe*, meaning that
+// any operation can be called on the *same* object from any number of
+// threads, provided that the allocator supplied at construction is fully
+// thread-safe.  Buffers may be released from any thread.  The factory must
+// not be destroyed while a buffer it allocated is still referenced, or while
+// another thread is using it.
+//
+// The cache of each thread is found through a thread-specific storage key
+// (see 'bslmt_threadutil') created by the factory.  Should the platform have
+// no key left to create, the factory works, but without caching.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Receiving Messages into Blobs
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that receiving threads of a server each read messages into blobs,
+// which are released once processed.  A single factory can supply all the
+// buffers, and a buffer released by a thread is reused by the same thread.
+//
+// First, we create a factory of 4K buffers, preallocating the 256 buffers
+// that the server is expected to hold at any time:
+//..
+//  bdlbb::ThreadCachingBlobBufferFactory factory(4096, 256);
+//  assert(4096 == factory.bufferSize());
+//  assert( 256 == factory.numBuffers());
+//..
+// Then, a receiving thread builds a message in a blob whose buffers are
+// supplied by the factory:
+//..
+//  for (int i = 0; i < 1000; ++i) {
+//      bdlbb::Blob message(&factory);
+//      message.setLength(10000);
+//      assert(3 == message.numDataBuffers());
+//  }
+//..
+// Next, we observe that, the blobs having been destroyed, their buffers were
+// reused, and that no buffer was allocated beyond those preallocated:
+//..
+//  assert(256 == factory.numBuffers());
+//..
+// Finally, a thread that is about to sleep for a long time may return its
+// cached buffers so that other threads can use them:
+//..
+//  factory.flushThreadCache();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlbb_blob.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+class ThreadCachingBlobBufferFactory_Rep;
+struct ThreadCachingBlobBufferFactory_Cache;
+struct ThreadCachingBlobBufferFactory_List;
+
+                    // ====================================
+                    // class ThreadCachingBlobBufferFactory
+                    // ====================================
+
+class ThreadCachingBlobBufferFactory : public BlobBufferFactory {
+    // This class implements the 'BlobBufferFactory' protocol to provide a
+    // fully thread-safe factory of buffers of a fixed size, recycling the
+    // buffers released by each thread through a cache private to that
+    // thread.
+
+    // DATA
+    int                                 d_bufferSize;     // size of buffers
+
+    int                                 d_maxListBlocks;  // blocks in a full
+                                                          // list of a cache
+
+    bdlma::ConcurrentPool               d_pool;           // blocks beyond the
+                                                          // preallocated ones,
+                                                          // and caches
+
+    void                               *d_slab_p;         // preallocated
+                                                          // blocks, or 0
+
+    int                                 d_numPreallocated;
+                                                          // blocks in slab
+
+    bsls::AtomicInt                     d_numBuffers;     // blocks created
+
+    bslmt::Mutex                        d_depotMutex;     // protects
+                                                          // 'd_depot_p'
+
+    ThreadCachingBlobBufferFactory_Rep *d_depot_p;        // first block of
+                                                          // first list in the
+                                                          // depot
+
+    bslmt::ThreadUtil::Key              d_key;            // key of the cache
+                                                          // of each thread
+
+    bool                                d_hasKey;         // 'true' if 'd_key'
+                                                          // was created
+
+    bslma::Allocator                   *d_allocator_p;    // memory allocator
+                                                          // (held, not owned)
+
+    // FRIENDS
+    friend class ThreadCachingBlobBufferFactory_Rep;
+    friend struct ThreadCachingBlobBufferFactory_Cache;
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingBlobBufferFactory(const ThreadCachingBlobBufferFactory&);
+    ThreadCachingBlobBufferFactory& operator=(
+                                        const ThreadCachingBlobBufferFactory&);
+
+    // PRIVATE MANIPULATORS
+    ThreadCachingBlobBufferFactory_Rep *allocateFromDepot(
+                                 ThreadCachingBlobBufferFactory_Cache *cache);
+        // Return a block taken from the specified 'cache' after refilling it
+        // from the depot, or from the depot or the pool if 'cache' is 0.
+        // Create the cache of the calling thread if 'cache' is 0 and it can be
+        // created.
+
+    ThreadCachingBlobBufferFactory_Cache *createCache();
+        // Create the cache of the calling thread and return its address, or
+        // return 0 if the cache could not be registered.
+
+    void deallocate(ThreadCachingBlobBufferFactory_Rep *block);
+        // Return the specified 'block', whose buffer is no longer referenced,
+        // to the cache of the calling thread.
+
+    void deallocateToDepot(ThreadCachingBlobBufferFactory_Rep   *block,
+                           ThreadCachingBlobBufferFactory_Cache *cache);
+        // Return the specified 'block' to the specified 'cache' after moving
+        // a full list of 'cache' to the depot, or to the depot if 'cache' is 0
+        // and the cache of the calling thread cannot be created.
+
+    void initialize();
+        // Create the preallocated blocks and the thread-specific key of this
+        // factory.
+
+    void popFromDepot(ThreadCachingBlobBufferFactory_List *list);
+        // Move a list of blocks from the depot to the specified 'list', if
+        // the depot is not empty.  The behavior is undefined unless 'list' is
+        // empty.
+
+    void pushToDepot(ThreadCachingBlobBufferFactory_List *list);
+        // Move the blocks of the specified 'list' to the depot, leaving 'list'
+        // empty.  The behavior is undefined unless 'list' is not empty.
+
+  public:
+    // CREATORS
+    explicit
+    ThreadCachingBlobBufferFactory(int               bufferSize,
+                                   bslma::Allocator *basicAllocator = 0);
+    ThreadCachingBlobBufferFactory(int               bufferSize,
+                                   int               numPreallocatedBuffers,
+                                   bslma::Allocator *basicAllocator = 0);
+        // Create a factory of 'BlobBuffer' objects of the specified
+        // 'bufferSize'.  Optionally specify 'numPreallocatedBuffers', the
+        // number of buffers whose memory is allocated, as one slab, at
+        // construction.  If 'numPreallocatedBuffers' is not specified, no
+        // buffer is preallocated.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '0 < bufferSize', '0 <= numPreallocatedBuffers', and
+        // 'basicAllocator' is fully thread-safe.
+
+    virtual ~ThreadCachingBlobBufferFactory();
+        // Destroy this factory, releasing all memory allocated through it,
+        // including that of the buffers held in the caches of threads still
+        // running.  The behavior is undefined if a buffer allocated by this
+        // factory is still referenced, or if another thread is using this
+        // factory.
+
+    // MANIPULATORS
+    virtual void allocate(BlobBuffer *buffer);
+        // Allocate a new buffer with the buffer size specified at construction
+        // and load it into the specified 'buffer'.
+
+    void flushThreadCache();
+        // Return the buffers held in the cache of the calling thread to the
+        // shared depot, from which any thread may reuse them.  Note that this
+        // is done automatically when a thread exits.
+
+    // ACCESSORS
+    int bufferSize() const;
+        // Return the buffer size specified at construction of this factory.
+
+    int numBuffers() const;
+        // Return the number of buffers whose memory this factory has
+        // allocated, including the preallocated buffers, whether they are
+        // currently in use or cached.
+
+    int numPreallocatedBuffers() const;
+        // Return the number of buffers preallocated at construction of this
+        // factory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                    // ------------------------------------
+                    // class ThreadCachingBlobBufferFactory
+                    // ------------------------------------
+
+// ACCESSORS
+inline
+int ThreadCachingBlobBufferFactory::bufferSize() const
+{
+    return d_bufferSize;
+}
+
+inline
+int ThreadCachingBlobBufferFactory::numBuffers() const
+{
+    return d_numBuffers.loadRelaxed();
+}
+
+inline
+int ThreadCachingBlobBufferFactory::numPreallocatedBuffers() const
+{
+    return d_numPreallocated;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
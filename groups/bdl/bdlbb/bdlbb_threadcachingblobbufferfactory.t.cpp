@@ -0,0 +1,905 @@
+// bdlbb_threadcachingblobbufferfactory.t.cpp                        -*-C++-*-
+#include <bdlbb_threadcachingblobbufferfactory.h>
+
+#include <bdlbb_blob.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlbb::ThreadCachingBlobBufferFactory' supplies buffers whose blocks are
+// recycled through a per-thread cache when the buffers are no longer
+// referenced.  The concerns are that every buffer supplied has the requested
+// size, is maximally aligned, and is distinct from every other buffer in use;
+// that a block is recycled only once no shared or weak reference to its
+// buffer remains; that buffers released by a thread are reused by that thread
+// without obtaining more memory; that buffers cached by a thread reach other
+// threads when it exits or flushes its cache; that preallocated buffers are
+// used before any other; and that all memory is returned to the underlying
+// allocator on destruction.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingBlobBufferFactory(int bufferSize, Allocator *ba = 0);
+// [ 2] ThreadCachingBlobBufferFactory(int, int numPreallocated, *ba = 0);
+// [ 2] ~ThreadCachingBlobBufferFactory();
+//
+// MANIPULATORS
+// [ 3] void allocate(BlobBuffer *buffer);
+// [ 4] void flushThreadCache();
+//
+// ACCESSORS
+// [ 2] int bufferSize() const;
+// [ 3] int numBuffers() const;
+// [ 2] int numPreallocatedBuffers() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: Buffers released by one thread are reused by other threads.
+// [ 5] CONCERN: The factory is thread-safe.
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::ThreadCachingBlobBufferFactory Obj;
+
+static const int k_MAX_ALIGNMENT = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                         HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address)
+                                                        % k_MAX_ALIGNMENT;
+}
+
+void fill(const bdlbb::BlobBuffer& buffer, unsigned char seed)
+    // Write a pattern derived from the specified 'seed' to the specified
+    // 'buffer'.
+{
+    for (int i = 0; i < buffer.size(); ++i) {
+        buffer.data()[i] = static_cast<char>(seed + i);
+    }
+}
+
+bool check(const bdlbb::BlobBuffer& buffer, unsigned char seed)
+    // Return 'true' if the specified 'buffer' holds the pattern written by
+    // 'fill' for the specified 'seed', and 'false' otherwise.
+{
+    for (int i = 0; i < buffer.size(); ++i) {
+        if (buffer.data()[i] != static_cast<char>(seed + i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                            // ====================
+                            // struct ThreadBuffers
+                            // ====================
+
+struct ThreadBuffers {
+    // This 'struct' describes the work of a thread allocating or releasing a
+    // set of buffers.
+
+    Obj                             *d_factory_p;  // factory under test
+    bsl::vector<bdlbb::BlobBuffer>  *d_buffers_p;  // buffers to allocate or
+                                                   // release
+    bool                             d_flush;      // 'true' if the thread
+                                                   // flushes its cache rather
+                                                   // than exit to do so
+};
+
+extern "C" void *allocateBuffers(void *arg)
+    // Allocate a buffer into each element of the vector of the specified
+    // 'arg' (the address of a 'ThreadBuffers').
+{
+    ThreadBuffers *work = static_cast<ThreadBuffers *>(arg);
+
+    for (bsl::size_t i = 0; i < work->d_buffers_p->size(); ++i) {
+        work->d_factory_p->allocate(&(*work->d_buffers_p)[i]);
+    }
+    return 0;
+}
+
+extern "C" void *releaseBuffers(void *arg)
+    // Release each buffer of the vector of the specified 'arg' (the address
+    // of a 'ThreadBuffers'), and then flush the cache of the thread if so
+    // described.
+{
+    ThreadBuffers *work = static_cast<ThreadBuffers *>(arg);
+
+    for (bsl::size_t i = 0; i < work->d_buffers_p->size(); ++i) {
+        (*work->d_buffers_p)[i].reset();
+    }
+    if (work->d_flush) {
+        work->d_factory_p->flushThreadCache();
+    }
+    return 0;
+}
+
+                            // =================
+                            // struct StressTest
+                            // =================
+
+enum { k_STRESS_SLOTS = 64 };
+
+struct StressTest {
+    // This 'struct' describes the shared state of the threads of the stress
+    // test: a table of slots, each owned by one thread at a time, through
+    // which buffers pass between threads.
+
+    Obj               *d_factory_p;                     // factory under test
+    bslmt::Barrier    *d_barrier_p;                     // starts the threads
+    int                d_numIterations;                 // per thread
+    int                d_numThreads;                    // number of threads
+    bdlbb::BlobBuffer  d_buffers[k_STRESS_SLOTS * 8];   // buffers in flight
+    bsls::AtomicInt    d_errors;                        // corrupted buffers
+                                                        // found
+    bsls::AtomicInt    d_index;                         // next thread index
+};
+
+extern "C" void *stress(void *arg)
+    // Repeatedly release and allocate buffers in slots of the table of the
+    // specified 'arg' (the address of a 'StressTest'), checking the contents
+    // of each buffer released.  Each thread starts on its own slots and then
+    // moves to those of the next thread, so that buffers are released by
+    // threads other than the one that allocated them.  Some buffers are
+    // released while a weak reference to them is held.
+{
+    StressTest *test  = static_cast<StressTest *>(arg);
+    const int   index = test->d_index++;
+
+    test->d_barrier_p->wait();
+
+    unsigned int seed   = 12345u * (index + 1);
+    int          errors = 0;
+
+    for (int round = 0; round < test->d_numThreads; ++round) {
+        const int base = ((index + round) % test->d_numThreads)
+                                                             * k_STRESS_SLOTS;
+
+        for (int i = 0; i < test->d_numIterations; ++i) {
+            seed = seed * 1103515245u + 12345u;
+
+            const int slot = base + static_cast<int>((seed >> 16)
+                                                             % k_STRESS_SLOTS);
+
+            bdlbb::BlobBuffer& buffer = test->d_buffers[slot];
+            if (buffer.data()) {
+                if (!check(buffer, static_cast<unsigned char>(slot))) {
+                    ++errors;
+                }
+            }
+
+            if (0 == (seed >> 8) % 16) {
+                bsl::weak_ptr<char> observer(buffer.buffer());
+                buffer.reset();
+                test->d_factory_p->allocate(&buffer);
+            }
+            else {
+                test->d_factory_p->allocate(&buffer);
+            }
+            fill(buffer, static_cast<unsigned char>(slot));
+        }
+
+        test->d_barrier_p->wait();
+    }
+
+    test->d_errors += errors;
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Receiving Messages into Blobs
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that receiving threads of a server each read messages into blobs,
+// which are released once processed.  A single factory can supply all the
+// buffers, and a buffer released by a thread is reused by the same thread.
+//
+// First, we create a factory of 4K buffers, preallocating the 256 buffers
+// that the server is expected to hold at any time:
+//..
+    bdlbb::ThreadCachingBlobBufferFactory factory(4096, 256);
+    ASSERT(4096 == factory.bufferSize());
+    ASSERT( 256 == factory.numBuffers());
+//..
+// Then, a receiving thread builds a message in a blob whose buffers are
+// supplied by the factory:
+//..
+    for (int i = 0; i < 1000; ++i) {
+        bdlbb::Blob message(&factory);
+        message.setLength(10000);
+        ASSERT(3 == message.numDataBuffers());
+    }
+//..
+// Next, we observe that, the blobs having been destroyed, their buffers were
+// reused, and that no buffer was allocated beyond those preallocated:
+//..
+    ASSERT(256 == factory.numBuffers());
+//..
+// Finally, a thread that is about to sleep for a long time may return its
+// cached buffers so that other threads can use them:
+//..
+    factory.flushThreadCache();
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'allocate', and releases of buffers, never
+        //:   supply a buffer that is in use, whether buffers are released by
+        //:   the thread that allocated them or by another, and whether or not
+        //:   weak references to them remain.
+        //:
+        //: 2 All memory is returned to the underlying allocator when the
+        //:   factory is destroyed, whether the threads have exited or not.
+        //
+        // Plan:
+        //: 1 Let several threads repeatedly replace buffers held in a shared
+        //:   table, filling each buffer with a pattern and checking the
+        //:   pattern before replacing it.  After each round, each thread
+        //:   moves to the slots filled by another thread.  (C-1)
+        //:
+        //: 2 Release the remaining buffers from the main thread, destroy the
+        //:   factory, and verify that no memory remains in use.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: The factory is thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        const int NUM_THREADS[] = { 2, 4, 8 };
+        const int NUM_CONFIGS   = static_cast<int>(sizeof NUM_THREADS
+                                                   / sizeof *NUM_THREADS);
+
+        for (int ti = 0; ti < NUM_CONFIGS; ++ti) {
+            for (int pi = 0; pi < 2; ++pi) {
+                const int THREADS      = NUM_THREADS[ti];
+                const int PREALLOCATED = pi ? THREADS * k_STRESS_SLOTS : 0;
+
+                if (veryVerbose) { T_ P_(THREADS) P(PREALLOCATED) }
+
+                bslma::TestAllocator ta("object", veryVeryVerbose);
+                {
+                    Obj            mX(100, PREALLOCATED, &ta);
+                    bslmt::Barrier barrier(THREADS);
+
+                    StressTest test;
+                    test.d_factory_p     = &mX;
+                    test.d_barrier_p     = &barrier;
+                    test.d_numIterations = 20000;
+                    test.d_numThreads    = THREADS;
+
+                    bslmt::ThreadUtil::Handle handles[8];
+                    for (int i = 0; i < THREADS; ++i) {
+                        ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                              stress,
+                                                              &test));
+                    }
+                    for (int i = 0; i < THREADS; ++i) {
+                        ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                    }
+                    ASSERTV(THREADS, test.d_errors, 0 == test.d_errors);
+
+                    for (int i = 0; i < THREADS * k_STRESS_SLOTS; ++i) {
+                        ASSERTV(i, check(test.d_buffers[i],
+                                         static_cast<unsigned char>(i)));
+                        test.d_buffers[i].reset();
+                    }
+                }
+                ASSERTV(THREADS, PREALLOCATED, 0 == ta.numBlocksInUse());
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SHARING BUFFERS BETWEEN THREADS
+        //
+        // Concerns:
+        //: 1 The buffers cached by a thread are returned to the depot when
+        //:   the thread exits, and are then reused by other threads.
+        //:
+        //: 2 'flushThreadCache' returns the buffers cached by the calling
+        //:   thread to the depot.
+        //:
+        //: 3 Buffers released by a thread other than the one that allocated
+        //:   them are reused.
+        //:
+        //: 4 The caches of threads that are still running when the factory is
+        //:   destroyed are released.
+        //
+        // Plan:
+        //: 1 Allocate buffers in the main thread, release them in another
+        //:   thread that then exits, and allocate the same number of buffers
+        //:   again in the main thread; verify that no buffer was created.
+        //:   (C-1, 3)
+        //:
+        //: 2 Repeat P-1, letting the releasing thread flush its cache
+        //:   instead.  (C-2)
+        //:
+        //: 3 Release buffers in the main thread, flush, and allocate them
+        //:   again in another thread.  (C-2)
+        //:
+        //: 4 Destroy a factory while the main thread holds buffers in its
+        //:   cache, and verify that no memory remains in use.  (C-4)
+        //
+        // Testing:
+        //   void flushThreadCache();
+        //   CONCERN: Buffers released by one thread are reused by other
+        //            threads.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SHARING BUFFERS BETWEEN THREADS" << endl
+                          << "===============================" << endl;
+
+        const int NUM_BUFFERS = 500;
+        const int SIZES[]     = { 1, 100, 4096, 65536 };
+        const int NUM_SIZES   = static_cast<int>(sizeof SIZES
+                                                 / sizeof *SIZES);
+
+        if (verbose) cout << "\tReleasing in another thread." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            for (int flush = 0; flush < 2; ++flush) {
+                const int SIZE = SIZES[ti];
+
+                bslma::TestAllocator ta("object", veryVeryVerbose);
+                {
+                    Obj mX(SIZE, &ta);
+
+                    bsl::vector<bdlbb::BlobBuffer> buffers(NUM_BUFFERS, &ta);
+                    ThreadBuffers work = { &mX, &buffers, !!flush };
+
+                    allocateBuffers(&work);
+                    ASSERTV(SIZE, flush, NUM_BUFFERS == mX.numBuffers());
+
+                    bslmt::ThreadUtil::Handle handle;
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                          releaseBuffers,
+                                                          &work));
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                    allocateBuffers(&work);
+                    ASSERTV(SIZE, flush, mX.numBuffers(),
+                            NUM_BUFFERS == mX.numBuffers());
+
+                    releaseBuffers(&work);
+                }
+                ASSERTV(SIZE, flush, 0 == ta.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\tAllocating in another thread." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(SIZE, &ta);
+
+                bsl::vector<bdlbb::BlobBuffer> buffers(NUM_BUFFERS, &ta);
+                ThreadBuffers work = { &mX, &buffers, true };
+
+                allocateBuffers(&work);
+                releaseBuffers(&work);
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      allocateBuffers,
+                                                      &work));
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                ASSERTV(SIZE, mX.numBuffers(),
+                        NUM_BUFFERS == mX.numBuffers());
+
+                releaseBuffers(&work);
+            }
+            ASSERTV(SIZE, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tDestroying with a live cache." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(64, &ta);
+
+                bsl::vector<bdlbb::BlobBuffer> buffers(NUM_BUFFERS, &ta);
+                ThreadBuffers work = { &mX, &buffers, false };
+
+                allocateBuffers(&work);
+                releaseBuffers(&work);
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE
+        //
+        // Concerns:
+        //: 1 'allocate' loads a buffer of the size specified at construction,
+        //:   maximally aligned, and distinct from every other buffer in use.
+        //:
+        //: 2 'allocate' replaces, and releases, the buffer previously held by
+        //:   the 'BlobBuffer'.
+        //:
+        //: 3 The block of a buffer is reused once no shared reference to the
+        //:   buffer remains, and no weak reference either.
+        //:
+        //: 4 Buffers released by a thread are reused by that thread without
+        //:   creating more buffers.
+        //:
+        //: 5 Blobs can use the factory.
+        //
+        // Plan:
+        //: 1 Allocate many buffers of various sizes, fill each with a
+        //:   distinct pattern, and verify their sizes, alignment, and
+        //:   patterns.  (C-1)
+        //:
+        //: 2 Release the buffers, allocate them again, and verify that
+        //:   'numBuffers' is unchanged.  (C-4)
+        //:
+        //: 3 Allocate into a 'BlobBuffer' already holding a buffer, and
+        //:   verify that the old buffer is recycled.  (C-2)
+        //:
+        //: 4 Hold a copy, and then a weak reference, of a buffer while
+        //:   releasing it, and verify that its block is reused only after
+        //:   they are released.  (C-3)
+        //:
+        //: 5 Grow and shrink a blob using the factory.  (C-5)
+        //
+        // Testing:
+        //   void allocate(BlobBuffer *buffer);
+        //   int numBuffers() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE" << endl
+                          << "========" << endl;
+
+        const int SIZES[]   = { 1, 7, 16, 100, 1000, 4096, 65536 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        if (verbose) cout << "\tDistinct buffers and reuse." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE        = SIZES[ti];
+            const int NUM_BUFFERS = 200;
+
+            if (veryVerbose) { T_ P(SIZE) }
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(SIZE, &ta);  const Obj& X = mX;
+
+                bsl::vector<bdlbb::BlobBuffer> buffers(NUM_BUFFERS, &ta);
+
+                for (int round = 0; round < 3; ++round) {
+                    for (int i = 0; i < NUM_BUFFERS; ++i) {
+                        mX.allocate(&buffers[i]);
+
+                        ASSERTV(SIZE, i, SIZE == buffers[i].size());
+                        ASSERTV(SIZE, i,
+                                isMaximallyAligned(buffers[i].data()));
+                        ASSERTV(SIZE, i, buffers[i].buffer().unique());
+
+                        fill(buffers[i], static_cast<unsigned char>(i));
+                    }
+                    for (int i = 0; i < NUM_BUFFERS; ++i) {
+                        ASSERTV(SIZE, i,
+                                check(buffers[i],
+                                      static_cast<unsigned char>(i)));
+                    }
+                    ASSERTV(SIZE, round, X.numBuffers(),
+                            NUM_BUFFERS == X.numBuffers());
+
+                    for (int i = 0; i < NUM_BUFFERS; ++i) {
+                        buffers[i].reset();
+                    }
+                }
+                ASSERT(0 == defaultAllocator.numBlocksTotal());
+            }
+            ASSERTV(SIZE, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tReplacing a buffer." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+
+            Obj mX(100, &ta);  const Obj& X = mX;
+
+            bdlbb::BlobBuffer buffer;
+            mX.allocate(&buffer);
+            const char *FIRST = buffer.data();
+
+            mX.allocate(&buffer);
+            const char *SECOND = buffer.data();
+            ASSERT(FIRST != SECOND);
+            ASSERT(2     == X.numBuffers());
+
+            mX.allocate(&buffer);
+            ASSERT(FIRST == buffer.data());
+            ASSERT(2     == X.numBuffers());
+        }
+
+        if (verbose) cout << "\tShared and weak references." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+
+            Obj mX(100, &ta);  const Obj& X = mX;
+
+            bdlbb::BlobBuffer buffer;
+            mX.allocate(&buffer);
+            const char *FIRST = buffer.data();
+            fill(buffer, 7);
+
+            bdlbb::BlobBuffer copy(buffer);
+            buffer.reset();
+
+            mX.allocate(&buffer);
+            ASSERT(FIRST != buffer.data());
+            ASSERT(2     == X.numBuffers());
+            ASSERT(check(copy, 7));
+            buffer.reset();
+
+            bsl::weak_ptr<char> observer(copy.buffer());
+            copy.reset();
+            ASSERT(observer.expired());
+
+            bdlbb::BlobBuffer other;
+            mX.allocate(&other);
+            ASSERT(FIRST != other.data());
+            ASSERT(2     == X.numBuffers());
+
+            observer.reset();
+
+            mX.allocate(&buffer);
+            ASSERT(FIRST == buffer.data());
+            ASSERT(2     == X.numBuffers());
+            ASSERT(1     == buffer.buffer().use_count());
+        }
+
+        if (verbose) cout << "\tUsing the factory in a blob." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(64, 16, &ta);  const Obj& X = mX;
+
+                for (int i = 0; i < 100; ++i) {
+                    bdlbb::Blob blob(&mX, &ta);
+
+                    blob.setLength(1000);
+                    ASSERTV(i, 16 == blob.numDataBuffers());
+                    ASSERTV(i, X.numBuffers(),
+                            (0 == i ? 16 : 32) == X.numBuffers());
+
+                    blob.setLength(100);
+                    blob.trimLastDataBuffer();
+                    blob.removeUnusedBuffers();
+                    ASSERTV(i, 2 == blob.numBuffers());
+
+                    blob.setLength(2000);
+                    ASSERTV(i, 32 == blob.numDataBuffers());
+                    ASSERTV(i, 32 == X.numBuffers());
+                }
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The factory supplies buffers of the size specified at
+        //:   construction.
+        //:
+        //: 2 Memory is obtained from the supplied allocator, or from the
+        //:   default allocator if none is supplied.
+        //:
+        //: 3 The preallocated buffers are allocated at construction, and are
+        //:   used before any other buffer is created.
+        //:
+        //: 4 All memory is released on destruction.
+        //
+        // Plan:
+        //: 1 Create factories with and without an allocator, and with and
+        //:   without preallocated buffers, verify the accessors and the
+        //:   memory allocated, allocate buffers, and destroy the factories.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   ThreadCachingBlobBufferFactory(int bufferSize, Allocator *ba = 0);
+        //   ThreadCachingBlobBufferFactory(int, int numPreallocated, *ba = 0);
+        //   ~ThreadCachingBlobBufferFactory();
+        //   int bufferSize() const;
+        //   int numPreallocatedBuffers() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        const int SIZES[]   = { 1, 100, 4096 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        const int PREALLOCATED[]   = { 0, 1, 31, 32, 33, 100 };
+        const int NUM_PREALLOCATED = static_cast<int>(sizeof PREALLOCATED
+                                                      / sizeof *PREALLOCATED);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            for (int pi = 0; pi < NUM_PREALLOCATED; ++pi) {
+                for (char cfg = 'a'; cfg <= 'c'; ++cfg) {
+                    const int SIZE = SIZES[ti];
+                    const int NUM  = PREALLOCATED[pi];
+                    const int CFG  = cfg;
+
+                    if (veryVerbose) { T_ P_(SIZE) P_(NUM) P(cfg) }
+
+                    bslma::TestAllocator fa("footprint", veryVeryVerbose);
+                    bslma::TestAllocator sa("supplied",  veryVeryVerbose);
+                    bslma::TestAllocator da("default",   veryVeryVerbose);
+
+                    bslma::DefaultAllocatorGuard dag(&da);
+
+                    bslma::TestAllocator& oa = 'b' == cfg ? sa : da;
+
+                    Obj *objPtr = 0;
+                    switch (cfg) {
+                      case 'a': {
+                        objPtr = 0 == NUM
+                               ? new (fa) Obj(SIZE)
+                               : new (fa) Obj(SIZE, NUM);
+                      } break;
+                      case 'b': {
+                        objPtr = 0 == NUM
+                               ? new (fa) Obj(SIZE, &sa)
+                               : new (fa) Obj(SIZE, NUM, &sa);
+                      } break;
+                      case 'c': {
+                        objPtr = new (fa) Obj(SIZE, NUM, 0);
+                      } break;
+                    }
+                    Obj& mX = *objPtr;  const Obj& X = mX;
+
+                    ASSERTV(CFG, SIZE == X.bufferSize());
+                    ASSERTV(CFG, NUM  == X.numPreallocatedBuffers());
+                    ASSERTV(CFG, NUM  == X.numBuffers());
+
+                    if (NUM) {
+                        ASSERTV(CFG, 1 == oa.numBlocksInUse());
+                        ASSERTV(CFG, oa.numBytesInUse() >= NUM * SIZE);
+                    }
+                    else {
+                        ASSERTV(CFG, 0 == oa.numBlocksInUse());
+                    }
+
+                    {
+                        bsl::vector<bdlbb::BlobBuffer> buffers(NUM + 1, &fa);
+
+                        for (int i = 0; i < NUM; ++i) {
+                            mX.allocate(&buffers[i]);
+                            ASSERTV(CFG, i, SIZE == buffers[i].size());
+                        }
+                        ASSERTV(CFG, NUM == X.numBuffers());
+
+                        mX.allocate(&buffers[NUM]);
+                        ASSERTV(CFG, NUM + 1 == X.numBuffers());
+                    }
+
+                    ASSERTV(CFG, &oa != &sa || 0 == da.numBlocksTotal());
+
+                    fa.deleteObject(objPtr);
+
+                    ASSERTV(CFG, 0 == fa.numBlocksInUse());
+                    ASSERTV(CFG, 0 == sa.numBlocksInUse());
+                    ASSERTV(CFG, 0 == da.numBlocksInUse());
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate, release, and reallocate a few buffers.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(1024, &ta);  const Obj& X = mX;
+
+            ASSERT(1024 == X.bufferSize());
+            ASSERT(   0 == X.numBuffers());
+
+            bdlbb::BlobBuffer a, b;
+            mX.allocate(&a);
+            mX.allocate(&b);
+
+            ASSERT(1024 == a.size());
+            ASSERT(1024 == b.size());
+            ASSERT(a.data() != b.data());
+            ASSERT(2 == X.numBuffers());
+
+            bsl::memset(a.data(), 'a', a.size());
+            bsl::memset(b.data(), 'b', b.size());
+
+            const char *A = a.data();
+            a.reset();
+
+            bdlbb::BlobBuffer c;
+            mX.allocate(&c);
+            ASSERT(A == c.data());
+            ASSERT(2 == X.numBuffers());
+            ASSERT('b' == b.data()[1023]);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
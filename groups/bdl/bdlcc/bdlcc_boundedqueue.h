@@ -28,6 +28,14 @@ BSLS_IDENT("$Id: $")
 // value, if the queue is full.  The 'tryPopFront' method fails immediately,
 // returning a non-zero value, if the queue is empty.
 //
+// Batch variants of these methods are provided for transferring many elements
+// per call: 'pushBack' and 'tryPushBack' accept a range of elements, and
+// 'popFront' and 'tryPopFront' accept a maximum number of elements and a
+// 'bsl::vector' to which the removed elements are appended.  A batch operation
+// claims a contiguous run of elements with a single update of the queue's
+// indices, and wakes blocked threads with a single 'post', rather than paying
+// those costs once per element.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  Any threads blocked in 'pushBack'
@@ -198,7 +206,11 @@ BSLS_IDENT("$Id: $")
 #include <bsls_objectbuffer.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
 #include <bsl_cstdint.h>
+#include <bsl_iterator.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlcc {
@@ -272,6 +284,102 @@ class BoundedQueue_PushExceptionCompleteProctor {
         // If no queue is currently managed, this method has no effect.
 };
 
+                  // ========================================
+                  // class BoundedQueue_PopBatchCompleteGuard
+                  // ========================================
+
+template <class TYPE>
+class BoundedQueue_PopBatchCompleteGuard {
+    // This class implements a guard that invokes 'TYPE::popBatchComplete' on
+    // a contiguous run of nodes upon destruction, and, unless released, also
+    // invokes 'TYPE::popBatchDiscard' for the elements of the batch "pop"
+    // operation that are not yet claimed.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    TYPE   *d_queue_p;       // managed queue owning the managed nodes
+    Uint64  d_index;         // index of the first managed node
+    Uint64  d_length;        // number of managed nodes
+    Uint64  d_numUnclaimed;  // number of elements of the batch not yet
+                             // claimed
+    bool    d_isLastRun;     // if true, the managed nodes are the last run of
+                             // the batch
+    bool    d_isEmpty;       // if true, the empty condition will be signalled
+                             // once the last run of the batch is complete
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PopBatchCompleteGuard();
+    BoundedQueue_PopBatchCompleteGuard(
+                                    const BoundedQueue_PopBatchCompleteGuard&);
+    BoundedQueue_PopBatchCompleteGuard& operator=(
+                                    const BoundedQueue_PopBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PopBatchCompleteGuard(TYPE   *queue,
+                                       Uint64  index,
+                                       Uint64  length,
+                                       Uint64  numUnclaimed,
+                                       bool    isEmpty);
+        // Create a 'popBatchComplete' guard managing the specified 'queue',
+        // the specified 'length' nodes starting at the specified 'index', and
+        // the specified 'numUnclaimed' elements of the batch that remain to be
+        // claimed, that will cause the empty condition to be signalled, once
+        // the batch is complete, if the specified 'isEmpty' is 'true'.
+
+    ~BoundedQueue_PopBatchCompleteGuard();
+        // Destroy this object, invoke the 'TYPE::popBatchComplete' method
+        // with the managed nodes, and, if any elements of the batch remain
+        // unclaimed (i.e., 'releaseUnclaimed' was not called), invoke the
+        // 'TYPE::popBatchDiscard' method for those elements.
+
+    // MANIPULATORS
+    void releaseUnclaimed();
+        // Release from management the elements of the batch that remain to be
+        // claimed.
+};
+
+                  // =========================================
+                  // class BoundedQueue_PushBatchCompleteGuard
+                  // =========================================
+
+template <class TYPE>
+class BoundedQueue_PushBatchCompleteGuard {
+    // This class implements a guard that invokes 'TYPE::pushBatchComplete'
+    // upon destruction, supplying the number of nodes reserved for a batch
+    // "push" operation and the number of those nodes that were successfully
+    // populated.
+
+    // DATA
+    TYPE        *d_queue_p;      // managed queue
+    bsl::size_t  d_numReserved;  // number of nodes reserved
+    bsl::size_t  d_numPushed;    // number of nodes populated
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PushBatchCompleteGuard();
+    BoundedQueue_PushBatchCompleteGuard(
+                                   const BoundedQueue_PushBatchCompleteGuard&);
+    BoundedQueue_PushBatchCompleteGuard& operator=(
+                                   const BoundedQueue_PushBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PushBatchCompleteGuard(TYPE *queue, bsl::size_t numReserved);
+        // Create a 'pushBatchComplete' guard managing the specified 'queue'
+        // for a batch "push" operation that reserved the specified
+        // 'numReserved' nodes.
+
+    ~BoundedQueue_PushBatchCompleteGuard();
+        // Destroy this object and invoke the managed queue's
+        // 'pushBatchComplete' method.
+
+    // MANIPULATORS
+    void incrementNumPushed();
+        // Increment the number of nodes that were successfully populated.
+};
+
                          // ========================
                          // struct BoundedQueue_Node
                          // ========================
@@ -404,6 +512,10 @@ class BoundedQueue {
     friend class BoundedQueue_PushExceptionCompleteProctor<
                                                           BoundedQueue<TYPE> >;
 
+    friend class BoundedQueue_PopBatchCompleteGuard<BoundedQueue<TYPE> >;
+
+    friend class BoundedQueue_PushBatchCompleteGuard<BoundedQueue<TYPE> >;
+
     // PRIVATE CLASS METHODS
     static bool isQuiescentState(bsls::Types::Uint64 count);
         // Return 'true' if the specified 'count' implies a quiescent state
@@ -417,11 +529,56 @@ class BoundedQueue {
         // by a guard to complete the reclamation of a node in the presence of
         // an exception.
 
+    void popBatchComplete(Uint64 index, Uint64 length, bool isEmpty);
+        // Destruct the values stored in the nodes of the specified 'length'
+        // run of nodes starting at the specified 'index' that are not marked
+        // for reclamation, mark the nodes writable, and if the specified
+        // 'isEmpty' is 'true' then signal the queue empty condition.  This
+        // method is used within 'popFrontBatchHelper' by a guard to complete
+        // the reclamation of the nodes in the presence of an exception.
+
+    Uint64 popBatchClaim(Uint64 length, Uint64 *index);
+        // Claim the run of the specified 'length' nodes at the front of this
+        // queue, load the index of the first node of the run into the
+        // specified 'index', and return the number of nodes in the run that
+        // are marked for reclamation (i.e., do not hold an element).
+
+    void popBatchDiscard(Uint64 numItems, bool isEmpty);
+        // Claim the specified 'numItems' elements at the front of this queue,
+        // destroy them, and mark their nodes writable, and if the specified
+        // 'isEmpty' is 'true' then signal the queue empty condition.  This
+        // method is used within 'popFrontBatchHelper' by a guard to complete
+        // a batch "pop" operation, whose elements are counted as started in
+        // 'd_popCount', in the presence of an exception.
+
+    void popFrontBatchHelper(bsl::size_t numItems, bsl::vector<TYPE> *buffer);
+        // Remove the specified 'numItems' elements from the front of this
+        // queue and append them, in order, to the specified 'buffer'.  This
+        // method is invoked by the batch 'popFront' and 'tryPopFront' methods
+        // once 'numItems' elements are available.  The behavior is undefined
+        // unless 'buffer' has the capacity for 'numItems' more elements, so
+        // that no allocation is needed once the elements are claimed.
+
     void popFrontHelper(TYPE *value);
         // Remove the element from the front of this queue and load that
         // element into the specified 'value'.  This method is invoked by
         // 'popFront' and 'tryPopFront' once an element is available.
 
+    void pushBatchComplete(bsl::size_t numPushed, bsl::size_t numReserved);
+        // Mark a batch "push" operation, having reserved the specified
+        // 'numReserved' nodes of which the specified 'numPushed' were
+        // populated, as complete, and 'post' to the 'd_popSemaphore' if
+        // appropriate.  The behavior is undefined unless
+        // 'numPushed <= numReserved'.
+
+    template <class FORWARD_ITER>
+    FORWARD_ITER pushBackBatchHelper(FORWARD_ITER begin, bsl::size_t numItems);
+        // Append the specified 'numItems' elements of the range starting at
+        // the specified 'begin' to the back of this queue, and return an
+        // iterator referring to the element following the last one appended.
+        // This method is invoked by the range 'pushBack' and 'tryPushBack'
+        // methods once space for 'numItems' elements is available.
+
     void pushComplete();
         // Mark a "push" operation as complete, and 'post' to the
         // 'd_popSemaphore' if appropriate.
@@ -492,6 +649,39 @@ class BoundedQueue {
         // due to the queue being full will return 'e_DISABLED' if
         // 'disablePushBack' is invoked.
 
+    int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        // Remove up to the specified 'maxNumItems' elements from the front of
+        // this queue and append them, in order, to the specified 'buffer'.  If
+        // the queue is empty, block until it is not empty.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPopFrontDisabled()' and
+        // 'e_FAILED' if an error occurs.  On failure, '*buffer' is not
+        // changed.  Threads blocked due to the queue being empty will return
+        // 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior is
+        // undefined unless '0 < maxNumItems'.  Note that capacity for up to
+        // 'maxNumItems' elements is reserved in 'buffer' before any element is
+        // removed, so if that allocation throws, the queue is not changed.
+        // If copying (or moving) an element into 'buffer' throws, the elements
+        // already appended remain in 'buffer', and the other elements removed
+        // by this call are destroyed.  Also note that all of the elements
+        // removed are claimed with a single update of the queue's indices,
+        // and a thread blocked in a "push" operation is released at most once
+        // per call.
+
+    template <class FORWARD_ITER>
+    int pushBack(FORWARD_ITER begin, FORWARD_ITER end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue.  If the queue becomes full, block
+        // until it is not full.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_SUCCESS' on success,
+        // 'e_DISABLED' if 'isPushBackDisabled()' and 'e_FAILED' if an error
+        // occurs.  Threads blocked due to the queue being full will return
+        // 'e_DISABLED' if 'disablePushBack' is invoked.  Note that on failure
+        // a prefix of the range may already have been appended to the queue.
+        // Also note that the elements of the range are appended in as few
+        // batches as the available capacity allows, each batch claiming its
+        // nodes with a single update of the queue's indices.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -507,6 +697,21 @@ class BoundedQueue {
         // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
         // an error occurs.  On failure, 'value' is not changed.
 
+    int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        // Attempt to remove up to the specified 'maxNumItems' elements from
+        // the front of this queue without blocking, and, if successful, append
+        // the removed elements, in order, to the specified 'buffer'.  Return 0
+        // on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPopFrontDisabled()',
+        // 'e_EMPTY' if '!isPopFrontDisabled()' and the queue was empty, and
+        // 'e_FAILED' if an error occurs.  On failure, '*buffer' is not
+        // changed.  The behavior is undefined unless '0 < maxNumItems'.  Note
+        // that capacity for up to 'maxNumItems' elements is reserved in
+        // 'buffer' before any element is removed, so if that allocation
+        // throws, the queue is not changed.  If copying (or moving) an element
+        // into 'buffer' throws, the elements already appended remain in
+        // 'buffer', and the other elements removed by this call are destroyed.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -522,6 +727,14 @@ class BoundedQueue {
         // 'e_FULL' if '!isPushBackDisabled()' and the queue was full, and
         // 'e_FAILED' if an error occurs.  On failure, 'value' is not changed.
 
+    template <class FORWARD_ITER>
+    bsl::size_t tryPushBack(FORWARD_ITER begin, FORWARD_ITER end);
+        // Append, without blocking, as many of the elements of the specified
+        // range '[begin .. end)', in order, to the back of this queue as there
+        // is capacity available for.  Return the number of elements appended.
+        // Note that 0 is returned if the queue is full or
+        // 'isPushBackDisabled()'.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -641,6 +854,82 @@ void BoundedQueue_PushExceptionCompleteProctor<TYPE>::release()
     d_queue_p = 0;
 }
 
+                  // ----------------------------------------
+                  // class BoundedQueue_PopBatchCompleteGuard
+                  // ----------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PopBatchCompleteGuard<TYPE>::BoundedQueue_PopBatchCompleteGuard(
+                                                        TYPE   *queue,
+                                                        Uint64  index,
+                                                        Uint64  length,
+                                                        Uint64  numUnclaimed,
+                                                        bool    isEmpty)
+: d_queue_p(queue)
+, d_index(index)
+, d_length(length)
+, d_numUnclaimed(numUnclaimed)
+, d_isLastRun(0 == numUnclaimed)
+, d_isEmpty(isEmpty)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PopBatchCompleteGuard<TYPE>::
+                                         ~BoundedQueue_PopBatchCompleteGuard()
+{
+    d_queue_p->popBatchComplete(d_index,
+                                d_length,
+                                d_isEmpty && d_isLastRun);
+
+    if (d_numUnclaimed) {
+        d_queue_p->popBatchDiscard(d_numUnclaimed, d_isEmpty);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PopBatchCompleteGuard<TYPE>::releaseUnclaimed()
+{
+    d_numUnclaimed = 0;
+}
+
+                  // -----------------------------------------
+                  // class BoundedQueue_PushBatchCompleteGuard
+                  // -----------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PushBatchCompleteGuard<TYPE>::
+              BoundedQueue_PushBatchCompleteGuard(TYPE        *queue,
+                                                  bsl::size_t  numReserved)
+: d_queue_p(queue)
+, d_numReserved(numReserved)
+, d_numPushed(0)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PushBatchCompleteGuard<TYPE>::
+                                        ~BoundedQueue_PushBatchCompleteGuard()
+{
+    d_queue_p->pushBatchComplete(d_numPushed, d_numReserved);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PushBatchCompleteGuard<TYPE>::incrementNumPushed()
+{
+    ++d_numPushed;
+}
+
                          // ------------------------
                          // struct BoundedQueue_Node
                          // ------------------------
@@ -716,6 +1005,129 @@ void BoundedQueue<TYPE>::popComplete(Node *node, bool isEmpty)
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::popBatchComplete(Uint64 index,
+                                          Uint64 length,
+                                          bool   isEmpty)
+{
+    Uint64 numPopped    = 0;
+    Uint64 numReclaimed = 0;
+
+    for (Uint64 i = 0; i < length; ++i) {
+        Node& node = d_element_p[(index + i) % d_capacity];
+
+        if (node.reclaim()) {
+            ++numReclaimed;
+        }
+        else {
+            node.d_value.object().~TYPE();
+            ++numPopped;
+        }
+    }
+
+    // Nodes marked for reclamation were not counted as started by
+    // 'popFrontBatchHelper' (see 'popFrontHelper'), so they are counted as
+    // both started and finished.
+
+    Uint64 count = AtomicOp::addUint64NvAcqRel(
+                           &d_popCount,
+                           k_FINISHED_INC * numPopped
+                         + (k_STARTED_INC + k_FINISHED_INC) * numReclaimed);
+    if (isQuiescentState(count)) {
+
+        // The total number of popped elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the
+        // push semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_popCount,
+                                              count,
+                                              0) == count) {
+            d_pushSemaphore.post(static_cast<int>(count & k_STARTED_MASK));
+        }
+    }
+
+    if (isEmpty) {
+        AtomicOp::addUintAcqRel(&d_emptyGeneration, 1);
+        if (0 < AtomicOp::getUintAcquire(&d_emptyCount)) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_emptyMutex);
+            }
+            d_emptyCondition.broadcast();
+        }
+    }
+}
+
+template <class TYPE>
+bsls::Types::Uint64 BoundedQueue<TYPE>::popBatchClaim(Uint64  length,
+                                                      Uint64 *index)
+{
+    // 'd_popIndex' stores the next location to use (want the original value)
+
+    *index = AtomicOp::addUint64NvAcqRel(&d_popIndex, length) - length;
+
+    Uint64 numReclaim = 0;
+    for (Uint64 i = 0; i < length; ++i) {
+        if (d_element_p[(*index + i) % d_capacity].reclaim()) {
+            ++numReclaim;
+        }
+    }
+    return numReclaim;
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popBatchDiscard(Uint64 numItems, bool isEmpty)
+{
+    while (numItems) {
+        const Uint64 length = numItems;
+        Uint64       index;
+
+        numItems = popBatchClaim(length, &index);
+        popBatchComplete(index, length, isEmpty && !numItems);
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popFrontBatchHelper(bsl::size_t        numItems,
+                                             bsl::vector<TYPE> *buffer)
+{
+    bool empty = isEmpty();
+
+    AtomicOp::addUint64AcqRel(&d_popCount, k_STARTED_INC * numItems);
+
+    // Claim the nodes in as few runs as possible; each run is claimed with a
+    // single update of 'd_popIndex'.  Nodes marked for reclamation do not
+    // hold an element and are replaced by extending the claim with another
+    // run.  If copying an element throws, the guard claims and discards the
+    // elements of the runs not yet claimed, since all 'numItems' elements are
+    // counted as started in 'd_popCount'.
+
+    Uint64 remaining = numItems;
+    while (remaining) {
+        const Uint64 length = remaining;
+        Uint64       index;
+
+        remaining = popBatchClaim(length, &index);
+
+        BoundedQueue_PopBatchCompleteGuard<BoundedQueue<TYPE> >
+                                  guard(this, index, length, remaining, empty);
+
+        for (Uint64 i = 0; i < length; ++i) {
+            Node& node = d_element_p[(index + i) % d_capacity];
+
+            if (!node.reclaim()) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+                buffer->push_back(
+                           bslmf::MovableRefUtil::move(node.d_value.object()));
+#else
+                buffer->push_back(node.d_value.object());
+#endif
+            }
+        }
+
+        guard.releaseUnclaimed();
+    }
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 {
@@ -771,6 +1183,71 @@ void BoundedQueue<TYPE>::pushComplete()
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::pushBatchComplete(bsl::size_t numPushed,
+                                           bsl::size_t numReserved)
+{
+    BSLS_ASSERT(numPushed <= numReserved);
+
+    // Nodes that were reserved but not populated remain marked for
+    // reclamation; remove the indicator for their started push operations
+    // (see 'pushExceptionComplete').
+
+    Uint64 count = AtomicOp::addUint64NvAcqRel(
+                              &d_pushCount,
+                              k_FINISHED_INC * numPushed
+                            - k_STARTED_INC * (numReserved - numPushed));
+
+    int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+    if (0 != numToPost && isQuiescentState(count)) {
+
+        // The total number of pushed elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the pop
+        // semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_pushCount,
+                                               count,
+                                               0) == count) {
+            d_popSemaphore.post(numToPost);
+        }
+    }
+}
+
+template <class TYPE>
+template <class FORWARD_ITER>
+FORWARD_ITER BoundedQueue<TYPE>::pushBackBatchHelper(FORWARD_ITER begin,
+                                                     bsl::size_t  numItems)
+{
+    AtomicOp::addUint64AcqRel(&d_pushCount, k_STARTED_INC * numItems);
+
+    // 'd_pushIndex' stores the next location to use (want the original value)
+
+    const Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, numItems)
+                                                                   - numItems;
+
+    for (bsl::size_t i = 0; i < numItems; ++i) {
+        d_element_p[(index + i) % d_capacity].assignReclaim(true);
+    }
+
+    BoundedQueue_PushBatchCompleteGuard<BoundedQueue<TYPE> >
+                                                      guard(this, numItems);
+
+    for (bsl::size_t i = 0; i < numItems; ++i, ++begin) {
+        Node& node = d_element_p[(index + i) % d_capacity];
+
+        bslalg::ScalarPrimitives::copyConstruct(node.d_value.address(),
+                                                *begin,
+                                                d_allocator_p);
+
+        node.assignReclaim(false);
+
+        guard.incrementNumPushed();
+    }
+
+    return begin;
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::pushExceptionComplete()
 {
@@ -849,6 +1326,66 @@ int BoundedQueue<TYPE>::popFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::popFront(bsl::size_t        maxNumItems,
+                                 bsl::vector<TYPE> *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    // Reserve before claiming any element, so that a failure to allocate
+    // leaves the queue unchanged.
+
+    buffer->reserve(buffer->size()
+                  + bsl::min<Uint64>(maxNumItems, d_capacity));
+
+    int rv = d_popSemaphore.wait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    bsl::size_t numItems = 1;
+    if (1 < maxNumItems) {
+        numItems += d_popSemaphore.take(static_cast<int>(
+                              bsl::min<Uint64>(maxNumItems - 1, d_capacity)));
+    }
+
+    popFrontBatchHelper(numItems, buffer);
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+template <class FORWARD_ITER>
+int BoundedQueue<TYPE>::pushBack(FORWARD_ITER begin, FORWARD_ITER end)
+{
+    bsl::size_t remaining = bsl::distance(begin, end);
+
+    while (remaining) {
+        int rv = d_pushSemaphore.wait();
+        if (rv) {
+            if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+                return e_DISABLED;                                    // RETURN
+            }
+            return e_FAILED;                                          // RETURN
+        }
+
+        bsl::size_t numItems = 1;
+        if (1 < remaining) {
+            numItems += d_pushSemaphore.take(static_cast<int>(
+                                bsl::min<Uint64>(remaining - 1, d_capacity)));
+        }
+
+        begin      = pushBackBatchHelper(begin, numItems);
+        remaining -= numItems;
+    }
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -980,6 +1517,41 @@ int BoundedQueue<TYPE>::tryPopFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPopFront(bsl::size_t        maxNumItems,
+                                    bsl::vector<TYPE> *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    // Reserve before claiming any element, so that a failure to allocate
+    // leaves the queue unchanged.
+
+    buffer->reserve(buffer->size()
+                  + bsl::min<Uint64>(maxNumItems, d_capacity));
+
+    int rv = d_popSemaphore.tryWait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+            return e_EMPTY;                                           // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    bsl::size_t numItems = 1;
+    if (1 < maxNumItems) {
+        numItems += d_popSemaphore.take(static_cast<int>(
+                              bsl::min<Uint64>(maxNumItems - 1, d_capacity)));
+    }
+
+    popFrontBatchHelper(numItems, buffer);
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -1059,6 +1631,29 @@ int BoundedQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+template <class FORWARD_ITER>
+bsl::size_t BoundedQueue<TYPE>::tryPushBack(FORWARD_ITER begin,
+                                            FORWARD_ITER end)
+{
+    if (d_pushSemaphore.isDisabled()) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t length = bsl::distance(begin, end);
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t numItems = d_pushSemaphore.take(static_cast<int>(
+                                        bsl::min<Uint64>(length, d_capacity)));
+    if (numItems) {
+        pushBackBatchHelper(begin, numItems);
+    }
+
+    return numItems;
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE>
@@ -85,6 +85,10 @@ using namespace bsl;
 // [ 7] int tryPopFront(TYPE *value);
 // [ 6] int tryPushBack(const TYPE& value);
 // [ 9] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [13] int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+// [13] int pushBack(FORWARD_ITER begin, FORWARD_ITER end);
+// [13] int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+// [13] bsl::size_t tryPushBack(FORWARD_ITER begin, FORWARD_ITER end);
 // [ 5] void disablePopFront();
 // [ 5] void disablePushBack();
 // [ 5] void enablePopFront();
@@ -98,7 +102,9 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] CONCERN: FAILING TO GROW A BATCH OUTPUT BUFFER
+// [15] CONCERN: THROWING COPY IN A BATCH POP
+// [16] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -107,6 +113,7 @@ using namespace bsl;
 // [10] CONCERN: template requirements
 // [11] CONCERN: ordering guarantee
 // [12] DRQS 153332608: 'waitUntilEmpty' RACE WITH 'popFront'
+// [-1] BATCH SIZE PERFORMANCE TEST
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -153,6 +160,13 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
 // ============================================================================
 //                        GLOBAL MACROS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -751,6 +765,82 @@ extern "C" void *pushWaitDisable(void *arg)
     return 0;
 }
 
+void batchPush(OrderingObj *queue, bsl::size_t batchSize, int numValues)
+    // Append, to the specified 'queue', the specified 'numValues' values
+    // having the push thread id of the calling thread and sequence numbers
+    // '1 .. numValues' using range 'pushBack' with batches of at most the
+    // specified 'batchSize' elements.
+{
+    bsl::vector<OrderingValue> batch;
+
+    OrderingValue value;
+    value.d_pushThreadId   = bslmt::ThreadUtil::selfIdAsUint64();
+    value.d_sequenceNumber = 0;
+
+    while (value.d_sequenceNumber < static_cast<bsls::Types::Uint64>(
+                                                                 numValues)) {
+        batch.clear();
+        while (batch.size() < batchSize
+            && value.d_sequenceNumber <
+                               static_cast<bsls::Types::Uint64>(numValues)) {
+            ++value.d_sequenceNumber;
+            batch.push_back(value);
+        }
+
+        ASSERT(0 == queue->pushBack(batch.begin(), batch.end()));
+    }
+}
+
+void batchPop(OrderingObj                *queue,
+              bsl::size_t                 batchSize,
+              bsl::vector<OrderingValue> *result)
+    // Append to the specified 'result' the values removed from the specified
+    // 'queue' using batch 'popFront' with batches of at most the specified
+    // 'batchSize' elements until 'popFront' fails.
+{
+    while (0 == queue->popFront(batchSize, result)) {
+    }
+}
+
+void batchBenchmarkPush(Obj *queue, bsl::size_t batchSize, int numValues)
+    // Append the specified 'numValues' values to the specified 'queue' in
+    // batches of the specified 'batchSize' elements, using the single element
+    // 'pushBack' if '1 == batchSize'.
+{
+    if (1 == batchSize) {
+        for (int i = 0; i < numValues; ++i) {
+            queue->pushBack(i);
+        }
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<int> batch(batchSize, 0);
+    for (int i = 0; i < numValues; i += static_cast<int>(batchSize)) {
+        queue->pushBack(batch.begin(), batch.end());
+    }
+}
+
+void batchBenchmarkPop(Obj *queue, bsl::size_t batchSize, int numValues)
+    // Remove the specified 'numValues' values from the specified 'queue' in
+    // batches of at most the specified 'batchSize' elements, using the single
+    // element 'popFront' if '1 == batchSize'.
+{
+    if (1 == batchSize) {
+        int value;
+        for (int i = 0; i < numValues; ++i) {
+            queue->popFront(&value);
+        }
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<int> batch;
+    batch.reserve(batchSize);
+    for (int i = 0; i < numValues; i += static_cast<int>(batch.size())) {
+        batch.clear();
+        queue->popFront(batchSize, &batch);
+    }
+}
+
 // ============================================================================
 //               GENERATOR FUNCTIONS 'gg' AND 'ggg' FOR TESTING
 // ----------------------------------------------------------------------------
@@ -971,7 +1061,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1009,6 +1099,559 @@ int main(int argc, char *argv[])
 
         bslmt::ThreadUtil::join(watchdogHandle);
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // CONCERN: THROWING COPY IN A BATCH POP
+        //
+        // Concerns:
+        //: 1 If copying an element into the buffer supplied to the batch
+        //:   'popFront' or 'tryPopFront' throws, the elements removed by the
+        //:   call are removed from the queue, including the elements of runs
+        //:   of nodes not yet claimed when the exception is thrown (i.e.,
+        //:   runs claimed to replace nodes marked for reclamation).
+        //:
+        //: 2 After such a failure, the queue's "push" capacity is not lost,
+        //:   so the queue can again be filled and emptied.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 For each batch "pop" method, mark two nodes of a queue for
+        //:   reclamation by causing a range 'pushBack' to throw, append one
+        //:   more element, and cause the copy of the first element into the
+        //:   output buffer (after the buffer has reserved capacity) to throw
+        //:   while popping both elements.  Verify that the queue is empty
+        //:   afterwards.  (C-1)
+        //:
+        //: 2 Verify the queue can be filled to capacity and emptied again.
+        //:   (C-2)
+        //:
+        //: 3 Use test allocators to verify that no memory is leaked.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: THROWING COPY IN A BATCH POP
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THROWING COPY IN A BATCH POP" << endl
+                          << "=====================================" << endl;
+
+#ifdef BDE_BUILD_TARGET_EXC
+        enum { k_CAPACITY = 4 };
+
+        for (int blocking = 0; blocking < 2; ++blocking) {
+            if (veryVerbose) { P(blocking) }
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+            bslma::TestAllocator oa("output",   veryVeryVeryVerbose);
+
+            typedef bdlcc::BoundedQueue<AllocExceptionHelper> HelperObj;
+
+            {
+                HelperObj mX(k_CAPACITY, &sa);  const HelperObj& X = mX;
+
+                bsl::vector<AllocExceptionHelper> input(
+                                                    k_CAPACITY,
+                                                    AllocExceptionHelper(&sa),
+                                                    &sa);
+
+                // Push one element, leaving the two following nodes marked
+                // for reclamation.
+
+                sa.setAllocationLimit(1);
+                try {
+                    mX.pushBack(input.begin(), input.begin() + 3);
+                    ASSERTV(blocking, !"exception not thrown");
+                } catch (BloombergLP::bslma::TestAllocatorException&) {
+                }
+                sa.setAllocationLimit(-1);
+
+                ASSERT(1 == mX.tryPushBack(input.begin(), input.begin() + 1));
+                ASSERTV(blocking, X.numElements(), 2 == X.numElements());
+
+                // Popping both elements claims a first run of two nodes (the
+                // first element and a node marked for reclamation) and a
+                // second run of two nodes (the other node marked for
+                // reclamation and the second element).  The copy of the first
+                // element throws.
+
+                bsl::vector<AllocExceptionHelper> output(&oa);
+
+                int numException = 0;
+
+                oa.setAllocationLimit(1);  // allow the 'reserve'
+                try {
+                    if (blocking) {
+                        mX.popFront(2, &output);
+                    }
+                    else {
+                        mX.tryPopFront(2, &output);
+                    }
+                } catch (BloombergLP::bslma::TestAllocatorException&) {
+                    ++numException;
+                }
+                oa.setAllocationLimit(-1);
+
+                ASSERTV(blocking, 1 == numException);
+                ASSERTV(blocking, output.empty());
+                ASSERTV(blocking, X.numElements(), 0 == X.numElements());
+                ASSERTV(blocking, X.isEmpty());
+
+                // The whole capacity is available again.
+
+                ASSERTV(blocking, k_CAPACITY == mX.tryPushBack(input.begin(),
+                                                               input.end()));
+                ASSERTV(blocking, X.isFull());
+
+                if (blocking) {
+                    ASSERT(e_SUCCESS == mX.popFront(k_CAPACITY, &output));
+                }
+                else {
+                    ASSERT(e_SUCCESS == mX.tryPopFront(k_CAPACITY, &output));
+                }
+                ASSERTV(blocking, output.size(), k_CAPACITY == output.size());
+                ASSERTV(blocking, X.isEmpty());
+
+                ASSERTV(blocking, k_CAPACITY == mX.tryPushBack(input.begin(),
+                                                               input.end()));
+                ASSERTV(blocking, X.isFull());
+            }
+            ASSERTV(blocking, sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+            ASSERTV(blocking, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+#else
+        if (verbose) cout << "\nExceptions disabled; test skipped." << endl;
+#endif
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // CONCERN: FAILING TO GROW A BATCH OUTPUT BUFFER
+        //
+        // Concerns:
+        //: 1 If growing the buffer supplied to the batch 'popFront' or
+        //:   'tryPopFront' throws, no element is removed from the queue and
+        //:   the contents of the buffer are unchanged.
+        //:
+        //: 2 After such a failure, the queue's "push" capacity is not lost,
+        //:   so the queue can again be filled and emptied.
+        //
+        // Plan:
+        //: 1 For each batch "pop" method, fill a queue, and set an allocation
+        //:   limit of 0 on the allocator of an output buffer having no
+        //:   capacity.  Verify that the batch "pop" throws and that the queue
+        //:   and buffer are unchanged.  (C-1)
+        //:
+        //: 2 Remove the limit, pop the elements in a batch, and verify their
+        //:   values, then verify the queue can be filled and emptied again.
+        //:   (C-2)
+        //
+        // Testing:
+        //   CONCERN: FAILING TO GROW A BATCH OUTPUT BUFFER
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: FAILING TO GROW A BATCH OUTPUT BUFFER"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+#ifdef BDE_BUILD_TARGET_EXC
+        enum { k_CAPACITY = 4 };
+
+        const int VALUES[] = { 1, 2, 3, 4 };
+
+        for (int blocking = 0; blocking < 2; ++blocking) {
+            if (veryVerbose) { P(blocking) }
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+            bslma::TestAllocator oa("output",   veryVeryVeryVerbose);
+
+            Obj mX(k_CAPACITY, &sa);  const Obj& X = mX;
+
+            ASSERT(k_CAPACITY == mX.tryPushBack(VALUES,
+                                                VALUES + k_CAPACITY));
+            ASSERT(X.isFull());
+
+            bsl::vector<int> output(&oa);
+
+            int numException = 0;
+
+            oa.setAllocationLimit(0);
+            try {
+                if (blocking) {
+                    mX.popFront(k_CAPACITY, &output);
+                }
+                else {
+                    mX.tryPopFront(k_CAPACITY, &output);
+                }
+            } catch (BloombergLP::bslma::TestAllocatorException&) {
+                ++numException;
+            }
+            oa.setAllocationLimit(-1);
+
+            ASSERTV(blocking, 1 == numException);
+            ASSERTV(blocking, output.empty());
+            ASSERTV(blocking, X.numElements(),
+                    k_CAPACITY == X.numElements());
+
+            if (blocking) {
+                ASSERT(e_SUCCESS == mX.popFront(k_CAPACITY, &output));
+            }
+            else {
+                ASSERT(e_SUCCESS == mX.tryPopFront(k_CAPACITY, &output));
+            }
+            ASSERTV(blocking, output.size(), k_CAPACITY == output.size());
+            for (int i = 0; i < k_CAPACITY && i < (int)output.size(); ++i) {
+                ASSERTV(blocking, i, output[i], VALUES[i] == output[i]);
+            }
+            ASSERTV(blocking, X.isEmpty());
+
+            ASSERTV(blocking, k_CAPACITY == mX.tryPushBack(VALUES,
+                                                           VALUES
+                                                               + k_CAPACITY));
+            ASSERTV(blocking, X.isFull());
+
+            output.clear();
+            ASSERTV(blocking, e_SUCCESS == mX.tryPopFront(k_CAPACITY,
+                                                          &output));
+            ASSERTV(blocking, k_CAPACITY == output.size());
+            ASSERTV(blocking, X.isEmpty());
+        }
+#else
+        if (verbose) cout << "\nExceptions disabled; test skipped." << endl;
+#endif
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //
+        // Concerns:
+        //: 1 The range 'pushBack' and 'tryPushBack' append the elements of
+        //:   the range in order, and 'tryPushBack' appends no more elements
+        //:   than the available capacity.
+        //:
+        //: 2 The batch 'popFront' and 'tryPopFront' remove up to the
+        //:   requested number of elements in order, appending them to the
+        //:   supplied buffer without discarding its contents.
+        //:
+        //: 3 The batch methods operate correctly when the batch wraps around
+        //:   the end of the underlying array.
+        //:
+        //: 4 The batch methods return the expected status values when the
+        //:   queue is empty, full, or disabled.
+        //:
+        //: 5 An exception thrown while copying an element of a range leaves
+        //:   the queue in a valid state containing the elements copied before
+        //:   the exception, and the node of the failed element is reclaimed
+        //:   by a subsequent batch "pop".
+        //:
+        //: 6 The batch methods are thread safe and provide the ordering
+        //:   guarantee.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Push and pop ranges and batches of varying sizes through a small
+        //:   queue, verifying the values and the returned status and counts.
+        //:   (C-1..3)
+        //:
+        //: 2 Exercise the batch methods on empty, full, and disabled queues.
+        //:   (C-4)
+        //:
+        //: 3 Using 'AllocExceptionHelper' and an allocation limit, cause the
+        //:   copy of the second element of a range to throw and verify the
+        //:   subsequent behavior of the queue.  (C-5)
+        //:
+        //: 4 Have multiple threads push ranges and pop batches of varying
+        //:   sizes, then verify every value is popped exactly once and that
+        //:   the values from each push thread are popped in order by each pop
+        //:   thread.  (C-6)
+        //:
+        //: 5 Verify defensive checks are triggered for invalid values.  (C-7)
+        //
+        // Testing:
+        //   int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        //   int pushBack(FORWARD_ITER begin, FORWARD_ITER end);
+        //   int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buf);
+        //   bsl::size_t tryPushBack(FORWARD_ITER begin, FORWARD_ITER end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "\nSingle-threaded batches." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(16, &sa);  const Obj& X = mX;
+
+            bsl::vector<int> input(40, 0, &sa);
+            for (int i = 0; i < 40; ++i) {
+                input[i] = i;
+            }
+
+            bsl::vector<int> output(&sa);
+
+            int start = 0;  // index in 'input' of the next range to push
+
+            for (bsl::size_t batch = 1; batch <= 16; ++batch) {
+                for (int round = 0; round < 5; ++round) {
+                    bsl::vector<int>::const_iterator first =
+                                                        input.begin() + start;
+
+                    bsl::size_t numPushed = mX.tryPushBack(first,
+                                                           first + batch);
+
+                    ASSERTV(batch, numPushed, batch == numPushed);
+                    ASSERTV(batch, batch == X.numElements());
+
+                    output.clear();
+                    output.push_back(-1);
+
+                    ASSERT(e_SUCCESS == mX.tryPopFront(batch + 3, &output));
+                    ASSERTV(batch, output.size(), batch + 1 == output.size());
+                    ASSERT(-1 == output[0]);
+
+                    for (bsl::size_t i = 1; i < output.size(); ++i) {
+                        ASSERTV(batch,
+                                i,
+                                output[i],
+                                start + static_cast<int>(i) - 1 == output[i]);
+                    }
+                    ASSERT(0 == X.numElements());
+
+                    start = (start + static_cast<int>(batch)) % 20;
+                }
+            }
+
+            // Fill the queue with a range larger than the capacity.
+
+            ASSERT(16 == mX.tryPushBack(input.begin(), input.end()));
+            ASSERT(X.isFull());
+            ASSERT( 0 == mX.tryPushBack(input.begin(), input.end()));
+
+            output.clear();
+            ASSERT(e_SUCCESS == mX.popFront(5, &output));
+            ASSERT(5 == output.size());
+            ASSERT(e_SUCCESS == mX.popFront(100, &output));
+            ASSERT(16 == output.size());
+            for (int i = 0; i < 16; ++i) {
+                ASSERTV(i, output[i], i == output[i]);
+            }
+
+            output.clear();
+            ASSERT(e_EMPTY == mX.tryPopFront(4, &output));
+            ASSERT(output.empty());
+
+            // Blocking range push that fits.
+
+            ASSERT(0 == mX.pushBack(input.begin(), input.begin() + 16));
+            ASSERT(16 == X.numElements());
+            ASSERT(e_SUCCESS == mX.tryPopFront(16, &output));
+            ASSERT(16 == output.size());
+
+            // Empty range.
+
+            ASSERT(0 == mX.pushBack(input.begin(), input.begin()));
+            ASSERT(0 == mX.tryPushBack(input.begin(), input.begin()));
+            ASSERT(0 == X.numElements());
+        }
+
+        if (verbose) cout << "\nDisabled queue." << endl;
+        {
+            Obj mX(8);  const Obj& X = mX;
+
+            int              input[] = { 1, 2, 3 };
+            bsl::vector<int> output;
+
+            mX.disablePushBack();
+
+            ASSERT(0          == mX.tryPushBack(input + 0, input + 3));
+            ASSERT(e_DISABLED == mX.pushBack(input + 0, input + 3));
+            ASSERT(0          == X.numElements());
+
+            mX.enablePushBack();
+
+            ASSERT(3 == mX.tryPushBack(input + 0, input + 3));
+
+            mX.disablePopFront();
+
+            ASSERT(e_DISABLED == mX.popFront(2, &output));
+            ASSERT(e_DISABLED == mX.tryPopFront(2, &output));
+            ASSERT(output.empty());
+
+            mX.enablePopFront();
+
+            ASSERT(e_SUCCESS == mX.popFront(2, &output));
+            ASSERT(2 == output.size());
+            ASSERT(1 == output[0] && 2 == output[1]);
+        }
+
+        if (verbose) cout << "\nBlocking batch 'popFront'." << endl;
+        {
+            Obj mX(8);
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, deferredDisablePopFront, &mX);
+
+            bsl::vector<int> output;
+            ASSERT(e_DISABLED == mX.popFront(4, &output));
+            ASSERT(output.empty());
+
+            bslmt::ThreadUtil::join(handle);
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nException in range 'pushBack'." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            typedef bdlcc::BoundedQueue<AllocExceptionHelper> HelperObj;
+
+            HelperObj mX(4, &sa);  const HelperObj& X = mX;
+
+            bsl::vector<AllocExceptionHelper> input(4,
+                                                    AllocExceptionHelper(&sa),
+                                                    &sa);
+            bsl::vector<AllocExceptionHelper> output(&sa);
+
+            int numException = 0;
+
+            sa.setAllocationLimit(1);
+            try {
+                mX.pushBack(input.begin(), input.begin() + 3);
+            } catch (BloombergLP::bslma::TestAllocatorException&) {
+                ++numException;
+            }
+            sa.setAllocationLimit(-1);
+
+            ASSERT(1 == numException);
+            ASSERT(1 == X.numElements());
+
+            // The two reserved nodes that were not populated are returned to
+            // the push capacity once a "pop" passes over them.
+
+            ASSERT(1 == mX.tryPushBack(input.begin(), input.begin() + 1));
+            ASSERT(2 == X.numElements());
+            ASSERT(X.isFull());
+
+            ASSERT(e_SUCCESS == mX.tryPopFront(4, &output));
+            ASSERTV(output.size(), 2 == output.size());
+            ASSERT(0 == X.numElements());
+
+            ASSERT(4 == mX.tryPushBack(input.begin(), input.end()));
+            ASSERT(X.isFull());
+
+            output.clear();
+            ASSERT(e_SUCCESS == mX.tryPopFront(10, &output));
+            ASSERT(4 == output.size());
+        }
+#endif
+
+        if (verbose) cout << "\nMulti-threaded batches." << endl;
+        {
+            enum {
+                k_NUM_PUSH_THREADS = 4,
+                k_NUM_POP_THREADS  = 4,
+                k_NUM_VALUES       = 5000
+            };
+
+            OrderingObj mX(64);  const OrderingObj& X = mX;
+
+            bsl::vector<bsl::vector<OrderingValue> >
+                                                 results(k_NUM_POP_THREADS);
+
+            bslmt::ThreadGroup pushThreads;
+            bslmt::ThreadGroup popThreads;
+
+            for (int i = 0; i < k_NUM_POP_THREADS; ++i) {
+                popThreads.addThread(bdlf::BindUtil::bind(
+                                        &batchPop,
+                                        &mX,
+                                        static_cast<bsl::size_t>(1 + i * 11),
+                                        &results[i]));
+            }
+            for (int i = 0; i < k_NUM_PUSH_THREADS; ++i) {
+                pushThreads.addThread(bdlf::BindUtil::bind(
+                                        &batchPush,
+                                        &mX,
+                                        static_cast<bsl::size_t>(1 + i * 23),
+                                        static_cast<int>(k_NUM_VALUES)));
+            }
+
+            pushThreads.joinAll();
+
+            ASSERT(0 == X.waitUntilEmpty());
+
+            mX.disablePopFront();
+
+            popThreads.joinAll();
+
+            bsl::unordered_map<bsls::Types::Uint64, bsl::vector<int> > seen;
+
+            bsl::size_t total = 0;
+            for (int i = 0; i < k_NUM_POP_THREADS; ++i) {
+                bsl::unordered_map<bsls::Types::Uint64, bsls::Types::Uint64>
+                                                                         last;
+
+                const bsl::vector<OrderingValue>& result = results[i];
+
+                total += result.size();
+                for (bsl::size_t j = 0; j < result.size(); ++j) {
+                    const OrderingValue& value = result[j];
+
+                    bsls::Types::Uint64& lastSequenceNumber =
+                                                   last[value.d_pushThreadId];
+
+                    ASSERTV(i,
+                            j,
+                            lastSequenceNumber,
+                            value.d_sequenceNumber,
+                            lastSequenceNumber < value.d_sequenceNumber);
+
+                    lastSequenceNumber = value.d_sequenceNumber;
+
+                    bsl::vector<int>& counts = seen[value.d_pushThreadId];
+                    counts.resize(k_NUM_VALUES + 1, 0);
+                    ++counts[static_cast<bsl::size_t>(
+                                                     value.d_sequenceNumber)];
+                }
+            }
+
+            ASSERTV(total, k_NUM_PUSH_THREADS * k_NUM_VALUES == total);
+            ASSERTV(seen.size(), k_NUM_PUSH_THREADS == seen.size());
+
+            for (bsl::unordered_map<bsls::Types::Uint64,
+                                    bsl::vector<int> >::const_iterator iter =
+                                                                  seen.begin();
+                 iter != seen.end();
+                 ++iter) {
+                for (int j = 1; j <= k_NUM_VALUES; ++j) {
+                    ASSERTV(j, iter->second[j], 1 == iter->second[j]);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(8);
+
+            bsl::vector<int> output;
+
+            mX.pushBack(1);
+
+            ASSERT_FAIL(mX.popFront(0, &output));
+            ASSERT_PASS(mX.popFront(1, &output));
+
+            mX.pushBack(1);
+
+            ASSERT_FAIL(mX.tryPopFront(0, &output));
+            ASSERT_PASS(mX.tryPopFront(1, &output));
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // DRQS 153332608: 'waitUntilEmpty' RACE WITH 'popFront'
@@ -2900,6 +3543,57 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // BATCH SIZE PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Transferring elements in batches reduces the cost per element
+        //:   compared to the single element methods.
+        //
+        // Plan:
+        //: 1 For batch sizes of 1 through 1024, have one thread push a fixed
+        //:   number of values with the range 'pushBack' while another thread
+        //:   removes them with the batch 'popFront', and report the elapsed
+        //:   time per element.  A batch size of 1 uses the single element
+        //:   methods as a baseline.  An optional second argument specifies
+        //:   the number of values.  (C-1)
+        //
+        // Testing:
+        //   BATCH SIZE PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH SIZE PERFORMANCE TEST" << endl
+                          << "===========================" << endl;
+
+        const int numValues = argc > 2 ? atoi(argv[2]) : 1 << 22;
+
+        for (bsl::size_t batchSize = 1; batchSize <= 1024; batchSize *= 2) {
+            Obj mX(4096);
+
+            bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+            bslmt::ThreadGroup threads;
+            threads.addThread(bdlf::BindUtil::bind(&batchBenchmarkPop,
+                                                   &mX,
+                                                   batchSize,
+                                                   numValues));
+            threads.addThread(bdlf::BindUtil::bind(&batchBenchmarkPush,
+                                                   &mX,
+                                                   batchSize,
+                                                   numValues));
+            threads.joinAll();
+
+            bsls::TimeInterval elapsed =
+                                 bsls::SystemTime::nowMonotonicClock() - start;
+
+            cout << "batch size " << batchSize << ": "
+                 << static_cast<double>(elapsed.totalNanoseconds()) /
+                                                                     numValues
+                 << " ns per element" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -2,6 +2,179 @@
 
 #include <bdlcc_cache.h>
 
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_cache_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+namespace {
+
+const bsls::Types::Uint64 k_SEEDS[] = {
+    0xc3a5c85c97cb3127ULL,
+    0xb492b66fbe98f273ULL,
+    0x9ae16a3b2f90404fULL,
+    0xcbf29ce484222325ULL
+};
+    // Multipliers used to derive the 4 counter indices of a hash value.
+
+const int k_NUM_HASHES = static_cast<int>(sizeof k_SEEDS / sizeof *k_SEEDS);
+    // Number of counters associated with each hash value.
+
+const int k_COUNTERS_PER_WORD = 16;
+    // Number of 4-bit counters packed in a 64-bit word.
+
+const bsls::Types::Uint64 k_MAX_NUM_COUNTERS = 1 << 22;
+    // Upper bound on the number of counters of a sketch (i.e., 2MB).
+
+const bsls::Types::Uint64 k_HALVE_MASK = 0x7777777777777777ULL;
+    // Mask clearing the bit shifted into each counter by a right shift.
+
+}  // close unnamed namespace
+
+                        // ---------------------------
+                        // class Cache_FrequencySketch
+                        // ---------------------------
+
+// PRIVATE ACCESSORS
+bsls::Types::Uint64 Cache_FrequencySketch::counterIndex(bsl::size_t hash,
+                                                        int         i) const
+{
+    bsls::Types::Uint64 h = (static_cast<bsls::Types::Uint64>(hash) +
+                                                     k_SEEDS[i]) * k_SEEDS[i];
+    h ^= h >> 32;
+    return h & d_counterMask;
+}
+
+// CREATORS
+Cache_FrequencySketch::Cache_FrequencySketch(bslma::Allocator *basicAllocator)
+: d_table_p(0)
+, d_numWords(0)
+, d_counterMask(0)
+, d_sampleSize(0)
+, d_numIncrements(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+Cache_FrequencySketch::~Cache_FrequencySketch()
+{
+    d_allocator_p->deallocate(d_table_p);
+}
+
+// MANIPULATORS
+void Cache_FrequencySketch::initialize(bsl::size_t capacity)
+{
+    // Use at least 4 counters per item (rounded up to a power of 2), so that
+    // collisions rarely inflate the estimates of infrequent items.
+
+    bsls::Types::Uint64 numCounters = k_COUNTERS_PER_WORD;
+    while (numCounters < k_MAX_NUM_COUNTERS
+        && numCounters / 4 < static_cast<bsls::Types::Uint64>(capacity)) {
+        numCounters <<= 1;
+    }
+
+    d_allocator_p->deallocate(d_table_p);
+    d_table_p = 0;
+
+    d_numWords    = static_cast<bsl::size_t>(numCounters /
+                                                        k_COUNTERS_PER_WORD);
+    d_counterMask = numCounters - 1;
+    d_sampleSize  = numCounters / 4 * 10;
+    d_numIncrements.storeRelaxed(0);
+
+    d_table_p = static_cast<bsls::AtomicUint64 *>(
+                   d_allocator_p->allocate(d_numWords *
+                                           sizeof(bsls::AtomicUint64)));
+    for (bsl::size_t i = 0; i < d_numWords; ++i) {
+        new (d_table_p + i) bsls::AtomicUint64(0);
+    }
+}
+
+void Cache_FrequencySketch::increment(bsl::size_t hash)
+{
+    if (0 == d_table_p) {
+        return;                                                       // RETURN
+    }
+
+    for (int i = 0; i < k_NUM_HASHES; ++i) {
+        const bsls::Types::Uint64 index = counterIndex(hash, i);
+        bsls::AtomicUint64&       word  = d_table_p[index /
+                                                        k_COUNTERS_PER_WORD];
+        const int                 shift = static_cast<int>(
+                                            index % k_COUNTERS_PER_WORD) * 4;
+
+        bsls::Types::Uint64 value = word.loadRelaxed();
+        while (((value >> shift) & k_MAX_FREQUENCY) != k_MAX_FREQUENCY) {
+            const bsls::Types::Uint64 newValue =
+                                  value + (static_cast<bsls::Types::Uint64>(1)
+                                                                     << shift);
+            const bsls::Types::Uint64 previous =
+                                           word.testAndSwap(value, newValue);
+            if (previous == value) {
+                break;
+            }
+            value = previous;
+        }
+    }
+
+    if (d_numIncrements.addRelaxed(1) == d_sampleSize) {
+        halve();
+    }
+}
+
+void Cache_FrequencySketch::halve()
+{
+    for (bsl::size_t i = 0; i < d_numWords; ++i) {
+        bsls::Types::Uint64 value = d_table_p[i].loadRelaxed();
+        while (true) {
+            const bsls::Types::Uint64 previous = d_table_p[i].testAndSwap(
+                                               value,
+                                               (value >> 1) & k_HALVE_MASK);
+            if (previous == value) {
+                break;
+            }
+            value = previous;
+        }
+    }
+    d_numIncrements.storeRelaxed(d_sampleSize / 2);
+}
+
+// ACCESSORS
+int Cache_FrequencySketch::frequency(bsl::size_t hash) const
+{
+    if (0 == d_table_p) {
+        return 0;                                                     // RETURN
+    }
+
+    int result = k_MAX_FREQUENCY;
+    for (int i = 0; i < k_NUM_HASHES; ++i) {
+        const bsls::Types::Uint64 index = counterIndex(hash, i);
+        const bsls::Types::Uint64 word  =
+                      d_table_p[index / k_COUNTERS_PER_WORD].loadRelaxed();
+        const int                 count = static_cast<int>(
+              (word >> (index % k_COUNTERS_PER_WORD * 4)) & k_MAX_FREQUENCY);
+        if (count < result) {
+            result = count;
+        }
+    }
+    return result;
+}
+
+bsl::size_t Cache_FrequencySketch::numCounters() const
+{
+    return d_numWords * k_COUNTERS_PER_WORD;
+}
+
+bsls::Types::Uint64 Cache_FrequencySketch::sampleSize() const
+{
+    return d_sampleSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
 // ----------------------------------------------------------------------------
 // Copyright 2017 Bloomberg Finance L.P.
 //
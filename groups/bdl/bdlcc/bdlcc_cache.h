@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlcc::Cache: in-process key-value cache
+//  bdlcc::CacheEvictionPolicy: enumeration of supported eviction policies
 //
 //@DESCRIPTION: This component defines a single class template, 'bdlcc::Cache',
 // implementing a thread-safe in-memory key-value cache with a configurable
@@ -27,11 +28,42 @@ BSLS_IDENT("$Id: $")
 // fixed maximum size is obtained by setting the high and low watermarks to the
 // same value.
 //
-// Two eviction policies are supported: LRU (Least Recently Used) and FIFO
-// (First In, First Out).  With LRU, the item that has *not* been accessed for
-// the longest period of time will be evicted first.  With FIFO, the eviction
-// order is based on the order of insertion, with the earliest inserted item
-// being evicted first.
+// Four eviction policies are supported: LRU (Least Recently Used), FIFO
+// (First In, First Out), CLOCK, and TinyLFU.  With LRU, the item that has
+// *not* been accessed for the longest period of time will be evicted first.
+// With FIFO, the eviction order is based on the order of insertion, with the
+// earliest inserted item being evicted first.  CLOCK and TinyLFU approximate
+// LRU while keeping cache hits read-only (see {Approximate LRU Policies}).
+//
+///Approximate LRU Policies
+///------------------------
+// Maintaining an exact LRU order requires the eviction queue to be modified
+// on every cache hit, and therefore a write lock.  The 'e_CLOCK' and
+// 'e_TINYLFU' policies instead record a hit by setting an atomic "referenced"
+// bit on the item, which only requires a read lock:
+//
+//: 'e_CLOCK':
+//:   The "second chance" (CLOCK) algorithm.  Items are queued in insertion
+//:   order.  When an item must be evicted, the item at the front of the queue
+//:   is examined: if it has been referenced since it was last examined, its
+//:   bit is cleared and it is moved to the back of the queue; otherwise it is
+//:   evicted.
+//:
+//: 'e_TINYLFU':
+//:   A W-TinyLFU style policy.  The access frequency of every key (including
+//:   keys looked up but not found) is recorded in a count-min sketch of 4-bit
+//:   counters that is periodically halved, so that the frequency estimates
+//:   age over time.  Newly inserted items enter a small admission window
+//:   (FIFO, 1% of the high watermark).  Items leave the window for the main
+//:   queue (managed with CLOCK) while the cache is not full.  Once the cache
+//:   is full, each eviction compares the oldest item of the window (the
+//:   candidate) with the CLOCK victim of the main queue, and evicts the one
+//:   with the lower estimated frequency (promoting the candidate to the main
+//:   queue if the victim is evicted).  This keeps frequently used items in
+//:   the cache during scans of rarely used keys.
+//
+// The 'e_TINYLFU' policy allocates, at construction, a frequency sketch using
+// 2 to 4 bytes per item of the high watermark (up to 2MB).
 //
 ///Thread Safety
 ///-------------
@@ -49,10 +81,10 @@ BSLS_IDENT("$Id: $")
 // All of the modifier methods of the cache potentially requires a write lock.
 // Of particular note is the 'tryGetValue' method, which requires a writer lock
 // only if the eviction queue needs to be modified.  This means 'tryGetValue'
-// requires only a read lock if the eviction policy is set to FIFO or the
-// argument 'modifyEvictionQueue' is set to 'false'.  For limited cases where
-// contention is likely, temporarily setting 'modifyEvictionQueue' to 'false'
-// might be of value.
+// requires only a read lock if the eviction policy is set to FIFO, CLOCK, or
+// TinyLFU, or the argument 'modifyEvictionQueue' is set to 'false'.  For
+// limited cases where contention is likely, temporarily setting
+// 'modifyEvictionQueue' to 'false' might be of value.
 //
 // The 'visit' method acquires a read lock and calls the supplied visitor
 // function for every item in the cache, or until the visitor function returns
@@ -88,13 +120,16 @@ BSLS_IDENT("$Id: $")
 // +----------------------------------------------------+--------------------+
 // | tryGetValue                                        | O[1]               |
 // +----------------------------------------------------+--------------------+
-// | popFront                                           | O[1]               |
+// | popFront                                           | Average: O[1]      |
+// |                                                    | Worst:   O[n]      |
 // +----------------------------------------------------+--------------------+
 // | erase                                              | O[1]               |
 // +----------------------------------------------------+--------------------+
 // | visit                                              | O[n]               |
 // +----------------------------------------------------+--------------------+
 //..
+// Note that the worst case of 'popFront' applies only to the CLOCK and TinyLFU
+// policies, which may have to skip every referenced item in the queue.
 //
 ///Usage
 ///-----
@@ -308,7 +343,9 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_review.h>
+#include <bsls_types.h>
 
 #include <bsl_memory.h>
 #include <bsl_map.h>
@@ -329,9 +366,134 @@ struct CacheEvictionPolicy {
     enum Enum {
         // Enumeration of supported cache eviction policies.
 
-        e_LRU,  // Least Recently Used
-        e_FIFO  // First In, First Out
+        e_LRU,     // Least Recently Used
+        e_FIFO,    // First In, First Out
+        e_CLOCK,   // second chance (approximate LRU, read-only hits)
+        e_TINYLFU  // W-TinyLFU admission over CLOCK (read-only hits)
+    };
+};
+
+                        // ===========================
+                        // class Cache_FrequencySketch
+                        // ===========================
+
+class Cache_FrequencySketch {
+    // This class implements a count-min sketch estimating the access frequency
+    // of hash values, used by the TinyLFU eviction policy.  Each hash value is
+    // mapped to 4 saturating 4-bit counters, packed 16 to an atomic 64-bit
+    // word.  After a number of increments proportional to the capacity
+    // supplied to 'initialize', all counters are halved so that the estimates
+    // favor recent accesses.  The 'increment' and 'frequency' methods may be
+    // called concurrently.
+
+    // DATA
+    bsls::AtomicUint64 *d_table_p;        // counter words (owned)
+
+    bsl::size_t         d_numWords;       // number of words in 'd_table_p'
+
+    bsls::Types::Uint64 d_counterMask;    // number of counters - 1
+
+    bsls::Types::Uint64 d_sampleSize;     // number of increments between
+                                          // two halvings
+
+    bsls::AtomicUint64  d_numIncrements;  // increments since last halving
+
+    bslma::Allocator   *d_allocator_p;    // memory allocator (held, not
+                                          // owned)
+
+    // PRIVATE ACCESSORS
+    bsls::Types::Uint64 counterIndex(bsl::size_t hash, int i) const;
+        // Return the index of the specified 'i'th counter of the specified
+        // 'hash'.
+
+  private:
+    // NOT IMPLEMENTED
+    Cache_FrequencySketch(const Cache_FrequencySketch&);
+    Cache_FrequencySketch& operator=(const Cache_FrequencySketch&);
+
+  public:
+    // CONSTANTS
+    enum {
+        k_MAX_FREQUENCY = 15  // saturation value of a counter
     };
+
+    // CREATORS
+    explicit Cache_FrequencySketch(bslma::Allocator *basicAllocator = 0);
+        // Create an empty sketch that records no frequencies until
+        // 'initialize' is called.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~Cache_FrequencySketch();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void initialize(bsl::size_t capacity);
+        // Size this sketch for a cache holding up to the specified 'capacity'
+        // items, and reset all counters.  This method is *not* thread-safe.
+
+    void increment(bsl::size_t hash);
+        // Increment the (saturating) counters associated with the specified
+        // 'hash', and halve all counters if the sample size has been reached.
+        // This method has no effect if 'initialize' has not been called.
+
+    void halve();
+        // Halve the value of every counter.
+
+    // ACCESSORS
+    int frequency(bsl::size_t hash) const;
+        // Return the estimated number of increments of the specified 'hash'
+        // since it was last halved, in the range '[0, k_MAX_FREQUENCY]'.
+
+    bsl::size_t numCounters() const;
+        // Return the number of counters of this sketch.
+
+    bsls::Types::Uint64 sampleSize() const;
+        // Return the number of increments after which all counters are
+        // halved.
+};
+
+                          // =====================
+                          // struct Cache_MapValue
+                          // =====================
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+struct Cache_MapValue {
+    // This 'struct' holds the per-item state of a cache: the value, the
+    // position of the key in an eviction queue, and the state used by the
+    // CLOCK and TinyLFU eviction policies.
+
+    // DATA
+    VALUE_PTR                d_valuePtr;    // cached value
+
+    QUEUE_ITERATOR           d_queueIt;     // position in eviction queue
+
+    mutable bsls::AtomicBool d_referenced;  // 'true' if accessed since the
+                                            // CLOCK hand last passed; set
+                                            // under a read lock
+
+    bool                     d_inWindow;    // 'true' if queued in the TinyLFU
+                                            // admission window
+
+    // CREATORS
+    Cache_MapValue(const VALUE_PTR& valuePtr,
+                   QUEUE_ITERATOR   queueIt,
+                   bool             inWindow);
+    Cache_MapValue(bslmf::MovableRef<VALUE_PTR> valuePtr,
+                   QUEUE_ITERATOR               queueIt,
+                   bool                         inWindow);
+        // Create a 'Cache_MapValue' object holding the specified 'valuePtr'
+        // queued at the specified 'queueIt', in the admission window if the
+        // specified 'inWindow' is 'true', and not referenced.
+
+    Cache_MapValue(const Cache_MapValue& original);
+    Cache_MapValue(bslmf::MovableRef<Cache_MapValue> original);
+        // Create a 'Cache_MapValue' object having the same value as the
+        // specified 'original'.
+
+  private:
+    // NOT IMPLEMENTED
+    Cache_MapValue& operator=(const Cache_MapValue&);
 };
 
 template <class KEY>
@@ -398,7 +560,8 @@ class Cache {
     typedef bsl::list<KEY>                                        QueueType;
         // Eviction queue type.
 
-    typedef bsl::pair<ValuePtrType, typename QueueType::iterator> MapValue;
+    typedef Cache_MapValue<ValuePtrType, typename QueueType::iterator>
+                                                                  MapValue;
         // Value type of the hash map.
 
     typedef bsl::unordered_map<KEY, MapValue, HASH, EQUAL>        MapType;
@@ -422,6 +585,22 @@ class Cache {
                                                        // evicted is at the
                                                        // front of the queue
 
+    typename QueueType::iterator
+                               d_windowBegin;          // first item of the
+                                                       // TinyLFU admission
+                                                       // window, which is the
+                                                       // tail of 'd_queue'
+                                                       // (or 'd_queue.end()')
+
+    bsl::size_t                d_windowSize;           // number of items in
+                                                       // the admission window
+
+    Cache_FrequencySketch      d_sketch;               // TinyLFU access
+                                                       // frequency estimates
+
+    bsl::size_t                d_windowCapacity;       // TinyLFU admission
+                                                       // window size
+
     CacheEvictionPolicy::Enum  d_evictionPolicy;       // eviction policy
 
     bsl::size_t                d_lowWatermark;         // the size of this
@@ -442,15 +621,41 @@ class Cache {
     friend class Cache_TestUtil<KEY, VALUE, HASH, EQUAL>;
 
     // PRIVATE MANIPULATORS
+    typename MapType::iterator clockVictim();
+        // Return an iterator to the first unreferenced item of the main
+        // eviction queue, clearing the referenced bit of, and moving to the
+        // back of the main queue, every referenced item encountered before it.
+        // The behavior is undefined unless the main eviction queue is not
+        // empty.
+
     void enforceHighWatermark();
         // Evict items from this cache if 'size() >= highWatermark()' until
-        // 'size() < lowWatermark()' beginning from the front of the eviction
-        // queue.  Invoke the post-eviction callback for each item evicted.
+        // 'size() < lowWatermark()' in the order defined by the eviction
+        // policy.  Invoke the post-eviction callback for each item evicted.
 
     void evictItem(const typename MapType::iterator& mapIt);
         // Evict the item at the specified 'mapIt' and invoke the post-eviction
         // callback for that item.
 
+    void initialize();
+        // Initialize the policy-specific state of this cache.
+
+    void promoteFromWindow(const typename MapType::iterator& mapIt);
+        // Move the item at the specified 'mapIt' from the front of the TinyLFU
+        // admission window to the back of the main eviction queue.  The
+        // behavior is undefined unless 'mapIt' refers to the first item of the
+        // admission window.
+
+    void recordAccess(const typename MapType::iterator& mapIt);
+        // Record a cache hit on the item at the specified 'mapIt' without
+        // modifying the eviction queue.  This method requires only a read
+        // lock.
+
+    typename MapType::iterator selectVictim();
+        // Return an iterator to the next item to be evicted according to the
+        // eviction policy, updating the eviction queues as necessary.  The
+        // behavior is undefined unless this cache is not empty.
+
     bool insertValuePtrMoveImp(KEY          *key_p,
                                bool          moveKey,
                                ValuePtrType *valuePtr_p,
@@ -591,9 +796,11 @@ class Cache {
         // Load, into the specified 'value', the value associated with the
         // specified 'key' in this cache.  If the optionally specified
         // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
-        // move the cached item to the back of the eviction queue.  Return 0 on
-        // success, and 1 if 'key' does not exist in this cache.  Note that a
-        // write lock is acquired only if this queue is modified.
+        // move the cached item to the back of the eviction queue; if it is
+        // CLOCK or TinyLFU, then mark the cached item as referenced (and, for
+        // TinyLFU, record the access to 'key' even if it is not found).
+        // Return 0 on success, and 1 if 'key' does not exist in this cache.
+        // Note that a write lock is acquired only if this queue is modified.
 
     // ACCESSORS
     EQUAL equalFunction() const;
@@ -624,7 +831,9 @@ class Cache {
         // Call the specified 'visitor' for every item stored in this cache in
         // the order of the eviction queue until 'visitor' returns 'false'.
         // The 'VISITOR' type must be a callable object that can be invoked in
-        // the same way as the function 'bool (const KEY&, const VALUE&)'
+        // the same way as the function 'bool (const KEY&, const VALUE&)'.
+        // Note that, for the TinyLFU policy, the items of the main queue are
+        // visited before those of the admission window.
 };
 
 template <class KEY,
@@ -704,6 +913,61 @@ void Cache_QueueProctor<KEY>::release()
     d_queue_p = 0;
 }
 
+                          // ---------------------
+                          // struct Cache_MapValue
+                          // ---------------------
+
+// CREATORS
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                              const VALUE_PTR& valuePtr,
+                                              QUEUE_ITERATOR   queueIt,
+                                              bool             inWindow)
+: d_valuePtr(valuePtr)
+, d_queueIt(queueIt)
+, d_referenced(false)
+, d_inWindow(inWindow)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                  bslmf::MovableRef<VALUE_PTR> valuePtr,
+                                  QUEUE_ITERATOR               queueIt,
+                                  bool                         inWindow)
+: d_valuePtr(bslmf::MovableRefUtil::move(valuePtr))
+, d_queueIt(queueIt)
+, d_referenced(false)
+, d_inWindow(inWindow)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                                const Cache_MapValue& original)
+: d_valuePtr(original.d_valuePtr)
+, d_queueIt(original.d_queueIt)
+, d_referenced(original.d_referenced.loadRelaxed())
+, d_inWindow(original.d_inWindow)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                    bslmf::MovableRef<Cache_MapValue> original)
+: d_valuePtr(bslmf::MovableRefUtil::move(
+                      bslmf::MovableRefUtil::access(original).d_valuePtr))
+, d_queueIt(bslmf::MovableRefUtil::access(original).d_queueIt)
+, d_referenced(
+            bslmf::MovableRefUtil::access(original).d_referenced.loadRelaxed())
+, d_inWindow(bslmf::MovableRefUtil::access(original).d_inWindow)
+{
+}
+
                         // -----------
                         // class Cache
                         // -----------
@@ -714,6 +978,10 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(bslma::Allocator *basicAllocator)
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(d_allocator_p)
 , d_queue(d_allocator_p)
+, d_windowBegin(d_queue.end())
+, d_windowSize(0)
+, d_sketch(d_allocator_p)
+, d_windowCapacity(0)
 , d_evictionPolicy(CacheEvictionPolicy::e_LRU)
 , d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
 , d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
@@ -730,6 +998,10 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(d_allocator_p)
 , d_queue(d_allocator_p)
+, d_windowBegin(d_queue.end())
+, d_windowSize(0)
+, d_sketch(d_allocator_p)
+, d_windowCapacity(0)
 , d_evictionPolicy(evictionPolicy)
 , d_lowWatermark(lowWatermark)
 , d_highWatermark(highWatermark)
@@ -738,6 +1010,8 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
     BSLS_REVIEW(lowWatermark <= highWatermark);
     BSLS_REVIEW(1 <= lowWatermark);
     BSLS_REVIEW(1 <= highWatermark);
+
+    initialize();
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -751,6 +1025,10 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(0, hashFunction, equalFunction, d_allocator_p)
 , d_queue(d_allocator_p)
+, d_windowBegin(d_queue.end())
+, d_windowSize(0)
+, d_sketch(d_allocator_p)
+, d_windowCapacity(0)
 , d_evictionPolicy(evictionPolicy)
 , d_lowWatermark(lowWatermark)
 , d_highWatermark(highWatermark)
@@ -759,9 +1037,32 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
     BSLS_REVIEW(lowWatermark <= highWatermark);
     BSLS_REVIEW(1 <= lowWatermark);
     BSLS_REVIEW(1 <= highWatermark);
+
+    initialize();
 }
 
 // PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename Cache<KEY, VALUE, HASH, EQUAL>::MapType::iterator
+Cache<KEY, VALUE, HASH, EQUAL>::clockVictim()
+{
+    BSLS_ASSERT(d_queue.begin() != d_windowBegin);
+
+    // Every referenced item is given a second chance, so at most one pass
+    // over the main queue clears all the bits and an item is always found.
+
+    while (true) {
+        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
+        BSLS_ASSERT(mapIt != d_map.end());
+
+        if (!mapIt->second.d_referenced.loadRelaxed()) {
+            return mapIt;                                             // RETURN
+        }
+        mapIt->second.d_referenced.storeRelaxed(false);
+        d_queue.splice(d_windowBegin, d_queue, d_queue.begin());
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
 {
@@ -770,9 +1071,7 @@ void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
     }
 
     while (d_map.size() >= d_lowWatermark && d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(selectVictim());
     }
 }
 
@@ -780,15 +1079,105 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::evictItem(
                                        const typename MapType::iterator& mapIt)
 {
-    ValuePtrType value = mapIt->second.first;
+    ValuePtrType value = mapIt->second.d_valuePtr;
 
-    d_queue.erase(mapIt->second.second);
+    if (mapIt->second.d_inWindow) {
+        if (d_windowBegin == mapIt->second.d_queueIt) {
+            ++d_windowBegin;
+        }
+        --d_windowSize;
+    }
+    d_queue.erase(mapIt->second.d_queueIt);
     d_map.erase(mapIt);
 
     if (d_postEvictionCallback) {
         d_postEvictionCallback(value);
     }
 }
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void Cache<KEY, VALUE, HASH, EQUAL>::initialize()
+{
+    if (CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+        d_windowCapacity = d_highWatermark / 100;
+        if (0 == d_windowCapacity) {
+            d_windowCapacity = 1;
+        }
+        d_sketch.initialize(d_highWatermark);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void Cache<KEY, VALUE, HASH, EQUAL>::promoteFromWindow(
+                                       const typename MapType::iterator& mapIt)
+{
+    BSLS_ASSERT(mapIt->second.d_inWindow);
+    BSLS_ASSERT(mapIt->second.d_queueIt == d_windowBegin);
+
+    ++d_windowBegin;
+    --d_windowSize;
+    mapIt->second.d_inWindow = false;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void Cache<KEY, VALUE, HASH, EQUAL>::recordAccess(
+                                       const typename MapType::iterator& mapIt)
+{
+    // Avoid writing to the cache line of an item that is already marked.
+
+    if (!mapIt->second.d_referenced.loadRelaxed()) {
+        mapIt->second.d_referenced.storeRelaxed(true);
+    }
+    if (CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+        d_sketch.increment(d_map.hash_function()(mapIt->first));
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename Cache<KEY, VALUE, HASH, EQUAL>::MapType::iterator
+Cache<KEY, VALUE, HASH, EQUAL>::selectVictim()
+{
+    BSLS_ASSERT(!d_map.empty());
+
+    switch (d_evictionPolicy) {
+      case CacheEvictionPolicy::e_CLOCK: {
+        return clockVictim();                                         // RETURN
+      }
+      case CacheEvictionPolicy::e_TINYLFU: {
+        if (d_queue.end() == d_windowBegin) {
+            return clockVictim();                                     // RETURN
+        }
+
+        const typename MapType::iterator candidate =
+                                                    d_map.find(*d_windowBegin);
+        BSLS_ASSERT(candidate != d_map.end());
+
+        if (d_queue.begin() == d_windowBegin) {
+            return candidate;                                         // RETURN
+        }
+
+        // Admit the candidate to the main queue only if it is accessed more
+        // frequently than the item it would replace.
+
+        const typename MapType::iterator victim = clockVictim();
+        const HASH                       hasher = d_map.hash_function();
+
+        if (d_sketch.frequency(hasher(candidate->first)) >
+                                   d_sketch.frequency(hasher(victim->first))) {
+            promoteFromWindow(candidate);
+            return victim;                                            // RETURN
+        }
+        return candidate;                                             // RETURN
+      }
+      default: {
+        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
+        BSLS_ASSERT(mapIt != d_map.end());
+        return mapIt;                                                 // RETURN
+      }
+    }
+}
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
@@ -811,13 +1200,19 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt != d_map.end()) {
         if (k_RVALUE_ASSIGN && moveValuePtr) {
-            mapIt->second.first = bslmf::MovableRefUtil::move(valuePtr);
+            mapIt->second.d_valuePtr = bslmf::MovableRefUtil::move(valuePtr);
         }
         else {
-            mapIt->second.first = valuePtr;
+            mapIt->second.d_valuePtr = valuePtr;
+        }
+
+        if (CacheEvictionPolicy::e_CLOCK   == d_evictionPolicy ||
+            CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+            recordAccess(mapIt);
+            return false;                                             // RETURN
         }
 
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
 
         // Move 'queueIt' to the back of 'd_queue'.
 
@@ -826,6 +1221,13 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
         return false;                                                 // RETURN
     }
     else {
+        const bool inWindow = CacheEvictionPolicy::e_TINYLFU ==
+                                                              d_evictionPolicy;
+
+        if (inWindow) {
+            d_sketch.increment(d_map.hash_function()(key));
+        }
+
         Cache_QueueProctor<KEY>      proctor(&d_queue);
         d_queue.push_back(key);
         typename QueueType::iterator queueIt = d_queue.end();
@@ -837,12 +1239,12 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
         if (moveValuePtr) {
             new (mapValue_p) MapValue(bslmf::MovableRefUtil::move(valuePtr),
                                       queueIt,
-                                      d_allocator_p);
+                                      inWindow);
         }
         else {
             new (mapValue_p) MapValue(valuePtr,
                                       queueIt,
-                                      d_allocator_p);
+                                      inWindow);
         }
         bslma::DestructorGuard<MapValue> mapValueGuard(mapValue_p);
 
@@ -857,6 +1259,21 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
 
         proctor.release();
 
+        if (inWindow) {
+            if (d_queue.end() == d_windowBegin) {
+                d_windowBegin = queueIt;
+            }
+            ++d_windowSize;
+
+            // While the cache is not full, items overflowing the admission
+            // window enter the main queue without competing for a place.
+
+            if (d_windowSize > d_windowCapacity
+             && d_map.size() < d_highWatermark) {
+                promoteFromWindow(d_map.find(*d_windowBegin));
+            }
+        }
+
         return true;                                                  // RETURN
     }
 }
@@ -909,6 +1326,8 @@ void Cache<KEY, VALUE, HASH, EQUAL>::clear()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
     d_map.clear();
     d_queue.clear();
+    d_windowBegin = d_queue.end();
+    d_windowSize  = 0;
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -1072,9 +1491,7 @@ int Cache<KEY, VALUE, HASH, EQUAL>::popFront()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
 
     if (d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(selectVictim());
         return 0;                                                     // RETURN
     }
 
@@ -1112,19 +1529,28 @@ int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
 
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt == d_map.end()) {
+        if (modifyEvictionQueue
+         && CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+            d_sketch.increment(d_map.hash_function()(key));
+        }
         return 1;                                                     // RETURN
     }
 
-    *value = mapIt->second.first;
+    *value = mapIt->second.d_valuePtr;
 
     if (writeLock) {
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
         typename QueueType::iterator last = d_queue.end();
         --last;
         if (last != queueIt) {
             d_queue.splice(d_queue.end(), d_queue, queueIt);
         }
     }
+    else if (modifyEvictionQueue
+          && (CacheEvictionPolicy::e_CLOCK   == d_evictionPolicy ||
+              CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy)) {
+        recordAccess(mapIt);
+    }
 
     return 0;
 }
@@ -1186,7 +1612,7 @@ void Cache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
         const KEY&                             key = *queueIt;
         const typename MapType::const_iterator mapIt = d_map.find(key);
         BSLS_ASSERT(mapIt != d_map.end());
-        const ValuePtrType& valuePtr = mapIt->second.first;
+        const ValuePtrType& valuePtr = mapIt->second.d_valuePtr;
 
         if (!visitor(key, *valuePtr)) {
             break;
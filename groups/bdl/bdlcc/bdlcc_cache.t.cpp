@@ -35,6 +35,7 @@
 #include <bsls_timeutil.h>  // 'CachePerformance'
 #include <bsls_types.h>     // 'BloombergLP::bsls::Types::Int64'
 
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_vector.h>
 #include <bsl_string.h>
@@ -128,11 +129,15 @@ using namespace bsl;
 // [15] THREAD SAFETY
 // [16] LOCKING TEST UTIL
 // [17] LOCKING
-// [18] USAGE EXAMPLE
+// [18] REPRODUCE DRQS 134930805
+// [19] Cache_FrequencySketch
+// [20] CLOCK AND TINYLFU EVICTION POLICIES
+// [21] USAGE EXAMPLE
 // [-1] INSERT PERFORMANCE
 // [-2] INSERT BULK PERFORMANCE
 // [-3] READ PERFORMANCE
 // [-4] READ WRITE PERFORMANCE
+// [-5] HIT RATIO
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -533,6 +538,20 @@ void InplaceUtil<VALUE>::SpCreateInplace(bsl::shared_ptr<VALUE> *ptr,
 }  // close unnamed namespace
 
 namespace cacheperf {
+
+bdlcc::CacheEvictionPolicy::Enum parsePolicy(const char *arg)
+    // Return the eviction policy designated by the first character of the
+    // specified 'arg': 'F' for FIFO, 'C' for CLOCK, 'T' for TinyLFU, and LRU
+    // otherwise.
+{
+    switch (arg[0]) {
+      case 'F': return bdlcc::CacheEvictionPolicy::e_FIFO;            // RETURN
+      case 'C': return bdlcc::CacheEvictionPolicy::e_CLOCK;           // RETURN
+      case 'T': return bdlcc::CacheEvictionPolicy::e_TINYLFU;         // RETURN
+      default:  return bdlcc::CacheEvictionPolicy::e_LRU;             // RETURN
+    }
+}
+
 class CachePerformance {
     // This class performs the various performance tests.
 
@@ -1746,6 +1765,474 @@ void threadedTest1()
 
 }  // close namespace threaded
 
+namespace approximateLru {
+
+typedef bdlcc::Cache<int, int> CacheType;
+
+class CountingCallback {
+    // This class provides a post-eviction callback that counts the items
+    // evicted from a cache.
+
+    // DATA
+    int *d_count_p;  // number of evictions (held, not owned)
+
+  public:
+    // CREATORS
+    explicit CountingCallback(int *count)
+        // Create a callback that increments the specified 'count' each time
+        // it is invoked.
+    : d_count_p(count)
+    {
+    }
+
+    // ACCESSORS
+    void operator()(const CacheType::ValuePtrType&) const
+        // Increment the eviction count.
+    {
+        ++*d_count_p;
+    }
+};
+
+class KeyRecorder {
+    // This class provides a visitor that records the keys of the visited
+    // items.
+
+    // DATA
+    bsl::vector<int> *d_keys_p;  // visited keys (held, not owned)
+
+  public:
+    // CREATORS
+    explicit KeyRecorder(bsl::vector<int> *keys)
+        // Create a visitor that appends the visited keys to the specified
+        // 'keys'.
+    : d_keys_p(keys)
+    {
+    }
+
+    // MANIPULATORS
+    bool operator()(const int& key, const int&)
+        // Record the specified 'key' and return 'true'.
+    {
+        d_keys_p->push_back(key);
+        return true;
+    }
+};
+
+class ZipfGenerator {
+    // This class generates integer keys in the range '[0, numKeys)' whose
+    // popularity follows a Zipf distribution with skew 1, i.e., the key 'k'
+    // is drawn with a probability proportional to '1 / (k + 1)'.
+
+    // DATA
+    bsl::vector<double> d_cdf;    // cumulative distribution
+    bsls::Types::Uint64 d_state;  // state of the pseudo-random generator
+
+  public:
+    // CREATORS
+    ZipfGenerator(int               numKeys,
+                  bsls::Types::Uint64 seed,
+                  bslma::Allocator *basicAllocator = 0)
+        // Create a generator of keys in the range '[0, numKeys)' seeded with
+        // the specified 'seed'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.
+    : d_cdf(basicAllocator)
+    , d_state(seed | 1)
+    {
+        d_cdf.reserve(numKeys);
+        double sum = 0;
+        for (int i = 0; i < numKeys; ++i) {
+            sum += 1.0 / (i + 1);
+            d_cdf.push_back(sum);
+        }
+        for (int i = 0; i < numKeys; ++i) {
+            d_cdf[i] /= sum;
+        }
+    }
+
+    // MANIPULATORS
+    int next()
+        // Return the next key.
+    {
+        // xorshift64*
+
+        d_state ^= d_state >> 12;
+        d_state ^= d_state << 25;
+        d_state ^= d_state >> 27;
+        const double u = static_cast<double>(
+                              (d_state * 2685821657736338717ULL) >> 11) /
+                                             static_cast<double>(1ULL << 53);
+        return static_cast<int>(
+                  bsl::lower_bound(d_cdf.begin(), d_cdf.end(), u) -
+                                                              d_cdf.begin());
+    }
+};
+
+double hitRatio(bdlcc::CacheEvictionPolicy::Enum  policy,
+                bsl::size_t                       capacity,
+                const bsl::vector<int>&           trace,
+                bslma::Allocator                 *basicAllocator)
+    // Return the ratio of hits when looking up, and inserting on a miss, each
+    // of the keys in the specified 'trace', in order, in a cache having the
+    // specified eviction 'policy' and 'capacity'.  Use the specified
+    // 'basicAllocator' to supply memory.
+{
+    CacheType cache(policy, capacity, capacity, basicAllocator);
+
+    bsl::size_t numHits = 0;
+    for (bsl::size_t i = 0; i < trace.size(); ++i) {
+        CacheType::ValuePtrType value;
+        if (0 == cache.tryGetValue(&value, trace[i])) {
+            ++numHits;
+        }
+        else {
+            cache.insert(trace[i], trace[i]);
+        }
+    }
+    return static_cast<double>(numHits) / static_cast<double>(trace.size());
+}
+
+void testFrequencySketch()
+{
+    // ------------------------------------------------------------------------
+    // 'Cache_FrequencySketch'
+    //
+    // Concerns:
+    //: 1 A default-constructed sketch allocates no memory, estimates every
+    //:   frequency as 0, and ignores increments.
+    //:
+    //: 2 'initialize' sizes the sketch as a power of 2 providing at least 4
+    //:   counters per item of the specified capacity, and allocates the
+    //:   counters from the supplied allocator.
+    //:
+    //: 3 'frequency' returns the number of calls to 'increment' for a hash
+    //:   value, saturating at 'k_MAX_FREQUENCY'.
+    //:
+    //: 4 'halve' divides every counter by 2.
+    //:
+    //: 5 Once 'sampleSize' increments are recorded, the counters are halved.
+    //:
+    //: 6 All memory is released on destruction.
+    //
+    // Plan:
+    //: 1 Create a sketch, verify its frequency estimates, and verify no memory
+    //:   is allocated.  (C-1)
+    //:
+    //: 2 Initialize the sketch for capacities of various sizes and verify the
+    //:   number of counters and the memory allocated.  (C-2)
+    //:
+    //: 3 Increment the counters associated with a few hash values, verify
+    //:   the frequency estimates, halve the counters, and verify the
+    //:   estimates again.  (C-3..4)
+    //:
+    //: 4 Increment the counters of a hash value 'sampleSize' times and
+    //:   verify the estimate is halved.  (C-5)
+    //:
+    //: 5 Verify all memory is released on destruction.  (C-6)
+    //
+    // Testing:
+    //   Cache_FrequencySketch
+    // ------------------------------------------------------------------------
+
+    typedef bdlcc::Cache_FrequencySketch Sketch;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    {
+        Sketch mX(&oa);  const Sketch& X = mX;
+
+        ASSERTV(0 == X.frequency(0));
+        mX.increment(0);
+        ASSERTV(0 == X.frequency(0));
+        ASSERTV(0 == X.numCounters());
+        ASSERTV(0 == oa.numBlocksTotal());
+
+        static const struct {
+            int         d_line;         // source line number
+            bsl::size_t d_capacity;     // capacity
+            bsl::size_t d_numCounters;  // expected number of counters
+        } DATA[] = {
+            //LINE  CAPACITY  NUM COUNTERS
+            //----  --------  ------------
+            { L_,          0,           16 },
+            { L_,          1,           16 },
+            { L_,          4,           16 },
+            { L_,          5,           32 },
+            { L_,        100,          512 },
+            { L_,       1024,         4096 },
+            { L_,  100000000,    1 << 22   },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE         = DATA[ti].d_line;
+            const bsl::size_t CAPACITY     = DATA[ti].d_capacity;
+            const bsl::size_t NUM_COUNTERS = DATA[ti].d_numCounters;
+
+            mX.initialize(CAPACITY);
+
+            ASSERTV(LINE, X.numCounters(), NUM_COUNTERS == X.numCounters());
+            ASSERTV(LINE, X.sampleSize(),
+                    NUM_COUNTERS / 4 * 10 == X.sampleSize());
+            ASSERTV(LINE, 1 == oa.numBlocksInUse());
+            ASSERTV(LINE, static_cast<bsls::Types::Int64>(NUM_COUNTERS / 2) ==
+                                                     oa.numBytesInUse());
+            ASSERTV(LINE, 0 == X.frequency(7));
+        }
+
+        mX.initialize(100);
+
+        for (int i = 0; i < 5; ++i) {
+            mX.increment(1);
+        }
+        for (int i = 0; i < 20; ++i) {
+            mX.increment(2);
+        }
+        mX.increment(3);
+
+        ASSERTV(X.frequency(1), 5 == X.frequency(1));
+        ASSERTV(X.frequency(2), Sketch::k_MAX_FREQUENCY == X.frequency(2));
+        ASSERTV(X.frequency(3), 1 == X.frequency(3));
+        ASSERTV(X.frequency(4), 0 == X.frequency(4));
+
+        mX.halve();
+
+        ASSERTV(X.frequency(1), 2 == X.frequency(1));
+        ASSERTV(X.frequency(2), 7 == X.frequency(2));
+        ASSERTV(X.frequency(3), 0 == X.frequency(3));
+
+        mX.initialize(4);
+
+        const int SAMPLE_SIZE = static_cast<int>(X.sampleSize());
+        for (int i = 0; i < SAMPLE_SIZE - 1; ++i) {
+            mX.increment(9);
+        }
+        ASSERTV(X.frequency(9), Sketch::k_MAX_FREQUENCY == X.frequency(9));
+
+        mX.increment(9);
+        ASSERTV(X.frequency(9), 7 == X.frequency(9));
+    }
+
+    ASSERTV(0 == oa.numBlocksInUse());
+}
+
+void testApproximatePolicies()
+{
+    // ------------------------------------------------------------------------
+    // CLOCK AND TINYLFU EVICTION POLICIES
+    //
+    // Concerns:
+    //: 1 For CLOCK, an item accessed by 'tryGetValue' with
+    //:   'modifyEvictionQueue' set to 'true' is given a second chance, and is
+    //:   not evicted before unreferenced items inserted after it.
+    //:
+    //: 2 For CLOCK, 'tryGetValue' with 'modifyEvictionQueue' set to 'false'
+    //:   does not modify the eviction order.
+    //:
+    //: 3 For CLOCK and TinyLFU, 'tryGetValue' acquires only a read lock, even
+    //:   when 'modifyEvictionQueue' is 'true'.
+    //:
+    //: 4 For TinyLFU, items are inserted in the admission window and are
+    //:   promoted to the main queue while the cache is not full; 'erase',
+    //:   'clear', and 'visit' account for both parts of the queue.
+    //:
+    //: 5 For TinyLFU, a scan of items accessed once does not flush a set of
+    //:   frequently accessed items from the cache, whereas it does for LRU.
+    //:
+    //: 6 The post-eviction callback is invoked for every evicted item.
+    //
+    // Plan:
+    //: 1 Insert items into a CLOCK cache, access some of them, insert more
+    //:   items to trigger eviction, and verify which items remain.  (C-1..2)
+    //:
+    //: 2 Acquire a read lock on a cache through 'Cache_TestUtil' and call
+    //:   'tryGetValue' on the same thread: a write lock would deadlock.  (C-3)
+    //:
+    //: 3 Insert, erase, and clear items of a TinyLFU cache, and verify the
+    //:   contents using 'visit'.  (C-4)
+    //:
+    //: 4 Access a set of hot items of a TinyLFU and a LRU cache several times,
+    //:   then insert a sequence of distinct cold items, and verify the number
+    //:   of hot items remaining and of evictions.  (C-5..6)
+    //
+    // Testing:
+    //   CLOCK AND TINYLFU EVICTION POLICIES
+    // ------------------------------------------------------------------------
+
+    typedef bdlcc::CacheEvictionPolicy Policy;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    if (verbose) cout << "\nCLOCK second chance." << endl;
+    {
+        CacheType mX(Policy::e_CLOCK, 3, 3, &oa);  const CacheType& X = mX;
+        ASSERTV(Policy::e_CLOCK == X.evictionPolicy());
+
+        mX.insert(1, 1);
+        mX.insert(2, 2);
+        mX.insert(3, 3);
+
+        CacheType::ValuePtrType value;
+        ASSERTV(0 == mX.tryGetValue(&value, 1));
+        ASSERTV(0 == mX.tryGetValue(&value, 2, false));
+
+        mX.insert(4, 4);  // evicts 2: 1 is referenced
+
+        ASSERTV(3 == X.size());
+        ASSERTV(0 == mX.tryGetValue(&value, 1, false));
+        ASSERTV(0 != mX.tryGetValue(&value, 2, false));
+        ASSERTV(0 == mX.tryGetValue(&value, 3, false));
+        ASSERTV(0 == mX.tryGetValue(&value, 4, false));
+
+        mX.insert(5, 5);  // evicts 3
+        ASSERTV(0 == mX.tryGetValue(&value, 1, false));
+        ASSERTV(0 != mX.tryGetValue(&value, 3, false));
+
+        mX.insert(6, 6);  // evicts 1: its reference bit was cleared
+        ASSERTV(0 != mX.tryGetValue(&value, 1, false));
+        ASSERTV(0 == mX.tryGetValue(&value, 4, false));
+
+        ASSERTV(0 == mX.popFront());  // evicts 4
+        ASSERTV(0 != mX.tryGetValue(&value, 4, false));
+        ASSERTV(0 == mX.tryGetValue(&value, 5, false));
+        ASSERTV(2 == X.size());
+    }
+
+    if (verbose) cout << "\nHits under a read lock." << endl;
+    {
+        const Policy::Enum POLICIES[] = { Policy::e_CLOCK,
+                                          Policy::e_TINYLFU };
+        const int          NUM_POLICIES = static_cast<int>(
+                                         sizeof POLICIES / sizeof *POLICIES);
+
+        for (int tp = 0; tp < NUM_POLICIES; ++tp) {
+            CacheType mX(POLICIES[tp], 10, 10, &oa);
+            mX.insert(1, 1);
+
+            bdlcc::Cache_TestUtil<int, int> util(mX);
+            util.lockRead();
+
+            CacheType::ValuePtrType value;
+            ASSERTV(tp, 0 == mX.tryGetValue(&value, 1));
+            ASSERTV(tp, 1 == *value);
+            ASSERTV(tp, 0 != mX.tryGetValue(&value, 2));
+
+            util.unlock();
+        }
+    }
+
+    if (verbose) cout << "\nTinyLFU admission window." << endl;
+    {
+        CacheType mX(Policy::e_TINYLFU, 10, 10, &oa);
+        const CacheType& X = mX;
+        ASSERTV(Policy::e_TINYLFU == X.evictionPolicy());
+
+        mX.insert(1, 1);
+        mX.insert(2, 2);
+        mX.insert(3, 3);
+        ASSERTV(0 == mX.erase(3));  // front of the window
+        mX.insert(4, 4);
+        ASSERTV(0 == mX.erase(1));  // front of the main queue
+
+        {
+            const int EXPECTED[] = { 2, 4 };
+
+            bsl::vector<int> keys(&oa);
+            KeyRecorder      visitor(&keys);
+            X.visit(visitor);
+            ASSERTV(keys.size(), 2 == keys.size());
+            ASSERTV(bsl::equal(keys.begin(), keys.end(), EXPECTED));
+        }
+
+        mX.clear();
+        ASSERTV(0 == X.size());
+
+        mX.insert(5, 5);
+        mX.insert(6, 6);
+        {
+            const int EXPECTED[] = { 5, 6 };
+
+            bsl::vector<int> keys(&oa);
+            KeyRecorder      visitor(&keys);
+            X.visit(visitor);
+            ASSERTV(keys.size(), 2 == keys.size());
+            ASSERTV(bsl::equal(keys.begin(), keys.end(), EXPECTED));
+        }
+
+        ASSERTV(0 == mX.popFront());
+        ASSERTV(0 == mX.popFront());
+        ASSERTV(0 != mX.popFront());
+    }
+
+    if (verbose) cout << "\nScan resistance." << endl;
+    {
+        const int k_CAPACITY   = 100;
+        const int k_NUM_HOT    = 90;
+        const int k_NUM_ROUNDS = 20;
+        const int k_SCAN_SIZE  = 50;
+
+        const Policy::Enum POLICIES[] = { Policy::e_TINYLFU, Policy::e_LRU };
+        const int          NUM_POLICIES = static_cast<int>(
+                                         sizeof POLICIES / sizeof *POLICIES);
+
+        for (int tp = 0; tp < NUM_POLICIES; ++tp) {
+            const Policy::Enum POLICY = POLICIES[tp];
+
+            int              numEvicted = 0;
+            CacheType        mX(POLICY, k_CAPACITY, k_CAPACITY, &oa);
+            const CacheType& X = mX;
+
+            CacheType::PostEvictionCallback callback(
+                                                bsl::allocator_arg,
+                                                &oa,
+                                                CountingCallback(&numEvicted));
+            mX.setPostEvictionCallback(callback);
+
+            // Each round accesses every hot item, then scans items never seen
+            // before.  The reuse distance of the hot items exceeds the
+            // capacity, which defeats LRU.
+
+            int numInserted = 0;
+            int numHotHits  = 0;
+            int nextScanKey = k_NUM_HOT;
+            for (int r = 0; r < k_NUM_ROUNDS; ++r) {
+                numHotHits = 0;
+
+                CacheType::ValuePtrType value;
+                for (int i = 0; i < k_NUM_HOT; ++i) {
+                    if (0 == mX.tryGetValue(&value, i)) {
+                        ++numHotHits;
+                    }
+                    else {
+                        mX.insert(i, i);
+                        ++numInserted;
+                    }
+                }
+                for (int i = 0; i < k_SCAN_SIZE; ++i, ++nextScanKey) {
+                    ASSERTV(0 != mX.tryGetValue(&value, nextScanKey));
+                    mX.insert(nextScanKey, nextScanKey);
+                    ++numInserted;
+                }
+            }
+
+            if (veryVerbose) { P_(POLICY) P_(numHotHits) P(numEvicted) }
+
+            ASSERTV(POLICY, k_CAPACITY == X.size());
+            ASSERTV(POLICY, numInserted, numEvicted,
+                    numInserted - k_CAPACITY == numEvicted);
+            if (Policy::e_TINYLFU == POLICY) {
+                ASSERTV(numHotHits, k_NUM_HOT == numHotHits);
+            }
+            else {
+                ASSERTV(numHotHits, 0 == numHotHits);
+            }
+        }
+    }
+
+    ASSERTV(0 == oa.numBlocksInUse());
+}
+
+}  // close namespace approximateLru
+
 // TestDriver template
 namespace {
 
@@ -2463,7 +2950,9 @@ void TestDriver<KEYTYPE, VALUETYPE, HASH, EQUAL>::testCase11()
 
     const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
         bdlcc::CacheEvictionPolicy::e_LRU,
-        bdlcc::CacheEvictionPolicy::e_FIFO
+        bdlcc::CacheEvictionPolicy::e_FIFO,
+        bdlcc::CacheEvictionPolicy::e_CLOCK,
+        bdlcc::CacheEvictionPolicy::e_TINYLFU
     };
 
     const int NUM_POLICIES = sizeof(POLICIES) / sizeof(*POLICIES);
@@ -2525,7 +3014,9 @@ void TestDriver<KEYTYPE, VALUETYPE, HASH, EQUAL>::testCase10()
 
     const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
         bdlcc::CacheEvictionPolicy::e_LRU,
-        bdlcc::CacheEvictionPolicy::e_FIFO
+        bdlcc::CacheEvictionPolicy::e_FIFO,
+        bdlcc::CacheEvictionPolicy::e_CLOCK,
+        bdlcc::CacheEvictionPolicy::e_TINYLFU
     };
 
     const int NUM_POLICIES = sizeof(POLICIES) / sizeof(*POLICIES);
@@ -2582,7 +3073,8 @@ void TestDriver<KEYTYPE, VALUETYPE, HASH, EQUAL>::testCase9()
 
     const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
         bdlcc::CacheEvictionPolicy::e_LRU,
-        bdlcc::CacheEvictionPolicy::e_FIFO
+        bdlcc::CacheEvictionPolicy::e_FIFO,
+        bdlcc::CacheEvictionPolicy::e_CLOCK
     };
 
     const int NUM_POLICIES = sizeof(POLICIES) / sizeof(*POLICIES);
@@ -2671,7 +3163,9 @@ void TestDriver<KEYTYPE, VALUETYPE, HASH, EQUAL>::testCase8()
 
     const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
         bdlcc::CacheEvictionPolicy::e_LRU,
-        bdlcc::CacheEvictionPolicy::e_FIFO
+        bdlcc::CacheEvictionPolicy::e_FIFO,
+        bdlcc::CacheEvictionPolicy::e_CLOCK,
+        bdlcc::CacheEvictionPolicy::e_TINYLFU
     };
 
     const int NUM_POLICIES = sizeof(POLICIES) / sizeof(*POLICIES);
@@ -2744,7 +3238,9 @@ void TestDriver<KEYTYPE, VALUETYPE, HASH, EQUAL>::testCase7()
 
     const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
         bdlcc::CacheEvictionPolicy::e_LRU,
-        bdlcc::CacheEvictionPolicy::e_FIFO
+        bdlcc::CacheEvictionPolicy::e_FIFO,
+        bdlcc::CacheEvictionPolicy::e_CLOCK,
+        bdlcc::CacheEvictionPolicy::e_TINYLFU
     };
 
     const int NUM_POLICIES = sizeof(POLICIES) / sizeof(*POLICIES);
@@ -2865,7 +3361,9 @@ void TestDriver<KEYTYPE, VALUETYPE, HASH, EQUAL>::testCase6()
 
     const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
         bdlcc::CacheEvictionPolicy::e_LRU,
-        bdlcc::CacheEvictionPolicy::e_FIFO
+        bdlcc::CacheEvictionPolicy::e_FIFO,
+        bdlcc::CacheEvictionPolicy::e_CLOCK,
+        bdlcc::CacheEvictionPolicy::e_TINYLFU
     };
 
     const int NUM_POLICIES = sizeof(POLICIES) / sizeof(*POLICIES);
@@ -2979,12 +3477,15 @@ void TestDriver<KEYTYPE, VALUETYPE, HASH, EQUAL>::testCase5()
     //:   elements least-recently accessed evicted first.  If no elements has
     //:   been accessed, this policy is equivalent to FIFO.
     //:
-    //: 5 'tryGetValue' only changes the eviction order if its argument
+    //: 5 For CLOCK, if no elements has been accessed, the policy is
+    //:   equivalent to FIFO.
+    //:
+    //: 6 'tryGetValue' only changes the eviction order if its argument
     //:   'modifyEvictionQueue' is true, which is the default value.
     //
     // Plan:
     //: 1 Use the loop-based approach to test 'insert' without any item access
-    //:   for objects with LRU or FIFO eviction policies.
+    //:   for objects with LRU, FIFO, or CLOCK eviction policies.  (C-3..5)
     //:
     //: 2 Using the loop-based approach, make sure that calling 'tryGetValue'
     //:   for a FIFO cache, or calling 'tryGetValue' with 'modifyEvictionQueue'
@@ -3003,11 +3504,12 @@ void TestDriver<KEYTYPE, VALUETYPE, HASH, EQUAL>::testCase5()
     const bsl::size_t    MAX_LENGTH = 9;
     bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
 
-    // Testing FIFO and LRU without any item access.
+    // Testing FIFO, LRU, and CLOCK without any item access.
     {
         const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
             bdlcc::CacheEvictionPolicy::e_LRU,
-            bdlcc::CacheEvictionPolicy::e_FIFO
+            bdlcc::CacheEvictionPolicy::e_FIFO,
+            bdlcc::CacheEvictionPolicy::e_CLOCK
         };
 
         const int NUM_POLICIES = sizeof(POLICIES) / sizeof(*POLICIES);
@@ -3416,7 +3918,9 @@ void TestDriver<KEYTYPE, VALUETYPE, HASH, EQUAL>::testCase4()
 
     const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
         bdlcc::CacheEvictionPolicy::e_LRU,
-        bdlcc::CacheEvictionPolicy::e_FIFO
+        bdlcc::CacheEvictionPolicy::e_FIFO,
+        bdlcc::CacheEvictionPolicy::e_CLOCK,
+        bdlcc::CacheEvictionPolicy::e_TINYLFU
     };
 
     const int NUM_POLICIES = sizeof(POLICIES) / sizeof(*POLICIES);
@@ -4163,7 +4667,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 19: {
+      case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -4184,6 +4688,12 @@ int main(int argc, char *argv[])
         usageExample1::example1();
         usageExample2::example2();
       } break;
+      case 20: {
+        approximateLru::testApproximatePolicies();
+      } break;
+      case 19: {
+        approximateLru::testFrequencySketch();
+      } break;
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
       case 18: {
         // --------------------------------------------------------------------
@@ -4273,7 +4783,8 @@ int main(int argc, char *argv[])
         //   control over the test, command line parameters are used.
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to insert.
-        //   4th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   4th parameter: eviction policy: F for FIFO, C for CLOCK, T for
+        //   TinyLFU; LRU otherwise.
         //
         // Concerns:
         //: 1 Calculates wall time, user time, and system time for inserting
@@ -4293,9 +4804,7 @@ int main(int argc, char *argv[])
         int numCalcs   = argc > 3 ? atoi(argv[3]) : 200000;
 
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
-            (argc > 4 && argv[4][0] == 'F' ?
-            bdlcc::CacheEvictionPolicy::e_FIFO :
-            bdlcc::CacheEvictionPolicy::e_LRU);
+                            cacheperf::parsePolicy(argc > 4 ? argv[4] : "L");
 
         cacheperf::CachePerformance cp("testInsert1", evictionPolicy,
                 1e7, 2e7, 0, numThreads, numCalcs, 10, &talloc);
@@ -4312,7 +4821,8 @@ int main(int argc, char *argv[])
         //   control over the test, command line parameters are used.
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to insert.
-        //   4th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   4th parameter: eviction policy: F for FIFO, C for CLOCK, T for
+        //   TinyLFU; LRU otherwise.
         //   5th parameter: number of batches to divide the number of rows
         //   into.
         //
@@ -4334,9 +4844,7 @@ int main(int argc, char *argv[])
         int numCalcs   = argc > 3 ? atoi(argv[3]) : 200000;
 
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
-            (argc > 4 && argv[4][0] == 'F' ?
-            bdlcc::CacheEvictionPolicy::e_FIFO :
-            bdlcc::CacheEvictionPolicy::e_LRU);
+                            cacheperf::parsePolicy(argc > 4 ? argv[4] : "L");
 
         int numBatches = argc > 5 ? atoi(argv[5]) : 1;
 
@@ -4353,11 +4861,13 @@ int main(int argc, char *argv[])
         // --------------------------------------------------------------------
         // READ PERFORMANCE TEST
         //   Tests performance of tryGetValue into the cache.  Note that LRU
-        //   eviction policy requires writes to the eviction queue.  To provide
+        //   eviction policy requires writes to the eviction queue, whereas
+        //   CLOCK and TinyLFU only require a read lock.  To provide
         //   control over the test, command line parameters are used.
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to read.
-        //   4th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   4th parameter: eviction policy: F for FIFO, C for CLOCK, T for
+        //   TinyLFU; LRU otherwise.
         //   5th parameter: sparsity of values loaded.  Sparsity is the
         //   distance between consecutive values inserted, and represents how
         //   likely is a read to find the key given. A value of 1 means
@@ -4385,9 +4895,7 @@ int main(int argc, char *argv[])
         int numCalcs   = argc > 3 ? atoi(argv[3]) : 200000;
 
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
-            (argc > 4 && argv[4][0] == 'F' ?
-            bdlcc::CacheEvictionPolicy::e_FIFO :
-            bdlcc::CacheEvictionPolicy::e_LRU);
+                            cacheperf::parsePolicy(argc > 4 ? argv[4] : "L");
 
         int sparsity = argc > 5 ? atoi(argv[5]) : 1;
 
@@ -4417,7 +4925,8 @@ int main(int argc, char *argv[])
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to read.
         //   4th parameter: number of writer threads.
-        //   5th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   5th parameter: eviction policy: F for FIFO, C for CLOCK, T for
+        //   TinyLFU; LRU otherwise.
         //   6th parameter: sparsity of values loaded.  Sparsity is the
         //   distance between consecutive values inserted, and represents how
         //   likely is a read to find the key given. A value of 1 means
@@ -4448,9 +4957,7 @@ int main(int argc, char *argv[])
         int numWThreads = argc > 4 ? atoi(argv[4]) : numThreads / 2;
 
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
-            (argc > 5 && argv[5][0] == 'F' ?
-            bdlcc::CacheEvictionPolicy::e_FIFO :
-            bdlcc::CacheEvictionPolicy::e_LRU);
+                            cacheperf::parsePolicy(argc > 5 ? argv[5] : "L");
 
         int sparsity = argc > 6 ? atoi(argv[6]) : 1;
 
@@ -4471,6 +4978,83 @@ int main(int argc, char *argv[])
         times = cp.runTests(args, cacheperf::CachePerformance::testReadWrite);
         cp.printResult();
       } break;
+      case -5: {
+        // --------------------------------------------------------------------
+        // HIT RATIO TEST
+        //   Compares the hit ratio of the eviction policies on synthetic
+        //   access traces.  To provide control over the test, command line
+        //   parameters are used.
+        //   2nd parameter: capacity of the cache.
+        //   3rd parameter: number of distinct keys.
+        //   4th parameter: length of the traces.
+        //
+        // Concerns:
+        //: 1 Reports the ratio of hits of each eviction policy for a trace
+        //:   following a Zipf distribution, and for the same trace
+        //:   interleaved with scans of keys never accessed again.
+        //
+        // Plan:
+        //: 1 Generate the traces, and for each policy replay them against a
+        //:   cache, inserting the key on every miss.  (C-1)
+        //
+        // Testing:
+        //   HIT RATIO
+        // --------------------------------------------------------------------
+
+        typedef bdlcc::CacheEvictionPolicy Policy;
+
+        bslma::TestAllocator talloc("ptm5", veryVeryVeryVerbose);
+
+        const int capacity    = argc > 2 ? atoi(argv[2]) : 1000;
+        const int numKeys     = argc > 3 ? atoi(argv[3]) : 100000;
+        const int traceLength = argc > 4 ? atoi(argv[4]) : 1000000;
+
+        approximateLru::ZipfGenerator zipf(numKeys, 12345, &talloc);
+
+        bsl::vector<int> zipfTrace(&talloc);
+        bsl::vector<int> scanTrace(&talloc);
+        zipfTrace.reserve(traceLength);
+        scanTrace.reserve(traceLength);
+
+        int scanKey = numKeys;
+        for (int i = 0; i < traceLength; ++i) {
+            const int key = zipf.next();
+            zipfTrace.push_back(key);
+
+            // Every 4th access is part of a scan over keys never reused.
+
+            scanTrace.push_back(0 == i % 4 ? scanKey++ : key);
+        }
+
+        const Policy::Enum  POLICIES[] = { Policy::e_LRU,
+                                           Policy::e_FIFO,
+                                           Policy::e_CLOCK,
+                                           Policy::e_TINYLFU };
+        const char         *NAMES[]    = { "LRU", "FIFO", "CLOCK", "TINYLFU" };
+        const int           NUM_POLICIES = static_cast<int>(
+                                         sizeof POLICIES / sizeof *POLICIES);
+
+        cout << "capacity: " << capacity
+             << ", keys: " << numKeys
+             << ", trace length: " << traceLength << "\n\n"
+             << setw(10) << "policy"
+             << setw(10) << "zipf"
+             << setw(10) << "scan" << "\n";
+
+        for (int tp = 0; tp < NUM_POLICIES; ++tp) {
+            const double zipfRatio = approximateLru::hitRatio(POLICIES[tp],
+                                                              capacity,
+                                                              zipfTrace,
+                                                              &talloc);
+            const double scanRatio = approximateLru::hitRatio(POLICIES[tp],
+                                                              capacity,
+                                                              scanTrace,
+                                                              &talloc);
+            cout << setw(10) << NAMES[tp]
+                 << setw(10) << setprecision(4) << zipfRatio
+                 << setw(10) << setprecision(4) << scanRatio << "\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
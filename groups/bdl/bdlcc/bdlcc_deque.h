@@ -64,6 +64,15 @@ BSLS_IDENT("$Id: $")
 // Moreover, if a 'bdlcc::Deque' object is empty, 'popFront' and 'popBack' will
 // block indefinitely until an item is added to the container.
 //
+// Items can also be transferred in batches: the 'popFront' and
+// 'timedPopFront' overloads taking a 'maxNumItems' and a 'bsl::vector' block
+// until the container is non-empty, then remove up to 'maxNumItems' items
+// while holding the container's mutex once, and the range 'pushBack' and
+// 'timedPushBack' overloads append as many items as there is space for each
+// time the mutex is acquired.  When many items are produced or consumed at a
+// time, batching substantially reduces the locking and signaling overhead per
+// item.
+//
 ///'High-Water Mark' Feature
 ///-------------------------
 // The behaviors of the 'push' methods differ from those of 'bsl::deque' in
@@ -609,6 +618,25 @@ class Deque {
     // NOT IMPLEMENTED
     Deque<TYPE>& operator=(const Deque<TYPE>&);
 
+    // PRIVATE MANIPULATORS
+    size_type popFrontBatchRaw(size_type          maxNumItems,
+                               bsl::vector<TYPE> *buffer);
+        // Remove up to the specified 'maxNumItems' from the front of this
+        // container and append them to the specified '*buffer', and return
+        // the number of threads waiting for space to become available that
+        // should be signaled as a result.  The behavior is undefined unless
+        // 'd_mutex' is locked by the calling thread.
+
+    template <class INPUT_ITER>
+    size_type pushBackBatchRaw(INPUT_ITER *begin, INPUT_ITER end);
+        // Append as many of the items in the range '[*begin .. end)', where
+        // the specified 'begin' and 'end' delimit the range, as there is
+        // space available for (see {'High-Water Mark' Feature}) to the back
+        // of this container, advance '*begin' past the items pushed, and
+        // return the number of items pushed.  If an exception is thrown, this
+        // container is left unchanged by this call.  The behavior is
+        // undefined unless 'd_mutex' is locked by the calling thread.
+
   public:
     // CLASS METHODS
     static
@@ -760,6 +788,17 @@ class Deque {
         // specified '*item'.  If the container is empty, block until an item
         // is available.
 
+    void popFront(size_type maxNumItems, bsl::vector<TYPE> *buffer);
+        // Remove up to the specified 'maxNumItems' from the front of this
+        // container and append them, in order, to the specified '*buffer'.
+        // If this container is empty, block until an item is available.  The
+        // behavior is undefined unless '0 < maxNumItems'.  Note that at least
+        // one item is removed, and that the items are removed while the
+        // container's mutex is acquired only once, so this method is
+        // considerably more efficient than repeated calls to 'popFront' when
+        // many items are available.  Also note that '*buffer' is not cleared
+        // -- the popped items are appended after any pre-existing contents.
+
     void pushBack(const TYPE&             item);
         // Block until space in this container becomes available (see
         // {'High-Water Mark' Feature}), then append the specified 'item' to
@@ -771,6 +810,23 @@ class Deque {
         // move-insertable 'item' to the back of this container.  'item' is
         // left in a valid but unspecified state.
 
+    template <class INPUT_ITER>
+    void pushBack(INPUT_ITER begin,
+                  INPUT_ITER end);
+        // Append the items in the specified range '[begin .. end)' to the
+        // back of this container, blocking whenever the container is full
+        // (see {'High-Water Mark' Feature}) until space becomes available.
+        // Each time space is available, as many items as there is space for
+        // are appended while the container's mutex is acquired once.  If an
+        // exception is thrown, the items appended before the container last
+        // became full remain in the container.  Note that, if there is space
+        // for the entire range, this method is equivalent to, but
+        // considerably more efficient than, repeated calls to 'pushBack'.
+        // Also note that items pushed concurrently by other threads may be
+        // interleaved with the items in the range.  Also note that the items
+        // in the range are treated as 'const' objects, copied without being
+        // modified.
+
     void pushFront(const TYPE&             item);
         // Block until space in this container becomes available (see
         // {'High-Water Mark' Feature}), then append the specified 'item' to
@@ -811,6 +867,20 @@ class Deque {
         // a proctor object -- there is no guarantee that this method will
         // return after 'timeout'.
 
+    int timedPopFront(size_type                  maxNumItems,
+                      bsl::vector<TYPE>         *buffer,
+                      const bsls::TimeInterval&  timeout);
+        // Remove up to the specified 'maxNumItems' from the front of this
+        // container and append them, in order, to the specified '*buffer'.  If
+        // this container is empty, block until an item is available or until
+        // the specified 'timeout' (expressed as the !ABSOLUTE! time from
+        // 00:00:00 UTC, January 1, 1970) expires.  Return 0 on success, and a
+        // non-zero value if the call timed out before an item was available.
+        // The behavior is undefined unless '0 < maxNumItems'.  Note that this
+        // method can block indefinitely if another thread has the mutex
+        // locked, particularly by a proctor object -- there is no guarantee
+        // that this method will return after 'timeout'.
+
     int timedPushBack(const TYPE&               item,
                       const bsls::TimeInterval& timeout);
         // Append the specified 'item' to the back of this container if space
@@ -839,6 +909,26 @@ class Deque {
         // thread has the mutex locked, particularly by a proctor object --
         // there is no guarantee that this method will return after 'timeout'.
 
+    template <class INPUT_ITER>
+    size_type timedPushBack(INPUT_ITER                begin,
+                            INPUT_ITER                end,
+                            const bsls::TimeInterval& timeout);
+        // Append the items in the specified range '[begin .. end)' to the
+        // back of this container, blocking whenever the container is full
+        // (see {'High-Water Mark' Feature}) until either space becomes
+        // available or the specified 'timeout' (expressed as the !ABSOLUTE!
+        // time from 00:00:00 UTC, January 1, 1970) expires.  Return the number
+        // of items pushed, which is less than the length of the range only if
+        // the call timed out.  Each time space is available, as many items as
+        // there is space for are appended while the container's mutex is
+        // acquired once.  If an exception is thrown, the items appended before
+        // the container last became full remain in the container.  Note that
+        // this method can block indefinitely if another thread has the mutex
+        // locked, particularly by a proctor object -- there is no guarantee
+        // that this method will return after 'timeout'.  Also note that the
+        // items in the range are treated as 'const' objects, copied without
+        // being modified.
+
     int timedPushFront(const TYPE&               item,
                        const bsls::TimeInterval& timeout);
         // Append the specified 'item' to the front of this container if space
@@ -1599,6 +1689,57 @@ Deque<TYPE>::~Deque()
 {
 }
 
+// PRIVATE MANIPULATORS
+template <class TYPE>
+typename Deque<TYPE>::size_type
+Deque<TYPE>::popFrontBatchRaw(size_type          maxNumItems,
+                              bsl::vector<TYPE> *buffer)
+{
+    typedef typename MonoDeque::iterator Iterator;
+
+    VectorThrowGuard tg(buffer);
+
+    const size_type startLength = d_monoDeque.size();
+    const size_type toMove      = bsl::min(startLength, maxNumItems);
+    const Iterator  beginRange  = d_monoDeque.begin();
+    const Iterator  endRange    = beginRange + toMove;
+
+    buffer->reserve(buffer->size() + toMove);
+
+    for (Iterator it = beginRange; it != endRange; ++it) {
+        buffer->push_back(bslmf::MovableRefUtil::move(*it));
+    }
+    d_monoDeque.erase(beginRange, endRange);
+
+    tg.release();
+
+    // Only the slots freed below the high-water mark can unblock a pusher.
+
+    const size_type full   = bsl::min(startLength, d_highWaterMark);
+    const size_type length = d_monoDeque.size();
+
+    return full > length ? full - length : 0;
+}
+
+template <class TYPE>
+template <class INPUT_ITER>
+typename Deque<TYPE>::size_type
+Deque<TYPE>::pushBackBatchRaw(INPUT_ITER *begin, INPUT_ITER end)
+{
+    DequeThrowGuard tg(&d_monoDeque);
+
+    const size_type startLength = d_monoDeque.size();
+    size_type       length      = startLength;
+
+    for (; length < d_highWaterMark && end != *begin; ++length, ++*begin) {
+        d_monoDeque.push_back(**begin);
+    }
+
+    tg.release();
+
+    return length - startLength;
+}
+
 // MANIPULATORS
 template <class TYPE>
 inline
@@ -1795,6 +1936,29 @@ void Deque<TYPE>::popFront(TYPE *item)
     }
 }
 
+template <class TYPE>
+void Deque<TYPE>::popFront(typename Deque<TYPE>::size_type  maxNumItems,
+                           bsl::vector<TYPE>               *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    size_type numToSignal;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        while (d_monoDeque.empty()) {
+            d_notEmptyCondition.wait(&d_mutex);
+        }
+
+        numToSignal = popFrontBatchRaw(maxNumItems, buffer);
+    }
+
+    for (; 0 < numToSignal; --numToSignal) {
+        d_notFullCondition.signal();
+    }
+}
+
 template <class TYPE>
 void Deque<TYPE>::pushBack(const TYPE& item)
 {
@@ -1825,6 +1989,29 @@ void Deque<TYPE>::pushBack(bslmf::MovableRef<TYPE> item)
     d_notEmptyCondition.signal();
 }
 
+template <class TYPE>
+template <class INPUT_ITER>
+void Deque<TYPE>::pushBack(INPUT_ITER begin,
+                           INPUT_ITER end)
+{
+    while (end != begin) {
+        size_type growth;
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+            while (d_monoDeque.size() >= d_highWaterMark) {
+                d_notFullCondition.wait(&d_mutex);
+            }
+
+            growth = pushBackBatchRaw(&begin, end);
+        }
+
+        for (; 0 < growth; --growth) {
+            d_notEmptyCondition.signal();
+        }
+    }
+}
+
 template <class TYPE>
 void Deque<TYPE>::pushFront(const TYPE& item)
 {
@@ -1937,6 +2124,35 @@ int Deque<TYPE>::timedPopFront(TYPE                      *item,
     return 0;
 }
 
+template <class TYPE>
+int Deque<TYPE>::timedPopFront(
+                         typename Deque<TYPE>::size_type  maxNumItems,
+                         bsl::vector<TYPE>               *buffer,
+                         const bsls::TimeInterval&        timeout)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    size_type numToSignal;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        while (d_monoDeque.empty()) {
+            if (d_notEmptyCondition.timedWait(&d_mutex, timeout)) {
+                return 1;                                             // RETURN
+            }
+        }
+
+        numToSignal = popFrontBatchRaw(maxNumItems, buffer);
+    }
+
+    for (; 0 < numToSignal; --numToSignal) {
+        d_notFullCondition.signal();
+    }
+
+    return 0;
+}
+
 template <class TYPE>
 int Deque<TYPE>::timedPushBack(const TYPE&               item,
                                const bsls::TimeInterval& timeout)
@@ -1977,6 +2193,39 @@ int Deque<TYPE>::timedPushBack(bslmf::MovableRef<TYPE>   item,
     return 0;
 }
 
+template <class TYPE>
+template <class INPUT_ITER>
+typename Deque<TYPE>::size_type
+Deque<TYPE>::timedPushBack(INPUT_ITER                begin,
+                           INPUT_ITER                end,
+                           const bsls::TimeInterval& timeout)
+{
+    size_type numPushed = 0;
+
+    while (end != begin) {
+        size_type growth;
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+            while (d_monoDeque.size() >= d_highWaterMark) {
+                if (d_notFullCondition.timedWait(&d_mutex, timeout)) {
+                    return numPushed;                                 // RETURN
+                }
+            }
+
+            growth = pushBackBatchRaw(&begin, end);
+        }
+
+        numPushed += growth;
+
+        for (; 0 < growth; --growth) {
+            d_notEmptyCondition.signal();
+        }
+    }
+
+    return numPushed;
+}
+
 template <class TYPE>
 int Deque<TYPE>::timedPushFront(const TYPE&               item,
                                 const bsls::TimeInterval &timeout)
@@ -2175,18 +2424,7 @@ Deque<TYPE>::tryPushBack(INPUT_ITER begin,
     {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-        DequeThrowGuard tg(&d_monoDeque);
-
-        const size_type startLength = d_monoDeque.size();
-        size_type       length      = startLength;
-
-        for (; length < d_highWaterMark && end != begin; ++length, ++begin) {
-            d_monoDeque.push_back(*begin);
-        }
-
-        tg.release();
-
-        growth = length - startLength;
+        growth = pushBackBatchRaw(&begin, end);
     }
 
     for (size_type ii = 0; ii < growth; ++ii) {
@@ -195,6 +195,10 @@ enum { PLAT_EXC = 0 };
 // [26] int timedPopFront(TYPE *, const TimeInterval&); - move semantics
 // [26] int timedPushBack(TYPE&&, const TimeInterval&);
 // [26] int timedPushFront(TYPE&&, const TimeInterval&);
+// [27] void popFront(size_t, vector<TYPE> *);
+// [27] int timedPopFront(size_t, vector<TYPE> *, const TimeInterval&);
+// [27] void pushBack(INPUT_ITER, INPUT_ITER);
+// [27] size_t timedPushBack(INPUT_ITER, INPUT_ITER, const TimeInterval&);
 //
 // ACCESSORS
 // [23] bslma::Allocator *allocator() const;
@@ -204,8 +208,8 @@ enum { PLAT_EXC = 0 };
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [24] PROCTOR LIFETIME
-// [27] USAGE EXAMPLE 1
-// [28] USAGE EXAMPLE 2
+// [28] USAGE EXAMPLE 1
+// [29] USAGE EXAMPLE 2
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
 // ----------------------------------------------------------------------------
@@ -1610,6 +1614,72 @@ namespace USAGE_EXAMPLE_1 {
 
 }  // close namespace USAGE_EXAMPLE_1
 
+//=============================================================================
+//                                  TEST CASE 27
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_27 {
+
+typedef bdlcc::Deque<int> IntDeque;
+
+struct BatchPopper {
+    // Functor that pops batches of at most 'd_maxNumItems' items from the
+    // front of '*d_deque_p', appending them to '*d_buffer_p', until the buffer
+    // holds 'd_numItems' items.
+
+    // DATA
+    IntDeque         *d_deque_p;
+    bsl::size_t       d_maxNumItems;
+    bsl::size_t       d_numItems;
+    bsl::vector<int> *d_buffer_p;
+
+    // ACCESSORS
+    void operator()() const
+    {
+        while (d_buffer_p->size() < d_numItems) {
+            const bsl::size_t length = d_buffer_p->size();
+
+            d_deque_p->popFront(d_maxNumItems, d_buffer_p);
+
+            ASSERT(length <  d_buffer_p->size());
+            ASSERT(length + d_maxNumItems >= d_buffer_p->size());
+        }
+    }
+};
+
+struct RangePusher {
+    // Functor that pushes the range '[d_begin_p .. d_end_p)' to the back of
+    // '*d_deque_p' with a single call to the blocking range 'pushBack'.
+
+    // DATA
+    IntDeque  *d_deque_p;
+    const int *d_begin_p;
+    const int *d_end_p;
+
+    // ACCESSORS
+    void operator()() const
+    {
+        d_deque_p->pushBack(d_begin_p, d_end_p);
+    }
+};
+
+struct SinglePusher {
+    // Functor that pushes 'd_value' to the back of '*d_deque_p', blocking
+    // until space is available.
+
+    // DATA
+    IntDeque *d_deque_p;
+    int       d_value;
+
+    // ACCESSORS
+    void operator()() const
+    {
+        d_deque_p->pushBack(d_value);
+    }
+};
+
+}  // close namespace TEST_CASE_27
+
 //=============================================================================
 //                                  TEST CASE 26
 //-----------------------------------------------------------------------------
@@ -5085,7 +5155,7 @@ int main(int argc, char *argv[])
                     bslmt::Configuration::recommendedDefaultThreadStackSize());
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 28: {
+      case 29: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //
@@ -5161,7 +5231,7 @@ int main(int argc, char *argv[])
 //..
         }
       } break;
-      case 27: {
+      case 28: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //
@@ -5219,6 +5289,231 @@ int main(int argc, char *argv[])
     ASSERT(0 == deque.length());
 //..
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH OPERATIONS
+        //
+        // Concerns:
+        //: 1 'popFront(maxNumItems, buffer)' removes up to 'maxNumItems' items
+        //:   from the front of the container, appending them in order to
+        //:   'buffer', and blocks only while the container is empty.
+        //:
+        //: 2 'timedPopFront(maxNumItems, buffer, timeout)' behaves the same
+        //:   way, but returns a non-zero value, leaving 'buffer' and the
+        //:   container unchanged, if it times out.
+        //:
+        //: 3 A batch pop provides the strong exception guarantee.
+        //:
+        //: 4 A batch pop unblocks as many blocked pushers as it frees space
+        //:   for.
+        //:
+        //: 5 The range 'pushBack' pushes every item of the range in order,
+        //:   blocking while the container is full.
+        //:
+        //: 6 The range 'timedPushBack' pushes items until either the range is
+        //:   exhausted or the timeout expires, and returns the number of items
+        //:   pushed.
+        //
+        // Plan:
+        //: 1 Force push items, pop them in batches of various sizes, and
+        //:   verify the contents of the buffer and of the container.  (C-1..2)
+        //:
+        //: 2 Pop a batch from an empty container with a timeout in the near
+        //:   future and verify the call fails with no effect.  (C-2)
+        //:
+        //: 3 Pop a batch from a container of allocating elements into a
+        //:   vector whose allocator throws, and verify the strong guarantee.
+        //:   (C-3)
+        //:
+        //: 4 Fill a container to its high-water mark, start as many threads
+        //:   blocked pushing single items as the high-water mark, pop the
+        //:   whole container in one batch, and verify all the pushers
+        //:   complete.  (C-4)
+        //:
+        //: 5 Push a range much longer than the high-water mark from one
+        //:   thread while another pops batches, and verify every item is
+        //:   popped in order.  (C-1, 5)
+        //:
+        //: 6 Push a range longer than the high-water mark into an empty
+        //:   container with a timeout in the near future, and verify the
+        //:   number of items pushed is the high-water mark.  (C-6)
+        //
+        // Testing:
+        //   void popFront(size_t, vector<TYPE> *);
+        //   int timedPopFront(size_t, vector<TYPE> *, const TimeInterval&);
+        //   void pushBack(INPUT_ITER, INPUT_ITER);
+        //   size_t timedPushBack(INPUT_ITER, INPUT_ITER, const TimeInterval&);
+        // --------------------------------------------------------------------
+
+        using namespace TEST_CASE_27;
+
+        if (verbose) cout << "TESTING BATCH OPERATIONS\n"
+                             "========================\n";
+
+        enum { k_NUM_ITEMS = 1000, k_HWM = 8 };
+
+        bsl::vector<int> values(&ta);
+        for (int ii = 0; ii < k_NUM_ITEMS; ++ii) {
+            values.push_back(ii);
+        }
+        const int *const BEGIN = values.data();
+        const int *const END   = BEGIN + values.size();
+
+        if (verbose) cout << "\tSingle-threaded batch pops\n";
+        {
+            const bsl::size_t MAX_NUM_ITEMS[] = { 1, 2, 3, 7, 16, 100 };
+            const int         NUM_MAX_NUM_ITEMS = static_cast<int>(
+                                 sizeof MAX_NUM_ITEMS / sizeof *MAX_NUM_ITEMS);
+
+            for (int ti = 0; ti < NUM_MAX_NUM_ITEMS; ++ti) {
+                const bsl::size_t MAX = MAX_NUM_ITEMS[ti];
+
+                IntDeque         mX(k_HWM, &ta);
+                bsl::vector<int> buffer(&ta);
+
+                mX.forcePushBack(BEGIN, BEGIN + 20);
+
+                buffer.push_back(-1);
+
+                while (0 < mX.length()) {
+                    const bsl::size_t length   = buffer.size();
+                    const bsl::size_t expected =
+                                    bsl::min<bsl::size_t>(MAX, mX.length());
+
+                    if (length % 2) {
+                        mX.popFront(MAX, &buffer);
+                    }
+                    else {
+                        const bsls::TimeInterval timeout =
+                              bdlt::CurrentTime::now().addSeconds(10);
+
+                        ASSERTV(MAX,
+                                0 == mX.timedPopFront(MAX, &buffer, timeout));
+                    }
+                    ASSERTV(MAX, length + expected == buffer.size());
+                }
+
+                ASSERTV(MAX, 21 == buffer.size());
+                ASSERTV(MAX, -1 == buffer[0]);
+                for (int ii = 0; ii < 20; ++ii) {
+                    ASSERTV(MAX, ii, ii == buffer[ii + 1]);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTimed batch pop times out\n";
+        {
+            IntDeque         mX(k_HWM, &ta);
+            bsl::vector<int> buffer(&ta);
+
+            buffer.push_back(-1);
+
+            const bsls::TimeInterval timeout =
+                          bdlt::CurrentTime::now().addMilliseconds(100);
+
+            ASSERT(0 != mX.timedPopFront(4, &buffer, timeout));
+            ASSERT(1 == buffer.size());
+            ASSERT(0 == mX.length());
+        }
+
+        if (verbose) cout << "\tBatch pop exception safety\n";
+        {
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            AObj mX(&ta);
+            for (int ii = 0; ii < 4; ++ii) {
+                mX.pushBack(AElement(ii, &ta));
+            }
+
+            AVec buffer(&sa);
+            int  numThrows = -1;
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                ++numThrows;
+
+                ASSERT(4 == mX.length());
+                ASSERT(0 == buffer.size());
+
+                mX.popFront(3, &buffer);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(numThrows, !PLAT_EXC || 0 < numThrows);
+
+            ASSERT(1 == mX.length());
+            ASSERT(3 == buffer.size());
+            for (int ii = 0; ii < 3; ++ii) {
+                ASSERTV(ii, ii == buffer[ii].data());
+            }
+        }
+
+        if (verbose) cout << "\tBatch pop unblocks pushers\n";
+        {
+            IntDeque mX(k_HWM, &ta);
+
+            mX.pushBack(BEGIN, BEGIN + k_HWM);
+            ASSERT(k_HWM == mX.length());
+
+            bslmt::ThreadUtil::Handle handles[k_HWM];
+            for (int ii = 0; ii < k_HWM; ++ii) {
+                SinglePusher pusher = { &mX, k_HWM + ii };
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[ii], pusher));
+            }
+
+            bsl::vector<int> buffer(&ta);
+            mX.popFront(k_HWM, &buffer);
+
+            ASSERT(k_HWM == buffer.size());
+            for (int ii = 0; ii < k_HWM; ++ii) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[ii]));
+            }
+            ASSERT(k_HWM == mX.length());
+        }
+
+        if (verbose) cout << "\tRange push with concurrent batch pops\n";
+        {
+            const bsl::size_t MAX_NUM_ITEMS[] = { 1, 3, 8, 64 };
+            const int         NUM_MAX_NUM_ITEMS = static_cast<int>(
+                                 sizeof MAX_NUM_ITEMS / sizeof *MAX_NUM_ITEMS);
+
+            for (int ti = 0; ti < NUM_MAX_NUM_ITEMS; ++ti) {
+                const bsl::size_t MAX = MAX_NUM_ITEMS[ti];
+
+                IntDeque         mX(k_HWM, &ta);
+                bsl::vector<int> buffer(&ta);
+
+                BatchPopper popper = { &mX, MAX, k_NUM_ITEMS, &buffer };
+                RangePusher pusher = { &mX, BEGIN, END };
+
+                bslmt::ThreadUtil::Handle popHandle, pushHandle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&popHandle,  popper));
+                ASSERT(0 == bslmt::ThreadUtil::create(&pushHandle, pusher));
+                ASSERT(0 == bslmt::ThreadUtil::join(pushHandle));
+                ASSERT(0 == bslmt::ThreadUtil::join(popHandle));
+
+                ASSERTV(MAX, 0 == mX.length());
+                ASSERTV(MAX, values == buffer);
+            }
+        }
+
+        if (verbose) cout << "\tTimed range push\n";
+        {
+            IntDeque mX(k_HWM, &ta);
+
+            bsls::TimeInterval timeout =
+                          bdlt::CurrentTime::now().addMilliseconds(100);
+
+            ASSERT(k_HWM == mX.timedPushBack(BEGIN, BEGIN + 20, timeout));
+            ASSERT(k_HWM == mX.length());
+
+            bsl::vector<int> buffer(&ta);
+            mX.removeAll(&buffer);
+            ASSERT(bsl::equal(buffer.begin(), buffer.end(), BEGIN));
+
+            timeout = bdlt::CurrentTime::now().addSeconds(10);
+
+            ASSERT(4 == mX.timedPushBack(BEGIN, BEGIN + 4, timeout));
+            ASSERT(0 == mX.timedPushBack(BEGIN, BEGIN,     timeout));
+            ASSERT(4 == mX.length());
+        }
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // TESTING TIMED POP & TIMED PUSH FUNCTIONS -- MOVE SEMANTICS
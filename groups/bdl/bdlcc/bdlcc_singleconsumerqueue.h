@@ -29,6 +29,13 @@ BSLS_IDENT("$Id: $")
 // provided.  The 'tryPopFront' method fails immediately, returning a non-zero
 // value, if the queue is empty.
 //
+// Batch variants of these methods are also provided: 'pushBack' and
+// 'tryPushBack' accept a range of elements, and 'popFront' and 'tryPopFront'
+// accept a maximum number of elements and a 'bsl::vector' to which the removed
+// elements are appended.  The batch methods update the shared state of the
+// queue once per call rather than once per element, and are preferable when
+// elements are produced or consumed in groups.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  The queue may be restored to normal
@@ -161,6 +168,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_atomicoperations.h>
 
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+
 namespace BloombergLP {
 namespace bdlcc {
 
@@ -230,6 +240,17 @@ class SingleConsumerQueue {
         // 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior is
         // undefined unless the invoker of this method is the single consumer.
 
+    int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        // Remove up to the specified 'maxNumItems' elements from the front of
+        // this queue and append them, in order, to the specified 'buffer'.  If
+        // the queue is empty, block until it is not empty.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_DISABLED' if 'isPopFrontDisabled()'.  On failure, '*buffer' is
+        // not changed.  Threads blocked due to the queue being empty will
+        // return 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior
+        // is undefined unless '0 < maxNumItems' and the invoker of this method
+        // is the single consumer.
+
     int pushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -242,6 +263,16 @@ class SingleConsumerQueue {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    template <class FORWARD_ITER>
+    int pushBack(FORWARD_ITER begin, FORWARD_ITER end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()'.  Note that the elements of the range are
+        // contiguous in this queue only if no other thread pushes concurrently
+        // and the range fits within the currently unused capacity of the
+        // queue.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -259,6 +290,17 @@ class SingleConsumerQueue {
         // behavior is undefined unless the invoker of this method is the
         // single consumer.
 
+    int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        // Attempt to remove up to the specified 'maxNumItems' elements from
+        // the front of this queue without blocking, and, if successful, append
+        // the removed elements, in order, to the specified 'buffer'.  Return 0
+        // on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_DISABLED' if 'isPopFrontDisabled()', and 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty.  On failure,
+        // '*buffer' is not changed.  The behavior is undefined unless
+        // '0 < maxNumItems' and the invoker of this method is the single
+        // consumer.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -271,6 +313,16 @@ class SingleConsumerQueue {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    template <class FORWARD_ITER>
+    int tryPushBack(FORWARD_ITER begin, FORWARD_ITER end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()'.  Note that the elements of the range are
+        // contiguous in this queue only if no other thread pushes concurrently
+        // and the range fits within the currently unused capacity of the
+        // queue.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -361,6 +413,13 @@ int SingleConsumerQueue<TYPE>::popFront(TYPE *value)
     return d_impl.popFront(value);
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::popFront(bsl::size_t        maxNumItems,
+                                        bsl::vector<TYPE> *buffer)
+{
+    return d_impl.popFront(maxNumItems, buffer);
+}
+
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -373,6 +432,14 @@ int SingleConsumerQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+template <class FORWARD_ITER>
+int SingleConsumerQueue<TYPE>::pushBack(FORWARD_ITER begin,
+                                        FORWARD_ITER end)
+{
+    return d_impl.pushBack(begin, end);
+}
+
 template <class TYPE>
 void SingleConsumerQueue<TYPE>::removeAll()
 {
@@ -385,6 +452,13 @@ int SingleConsumerQueue<TYPE>::tryPopFront(TYPE *value)
     return d_impl.tryPopFront(value);
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::tryPopFront(bsl::size_t        maxNumItems,
+                                           bsl::vector<TYPE> *buffer)
+{
+    return d_impl.tryPopFront(maxNumItems, buffer);
+}
+
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -397,6 +471,14 @@ int SingleConsumerQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.tryPushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+template <class FORWARD_ITER>
+int SingleConsumerQueue<TYPE>::tryPushBack(FORWARD_ITER begin,
+                                           FORWARD_ITER end)
+{
+    return d_impl.tryPushBack(begin, end);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE>
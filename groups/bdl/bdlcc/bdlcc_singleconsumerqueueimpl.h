@@ -40,6 +40,15 @@ BSLS_IDENT("$Id: $")
 // blocked in 'popFront' when the queue is dequeue disabled return from
 // 'popFront' immediately and return an error code.
 //
+// Batch variants of these methods are provided for transferring many elements
+// per call: 'pushBack' and 'tryPushBack' accept a range of elements, and
+// 'popFront' and 'tryPopFront' accept a maximum number of elements and a
+// 'bsl::vector' to which the removed elements are appended.  When sufficient
+// capacity is available, a batch "push" reserves all of its nodes with a
+// single update of the queue state and a single update of the write position,
+// and a batch "pop" returns all of its nodes to the producers with a single
+// update of the queue state.
+//
 ///Exception safety
 ///----------------
 // A 'bdlcc::SingleConsumerQueueImpl' is exception neutral, and all of the
@@ -101,6 +110,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_types.h>
 
 #include <bsl_cstddef.h>
+#include <bsl_iterator.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlcc {
@@ -179,6 +190,87 @@ class SingleConsumerQueueImpl_MarkReclaimProctor {
         // proctor.  If no queue, this method has no effect.
 };
 
+          // =====================================================
+          // class SingleConsumerQueueImpl_MarkReclaimRangeProctor
+          // =====================================================
+
+template <class TYPE, class NODE>
+class SingleConsumerQueueImpl_MarkReclaimRangeProctor {
+    // This class implements a proctor that automatically invokes
+    // 'markReclaimRange' on the managed sequence of 'NODE' objects upon
+    // destruction.  Nodes are released from management, in order, using the
+    // 'advance' method.
+
+    // DATA
+    TYPE        *d_queue_p;   // managed queue owning the managed nodes
+    NODE        *d_node_p;    // first managed node
+    bsl::size_t  d_numNodes;  // number of managed nodes
+
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_MarkReclaimRangeProctor();
+    SingleConsumerQueueImpl_MarkReclaimRangeProctor(
+                       const SingleConsumerQueueImpl_MarkReclaimRangeProctor&);
+    SingleConsumerQueueImpl_MarkReclaimRangeProctor& operator=(
+                       const SingleConsumerQueueImpl_MarkReclaimRangeProctor&);
+
+  public:
+    // CREATORS
+    SingleConsumerQueueImpl_MarkReclaimRangeProctor(TYPE        *queue,
+                                                    NODE        *node,
+                                                    bsl::size_t  numNodes);
+        // Create a 'markReclaimRange' proctor managing the specified
+        // 'numNodes' nodes, starting with the specified 'node', of the
+        // specified 'queue'.
+
+    ~SingleConsumerQueueImpl_MarkReclaimRangeProctor();
+        // Destroy this object and, if any nodes remain under management,
+        // invoke the managed queue's 'markReclaimRange' method with the
+        // managed nodes.
+
+    // MANIPULATORS
+    void advance(NODE *next);
+        // Release from management the first managed node, and manage the
+        // remaining nodes starting with the specified 'next' node.  The
+        // behavior is undefined unless at least one node is managed and
+        // 'next' is the node following the first managed node.
+};
+
+             // ===================================================
+             // class SingleConsumerQueueImpl_PopBatchCompleteGuard
+             // ===================================================
+
+template <class TYPE>
+class SingleConsumerQueueImpl_PopBatchCompleteGuard {
+    // This class implements a guard that automatically invokes
+    // 'popBatchComplete' on the managed queue, supplying the number of nodes
+    // removed, upon destruction.
+
+    // DATA
+    TYPE        *d_queue_p;     // managed queue
+    bsl::size_t  d_numRemoved;  // number of nodes removed
+
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_PopBatchCompleteGuard();
+    SingleConsumerQueueImpl_PopBatchCompleteGuard(
+                         const SingleConsumerQueueImpl_PopBatchCompleteGuard&);
+    SingleConsumerQueueImpl_PopBatchCompleteGuard& operator=(
+                         const SingleConsumerQueueImpl_PopBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+    explicit
+    SingleConsumerQueueImpl_PopBatchCompleteGuard(TYPE *queue);
+        // Create a 'popBatchComplete' guard managing the specified 'queue'.
+
+    ~SingleConsumerQueueImpl_PopBatchCompleteGuard();
+        // Destroy this object and invoke the 'popBatchComplete' method on the
+        // managed queue.
+
+    // MANIPULATORS
+    void incrementNumRemoved();
+        // Increment the number of nodes removed.
+};
+
               // ==============================================
               // class SingleConsumerQueueImpl_PopCompleteGuard
               // ==============================================
@@ -328,6 +420,22 @@ class SingleConsumerQueueImpl {
                                                             MUTEX,
                                                             CONDITION>::Node >;
 
+    friend class SingleConsumerQueueImpl_MarkReclaimRangeProctor<
+                           SingleConsumerQueueImpl<TYPE,
+                                                   ATOMIC_OP,
+                                                   MUTEX,
+                                                   CONDITION>,
+                           typename SingleConsumerQueueImpl<TYPE,
+                                                            ATOMIC_OP,
+                                                            MUTEX,
+                                                            CONDITION>::Node >;
+
+    friend class SingleConsumerQueueImpl_PopBatchCompleteGuard<
+                                          SingleConsumerQueueImpl<TYPE,
+                                                                  ATOMIC_OP,
+                                                                  MUTEX,
+                                                                  CONDITION> >;
+
     friend class SingleConsumerQueueImpl_PopCompleteGuard<
                                           SingleConsumerQueueImpl<TYPE,
                                                                   ATOMIC_OP,
@@ -342,16 +450,53 @@ class SingleConsumerQueueImpl {
     void markReclaim(Node *node);
         // Mark the specified 'node' as a node to be reclaimed.
 
+    void markReclaimRange(Node *node, bsl::size_t numNodes);
+        // Mark the specified 'numNodes' nodes, starting with the specified
+        // 'node', as nodes to be reclaimed.
+
+    void popBatchComplete(bsl::size_t numRemoved);
+        // Make the specified 'numRemoved' nodes most recently removed by the
+        // single consumer available to the producers, and if the queue is
+        // empty then signal the queue empty condition.
+
     void popComplete(bool destruct);
         // If the specified 'destruct' is true, destruct the value stored in
         // 'd_nextRead'.  Mark 'd_nextRead' writable, and if the queue is empty
         // then signal the queue empty condition.  This method is used to
         // complete the reclamation of a node in the presence of an exception.
 
+    bsl::size_t popFrontBatchRaw(bsl::size_t        maxNumItems,
+                                 bsl::vector<TYPE> *buffer);
+        // Remove up to the specified 'maxNumItems' elements from the front of
+        // this queue, append them, in order, to the specified 'buffer', and
+        // return the number of elements removed.  Reclaimed nodes encountered
+        // are removed but do not count as elements.  The behavior is undefined
+        // unless the invoker of this method is the single consumer.
+
     Node *pushBackHelper();
         // Return a pointer to the node to assign the value being pushed into
         // this queue, or 0 if 'isPushBackDisabled()'.
 
+    bsl::size_t pushBackReserve(Node **first, bsl::size_t maxNumItems);
+        // Attempt to reserve, without allocating, up to the specified
+        // 'maxNumItems' consecutive nodes for the values being pushed into
+        // this queue using a single update of the queue state, load into the
+        // specified 'first' the first reserved node, and return the number of
+        // nodes reserved.  Return 0, and leave 'first' unchanged, if no
+        // existing node is available or another thread is allocating a node.
+
+    void removeNode(bool destruct);
+        // If the specified 'destruct' is true, destruct the value stored in
+        // 'd_nextRead'.  Mark 'd_nextRead' writable and advance 'd_nextRead'.
+        // Note that the node is not made available to the producers until
+        // 'popBatchComplete' is invoked.
+
+    int waitForReadable(unsigned int generation);
+        // Block until the node at 'd_nextRead' is readable, removing any
+        // reclaimed nodes encountered.  Return 0 on success, and 'e_DISABLED'
+        // if the specified 'generation' is not the current dequeue generation
+        // (i.e., 'disablePopFront' has been invoked).
+
     void incrementUntil(AtomicUint *value, unsigned int bitValue);
         // If the specified 'value' does not have its lowest-order bit set to
         // the value of the specified 'bitValue', increment 'value' until it
@@ -413,6 +558,17 @@ class SingleConsumerQueueImpl {
         // 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior is
         // undefined unless the invoker of this method is the single consumer.
 
+    int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        // Remove up to the specified 'maxNumItems' elements from the front of
+        // this queue and append them, in order, to the specified 'buffer'.  If
+        // the queue is empty, block until it is not empty.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_DISABLED' if 'isPopFrontDisabled()'.  On failure, '*buffer' is
+        // not changed.  Threads blocked due to the queue being empty will
+        // return 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior
+        // is undefined unless '0 < maxNumItems' and the invoker of this method
+        // is the single consumer.
+
     int pushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -425,6 +581,16 @@ class SingleConsumerQueueImpl {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    template <class FORWARD_ITER>
+    int pushBack(FORWARD_ITER begin, FORWARD_ITER end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()'.  Note that the elements of the range are
+        // contiguous in this queue only if no other thread pushes concurrently
+        // and the range fits within the currently unused capacity of the
+        // queue.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -442,6 +608,17 @@ class SingleConsumerQueueImpl {
         // behavior is undefined unless the invoker of this method is the
         // single consumer.
 
+    int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        // Attempt to remove up to the specified 'maxNumItems' elements from
+        // the front of this queue without blocking, and, if successful, append
+        // the removed elements, in order, to the specified 'buffer'.  Return 0
+        // on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_DISABLED' if 'isPopFrontDisabled()', and 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty.  On failure,
+        // '*buffer' is not changed.  The behavior is undefined unless
+        // '0 < maxNumItems' and the invoker of this method is the single
+        // consumer.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, retun
@@ -454,6 +631,13 @@ class SingleConsumerQueueImpl {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    template <class FORWARD_ITER>
+    int tryPushBack(FORWARD_ITER begin, FORWARD_ITER end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()'.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -574,6 +758,69 @@ void SingleConsumerQueueImpl_MarkReclaimProctor<TYPE, NODE>::release()
     d_queue_p = 0;
 }
 
+          // -----------------------------------------------------
+          // class SingleConsumerQueueImpl_MarkReclaimRangeProctor
+          // -----------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_MarkReclaimRangeProctor<TYPE, NODE>::
+         SingleConsumerQueueImpl_MarkReclaimRangeProctor(TYPE        *queue,
+                                                         NODE        *node,
+                                                         bsl::size_t  numNodes)
+: d_queue_p(queue)
+, d_node_p(node)
+, d_numNodes(numNodes)
+{
+}
+
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_MarkReclaimRangeProctor<TYPE, NODE>::
+                             ~SingleConsumerQueueImpl_MarkReclaimRangeProctor()
+{
+    if (d_numNodes) {
+        d_queue_p->markReclaimRange(d_node_p, d_numNodes);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+void SingleConsumerQueueImpl_MarkReclaimRangeProctor<TYPE, NODE>::advance(
+                                                                    NODE *next)
+{
+    BSLS_ASSERT(0 < d_numNodes);
+
+    d_node_p = next;
+    --d_numNodes;
+}
+
+             // ---------------------------------------------------
+             // class SingleConsumerQueueImpl_PopBatchCompleteGuard
+             // ---------------------------------------------------
+
+// CREATORS
+template <class TYPE>
+SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE>::
+                     SingleConsumerQueueImpl_PopBatchCompleteGuard(TYPE *queue)
+: d_queue_p(queue)
+, d_numRemoved(0)
+{
+}
+
+template <class TYPE>
+SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE>::
+                               ~SingleConsumerQueueImpl_PopBatchCompleteGuard()
+{
+    d_queue_p->popBatchComplete(d_numRemoved);
+}
+
+// MANIPULATORS
+template <class TYPE>
+void SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE>::incrementNumRemoved()
+{
+    ++d_numRemoved;
+}
+
               // ----------------------------------------------
               // class SingleConsumerQueueImpl_PopCompleteGuard
               // ----------------------------------------------
@@ -628,22 +875,33 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
 
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
-                                                   ::popComplete(bool destruct)
+                        ::markReclaimRange(Node *node, bsl::size_t numNodes)
 {
-    Node *nextRead =
-                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+    for (bsl::size_t i = 0; i < numNodes; ++i) {
+        // Obtain the next node before marking 'node'; once reclaimed, the
+        // consumer may remove the node.
 
-    if (destruct) {
-        nextRead->d_value.object().~TYPE();
-    }
+        Node *next = static_cast<Node *>(
+                                      ATOMIC_OP::getPtrAcquire(&node->d_next));
 
-    ATOMIC_OP::setIntRelease(&nextRead->d_state, e_WRITABLE);
+        markReclaim(node);
 
-    ATOMIC_OP::setPtrRelease(&d_nextRead,
-                             ATOMIC_OP::getPtrAcquire(&nextRead->d_next));
+        node = next;
+    }
+}
 
-    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(&d_state,
-                                                           k_AVAILABLE_INC);
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                  ::popBatchComplete(bsl::size_t numRemoved)
+{
+    if (0 == numRemoved) {
+        return;                                                       // RETURN
+    }
+
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(
+                               &d_state,
+                              k_AVAILABLE_INC
+                                * static_cast<bsls::Types::Int64>(numRemoved));
 
     if (ATOMIC_OP::getInt64Acquire(&d_capacity) == available(state)) {
         {
@@ -653,6 +911,72 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
     }
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                                   ::popComplete(bool destruct)
+{
+    removeNode(destruct);
+    popBatchComplete(1);
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+bsl::size_t SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                    ::popFrontBatchRaw(bsl::size_t        maxNumItems,
+                                       bsl::vector<TYPE> *buffer)
+{
+    // Determine the number of readable nodes so that the capacity of 'buffer'
+    // can be reserved before any node is removed.  Note that only the single
+    // consumer modifies the state of a readable or reclaimed node.
+
+    bsl::size_t numReadable = 0;
+    {
+        Node *node =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+        int nodeState = ATOMIC_OP::getIntAcquire(&node->d_state);
+        while (numReadable < maxNumItems
+            && (e_READABLE == nodeState || e_RECLAIM == nodeState)) {
+            if (e_READABLE == nodeState) {
+                ++numReadable;
+            }
+            node = static_cast<Node *>(
+                                      ATOMIC_OP::getPtrAcquire(&node->d_next));
+            nodeState = ATOMIC_OP::getIntAcquire(&node->d_state);
+        }
+    }
+
+    buffer->reserve(buffer->size() + numReadable);
+
+    SingleConsumerQueueImpl_PopBatchCompleteGuard<
+                              SingleConsumerQueueImpl<TYPE,
+                                                      ATOMIC_OP,
+                                                      MUTEX,
+                                                      CONDITION> > guard(this);
+
+    bsl::size_t numPopped = 0;
+    while (numPopped < numReadable) {
+        Node *nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+
+        if (e_RECLAIM == ATOMIC_OP::getIntAcquire(&nextRead->d_state)) {
+            ATOMIC_OP::addInt64AcqRel(&d_capacity, 1);
+            removeNode(false);
+        }
+        else {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+            buffer->push_back(bslmf::MovableRefUtil::move(
+                                                 nextRead->d_value.object()));
+#else
+            buffer->push_back(nextRead->d_value.object());
+#endif
+            removeNode(true);
+            ++numPopped;
+        }
+        guard.incrementNumRemoved();
+    }
+
+    return numPopped;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
                      SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
@@ -754,6 +1078,59 @@ typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
     return nextWrite;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+bsl::size_t SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                 ::pushBackReserve(Node **first, bsl::size_t maxNumItems)
+{
+    // Reserve the nodes and indicate a thread is intending to use existing
+    // nodes with a single update of 'd_state'.  Threads allocating new nodes
+    // wait for the use indication to be removed, so the links between the
+    // reserved nodes are stable while the reservation is claimed.
+
+    bsls::Types::Int64 state = ATOMIC_OP::getInt64Acquire(&d_state);
+    bsls::Types::Int64 expState;
+    bsls::Types::Int64 numNodes;
+    do {
+        numNodes = available(state);
+        if (0 >= numNodes || 0 < (state & k_ALLOCATE_MASK)) {
+            return 0;                                                 // RETURN
+        }
+        if (static_cast<bsls::Types::Uint64>(numNodes) > maxNumItems) {
+            numNodes = static_cast<bsls::Types::Int64>(maxNumItems);
+        }
+
+        expState = state;
+        state    = ATOMIC_OP::testAndSwapInt64AcqRel(
+                               &d_state,
+                               state,
+                               state + k_USE_INC - k_AVAILABLE_INC * numNodes);
+    } while (state != expState);
+
+    Node *nextWrite = static_cast<Node *>(
+                                       ATOMIC_OP::getPtrAcquire(&d_nextWrite));
+    Node *expNextWrite;
+    do {
+        expNextWrite = nextWrite;
+
+        Node *next = nextWrite;
+        for (bsls::Types::Int64 i = 0; i < numNodes; ++i) {
+            next = static_cast<Node *>(
+                                      ATOMIC_OP::getPtrAcquire(&next->d_next));
+        }
+
+        nextWrite = static_cast<Node *>(ATOMIC_OP::testAndSwapPtrAcqRel(
+                                                                  &d_nextWrite,
+                                                                  nextWrite,
+                                                                  next));
+    } while (nextWrite != expNextWrite);
+
+    ATOMIC_OP::addInt64AcqRel(&d_state, -k_USE_INC);
+
+    *first = nextWrite;
+
+    return static_cast<bsl::size_t>(numNodes);
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
                      ::incrementUntil(AtomicUint *value, unsigned int bitValue)
@@ -800,6 +1177,66 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
     }
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                                    ::removeNode(bool destruct)
+{
+    Node *nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+
+    if (destruct) {
+        nextRead->d_value.object().~TYPE();
+    }
+
+    ATOMIC_OP::setIntRelease(&nextRead->d_state, e_WRITABLE);
+
+    ATOMIC_OP::setPtrRelease(&d_nextRead,
+                             ATOMIC_OP::getPtrAcquire(&nextRead->d_next));
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                   ::waitForReadable(unsigned int generation)
+{
+    Node *nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+    int nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+    do {
+        // Note that 'e_WRITABLE_AND_BLOCKED != nodeState' since if the one
+        // consumer sets this state, the one consumer waits until the node is
+        // readable, and either the producer that signalled the consumer
+        // changed the node state already, or the consumer will change the node
+        // state in 'popComplete'.
+
+        if (e_WRITABLE == nodeState) {
+            bslmt::ThreadUtil::yield();
+            nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+            if (e_WRITABLE == nodeState) {
+                bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+                nodeState = ATOMIC_OP::swapIntAcqRel(&nextRead->d_state,
+                                                     e_WRITABLE_AND_BLOCKED);
+                while (e_READABLE != nodeState && e_RECLAIM != nodeState) {
+                    if (generation !=
+                              ATOMIC_OP::getUintAcquire(&d_popFrontDisabled)) {
+                        return e_DISABLED;                            // RETURN
+                    }
+                    d_readCondition.wait(&d_readMutex);
+                    nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+                }
+            }
+        }
+        if (e_RECLAIM == nodeState) {
+            ATOMIC_OP::addInt64AcqRel(&d_capacity, 1);
+            popComplete(false);
+            nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+            nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+        }
+    } while (e_RECLAIM == nodeState);
+
+    return 0;
+}
+
 // CREATORS
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
@@ -899,41 +1336,12 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
         return e_DISABLED;                                            // RETURN
     }
 
-    Node *nextRead =
-                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
-    int nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
-    do {
-        // Note that 'e_WRITABLE_AND_BLOCKED != nodeState' since if the one
-        // consumer sets this state, the one consumer waits until the node is
-        // readable, and either the producer that signalled the consumer
-        // changed the node state already, or the consumer will change the node
-        // state in 'popComplete'.
+    if (waitForReadable(generation)) {
+        return e_DISABLED;                                            // RETURN
+    }
 
-        if (e_WRITABLE == nodeState) {
-            bslmt::ThreadUtil::yield();
-            nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
-            if (e_WRITABLE == nodeState) {
-                bslmt::LockGuard<MUTEX> guard(&d_readMutex);
-                nodeState = ATOMIC_OP::swapIntAcqRel(&nextRead->d_state,
-                                                     e_WRITABLE_AND_BLOCKED);
-                while (e_READABLE != nodeState && e_RECLAIM != nodeState) {
-                    if (generation !=
-                              ATOMIC_OP::getUintAcquire(&d_popFrontDisabled)) {
-                        return e_DISABLED;                            // RETURN
-                    }
-                    d_readCondition.wait(&d_readMutex);
-                    nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
-                }
-            }
-        }
-        if (e_RECLAIM == nodeState) {
-            ATOMIC_OP::addInt64AcqRel(&d_capacity, 1);
-            popComplete(false);
-            nextRead =
+    Node *nextRead =
                     static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
-            nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
-        }
-    } while (e_RECLAIM == nodeState);
 
     SingleConsumerQueueImpl_PopCompleteGuard<
                               SingleConsumerQueueImpl<TYPE,
@@ -950,6 +1358,31 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
+                                                bsl::size_t        maxNumItems,
+                                                bsl::vector<TYPE> *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    if (waitForReadable(generation)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    // Note that the node at 'd_nextRead' is readable and only the single
+    // consumer modifies a readable node, so at least one element is removed.
+
+    popFrontBatchRaw(maxNumItems, buffer);
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
                                                              const TYPE& value)
@@ -1019,6 +1452,75 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class FORWARD_ITER>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
+                                                            FORWARD_ITER begin,
+                                                            FORWARD_ITER end)
+{
+    if (1 == (ATOMIC_OP::getUintAcquire(&d_pushBackDisabled) & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    bsl::size_t remaining = bsl::distance(begin, end);
+
+    while (remaining) {
+        Node        *node;
+        bsl::size_t  numNodes = pushBackReserve(&node, remaining);
+
+        if (0 == numNodes) {
+            // No existing node is available; push a single element, which
+            // allocates a new node.
+
+            int rv = pushBack(*begin);
+            if (rv) {
+                return rv;                                            // RETURN
+            }
+            ++begin;
+            --remaining;
+            continue;
+        }
+
+        remaining -= numNodes;
+
+        SingleConsumerQueueImpl_MarkReclaimRangeProctor<
+                                            SingleConsumerQueueImpl<TYPE,
+                                                                    ATOMIC_OP,
+                                                                    MUTEX,
+                                                                    CONDITION>,
+                                            Node> proctor(this,
+                                                          node,
+                                                          numNodes);
+
+        for (bsl::size_t i = 0; i < numNodes; ++i, ++begin) {
+            // Obtain the next node before publishing 'node'; once readable,
+            // the consumer may remove the node.
+
+            Node *next = static_cast<Node *>(
+                                      ATOMIC_OP::getPtrAcquire(&node->d_next));
+
+            bslalg::ScalarPrimitives::copyConstruct(node->d_value.address(),
+                                                    *begin,
+                                                    d_allocator_p);
+
+            proctor.advance(next);
+
+            int nodeState = ATOMIC_OP::swapIntAcqRel(&node->d_state,
+                                                     e_READABLE);
+            if (e_WRITABLE_AND_BLOCKED == nodeState) {
+                {
+                    bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+                }
+                d_readCondition.signal();
+            }
+
+            node = next;
+        }
+    }
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::removeAll()
 {
@@ -1092,6 +1594,26 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
+                                                bsl::size_t        maxNumItems,
+                                                bsl::vector<TYPE> *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    if (0 == popFrontBatchRaw(maxNumItems, buffer)) {
+        return e_EMPTY;                                               // RETURN
+    }
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
                                                              const TYPE& value)
@@ -1106,6 +1628,15 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
     return pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class FORWARD_ITER>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
+                                                            FORWARD_ITER begin,
+                                                            FORWARD_ITER end)
+{
+    return pushBack(begin, end);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
@@ -26,6 +26,7 @@
 #include <bsltf_moveonlyalloctesttype.h>
 #include <bsltf_movablealloctesttype.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
@@ -77,12 +78,16 @@ using namespace bsl;
 // [ 5] SingleConsumerQueueImpl(capacity, *bA = 0);
 // [ 2] ~SingleConsumerQueueImpl();
 // [ 2] int popFront(TYPE *value);
+// [13] int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int pushBack(FORWARD_ITER begin, FORWARD_ITER end);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [13] int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [13] int tryPushBack(FORWARD_ITER begin, FORWARD_ITER end);
 // [ 6] void disablePopFront();
 // [ 6] void disablePushBack();
 // [ 6] void enablePopFront();
@@ -102,6 +107,7 @@ using namespace bsl;
 // [10] CONCERN: 'popFront' and 'tryPopFront' honor move-semantics
 // [11] CONCERN: template requirements
 // [12] CONCERN: ordering guarantee
+// [-1] BATCH SIZE PERFORMANCE TEST
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -687,6 +693,51 @@ void orderingGuaranteeTest(const int numPushThread, const int numPopThread)
     bslmt::ThreadUtil::join(watchdogHandle);
 }
 
+namespace Case13 {
+
+struct PushData {
+    Obj         *d_obj_p;       // queue under test
+    int          d_firstValue;  // first value pushed by the thread
+    int          d_numValues;   // number of values pushed by the thread
+    bsl::size_t  d_batchSize;   // maximum number of elements per push
+};
+
+extern "C" void *batchPush(void *arg)
+{
+    PushData& data = *static_cast<PushData *>(arg);
+
+    bsl::vector<int> input;
+    for (int i = 0; i < data.d_numValues; ++i) {
+        input.push_back(data.d_firstValue + i);
+    }
+
+    bsl::size_t start = 0;
+    while (start < input.size()) {
+        const bsl::size_t end = bsl::min(start + data.d_batchSize,
+                                         input.size());
+
+        ASSERT(e_SUCCESS == data.d_obj_p->pushBack(input.begin() + start,
+                                                   input.begin() + end));
+        start = end;
+    }
+
+    return 0;
+}
+
+extern "C" void *blockedBatchPop(void *arg)
+{
+    Obj& mX = *static_cast<Obj *>(arg);
+
+    bsl::vector<int> buffer;
+
+    ASSERT(e_SUCCESS == mX.popFront(4, &buffer));
+    ASSERT(0 < buffer.size());
+
+    return 0;
+}
+
+}  // close namespace Case13
+
 // ============================================================================
 //               GENERATOR FUNCTIONS 'gg' AND 'ggg' FOR TESTING
 // ----------------------------------------------------------------------------
@@ -805,6 +856,266 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 13: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //   The batch methods transfer many elements per call.
+        //
+        // Concerns:
+        //: 1 The range 'pushBack' and 'tryPushBack' append all elements, in
+        //:   order, whether or not the queue must allocate nodes, and the
+        //:   batch 'popFront' and 'tryPopFront' remove up to the requested
+        //:   number of elements, in order, appending them to the buffer.
+        //:
+        //: 2 The batch methods respect the enqueue and dequeue disabled
+        //:   states, and do not modify the buffer on failure.
+        //:
+        //: 3 The blocked consumer is released by a range 'pushBack' and by
+        //:   'disablePopFront'.
+        //:
+        //: 4 If an exception is thrown while copying an element of the range,
+        //:   the elements already written are available to the consumer, and
+        //:   the remaining reserved nodes are reclaimed.
+        //:
+        //: 5 With concurrent producers, every element is removed exactly once
+        //:   and the elements of each producer are removed in order.
+        //
+        // Plan:
+        //: 1 Push ranges of varying length into queues of varying capacity
+        //:   and pop batches of varying size, verifying the number and the
+        //:   values of the removed elements.  (C-1)
+        //:
+        //: 2 Disable the queue and verify the return values and that the
+        //:   buffer is unchanged.  (C-2)
+        //:
+        //: 3 Block the consumer in the batch 'popFront' and release it with a
+        //:   range 'pushBack', then again with 'disablePopFront'.  (C-3)
+        //:
+        //: 4 Use a test allocator with an allocation limit and a type that
+        //:   allocates on copy to force an exception during the range
+        //:   'pushBack', and verify the number of elements in the queue and
+        //:   that the queue remains usable.  (C-4)
+        //:
+        //: 5 Push ranges from several threads while the consumer pops
+        //:   batches, and verify every value is popped exactly once and in
+        //:   order per producer.  (C-5)
+        //
+        // Testing:
+        //   int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        //   int pushBack(FORWARD_ITER begin, FORWARD_ITER end);
+        //   int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *bf);
+        //   int tryPushBack(FORWARD_ITER begin, FORWARD_ITER end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "Single-threaded batches." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bsl::vector<int> input;
+            for (int i = 0; i < 40; ++i) {
+                input.push_back(i);
+            }
+
+            for (bsl::size_t capacity = 0; capacity <= 48; capacity += 12) {
+            for (bsl::size_t batch = 1; batch <= 16; ++batch) {
+                Obj mX(capacity, &oa);  const Obj& X = mX;
+
+                ASSERTV(capacity, batch,
+                        e_SUCCESS == mX.pushBack(input.begin(),
+                                                 input.begin() + 20));
+                ASSERTV(capacity, batch,
+                        e_SUCCESS == mX.tryPushBack(input.begin() + 20,
+                                                    input.end()));
+                ASSERTV(capacity, batch, 40 == X.numElements());
+
+                bsl::vector<int> buffer;
+                int              expected = 0;
+                while (expected < 40) {
+                    const bsl::size_t size = buffer.size();
+                    const int         rv   = expected % 2
+                                           ? mX.tryPopFront(batch, &buffer)
+                                           : mX.popFront(batch, &buffer);
+
+                    ASSERTV(capacity, batch, e_SUCCESS == rv);
+
+                    const bsl::size_t numPopped = buffer.size() - size;
+                    ASSERTV(capacity, batch, numPopped,
+                            bsl::min<bsl::size_t>(batch, 40 - expected)
+                                                                 == numPopped);
+
+                    for (bsl::size_t i = size; i < buffer.size(); ++i) {
+                        ASSERTV(capacity, batch, expected == buffer[i]);
+                        ++expected;
+                    }
+                }
+                ASSERTV(capacity, batch, 0 == X.numElements());
+                ASSERTV(capacity, batch, X.isEmpty());
+                ASSERTV(capacity,
+                        batch,
+                        e_EMPTY == mX.tryPopFront(batch, &buffer));
+                ASSERTV(capacity, batch, 40 == buffer.size());
+
+                // empty range
+
+                ASSERTV(capacity, batch,
+                        e_SUCCESS == mX.pushBack(input.begin(),
+                                                 input.begin()));
+                ASSERTV(capacity, batch, 0 == X.numElements());
+            }
+            }
+        }
+
+        if (verbose) cout << "Disabled queue." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            bsl::vector<int> input(5, 7);
+            bsl::vector<int> buffer(1, 3);
+
+            mX.disablePushBack();
+
+            ASSERT(e_DISABLED == mX.pushBack(input.begin(), input.end()));
+            ASSERT(e_DISABLED == mX.tryPushBack(input.begin(), input.end()));
+            ASSERT(0 == X.numElements());
+
+            mX.enablePushBack();
+            ASSERT(e_SUCCESS == mX.pushBack(input.begin(), input.end()));
+
+            mX.disablePopFront();
+
+            ASSERT(e_DISABLED == mX.popFront(3, &buffer));
+            ASSERT(e_DISABLED == mX.tryPopFront(3, &buffer));
+            ASSERT(1 == buffer.size());
+            ASSERT(5 == X.numElements());
+        }
+
+        if (verbose) cout << "Blocked batch 'popFront'." << endl;
+        {
+            Obj mX(8);
+
+            bsl::vector<int> input(3, 1);
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, Case13::blockedBatchPop, &mX);
+
+            bslmt::ThreadUtil::microSleep(100000);
+
+            ASSERT(e_SUCCESS == mX.pushBack(input.begin(), input.end()));
+
+            bslmt::ThreadUtil::join(handle);
+
+            mX.removeAll();
+
+            bslmt::ThreadUtil::create(&handle, deferredDisablePopFront, &mX);
+
+            bsl::vector<int> buffer;
+
+            ASSERT(e_DISABLED == mX.popFront(4, &buffer));
+            ASSERT(buffer.empty());
+
+            bslmt::ThreadUtil::join(handle);
+        }
+
+        if (verbose) cout << "Exception during range 'pushBack'." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bdlcc::SingleConsumerQueueImpl<AllocExceptionHelper,
+                                           bsls::AtomicOperations,
+                                           bslmt::Mutex,
+                                           bslmt::Condition> mX(8, &oa);
+
+            bsl::vector<AllocExceptionHelper> input(4, AllocExceptionHelper(
+                                                                         &oa),
+                                                    &oa);
+
+            oa.setAllocationLimit(2);
+
+            bool caught = false;
+            try {
+                mX.pushBack(input.begin(), input.end());
+            }
+            catch (...) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            oa.setAllocationLimit(-1);
+
+            ASSERT(2 == mX.numElements());
+
+            bsl::vector<AllocExceptionHelper> buffer(&oa);
+
+            ASSERT(e_SUCCESS == mX.tryPopFront(4, &buffer));
+            ASSERT(2 == buffer.size());
+            ASSERT(0 == mX.numElements());
+            ASSERT(mX.isEmpty());
+
+            ASSERT(e_SUCCESS == mX.pushBack(input.begin(), input.end()));
+            ASSERT(4 == mX.numElements());
+
+            buffer.clear();
+
+            ASSERT(e_SUCCESS == mX.popFront(8, &buffer));
+            ASSERT(4 == buffer.size());
+            ASSERT(0 == mX.numElements());
+        }
+
+        if (verbose) cout << "Concurrent range 'pushBack'." << endl;
+        {
+            const int k_NUM_THREADS = 4;
+            const int k_NUM_VALUES  = 5000;  // per thread
+
+            Obj mX(16);
+
+            Case13::PushData          data[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle handle[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                data[i].d_obj_p      = &mX;
+                data[i].d_firstValue = i * k_NUM_VALUES;
+                data[i].d_numValues  = k_NUM_VALUES;
+                data[i].d_batchSize  = 1 + 5 * i;
+                bslmt::ThreadUtil::create(&handle[i],
+                                          Case13::batchPush,
+                                          &data[i]);
+            }
+
+            bsl::vector<int> seen(k_NUM_THREADS * k_NUM_VALUES, 0);
+            bsl::vector<int> last(k_NUM_THREADS, -1);
+            bsl::vector<int> buffer;
+
+            int numPopped = 0;
+            while (numPopped < k_NUM_THREADS * k_NUM_VALUES) {
+                buffer.clear();
+                ASSERT(e_SUCCESS == mX.popFront(1 + numPopped % 13, &buffer));
+
+                for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+                    const int value  = buffer[i];
+                    const int thread = value / k_NUM_VALUES;
+
+                    ASSERTV(value, last[thread], last[thread] < value);
+
+                    last[thread] = value;
+                    ++seen[value];
+                }
+                numPopped += static_cast<int>(buffer.size());
+            }
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handle[i]);
+            }
+
+            ASSERT(mX.isEmpty());
+            for (int i = 0; i < k_NUM_THREADS * k_NUM_VALUES; ++i) {
+                ASSERTV(i, seen[i], 1 == seen[i]);
+            }
+        }
+      } break;
       case 12: {
         // ---------------------------------------------------------
         // Ordering Guarantee Test
@@ -2658,6 +2969,72 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // BATCH SIZE PERFORMANCE TEST
+        //   Compare the cost per element of the single-element and the batch
+        //   methods.
+        //
+        // Concerns:
+        //: 1 The batch methods reduce the cost per element.
+        //
+        // Plan:
+        //: 1 For a series of batch sizes, push and pop a fixed number of
+        //:   elements with one producer and one consumer thread and report
+        //:   the elapsed time per element.  A batch size of one uses the
+        //:   single-element methods.
+        //
+        // Testing:
+        //   BATCH SIZE PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "BATCH SIZE PERFORMANCE TEST" << endl
+             << "===========================" << endl;
+
+        const int numValues = 1 << 22;
+
+        for (bsl::size_t batch = 1; batch <= 1024; batch *= 2) {
+            Obj mX(4096);
+
+            Case13::PushData data;
+
+            data.d_obj_p      = &mX;
+            data.d_firstValue = 0;
+            data.d_numValues  = numValues;
+            data.d_batchSize  = batch;
+
+            bsls::TimeInterval startTime =
+                                         bsls::SystemTime::nowMonotonicClock();
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, Case13::batchPush, &data);
+
+            bsl::vector<int> buffer;
+            int              value;
+
+            for (int numPopped = 0; numPopped < numValues; ) {
+                if (1 == batch) {
+                    mX.popFront(&value);
+                    ++numPopped;
+                }
+                else {
+                    buffer.clear();
+                    mX.popFront(batch, &buffer);
+                    numPopped += static_cast<int>(buffer.size());
+                }
+            }
+
+            bslmt::ThreadUtil::join(handle);
+
+            bsls::TimeInterval elapsed = bsls::SystemTime::nowMonotonicClock()
+                                       - startTime;
+
+            cout << "batch size " << batch << ": "
+                 << elapsed.totalSecondsAsDouble() * 1.0e9 / numValues
+                 << " ns/element" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -29,6 +29,13 @@ BSLS_IDENT("$Id: $")
 // provided.  The 'tryPopFront' method fails immediately, returning a non-zero
 // value, if the queue is empty.
 //
+// Batch variants of these methods are also provided: 'pushBack' and
+// 'tryPushBack' accept a range of elements, and 'popFront' and 'tryPopFront'
+// accept a maximum number of elements and a 'bsl::vector' to which the removed
+// elements are appended.  The batch methods update the shared state of the
+// queue once per call rather than once per element, and are preferable when
+// elements are produced or consumed in groups.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  The queue may be restored to normal
@@ -182,6 +189,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_atomicoperations.h>
 
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+
 namespace BloombergLP {
 namespace bdlcc {
 
@@ -248,6 +258,16 @@ class SingleProducerQueue {
         // Threads blocked due to the queue being empty will return
         // 'e_DISABLED' if 'disablePopFront' is invoked.
 
+    int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        // Remove up to the specified 'maxNumItems' elements from the front of
+        // this queue and append them, in order, to the specified 'buffer'.  If
+        // the queue is empty, block until it is not empty.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_DISABLED' if 'isPopFrontDisabled()'.  On failure, '*buffer' is
+        // not changed.  Threads blocked due to the queue being empty will
+        // return 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior
+        // is undefined unless '0 < maxNumItems'.
+
     int pushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -262,6 +282,14 @@ class SingleProducerQueue {
         // changed.  The behavior is undefined unless the invoker of this
         // method is the single producer.
 
+    template <class INPUT_ITER>
+    int pushBack(INPUT_ITER begin, INPUT_ITER end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()'.  The behavior is undefined unless the
+        // invoker of this method is the single producer.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -276,6 +304,16 @@ class SingleProducerQueue {
         // 'isPopFrontDisabled()', and 'e_EMPTY' if '!isPopFrontDisabled()' and
         // the queue was empty.  On failure, 'value' is not changed.
 
+    int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        // Attempt to remove up to the specified 'maxNumItems' elements from
+        // the front of this queue without blocking, and, if successful, append
+        // the removed elements, in order, to the specified 'buffer'.  Return 0
+        // on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_DISABLED' if 'isPopFrontDisabled()', and 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty.  On failure,
+        // '*buffer' is not changed.  The behavior is undefined unless
+        // '0 < maxNumItems'.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -290,6 +328,14 @@ class SingleProducerQueue {
         // changed.  The behavior is undefined unless the invoker of this
         // method is the single producer.
 
+    template <class INPUT_ITER>
+    int tryPushBack(INPUT_ITER begin, INPUT_ITER end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()'.  The behavior is undefined unless the
+        // invoker of this method is the single producer.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -381,6 +427,13 @@ int SingleProducerQueue<TYPE>::popFront(TYPE *value)
     return d_impl.popFront(value);
 }
 
+template <class TYPE>
+int SingleProducerQueue<TYPE>::popFront(bsl::size_t        maxNumItems,
+                                        bsl::vector<TYPE> *buffer)
+{
+    return d_impl.popFront(maxNumItems, buffer);
+}
+
 template <class TYPE>
 int SingleProducerQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -393,6 +446,14 @@ int SingleProducerQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+template <class INPUT_ITER>
+int SingleProducerQueue<TYPE>::pushBack(INPUT_ITER begin,
+                                        INPUT_ITER end)
+{
+    return d_impl.pushBack(begin, end);
+}
+
 template <class TYPE>
 void SingleProducerQueue<TYPE>::removeAll()
 {
@@ -405,6 +466,13 @@ int SingleProducerQueue<TYPE>::tryPopFront(TYPE *value)
     return d_impl.tryPopFront(value);
 }
 
+template <class TYPE>
+int SingleProducerQueue<TYPE>::tryPopFront(bsl::size_t        maxNumItems,
+                                           bsl::vector<TYPE> *buffer)
+{
+    return d_impl.tryPopFront(maxNumItems, buffer);
+}
+
 template <class TYPE>
 int SingleProducerQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -417,6 +485,14 @@ int SingleProducerQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.tryPushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+template <class INPUT_ITER>
+int SingleProducerQueue<TYPE>::tryPushBack(INPUT_ITER begin,
+                                           INPUT_ITER end)
+{
+    return d_impl.tryPushBack(begin, end);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE>
@@ -79,12 +79,16 @@ using namespace bsl;
 // [ 5] SingleProducerQueue(capacity, *bA = 0);
 // [ 2] ~SingleProducerQueue();
 // [ 2] int popFront(TYPE *value);
+// [13] int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int pushBack(INPUT_ITER begin, INPUT_ITER end);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [13] int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [13] int tryPushBack(INPUT_ITER begin, INPUT_ITER end);
 // [ 6] void disablePopFront();
 // [ 6] void disablePushBack();
 // [ 6] void enablePopFront();
@@ -98,7 +102,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -893,7 +897,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -930,6 +934,61 @@ int main(int argc, char *argv[])
         s_continue = 0;
 
         bslmt::ThreadUtil::join(watchdogHandle);
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //   The batch methods forward to the implementation.
+        //
+        // Concerns:
+        //: 1 The batch methods forward to the corresponding methods of the
+        //:   implementation and report their results.
+        //
+        // Plan:
+        //: 1 Push ranges and pop batches, verifying the removed values and
+        //:   the return values, including in the enqueue and dequeue disabled
+        //:   states.  (C-1)
+        //
+        // Testing:
+        //   int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        //   int pushBack(INPUT_ITER begin, INPUT_ITER end);
+        //   int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *bf);
+        //   int tryPushBack(INPUT_ITER begin, INPUT_ITER end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        bsl::vector<int> input;
+        for (int i = 0; i < 10; ++i) {
+            input.push_back(i);
+        }
+
+        ASSERT(e_SUCCESS == mX.pushBack(input.begin(), input.begin() + 6));
+        ASSERT(e_SUCCESS == mX.tryPushBack(input.begin() + 6, input.end()));
+        ASSERT(10 == X.numElements());
+
+        bsl::vector<int> buffer;
+
+        ASSERT(e_SUCCESS == mX.popFront(4, &buffer));
+        ASSERT(4 == buffer.size());
+        ASSERT(e_SUCCESS == mX.tryPopFront(8, &buffer));
+        ASSERT(input == buffer);
+        ASSERT(e_EMPTY == mX.tryPopFront(8, &buffer));
+
+        mX.disablePushBack();
+        ASSERT(e_DISABLED == mX.pushBack(input.begin(), input.end()));
+        ASSERT(e_DISABLED == mX.tryPushBack(input.begin(), input.end()));
+
+        mX.disablePopFront();
+        ASSERT(e_DISABLED == mX.popFront(4, &buffer));
+        ASSERT(e_DISABLED == mX.tryPopFront(4, &buffer));
+        ASSERT(10 == buffer.size());
 
       } break;
       case 12: {
@@ -40,6 +40,14 @@ BSLS_IDENT("$Id: $")
 // blocked in 'popFront' when the queue is dequeue disabled return from
 // 'popFront' immediately and return an error code.
 //
+// Batch variants of these methods are provided for transferring many elements
+// per call: 'pushBack' and 'tryPushBack' accept a range of elements, and
+// 'popFront' and 'tryPopFront' accept a maximum number of elements and a
+// 'bsl::vector' to which the removed elements are appended.  A batch "push"
+// publishes all of its elements with a single update of the queue state and
+// wakes at most one blocked thread, and a batch "pop" reserves and claims its
+// elements with a single update of the queue state and of the read position.
+//
 ///Exception safety
 ///----------------
 // A 'bdlcc::SingleProducerQueueImpl' is exception neutral, and all of the
@@ -87,7 +95,9 @@ BSLS_IDENT("$Id: $")
 #include <bsls_objectbuffer.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlcc {
@@ -163,6 +173,80 @@ class SingleProducerQueueImpl_PopCompleteGuard {
         // the managed 'node'.
 };
 
+           // ===================================================
+           // class SingleProducerQueueImpl_PopBatchCompleteGuard
+           // ===================================================
+
+template <class TYPE, class NODE>
+class SingleProducerQueueImpl_PopBatchCompleteGuard {
+    // This class implements a guard that automatically invokes
+    // 'popBatchComplete' on a sequence of 'NODE' objects upon destruction.
+
+    // DATA
+    TYPE        *d_queue_p;   // managed queue owning the managed nodes
+    NODE        *d_node_p;    // first managed node
+    bsl::size_t  d_numNodes;  // number of managed nodes
+    bool         d_isEmpty;   // if true, the empty condition will be signalled
+
+    // NOT IMPLEMENTED
+    SingleProducerQueueImpl_PopBatchCompleteGuard();
+    SingleProducerQueueImpl_PopBatchCompleteGuard(
+                         const SingleProducerQueueImpl_PopBatchCompleteGuard&);
+    SingleProducerQueueImpl_PopBatchCompleteGuard& operator=(
+                         const SingleProducerQueueImpl_PopBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+    SingleProducerQueueImpl_PopBatchCompleteGuard(TYPE        *queue,
+                                                  NODE        *node,
+                                                  bsl::size_t  numNodes,
+                                                  bool         isEmpty);
+        // Create a 'popBatchComplete' guard managing the specified 'queue' and
+        // the specified 'numNodes' nodes starting with the specified 'node'
+        // that will cause the empty condition to be signalled if the
+        // specified 'isEmpty' is 'true'.
+
+    ~SingleProducerQueueImpl_PopBatchCompleteGuard();
+        // Destroy this object and invoke the 'TYPE::popBatchComplete' method
+        // with the managed nodes.
+};
+
+           // ====================================================
+           // class SingleProducerQueueImpl_PushBatchCompleteGuard
+           // ====================================================
+
+template <class TYPE>
+class SingleProducerQueueImpl_PushBatchCompleteGuard {
+    // This class implements a guard that automatically invokes
+    // 'pushBatchComplete' on the managed queue, supplying the number of
+    // elements written, upon destruction.
+
+    // DATA
+    TYPE        *d_queue_p;    // managed queue
+    bsl::size_t  d_numPushed;  // number of elements written
+
+    // NOT IMPLEMENTED
+    SingleProducerQueueImpl_PushBatchCompleteGuard();
+    SingleProducerQueueImpl_PushBatchCompleteGuard(
+                        const SingleProducerQueueImpl_PushBatchCompleteGuard&);
+    SingleProducerQueueImpl_PushBatchCompleteGuard& operator=(
+                        const SingleProducerQueueImpl_PushBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+    explicit
+    SingleProducerQueueImpl_PushBatchCompleteGuard(TYPE *queue);
+        // Create a 'pushBatchComplete' guard managing the specified 'queue'.
+
+    ~SingleProducerQueueImpl_PushBatchCompleteGuard();
+        // Destroy this object and invoke the 'pushBatchComplete' method on the
+        // managed queue.
+
+    // MANIPULATORS
+    void incrementNumPushed();
+        // Increment the number of elements written.
+};
+
                       // =============================
                       // class SingleProducerQueueImpl
                       // =============================
@@ -267,6 +351,22 @@ class SingleProducerQueueImpl {
                                                             MUTEX,
                                                             CONDITION>::Node >;
 
+    friend class SingleProducerQueueImpl_PopBatchCompleteGuard<
+                           SingleProducerQueueImpl<TYPE,
+                                                   ATOMIC_OP,
+                                                   MUTEX,
+                                                   CONDITION>,
+                           typename SingleProducerQueueImpl<TYPE,
+                                                            ATOMIC_OP,
+                                                            MUTEX,
+                                                            CONDITION>::Node >;
+
+    friend class SingleProducerQueueImpl_PushBatchCompleteGuard<
+                                          SingleProducerQueueImpl<TYPE,
+                                                                  ATOMIC_OP,
+                                                                  MUTEX,
+                                                                  CONDITION> >;
+
     // PRIVATE CLASS METHODS
     static bool allElementsReserved(bsls::Types::Int64 state);
         // Return 'true' if the specified 'state' implies all elements in the
@@ -294,6 +394,22 @@ class SingleProducerQueueImpl {
         // will have one or more threads blocked in a dequeue operation.
 
     // PRIVATE MANIPULATORS
+    int acquireElement(unsigned int generation, bsls::Types::Int64 *state);
+        // Reserve an element for a dequeue operation, blocking until an
+        // element is available, and load into the specified 'state' the state
+        // of the queue after the reservation.  Return 0 on success, and
+        // 'e_DISABLED' if the specified 'generation' is not the current
+        // dequeue generation (i.e., 'disablePopFront' has been invoked).
+
+    bsl::size_t acquireElements(bsl::size_t         maxNumItems,
+                                bsls::Types::Int64 *state);
+        // Reserve, without blocking, up to the specified 'maxNumItems'
+        // elements for a dequeue operation, using a single update of the queue
+        // state, and load into the specified 'state' the state of the queue
+        // after the reservation.  Return the number of elements reserved.
+        // Note that elements are not reserved if they are required to supply
+        // threads blocked in 'popFront'.
+
     void incrementUntil(AtomicUint *value, unsigned int bitValue);
         // If the specified 'value' does not have its lowest-order bit set to
         // the value of the specified 'bitValue', increment 'value' until it
@@ -308,12 +424,37 @@ class SingleProducerQueueImpl {
         // a guard to complete the reclamation of a node in the presence of an
         // exception.
 
+    void popBatchComplete(Node *node, bsl::size_t numNodes, bool isEmpty);
+        // Destruct the values stored in the specified 'numNodes' nodes
+        // starting with the specified 'node', mark the nodes writable, and if
+        // the specified 'isEmpty' is 'true' then signal the queue empty
+        // condition.  This method is used within 'popFrontBatchRaw' by a guard
+        // to complete the reclamation of the nodes in the presence of an
+        // exception.
+
+    void popFrontBatchRaw(bsl::size_t        numItems,
+                          bsl::vector<TYPE> *buffer,
+                          bool               isEmpty);
+        // Remove the specified 'numItems' elements, without verifying the
+        // availability of the elements, from the front of this queue, append
+        // them, in order, to the specified 'buffer', and if the specified
+        // 'isEmpty' is 'true' then signal the queue empty condition.  Note
+        // that all of the nodes are claimed with a single update of the read
+        // position.
+
     void popFrontRaw(TYPE* value, bool isEmpty);
         // Remove the element, without verifying the availability of the
         // element, from the front of this queue, load that element into the
         // specified 'value', and if the specified 'isEmpty' is 'true' then
         // signal the queue empty condition.
 
+    void pushBatchComplete(bsl::size_t numPushed);
+        // Make the specified 'numPushed' elements most recently written by the
+        // single producer available for dequeue operations, and signal a
+        // blocked thread if appropriate.  This method is used within the range
+        // 'pushBack' by a guard to publish the written elements even in the
+        // presence of an exception.
+
     void releaseAllRaw();
         // Return all memory to the allocator.  This method is intended to be
         // used by the destructor and to avoid a memory leak when there is an
@@ -364,6 +505,16 @@ class SingleProducerQueueImpl {
         // Threads blocked due to the queue being empty will return
         // 'e_DISABLED' if 'disablePopFront' is invoked.
 
+    int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        // Remove up to the specified 'maxNumItems' elements from the front of
+        // this queue and append them, in order, to the specified 'buffer'.  If
+        // the queue is empty, block until it is not empty.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_DISABLED' if 'isPopFrontDisabled()'.  On failure, '*buffer' is
+        // not changed.  Threads blocked due to the queue being empty will
+        // return 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior
+        // is undefined unless '0 < maxNumItems'.
+
     int pushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -378,6 +529,16 @@ class SingleProducerQueueImpl {
         // changed.  The behavior is undefined unless the invoker of this
         // method is the single producer.
 
+    template <class INPUT_ITER>
+    int pushBack(INPUT_ITER begin, INPUT_ITER end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()'.  The behavior is undefined unless the
+        // invoker of this method is the single producer.  Note that the
+        // elements are made available to consumers with a single update of
+        // the queue state once the entire range has been written.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -392,6 +553,16 @@ class SingleProducerQueueImpl {
         // 'isPopFrontDisabled()', and 'e_EMPTY' if '!isPopFrontDisabled()' and
         // the queue was empty.  On failure, 'value' is not changed.
 
+    int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        // Attempt to remove up to the specified 'maxNumItems' elements from
+        // the front of this queue without blocking, and, if successful, append
+        // the removed elements, in order, to the specified 'buffer'.  Return 0
+        // on success, and a non-zero value otherwise.  Specifically, return
+        // 'e_DISABLED' if 'isPopFrontDisabled()', and 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty.  On failure,
+        // '*buffer' is not changed.  The behavior is undefined unless
+        // '0 < maxNumItems'.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -406,6 +577,14 @@ class SingleProducerQueueImpl {
         // changed.  The behavior is undefined unless the invoker of this
         // method is the single producer.
 
+    template <class INPUT_ITER>
+    int tryPushBack(INPUT_ITER begin, INPUT_ITER end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()'.  The behavior is undefined unless the
+        // invoker of this method is the single producer.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -520,6 +699,58 @@ SingleProducerQueueImpl_PopCompleteGuard<TYPE, NODE>::
     d_queue_p->popComplete(d_node_p, d_isEmpty);
 }
 
+           // ---------------------------------------------------
+           // class SingleProducerQueueImpl_PopBatchCompleteGuard
+           // ---------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+SingleProducerQueueImpl_PopBatchCompleteGuard<TYPE, NODE>::
+           SingleProducerQueueImpl_PopBatchCompleteGuard(TYPE        *queue,
+                                                         NODE        *node,
+                                                         bsl::size_t  numNodes,
+                                                         bool         isEmpty)
+: d_queue_p(queue)
+, d_node_p(node)
+, d_numNodes(numNodes)
+, d_isEmpty(isEmpty)
+{
+}
+
+template <class TYPE, class NODE>
+SingleProducerQueueImpl_PopBatchCompleteGuard<TYPE, NODE>::
+                               ~SingleProducerQueueImpl_PopBatchCompleteGuard()
+{
+    d_queue_p->popBatchComplete(d_node_p, d_numNodes, d_isEmpty);
+}
+
+           // ----------------------------------------------------
+           // class SingleProducerQueueImpl_PushBatchCompleteGuard
+           // ----------------------------------------------------
+
+// CREATORS
+template <class TYPE>
+SingleProducerQueueImpl_PushBatchCompleteGuard<TYPE>::
+                    SingleProducerQueueImpl_PushBatchCompleteGuard(TYPE *queue)
+: d_queue_p(queue)
+, d_numPushed(0)
+{
+}
+
+template <class TYPE>
+SingleProducerQueueImpl_PushBatchCompleteGuard<TYPE>::
+                              ~SingleProducerQueueImpl_PushBatchCompleteGuard()
+{
+    d_queue_p->pushBatchComplete(d_numPushed);
+}
+
+// MANIPULATORS
+template <class TYPE>
+void SingleProducerQueueImpl_PushBatchCompleteGuard<TYPE>::incrementNumPushed()
+{
+    ++d_numPushed;
+}
+
                       // -----------------------------
                       // class SingleProducerQueueImpl
                       // -----------------------------
@@ -575,6 +806,79 @@ bool SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
 }
 
 // PRIVATE MANIPULATORS
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::acquireElement(
+                                             unsigned int        generation,
+                                             bsls::Types::Int64 *state)
+{
+    *state = ATOMIC_OP::addInt64NvAcqRel(&d_state, -k_AVAILABLE_INC);
+
+    if (willHaveBlockedThread(*state)) {
+        bslmt::ThreadUtil::yield();
+        *state = ATOMIC_OP::getInt64Acquire(&d_state);
+        if (willHaveBlockedThread(*state)) {
+            {
+                bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+
+                *state = ATOMIC_OP::addInt64NvAcqRel(
+                                              &d_state,
+                                              k_AVAILABLE_INC + k_BLOCKED_INC);
+
+                while (isEmpty(*state)) {
+                    if (generation !=
+                              ATOMIC_OP::getUintAcquire(&d_popFrontDisabled)) {
+                        ATOMIC_OP::addInt64AcqRel(&d_state, -k_BLOCKED_INC);
+                        return e_DISABLED;                            // RETURN
+                    }
+                    d_readCondition.wait(&d_readMutex);
+                    *state = ATOMIC_OP::getInt64Acquire(&d_state);
+                }
+
+                *state = ATOMIC_OP::addInt64NvAcqRel(
+                                           &d_state,
+                                           -(k_AVAILABLE_INC + k_BLOCKED_INC));
+            }
+            if (canSupplyBlockedThread(*state)) {
+                d_readCondition.signal();
+            }
+        }
+    }
+
+    return 0;
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+bsl::size_t SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                               acquireElements(bsl::size_t         maxNumItems,
+                                               bsls::Types::Int64 *state)
+{
+    bsls::Types::Int64 expState;
+    bsls::Types::Int64 numItems;
+
+    *state = ATOMIC_OP::getInt64Acquire(&d_state);
+    do {
+        // Elements required to supply blocked threads are not available.
+
+        numItems = getAvailable(*state) - (*state & k_BLOCKED_MASK);
+        if (0 >= numItems) {
+            return 0;                                                 // RETURN
+        }
+        if (static_cast<bsls::Types::Uint64>(numItems) > maxNumItems) {
+            numItems = static_cast<bsls::Types::Int64>(maxNumItems);
+        }
+
+        expState = *state;
+        *state   = ATOMIC_OP::testAndSwapInt64AcqRel(
+                                        &d_state,
+                                        expState,
+                                        expState - k_AVAILABLE_INC * numItems);
+    } while (expState != *state);
+
+    *state -= k_AVAILABLE_INC * numItems;
+
+    return static_cast<bsl::size_t>(numItems);
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
                      ::incrementUntil(AtomicUint *value, unsigned int bitValue)
@@ -608,6 +912,82 @@ void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
 
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                        popBatchComplete(Node        *node,
+                                                         bsl::size_t  numNodes,
+                                                         bool         isEmpty)
+{
+    for (bsl::size_t i = 0; i < numNodes; ++i) {
+        // Obtain the next node before marking 'node' writable; once writable,
+        // the producer may modify the node.
+
+        Node *next = static_cast<Node *>(
+                                      ATOMIC_OP::getPtrAcquire(&node->d_next));
+
+        node->d_value.object().~TYPE();
+
+        ATOMIC_OP::setIntRelease(&node->d_state, e_WRITABLE);
+
+        node = next;
+    }
+
+    if (isEmpty) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_emptyMutex);
+        }
+        d_emptyCondition.broadcast();
+    }
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                  popFrontBatchRaw(bsl::size_t        numItems,
+                                                   bsl::vector<TYPE> *buffer,
+                                                   bool               isEmpty)
+{
+    Node *readFrom =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+
+    Node *exp;
+    do {
+        Node *next = readFrom;
+        for (bsl::size_t i = 0; i < numItems; ++i) {
+            next = static_cast<Node *>(
+                                      ATOMIC_OP::getPtrAcquire(&next->d_next));
+        }
+
+        exp      = readFrom;
+        readFrom = static_cast<Node *>(ATOMIC_OP::testAndSwapPtrAcqRel(
+                                                                   &d_nextRead,
+                                                                   readFrom,
+                                                                   next));
+    } while (readFrom != exp);
+
+    SingleProducerQueueImpl_PopBatchCompleteGuard<
+                                          SingleProducerQueueImpl <TYPE,
+                                                                   ATOMIC_OP,
+                                                                   MUTEX,
+                                                                   CONDITION>,
+                                          Node> guard(this,
+                                                      readFrom,
+                                                      numItems,
+                                                      isEmpty);
+
+    buffer->reserve(buffer->size() + numItems);
+
+    Node *node = readFrom;
+    for (bsl::size_t i = 0; i < numItems; ++i) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        buffer->push_back(
+                        bslmf::MovableRefUtil::move(node->d_value.object()));
+#else
+        buffer->push_back(node->d_value.object());
+#endif
+        node = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&node->d_next));
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
                                           popFrontRaw(TYPE *value,
@@ -642,6 +1022,37 @@ void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
 #endif
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                                       pushBatchComplete(bsl::size_t numPushed)
+{
+    if (0 == numPushed) {
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::Int64 numAdded =
+                                   static_cast<bsls::Types::Int64>(numPushed);
+
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(
+                                                  &d_state,
+                                                  k_AVAILABLE_INC * numAdded);
+
+    // As in the single-element 'pushBack', signal only when the update made
+    // an element available for a blocked thread; a woken thread signals the
+    // next blocked thread if more elements remain.
+
+    const bsls::Types::Int64 available = getAvailable(state);
+
+    if (   (state & k_BLOCKED_MASK)
+        && 0 < available
+        && available <= numAdded) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+        }
+        d_readCondition.signal();
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
                                                                 releaseAllRaw()
@@ -784,41 +1195,42 @@ int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
         return e_DISABLED;                                            // RETURN
     }
 
-    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(&d_state,
-                                                           -k_AVAILABLE_INC);
+    bsls::Types::Int64 state;
 
-    if (willHaveBlockedThread(state)) {
-        bslmt::ThreadUtil::yield();
-        state = ATOMIC_OP::getInt64Acquire(&d_state);
-        if (willHaveBlockedThread(state)) {
-            {
-                bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+    if (acquireElement(generation, &state)) {
+        return e_DISABLED;                                            // RETURN
+    }
 
-                state = ATOMIC_OP::addInt64NvAcqRel(
-                                              &d_state,
-                                              k_AVAILABLE_INC + k_BLOCKED_INC);
+    popFrontRaw(value, isEmpty(state));
 
-                while (isEmpty(state)) {
-                    if (generation !=
-                              ATOMIC_OP::getUintAcquire(&d_popFrontDisabled)) {
-                        ATOMIC_OP::addInt64AcqRel(&d_state, -k_BLOCKED_INC);
-                        return e_DISABLED;                            // RETURN
-                    }
-                    d_readCondition.wait(&d_readMutex);
-                    state = ATOMIC_OP::getInt64Acquire(&d_state);
-                }
+    return 0;
+}
 
-                state = ATOMIC_OP::addInt64NvAcqRel(
-                                           &d_state,
-                                           -(k_AVAILABLE_INC + k_BLOCKED_INC));
-            }
-            if (canSupplyBlockedThread(state)) {
-                d_readCondition.signal();
-            }
-        }
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
+                                                bsl::size_t        maxNumItems,
+                                                bsl::vector<TYPE> *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return e_DISABLED;                                            // RETURN
     }
 
-    popFrontRaw(value, isEmpty(state));
+    bsls::Types::Int64 state;
+
+    if (acquireElement(generation, &state)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    bsl::size_t numItems = 1;
+    if (1 < maxNumItems) {
+        numItems += acquireElements(maxNumItems - 1, &state);
+    }
+
+    popFrontBatchRaw(numItems, buffer, isEmpty(state));
 
     return 0;
 }
@@ -914,6 +1326,55 @@ int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class INPUT_ITER>
+int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
+                                                              INPUT_ITER begin,
+                                                              INPUT_ITER end)
+{
+    if (1 == (ATOMIC_OP::getUintAcquire(&d_pushBackDisabled) & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    SingleProducerQueueImpl_PushBatchCompleteGuard<
+                                          SingleProducerQueueImpl <TYPE,
+                                                                   ATOMIC_OP,
+                                                                   MUTEX,
+                                                                   CONDITION> >
+                                                                   guard(this);
+
+    for (; begin != end; ++begin) {
+        Node *nextWrite = static_cast<Node *>(
+                                       ATOMIC_OP::getPtrAcquire(&d_nextWrite));
+
+        Node *next = static_cast<Node *>(
+                                 ATOMIC_OP::getPtrAcquire(&nextWrite->d_next));
+
+        if (e_WRITABLE != ATOMIC_OP::getIntAcquire(&next->d_state)) {
+            Node *n = static_cast<Node *>(
+                                       d_allocator_p->allocate(sizeof(Node)));
+
+            ATOMIC_OP::initInt(&n->d_state, e_WRITABLE);
+            ATOMIC_OP::initPointer(&n->d_next, next);
+
+            ATOMIC_OP::setPtrRelease(&nextWrite->d_next, n);
+
+            next = n;
+        }
+
+        bslalg::ScalarPrimitives::copyConstruct(nextWrite->d_value.address(),
+                                                *begin,
+                                                d_allocator_p);
+
+        ATOMIC_OP::setIntRelease(&nextWrite->d_state, e_READABLE);
+        ATOMIC_OP::setPtrRelease(&d_nextWrite, next);
+
+        guard.incrementNumPushed();
+    }
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
                                                                    TYPE *value)
@@ -957,6 +1418,31 @@ int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
+                                                bsl::size_t        maxNumItems,
+                                                bsl::vector<TYPE> *buffer)
+{
+    BSLS_ASSERT(0 < maxNumItems);
+    BSLS_ASSERT(buffer);
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    bsls::Types::Int64 state;
+
+    bsl::size_t numItems = acquireElements(maxNumItems, &state);
+    if (0 == numItems) {
+        return e_EMPTY;                                               // RETURN
+    }
+
+    popFrontBatchRaw(numItems, buffer, isEmpty(state));
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
                                                              const TYPE& value)
@@ -971,6 +1457,15 @@ int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
     return pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class INPUT_ITER>
+int SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
+                                                              INPUT_ITER begin,
+                                                              INPUT_ITER end)
+{
+    return pushBack(begin, end);
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleProducerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::removeAll()
 {
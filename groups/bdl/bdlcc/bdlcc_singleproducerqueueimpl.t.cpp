@@ -26,6 +26,7 @@
 #include <bsltf_moveonlyalloctesttype.h>
 #include <bsltf_movablealloctesttype.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
 #include <bsl_string.h>
@@ -76,12 +77,16 @@ using namespace bsl;
 // [ 5] SingleProducerQueueImpl(capacity, *bA = 0);
 // [ 2] ~SingleProducerQueueImpl();
 // [ 2] int popFront(TYPE *value);
+// [14] int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [14] int pushBack(INPUT_ITER begin, INPUT_ITER end);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [14] int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [14] int tryPushBack(INPUT_ITER begin, INPUT_ITER end);
 // [ 6] void disablePopFront();
 // [ 6] void disablePushBack();
 // [ 6] void enablePopFront();
@@ -102,6 +107,7 @@ using namespace bsl;
 // [11] CONCERN: template requirements
 // [12] CONCERN: ordering guarantee
 // [13] CONCERN: 'numElements' is not lower-bound due to 'tryPopFront'
+// [-1] BATCH SIZE PERFORMANCE TEST
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -989,6 +995,54 @@ extern "C" void *tryPopFront(void *arg)
 
 } // close namespace Case13
 
+namespace Case14 {
+
+const int k_NUM_VALUES = 20000;  // number of values pushed by the producer
+
+struct PopData {
+    Obj              *d_obj_p;       // queue under test
+    bsl::size_t       d_batchSize;   // maximum number of elements per pop
+    bsls::AtomicInt  *d_seen_p;      // number of times each value was popped
+    bsls::AtomicInt  *d_numPopped_p; // total number of values popped
+};
+
+extern "C" void *batchPop(void *arg)
+{
+    PopData& data = *static_cast<PopData *>(arg);
+
+    bsl::vector<int> buffer;
+
+    while (0 == data.d_obj_p->popFront(data.d_batchSize, &buffer)) {
+        ASSERT(0 < buffer.size());
+        ASSERT(data.d_batchSize >= buffer.size());
+
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            if (0 < i) {
+                ASSERTV(buffer[i - 1], buffer[i], buffer[i - 1] < buffer[i]);
+            }
+            ++data.d_seen_p[buffer[i]];
+        }
+        data.d_numPopped_p->add(static_cast<int>(buffer.size()));
+        buffer.clear();
+    }
+
+    return 0;
+}
+
+extern "C" void *blockedBatchPop(void *arg)
+{
+    Obj& mX = *static_cast<Obj *>(arg);
+
+    bsl::vector<int> buffer;
+
+    ASSERT(e_SUCCESS == mX.popFront(4, &buffer));
+    ASSERT(0 < buffer.size());
+
+    return 0;
+}
+
+}  // close namespace Case14
+
 // ============================================================================
 //               GENERATOR FUNCTIONS 'gg' AND 'ggg' FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1107,6 +1161,246 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 14: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //   The batch methods transfer many elements per call.
+        //
+        // Concerns:
+        //: 1 The range 'pushBack' and 'tryPushBack' append all elements, in
+        //:   order, and the batch 'popFront' and 'tryPopFront' remove up to
+        //:   the requested number of elements, in order, appending them to
+        //:   the buffer.
+        //:
+        //: 2 The batch methods respect the enqueue and dequeue disabled
+        //:   states, and do not modify the buffer on failure.
+        //:
+        //: 3 A thread blocked in 'popFront' is released by a range 'pushBack'
+        //:   and by 'disablePopFront'.
+        //:
+        //: 4 If an exception is thrown while copying an element of the range,
+        //:   the elements already written are available to consumers.
+        //:
+        //: 5 With concurrent consumers, every element is removed exactly once
+        //:   and the elements removed by one 'popFront' are in order.
+        //
+        // Plan:
+        //: 1 Push ranges of varying length and pop batches of varying size,
+        //:   verifying the number and the values of the removed elements.
+        //:   (C-1)
+        //:
+        //: 2 Disable the queue and verify the return values and that the
+        //:   buffer is unchanged.  (C-2)
+        //:
+        //: 3 Block a thread in the batch 'popFront' and release it with a
+        //:   range 'pushBack', then again with 'disablePopFront'.  (C-3)
+        //:
+        //: 4 Use a test allocator with an allocation limit and a type that
+        //:   allocates on copy to force an exception during the range
+        //:   'pushBack', and verify the number of elements in the queue.
+        //:   (C-4)
+        //:
+        //: 5 Pop with several threads while a single thread pushes ranges,
+        //:   and verify every value is popped exactly once.  (C-5)
+        //
+        // Testing:
+        //   int popFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *buffer);
+        //   int pushBack(INPUT_ITER begin, INPUT_ITER end);
+        //   int tryPopFront(bsl::size_t maxNumItems, bsl::vector<TYPE> *bf);
+        //   int tryPushBack(INPUT_ITER begin, INPUT_ITER end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "Single-threaded batches." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            for (bsl::size_t batch = 1; batch <= 16; ++batch) {
+                Obj mX(4, &oa);  const Obj& X = mX;
+
+                bsl::vector<int> input;
+                for (int i = 0; i < 40; ++i) {
+                    input.push_back(i);
+                }
+
+                ASSERTV(batch, e_SUCCESS == mX.pushBack(input.begin(),
+                                                        input.begin() + 20));
+                ASSERTV(batch, e_SUCCESS == mX.tryPushBack(input.begin() + 20,
+                                                           input.end()));
+                ASSERTV(batch, 40 == X.numElements());
+
+                bsl::vector<int> buffer;
+                int              expected = 0;
+                while (expected < 40) {
+                    const bsl::size_t size = buffer.size();
+                    const int         rv   = expected % 2
+                                           ? mX.tryPopFront(batch, &buffer)
+                                           : mX.popFront(batch, &buffer);
+
+                    ASSERTV(batch, e_SUCCESS == rv);
+
+                    const bsl::size_t numPopped = buffer.size() - size;
+                    ASSERTV(batch, numPopped,
+                            bsl::min<bsl::size_t>(batch, 40 - expected)
+                                                                 == numPopped);
+
+                    for (bsl::size_t i = size; i < buffer.size(); ++i) {
+                        ASSERTV(batch, expected == buffer[i]);
+                        ++expected;
+                    }
+                }
+                ASSERTV(batch, 0 == X.numElements());
+                ASSERTV(batch, e_EMPTY == mX.tryPopFront(batch, &buffer));
+                ASSERTV(batch, 40 == buffer.size());
+
+                // empty range
+
+                ASSERTV(batch, e_SUCCESS == mX.pushBack(input.begin(),
+                                                        input.begin()));
+                ASSERTV(batch, 0 == X.numElements());
+            }
+        }
+
+        if (verbose) cout << "Disabled queue." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            bsl::vector<int> input(5, 7);
+            bsl::vector<int> buffer(1, 3);
+
+            mX.disablePushBack();
+
+            ASSERT(e_DISABLED == mX.pushBack(input.begin(), input.end()));
+            ASSERT(e_DISABLED == mX.tryPushBack(input.begin(), input.end()));
+            ASSERT(0 == X.numElements());
+
+            mX.enablePushBack();
+            ASSERT(e_SUCCESS == mX.pushBack(input.begin(), input.end()));
+
+            mX.disablePopFront();
+
+            ASSERT(e_DISABLED == mX.popFront(3, &buffer));
+            ASSERT(e_DISABLED == mX.tryPopFront(3, &buffer));
+            ASSERT(1 == buffer.size());
+            ASSERT(5 == X.numElements());
+        }
+
+        if (verbose) cout << "Blocked batch 'popFront'." << endl;
+        {
+            Obj mX;
+
+            bsl::vector<int> input(3, 1);
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, Case14::blockedBatchPop, &mX);
+
+            bslmt::ThreadUtil::microSleep(100000);
+
+            ASSERT(e_SUCCESS == mX.pushBack(input.begin(), input.end()));
+
+            bslmt::ThreadUtil::join(handle);
+
+            mX.removeAll();
+
+            bslmt::ThreadUtil::create(&handle, deferredDisablePopFront, &mX);
+
+            bsl::vector<int> buffer;
+
+            ASSERT(e_DISABLED == mX.popFront(4, &buffer));
+            ASSERT(buffer.empty());
+
+            bslmt::ThreadUtil::join(handle);
+        }
+
+        if (verbose) cout << "Exception during range 'pushBack'." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bdlcc::SingleProducerQueueImpl<AllocExceptionHelper,
+                                           bsls::AtomicOperations,
+                                           bslmt::Mutex,
+                                           bslmt::Condition> mX(8, &oa);
+
+            bsl::vector<AllocExceptionHelper> input(4, AllocExceptionHelper(
+                                                                         &oa),
+                                                    &oa);
+
+            oa.setAllocationLimit(2);
+
+            bool caught = false;
+            try {
+                mX.pushBack(input.begin(), input.end());
+            }
+            catch (...) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            oa.setAllocationLimit(-1);
+
+            ASSERT(2 == mX.numElements());
+
+            bsl::vector<AllocExceptionHelper> buffer(&oa);
+
+            ASSERT(e_SUCCESS == mX.tryPopFront(4, &buffer));
+            ASSERT(2 == buffer.size());
+            ASSERT(0 == mX.numElements());
+        }
+
+        if (verbose) cout << "Concurrent batch 'popFront'." << endl;
+        {
+            const int k_NUM_THREADS = 4;
+
+            Obj mX;  const Obj& X = mX;
+
+            bsl::vector<bsls::AtomicInt> seen(Case14::k_NUM_VALUES);
+            bsls::AtomicInt              numPopped(0);
+
+            Case14::PopData data[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle handle[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                data[i].d_obj_p        = &mX;
+                data[i].d_batchSize    = 1 + 7 * i;
+                data[i].d_seen_p       = &seen[0];
+                data[i].d_numPopped_p  = &numPopped;
+                bslmt::ThreadUtil::create(&handle[i],
+                                          Case14::batchPop,
+                                          &data[i]);
+            }
+
+            bsl::vector<int> input;
+            for (int i = 0; i < Case14::k_NUM_VALUES; ++i) {
+                input.push_back(i);
+            }
+
+            int start = 0;
+            for (int batch = 1; start < Case14::k_NUM_VALUES; ++batch) {
+                const int end = bsl::min(start + batch % 50,
+                                         Case14::k_NUM_VALUES);
+
+                ASSERT(e_SUCCESS == mX.pushBack(input.begin() + start,
+                                                input.begin() + end));
+                start = end;
+            }
+
+            ASSERT(0 == X.waitUntilEmpty());
+
+            mX.disablePopFront();
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handle[i]);
+            }
+
+            ASSERT(Case14::k_NUM_VALUES == numPopped);
+            for (int i = 0; i < Case14::k_NUM_VALUES; ++i) {
+                ASSERTV(i, seen[i], 1 == seen[i]);
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // 'numElements' IS NOT LOWER_BOUND DUE TO 'tryPopFront'
@@ -2888,6 +3182,78 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // BATCH SIZE PERFORMANCE TEST
+        //   Compare the cost per element of the single-element and the batch
+        //   methods.
+        //
+        // Concerns:
+        //: 1 The batch methods reduce the cost per element.
+        //
+        // Plan:
+        //: 1 For a series of batch sizes, push and pop a fixed number of
+        //:   elements with one producer and one consumer thread and report
+        //:   the elapsed time per element.  A batch size of one pushes with
+        //:   the single-element 'pushBack'.
+        //
+        // Testing:
+        //   BATCH SIZE PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "BATCH SIZE PERFORMANCE TEST" << endl
+             << "===========================" << endl;
+
+        const int numValues = 1 << 22;
+
+        for (bsl::size_t batch = 1; batch <= 1024; batch *= 2) {
+            Obj mX(4096);
+
+            Case14::PopData data;
+            bsls::AtomicInt numPopped(0);
+            bsl::vector<bsls::AtomicInt> seen(numValues);
+
+            data.d_obj_p       = &mX;
+            data.d_batchSize   = batch;
+            data.d_seen_p      = &seen[0];
+            data.d_numPopped_p = &numPopped;
+
+            bsl::vector<int> input;
+            for (int i = 0; i < static_cast<int>(batch); ++i) {
+                input.push_back(i);
+            }
+
+            bsls::TimeInterval startTime =
+                                         bsls::SystemTime::nowMonotonicClock();
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, Case14::batchPop, &data);
+
+            for (int i = 0; i < numValues; i += static_cast<int>(batch)) {
+                if (1 == batch) {
+                    mX.pushBack(i);
+                }
+                else {
+                    for (bsl::size_t j = 0; j < batch; ++j) {
+                        input[j] = i + static_cast<int>(j);
+                    }
+                    mX.pushBack(input.begin(), input.end());
+                }
+            }
+
+            mX.waitUntilEmpty();
+            mX.disablePopFront();
+            bslmt::ThreadUtil::join(handle);
+
+            bsls::TimeInterval elapsed = bsls::SystemTime::nowMonotonicClock()
+                                       - startTime;
+
+            cout << "batch size " << batch << ": "
+                 << elapsed.totalSecondsAsDouble() * 1.0e9 / numValues
+                 << " ns/element" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,954 @@
+// bdlcc_stripedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_STRIPEDCACHE
+#define INCLUDED_BDLCC_STRIPEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-striped in-process cache for concurrent access.
+//
+//@CLASSES:
+//  bdlcc::StripedCache: in-process key-value cache divided into stripes
+//
+//@SEE_ALSO: bdlcc_cache, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlcc::StripedCache', implementing a thread-safe in-memory key-value cache
+// with a configurable eviction policy whose content is partitioned into a
+// fixed number of independently locked "stripes".  Each stripe is a
+// 'bdlcc::Cache' owning the keys that hash to it, with its own reader-writer
+// lock, hash table, and eviction queue.  Operations on keys that belong to
+// different stripes therefore never contend for the same lock.
+//
+// 'bdlcc::StripedCache' provides the same 'insert', 'insertBulk',
+// 'tryGetValue', 'erase', 'eraseBulk', 'popFront', 'clear', and 'visit'
+// methods as 'bdlcc::Cache', and can be used as a drop-in replacement where
+// the strict global eviction order of 'bdlcc::Cache' is not required.
+//
+///Stripes and Eviction
+///--------------------
+// The number of stripes is fixed at construction and is rounded up to the
+// nearest power of 2.  A key is mapped to a stripe by mixing the value
+// returned by the 'HASH' functor (so that the stripe selection is independent
+// of the hash-table bucket selection within the stripe).
+//
+// The low and high watermarks supplied at construction form a *global*
+// capacity budget that is divided evenly among the stripes: each stripe is
+// given a low watermark of 'ceil(lowWatermark / numStripes())' and a high
+// watermark of 'ceil(highWatermark / numStripes())'.  Eviction is performed
+// independently within each stripe, according to the eviction policy of the
+// cache (the TinyLFU policy keeps a frequency sketch per stripe), so the
+// eviction order is only approximate across the whole cache.  Note that, as a
+// consequence, the total number of items in the cache may exceed
+// 'highWatermark()' by at most 'numStripes() - 1' items before a stripe starts
+// evicting, and that a cache whose keys are unevenly distributed among stripes
+// may evict items before 'highWatermark()' items are stored in total.  For
+// small caches, a smaller number of stripes should be chosen.
+//
+// 'popFront' removes the item at the front of the eviction queue of one
+// stripe, visiting the stripes in a round-robin order so that successive
+// calls drain the stripes evenly.
+//
+///Thread Safety
+///-------------
+// The 'bdlcc::StripedCache' class template is fully thread-safe (see
+// 'bsldoc_glossary') provided that the allocator supplied at construction and
+// the default allocator in effect during the lifetime of cached items are both
+// fully thread-safe.
+//
+///Thread Contention
+///-----------------
+// Each operation on a single key acquires only the lock of the stripe owning
+// that key, following the locking rules described in 'bdlcc_cache' (in
+// particular, 'tryGetValue' on an LRU cache acquires the write lock of the
+// stripe, whereas CLOCK and TinyLFU caches acquire only its read lock).
+// 'size', 'clear', and 'setPostEvictionCallback' lock each stripe in turn.
+// 'insertBulk' and 'eraseBulk' first partition their input by stripe and then
+// lock each affected stripe once.
+//
+// The 'visit' method acquires a read lock on each stripe in turn, so the
+// visitor is never invoked on a consistent snapshot of the entire cache, and
+// items may be added or removed from stripes other than the one being visited
+// while 'visit' is in progress.
+//
+///Post-eviction Callback and Potential Deadlocks
+///---------------------------------------------
+// As for 'bdlcc::Cache', the post-eviction callback is invoked while holding
+// the write lock of the stripe from which the item is evicted.  The cache
+// object itself should not be used in a post-eviction callback; otherwise, a
+// deadlock may result.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Sharing Reference Data Among Many Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service caches security descriptions keyed by an integer
+// identifier, and that the cache is read by many threads concurrently.  A
+// single 'bdlcc::Cache' would serialize all LRU lookups on its write lock, so
+// we use a 'bdlcc::StripedCache' instead.
+//
+// First, we define a 'bdlcc::StripedCache' object, 'myCache', that maps 'int'
+// to 'bsl::string', uses the LRU eviction policy, holds at most 1024 items,
+// and is divided into 8 stripes:
+//..
+//  bdlcc::StripedCache<int, bsl::string> myCache(
+//                                          bdlcc::CacheEvictionPolicy::e_LRU,
+//                                          1024,
+//                                          1024,
+//                                          8,
+//                                          &talloc);
+//  assert(8    == myCache.numStripes());
+//  assert(1024 == myCache.highWatermark());
+//..
+// Then, we insert a few items into the cache:
+//..
+//  myCache.insert(0, "IBM US Equity");
+//  myCache.insert(1, "MSFT US Equity");
+//  myCache.insert(2, "AAPL US Equity");
+//  assert(3 == myCache.size());
+//..
+// Next, we retrieve a value from the cache:
+//..
+//  bsl::shared_ptr<bsl::string> value;
+//  int rc = myCache.tryGetValue(&value, 1);
+//  assert(0 == rc);
+//  assert("MSFT US Equity" == *value);
+//..
+// Then, we look up a key that is not in the cache:
+//..
+//  rc = myCache.tryGetValue(&value, 3);
+//  assert(1 == rc);
+//..
+// Now, we define a visitor that counts the items in the cache:
+//..
+//  struct MyCountingVisitor {
+//      // Visitor to 'bdlcc::StripedCache<int, bsl::string>'.
+//
+//      int d_count;  // number of items visited
+//
+//      bool operator()(int, const bsl::string&)
+//          // Increment 'd_count' and return 'true'.
+//      {
+//          ++d_count;
+//          return true;
+//      }
+//  };
+//..
+// and use it to count the items in every stripe:
+//..
+//  MyCountingVisitor counter = { 0 };
+//  myCache.visit(counter);
+//  assert(3 == counter.d_count);
+//..
+// Finally, we erase an item and verify the size of the cache:
+//..
+//  rc = myCache.erase(0);
+//  assert(0 == rc);
+//  assert(2 == myCache.size());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_cache.h>
+
+#include <bslma_allocator.h>
+#include <bslma_autodestructor.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                      // ===============================
+                      // class StripedCache_VisitorProxy
+                      // ===============================
+
+template <class VISITOR>
+class StripedCache_VisitorProxy {
+    // This class wraps a visitor supplied to 'StripedCache::visit' and records
+    // whether the visitor requested that the visit be stopped, so that the
+    // remaining stripes are not visited.
+
+    // DATA
+    VISITOR *d_visitor_p;  // visitor (held, not owned)
+    bool     d_stopped;    // 'true' if the visitor returned 'false'
+
+  public:
+    // CREATORS
+    explicit StripedCache_VisitorProxy(VISITOR *visitor);
+        // Create a proxy forwarding to the specified 'visitor'.
+
+    // MANIPULATORS
+    template <class KEY, class VALUE>
+    bool operator()(const KEY& key, const VALUE& value);
+        // Invoke the visitor with the specified 'key' and 'value'.  Return the
+        // result of that invocation, and record if it was 'false'.
+
+    // ACCESSORS
+    bool stopped() const;
+        // Return 'true' if the visitor returned 'false', and 'false'
+        // otherwise.
+};
+
+                            // ==================
+                            // class StripedCache
+                            // ==================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class StripedCache {
+    // This class represents an in-process key-value store, supporting a
+    // variety of eviction policies, whose content is divided into
+    // independently locked stripes.
+
+  public:
+    // PUBLIC TYPES
+    typedef Cache<KEY, VALUE, HASH, EQUAL>             StripeType;
+        // Type of each stripe.
+
+    typedef typename StripeType::ValuePtrType          ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef typename StripeType::PostEvictionCallback  PostEvictionCallback;
+        // Type of function to call after an item has been evicted from the
+        // cache.
+
+    typedef typename StripeType::KVType                KVType;
+        // Value type of a bulk insert entry.
+
+    enum {
+        k_DEFAULT_NUM_STRIPES = 16  // default number of stripes
+    };
+
+  private:
+    // DATA
+    bslma::Allocator          *d_allocator_p;    // memory allocator (held,
+                                                 // not owned)
+
+    bsl::size_t                d_numStripes;     // number of stripes, a
+                                                 // power of 2
+
+    bsl::size_t                d_stripeMask;     // 'd_numStripes - 1'
+
+    HASH                       d_hashFunction;   // hash used to select a
+                                                 // stripe
+
+    StripeType                *d_stripes_p;      // array of 'd_numStripes'
+                                                 // stripes (owned)
+
+    CacheEvictionPolicy::Enum  d_evictionPolicy; // eviction policy
+
+    bsl::size_t                d_lowWatermark;   // global low watermark
+
+    bsl::size_t                d_highWatermark;  // global high watermark
+
+    bsls::AtomicUint64         d_popFrontCursor; // round-robin index of the
+                                                 // next stripe to 'popFront'
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t adjustNumStripes(bsl::size_t numStripes);
+        // Return the smallest power of 2 that is not less than the specified
+        // 'numStripes', or 1 if 'numStripes' is 0.
+
+    static bsl::size_t stripeWatermark(bsl::size_t watermark,
+                                       bsl::size_t numStripes);
+        // Return the share of the specified global 'watermark' allotted to
+        // each of the specified 'numStripes' stripes, rounded up.
+
+    // PRIVATE MANIPULATORS
+    void createStripes(const HASH& hashFunction, const EQUAL& equalFunction);
+        // Allocate and construct 'd_numStripes' stripes, each using the
+        // specified 'hashFunction' and 'equalFunction', and the per-stripe
+        // share of the global watermarks.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t stripeIndex(const KEY& key) const;
+        // Return the index of the stripe owning the specified 'key'.
+
+    template <class DATA, class KEY_ACCESSOR>
+    void partition(bsl::vector<bsl::vector<DATA> > *result,
+                   const bsl::vector<DATA>&         data,
+                   KEY_ACCESSOR                     keyOf) const;
+        // Load into the specified 'result' 'd_numStripes' vectors, where the
+        // 'i'th vector holds (in order) the elements of the specified 'data'
+        // whose key, as returned by the specified 'keyOf', is owned by stripe
+        // 'i'.
+
+    static const KEY& keyOfKey(const KEY& key);
+        // Return the specified 'key'.
+
+    static const KEY& keyOfPair(const KVType& pair);
+        // Return the key of the specified 'pair'.
+
+  private:
+    // NOT IMPLEMENTED
+    StripedCache(const StripedCache&);
+    StripedCache& operator=(const StripedCache&);
+
+  public:
+    // CREATORS
+    explicit StripedCache(bslma::Allocator *basicAllocator = 0);
+        // Create an empty LRU cache having no size limit and
+        // 'k_DEFAULT_NUM_STRIPES' stripes.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    StripedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numStripes = k_DEFAULT_NUM_STRIPES,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy' and the
+        // specified 'lowWatermark' and 'highWatermark'.  Optionally specify
+        // 'numStripes', the number of independently locked stripes of this
+        // cache, which is rounded up to the nearest power of 2.  If
+        // 'numStripes' is not specified, 'k_DEFAULT_NUM_STRIPES' is used.
+        // Optionally specify the 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark', and
+        // '1 <= highWatermark'.
+
+    StripedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numStripes,
+                 const HASH&                hashFunction,
+                 const EQUAL&               equalFunction,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy',
+        // 'lowWatermark', 'highWatermark', and 'numStripes' (rounded up to the
+        // nearest power of 2).  The specified 'hashFunction' is used to
+        // generate the hash values for a given key, and the specified
+        // 'equalFunction' is used to determine whether two keys have the same
+        // value.  Optionally specify the 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark', and
+        // '1 <= highWatermark'.
+
+    ~StripedCache();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this cache.  Do *not* invoke the post-eviction
+        // callback.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this cache.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    int eraseBulk(const bsl::vector<KEY>& keys);
+        // Remove the items having the specified 'keys' from this cache.
+        // Invoke the post-eviction callback for each removed item.  Return
+        // the number of items successfully removed.
+
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+    void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+    void insert(bslmf::MovableRef<KEY> key, bslmf::MovableRef<VALUE> value);
+        // Move the specified 'key' and its associated 'value' into this cache.
+        // If 'key' already exists, then its value will be replaced with
+        // 'value'.  Note that all the methods that take moved objects provide
+        // the 'basic' but not the 'strong' exception guarantee.  Also note
+        // that 'key' must be copyable, even if it is moved.
+
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+    void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        // Insert the specified 'key' and its associated 'valuePtr' into this
+        // cache.  If 'key' already exists, then its value will be replaced
+        // with 'value'.  Note that the method with 'key' moved provides the
+        // 'basic' but not the 'strong' exception guarantee.  Also note that
+        // 'key' must be copyable, even if it is moved.
+
+    int insertBulk(const bsl::vector<KVType>& data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+        // Note that the stripes are not locked simultaneously, so the
+        // insertion is not atomic with respect to other threads.
+
+    int insertBulk(bslmf::MovableRef<bsl::vector<KVType> > data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+        // 'data' is left in a valid but unspecified state.  If an exception
+        // occurs during this action, we provide only the basic guarantee.
+
+    int popFront();
+        // Remove the item at the front of the eviction queue of the next
+        // non-empty stripe in round-robin order.  Invoke the post-eviction
+        // callback for the removed item.  Return 0 on success, and 1 if this
+        // cache is empty.
+
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+        // Set the post-eviction callback to the specified
+        // 'postEvictionCallback'.  The post-eviction callback is invoked for
+        // each item evicted or removed from this cache.
+
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key' in this cache.  If the optionally specified
+        // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
+        // move the cached item to the back of the eviction queue of its
+        // stripe.  Return 0 on success, and 1 if 'key' does not exist in this
+        // cache.  Note that only the stripe owning 'key' is locked.
+
+    // ACCESSORS
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this cache.
+
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+        // Return the eviction policy used by this cache.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this cache to
+        // generate a hash value (of type 'std::size_t') for a 'KEY' object.
+
+    bsl::size_t highWatermark() const;
+        // Return the global high watermark of this cache.
+
+    bsl::size_t lowWatermark() const;
+        // Return the global low watermark of this cache.
+
+    bsl::size_t numStripes() const;
+        // Return the number of stripes of this cache.
+
+    bsl::size_t size() const;
+        // Return the current size of this cache.  Note that the stripes are
+        // not locked simultaneously, so the returned value may not reflect
+        // the size of the cache at any single point in time if the cache is
+        // modified concurrently.
+
+    const StripeType& stripe(bsl::size_t index) const;
+        // Return a 'const' reference to the stripe at the specified 'index'.
+        // The behavior is undefined unless 'index < numStripes()'.
+
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this cache,
+        // stripe by stripe, in the order of the eviction queue of each stripe,
+        // until 'visitor' returns 'false'.  The 'VISITOR' type must be a
+        // callable object that can be invoked in the same way as the function
+        // 'bool (const KEY&, const VALUE&)'.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class StripedCache_VisitorProxy
+                      // -------------------------------
+
+// CREATORS
+template <class VISITOR>
+inline
+StripedCache_VisitorProxy<VISITOR>::StripedCache_VisitorProxy(VISITOR *visitor)
+: d_visitor_p(visitor)
+, d_stopped(false)
+{
+}
+
+// MANIPULATORS
+template <class VISITOR>
+template <class KEY, class VALUE>
+inline
+bool StripedCache_VisitorProxy<VISITOR>::operator()(const KEY&   key,
+                                                    const VALUE& value)
+{
+    if (!(*d_visitor_p)(key, value)) {
+        d_stopped = true;
+        return false;                                                 // RETURN
+    }
+    return true;
+}
+
+// ACCESSORS
+template <class VISITOR>
+inline
+bool StripedCache_VisitorProxy<VISITOR>::stopped() const
+{
+    return d_stopped;
+}
+
+                            // ------------------
+                            // class StripedCache
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::adjustNumStripes(
+                                                        bsl::size_t numStripes)
+{
+    bsl::size_t power = 1;
+    while (power < numStripes) {
+        power <<= 1;
+    }
+    return power;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::stripeWatermark(
+                                                        bsl::size_t watermark,
+                                                        bsl::size_t numStripes)
+{
+    return watermark / numStripes + (watermark % numStripes ? 1 : 0);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const KEY& StripedCache<KEY, VALUE, HASH, EQUAL>::keyOfKey(const KEY& key)
+{
+    return key;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const KEY& StripedCache<KEY, VALUE, HASH, EQUAL>::keyOfPair(const KVType& pair)
+{
+    return pair.first;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::createStripes(
+                                                   const HASH&  hashFunction,
+                                                   const EQUAL& equalFunction)
+{
+    const bsl::size_t stripeLow  = stripeWatermark(d_lowWatermark,
+                                                   d_numStripes);
+    const bsl::size_t stripeHigh = stripeWatermark(d_highWatermark,
+                                                   d_numStripes);
+
+    d_stripes_p = static_cast<StripeType *>(
+                  d_allocator_p->allocate(d_numStripes * sizeof(StripeType)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> deallocator(d_stripes_p,
+                                                            d_allocator_p);
+    bslma::AutoDestructor<StripeType>           destructor(d_stripes_p, 0);
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        new (d_stripes_p + i) StripeType(d_evictionPolicy,
+                                         stripeLow,
+                                         stripeHigh,
+                                         hashFunction,
+                                         equalFunction,
+                                         d_allocator_p);
+        ++destructor;
+    }
+
+    destructor.release();
+    deallocator.release();
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t
+StripedCache<KEY, VALUE, HASH, EQUAL>::stripeIndex(const KEY& key) const
+{
+    // Hash tables such as 'bsl::unordered_map' select buckets using the low
+    // bits of the hash value, and many 'bsl::hash' specializations are the
+    // identity function; so mix the hash value (multiplicative hashing) and
+    // use its high bits to select the stripe.
+
+    const bsls::Types::Uint64 hash =
+                     static_cast<bsls::Types::Uint64>(d_hashFunction(key)) *
+                                                   0x9E3779B97F4A7C15ULL;
+    return static_cast<bsl::size_t>(hash >> 32) & d_stripeMask;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class DATA, class KEY_ACCESSOR>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::partition(
+                                 bsl::vector<bsl::vector<DATA> > *result,
+                                 const bsl::vector<DATA>&         data,
+                                 KEY_ACCESSOR                     keyOf) const
+{
+    BSLS_ASSERT(result);
+
+    result->resize(d_numStripes);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        (*result)[stripeIndex(keyOf(data[i]))].push_back(data[i]);
+    }
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numStripes(k_DEFAULT_NUM_STRIPES)
+, d_stripeMask(k_DEFAULT_NUM_STRIPES - 1)
+, d_hashFunction()
+, d_stripes_p(0)
+, d_evictionPolicy(CacheEvictionPolicy::e_LRU)
+, d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_popFrontCursor(0)
+{
+    createStripes(HASH(), EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numStripes,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numStripes(adjustNumStripes(numStripes))
+, d_stripeMask(d_numStripes - 1)
+, d_hashFunction()
+, d_stripes_p(0)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_popFrontCursor(0)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+
+    createStripes(HASH(), EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numStripes,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numStripes(adjustNumStripes(numStripes))
+, d_stripeMask(d_numStripes - 1)
+, d_hashFunction(hashFunction)
+, d_stripes_p(0)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_popFrontCursor(0)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+
+    createStripes(hashFunction, equalFunction);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::~StripedCache()
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        bslma::DestructionUtil::destroy(d_stripes_p + i);
+    }
+    d_allocator_p->deallocate(d_stripes_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_stripes_p[i].clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int StripedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_stripes_p[stripeIndex(key)].erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                  const bsl::vector<KEY>& keys)
+{
+    bsl::vector<bsl::vector<KEY> > keysByStripe(d_allocator_p);
+    partition(&keysByStripe, keys, &keyOfKey);
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        if (!keysByStripe[i].empty()) {
+            count += d_stripes_p[i].eraseBulk(keysByStripe[i]);
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    d_stripes_p[stripeIndex(key)].insert(key, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              const KEY&               key,
+                                              bslmf::MovableRef<VALUE> value)
+{
+    d_stripes_p[stripeIndex(key)].insert(key,
+                                         bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                bslmf::MovableRef<KEY> key,
+                                                const VALUE&           value)
+{
+    const KEY& localKey = key;
+    d_stripes_p[stripeIndex(localKey)].insert(bslmf::MovableRefUtil::move(key),
+                                              value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY>   key,
+                                              bslmf::MovableRef<VALUE> value)
+{
+    const KEY& localKey = key;
+    d_stripes_p[stripeIndex(localKey)].insert(
+                                          bslmf::MovableRefUtil::move(key),
+                                          bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 const KEY&          key,
+                                                 const ValuePtrType& valuePtr)
+{
+    d_stripes_p[stripeIndex(key)].insert(key, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY> key,
+                                              const ValuePtrType&    valuePtr)
+{
+    const KEY& localKey = key;
+    d_stripes_p[stripeIndex(localKey)].insert(bslmf::MovableRefUtil::move(key),
+                                              valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                               const bsl::vector<KVType>& data)
+{
+    bsl::vector<bsl::vector<KVType> > dataByStripe(d_allocator_p);
+    partition(&dataByStripe, data, &keyOfPair);
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        if (!dataByStripe[i].empty()) {
+            count += d_stripes_p[i].insertBulk(
+                            bslmf::MovableRefUtil::move(dataByStripe[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                  bslmf::MovableRef<bsl::vector<KVType> > data)
+{
+    bsl::vector<KVType>& localData = data;
+
+    bsl::vector<bsl::vector<KVType> > dataByStripe(d_allocator_p);
+    dataByStripe.resize(d_numStripes);
+    for (bsl::size_t i = 0; i < localData.size(); ++i) {
+        bsl::vector<KVType>& stripeData =
+                                dataByStripe[stripeIndex(localData[i].first)];
+        stripeData.push_back(bslmf::MovableRefUtil::move(localData[i]));
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        if (!dataByStripe[i].empty()) {
+            count += d_stripes_p[i].insertBulk(
+                            bslmf::MovableRefUtil::move(dataByStripe[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedCache<KEY, VALUE, HASH, EQUAL>::popFront()
+{
+    const bsl::size_t start = static_cast<bsl::size_t>(
+                                               d_popFrontCursor.addRelaxed(1));
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        if (0 == d_stripes_p[(start + i) & d_stripeMask].popFront()) {
+            return 0;                                                 // RETURN
+        }
+    }
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_stripes_p[i].setPostEvictionCallback(postEvictionCallback);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int StripedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    return d_stripes_p[stripeIndex(key)].tryGetValue(value,
+                                                     key,
+                                                     modifyEvictionQueue);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL StripedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_stripes_p[0].equalFunction();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+StripedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_evictionPolicy;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH StripedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hashFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::numStripes() const
+{
+    return d_numStripes;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        result += d_stripes_p[i].size();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const typename StripedCache<KEY, VALUE, HASH, EQUAL>::StripeType&
+StripedCache<KEY, VALUE, HASH, EQUAL>::stripe(bsl::size_t index) const
+{
+    BSLS_ASSERT(index < d_numStripes);
+
+    return d_stripes_p[index];
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    StripedCache_VisitorProxy<VISITOR> proxy(&visitor);
+
+    for (bsl::size_t i = 0; i < d_numStripes && !proxy.stopped(); ++i) {
+        d_stripes_p[i].visit(proxy);
+    }
+}
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY,  class VALUE,  class HASH,  class EQUAL>
+struct UsesBslmaAllocator<bdlcc::StripedCache<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
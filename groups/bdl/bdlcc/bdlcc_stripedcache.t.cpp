@@ -0,0 +1,1158 @@
+// bdlcc_stripedcache.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_stripedcache.h>
+
+#include <bdlcc_cache.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::StripedCache', that
+// divides a key-value cache into a fixed number of 'bdlcc::Cache' stripes.
+// Since the caching, locking and eviction behavior of each stripe is that of
+// 'bdlcc::Cache' (tested in 'bdlcc_cache'), we concentrate on the forwarding
+// of each operation to the correct stripe, the division of the global
+// watermarks among stripes, the aggregation performed by 'size', 'visit',
+// 'popFront', 'insertBulk' and 'eraseBulk', and the use of the allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit StripedCache(bslma::Allocator *basicAllocator);
+// [ 2] StripedCache(policy, lowWat, highWat, numStripes, basicAllocator);
+// [ 2] StripedCache(policy, low, high, numStripes, hash, equal, alloc);
+// [ 2] ~StripedCache();
+//
+// MANIPULATORS
+// [ 3] void insert(const KEY& key, const VALUE& value);
+// [ 3] void insert(const KEY& key, MovableRef<VALUE> value);
+// [ 3] void insert(MovableRef<KEY> key, const VALUE& value);
+// [ 3] void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+// [ 3] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 3] void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+// [ 3] int tryGetValue(value, const KEY& key, bool modifyEvictionQueue);
+// [ 3] int erase(const KEY& key);
+// [ 3] void clear();
+// [ 4] int insertBulk(const bsl::vector<KVType>& data);
+// [ 4] int insertBulk(MovableRef<bsl::vector<KVType> > data);
+// [ 4] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 5] int popFront();
+// [ 5] void setPostEvictionCallback(postEvictionCallback);
+//
+// ACCESSORS
+// [ 2] EQUAL equalFunction() const;
+// [ 2] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 2] HASH hashFunction() const;
+// [ 2] bsl::size_t highWatermark() const;
+// [ 2] bsl::size_t lowWatermark() const;
+// [ 2] bsl::size_t numStripes() const;
+// [ 3] bsl::size_t size() const;
+// [ 2] const StripeType& stripe(bsl::size_t index) const;
+// [ 6] void visit(VISITOR& visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] THREAD SAFETY
+// [ 8] USAGE EXAMPLE
+// [-1] READ/WRITE THROUGHPUT: 'bdlcc::Cache' VS 'bdlcc::StripedCache'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlcc::StripedCache<int, bsl::string> Obj;
+typedef Obj::ValuePtrType                     ValuePtr;
+typedef Obj::KVType                           KVType;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct CollectVisitor {
+    // Visitor loading every visited key into a vector, stopping after
+    // 'd_limit' items.
+
+    bsl::vector<int> *d_keys_p;
+    bsl::size_t       d_limit;
+
+    bool operator()(int key, const bsl::string&)
+        // Append the specified 'key' to '*d_keys_p' and return 'true' if fewer
+        // than 'd_limit' keys have been collected.
+    {
+        d_keys_p->push_back(key);
+        return d_keys_p->size() < d_limit;
+    }
+};
+
+struct EvictionCounter {
+    // Post-eviction callback counting the number of evicted items.
+
+    bsls::AtomicInt *d_count_p;
+
+    void operator()(const ValuePtr&)
+        // Increment '*d_count_p'.
+    {
+        ++*d_count_p;
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usageExample1 {
+
+struct MyCountingVisitor {
+    // Visitor to 'bdlcc::StripedCache<int, bsl::string>'.
+
+    int d_count;  // number of items visited
+
+    bool operator()(int, const bsl::string&)
+        // Increment 'd_count' and return 'true'.
+    {
+        ++d_count;
+        return true;
+    }
+};
+
+void example1()
+{
+    bslma::TestAllocator talloc("ue1", veryVeryVeryVerbose);
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Sharing Reference Data Among Many Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service caches security descriptions keyed by an integer
+// identifier, and that the cache is read by many threads concurrently.  A
+// single 'bdlcc::Cache' would serialize all LRU lookups on its write lock, so
+// we use a 'bdlcc::StripedCache' instead.
+//
+// First, we define a 'bdlcc::StripedCache' object, 'myCache', that maps 'int'
+// to 'bsl::string', uses the LRU eviction policy, holds at most 1024 items,
+// and is divided into 8 stripes:
+//..
+    bdlcc::StripedCache<int, bsl::string> myCache(
+                                            bdlcc::CacheEvictionPolicy::e_LRU,
+                                            1024,
+                                            1024,
+                                            8,
+                                            &talloc);
+    ASSERT(8    == myCache.numStripes());
+    ASSERT(1024 == myCache.highWatermark());
+//..
+// Then, we insert a few items into the cache:
+//..
+    myCache.insert(0, "IBM US Equity");
+    myCache.insert(1, "MSFT US Equity");
+    myCache.insert(2, "AAPL US Equity");
+    ASSERT(3 == myCache.size());
+//..
+// Next, we retrieve a value from the cache:
+//..
+    bsl::shared_ptr<bsl::string> value;
+    int rc = myCache.tryGetValue(&value, 1);
+    ASSERT(0 == rc);
+    ASSERT("MSFT US Equity" == *value);
+//..
+// Then, we look up a key that is not in the cache:
+//..
+    rc = myCache.tryGetValue(&value, 3);
+    ASSERT(1 == rc);
+//..
+// Now, we define a visitor that counts the items in the cache (see
+// 'MyCountingVisitor' above) and use it to count the items in every stripe:
+//..
+    MyCountingVisitor counter = { 0 };
+    myCache.visit(counter);
+    ASSERT(3 == counter.d_count);
+//..
+// Finally, we erase an item and verify the size of the cache:
+//..
+    rc = myCache.erase(0);
+    ASSERT(0 == rc);
+    ASSERT(2 == myCache.size());
+//..
+}
+
+}  // close namespace usageExample1
+
+// ============================================================================
+//                         THREAD SAFETY TEST
+// ----------------------------------------------------------------------------
+
+namespace threaded {
+
+enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 2000 };
+
+Obj           *g_cache_p;
+bslmt::Barrier g_barrier(k_NUM_THREADS);
+
+void worker(int threadId)
+    // Insert, read back, and erase a range of keys unique to the specified
+    // 'threadId', while concurrently reading keys of other threads.
+{
+    g_barrier.wait();
+
+    const int base = threadId * k_NUM_ITERATIONS;
+    bsl::shared_ptr<bsl::string> value;
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        g_cache_p->insert(base + i, bsl::string(1, char('a' + threadId)));
+        ASSERTV(threadId, i, 0 == g_cache_p->tryGetValue(&value, base + i));
+        ASSERTV(threadId, i, bsl::string(1, char('a' + threadId)) == *value);
+
+        g_cache_p->tryGetValue(&value,
+                               (base + k_NUM_ITERATIONS + i) %
+                                          (k_NUM_THREADS * k_NUM_ITERATIONS));
+        if (i % 2) {
+            ASSERTV(threadId, i, 0 == g_cache_p->erase(base + i));
+        }
+    }
+}
+
+}  // close namespace threaded
+
+// ============================================================================
+//                          BENCHMARK APPARATUS
+// ----------------------------------------------------------------------------
+
+namespace benchmark {
+
+template <class CACHE>
+class CacheBenchmark {
+    // This class drives readers and writers against a cache of type 'CACHE'
+    // under 'bslmt::ThroughputBenchmark'.
+
+    // DATA
+    CACHE *d_cache_p;
+    int    d_numKeys;
+
+  public:
+    // CREATORS
+    CacheBenchmark(CACHE *cache, int numKeys)
+        // Create a benchmark driving the specified 'cache' with keys in the
+        // range '[0, numKeys)'.
+    : d_cache_p(cache)
+    , d_numKeys(numKeys)
+    {
+    }
+
+    // MANIPULATORS
+    void initialize(bool isFirst)
+        // Populate the cache if the specified 'isFirst' is 'true'.
+    {
+        if (isFirst) {
+            for (int i = 0; i < d_numKeys; ++i) {
+                d_cache_p->insert(i, i);
+            }
+        }
+    }
+
+    void read(int threadIndex)
+        // Look up a pseudo-random key derived from the specified
+        // 'threadIndex'.
+    {
+        static bsls::AtomicUint s_seed(1);
+        unsigned int seed = s_seed.addRelaxed(threadIndex + 0x9E3779B9);
+        bsl::shared_ptr<int> value;
+        d_cache_p->tryGetValue(&value, static_cast<int>(seed % d_numKeys));
+    }
+
+    void write(int threadIndex)
+        // Insert a pseudo-random key derived from the specified
+        // 'threadIndex'.
+    {
+        static bsls::AtomicUint s_seed(7);
+        unsigned int seed = s_seed.addRelaxed(threadIndex + 0x7F4A7C15);
+        const int key = static_cast<int>(seed % d_numKeys);
+        d_cache_p->insert(key, key);
+    }
+};
+
+template <class CACHE>
+void run(const char *name,
+         CACHE      *cache,
+         int         numKeys,
+         int         numReaders,
+         int         numWriters,
+         int         numMillis,
+         int         numSamples)
+    // Run the benchmark on the specified 'cache' labeled by the specified
+    // 'name', using the specified 'numKeys', 'numReaders', 'numWriters',
+    // 'numMillis' and 'numSamples', and print the median throughputs.
+{
+    bslma::NewDeleteAllocator        nalloc;
+    CacheBenchmark<CACHE>            bench(cache, numKeys);
+    bslmt::ThroughputBenchmark       tb(&nalloc);
+    bslmt::ThroughputBenchmarkResult res(&nalloc);
+
+    int readGroup = tb.addThreadGroup(
+                          bdlf::BindUtil::bind(&CacheBenchmark<CACHE>::read,
+                                               &bench,
+                                               bdlf::PlaceHolders::_1),
+                          numReaders,
+                          0);
+    int writeGroup = -1;
+    if (numWriters) {
+        writeGroup = tb.addThreadGroup(
+                          bdlf::BindUtil::bind(&CacheBenchmark<CACHE>::write,
+                                               &bench,
+                                               bdlf::PlaceHolders::_1),
+                          numWriters,
+                          0);
+    }
+
+    tb.execute(&res,
+               numMillis,
+               numSamples,
+               bdlf::BindUtil::bind(&CacheBenchmark<CACHE>::initialize,
+                                    &bench,
+                                    bdlf::PlaceHolders::_1),
+               bslmt::ThroughputBenchmark::ShutdownSampleFunction(),
+               bslmt::ThroughputBenchmark::CleanupSampleFunction());
+
+    double readMedian  = 0;
+    double writeMedian = 0;
+    res.getMedian(&readMedian, readGroup);
+    if (writeGroup >= 0) {
+        res.getMedian(&writeMedian, writeGroup);
+    }
+    bsl::cout << bsl::fixed << bsl::setprecision(0)
+              << name << "," << numReaders << "," << numWriters << ","
+              << readMedian << "," << writeMedian << "\n";
+}
+
+}  // close namespace benchmark
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        usageExample1::example1();
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 Concurrent 'insert', 'tryGetValue', and 'erase' calls on keys in
+        //:   the same and different stripes behave as if serialized.
+        //
+        // Plan:
+        //: 1 Run several threads that each insert, read back and erase their
+        //:   own range of keys while reading the keys of other threads, then
+        //:   verify the final size of the cache.  (C-1)
+        //
+        // Testing:
+        //   THREAD SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD SAFETY" << endl
+                          << "=============" << endl;
+
+        using namespace threaded;
+
+        bslma::TestAllocator ta("threaded", veryVeryVeryVerbose);
+        {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_LRU,
+                   k_NUM_THREADS * k_NUM_ITERATIONS,
+                   k_NUM_THREADS * k_NUM_ITERATIONS,
+                   4,
+                   &ta);
+            g_cache_p = &mX;
+
+            bslmt::ThreadGroup tg(&ta);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                tg.addThread(bdlf::BindUtil::bind(&worker, i));
+            }
+            tg.joinAll();
+
+            ASSERTV(mX.size(),
+                    k_NUM_THREADS * k_NUM_ITERATIONS / 2 == mX.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // VISIT
+        //
+        // Concerns:
+        //: 1 'visit' invokes the visitor for every item of every stripe.
+        //:
+        //: 2 Within a stripe, items are visited in eviction order.
+        //:
+        //: 3 Once the visitor returns 'false', no other item is visited, in
+        //:   this stripe or any other.
+        //
+        // Plan:
+        //: 1 Populate a cache, visit it with a collecting visitor, and verify
+        //:   that every key was visited exactly once, and that keys of each
+        //:   stripe appear in the same order as a visit of that stripe.
+        //:   (C-1..2)
+        //:
+        //: 2 Visit with visitors that stop after N items, for N in a range
+        //:   that spans several stripes.  (C-3)
+        //
+        // Testing:
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VISIT" << endl
+                          << "=====" << endl;
+
+        bslma::TestAllocator ta("visit", veryVeryVeryVerbose);
+        {
+            const int NUM_KEYS = 100;
+
+            Obj mX(bdlcc::CacheEvictionPolicy::e_FIFO,
+                   1000,
+                   1000,
+                   8,
+                   &ta);
+            const Obj& X = mX;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.insert(i, "v");
+            }
+
+            bsl::vector<int> keys(&ta);
+            CollectVisitor   visitor = { &keys, 1000 };
+            X.visit(visitor);
+            ASSERTV(keys.size(), NUM_KEYS == static_cast<int>(keys.size()));
+
+            bsl::vector<int> seen(NUM_KEYS, 0, &ta);
+            for (bsl::size_t i = 0; i < keys.size(); ++i) {
+                ++seen[keys[i]];
+            }
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                ASSERTV(i, 1 == seen[i]);
+            }
+
+            bsl::size_t offset = 0;
+            for (bsl::size_t s = 0; s < X.numStripes(); ++s) {
+                bsl::vector<int> stripeKeys(&ta);
+                CollectVisitor   stripeVisitor = { &stripeKeys, 1000 };
+                X.stripe(s).visit(stripeVisitor);
+                for (bsl::size_t i = 0; i < stripeKeys.size(); ++i) {
+                    ASSERTV(s, i, stripeKeys[i] == keys[offset + i]);
+                }
+                offset += stripeKeys.size();
+            }
+            ASSERT(keys.size() == offset);
+
+            for (bsl::size_t limit = 1; limit <= 60; ++limit) {
+                bsl::vector<int> partial(&ta);
+                CollectVisitor   partialVisitor = { &partial, limit };
+                X.visit(partialVisitor);
+                ASSERTV(limit, partial.size(), limit == partial.size());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EVICTION, 'popFront' AND 'setPostEvictionCallback'
+        //
+        // Concerns:
+        //: 1 Each stripe evicts according to its share of the global
+        //:   watermarks, so the total size of the cache never exceeds
+        //:   'highWatermark() + numStripes() - 1'.
+        //:
+        //: 2 The post-eviction callback is installed on every stripe and is
+        //:   invoked for evicted, erased and popped items.
+        //:
+        //: 3 'popFront' removes one item per call, from a non-empty stripe,
+        //:   until the cache is empty, then returns 1.
+        //:
+        //: 4 'popFront' removes, within a stripe, the item at the front of
+        //:   that stripe's eviction queue.
+        //
+        // Plan:
+        //: 1 Insert many more keys than the high watermark and check the size
+        //:   and the number of evictions.  (C-1..2)
+        //:
+        //: 2 Call 'popFront' until it fails, checking the size after each
+        //:   call.  (C-2..3)
+        //:
+        //: 3 Using a single stripe, verify that 'popFront' follows the LRU
+        //:   order established by 'tryGetValue'.  (C-4)
+        //
+        // Testing:
+        //   int popFront();
+        //   void setPostEvictionCallback(postEvictionCallback);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "EVICTION, 'popFront' AND 'setPostEvictionCallback'"
+                      << endl
+                      << "=================================================="
+                      << endl;
+
+        bslma::TestAllocator ta("eviction", veryVeryVeryVerbose);
+        {
+            const bsl::size_t LOW  = 60;
+            const bsl::size_t HIGH = 64;
+
+            bsls::AtomicInt numEvicted(0);
+            EvictionCounter counter = { &numEvicted };
+
+            Obj mX(bdlcc::CacheEvictionPolicy::e_LRU, LOW, HIGH, 4, &ta);
+            const Obj& X = mX;
+            mX.setPostEvictionCallback(counter);
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i, "v");
+                ASSERTV(i, X.size(), X.size() < HIGH + X.numStripes());
+            }
+            ASSERTV(X.size(), numEvicted,
+                    1000 == X.size() + numEvicted);
+
+            int         numPopped = 0;
+            bsl::size_t size      = X.size();
+            while (0 == mX.popFront()) {
+                ++numPopped;
+                ASSERTV(size, X.size(), size - 1 == X.size());
+                size = X.size();
+            }
+            ASSERT(0 == X.size());
+            ASSERT(1 == mX.popFront());
+            ASSERT(1000 == numEvicted);
+
+            mX.insert(1, "v");
+            ASSERT(0 == mX.erase(1));
+            ASSERT(1001 == numEvicted);
+        }
+        {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_LRU, 10, 10, 1, &ta);
+            const Obj& X = mX;
+
+            for (int i = 0; i < 5; ++i) {
+                mX.insert(i, "v");
+            }
+
+            ValuePtr value;
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            ASSERT(0 == mX.tryGetValue(&value, 1, false));
+
+            ASSERT(0 == mX.popFront());
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            ASSERT(1 == mX.tryGetValue(&value, 1));
+            ASSERT(4 == X.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BULK OPERATIONS
+        //
+        // Concerns:
+        //: 1 'insertBulk' inserts all items, spread among the stripes, and
+        //:   returns the number of newly inserted keys.
+        //:
+        //: 2 The moving 'insertBulk' has the same effect.
+        //:
+        //: 3 'eraseBulk' erases the existing keys and returns their number.
+        //
+        // Plan:
+        //: 1 Bulk insert a set of keys containing duplicates of keys already
+        //:   present, and verify the return values, size and content.
+        //:   (C-1..2)
+        //:
+        //: 2 Bulk erase a set of keys that partially overlaps the cache
+        //:   content.  (C-3)
+        //
+        // Testing:
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int insertBulk(MovableRef<bsl::vector<KVType> > data);
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK OPERATIONS" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator ta("bulk", veryVeryVeryVerbose);
+        {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_LRU, 1000, 1000, 4, &ta);
+            const Obj& X = mX;
+
+            mX.insert(0, "zero");
+            mX.insert(1, "one");
+
+            bsl::vector<KVType> data(&ta);
+            for (int i = 0; i < 20; ++i) {
+                data.push_back(KVType(i,
+                                      bsl::allocate_shared<bsl::string>(
+                                                                     &ta,
+                                                                     "bulk")));
+            }
+
+            ASSERT(18 == mX.insertBulk(data));
+            ASSERT(20 == X.size());
+
+            int nonEmptyStripes = 0;
+            for (bsl::size_t s = 0; s < X.numStripes(); ++s) {
+                nonEmptyStripes += 0 != X.stripe(s).size();
+            }
+            ASSERTV(nonEmptyStripes, 1 < nonEmptyStripes);
+
+            ValuePtr value;
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            ASSERT("bulk" == *value);
+
+            bsl::vector<KVType> moved(&ta);
+            for (int i = 10; i < 30; ++i) {
+                moved.push_back(KVType(i,
+                                       bsl::allocate_shared<bsl::string>(
+                                                                    &ta,
+                                                                    "moved")));
+            }
+            ASSERT(10 == mX.insertBulk(bslmf::MovableRefUtil::move(moved)));
+            ASSERT(30 == X.size());
+            ASSERT(0 == mX.tryGetValue(&value, 29));
+            ASSERT("moved" == *value);
+
+            bsl::vector<int> keys(&ta);
+            for (int i = 25; i < 40; ++i) {
+                keys.push_back(i);
+            }
+            ASSERT(5 == mX.eraseBulk(keys));
+            ASSERT(25 == X.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SINGLE-KEY MANIPULATORS
+        //
+        // Concerns:
+        //: 1 Each 'insert' overload inserts or replaces the value of the key.
+        //:
+        //: 2 'tryGetValue' finds exactly the inserted keys.
+        //:
+        //: 3 'erase' removes the key and reports whether it was present.
+        //:
+        //: 4 'clear' empties every stripe.
+        //:
+        //: 5 All memory comes from the object allocator.
+        //
+        // Plan:
+        //: 1 Use each 'insert' overload, then verify the content with
+        //:   'tryGetValue' and 'size'.  (C-1..2)
+        //:
+        //: 2 Erase present and absent keys.  (C-3)
+        //:
+        //: 3 Clear the cache and verify it is empty.  (C-4)
+        //:
+        //: 4 Check the default and object allocators.  (C-5)
+        //
+        // Testing:
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, MovableRef<VALUE> value);
+        //   void insert(MovableRef<KEY> key, const VALUE& value);
+        //   void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        //   int tryGetValue(value, const KEY& key, bool modifyEvictionQueue);
+        //   int erase(const KEY& key);
+        //   void clear();
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SINGLE-KEY MANIPULATORS" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta("single", veryVeryVeryVerbose);
+        {
+            typedef bdlcc::StripedCache<bsl::string, bsl::string> SObj;
+
+            SObj mX(bdlcc::CacheEvictionPolicy::e_FIFO, 100, 100, 4, &ta);
+            const SObj& X = mX;
+
+            bsl::string k0("key0 long enough to allocate memory", &ta);
+            bsl::string k1("key1 long enough to allocate memory", &ta);
+            bsl::string k2("key2 long enough to allocate memory", &ta);
+            bsl::string k3("key3 long enough to allocate memory", &ta);
+            bsl::string k4("key4 long enough to allocate memory", &ta);
+            bsl::string k5("key5 long enough to allocate memory", &ta);
+            bsl::string v("value long enough to allocate memory", &ta);
+
+            mX.insert(k0, v);
+            {
+                bsl::string mv(v, &ta);
+                mX.insert(k1, bslmf::MovableRefUtil::move(mv));
+            }
+            {
+                bsl::string mk(k2, &ta);
+                mX.insert(bslmf::MovableRefUtil::move(mk), v);
+            }
+            {
+                bsl::string mk(k3, &ta);
+                bsl::string mv(v, &ta);
+                mX.insert(bslmf::MovableRefUtil::move(mk),
+                          bslmf::MovableRefUtil::move(mv));
+            }
+            SObj::ValuePtrType valuePtr =
+                                     bsl::allocate_shared<bsl::string>(&ta, v);
+            mX.insert(k4, valuePtr);
+            {
+                bsl::string mk(k5, &ta);
+                mX.insert(bslmf::MovableRefUtil::move(mk), valuePtr);
+            }
+            ASSERT(6 == X.size());
+
+            const bsl::string *KEYS[] = { &k0, &k1, &k2, &k3, &k4, &k5 };
+            for (int i = 0; i < 6; ++i) {
+                bsl::shared_ptr<bsl::string> value;
+                ASSERTV(i, 0 == mX.tryGetValue(&value, *KEYS[i]));
+                ASSERTV(i, v == *value);
+            }
+
+            mX.insert(k0, bsl::string("new", &ta));
+            ASSERT(6 == X.size());
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, k0));
+            ASSERT("new" == *value);
+
+            ASSERT(1 == mX.tryGetValue(&value, bsl::string("absent", &ta)));
+
+            ASSERT(0 == mX.erase(k0));
+            ASSERT(1 == mX.erase(k0));
+            ASSERT(1 == mX.tryGetValue(&value, k0));
+            ASSERT(5 == X.size());
+
+            mX.clear();
+            ASSERT(0 == X.size());
+            for (bsl::size_t s = 0; s < X.numStripes(); ++s) {
+                ASSERTV(s, 0 == X.stripe(s).size());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The number of stripes is rounded up to a power of 2, and
+        //:   defaults to 'k_DEFAULT_NUM_STRIPES'.
+        //:
+        //: 2 The global watermarks are reported as supplied, and each stripe
+        //:   has the rounded-up per-stripe share.
+        //:
+        //: 3 The eviction policy, hash and equality functors are propagated.
+        //:
+        //: 4 The stripes use the object allocator, and all memory is released
+        //:   on destruction.
+        //
+        // Plan:
+        //: 1 Construct objects with a range of stripe counts and watermarks,
+        //:   and verify the accessors of the object and its stripes.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   explicit StripedCache(bslma::Allocator *basicAllocator);
+        //   StripedCache(policy, lowWat, highWat, numStripes, basicAllocator);
+        //   StripedCache(policy, low, high, numStripes, hash, equal, alloc);
+        //   ~StripedCache();
+        //   EQUAL equalFunction() const;
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsl::size_t numStripes() const;
+        //   const StripeType& stripe(bsl::size_t index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator ta("creators", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+            ASSERT(bdlcc::CacheEvictionPolicy::e_LRU == X.evictionPolicy());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                           X.highWatermark());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                            X.lowWatermark());
+            ASSERT(0 == X.size());
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        static const struct {
+            int         d_line;
+            bsl::size_t d_numStripes;
+            bsl::size_t d_expStripes;
+            bsl::size_t d_low;
+            bsl::size_t d_high;
+            bsl::size_t d_expLow;
+            bsl::size_t d_expHigh;
+        } DATA[] = {
+            //LINE  NS  EXP_NS   LOW  HIGH  EXP_LOW  EXP_HIGH
+            //----  --  ------   ---  ----  -------  --------
+            { L_,    0,      1,    1,    1,       1,        1 },
+            { L_,    1,      1,   10,   20,      10,       20 },
+            { L_,    2,      2,   10,   20,       5,       10 },
+            { L_,    3,      4,   10,   20,       3,        5 },
+            { L_,    4,      4,    1,    1,       1,        1 },
+            { L_,    5,      8,  100,  100,      13,       13 },
+            { L_,   16,     16, 1000, 1024,      63,       64 },
+            { L_,   17,     32, 1000, 1024,      32,       32 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const bsl::size_t NS       = DATA[ti].d_numStripes;
+            const bsl::size_t EXP_NS   = DATA[ti].d_expStripes;
+            const bsl::size_t LOW      = DATA[ti].d_low;
+            const bsl::size_t HIGH     = DATA[ti].d_high;
+            const bsl::size_t EXP_LOW  = DATA[ti].d_expLow;
+            const bsl::size_t EXP_HIGH = DATA[ti].d_expHigh;
+
+            for (char cfg = 'a'; cfg <= 'b'; ++cfg) {
+                bdlcc::CacheEvictionPolicy::Enum policy =
+                                       'a' == cfg
+                                       ? bdlcc::CacheEvictionPolicy::e_FIFO
+                                       : bdlcc::CacheEvictionPolicy::e_LRU;
+                bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+                {
+                    bsl::hash<int>     hash;
+                    bsl::equal_to<int> equal;
+
+                    Obj *objPtr = 'a' == cfg
+                                ? new (ta) Obj(policy, LOW, HIGH, NS, &ta)
+                                : new (ta) Obj(policy,
+                                               LOW,
+                                               HIGH,
+                                               NS,
+                                               hash,
+                                               equal,
+                                               &ta);
+                    const Obj& X = *objPtr;
+
+                    ASSERTV(LINE, cfg, EXP_NS == X.numStripes());
+                    ASSERTV(LINE, cfg, LOW    == X.lowWatermark());
+                    ASSERTV(LINE, cfg, HIGH   == X.highWatermark());
+                    ASSERTV(LINE, cfg, policy == X.evictionPolicy());
+                    ASSERTV(LINE, cfg, 0      == X.size());
+                    ASSERTV(LINE, cfg, X.hashFunction()(5) == hash(5));
+                    ASSERTV(LINE, cfg, X.equalFunction()(5, 5));
+
+                    for (bsl::size_t s = 0; s < X.numStripes(); ++s) {
+                        ASSERTV(LINE, cfg, s,
+                                EXP_LOW  == X.stripe(s).lowWatermark());
+                        ASSERTV(LINE, cfg, s,
+                                EXP_HIGH == X.stripe(s).highWatermark());
+                        ASSERTV(LINE, cfg, s,
+                                policy == X.stripe(s).evictionPolicy());
+                    }
+
+                    ta.deleteObject(objPtr);
+                }
+                ASSERTV(LINE, cfg, numBlocks == ta.numBlocksInUse());
+            }
+        }
+
+        ASSERT((bslma::UsesBslmaAllocator<Obj>::value));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, insert, look up and erase a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("breathing", veryVeryVeryVerbose);
+        {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_LRU, 4, 8, 2, &ta);
+            const Obj& X = mX;
+
+            ASSERT(2 == X.numStripes());
+            ASSERT(0 == X.size());
+
+            mX.insert(1, "one");
+            mX.insert(2, "two");
+            ASSERT(2 == X.size());
+
+            ValuePtr value;
+            ASSERT(0 == mX.tryGetValue(&value, 1));
+            ASSERT("one" == *value);
+            ASSERT(1 == mX.tryGetValue(&value, 3));
+
+            ASSERT(0 == mX.erase(2));
+            ASSERT(1 == X.size());
+
+            mX.clear();
+            ASSERT(0 == X.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // READ/WRITE THROUGHPUT: 'bdlcc::Cache' VS 'bdlcc::StripedCache'
+        //   Compare the throughput of 'tryGetValue' and 'insert' on a
+        //   'bdlcc::Cache' with those on a 'bdlcc::StripedCache'.  To provide
+        //   control over the test, command line parameters are used.
+        //   2nd parameter: number of reader threads (defaults to 32).
+        //   3rd parameter: number of writer threads (defaults to 0).
+        //   4th parameter: number of stripes (defaults to 16).
+        //   5th parameter: if F, use FIFO for eviction policy; LRU otherwise.
+        //   6th parameter: number of keys (defaults to 100000).
+        //   7th parameter: number of milliseconds per sample (defaults to
+        //       1000).
+        //   8th parameter: number of samples (defaults to 5).
+        //
+        // Concerns:
+        //: 1 Report the median throughput of the reader and writer thread
+        //:   groups for both caches.
+        //
+        // Plan:
+        //: 1 Pre-load each cache with the keys, then use
+        //:   'bslmt::ThroughputBenchmark' to run readers and writers on
+        //:   uniformly distributed keys.  (C-1)
+        //
+        // Testing:
+        //   READ/WRITE THROUGHPUT: 'bdlcc::Cache' VS 'bdlcc::StripedCache'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+            << "READ/WRITE THROUGHPUT: 'bdlcc::Cache' VS 'bdlcc::StripedCache'"
+            << endl
+            << "=============================================================="
+            << endl;
+
+        bslma::NewDeleteAllocator    nalloc;
+        bslma::DefaultAllocatorGuard guard(&nalloc);
+
+        int  numReaders = argc > 2 ? atoi(argv[2]) : 32;
+        int  numWriters = argc > 3 ? atoi(argv[3]) : 0;
+        int  numStripes = argc > 4 ? atoi(argv[4]) : 16;
+        bdlcc::CacheEvictionPolicy::Enum evictionPolicy =
+            (argc > 5 && argv[5][0] == 'F' ?
+            bdlcc::CacheEvictionPolicy::e_FIFO :
+            bdlcc::CacheEvictionPolicy::e_LRU);
+        int  numKeys    = argc > 6 ? atoi(argv[6]) : 100000;
+        int  numMillis  = argc > 7 ? atoi(argv[7]) : 1000;
+        int  numSamples = argc > 8 ? atoi(argv[8]) : 5;
+
+        bsl::cout << "Cache,Readers,Writers,ReadMedian,WriteMedian\n";
+        {
+            bdlcc::Cache<int, int> cache(evictionPolicy,
+                                         numKeys * 2,
+                                         numKeys * 2,
+                                         &nalloc);
+            benchmark::run("Cache",
+                           &cache,
+                           numKeys,
+                           numReaders,
+                           numWriters,
+                           numMillis,
+                           numSamples);
+        }
+        {
+            bdlcc::StripedCache<int, int> cache(evictionPolicy,
+                                                numKeys * 2,
+                                                numKeys * 2,
+                                                numStripes,
+                                                &nalloc);
+            benchmark::run("StripedCache",
+                           &cache,
+                           numKeys,
+                           numReaders,
+                           numWriters,
+                           numMillis,
+                           numSamples);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (test >= 0) {
+        // CONCERN: In no case does memory come from the default allocator.
+
+        ASSERT(dam.isTotalSame());
+
+        // CONCERN: In no case does memory come from the global allocator.
+
+        ASSERT(gam.isTotalSame());
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
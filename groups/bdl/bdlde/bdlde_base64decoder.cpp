@@ -14,7 +14,23 @@ BSLS_IDENT_RCSID(bdlde_base64decoder_cpp,"$Id$ $CSID$")
 
 #include <bdlde_base64encoder.h>  // for testing only
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#if (defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)) &&              \
+    defined(__SSSE3__) &&                                                     \
+   (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+    // The vectorized decoder needs 'pshufb' and 'pmaddubsw', which the
+    // package options make available to the compiler ('-msse4.2'); whether
+    // the CPU that actually runs the code supports them is determined once,
+    // at run time, using 'cpuid' (see 'decodeFunction').
+
+#define U_USE_SSSE3
+#include <cpuid.h>
+#include <tmmintrin.h>
+#endif
 
 namespace BloombergLP {
 
@@ -93,6 +109,173 @@ static const char decoding[256] = {
        ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
 };
 
+                       // ========================
+                       // STATIC HELPER FUNCTIONS
+                       // ========================
+
+typedef bsl::size_t (*DecodeFunction)(char        *out,
+                                      const char  *input,
+                                      bsl::size_t  length);
+    // 'DecodeFunction' is an alias for the signature of the functions that
+    // decode the leading complete 4-character quanta of numeric Base64
+    // characters of a contiguous input sequence.
+
+static
+bsl::size_t decodeQuanta(char *out, const char *input, bsl::size_t length)
+    // Decode the 4-character quanta of numeric Base64 characters starting at
+    // the specified 'input' address, and extending no farther than the
+    // specified 'length', into the specified 'out' buffer, 4 characters at a
+    // time, stopping at the first quantum that contains any other character.
+    // Return the number of characters consumed, which is a multiple of 4.
+{
+    const unsigned char *in    = reinterpret_cast<const unsigned char *>(
+                                                                       input);
+    const unsigned char *begin = in;
+
+    for (; 4 <= length; length -= 4, in += 4, out += 3) {
+        const unsigned int c0 = static_cast<unsigned char>(decoding[in[0]]);
+        const unsigned int c1 = static_cast<unsigned char>(decoding[in[1]]);
+        const unsigned int c2 = static_cast<unsigned char>(decoding[in[2]]);
+        const unsigned int c3 = static_cast<unsigned char>(decoding[in[3]]);
+
+        if ((c0 | c1 | c2 | c3) & 0xc0) {
+            break;
+        }
+
+        const unsigned int bits = (c0 << 18) | (c1 << 12) | (c2 << 6) | c3;
+
+        out[0] = static_cast<char>( bits >> 16        );
+        out[1] = static_cast<char>((bits >>  8) & 0xff);
+        out[2] = static_cast<char>( bits        & 0xff);
+    }
+
+    return in - begin;
+}
+
+#if defined(U_USE_SSSE3)
+
+static inline
+bool decodeBlock(__m128i *result, __m128i block)
+    // Load into the specified 'result' the 12 bytes (followed by 4 zero
+    // bytes) encoded by the specified 'block' of 16 characters, and return
+    // 'true' if every character of 'block' is a numeric Base64 character.
+    // Otherwise, return 'false' with no effect on 'result'.
+{
+    // Classify each character by its nibbles (see "Base64 decoding with SIMD
+    // instructions", W. Mula): a character is numeric Base64 exactly when the
+    // bit sets looked up for its low and high nibbles are disjoint.
+
+    const __m128i lowNibbles  = _mm_and_si128(block, _mm_set1_epi8(0x0f));
+    const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(block, 4),
+                                              _mm_set1_epi8(0x0f));
+
+    const __m128i lowClasses = _mm_shuffle_epi8(
+                                   _mm_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                                 0x11, 0x11, 0x11, 0x11,
+                                                 0x11, 0x11, 0x13, 0x1a,
+                                                 0x1b, 0x1b, 0x1b, 0x1a),
+                                   lowNibbles);
+    const __m128i highClasses = _mm_shuffle_epi8(
+                                   _mm_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                                 0x04, 0x08, 0x04, 0x08,
+                                                 0x10, 0x10, 0x10, 0x10,
+                                                 0x10, 0x10, 0x10, 0x10),
+                                   highNibbles);
+
+    const __m128i invalid = _mm_cmpeq_epi8(
+                                     _mm_and_si128(lowClasses, highClasses),
+                                     _mm_setzero_si128());
+    if (0xffff != _mm_movemask_epi8(invalid)) {
+        return false;                                                 // RETURN
+    }
+
+    // Map each character to its 6-bit value by adding an offset that depends
+    // only on the high nibble, except that '/' and '+' (which share a high
+    // nibble) are told apart explicitly.
+
+    const __m128i isSlash = _mm_cmpeq_epi8(block, _mm_set1_epi8('/'));
+    const __m128i offsets = _mm_shuffle_epi8(
+                                   _mm_setr_epi8(  0,  16,  19,   4,
+                                                 -65, -65, -71, -71,
+                                                   0,   0,   0,   0,
+                                                   0,   0,   0,   0),
+                                   _mm_add_epi8(isSlash, highNibbles));
+    const __m128i values = _mm_add_epi8(block, offsets);
+
+    // Pack each group of four 6-bit values into 3 bytes: first pairs into
+    // 12-bit values, then pairs of those into 24-bit values, and finally
+    // gather the bytes of each 24-bit value in big-endian order.
+
+    const __m128i pairs = _mm_maddubs_epi16(values,
+                                            _mm_set1_epi32(0x01400140));
+    const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+    *result = _mm_shuffle_epi8(quads, _mm_setr_epi8( 2,  1,  0,  6,
+                                                     5,  4, 10,  9,
+                                                     8, 14, 13, 12,
+                                                    -1, -1, -1, -1));
+    return true;
+}
+
+static
+bsl::size_t decodeQuantaSsse3(char        *out,
+                              const char  *input,
+                              bsl::size_t  length)
+    // Decode the 4-character quanta of numeric Base64 characters starting at
+    // the specified 'input' address, and extending no farther than the
+    // specified 'length', into the specified 'out' buffer, 16 characters at a
+    // time while enough input remains that writing 16 bytes cannot overrun
+    // an output buffer sized for the whole input, stopping at the first
+    // quantum that contains any other character.  Return the number of
+    // characters consumed, which is a multiple of 4.  The behavior is
+    // undefined unless the CPU supports SSSE3.
+{
+    const char *begin = input;
+
+    for (; 24 <= length; length -= 16, input += 16, out += 12) {
+        const __m128i block = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(input));
+        __m128i       result;
+
+        if (!decodeBlock(&result, block)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), result);
+    }
+
+    return (input - begin) + decodeQuanta(out, input, length);
+}
+
+#endif  // U_USE_SSSE3
+
+static
+DecodeFunction decodeFunction()
+    // Return the address of the fastest function decoding complete quanta of
+    // numeric Base64 characters that is supported by the CPU on which this
+    // process is running.  Note that the CPU is queried only on the first
+    // call.
+{
+    static DecodeFunction s_decodeFunction = 0;
+
+    BSLMT_ONCE_DO {
+#if defined(U_USE_SSSE3)
+        unsigned int eax, ebx, ecx, edx;
+        __cpuid(1, eax, ebx, ecx, edx);
+
+        if (ecx & bit_SSSE3) {
+            s_decodeFunction = &decodeQuantaSsse3;
+        }
+        else {
+            s_decodeFunction = &decodeQuanta;
+        }
+#else
+        s_decodeFunction = &decodeQuanta;
+#endif
+    }
+
+    return s_decodeFunction;
+}
+
 namespace bdlde {
 
                          // -------------------
@@ -106,6 +289,69 @@ const bool *const Base64Decoder::s_ignorableRelaxed_p =
                                             charsThatCanBeIgnoredInRelaxedMode;
 const char *const Base64Decoder::s_decoding_p = decoding;
 
+// CLASS METHODS
+int Base64Decoder::decode(char        *out,
+                          bsl::size_t *numOut,
+                          const char  *input,
+                          bsl::size_t  length,
+                          bool         unrecognizedIsErrorFlag)
+{
+    BSLS_ASSERT(out);
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(input || 0 == length);
+
+    const DecodeFunction decodeQuantaFunction = decodeFunction();
+
+    // Characters the fast path cannot handle (whitespace, unrecognized
+    // characters, '=', and any numeric Base64 characters up to the next
+    // quantum boundary) are supplied, one at a time, to a streaming decoder,
+    // which thereby reports errors exactly as it would for the whole input.
+
+    Base64Decoder  decoder(unrecognizedIsErrorFlag);
+    const char    *end    = input + length;
+    char          *cursor = out;
+
+    while (input != end) {
+        if (e_INPUT_STATE == decoder.d_state && 0 == decoder.d_bitsInStack) {
+            // 'decoder' is at a quantum boundary, so complete quanta can be
+            // decoded directly.  Note that only the residue of the output
+            // length modulo 3 (here 0) is significant to 'decoder'; resetting
+            // it prevents overflow for very large inputs.
+
+            const bsl::size_t numIn = decodeQuantaFunction(cursor,
+                                                           input,
+                                                           end - input);
+            input                  += numIn;
+            cursor                 += numIn / 4 * 3;
+            decoder.d_outputLength  = 0;
+
+            if (input == end) {
+                break;
+            }
+        }
+
+        int numCharsOut;
+        int numCharsIn;
+        if (0 > decoder.convert(cursor,
+                                &numCharsOut,
+                                &numCharsIn,
+                                input,
+                                input + 1)) {
+            return -1;                                                // RETURN
+        }
+        cursor += numCharsOut;
+        input  += numCharsIn;
+    }
+
+    int numCharsOut;
+    if (0 > decoder.endConvert(cursor, &numCharsOut, -1)) {
+        return -1;                                                    // RETURN
+    }
+
+    *numOut = cursor + numCharsOut - out;
+    return 0;
+}
+
 
 // CREATORS
 
@@ -153,6 +153,20 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///One-Shot Decoding
+///-----------------
+// When the entire input is available in a contiguous buffer, the 'decode'
+// class method converts it in a single call.  It succeeds exactly when
+// 'convert' followed by 'endConvert' on a newly-created decoder in the same
+// error-reporting mode would succeed, and then produces the same output.
+// Runs of numeric Base64 characters are decoded 16 characters at a time using
+// SSSE3 instructions on platforms that support them (the instruction set is
+// checked once, at run time), and 4 characters at a time otherwise; only
+// whitespace, unrecognized characters, and the trailing '=' padding are
+// processed one character at a time.  Note that input broken into lines
+// whose length is a multiple of 4 (e.g., the 76-character lines produced by
+// default by 'bdlde::Base64Encoder') stays on the fast path.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Decoder' object to
@@ -398,6 +412,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #include <bsls_review.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 
 namespace bdlde {
@@ -455,6 +471,26 @@ class Base64Decoder {
 
   public:
     // CLASS METHODS
+    static int decode(char        *out,
+                      bsl::size_t *numOut,
+                      const char  *input,
+                      bsl::size_t  length,
+                      bool         unrecognizedIsErrorFlag);
+        // Decode the specified 'length' characters starting at the specified
+        // 'input' address into the specified 'out' buffer, and load into the
+        // specified 'numOut' the number of bytes written.  Unrecognized
+        // characters (i.e., non-base64 characters other than whitespace) are
+        // treated as errors if the specified 'unrecognizedIsErrorFlag' is
+        // 'true', and ignored otherwise.  Return 0 on success, and a negative
+        // value if 'input' is not a complete, valid Base64 encoding, in which
+        // case the contents of 'out' and 'numOut' are unspecified.  On
+        // success, the output is identical to that of 'convert' followed by
+        // 'endConvert' on a newly-created decoder configured with
+        // 'unrecognizedIsErrorFlag'.  The behavior is undefined unless 'out'
+        // has room for at least '(length + 3) / 4 * 3' bytes (see
+        // 'maxDecodedLength') and the input and output buffers do not
+        // overlap.
+
     static int maxDecodedLength(int inputLength);
         // Return the maximum number of decoded bytes that could result from an
         // input byte sequence of the specified 'inputLength' provided to the
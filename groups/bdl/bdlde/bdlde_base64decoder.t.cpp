@@ -15,6 +15,7 @@
 #include <bslim_testutil.h>
 
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_iostream.h>
 #include <bsl_cstdlib.h>   // atoi()
@@ -22,6 +23,8 @@
 #include <bsl_cctype.h>    // isgraph()
 #include <bsl_climits.h>   // INT_MIN
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <stdio.h>
 
@@ -175,6 +178,7 @@ using namespace bsl;  // automatically added by script
 // for the decoder; we will therefore ensure (using metafunctions) that no
 // default constructor can be instantiated.
 //-----------------------------------------------------------------------------
+// [12] static int decode(char *o, size_t *no, const char *i, size_t l, bool);
 // [ 2] bdlde::Base64Decoder(int unrecognizedIsErrorFlag);
 // [ 3] ~bdlde::Base64Decoder();
 // [ 8] int convert(char *o, int *no, int *ni, begin, end, int mno);
@@ -210,6 +214,7 @@ using namespace bsl;  // automatically added by script
 //*[ 8] That a specified maximum output length is observed.
 //*[ 8] That surplus output beyond 'maxNumOut' is buffered properly.
 //*[10] STRESS TEST: The decoder properly decodes all encoded output.
+// [-1] PERFORMANCE: ONE-SHOT DECODING THROUGHPUT
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1200,6 +1205,110 @@ int streamDecoder(bsl::ostream& os, bsl::istream& is)
 
 }  // close enterprise namespace
 
+                        // ==========================
+                        // ONE-SHOT DECODING HELPERS
+                        // ==========================
+
+namespace {
+
+unsigned int nextRandom(unsigned int *seed)
+    // Advance the specified 'seed' of a linear congruential generator and
+    // return its next (15-bit) pseudo-random value.
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (*seed >> 16) & 0x7fff;
+}
+
+bsl::string streamEncode(const char *input, int length, int maxLineLength)
+    // Return the Base64 encoding of the specified 'length' bytes starting at
+    // the specified 'input' address produced by an encoder having the
+    // specified 'maxLineLength'.
+{
+    bdlde::Base64Encoder encoder(maxLineLength);
+    bsl::string          result(
+                bdlde::Base64Encoder::encodedLength(length, maxLineLength), 0);
+
+    int numOut;
+    int numIn;
+    encoder.convert(result.begin(), &numOut, &numIn, input, input + length);
+    encoder.endConvert(result.begin() + numOut);
+
+    return result;
+}
+
+int streamDecode(bsl::string *result,
+                 const char  *input,
+                 int          length,
+                 bool         unrecognizedIsErrorFlag)
+    // Load into the specified 'result' the decoding of the specified 'length'
+    // characters starting at the specified 'input' address produced by the
+    // 'convert' and 'endConvert' methods of a decoder created with the
+    // specified 'unrecognizedIsErrorFlag'.  Return 0 on success, and a
+    // non-zero value otherwise.
+{
+    Obj decoder(unrecognizedIsErrorFlag);
+    result->resize(Obj::maxDecodedLength(length));
+
+    int numOut;
+    int numIn;
+    if (0 > decoder.convert(result->begin(),
+                            &numOut,
+                            &numIn,
+                            input,
+                            input + length)) {
+        return -1;                                                    // RETURN
+    }
+
+    int numEndOut;
+    if (0 > decoder.endConvert(result->begin() + numOut, &numEndOut)) {
+        return -1;                                                    // RETURN
+    }
+
+    result->resize(numOut + numEndOut);
+    return 0;
+}
+
+void checkOneShot(int line, const bsl::string& input)
+    // Verify that, in both error-reporting modes, 'Obj::decode' of the
+    // specified 'input' succeeds exactly when the streaming interface does,
+    // and then produces the same output, without writing past the end of an
+    // output buffer of the documented size.  Report failures using the
+    // specified 'line'.
+{
+    const char        GUARD    = '#';
+    const bsl::size_t CAPACITY = (input.length() + 3) / 4 * 3;
+
+    for (int mode = 0; mode < 2; ++mode) {
+        const bool STRICT = mode;
+
+        bsl::string expected;
+        const int   EXP_RC = streamDecode(&expected,
+                                          input.data(),
+                                          static_cast<int>(input.length()),
+                                          STRICT);
+
+        bsl::vector<char> output(CAPACITY + 16, GUARD);
+        bsl::size_t       numOut = 0;
+
+        const int rc = Obj::decode(&output[0],
+                                   &numOut,
+                                   input.data(),
+                                   input.length(),
+                                   STRICT);
+
+        ASSERTV(line, STRICT, input, EXP_RC, rc, (0 == EXP_RC) == (0 == rc));
+        if (0 == EXP_RC && 0 == rc) {
+            ASSERTV(line, STRICT, input,
+                    expected == bsl::string(&output[0], numOut));
+        }
+        for (bsl::size_t i = CAPACITY; i < output.size(); ++i) {
+            ASSERTV(line, STRICT, i, GUARD == output[i]);
+        }
+    }
+}
+
+}  // close unnamed namespace
+
 // ============================================================================
 //                                TEST CASES
 // ----------------------------------------------------------------------------
@@ -1209,6 +1318,151 @@ void testCase##NUMBER(bool verbose,                                           \
                       bool veryVeryVerbose,                                   \
                       bool veryVeryVeryVerbose)
 
+DEFINE_TEST_CASE(12)
+{
+        (void)veryVerbose;
+        (void)veryVeryVerbose;
+        (void)veryVeryVeryVerbose;
+
+        // --------------------------------------------------------------------
+        // TESTING ONE-SHOT 'decode'
+        //
+        // Concerns:
+        //: 1 'decode' succeeds exactly when 'convert' followed by 'endConvert'
+        //:   succeeds on a newly-created decoder in the same error-reporting
+        //:   mode, and then produces the same output.
+        //:
+        //: 2 'decode' correctly decodes the output of the encoder for every
+        //:   input length and maximum line length, in particular for line
+        //:   lengths that are and are not multiples of 4.
+        //:
+        //: 3 Every character value is classified correctly at every position
+        //:   of a vectorized block, including bytes having the high bit set,
+        //:   '=', whitespace, and characters adjacent to the numeric Base64
+        //:   ranges.
+        //:
+        //: 4 No byte is written past the end of an output buffer of the
+        //:   documented size.
+        //
+        // Plan:
+        //: 1 Encode pseudo-random data of every length up to 200 (and some
+        //:   much longer lengths) with a range of maximum line lengths, and
+        //:   verify that 'decode' recovers the data in both modes.  (C-2)
+        //:
+        //: 2 Using the 'checkOneShot' helper, which compares with the
+        //:   streaming interface in both modes and checks guard bytes after
+        //:   the output buffer, check each such encoding, each encoding with
+        //:   every character value substituted at every position, and each
+        //:   encoding with pseudo-random insertions and deletions of
+        //:   whitespace, '=', unrecognized, and numeric characters.
+        //:   (C-1, 3..4)
+        //
+        // Testing:
+        //   static int decode(char *o, size_t *no, const char *i, size_t l,
+        //                     bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ONE-SHOT 'decode'" << endl
+                          << "=========================" << endl;
+
+        static const int LINE_LENGTHS[] = { 0, 1, 2, 3, 4, 5, 7, 8, 16, 63,
+                                            64, 75, 76, 77 };
+        const int NUM_LINE_LENGTHS = sizeof  LINE_LENGTHS
+                                   / sizeof *LINE_LENGTHS;
+
+        static const char NOISE[] = { ' ', '\t', '\r', '\n', '=', '@', '-',
+                                      '_', '.', ':', '\0', '\x7f', '\x80',
+                                      '\xff', 'A', 'z', '0', '+', '/' };
+        const int NUM_NOISE = sizeof NOISE / sizeof *NOISE;
+
+        unsigned int seed = 54321;
+
+        bsl::vector<char> data(2000);
+        for (bsl::size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<char>(nextRandom(&seed));
+        }
+
+        if (verbose) cout << "\nDecode encoder output." << endl;
+        for (int li = 0; li < NUM_LINE_LENGTHS; ++li) {
+            const int MLL = LINE_LENGTHS[li];
+
+            for (int len = 0; len <= 2000; ++len) {
+                if (200 < len && 0 != len % 97) {
+                    continue;
+                }
+                const bsl::string ENCODED = streamEncode(&data[0], len, MLL);
+
+                for (int mode = 0; mode < 2; ++mode) {
+                    bsl::vector<char> output(
+                                          (ENCODED.length() + 3) / 4 * 3 + 1);
+                    bsl::size_t       numOut = 0;
+
+                    const int rc = Obj::decode(&output[0],
+                                               &numOut,
+                                               ENCODED.data(),
+                                               ENCODED.length(),
+                                               mode);
+                    ASSERTV(MLL, len, mode, 0 == rc);
+                    ASSERTV(MLL, len, mode, len == static_cast<int>(numOut));
+                    ASSERTV(MLL, len, mode,
+                            0 == len || 0 == bsl::memcmp(&output[0],
+                                                         &data[0],
+                                                         len));
+                }
+
+                checkOneShot(L_, ENCODED);
+            }
+        }
+
+        if (verbose) cout << "\nEvery character at every position." << endl;
+        {
+            const bsl::string ENCODED = streamEncode(&data[0], 45, 0);
+            ASSERT(60 == ENCODED.length());
+
+            for (int value = 0; value < 256; ++value) {
+                for (bsl::size_t pos = 0; pos < ENCODED.length(); ++pos) {
+                    bsl::string input(ENCODED);
+                    input[pos] = static_cast<char>(value);
+                    checkOneShot(L_, input);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nRandom insertions and deletions." << endl;
+        for (int iteration = 0; iteration < 20000; ++iteration) {
+            const int len = nextRandom(&seed) % 300;
+            const int MLL = LINE_LENGTHS[nextRandom(&seed) % NUM_LINE_LENGTHS];
+
+            bsl::string input = streamEncode(&data[0], len, MLL);
+
+            const int numEdits = 1 + nextRandom(&seed) % 3;
+            for (int e = 0; e < numEdits; ++e) {
+                const bsl::size_t pos = nextRandom(&seed)
+                                                    % (input.length() + 1);
+                const char        ch  = NOISE[nextRandom(&seed) % NUM_NOISE];
+
+                switch (nextRandom(&seed) % 3) {
+                  case 0: {
+                    input.insert(input.begin() + pos, ch);
+                  } break;
+                  case 1: {
+                    if (pos < input.length()) {
+                        input.erase(pos, 1);
+                    }
+                  } break;
+                  default: {
+                    if (pos < input.length()) {
+                        input[pos] = ch;
+                    }
+                  } break;
+                }
+            }
+
+            checkOneShot(L_, input);
+        }
+}
+
 DEFINE_TEST_CASE(11)
 {
         (void)veryVeryVerbose;
@@ -5616,6 +5870,7 @@ int main(int argc, char *argv[])
   case NUMBER: testCase##NUMBER(verbose, veryVerbose, veryVeryVerbose,        \
                                                     veryVeryVeryVerbose); break
 
+        CASE(12);
         CASE(11);
         CASE(10);
         CASE(9);
@@ -5628,6 +5883,75 @@ int main(int argc, char *argv[])
         CASE(2);
         CASE(1);
 #undef CASE
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ONE-SHOT DECODING THROUGHPUT
+        //
+        // Concerns:
+        //: 1 The one-shot 'decode' is substantially faster than the streaming
+        //:   'convert' for large inputs, with and without line breaks.
+        //
+        // Plan:
+        //: 1 Decode the encodings of a 4 MB buffer of pseudo-random data,
+        //:   produced with maximum line lengths of 0, 76, and 75, repeatedly
+        //:   with both interfaces, and report the throughput (in encoded
+        //:   characters) of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: ONE-SHOT DECODING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: ONE-SHOT DECODING THROUGHPUT" << endl
+             << "=========================================" << endl;
+
+        const int LENGTH     = 4 * 1024 * 1024;
+        const int ITERATIONS = argc > 2 ? atoi(argv[2]) : 20;
+        const int LINES[]    = { 0, 76, 75 };
+
+        unsigned int      seed = 1;
+        bsl::vector<char> data(LENGTH);
+        for (int i = 0; i < LENGTH; ++i) {
+            data[i] = static_cast<char>(nextRandom(&seed));
+        }
+        bsl::vector<char> output(LENGTH + 16);
+
+        for (int li = 0; li < 3; ++li) {
+            const int         MLL     = LINES[li];
+            const bsl::string ENCODED = streamEncode(&data[0], LENGTH, MLL);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                Obj decoder(true);
+                decoder.convert(&output[0],
+                                ENCODED.data(),
+                                ENCODED.data() + ENCODED.length());
+                decoder.endConvert(&output[0] + decoder.outputLength());
+            }
+            timer.stop();
+            const double streamTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                bsl::size_t numOut;
+                Obj::decode(&output[0],
+                            &numOut,
+                            ENCODED.data(),
+                            ENCODED.length(),
+                            true);
+            }
+            timer.stop();
+            const double oneShotTime = timer.elapsedTime();
+
+            const double MB = double(ENCODED.length()) * ITERATIONS
+                                                             / (1024 * 1024);
+            cout << "maxLineLength " << MLL
+                 << ": streaming " << MB / streamTime << " MB/s"
+                 << ", one-shot "  << MB / oneShotTime << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
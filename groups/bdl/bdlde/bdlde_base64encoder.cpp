@@ -12,7 +12,25 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_base64encoder_cpp,"$Id$ $CSID$")
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+#if (defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)) &&              \
+    defined(__SSSE3__) &&                                                     \
+   (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+    // The vectorized encoder needs 'pshufb', which the package options make
+    // available to the compiler ('-msse4.2'); whether the CPU that actually
+    // runs the code supports it is determined once, at run time, using
+    // 'cpuid' (see 'encodeFunction').
+
+#define U_USE_SSSE3
+#include <cpuid.h>
+#include <tmmintrin.h>
+#endif
 
 namespace BloombergLP {
 
@@ -35,6 +53,161 @@ static const char enc[] = {
     '4', '5', '6', '7', '8', '9', '+', '/',  // 070
 };
 
+                       // ========================
+                       // STATIC HELPER FUNCTIONS
+                       // ========================
+
+typedef char *(*EncodeFunction)(char        *out,
+                                const char  *input,
+                                bsl::size_t  length);
+    // 'EncodeFunction' is an alias for the signature of the functions that
+    // encode the complete 3-byte quanta of a contiguous input sequence.
+
+static
+char *encodeQuanta(char *out, const char *input, bsl::size_t length)
+    // Encode the largest multiple of 3 bytes not exceeding the specified
+    // 'length' starting at the specified 'input' address into the specified
+    // 'out' buffer, 3 bytes at a time, and return the address one past the
+    // last character written.
+{
+    const unsigned char *in = reinterpret_cast<const unsigned char *>(input);
+
+    for (; 3 <= length; length -= 3, in += 3, out += 4) {
+        const unsigned int bits = (in[0] << 16) | (in[1] << 8) | in[2];
+
+        out[0] = enc[ bits >> 18        ];
+        out[1] = enc[(bits >> 12) & 0x3f];
+        out[2] = enc[(bits >>  6) & 0x3f];
+        out[3] = enc[ bits        & 0x3f];
+    }
+
+    return out;
+}
+
+#if defined(U_USE_SSSE3)
+
+static inline
+__m128i encodeBlock(__m128i block)
+    // Return the 16 Base64 characters encoding the first 12 bytes of the
+    // specified 'block'.  The last 4 bytes of 'block' are ignored.
+{
+    // Gather the bytes of each 3-byte quantum into a 32-bit lane, in the
+    // order 'b1 b0 b2 b1' (from low to high address), so that each of the
+    // four 6-bit indices can be isolated by a 16-bit multiply (see "Base64
+    // encoding with SIMD instructions", W. Mula).
+
+    const __m128i in = _mm_shuffle_epi8(block,
+                                        _mm_setr_epi8( 1,  0,  2,  1,
+                                                       4,  3,  5,  4,
+                                                       7,  6,  8,  7,
+                                                      10,  9, 11, 10));
+
+    const __m128i hi = _mm_mulhi_epu16(
+                                 _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)),
+                                 _mm_set1_epi32(0x04000040));
+    const __m128i lo = _mm_mullo_epi16(
+                                 _mm_and_si128(in, _mm_set1_epi32(0x003f03f0)),
+                                 _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(hi, lo);
+
+    // Map each index to its character by adding an offset that depends only
+    // on the range ('A-Z', 'a-z', '0-9', '+', '/') containing the index;
+    // compute a small range number for each index and use it to look up the
+    // offset.
+
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    range = _mm_or_si128(range,
+                         _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26),
+                                                      indices),
+                                       _mm_set1_epi8(13)));
+
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '+' - 62,
+                                          '/' - 63, 'A',       0,
+                                          0);
+
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+}
+
+static
+char *encodeQuantaSsse3(char *out, const char *input, bsl::size_t length)
+    // Encode the largest multiple of 3 bytes not exceeding the specified
+    // 'length' starting at the specified 'input' address into the specified
+    // 'out' buffer, 12 bytes at a time while at least 16 bytes remain to be
+    // loaded, and return the address one past the last character written.
+    // The behavior is undefined unless the CPU supports SSSE3.
+{
+    for (; 16 <= length; length -= 12, input += 12, out += 16) {
+        const __m128i block = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(input));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         encodeBlock(block));
+    }
+
+    return encodeQuanta(out, input, length);
+}
+
+#endif  // U_USE_SSSE3
+
+static
+EncodeFunction encodeFunction()
+    // Return the address of the fastest function encoding complete 3-byte
+    // quanta that is supported by the CPU on which this process is running.
+    // Note that the CPU is queried only on the first call.
+{
+    static EncodeFunction s_encodeFunction = 0;
+
+    BSLMT_ONCE_DO {
+#if defined(U_USE_SSSE3)
+        unsigned int eax, ebx, ecx, edx;
+        __cpuid(1, eax, ebx, ecx, edx);
+
+        if (ecx & bit_SSSE3) {
+            s_encodeFunction = &encodeQuantaSsse3;
+        }
+        else {
+            s_encodeFunction = &encodeQuanta;
+        }
+#else
+        s_encodeFunction = &encodeQuanta;
+#endif
+    }
+
+    return s_encodeFunction;
+}
+
+static
+char *encodeAll(char           *out,
+                const char     *input,
+                bsl::size_t     length,
+                EncodeFunction  encodeQuantaFunction)
+    // Encode the specified 'length' bytes starting at the specified 'input'
+    // address into the specified 'out' buffer without line breaks, using the
+    // specified 'encodeQuantaFunction' for the complete 3-byte quanta and
+    // appending '=' padding after a final partial quantum.  Return the
+    // address one past the last character written.
+{
+    out = encodeQuantaFunction(out, input, length);
+
+    const bsl::size_t residual = length % 3;
+    if (residual) {
+        const unsigned char *in = reinterpret_cast<const unsigned char *>(
+                                                input + length - residual);
+        const unsigned int bits = (in[0] << 16)
+                                | (2 == residual ? in[1] << 8 : 0);
+
+        out[0] = enc[ bits >> 18        ];
+        out[1] = enc[(bits >> 12) & 0x3f];
+        out[2] = 2 == residual ? enc[(bits >> 6) & 0x3f] : '=';
+        out[3] = '=';
+        out += 4;
+    }
+
+    return out;
+}
+
 namespace bdlde {
 
                          // -------------------
@@ -45,6 +218,72 @@ namespace bdlde {
 const char *const Base64Encoder::s_encodedChars_p       = enc;
 const int         Base64Encoder::s_defaultMaxLineLength = 76;
 
+// CLASS METHODS
+bsl::size_t Base64Encoder::encode(char        *out,
+                                  const char  *input,
+                                  bsl::size_t  length,
+                                  int          maxLineLength)
+{
+    BSLS_ASSERT(out);
+    BSLS_ASSERT(input || 0 == length);
+    BSLS_ASSERT(0 <= maxLineLength);
+
+    const EncodeFunction encodeQuantaFunction = encodeFunction();
+
+    const bsl::size_t numChars   = (length + 2) / 3 * 4;
+    const bsl::size_t lineLength = maxLineLength;
+
+    if (0 == maxLineLength || numChars <= lineLength) {
+        return encodeAll(out, input, length, encodeQuantaFunction) - out;
+                                                                      // RETURN
+    }
+
+    // A CRLF follows each full line unless it is the last line of output.
+
+    const bsl::size_t numBreaks = (numChars - 1) / lineLength;
+    char             *cursor    = out;
+
+    if (0 == maxLineLength % 4) {
+        // Each full line encodes a whole number of 3-byte quanta, so the
+        // lines can be encoded directly into place.
+
+        const bsl::size_t lineInputLength = lineLength / 4 * 3;
+
+        for (bsl::size_t i = 0; i < numBreaks; ++i) {
+            cursor = encodeQuantaFunction(cursor, input, lineInputLength);
+            *cursor++ = '\r';
+            *cursor++ = '\n';
+
+            input  += lineInputLength;
+            length -= lineInputLength;
+        }
+
+        return encodeAll(cursor, input, length, encodeQuantaFunction) - out;
+                                                                      // RETURN
+    }
+
+    // Otherwise, encode the output without line breaks into the end of 'out',
+    // then move each line to its final position, from first to last.  Each
+    // line (and the CRLF following it) moves toward the start of 'out', so no
+    // line is overwritten before it has been moved.
+
+    const char *line = out + 2 * numBreaks;
+    encodeAll(out + 2 * numBreaks, input, length, encodeQuantaFunction);
+
+    for (bsl::size_t i = 0; i < numBreaks; ++i) {
+        bsl::memmove(cursor, line, lineLength);
+        cursor += lineLength;
+        line   += lineLength;
+        *cursor++ = '\r';
+        *cursor++ = '\n';
+    }
+
+    const bsl::size_t lastLineLength = numChars - numBreaks * lineLength;
+    bsl::memmove(cursor, line, lastLineLength);
+
+    return numChars + 2 * numBreaks;
+}
+
 // CREATORS
 Base64Encoder::~Base64Encoder()
 {
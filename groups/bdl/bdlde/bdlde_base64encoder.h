@@ -153,6 +153,19 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///One-Shot Encoding
+///-----------------
+// When the entire input is available in a contiguous buffer, the 'encode'
+// class method converts it in a single call, producing exactly the output
+// (including soft line breaks and trailing '=' padding) that 'convert'
+// followed by 'endConvert' would produce for an encoder configured with the
+// same maximum line length.  The caller supplies an output buffer of (at
+// least) 'encodedLength' characters.  Unlike the streaming interface, 'encode'
+// converts 12 input bytes at a time using SSSE3 instructions on platforms
+// that support them (the instruction set is checked once, at run time),
+// and 3 bytes at a time otherwise; this is several times faster than
+// 'convert' for large inputs.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Encoder' object to
@@ -396,6 +409,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #include <bsls_review.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 
 namespace bdlde {
@@ -456,6 +471,25 @@ class Base64Encoder {
 
   public:
     // CLASS METHODS
+    static bsl::size_t encode(char        *out,
+                              const char  *input,
+                              bsl::size_t  length);
+    static bsl::size_t encode(char        *out,
+                              const char  *input,
+                              bsl::size_t  length,
+                              int          maxLineLength);
+        // Encode the specified 'length' bytes starting at the specified
+        // 'input' address into the specified 'out' buffer, and return the
+        // number of characters written.  Optionally specify the
+        // 'maxLineLength' of the output; if 'maxLineLength' is not specified,
+        // the maximum line length is 76 characters (as recommended by the
+        // MIME standard).  The output is identical to that of 'convert'
+        // followed by 'endConvert' on a newly-created encoder having the same
+        // maximum line length.  The behavior is undefined unless
+        // '0 <= maxLineLength', 'out' has room for at least
+        // 'encodedLength(length, maxLineLength)' characters, and the input and
+        // output buffers do not overlap.
+
     static int encodedLength(int inputLength);
         // Return the exact number of encoded bytes that would result from an
         // input byte sequence of the specified 'inputLength' provided to the
@@ -680,6 +714,14 @@ void Base64Encoder::encode(OUTPUT_ITERATOR *out, int maxLength)
 }
 
 // CLASS METHODS
+inline
+bsl::size_t Base64Encoder::encode(char        *out,
+                                  const char  *input,
+                                  bsl::size_t  length)
+{
+    return encode(out, input, length, s_defaultMaxLineLength);
+}
+
 inline
 int Base64Encoder::encodedLength(int inputLength, int maxLineLength)
 {
@@ -14,7 +14,9 @@
 
 #include <bsls_assert.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>   // atoi()
@@ -22,6 +24,8 @@
 #include <bsl_cctype.h>    // isgraph()
 #include <bsl_climits.h>   // INT_MAX
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -95,6 +99,8 @@ using namespace bsl;  // automatically added by script
 // arguments, 'bdeut::InputIterator' for 'convert' and 'bdeut::OutputIterator'
 // for both of these template methods.
 //-----------------------------------------------------------------------------
+// [14] static size_t encode(char *out, const char *in, size_t length);
+// [14] static size_t encode(char *out, const char *in, size_t len, int mll);
 // [ 7] static int encodedLength(int numInputBytes, int maxLineLength);
 // [10] bdlde::Base64Encoder();
 // [ 2] bdlde::Base64Encoder(int maxLineLength);
@@ -129,6 +135,7 @@ using namespace bsl;  // automatically added by script
 // [ 7] That each bit of a 2-byte quantum finds its appropriate spot.
 // [ 7] That each bit of a 1-byte quantum finds its appropriate spot.
 // [ 7] That output length is calculated properly.
+// [-1] PERFORMANCE: ONE-SHOT ENCODING THROUGHPUT
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1202,6 +1209,49 @@ int streamDecoder(bsl::ostream& os, bsl::istream& is)
     return (is.eof() && os.good()) ? e_SUCCESS : e_IO_ERROR;
 }
 
+                        // ==========================
+                        // ONE-SHOT ENCODING HELPERS
+                        // ==========================
+
+namespace {
+
+unsigned int nextRandom(unsigned int *seed)
+    // Advance the specified 'seed' of a linear congruential generator and
+    // return its next (15-bit) pseudo-random value.
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (*seed >> 16) & 0x7fff;
+}
+
+bsl::string streamEncode(const char *input, int length, int maxLineLength)
+    // Return the Base64 encoding of the specified 'length' bytes starting at
+    // the specified 'input' address produced by the 'convert' and
+    // 'endConvert' methods of an encoder having the specified
+    // 'maxLineLength'.
+{
+    Obj         encoder(maxLineLength);
+    bsl::string result(Obj::encodedLength(length, maxLineLength), '?');
+
+    int numOut;
+    int numIn;
+    int rc = encoder.convert(result.begin(),
+                             &numOut,
+                             &numIn,
+                             input,
+                             input + length);
+    ASSERT(0 == rc);
+    ASSERT(length == numIn);
+
+    int numEndOut;
+    rc = encoder.endConvert(result.begin() + numOut, &numEndOut);
+    ASSERT(0 == rc);
+    ASSERT(static_cast<int>(result.length()) == numOut + numEndOut);
+
+    return result;
+}
+
+}  // close unnamed namespace
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1220,6 +1270,151 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING ONE-SHOT 'encode'
+        //
+        // Concerns:
+        //: 1 'encode' produces exactly the output of 'convert' followed by
+        //:   'endConvert', including soft line breaks and '=' padding, for
+        //:   every input length and maximum line length, in particular for
+        //:   line lengths that are and are not multiples of 4.
+        //:
+        //: 2 The return value is the number of characters written, which is
+        //:   'encodedLength(length, maxLineLength)'.
+        //:
+        //: 3 No character is written beyond the encoded length.
+        //:
+        //: 4 Every byte value is encoded correctly at every position of a
+        //:   vectorized block, and the result does not depend on the
+        //:   alignment of the input or output buffers.
+        //:
+        //: 5 The two-argument overload uses a maximum line length of 76.
+        //
+        // Plan:
+        //: 1 For every input length up to 200 (enough to cover several
+        //:   vectorized blocks and their scalar tail) and every maximum line
+        //:   length up to 80, as well as some much longer inputs, encode
+        //:   pseudo-random data at each of several input and output offsets
+        //:   and compare the result with that of the streaming interface.
+        //:   Place guard characters after the expected end of the output.
+        //:   (C-1..3)
+        //:
+        //: 2 Encode, for every byte value, a buffer in which that value
+        //:   appears at every position, and compare with the streaming
+        //:   interface.  (C-4)
+        //:
+        //: 3 Compare the output of the overload lacking 'maxLineLength' with
+        //:   that of a streaming encoder created with its default
+        //:   constructor.  (C-5)
+        //
+        // Testing:
+        //   static size_t encode(char *out, const char *in, size_t length);
+        //   static size_t encode(char *out, const char *in, size_t len, mll);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ONE-SHOT 'encode'" << endl
+                          << "=========================" << endl;
+
+        const int  MAX_LENGTH = 200;
+        const char GUARD      = '#';
+
+        unsigned int seed = 12345;
+
+        bsl::vector<char> input(2000 + 16);
+        for (bsl::size_t i = 0; i < input.size(); ++i) {
+            input[i] = static_cast<char>(nextRandom(&seed));
+        }
+
+        if (verbose) cout << "\nCompare with streaming encoder." << endl;
+        {
+            bsl::vector<char> output(Obj::encodedLength(2000, 1) + 32);
+
+            for (int mll = 0; mll <= 80; ++mll) {
+                for (int len = 0; len <= MAX_LENGTH + 1800; ++len) {
+                    if (MAX_LENGTH < len && 0 != len % 97) {
+                        continue;
+                    }
+                    for (int inOff = 0; inOff < 3; ++inOff) {
+                        const int outOff = (inOff + mll) % 4;
+
+                        const char        *IN  = &input[inOff];
+                        const bsl::string  EXP = streamEncode(IN, len, mll);
+
+                        bsl::fill(output.begin(), output.end(), GUARD);
+
+                        const bsl::size_t numOut = Obj::encode(
+                                                              &output[outOff],
+                                                              IN,
+                                                              len,
+                                                              mll);
+
+                        ASSERTV(mll, len, inOff, EXP.length() == numOut);
+                        ASSERTV(mll, len, inOff,
+                                EXP == bsl::string(&output[outOff], numOut));
+                        for (int i = 0; i < outOff; ++i) {
+                            ASSERTV(mll, len, i, GUARD == output[i]);
+                        }
+                        for (bsl::size_t i = outOff + numOut;
+                             i < outOff + numOut + 16;
+                             ++i) {
+                            ASSERTV(mll, len, i, GUARD == output[i]);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nEvery byte value at every position." << endl;
+        {
+            char buffer[48];
+            char output[64 + 16];
+
+            for (int value = 0; value < 256; ++value) {
+                for (int i = 0; i < 48; ++i) {
+                    buffer[i] = static_cast<char>(nextRandom(&seed));
+                }
+                for (int pos = 0; pos < 48; ++pos) {
+                    const char saved = buffer[pos];
+                    buffer[pos] = static_cast<char>(value);
+
+                    const bsl::string EXP = streamEncode(buffer, 48, 0);
+                    const bsl::size_t numOut = Obj::encode(output,
+                                                           buffer,
+                                                           48,
+                                                           0);
+
+                    ASSERTV(value, pos, 64 == numOut);
+                    ASSERTV(value, pos, EXP == bsl::string(output, numOut));
+
+                    buffer[pos] = saved;
+                }
+            }
+        }
+
+        if (verbose) cout << "\nDefault maximum line length." << endl;
+        {
+            bsl::vector<char> output(Obj::encodedLength(1000) + 16);
+
+            for (int len = 0; len <= 1000; len += 7) {
+                Obj         encoder;
+                bsl::string expected(Obj::encodedLength(len), '?');
+
+                ASSERT(0 == encoder.convert(expected.begin(),
+                                            &input[0],
+                                            &input[0] + len));
+                ASSERT(0 == encoder.endConvert(expected.begin() +
+                                                     encoder.outputLength()));
+
+                const bsl::size_t numOut = Obj::encode(&output[0],
+                                                       &input[0],
+                                                       len);
+
+                ASSERTV(len, expected == bsl::string(&output[0], numOut));
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING OPTIONAL NUMIN, NUMOUT
@@ -3565,6 +3760,71 @@ LOOP4_ASSERT(LINE, index, totalOut, localTotalOut, totalOut == localTotalOut);
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ONE-SHOT ENCODING THROUGHPUT
+        //
+        // Concerns:
+        //: 1 The one-shot 'encode' is substantially faster than the streaming
+        //:   'convert' for large inputs, with and without line breaks.
+        //
+        // Plan:
+        //: 1 Encode a 4 MB buffer of pseudo-random data repeatedly with both
+        //:   interfaces, using maximum line lengths of 0, 76, and 75, and
+        //:   report the throughput of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: ONE-SHOT ENCODING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: ONE-SHOT ENCODING THROUGHPUT" << endl
+             << "=========================================" << endl;
+
+        const int LENGTH     = 4 * 1024 * 1024;
+        const int ITERATIONS = argc > 2 ? atoi(argv[2]) : 20;
+        const int LINES[]    = { 0, 76, 75 };
+
+        unsigned int      seed = 1;
+        bsl::vector<char> input(LENGTH);
+        for (int i = 0; i < LENGTH; ++i) {
+            input[i] = static_cast<char>(nextRandom(&seed));
+        }
+
+        for (int li = 0; li < 3; ++li) {
+            const int         MLL = LINES[li];
+            bsl::vector<char> output(Obj::encodedLength(LENGTH, MLL));
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                Obj encoder(MLL);
+                int numOut;
+                int numIn;
+                encoder.convert(&output[0],
+                                &numOut,
+                                &numIn,
+                                &input[0],
+                                &input[0] + LENGTH);
+                encoder.endConvert(&output[0] + numOut);
+            }
+            timer.stop();
+            const double streamTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                Obj::encode(&output[0], &input[0], LENGTH, MLL);
+            }
+            timer.stop();
+            const double oneShotTime = timer.elapsedTime();
+
+            const double MB = double(LENGTH) * ITERATIONS / (1024 * 1024);
+            cout << "maxLineLength " << MLL
+                 << ": streaming " << MB / streamTime << " MB/s"
+                 << ", one-shot "  << MB / oneShotTime << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
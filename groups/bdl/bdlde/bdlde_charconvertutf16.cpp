@@ -14,16 +14,24 @@ BSLS_IDENT("$Id$ $CSID$")
 
 #include <bdlde_charconvertstatus.h>
 
+#include <bdlb_bitutil.h>
+
 #include <bsla_maybeunused.h>
 #include <bslmf_assert.h>
 #include <bslmf_issame.h>
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>  // 'min'
 #include <bsl_climits.h>    // 'CHAR_BIT'
 #include <bsl_cstdint.h>    // 'WCHAR_WIDTH'
 
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define U_USE_SSE2
+#include <emmintrin.h>
+#endif
+
 ///IMPLEMENTATION NOTES
 ///--------------------
 // This UTF-8 documentation was copied verbatim from RFC 3629.  The original
@@ -325,13 +333,19 @@ struct Capacity {
     void operator--() { --d_capacity; }
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta) { d_capacity -= delta; }
+    void operator-=(bsl::size_t delta) { d_capacity -= delta; }
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
     bool operator<(bsl::size_t rhs) const { return d_capacity < rhs; }
         // Return 'true' if 'd_capacity' is less than the specified 'rhs', and
         // 'false' otherwise.
+
+    bsl::size_t limit(bsl::size_t numWords) const
+        // Return the lesser of the specified 'numWords' and 'd_capacity'.
+    {
+        return bsl::min(numWords, d_capacity);
+    }
 };
 
 struct NoOpCapacity {
@@ -345,12 +359,15 @@ struct NoOpCapacity {
     void operator--() {}
         // No-op.
 
-    void operator-=(int) {}
+    void operator-=(bsl::size_t) {}
         // No-op.
 
     // ACCESSORS
     bool operator<(bsl::size_t) const { return false; }
         // Return 'false'.
+
+    bsl::size_t limit(bsl::size_t numWords) const { return numWords; }
+        // Return the specified 'numWords'.
 };
 
 // LOCAL HELPER STRUCT
@@ -462,6 +479,38 @@ struct Utf8 {
 
             return true;
         }
+
+        const OctetType *skipAscii(const OctetType *octets) const
+            // Return a pointer to the first octet at or after the specified
+            // 'octets' that is not a single-octet (ASCII) code point, or
+            // 'd_end' if there is no such octet.  The behavior is undefined
+            // unless 'octets <= d_end'.
+        {
+            BSLS_ASSERT(d_end >= octets);
+
+#if defined(U_USE_SSE2)
+            // Runs of ASCII are the common case in most text, so examine 16
+            // octets at a time, using the high bit of each.
+
+            while (d_end - octets >= 16) {
+                const int highBits = _mm_movemask_epi8(_mm_loadu_si128(
+                                 reinterpret_cast<const __m128i *>(octets)));
+                if (highBits) {
+                    return octets + BloombergLP::bdlb::BitUtil::
+                                         numTrailingUnsetBits(
+                                       static_cast<bsl::uint32_t>(highBits));
+                                                                      // RETURN
+                }
+                octets += 16;
+            }
+#endif
+
+            while (octets < d_end && 0 == (*octets & ONE_OCTET_MASK)) {
+                ++octets;
+            }
+
+            return octets;
+        }
     };
 
     struct ZeroBasedEnd {
@@ -513,6 +562,22 @@ struct Utf8 {
 
             return true;
         }
+
+        const OctetType *skipAscii(const OctetType *octets) const
+            // Return a pointer to the first octet at or after the specified
+            // 'octets' that is either not a single-octet (ASCII) code point
+            // or is the terminating 0.
+        {
+            // Reading ahead in blocks could cross the terminating 0 into
+            // memory that may not be readable, so examine one octet at a
+            // time.
+
+            while (0 != *octets && 0 == (*octets & ONE_OCTET_MASK)) {
+                ++octets;
+            }
+
+            return octets;
+        }
     };
 
     // CLASS METHODS
@@ -1041,8 +1106,11 @@ bsl::size_t utf16BufferLength(const char  *srcBuffer,
                                           static_cast<const void*>(srcBuffer));
     while (!endFunctor.isFinished(octets)) {
         if      (Utf8::isSingleOctet(     *octets)) {
-            ++octets;
-            ++wordsNeeded;
+            // Every octet of a run of ASCII is translated to one word.
+
+            const Utf8::OctetType *runEnd = endFunctor.skipAscii(octets + 1);
+            wordsNeeded += runEnd - octets;
+            octets       = runEnd;
         }
         else if (Utf8::isTwoOctetHeader(  *octets)) {
             octets += endFunctor.verifyContinuations(octets + 1, 1) ? 2 : 1;
@@ -1166,7 +1234,8 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
             break;
         }
 
-        // Single-octet case is simple and quick.
+        // Single-octet case is simple and quick, so translate the whole run
+        // of ASCII starting here, as far as the output capacity permits.
 
         if (Utf8::isSingleOctet(*octets)) {
             if (dstCapacity < 2) {
@@ -1176,11 +1245,18 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
                 break;
             }
 
-            *dstBuffer = SWAPPER::encodeSingleWord(*octets);
-            ++octets;
-            ++dstBuffer;
-            --dstCapacity;
-            ++nCodePoints;
+            const Utf8::OctetType *runEnd    = endFunctor.skipAscii(
+                                                                  octets + 1);
+            const bsl::size_t      runLength = dstCapacity.limit(
+                                                    runEnd - octets + 1) - 1;
+
+            for (bsl::size_t i = 0; i < runLength; ++i) {
+                dstBuffer[i] = SWAPPER::encodeSingleWord(octets[i]);
+            }
+            octets      += runLength;
+            dstBuffer   += runLength;
+            dstCapacity -= runLength;
+            nCodePoints += runLength;
             continue;
         }
 
@@ -13,18 +13,27 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
 
+#include <bdlb_bitutil.h>
+
 #include <bslmf_assert.h>     // 'BSLMF_ASSERT'
 #include <bslmf_issame.h>
 
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>    // 'bsl::find'
 
 #include <bsl_climits.h>      // 'CHAR_BIT'
+#include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define U_USE_SSE2
+#include <emmintrin.h>
+#endif
+
 ///IMPLEMENTATION NOTES
 ///--------------------
 // This UTF-8 documentation was copied verbatim from RFC 3629.  The original
@@ -182,7 +191,7 @@ struct Capacity {
     void operator--();
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta);
+    void operator-=(bsl::size_t delta);
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
@@ -193,6 +202,9 @@ struct Capacity {
     bool operator>=(bsl::size_t rhs) const;
         // Return 'true' if 'd_capacity' is greater than or equal to the
         // specified 'rhs', and 'false' otherwise.
+
+    bsl::size_t limit(bsl::size_t numWords) const;
+        // Return the lesser of the specified 'numWords' and 'd_capacity'.
 };
 
                            // ---------------------
@@ -214,7 +226,7 @@ void Capacity::operator--()
 }
 
 inline
-void Capacity::operator-=(int delta)
+void Capacity::operator-=(bsl::size_t delta)
     // Decrement 'd_capacity' by 'delta'.
 {
     d_capacity -= delta;
@@ -237,6 +249,13 @@ bool Capacity::operator>=(bsl::size_t rhs) const
     return d_capacity >= rhs;
 }
 
+inline
+bsl::size_t Capacity::limit(bsl::size_t numWords) const
+    // Return the lesser of the specified 'numWords' and 'd_capacity'.
+{
+    return bsl::min(numWords, d_capacity);
+}
+
                          // =========================
                          // local struct NoopCapacity
                          // =========================
@@ -257,7 +276,7 @@ struct NoopCapacity {
     void operator--();
         // No-op.
 
-    void operator-=(int);
+    void operator-=(bsl::size_t);
         // No-op.
 
     // ACCESSORS
@@ -266,6 +285,9 @@ struct NoopCapacity {
 
     bool operator>=(bsl::size_t) const;
         // Return 'true'.
+
+    bsl::size_t limit(bsl::size_t numWords) const;
+        // Return the specified 'numWords'.
 };
 
                          // -------------------------
@@ -285,7 +307,7 @@ void NoopCapacity::operator--()
 {}
 
 inline
-void NoopCapacity::operator-=(int)
+void NoopCapacity::operator-=(bsl::size_t)
     // No-op.
 {}
 
@@ -304,6 +326,13 @@ bool NoopCapacity::operator>=(bsl::size_t) const
     return true;
 }
 
+inline
+bsl::size_t NoopCapacity::limit(bsl::size_t numWords) const
+    // Return the specified 'numWords'.
+{
+    return numWords;
+}
+
                             // ====================
                             // local struct Swapper
                             // ====================
@@ -381,6 +410,12 @@ class Utf8PtrBasedEnd {
         // bytes beginning at the specified 'octets' and prior to 'd_end', and
         // 'false' otherwise.  The behavior is undefined if 'octets' is past
         // the end.  The behavior is undefined unless 'octets <= d_end'.
+
+    const OctetType *skipAscii(const OctetType *octets) const;
+        // Return a pointer to the first octet at or after the specified
+        // 'octets' that is not a single-octet (ASCII) code point, or 'd_end'
+        // if there is no such octet.  The behavior is undefined unless
+        // 'octets <= d_end'.
 };
 
                         // ---------------------------
@@ -448,6 +483,35 @@ bool Utf8PtrBasedEnd::verifyContinuations(const OctetType *octets,
     return true;
 }
 
+inline
+const OctetType *Utf8PtrBasedEnd::skipAscii(const OctetType *octets) const
+{
+    BSLS_ASSERT(d_end >= octets);
+
+#if defined(U_USE_SSE2)
+    // Runs of ASCII are the common case in most text, so examine 16 octets at
+    // a time, using the high bit of each.
+
+    while (d_end - octets >= 16) {
+        const int highBits = _mm_movemask_epi8(
+                      _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                                   octets)));
+        if (highBits) {
+            return octets + BloombergLP::bdlb::BitUtil::numTrailingUnsetBits(
+                                       static_cast<bsl::uint32_t>(highBits));
+                                                                      // RETURN
+        }
+        octets += 16;
+    }
+#endif
+
+    while (octets < d_end && 0 == (*octets & k_ONE_OCTET_MASK)) {
+        ++octets;
+    }
+
+    return octets;
+}
+
                        // =============================
                        // local struct Utf8ZeroBasedEnd
                        // =============================
@@ -474,6 +538,12 @@ struct Utf8ZeroBasedEnd {
         // Return 'true' if there are at least the specified 'n' continuation
         // bytes beginning at the specified 'octets' and 'false' otherwise.
         // The behavior is undefined unless 'n >= 1'.
+
+    const OctetType *skipAscii(const OctetType *octets) const;
+        // Return a pointer to the first octet at or after the specified
+        // 'octets' that is either not a single-octet (ASCII) code point or is
+        // the terminating 0.  The behavior is undefined unless 'octets' is
+        // before or at the end of input.
 };
 
                        // -----------------------------
@@ -529,6 +599,19 @@ bool Utf8ZeroBasedEnd::verifyContinuations(const OctetType *octets,
     return true;
 }
 
+inline
+const OctetType *Utf8ZeroBasedEnd::skipAscii(const OctetType *octets) const
+{
+    // Reading ahead in blocks could cross the terminating 0 into memory that
+    // may not be readable, so examine one octet at a time.
+
+    while (0 != *octets && 0 == (*octets & k_ONE_OCTET_MASK)) {
+        ++octets;
+    }
+
+    return octets;
+}
+
 
                         // ============================
                         // local class Utf32PtrBasedEnd
@@ -867,8 +950,18 @@ bsl::size_t utf32BufferLengthNeeded(const char  *input,
     const OctetType *octets = constOctetCast(input);
 
     bsl::size_t ret = 0;
-    for (; ! endFunctor.isFinished(octets); ++ret) {
-        octets = skipUtf8CodePoint(octets);
+    while (! endFunctor.isFinished(octets)) {
+        if (isSingleOctet(*octets)) {
+            // Every octet of a run of ASCII is a code point.
+
+            const OctetType *runEnd = endFunctor.skipAscii(octets + 1);
+            ret    += runEnd - octets;
+            octets  = runEnd;
+        }
+        else {
+            octets = skipUtf8CodePoint(octets);
+            ++ret;
+        }
     }
 
     return ret + 1;
@@ -1007,9 +1100,11 @@ class Utf8ToUtf32Translator {
     int decodeCodePoint();
         // Read one Unicode code point of UTF-8 from the input stream
         // 'd_input', and update the output and the state of this object
-        // accordingly.  Return a non-zero value if there was insufficient
-        // capacity for the output, and 0 otherwise.  The behavior is undefined
-        // unless at least 1 word of space is available in the output buffer.
+        // accordingly.  If that code point is ASCII, also translate as much of
+        // the run of ASCII following it as the output capacity permits.
+        // Return a non-zero value if there was insufficient capacity for the
+        // output, and 0 otherwise.  The behavior is undefined unless at least
+        // 1 word of space is available in the output buffer.
 
   public:
     // CLASS METHODS
@@ -1083,9 +1178,22 @@ int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::decodeCodePoint()
     }
 
     if      (isSingleOctet(     firstOctet)) {
-        len = 1;
-        good = true;
-        decodedCodePoint = firstOctet;
+        // Translate the whole run of ASCII, leaving room for the terminating
+        // 0 word.  Note that 'd_capacity >= 2' here, so 'runLength >= 1'.
+
+        const OctetType   *runEnd    = d_endFunctor.skipAscii(d_input + 1);
+        const bsl::size_t  runLength = d_capacity.limit(
+                                                   runEnd - d_input + 1) - 1;
+
+        for (bsl::size_t i = 0; i < runLength; ++i) {
+            d_output[i] = SWAPPER::swapBytes(d_input[i]);
+        }
+
+        d_input    += runLength;
+        d_output   += runLength;
+        d_capacity -= runLength;
+
+        return 0;                                                     // RETURN
     }
     else if (isTwoOctetHeader(  firstOctet)) {
         len = 2;
@@ -12,13 +12,38 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 
+#include <bdlb_bitutil.h>
+
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
 
 // LOCAL MACROS
 
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
 
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define U_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(U_USE_SSE2) && defined(__SSSE3__) &&                             \
+   (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+    // The lookup-table validator needs 'pshufb' and 'palignr', which the
+    // package options make available to the compiler ('-msse4.2'); whether
+    // the CPU that actually runs the code supports them is determined once,
+    // at run time, using 'cpuid' (see 'validateFunction').
+
+#define U_USE_SSSE3
+#include <cpuid.h>
+#include <tmmintrin.h>
+#endif
+
 // LOCAL CONSTANTS
 
 namespace {
@@ -239,9 +264,11 @@ int validateAndCountCodePoints(const char **invalidString, const char *string)
     }
 }
 
-static int validateAndCountCodePoints(const char             **invalidString,
-                                      const char              *string,
-                                      bsls::Types::size_type   length)
+static
+bsls::Types::IntPtr validateAndCountCodePoints(
+                                       const char             **invalidString,
+                                       const char              *string,
+                                       bsls::Types::size_type   length)
     // Return the number of Unicode code points in the specified 'string'
     // having the specified 'length' (in bytes) if 'string' contains valid
     // UTF-8, with no effect on the specified 'invalidString'.  Otherwise,
@@ -262,7 +289,7 @@ static int validateAndCountCodePoints(const char             **invalidString,
     const char       *pc     = string;
     const char *const pcEnd4 = string + length - 4;
 
-    int count = 0;
+    bsls::Types::IntPtr count = 0;
 
     while (pc <= pcEnd4) {
         switch ((*pc >> 4) & 0xf) {
@@ -399,6 +426,328 @@ static int validateAndCountCodePoints(const char             **invalidString,
     return count;
 }
 
+// Vectorized Validation
+// ---------------------
+// The scalar validators above decode one code point per iteration.  For
+// length-delimited input of at least 'k_MIN_VECTOR_LENGTH' bytes on a CPU
+// supporting SSSE3, 'validateAndCountCodePointsSsse3' is used instead.  It
+// examines 16 bytes per iteration: a block that is entirely ASCII only needs
+// to be checked for a sequence left incomplete by the previous block;
+// otherwise every byte is classified by looking up its high nibble, the low
+// and high nibbles of the byte preceding it, in three 16-entry tables with
+// 'pshufb', and AND-ing the results, so that each of the error patterns of
+// RFC 3629 sets a bit.  Code points are counted as the number of bytes that
+// are not continuation bytes.
+//
+// The vectorized pass only determines *whether* a block is valid.  To report
+// exactly the same 'invalidString' as the scalar validator, once a block
+// containing an error is found (or fewer than 16 bytes remain), the scan
+// backs up to the last code point that started within the 3 preceding bytes
+// -- every sequence that started before that point has been completely
+// verified -- and the scalar validator finishes the job from there.
+
+enum { k_MIN_VECTOR_LENGTH = 32 };
+    // Minimum length of a string for which it is worth dispatching to the
+    // vectorized validator.
+
+static inline
+const char *lastCodePointStart(const char *begin, const char *position)
+    // Return the address of the last byte, among the (up to) 3 bytes that
+    // precede the specified 'position' but do not precede the specified
+    // 'begin', that is not a UTF-8 continuation byte, or 'position' if there
+    // is no such byte.
+{
+    for (int i = 1; i <= 3 && position - i >= begin; ++i) {
+        if (isNotContinuation(position[-i])) {
+            return position - i;                                      // RETURN
+        }
+    }
+
+    return position;
+}
+
+#if defined(U_USE_SSSE3)
+
+enum {
+    // Error flags used by the lookup tables of 'findErrors'.  Each names the
+    // error pattern, expressed on the pair of bytes formed by a byte and its
+    // predecessor, that is diagnosed when all three table lookups for the
+    // pair have the flag set.
+
+    k_TOO_SHORT      = 1 << 0,  // lead byte not followed by a continuation
+    k_TOO_LONG       = 1 << 1,  // ASCII followed by a continuation
+    k_OVERLONG_3     = 1 << 2,  // 0xe0 followed by '[0x80 .. 0x9f]'
+    k_TOO_LARGE      = 1 << 3,  // 0xf4 and above followed by '[0x90 .. 0xbf]'
+    k_SURROGATE      = 1 << 4,  // 0xed followed by '[0xa0 .. 0xbf]'
+    k_OVERLONG_2     = 1 << 5,  // 0xc0 or 0xc1 followed by a continuation
+    k_TOO_LARGE_1000 = 1 << 6,  // 0xf5 and above followed by '[0x80 .. 0x8f]'
+    k_OVERLONG_4     = 1 << 6,  // 0xf0 followed by '[0x80 .. 0x8f]'
+    k_TWO_CONTS      = 1 << 7,  // continuation following a continuation
+
+    k_CARRY          = k_TOO_SHORT | k_TOO_LONG | k_TWO_CONTS
+                                // errors independent of the low nibble
+};
+
+static inline
+__m128i findErrors(__m128i input, __m128i previous)
+    // Return a vector having a non-zero byte at each position where the byte
+    // in the specified 'input' block, taken together with the (up to) three
+    // bytes preceding it, which are found at the end of the specified
+    // 'previous' block when necessary, is not consistent with valid UTF-8,
+    // and a zero byte otherwise.  Note that a sequence that is left
+    // incomplete at the end of 'input' is not diagnosed.
+{
+    const __m128i byte1HighTable = _mm_setr_epi8(
+        k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+        k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+        k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS,
+        k_TOO_SHORT | k_OVERLONG_2,
+        k_TOO_SHORT,
+        k_TOO_SHORT | k_OVERLONG_3 | k_SURROGATE,
+        static_cast<char>(k_TOO_SHORT | k_TOO_LARGE | k_TOO_LARGE_1000
+                                                             | k_OVERLONG_4));
+
+    const __m128i byte1LowTable = _mm_setr_epi8(
+        static_cast<char>(k_CARRY | k_OVERLONG_3 | k_OVERLONG_2
+                                                             | k_OVERLONG_4),
+        static_cast<char>(k_CARRY | k_OVERLONG_2),
+        static_cast<char>(k_CARRY),
+        static_cast<char>(k_CARRY),
+        static_cast<char>(k_CARRY | k_TOO_LARGE),
+        static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+        static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+        static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+        static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+        static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+        static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+        static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+        static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+        static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000
+                                                              | k_SURROGATE),
+        static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+        static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000));
+
+    const __m128i byte2HighTable = _mm_setr_epi8(
+        k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+        k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+        static_cast<char>(k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS
+                        | k_OVERLONG_3 | k_TOO_LARGE_1000 | k_OVERLONG_4),
+        static_cast<char>(k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS
+                                               | k_OVERLONG_3 | k_TOO_LARGE),
+        static_cast<char>(k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS
+                                                | k_SURROGATE | k_TOO_LARGE),
+        static_cast<char>(k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS
+                                                | k_SURROGATE | k_TOO_LARGE),
+        k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT);
+
+    const __m128i lowNibble = _mm_set1_epi8(0x0f);
+
+    const __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+    const __m128i prev2 = _mm_alignr_epi8(input, previous, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, previous, 13);
+
+    const __m128i byte1High = _mm_shuffle_epi8(
+                    byte1HighTable,
+                    _mm_and_si128(_mm_srli_epi16(prev1, 4), lowNibble));
+    const __m128i byte1Low  = _mm_shuffle_epi8(
+                    byte1LowTable,
+                    _mm_and_si128(prev1, lowNibble));
+    const __m128i byte2High = _mm_shuffle_epi8(
+                    byte2HighTable,
+                    _mm_and_si128(_mm_srli_epi16(input, 4), lowNibble));
+
+    const __m128i specialCases = _mm_and_si128(
+                                      _mm_and_si128(byte1High, byte1Low),
+                                      byte2High);
+
+    // The third and fourth bytes of 3- and 4-byte sequences are not covered
+    // by the tables, which only look at pairs: they must be continuations
+    // exactly when the byte 2 (resp. 3) positions before is a 3- or 4-byte
+    // (resp. 4-byte) lead.  In that case the tables report 'k_TWO_CONTS'
+    // (bit 7), so the two results cancel out when XOR'ed.
+
+    const __m128i isThirdByte  = _mm_subs_epu8(
+                                      prev2,
+                                      _mm_set1_epi8(0xe0 - 0x80));
+    const __m128i isFourthByte = _mm_subs_epu8(
+                                      prev3,
+                                      _mm_set1_epi8(0xf0 - 0x80));
+    const __m128i mustBe23Continuation = _mm_and_si128(
+                         _mm_or_si128(isThirdByte, isFourthByte),
+                         _mm_set1_epi8(static_cast<char>(0x80)));
+
+    return _mm_xor_si128(mustBe23Continuation, specialCases);
+}
+
+static
+bsls::Types::IntPtr validateAndCountCodePointsSsse3(
+                                       const char             **invalidString,
+                                       const char              *string,
+                                       bsls::Types::size_type   length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' (in bytes) if 'string' contains valid
+    // UTF-8, with no effect on the specified 'invalidString'.  Otherwise,
+    // return a negative value and load into 'invalidString' the address of
+    // the first byte in 'string' that does not constitute the start of a
+    // valid UTF-8 encoding.  The behavior is identical to that of the scalar
+    // 'validateAndCountCodePoints' taking a length, but the behavior is
+    // undefined unless the CPU supports SSSE3.
+{
+    BSLS_ASSERT_SAFE(invalidString);
+    BSLS_ASSERT_SAFE(string);
+    BSLS_ASSERT_SAFE(0 <= bsls::Types::IntPtr(length));
+
+    const __m128i zero        = _mm_setzero_si128();
+    const __m128i maxValue    = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                              -1, -1, -1, -1, -1,
+                                              static_cast<char>(0xf0 - 1),
+                                              static_cast<char>(0xe0 - 1),
+                                              static_cast<char>(0xc0 - 1));
+        // Any byte in the last three positions of a block that is greater
+        // than the corresponding element of 'maxValue' starts a sequence that
+        // extends past the end of the block.
+
+    const __m128i lastCont    = _mm_set1_epi8(static_cast<char>(0xbf));
+
+    const char       *pc  = string;
+    const char *const end = string + length;
+
+    bsls::Types::IntPtr count      = 0;
+    __m128i             previous   = zero;
+    __m128i             incomplete = zero;
+
+    while (end - pc >= 16) {
+        const __m128i input = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(pc));
+
+        __m128i error;
+        int     numStarts;
+
+        if (0 == _mm_movemask_epi8(input)) {
+            error     = incomplete;
+            numStarts = 16;
+        }
+        else {
+            error     = findErrors(input, previous);
+
+            // Signed comparison: ASCII and lead bytes are greater than the
+            // last continuation byte, 0xbf (-65).
+
+            const int starts = _mm_movemask_epi8(_mm_cmpgt_epi8(input,
+                                                                lastCont));
+            numStarts = bdlb::BitUtil::numBitsSet(
+                                         static_cast<bsl::uint32_t>(starts));
+        }
+
+        if (UNLIKELY(0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(error,
+                                                                zero)))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            break;
+        }
+
+        count      += numStarts;
+        incomplete  = _mm_subs_epu8(input, maxValue);
+        previous    = input;
+        pc         += 16;
+    }
+
+    const char *restart = lastCodePointStart(string, pc);
+    if (restart != pc) {
+        --count;    // The code point starting at 'restart' was counted.
+    }
+
+    const bsls::Types::IntPtr tail = validateAndCountCodePoints(invalidString,
+                                                                restart,
+                                                                end - restart);
+
+    return tail < 0 ? tail : count + tail;
+}
+
+#endif  // U_USE_SSSE3
+
+typedef bsls::Types::IntPtr (*ValidateFunction)(
+                                       const char             **invalidString,
+                                       const char              *string,
+                                       bsls::Types::size_type   length);
+    // 'ValidateFunction' is an alias for the signature of the functions that
+    // validate, and count the code points in, length-delimited UTF-8.
+
+static
+ValidateFunction validateFunction()
+    // Return the address of the fastest function validating length-delimited
+    // UTF-8 that is supported by the CPU on which this process is running.
+    // Note that the CPU is queried only on the first call.
+{
+    static ValidateFunction s_validateFunction = 0;
+
+    BSLMT_ONCE_DO {
+#if defined(U_USE_SSSE3)
+        unsigned int eax, ebx, ecx, edx;
+        __cpuid(1, eax, ebx, ecx, edx);
+
+        if (ecx & bit_SSSE3) {
+            s_validateFunction = &validateAndCountCodePointsSsse3;
+        }
+        else {
+            s_validateFunction = &validateAndCountCodePoints;
+        }
+#else
+        s_validateFunction = &validateAndCountCodePoints;
+#endif
+    }
+
+    return s_validateFunction;
+}
+
+static inline
+bsls::Types::IntPtr validateAndCount(const char             **invalidString,
+                                     const char              *string,
+                                     bsls::Types::size_type   length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' (in bytes) if 'string' contains valid
+    // UTF-8, with no effect on the specified 'invalidString'.  Otherwise,
+    // return a negative value and load into 'invalidString' the address of
+    // the first byte in 'string' that does not constitute the start of a
+    // valid UTF-8 encoding.  Use the vectorized validator if it is supported
+    // and 'length' is large enough for it to pay off.
+{
+    if (length < k_MIN_VECTOR_LENGTH) {
+        return validateAndCountCodePoints(invalidString, string, length);
+                                                                      // RETURN
+    }
+
+    return validateFunction()(invalidString, string, length);
+}
+
+static
+bsls::Types::IntPtr validateAndCount(const char **invalidString,
+                                     const char  *string)
+    // Return the number of Unicode code points in the specified
+    // null-terminated 'string' if it contains valid UTF-8, with no effect on
+    // the specified 'invalidString'.  Otherwise, return a negative value and
+    // load into 'invalidString' the address of the first sequence in 'string'
+    // that does not constitute the start of a valid UTF-8 encoding.  Note
+    // that, when the vectorized validator is available, the length of
+    // 'string' is determined first (a null byte terminates a multi-byte
+    // sequence in the same way as the end of a length-delimited string would)
+    // since reading a full block past the terminating null byte is not safe.
+{
+    const ValidateFunction function = validateFunction();
+    if (static_cast<ValidateFunction>(&validateAndCountCodePoints) ==
+                                                                    function) {
+        return validateAndCountCodePoints(invalidString, string);     // RETURN
+    }
+
+    const bsl::size_t length = bsl::strlen(string);
+    if (length < k_MIN_VECTOR_LENGTH) {
+        return validateAndCountCodePoints(invalidString, string, length);
+                                                                      // RETURN
+    }
+
+    return function(invalidString, string, length);
+}
+
 
 namespace BloombergLP {
 
@@ -1038,7 +1387,7 @@ bool Utf8Util::isValid(const char **invalidString, const char *string)
     BSLS_ASSERT(invalidString);
     BSLS_ASSERT(string);
 
-    return validateAndCountCodePoints(invalidString, string) >= 0;
+    return validateAndCount(invalidString, string) >= 0;
 }
 
 bool Utf8Util::isValid(const char **invalidString,
@@ -1049,7 +1398,7 @@ bool Utf8Util::isValid(const char **invalidString,
     BSLS_ASSERT(string);
     BSLS_ASSERT(0 <= bsls::Types::IntPtr(length));
 
-    return validateAndCountCodePoints(invalidString, string, length) >= 0;
+    return validateAndCount(invalidString, string, length) >= 0;
 }
 
 Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
@@ -1058,7 +1407,7 @@ Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
     BSLS_ASSERT(invalidString);
     BSLS_ASSERT(string);
 
-    return validateAndCountCodePoints(invalidString, string);
+    return validateAndCount(invalidString, string);
 }
 
 Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
@@ -1069,7 +1418,7 @@ Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
     BSLS_ASSERT(string);
     BSLS_ASSERT(0 <= bsls::Types::IntPtr(length));
 
-    return validateAndCountCodePoints(invalidString, string, length);
+    return validateAndCount(invalidString, string, length);
 }
 
 Utf8Util::IntPtr Utf8Util::numCodePointsRaw(const char *string)
@@ -1124,6 +1473,33 @@ Utf8Util::IntPtr Utf8Util::numCodePointsRaw(const char *string,
 
     const char *const end = string + length;
 
+#if defined(U_USE_SSE2)
+    // Every byte that is not a continuation byte starts a code point, so
+    // count those 16 at a time.  The signed comparison selects ASCII and lead
+    // bytes, which are greater than the last continuation byte, 0xbf (-65).
+
+    const __m128i lastCont = _mm_set1_epi8(static_cast<char>(0xbf));
+
+    while (end - string >= 16) {
+        const __m128i input = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(string));
+
+        const int starts = _mm_movemask_epi8(_mm_cmpgt_epi8(input,
+                                                            lastCont));
+
+        count  += bdlb::BitUtil::numBitsSet(
+                                         static_cast<bsl::uint32_t>(starts));
+        string += 16;
+    }
+
+    // Skip the rest of the code point straddling the boundary, if any, which
+    // has already been counted.
+
+    while (string < end && !isNotContinuation(*string)) {
+        ++string;
+    }
+#endif
+
     while (string < end) {
         switch ((*string >> 4) & 0xf) {
           case 0:
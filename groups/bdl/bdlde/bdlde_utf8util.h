@@ -68,6 +68,17 @@ BSLS_IDENT("$Id: $")
 //  http://en.wikipedia.org/wiki/Utf-8
 //..
 //
+///Performance
+///-----------
+// On x86 platforms, 'isValid' and 'numCodePointsIfValid', as well as
+// 'numCodePointsRaw' when passed a length, examine long strings 16 bytes at a
+// time using SIMD instructions (multi-byte sequences are validated with lookup
+// tables, and blocks of ASCII are accepted after a single test).  Whether the
+// CPU supports the required instructions is determined at run time, the first
+// time they might be used.  The results, including the position reported
+// through 'invalidString', are the same as those of the byte-at-a-time
+// implementation used otherwise.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -14,6 +14,7 @@
 #include <bslim_testutil.h>
 
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -57,6 +58,10 @@ using bsl::size_t;
 //: o Test case 10 Test 'numBytesIfValid'.
 //: o Test case 11 Test 'getByteSize'.
 //: o Test case 12 Test 'appendUtf8Character'.
+//: o Test case 13 Test that 'isValid', 'numCodePointsIfValid', and
+//:   'numCodePointsRaw' agree with a simple reference validator on input of
+//:   all lengths, at all alignments, with errors at all positions relative to
+//:   the 16-byte blocks examined by the vectorized implementation.
 //-----------------------------------------------------------------------------
 // CLASS METHODS
 // [12] int appendUtf8Character(bsl::string *, unsigned int);
@@ -97,11 +102,13 @@ using bsl::size_t;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
-// [13] USAGE EXAMPLE 1
-// [14] USAGE EXAMPLE 2
+// [13] VECTORIZED VALIDATION
+// [14] USAGE EXAMPLE 1
+// [15] USAGE EXAMPLE 2
 // [ 9] 'advanceIfValid' on correct input followed by incorrect input
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] PERFORMANCE: VALIDATION THROUGHPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -2783,6 +2790,101 @@ static const struct {
 };
 enum { NUM_DATA = sizeof DATA / sizeof *DATA };
 
+// ============================================================================
+//                       HELPER DEFINITIONS FOR TEST 13
+// ----------------------------------------------------------------------------
+
+namespace BDEDE_UTF8UTIL_CASE_13 {
+
+bsls::Types::IntPtr refValidate(const char **invalidString,
+                                const char  *string,
+                                size_t       length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' if it is valid UTF-8, and a negative
+    // value otherwise, loading into the specified 'invalidString' the address
+    // of the first sequence that is not valid.  This reference implementation
+    // follows the table of well-formed byte sequences in the Unicode Standard
+    // (Table 3-7) literally, one code point at a time.
+{
+    const unsigned char *pc  = reinterpret_cast<const unsigned char *>(string);
+    const unsigned char *end = pc + length;
+
+    bsls::Types::IntPtr count = 0;
+    for (; pc < end; ++count) {
+        const unsigned char c = *pc;
+
+        int           len;
+        unsigned char lo = 0x80, hi = 0xbf;  // range of the second byte
+
+        if      (c <= 0x7f)                { len = 1; }
+        else if (c >= 0xc2 && c <= 0xdf)   { len = 2; }
+        else if (0xe0 == c)                { len = 3; lo = 0xa0; }
+        else if (0xed == c)                { len = 3; hi = 0x9f; }
+        else if (c >= 0xe1 && c <= 0xef)   { len = 3; }
+        else if (0xf0 == c)                { len = 4; lo = 0x90; }
+        else if (0xf4 == c)                { len = 4; hi = 0x8f; }
+        else if (c >= 0xf1 && c <= 0xf3)   { len = 4; }
+        else                               { len = 0; }
+
+        bool ok = 0 != len && end - pc >= len;
+        for (int i = 1; ok && i < len; ++i) {
+            ok = 1 == i ? pc[1] >= lo && pc[1] <= hi
+                        : pc[i] >= 0x80 && pc[i] <= 0xbf;
+        }
+        if (!ok) {
+            *invalidString = reinterpret_cast<const char *>(pc);
+            return -1;                                                // RETURN
+        }
+
+        pc += len;
+    }
+
+    return count;
+}
+
+void checkAgainstReference(int line, const char *string, size_t length)
+    // Verify that the length-based, and, if the specified 'string' of the
+    // specified 'length' contains no null byte, the null-terminated, forms of
+    // 'isValid', 'numCodePointsIfValid', and (on valid input)
+    // 'numCodePointsRaw' agree with 'refValidate', reporting any failure
+    // using the specified 'line'.  The behavior is undefined unless
+    // 'string[length]' is a null byte.
+{
+    const char                *expInvalid = 0;
+    const bsls::Types::IntPtr  expCount   = refValidate(&expInvalid,
+                                                        string,
+                                                        length);
+
+    const char *invalid = 0;
+    ASSERTV(line, length, expCount ==
+                        Obj::numCodePointsIfValid(&invalid, string, length));
+    ASSERTV(line, length, expInvalid == invalid);
+
+    invalid = 0;
+    ASSERTV(line, length, (expCount >= 0) ==
+                                     Obj::isValid(&invalid, string, length));
+    ASSERTV(line, length, expInvalid == invalid);
+
+    if (expCount >= 0) {
+        ASSERTV(line, length, expCount ==
+                                       Obj::numCodePointsRaw(string, length));
+    }
+
+    if (bsl::strlen(string) == length) {
+        invalid = 0;
+        ASSERTV(line, length, expCount ==
+                                  Obj::numCodePointsIfValid(&invalid, string));
+        ASSERTV(line, length, expInvalid == invalid);
+
+        invalid = 0;
+        ASSERTV(line, length, (expCount >= 0) ==
+                                             Obj::isValid(&invalid, string));
+        ASSERTV(line, length, expInvalid == invalid);
+    }
+}
+
+}  // close namespace BDEDE_UTF8UTIL_CASE_13
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2802,7 +2904,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: 'advance'
         //
@@ -2913,7 +3015,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 //..
       } break;
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: 'isValid' AND 'numCodePoints*'
         //
@@ -3012,6 +3114,119 @@ int main(int argc, char *argv[])
     ASSERT(false == bdlde::Utf8Util::isValid(stringWithOverlong.c_str()));
 //..
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // VECTORIZED VALIDATION
+        //
+        // Concerns:
+        //: 1 Long strings are validated 16 bytes at a time when the CPU
+        //:   supports it; the result, the reported 'invalidString', and the
+        //:   code point count must be exactly those of the byte-at-a-time
+        //:   validation, whatever the alignment of the input and the position
+        //:   of an error relative to the 16-byte blocks.
+        //:
+        //: 2 Sequences straddling a block boundary, and sequences left
+        //:   incomplete at the end of a block, are handled correctly.
+        //:
+        //: 3 The null-terminated and length-based forms agree.
+        //:
+        //: 4 'numCodePointsRaw' counts valid input of all lengths correctly.
+        //
+        // Plan:
+        //: 1 Implement a simple reference validator, 'refValidate', that
+        //:   follows the table of well-formed byte sequences of the Unicode
+        //:   Standard literally.
+        //:
+        //: 2 Place each possible lead byte, followed by 3 bytes chosen from a
+        //:   set of boundary values, at every position straddling a block
+        //:   boundary within ASCII and within multi-byte context, and compare
+        //:   the results of the functions under test with 'refValidate'.
+        //:   (C-1..3)
+        //:
+        //: 3 Generate random valid strings of all lengths up to 100 bytes at
+        //:   all 16 alignments, verify them, then corrupt a random byte and
+        //:   truncate them at a random position, verifying again.  (C-1..4)
+        //
+        // Testing:
+        //   VECTORIZED VALIDATION
+        // --------------------------------------------------------------------
+
+        using namespace BDEDE_UTF8UTIL_CASE_13;
+
+        if (verbose) cout << "VECTORIZED VALIDATION\n"
+                             "=====================\n";
+
+        static const unsigned char FOLLOW[] = {
+            0x00, 0x41, 0x7f, 0x80, 0x8f, 0x90, 0x9f, 0xa0, 0xbf,
+            0xc0, 0xc2, 0xdf, 0xe0, 0xed, 0xef, 0xf0, 0xf4, 0xf5, 0xff };
+        enum { k_NUM_FOLLOW = sizeof FOLLOW / sizeof *FOLLOW };
+
+        if (verbose) cout << "Lead bytes around block boundaries.\n";
+        {
+            enum { k_LEN = 48 };
+
+            static const char *const CONTEXT[] = {
+                "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUV",
+                "\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9"
+                "\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9"
+                "\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9"
+                "\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9" };
+
+            for (int ci = 0; ci < 2; ++ci) {
+                ASSERT(k_LEN == bsl::strlen(CONTEXT[ci]));
+
+                for (int pos = 12; pos <= 17; ++pos) {
+                    for (int c0 = 0x80; c0 <= 0xff; ++c0) {
+                    for (int i1 = 0; i1 < k_NUM_FOLLOW; ++i1) {
+                    for (int i2 = 0; i2 < k_NUM_FOLLOW; ++i2) {
+                    for (int i3 = 0; i3 < k_NUM_FOLLOW; ++i3) {
+                        char buffer[k_LEN + 1];
+                        bsl::memcpy(buffer, CONTEXT[ci], k_LEN + 1);
+
+                        buffer[pos]     = static_cast<char>(c0);
+                        buffer[pos + 1] = static_cast<char>(FOLLOW[i1]);
+                        buffer[pos + 2] = static_cast<char>(FOLLOW[i2]);
+                        buffer[pos + 3] = static_cast<char>(FOLLOW[i3]);
+
+                        checkAgainstReference(L_, buffer, k_LEN);
+                    }
+                    }
+                    }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "Random strings at all lengths and alignments.\n";
+        {
+            for (int len = 0; len <= 100; ++len) {
+                for (int align = 0; align < 16; ++align) {
+                    for (int ti = 0; ti < 8; ++ti) {
+                        bsl::string str;
+                        while (str.length() < static_cast<size_t>(len)) {
+                            appendRandCorrectCodePoint(&str, 3 == ti);
+                        }
+                        str.resize(len);  // may truncate a sequence
+
+                        char buffer[16 + 104 + 1];
+                        char *begin = buffer + align;
+                        bsl::memcpy(begin, str.data(), len);
+                        begin[len] = 0;
+
+                        checkAgainstReference(L_, begin, len);
+
+                        if (0 < len) {
+                            const unsigned r = randUnsigned();
+                            begin[r % len] = static_cast<char>(r >> 24);
+                            begin[len] = 0;
+
+                            checkAgainstReference(L_, begin, len);
+                        }
+                    }
+                }
+            }
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING 'appendUtf8Character'
@@ -5059,6 +5274,98 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: VALIDATION THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Measure the throughput of validation and code point counting on
+        //:   input dominated by 1-, 2-, 3-, and 4-byte sequences.
+        //
+        // Plan:
+        //: 1 Build a 1 MB string for each mix of sequence lengths and time
+        //:   repeated calls to 'isValid', 'numCodePointsIfValid' (both
+        //:   length-based and null-terminated), and 'numCodePointsRaw',
+        //:   reporting the throughput in GB/s.  The number of iterations can
+        //:   be given as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE: VALIDATION THROUGHPUT
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE: VALIDATION THROUGHPUT\n"
+                "==================================\n";
+
+        const int numIterations = argc > 2 ? bsl::atoi(argv[2]) : 200;
+
+        static const struct {
+            const char *d_name;
+            int         d_weights[4];  // relative weight of 1..4-byte
+        } MIXES[] = {
+            { "ASCII",           { 1, 0, 0, 0 } },
+            { "mostly ASCII",    { 20, 1, 1, 0 } },
+            { "2-byte (Latin)",  { 1, 4, 0, 0 } },
+            { "3-byte (CJK)",    { 1, 0, 8, 0 } },
+            { "4-byte (emoji)",  { 1, 0, 0, 4 } },
+        };
+        enum { k_NUM_MIXES = sizeof MIXES / sizeof *MIXES };
+
+        for (int mi = 0; mi < k_NUM_MIXES; ++mi) {
+            const int *weights = MIXES[mi].d_weights;
+            const int  total   = weights[0] + weights[1] + weights[2]
+                                                                + weights[3];
+
+            bsl::string str;
+            while (str.length() < 1024 * 1024) {
+                int r = static_cast<int>(randUnsigned() % total);
+                if      ((r -= weights[0]) < 0) appendRand1Byte(&str);
+                else if ((r -= weights[1]) < 0) appendRand2Byte(&str);
+                else if ((r -= weights[2]) < 0) appendRand3Byte(&str);
+                else                            appendRand4Byte(&str);
+            }
+
+            const double gigabytes = static_cast<double>(str.length()) *
+                                                       numIterations / 1e9;
+            const char  *invalid   = 0;
+            bsls::Types::IntPtr sum = 0;
+
+            bsls::Stopwatch sw;
+
+            sw.start(); for (int i = 0; i < numIterations; ++i) {
+                sum += Obj::isValid(&invalid, str.data(), str.length());
+            } sw.stop();
+            const double isValidTime = sw.elapsedTime();
+
+            sw.reset(); sw.start(); for (int i = 0; i < numIterations; ++i) {
+                sum += Obj::numCodePointsIfValid(&invalid,
+                                                 str.data(),
+                                                 str.length());
+            } sw.stop();
+            const double ifValidTime = sw.elapsedTime();
+
+            sw.reset(); sw.start(); for (int i = 0; i < numIterations; ++i) {
+                sum += Obj::numCodePointsIfValid(&invalid, str.c_str());
+            } sw.stop();
+            const double ifValidZTime = sw.elapsedTime();
+
+            sw.reset(); sw.start(); for (int i = 0; i < numIterations; ++i) {
+                sum += Obj::numCodePointsRaw(str.data(), str.length());
+            } sw.stop();
+            const double rawTime = sw.elapsedTime();
+
+            ASSERT(0 < sum);
+
+            cout << MIXES[mi].d_name << ":\n"
+                 << "\tisValid:                   "
+                 << gigabytes / isValidTime  << " GB/s\n"
+                 << "\tnumCodePointsIfValid:      "
+                 << gigabytes / ifValidTime  << " GB/s\n"
+                 << "\tnumCodePointsIfValid(nul): "
+                 << gigabytes / ifValidZTime << " GB/s\n"
+                 << "\tnumCodePointsRaw:          "
+                 << gigabytes / rawTime      << " GB/s\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,519 @@
+// bdlma_hugepageallocator.cpp                                        -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_hugepageallocator_cpp,"$Id$ $CSID$")
+
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_climits.h>             // 'CHAR_BIT'
+#include <bsl_cstddef.h>             // 'bsl::size_t'
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>        // 'VirtualAlloc', 'VirtualFree'
+
+#else
+
+#include <sys/mman.h>       // 'madvise', 'mmap', 'munmap'
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <sys/syscall.h>    // 'SYS_mbind'
+#include <unistd.h>         // 'syscall'
+#endif
+
+#endif
+
+namespace BloombergLP {
+namespace {
+
+// CONSTANTS
+const bsls::Types::size_type k_2M = 2 * 1024 * 1024;  // size of a 2M page
+
+const bsls::Types::size_type k_1G = 1024 * 1024 * 1024;
+                                                      // size of a 1G page
+
+const int k_LOG2_2M = 21;  // log2 of the size of a 2M page
+const int k_LOG2_1G = 30;  // log2 of the size of a 1G page
+
+const bsls::Types::size_type k_MAX_ALIGNMENT =
+                                       bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+const bsls::Types::size_type k_REGION_HEADER_SIZE =
+           (4 * sizeof(void *) + k_MAX_ALIGNMENT - 1) / k_MAX_ALIGNMENT
+                                                            * k_MAX_ALIGNMENT;
+    // size reserved at the start of each region for its header, which holds
+    // two pointers and two sizes
+
+const bsls::Types::size_type k_BLOCK_HEADER_SIZE = k_MAX_ALIGNMENT;
+    // size of the header preceding each block
+
+union BlockHeader {
+    // This 'union' describes the header preceding each block, which refers to
+    // the region the block was carved from.
+
+    void                                *d_region_p;  // region of the block
+    bsls::AlignmentUtil::MaxAlignedType  d_dummy;     // for alignment
+};
+
+BSLMF_ASSERT(sizeof(BlockHeader) == k_BLOCK_HEADER_SIZE);
+
+// HELPER FUNCTIONS
+void *systemMap(bsl::size_t size)
+    // Obtain from the system a page-aligned block of memory of the specified
+    // 'size' (in bytes) backed by default pages, and return its address, or 0
+    // if no memory is available.  The behavior is undefined unless
+    // '0 < size'.
+{
+    BSLS_ASSERT(0 < size);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return VirtualAlloc(0, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+                                                                      // RETURN
+
+#else
+
+    void *address = mmap(0,
+                         size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_ANON | MAP_PRIVATE,
+                         -1,
+                         0);
+
+    return MAP_FAILED == address ? 0 : address;
+
+#endif
+}
+
+void systemUnmap(void *address, bsl::size_t size)
+    // Return to the system the block of memory at the specified 'address'
+    // having the specified 'size' (in bytes).  The behavior is undefined
+    // unless 'address' and 'size' describe memory (or the whole of a mapping
+    // of memory) obtained by 'systemMap', 'mapAligned', or 'mapHugeTlb'.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(address, 0, MEM_RELEASE);
+    (void) size;
+
+#else
+
+    // On some of our platforms, 'munmap' takes a 'char*' argument, while on
+    // others it takes a 'void*'.  Casting to 'char*', which will work in both
+    // cases.
+
+    munmap(static_cast<char *>(address), size);
+
+#endif
+}
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+void *mapAligned(bsl::size_t size, bsl::size_t alignment)
+    // Obtain from the system a block of memory of the specified 'size' (in
+    // bytes) aligned on the specified 'alignment', backed by default pages,
+    // and return its address, or 0 if no memory is available.  The behavior
+    // is undefined unless 'size' and 'alignment' are multiples of the size of
+    // a default page, and 'alignment' is a power of 2.
+{
+    // Map enough memory to contain an aligned block, then return the memory
+    // before and after that block to the system.  Note that, 'mapping' being
+    // page-aligned, some memory always remains after the block.
+
+    char *mapping = static_cast<char *>(systemMap(size + alignment));
+    if (!mapping) {
+        return 0;                                                     // RETURN
+    }
+
+    char *address = reinterpret_cast<char *>(
+                         (reinterpret_cast<bsls::Types::UintPtr>(mapping)
+                          + alignment - 1) & ~(alignment - 1));
+
+    if (address != mapping) {
+        systemUnmap(mapping, address - mapping);
+    }
+    systemUnmap(address + size, mapping + alignment - address);
+    return address;
+}
+
+void *mapHugeTlb(bsl::size_t size, int log2PageSize)
+    // Obtain from the system a block of memory of the specified 'size' (in
+    // bytes) backed by reserved huge pages of the size of which the specified
+    // 'log2PageSize' is the base-2 logarithm, and return its address, or 0 if
+    // no such pages are available.  The behavior is undefined unless 'size' is
+    // a multiple of the size of the pages.
+{
+#ifdef MAP_HUGETLB
+
+    // 'MAP_HUGE_SHIFT' is missing from the headers of older systems, on which
+    // the size of the huge pages is encoded as it is on newer systems.
+
+#ifdef MAP_HUGE_SHIFT
+    const int hugeShift = MAP_HUGE_SHIFT;
+#else
+    const int hugeShift = 26;
+#endif
+
+    void *address = mmap(0,
+                         size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_ANON | MAP_PRIVATE | MAP_HUGETLB
+                                                | log2PageSize << hugeShift,
+                         -1,
+                         0);
+
+    return MAP_FAILED == address ? 0 : address;
+
+#else
+
+    (void) size;
+    (void) log2PageSize;
+    return 0;
+
+#endif
+}
+
+int adviseHugePages(void *address, bsl::size_t size)
+    // Advise the system to back the block of memory at the specified 'address'
+    // having the specified 'size' (in bytes) with transparent huge pages.
+    // Return 0 on success, and a non-zero value if the system does not
+    // support transparent huge pages.
+{
+#ifdef MADV_HUGEPAGE
+    return madvise(static_cast<char *>(address), size, MADV_HUGEPAGE);
+#else
+    (void) address;
+    (void) size;
+    return -1;
+#endif
+}
+
+int bindToNode(void *address, bsl::size_t size, int node)
+    // Bind the block of memory at the specified 'address' having the
+    // specified 'size' (in bytes) to the specified NUMA 'node', so that its
+    // pages are allocated from the memory of 'node' when first touched.
+    // Return 0 on success, and a non-zero value otherwise.  The behavior is
+    // undefined unless 'address' is page-aligned and '0 <= node'.
+{
+#ifdef SYS_mbind
+
+    // 'mbind' is invoked through 'syscall' so as not to depend on 'libnuma',
+    // which provides the wrapper but is not installed everywhere.
+
+    enum {
+        k_MPOL_BIND      = 2,     // from '<numaif.h>'
+        k_NUM_NODE_BITS  = 1024,  // number of nodes supported
+        k_BITS_PER_WORD  = sizeof(unsigned long) * CHAR_BIT
+    };
+
+    if (k_NUM_NODE_BITS <= node) {
+        return -1;                                                    // RETURN
+    }
+
+    unsigned long nodeMask[k_NUM_NODE_BITS / k_BITS_PER_WORD] = { 0 };
+    nodeMask[node / k_BITS_PER_WORD] = 1UL << node % k_BITS_PER_WORD;
+
+    return 0 == syscall(SYS_mbind,
+                        address,
+                        size,
+                        static_cast<int>(k_MPOL_BIND),
+                        nodeMask,
+                        static_cast<unsigned long>(k_NUM_NODE_BITS + 1),
+                        0U)
+           ? 0
+           : -1;
+
+#else
+
+    (void) address;
+    (void) size;
+    (void) node;
+    return -1;
+
+#endif
+}
+
+#endif  // BSLS_PLATFORM_OS_LINUX
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// PRIVATE TYPES
+struct HugePageAllocator::Region {
+    // This 'struct' describes the header at the start of each region.
+
+    Region                 *d_prev_p;     // previous region in the list
+    Region                 *d_next_p;     // next region in the list
+    bsls::Types::size_type  d_size;       // size of the region
+    bsls::Types::size_type  d_numBlocks;  // blocks of the region in use
+};
+
+// PRIVATE MANIPULATORS
+HugePageAllocator::Region *HugePageAllocator::mapRegion(
+                                                   bsls::Types::size_type size)
+{
+    BSLS_ASSERT(0 == size % d_regionSize);
+
+    void       *address  = 0;
+    PagePolicy  policy   = d_pagePolicy;
+    bool        isBound  = true;
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+    // Try the pages of the policy, then those of each policy having smaller
+    // pages in turn.
+
+    if (e_HUGE_PAGES_1G == policy) {
+        address = mapHugeTlb(size, k_LOG2_1G);
+        if (!address) {
+            policy = e_HUGE_PAGES_2M;
+        }
+    }
+    if (e_HUGE_PAGES_2M == policy) {
+        address = mapHugeTlb(size, k_LOG2_2M);
+        if (!address) {
+            policy = e_TRANSPARENT_HUGE_PAGES;
+        }
+    }
+    if (e_TRANSPARENT_HUGE_PAGES == policy) {
+        address = mapAligned(size, k_2M);
+        if (address && 0 != adviseHugePages(address, size)) {
+            policy = e_STANDARD_PAGES;
+        }
+    }
+    else if (e_STANDARD_PAGES == policy) {
+        address = systemMap(size);
+    }
+
+    if (address
+     && k_NO_NUMA_NODE != d_numaNode
+     && 0 != bindToNode(address, size, d_numaNode)) {
+        isBound = false;
+    }
+
+#else
+
+    address = systemMap(size);
+    policy  = e_STANDARD_PAGES;
+
+#endif
+
+    if (!address) {
+        return 0;                                                     // RETURN
+    }
+
+    if (policy != d_pagePolicy || !isBound) {
+        d_numFallbacks.addRelaxed(1);
+    }
+    d_numBytesMapped.addRelaxed(static_cast<bsls::Types::Int64>(size));
+
+    Region *region = static_cast<Region *>(address);
+
+    region->d_prev_p    = 0;
+    region->d_next_p    = d_regions_p;
+    region->d_size      = size;
+    region->d_numBlocks = 0;
+
+    if (d_regions_p) {
+        d_regions_p->d_prev_p = region;
+    }
+    d_regions_p = region;
+
+    return region;
+}
+
+void HugePageAllocator::unmapRegion(Region *region)
+{
+    BSLS_ASSERT(region);
+
+    if (region->d_prev_p) {
+        region->d_prev_p->d_next_p = region->d_next_p;
+    }
+    else {
+        d_regions_p = region->d_next_p;
+    }
+    if (region->d_next_p) {
+        region->d_next_p->d_prev_p = region->d_prev_p;
+    }
+
+    const bsls::Types::size_type size = region->d_size;
+
+    d_numBytesMapped.addRelaxed(-static_cast<bsls::Types::Int64>(size));
+    systemUnmap(region, size);
+}
+
+// CREATORS
+HugePageAllocator::HugePageAllocator(PagePolicy pagePolicy, int numaNode)
+: d_pagePolicy(pagePolicy)
+, d_numaNode(numaNode)
+, d_regionSize(e_HUGE_PAGES_1G == pagePolicy ? k_1G : k_2M)
+, d_regions_p(0)
+, d_current_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+, d_numBytesMapped(0)
+, d_numFallbacks(0)
+{
+    BSLS_ASSERT(e_STANDARD_PAGES <= pagePolicy);
+    BSLS_ASSERT(                    pagePolicy <= e_HUGE_PAGES_1G);
+    BSLS_ASSERT(k_NO_NUMA_NODE <= numaNode);
+
+    BSLMF_ASSERT(sizeof(Region) <= k_REGION_HEADER_SIZE);
+}
+
+HugePageAllocator::~HugePageAllocator()
+{
+    release();
+}
+
+// MANIPULATORS
+void *HugePageAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Region *region;
+    char   *block;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size > d_regionSize / 4)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Large blocks get a region of their own.  A 'size' so large that the
+        // size of its region cannot be represented is treated as unavailable.
+
+        const bsls::Types::size_type regionSize =
+               (k_REGION_HEADER_SIZE + k_BLOCK_HEADER_SIZE + size
+                                                           + d_regionSize - 1)
+                                                 / d_regionSize * d_regionSize;
+
+        region = size < regionSize ? mapRegion(regionSize) : 0;
+        if (!region) {
+#ifdef BDE_BUILD_TARGET_EXC
+            BSLS_THROW(bsl::bad_alloc());
+#else
+            return 0;                                                 // RETURN
+#endif
+        }
+        block = reinterpret_cast<char *>(region) + k_REGION_HEADER_SIZE;
+    }
+    else {
+        const bsls::Types::size_type blockSize =
+                         k_BLOCK_HEADER_SIZE
+                       + bsls::AlignmentUtil::roundUpToMaximalAlignment(size);
+
+        if (static_cast<bsls::Types::size_type>(d_end_p - d_cursor_p)
+                                                                < blockSize) {
+            // Start a new current region, returning the previous one to the
+            // system if none of its blocks is in use.
+
+            Region *newRegion = mapRegion(d_regionSize);
+            if (!newRegion) {
+#ifdef BDE_BUILD_TARGET_EXC
+                BSLS_THROW(bsl::bad_alloc());
+#else
+                return 0;                                             // RETURN
+#endif
+            }
+
+            Region *oldRegion = d_current_p;
+
+            d_current_p = newRegion;
+            d_cursor_p  = reinterpret_cast<char *>(newRegion)
+                        + k_REGION_HEADER_SIZE;
+            d_end_p     = reinterpret_cast<char *>(newRegion) + d_regionSize;
+
+            if (oldRegion && 0 == oldRegion->d_numBlocks) {
+                unmapRegion(oldRegion);
+            }
+        }
+        region      = d_current_p;
+        block       = d_cursor_p;
+        d_cursor_p += blockSize;
+    }
+
+    ++region->d_numBlocks;
+    reinterpret_cast<BlockHeader *>(block)->d_region_p = region;
+
+    return block + k_BLOCK_HEADER_SIZE;
+}
+
+void HugePageAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Region *region = static_cast<Region *>(
+                                     (static_cast<BlockHeader *>(address) - 1)
+                                                                ->d_region_p);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    BSLS_ASSERT(0 < region->d_numBlocks);
+
+    if (0 == --region->d_numBlocks) {
+        if (region == d_current_p) {
+            // Carve the next blocks from the start of the current region
+            // again.
+
+            d_cursor_p = reinterpret_cast<char *>(region)
+                       + k_REGION_HEADER_SIZE;
+        }
+        else {
+            unmapRegion(region);
+        }
+    }
+}
+
+void HugePageAllocator::release()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (d_regions_p) {
+        unmapRegion(d_regions_p);
+    }
+    d_current_p = 0;
+    d_cursor_p  = 0;
+    d_end_p     = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
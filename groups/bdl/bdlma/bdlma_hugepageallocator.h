@@ -0,0 +1,337 @@
+// bdlma_hugepageallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+#define INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a memory source mapping huge pages, optionally NUMA-bound.
+//
+//@CLASSES:
+//  bdlma::HugePageAllocator: managed allocator carving blocks from huge pages
+//
+//@SEE_ALSO: bdlma_multipool, bdlma_concurrentpool, bdlma_sequentialallocator
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bdlma::HugePageAllocator', that implements the 'bdlma::ManagedAllocator'
+// protocol by obtaining memory directly from the operating system in large,
+// aligned *regions* that can be backed by huge pages and bound to a NUMA node.
+// It is meant to be the underlying allocator of the pools and arenas of this
+// package ('bdlma::Multipool', 'bdlma::ConcurrentPool',
+// 'bdlma::BufferedSequentialAllocator', ...), which request large chunks
+// rarely and then serve small blocks from them: placing those chunks in huge
+// pages reduces the TLB misses of programs that access large data structures
+// at random.
+//..
+//   ,------------------------.
+//  ( bdlma::HugePageAllocator )
+//   `------------------------'
+//               |         ctor/dtor
+//               |         numaNode
+//               |         numBytesMapped
+//               |         numFallbacks
+//               |         pagePolicy
+//               |         regionSize
+//               V
+//   ,-----------------------.
+//  ( bdlma::ManagedAllocator )
+//   `-----------------------'
+//               |         release
+//               V
+//      ,----------------.
+//     ( bslma::Allocator )
+//      `----------------'
+//                         allocate
+//                         deallocate
+//..
+//
+///Page Policies
+///-------------
+// The 'PagePolicy' supplied at construction selects the pages backing each
+// region:
+//..
+//  Policy                      Regions             Pages
+//  --------------------------  ------------------  ---------------------------
+//  e_STANDARD_PAGES            2M, not aligned     default pages of the system
+//  e_TRANSPARENT_HUGE_PAGES    2M, 2M-aligned      default pages, advised to
+//                                                  be replaced by transparent
+//                                                  huge pages (Linux
+//                                                  'MADV_HUGEPAGE')
+//  e_HUGE_PAGES_2M             2M, 2M-aligned      reserved 2M huge pages
+//                                                  (Linux 'MAP_HUGETLB')
+//  e_HUGE_PAGES_1G             1G, 1G-aligned      reserved 1G huge pages
+//..
+// Reserved huge pages exist only if the administrator of the system has set
+// them aside.  Should a region not be obtainable with the pages of the policy,
+// the allocator falls back to the next policy in the table above that has
+// smaller pages, down to transparent huge pages, and counts the fallback (see
+// 'numFallbacks').  On platforms other than Linux, every policy yields
+// default pages.
+//
+///NUMA Binding
+///------------
+// If a NUMA node is supplied at construction, each region is bound to that
+// node (Linux 'mbind' with 'MPOL_BIND') before it is first touched, so that
+// its pages are allocated from the memory of that node.  Should the binding
+// fail (for example, because the node does not exist or the system does not
+// support NUMA), the region is used unbound and the failure is counted as a
+// fallback.
+//
+///Regions and Blocks
+///------------------
+// Blocks are carved in sequence from the current region, each preceded by a
+// header of 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT' bytes, and are maximally
+// aligned.  A request too large for a quarter of a region gets a region of its
+// own, whose size is a multiple of the region size.  A region is returned to
+// the system when the last of its blocks is deallocated (unless it is the
+// current region), when 'release' is called, or when the allocator is
+// destroyed.  Note that, since the memory of a deallocated block is not
+// reused until its whole region is free, this allocator suits clients that
+// allocate few, large blocks that live long -- such as the chunks of a pool
+// -- and not general-purpose allocation.
+//
+///Thread Safety
+///-------------
+// 'bdlma::HugePageAllocator' is *fully thread-safe*, meaning that any
+// operation can be called on the *same* object from any number of threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing a Large Hash Table with Huge Pages
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we keep a large cache of prices in a hash table that is read
+// at random, and that the time spent in TLB misses is significant.  We can
+// place the nodes and buckets of the table in huge pages by obtaining them
+// from a multipool whose chunks come from a 'bdlma::HugePageAllocator'.
+//
+// First, we create the allocator, asking for transparent huge pages (which
+// are available without special configuration of the system):
+//..
+//  bdlma::HugePageAllocator hugePageAllocator(
+//                         bdlma::HugePageAllocator::e_TRANSPARENT_HUGE_PAGES);
+//..
+// Then, we create a multipool allocator, supplying it the huge page allocator
+// as its underlying allocator, so that the multipool obtains its chunks from
+// huge pages:
+//..
+//  bdlma::MultipoolAllocator multipoolAllocator(&hugePageAllocator);
+//..
+// Next, we create the table, using the multipool allocator:
+//..
+//  bsl::unordered_map<int, double> prices(&multipoolAllocator);
+//  for (int i = 0; i < 100000; ++i) {
+//      prices[i] = i * 0.25;
+//  }
+//  assert(0 < hugePageAllocator.numBytesMapped());
+//..
+// Finally, the table and the multipool are destroyed, returning their chunks
+// to the huge page allocator, which returns its regions to the system when
+// it is destroyed in turn.
+
+#include <bdlscm_version.h>
+
+#include <bdlma_managedallocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // =======================
+                          // class HugePageAllocator
+                          // =======================
+
+class HugePageAllocator : public ManagedAllocator {
+    // This class implements the 'ManagedAllocator' protocol by carving blocks
+    // from regions of memory obtained from the operating system, backed by
+    // the pages of a policy supplied at construction and optionally bound to
+    // a NUMA node.
+
+  public:
+    // TYPES
+    enum PagePolicy {
+        // Enumerate the kinds of pages that may back the regions of a
+        // 'HugePageAllocator'.
+
+        e_STANDARD_PAGES,          // default pages of the system
+        e_TRANSPARENT_HUGE_PAGES,  // default pages, advised to be replaced by
+                                   // transparent huge pages
+        e_HUGE_PAGES_2M,           // reserved 2M huge pages
+        e_HUGE_PAGES_1G            // reserved 1G huge pages
+    };
+
+    enum { k_NO_NUMA_NODE = -1 };  // value of 'numaNode' if none is bound
+
+  private:
+    // PRIVATE TYPES
+    struct Region;  // header of a region (defined in the .cpp)
+
+    // DATA
+    const PagePolicy         d_pagePolicy;      // pages backing the regions
+
+    const int                d_numaNode;        // node to bind regions to, or
+                                                // 'k_NO_NUMA_NODE'
+
+    const bsls::Types::size_type
+                             d_regionSize;      // size of a normal region
+
+    Region                  *d_regions_p;       // list of all regions
+
+    Region                  *d_current_p;       // region blocks are carved
+                                                // from, or 0
+
+    char                    *d_cursor_p;        // next free byte of
+                                                // 'd_current_p'
+
+    char                    *d_end_p;           // end of 'd_current_p'
+
+    bsls::AtomicInt64        d_numBytesMapped;  // size of all regions
+
+    bsls::AtomicInt          d_numFallbacks;    // regions not obtained as
+                                                // requested
+
+    mutable bslmt::Mutex     d_mutex;           // guards the regions
+
+  private:
+    // NOT IMPLEMENTED
+    HugePageAllocator(const HugePageAllocator&);
+    HugePageAllocator& operator=(const HugePageAllocator&);
+
+    // PRIVATE MANIPULATORS
+    Region *mapRegion(bsls::Types::size_type size);
+        // Obtain from the system a region of the specified 'size' bytes, add
+        // it to the list of regions, and return its address, or 0 if no
+        // memory is available.  The behavior is undefined unless 'size' is a
+        // multiple of 'regionSize()' and 'd_mutex' is locked.
+
+    void unmapRegion(Region *region);
+        // Remove the specified 'region' from the list of regions and return
+        // its memory to the system.  The behavior is undefined unless
+        // 'd_mutex' is locked.
+
+  public:
+    // CREATORS
+    explicit
+    HugePageAllocator(PagePolicy pagePolicy = e_TRANSPARENT_HUGE_PAGES,
+                      int        numaNode   = k_NO_NUMA_NODE);
+        // Create a huge page allocator.  Optionally specify a 'pagePolicy'
+        // selecting the pages backing its regions.  If 'pagePolicy' is not
+        // specified, 'e_TRANSPARENT_HUGE_PAGES' is used.  Optionally specify
+        // a 'numaNode' to which the regions are bound.  If 'numaNode' is not
+        // specified, the regions are not bound.  The behavior is undefined
+        // unless 'numaNode' is 'k_NO_NUMA_NODE' or non-negative.  Note that
+        // the pages and the binding requested are obtained on a best-effort
+        // basis (see {Page Policies} and {NUMA Binding}).
+
+    virtual ~HugePageAllocator();
+        // Destroy this allocator, returning all the memory allocated through
+        // it to the system.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a maximally-aligned block of memory of at
+        // least the specified 'size' (in bytes).  If 'size' is 0, a null
+        // pointer is returned with no other effect.  If the system has no
+        // memory available, 'bsl::bad_alloc' is thrown, or 0 is returned in
+        // builds without exceptions.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to this
+        // allocator, returning its region to the system if no other block of
+        // the region is in use and the region is not the one blocks are
+        // currently allocated from.  If 'address' is 0, this function has no
+        // effect.  The behavior is undefined unless 'address' was allocated by
+        // this allocator and has not already been deallocated.
+
+    virtual void release();
+        // Return all the memory allocated through this allocator to the
+        // system.  The behavior is undefined if any block allocated through
+        // this allocator is used after this call.
+
+    // ACCESSORS
+    int numaNode() const;
+        // Return the NUMA node to which the regions of this allocator are
+        // bound, or 'k_NO_NUMA_NODE' if they are not bound.
+
+    bsls::Types::Int64 numBytesMapped() const;
+        // Return the total size of the regions currently obtained from the
+        // system by this allocator.
+
+    int numFallbacks() const;
+        // Return the number of times a region could not be obtained with the
+        // pages of the policy of this allocator, or bound to its NUMA node,
+        // and was obtained otherwise.
+
+    PagePolicy pagePolicy() const;
+        // Return the page policy of this allocator.
+
+    bsls::Types::size_type regionSize() const;
+        // Return the size of a normal region of this allocator, which is also
+        // the alignment of the regions for all policies but
+        // 'e_STANDARD_PAGES'.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// ACCESSORS
+inline
+int HugePageAllocator::numaNode() const
+{
+    return d_numaNode;
+}
+
+inline
+bsls::Types::Int64 HugePageAllocator::numBytesMapped() const
+{
+    return d_numBytesMapped.loadRelaxed();
+}
+
+inline
+int HugePageAllocator::numFallbacks() const
+{
+    return d_numFallbacks.loadRelaxed();
+}
+
+inline
+HugePageAllocator::PagePolicy HugePageAllocator::pagePolicy() const
+{
+    return d_pagePolicy;
+}
+
+inline
+bsls::Types::size_type HugePageAllocator::regionSize() const
+{
+    return d_regionSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1000 @@
+// bdlma_hugepageallocator.t.cpp                                      -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bdlma_multipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_new.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlma::HugePageAllocator' carves blocks from regions of memory obtained
+// from the system with the pages of a policy, optionally bound to a NUMA node.
+// The concerns are that every block returned is usable, maximally aligned,
+// and distinct from every other block in use; that regions are obtained and
+// returned to the system as documented, which is observable through
+// 'numBytesMapped'; that each policy, and each NUMA binding, yields usable
+// memory whether or not the system supports it, counting the fallbacks; and
+// that the allocator is thread-safe.  Whether the pages obtained are huge
+// pages is up to the system and is not tested; test case -1 measures the
+// effect of the huge pages on a TLB-bound workload.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] HugePageAllocator(PagePolicy pagePolicy, int numaNode);
+// [ 2] ~HugePageAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void release();
+//
+// ACCESSORS
+// [ 2] int numaNode() const;
+// [ 3] bsls::Types::Int64 numBytesMapped() const;
+// [ 5] int numFallbacks() const;
+// [ 2] PagePolicy pagePolicy() const;
+// [ 2] bsls::Types::size_type regionSize() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: Every page policy yields usable memory.
+// [ 6] CONCERN: Binding to a NUMA node yields usable memory.
+// [ 7] CONCERN: The allocator is thread-safe.
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: RANDOM LOOKUPS IN A LARGE HASH TABLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::HugePageAllocator Obj;
+typedef bsls::Types::size_type   size_type;
+typedef bsls::Types::Int64       Int64;
+
+static const int k_MAX_ALIGNMENT = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+static const size_type k_2M = 2 * 1024 * 1024;
+static const size_type k_1G = 1024 * 1024 * 1024;
+
+static const Obj::PagePolicy POLICIES[] = {
+    Obj::e_STANDARD_PAGES,
+    Obj::e_TRANSPARENT_HUGE_PAGES,
+    Obj::e_HUGE_PAGES_2M,
+    Obj::e_HUGE_PAGES_1G
+};
+static const int NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES;
+
+// ============================================================================
+//                         HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address)
+                                                        % k_MAX_ALIGNMENT;
+}
+
+void fill(void *address, size_type size, unsigned char seed)
+    // Write a pattern derived from the specified 'seed' to the specified
+    // 'size' bytes at the specified 'address'.
+{
+    unsigned char *p = static_cast<unsigned char *>(address);
+    for (size_type i = 0; i < size; ++i) {
+        p[i] = static_cast<unsigned char>(seed + i);
+    }
+}
+
+bool check(const void *address, size_type size, unsigned char seed)
+    // Return 'true' if the specified 'size' bytes at the specified 'address'
+    // hold the pattern written by 'fill' for the specified 'seed', and
+    // 'false' otherwise.
+{
+    const unsigned char *p = static_cast<const unsigned char *>(address);
+    for (size_type i = 0; i < size; ++i) {
+        if (p[i] != static_cast<unsigned char>(seed + i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+void exerciseAllocator(Obj *allocator, int line)
+    // Allocate, fill, check, and deallocate blocks of various sizes from the
+    // specified 'allocator', including a block too large to share a region,
+    // and report failures against the specified 'line'.
+{
+    static const size_type SIZES[] = { 1, 8, 100, 4096, 100000 };
+    enum { k_NUM_SIZES = sizeof SIZES / sizeof *SIZES };
+
+    void *blocks[k_NUM_SIZES + 1];
+
+    for (int i = 0; i < k_NUM_SIZES; ++i) {
+        blocks[i] = allocator->allocate(SIZES[i]);
+        LOOP2_ASSERT(line, i, isMaximallyAligned(blocks[i]));
+        fill(blocks[i], SIZES[i], static_cast<unsigned char>(i));
+    }
+
+    const size_type largeSize = allocator->regionSize() / 2;
+
+    blocks[k_NUM_SIZES] = allocator->allocate(largeSize);
+    LOOP_ASSERT(line, isMaximallyAligned(blocks[k_NUM_SIZES]));
+
+    // Touch the first and last pages only, so as not to commit a whole 1G
+    // region.
+
+    fill(blocks[k_NUM_SIZES], 4096, 7);
+    fill(static_cast<char *>(blocks[k_NUM_SIZES]) + largeSize - 4096, 4096, 9);
+
+    for (int i = 0; i < k_NUM_SIZES; ++i) {
+        LOOP2_ASSERT(line, i, check(blocks[i], SIZES[i],
+                                    static_cast<unsigned char>(i)));
+    }
+    LOOP_ASSERT(line, check(blocks[k_NUM_SIZES], 4096, 7));
+    LOOP_ASSERT(line, check(static_cast<char *>(blocks[k_NUM_SIZES])
+                                                          + largeSize - 4096,
+                            4096,
+                            9));
+
+    for (int i = 0; i <= k_NUM_SIZES; ++i) {
+        allocator->deallocate(blocks[i]);
+    }
+}
+
+                            // =================
+                            // struct StressTest
+                            // =================
+
+struct StressTest {
+    // This 'struct' describes the work of a thread repeatedly allocating and
+    // freeing blocks from a shared allocator.
+
+    Obj *d_allocator_p;  // allocator under test
+    int  d_index;        // index of the thread
+    bool d_failed;       // 'true' if a block was found corrupted
+};
+
+extern "C" void *stressTest(void *arg)
+    // Perform the work described by the specified 'arg' (the address of a
+    // 'StressTest').
+{
+    StressTest *work = static_cast<StressTest *>(arg);
+
+    enum { k_SLOTS = 32, k_ITERATIONS = 20000 };
+
+    void          *blocks[k_SLOTS] = { 0 };
+    size_type      sizes[k_SLOTS]  = { 0 };
+    unsigned int   seed = 1u + work->d_index;
+
+    for (int i = 0; i < k_ITERATIONS; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        const int slot = (seed >> 8) % k_SLOTS;
+
+        if (blocks[slot]) {
+            if (!check(blocks[slot],
+                       sizes[slot],
+                       static_cast<unsigned char>(slot + work->d_index))) {
+                work->d_failed = true;
+            }
+            work->d_allocator_p->deallocate(blocks[slot]);
+        }
+        sizes[slot]  = 1 + (seed >> 16) % 2000;
+        blocks[slot] = work->d_allocator_p->allocate(sizes[slot]);
+        fill(blocks[slot],
+             sizes[slot],
+             static_cast<unsigned char>(slot + work->d_index));
+    }
+
+    for (int i = 0; i < k_SLOTS; ++i) {
+        work->d_allocator_p->deallocate(blocks[i]);
+    }
+    return 0;
+}
+
+double benchmarkLookups(bslma::Allocator *allocator,
+                        int               numEntries,
+                        int               numLookups)
+    // Return the average time (in nanoseconds) of a lookup of a random key in
+    // a 'bsl::unordered_map' having the specified 'numEntries' entries and
+    // using the specified 'allocator', measured over the specified
+    // 'numLookups' lookups.
+{
+    bsl::unordered_map<Int64, Int64> map(allocator);
+    map.reserve(numEntries);
+
+    // Insert the keys in a scrambled order, so that neighboring keys are not
+    // in neighboring nodes.
+
+    unsigned int seed = 12345u;
+    for (int i = 0; i < numEntries; ++i) {
+        const Int64 key = (static_cast<Int64>(i) * 2654435761u) % numEntries;
+        map[key] = i;
+    }
+
+    Int64 sum = 0;
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numLookups; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        const Int64 key = (seed >> 4) % numEntries;
+        sum += map.find(key)->second;
+    }
+    timer.stop();
+
+    if (0 == sum) {
+        cout << "unexpected sum" << endl;  // keep 'sum' alive
+    }
+
+    return timer.elapsedTime() * 1e9 / numLookups;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Backing a Large Hash Table with Huge Pages
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we keep a large cache of prices in a hash table that is read
+// at random, and that the time spent in TLB misses is significant.  We can
+// place the nodes and buckets of the table in huge pages by obtaining them
+// from a multipool whose chunks come from a 'bdlma::HugePageAllocator'.
+//
+// First, we create the allocator, asking for transparent huge pages (which
+// are available without special configuration of the system):
+//..
+    bdlma::HugePageAllocator hugePageAllocator(
+                           bdlma::HugePageAllocator::e_TRANSPARENT_HUGE_PAGES);
+//..
+// Then, we create a multipool allocator, supplying it the huge page allocator
+// as its underlying allocator, so that the multipool obtains its chunks from
+// huge pages:
+//..
+    bdlma::MultipoolAllocator multipoolAllocator(&hugePageAllocator);
+//..
+// Next, we create the table, using the multipool allocator:
+//..
+    bsl::unordered_map<int, double> prices(&multipoolAllocator);
+    for (int i = 0; i < 100000; ++i) {
+        prices[i] = i * 0.25;
+    }
+    ASSERT(0 < hugePageAllocator.numBytesMapped());
+//..
+// Finally, the table and the multipool are destroyed, returning their chunks
+// to the huge page allocator, which returns its regions to the system when
+// it is destroyed in turn.
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Blocks allocated and freed concurrently by several threads are
+        //:   distinct and retain their contents while in use.
+        //:
+        //: 2 All regions are returned to the system once every block is freed
+        //:   but those of the current region.
+        //
+        // Plan:
+        //: 1 Have several threads repeatedly allocate blocks of random sizes
+        //:   from a shared allocator, fill them with a pattern specific to
+        //:   the thread and the slot, and check the pattern before freeing
+        //:   them.  (C-1)
+        //:
+        //: 2 Once the threads are joined, verify that at most one region is
+        //:   mapped.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: The allocator is thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        enum { k_NUM_THREADS = 8 };
+
+        Obj mX;  const Obj& X = mX;
+
+        StressTest                work[k_NUM_THREADS];
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            work[i].d_allocator_p = &mX;
+            work[i].d_index       = i;
+            work[i].d_failed      = false;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  stressTest,
+                                                  &work[i]));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            ASSERTV(i, !work[i].d_failed);
+        }
+
+        ASSERTV(X.numBytesMapped(),
+                X.numBytesMapped() <= static_cast<Int64>(X.regionSize()));
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // NUMA BINDING
+        //
+        // Concerns:
+        //: 1 An allocator bound to a NUMA node yields usable memory whether or
+        //:   not the node exists.
+        //:
+        //: 2 A failure to bind a region is counted as a fallback.
+        //
+        // Plan:
+        //: 1 For each page policy, exercise allocators bound to node 0, which
+        //:   exists on every system supporting NUMA, and to a node that
+        //:   exists on no system.  (C-1)
+        //:
+        //: 2 On Linux, verify that the regions bound to the nonexistent node
+        //:   are counted as fallbacks.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: Binding to a NUMA node yields usable memory.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "NUMA BINDING" << endl
+                          << "============" << endl;
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            const Obj::PagePolicy POLICY = POLICIES[ti];
+
+            {
+                Obj mX(POLICY, 0);  const Obj& X = mX;
+
+                ASSERTV(ti, 0 == X.numaNode());
+                exerciseAllocator(&mX, L_);
+
+                if (veryVerbose) { T_ P_(ti) P(X.numFallbacks()) }
+            }
+            {
+                Obj mX(POLICY, 100000);  const Obj& X = mX;
+
+                ASSERTV(ti, 100000 == X.numaNode());
+                exerciseAllocator(&mX, L_);
+
+                if (veryVerbose) { T_ P_(ti) P(X.numFallbacks()) }
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+                // Each of the two regions mapped fell back.
+
+                ASSERTV(ti, X.numFallbacks(), 2 == X.numFallbacks());
+#endif
+            }
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // PAGE POLICIES
+        //
+        // Concerns:
+        //: 1 Every page policy yields usable, maximally-aligned memory,
+        //:   whether or not the system supports its pages.
+        //:
+        //: 2 The regions of every policy but 'e_STANDARD_PAGES' are aligned on
+        //:   the region size.
+        //:
+        //: 3 At most one fallback is counted per region.
+        //:
+        //: 4 'e_STANDARD_PAGES' never falls back.
+        //
+        // Plan:
+        //: 1 For each page policy, exercise an allocator.  (C-1)
+        //:
+        //: 2 For each page policy, allocate a block, and verify that the
+        //:   address of the block less the size of the region header is
+        //:   aligned as expected.  (C-2)
+        //:
+        //: 3 Verify the values of 'numFallbacks'.  (C-3..4)
+        //
+        // Testing:
+        //   int numFallbacks() const;
+        //   CONCERN: Every page policy yields usable memory.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PAGE POLICIES" << endl
+                          << "=============" << endl;
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            const Obj::PagePolicy POLICY = POLICIES[ti];
+
+            Obj mX(POLICY);  const Obj& X = mX;
+
+            ASSERTV(ti, 0 == X.numFallbacks());
+
+            void *p = mX.allocate(1);
+            fill(p, 1, 1);
+
+            if (veryVerbose) { T_ P_(ti) P_(p) P(X.numFallbacks()) }
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+            if (Obj::e_STANDARD_PAGES != POLICY) {
+                // The first block follows the region header, which is smaller
+                // than a page.
+
+                const bsls::Types::UintPtr offset =
+                        reinterpret_cast<bsls::Types::UintPtr>(p) % k_2M;
+
+                ASSERTV(ti, offset, offset < 4096);
+            }
+#endif
+
+            ASSERTV(ti, X.numFallbacks(), X.numFallbacks() <= 1);
+
+            exerciseAllocator(&mX, L_);
+
+            // 'exerciseAllocator' mapped exactly one more region.
+
+            ASSERTV(ti, X.numFallbacks(), X.numFallbacks() <= 2);
+
+            if (Obj::e_STANDARD_PAGES == POLICY) {
+                ASSERTV(X.numFallbacks(), 0 == X.numFallbacks());
+            }
+
+            mX.deallocate(p);
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'release'
+        //
+        // Concerns:
+        //: 1 'release' returns every region to the system, including the
+        //:   current region and the regions of large blocks.
+        //:
+        //: 2 The allocator is usable after 'release'.
+        //:
+        //: 3 Destroying the allocator returns every region to the system.
+        //
+        // Plan:
+        //: 1 Allocate small and large blocks, call 'release', and verify that
+        //:   'numBytesMapped' is 0.  (C-1)
+        //:
+        //: 2 Allocate again and verify the memory is usable.  (C-2)
+        //:
+        //: 3 Destroy an allocator holding blocks; the test is run under a
+        //:   leak-checking tool to verify C-3.  (C-3)
+        //
+        // Testing:
+        //   void release();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'release'" << endl
+                          << "=========" << endl;
+
+        Obj mX(Obj::e_STANDARD_PAGES);  const Obj& X = mX;
+
+        mX.release();
+        ASSERT(0 == X.numBytesMapped());
+
+        for (int i = 0; i < 100; ++i) {
+            mX.allocate(10000);
+        }
+        mX.allocate(k_2M);
+        ASSERT(0 < X.numBytesMapped());
+
+        mX.release();
+        ASSERT(0 == X.numBytesMapped());
+
+        void *p = mX.allocate(100);
+        fill(p, 100, 3);
+        ASSERT(check(p, 100, 3));
+        ASSERT(static_cast<Int64>(k_2M) == X.numBytesMapped());
+
+        {
+            Obj mY;
+
+            mY.allocate(100);
+            mY.allocate(k_2M);
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block that is distinct
+        //:   from the blocks in use and retains its contents until freed.
+        //:
+        //: 2 'allocate(0)' returns 0 and 'deallocate(0)' has no effect.
+        //:
+        //: 3 Small blocks are carved from a region of 'regionSize()' bytes,
+        //:   and a new region is mapped when the current one is exhausted.
+        //:
+        //: 4 A region other than the current one is returned to the system
+        //:   when its last block is freed, and the current region is reused
+        //:   when its last block is freed.
+        //:
+        //: 5 A large block gets a region of its own, of a multiple of
+        //:   'regionSize()' bytes, which is returned to the system when the
+        //:   block is freed.
+        //
+        // Plan:
+        //: 1 Allocate blocks of various sizes, verify their alignment, fill
+        //:   them with distinct patterns, and verify the patterns before
+        //:   freeing them.  (C-1)
+        //:
+        //: 2 Call 'allocate(0)' and 'deallocate(0)', and verify that no
+        //:   region is mapped.  (C-2)
+        //:
+        //: 3 Allocate blocks until a second region is mapped, verifying
+        //:   'numBytesMapped' after each allocation.  Free the blocks of the
+        //:   first region and verify that it is unmapped; free the blocks of
+        //:   the second region and verify that its memory is reused.  (C-3..4)
+        //:
+        //: 4 Allocate large blocks and verify 'numBytesMapped' before and
+        //:   after freeing them.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 numBytesMapped() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        const Int64 REGION = static_cast<Int64>(k_2M);
+
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        if (verbose) cout << "\tTesting distinct, usable blocks." << endl;
+        {
+            Obj mX(Obj::e_STANDARD_PAGES);
+
+            bsl::vector<void *> blocks(&sa);
+            for (int i = 0; i < 1000; ++i) {
+                void *p = mX.allocate(1 + i % 300);
+                ASSERTV(i, isMaximallyAligned(p));
+                fill(p, 1 + i % 300, static_cast<unsigned char>(i));
+                blocks.push_back(p);
+            }
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, check(blocks[i],
+                                 1 + i % 300,
+                                 static_cast<unsigned char>(i)));
+                mX.deallocate(blocks[i]);
+            }
+        }
+
+        if (verbose) cout << "\tTesting 0 size and null address." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            ASSERT(0 == X.numBytesMapped());
+        }
+
+        if (verbose) cout << "\tTesting region reuse and unmapping." << endl;
+        {
+            Obj mX(Obj::e_STANDARD_PAGES);  const Obj& X = mX;
+
+            // Each block takes 64K including its header.
+
+            const size_type SIZE = 64 * 1024 - k_MAX_ALIGNMENT;
+
+            bsl::vector<void *> first(&sa);
+            void *p = mX.allocate(SIZE);
+            ASSERT(REGION == X.numBytesMapped());
+
+            while (REGION == X.numBytesMapped()) {
+                first.push_back(p);
+                p = mX.allocate(SIZE);
+            }
+            ASSERTV(first.size(), 31 == first.size());
+            ASSERT(2 * REGION == X.numBytesMapped());
+
+            // Freeing the blocks of the first region unmaps it.
+
+            for (bsl::size_t i = 0; i < first.size(); ++i) {
+                mX.deallocate(first[i]);
+            }
+            ASSERT(REGION == X.numBytesMapped());
+
+            // Freeing the only block of the current region resets it.
+
+            mX.deallocate(p);
+            ASSERT(REGION == X.numBytesMapped());
+            ASSERT(p == mX.allocate(SIZE));
+            ASSERT(REGION == X.numBytesMapped());
+            mX.deallocate(p);
+        }
+
+        if (verbose) cout << "\tTesting large blocks." << endl;
+        {
+            Obj mX(Obj::e_STANDARD_PAGES);  const Obj& X = mX;
+
+            void *small = mX.allocate(100);
+            ASSERT(REGION == X.numBytesMapped());
+
+            void *large = mX.allocate(k_2M / 4 + 1);
+            ASSERT(2 * REGION == X.numBytesMapped());
+            fill(large, k_2M / 4 + 1, 5);
+
+            void *huge = mX.allocate(k_2M);
+            ASSERT(4 * REGION == X.numBytesMapped());
+            fill(huge, k_2M, 6);
+
+            ASSERT(check(large, k_2M / 4 + 1, 5));
+            ASSERT(check(huge, k_2M, 6));
+
+            mX.deallocate(huge);
+            ASSERT(2 * REGION == X.numBytesMapped());
+            mX.deallocate(large);
+            ASSERT(REGION == X.numBytesMapped());
+
+            // Large blocks do not disturb the current region.
+
+            void *next = mX.allocate(100);
+            ASSERT(static_cast<char *>(small)
+                   + bsls::AlignmentUtil::roundUpToMaximalAlignment(100)
+                   + k_MAX_ALIGNMENT == static_cast<char *>(next));
+            ASSERT(REGION == X.numBytesMapped());
+
+            mX.deallocate(small);
+            mX.deallocate(next);
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\tTesting unavailable memory." << endl;
+        {
+            Obj mX;
+
+            bool caught = false;
+            try {
+                mX.allocate(~size_type(0) - 100);
+            }
+            catch (const bsl::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+        }
+#endif
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructor records the page policy and the NUMA node, which
+        //:   default to 'e_TRANSPARENT_HUGE_PAGES' and 'k_NO_NUMA_NODE'.
+        //:
+        //: 2 The region size is 1G for 'e_HUGE_PAGES_1G' and 2M otherwise.
+        //:
+        //: 3 A new allocator has mapped no memory and counted no fallbacks.
+        //:
+        //: 4 The allocator uses no memory from the default allocator.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create allocators with every page policy, with and without a
+        //:   NUMA node, and verify the accessors.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a NUMA node less than 'k_NO_NUMA_NODE' (using the
+        //:   'BSLS_ASSERTTEST_*' macros).  (C-5)
+        //
+        // Testing:
+        //   HugePageAllocator(PagePolicy pagePolicy, int numaNode);
+        //   ~HugePageAllocator();
+        //   int numaNode() const;
+        //   PagePolicy pagePolicy() const;
+        //   bsls::Types::size_type regionSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::e_TRANSPARENT_HUGE_PAGES == X.pagePolicy());
+            ASSERT(Obj::k_NO_NUMA_NODE           == X.numaNode());
+            ASSERT(k_2M                          == X.regionSize());
+            ASSERT(0                             == X.numBytesMapped());
+            ASSERT(0                             == X.numFallbacks());
+        }
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            const Obj::PagePolicy POLICY = POLICIES[ti];
+            const size_type       REGION = Obj::e_HUGE_PAGES_1G == POLICY
+                                         ? k_1G
+                                         : k_2M;
+
+            for (int node = Obj::k_NO_NUMA_NODE; node < 2; ++node) {
+                Obj mX(POLICY, node);  const Obj& X = mX;
+
+                ASSERTV(ti, node, POLICY == X.pagePolicy());
+                ASSERTV(ti, node, node   == X.numaNode());
+                ASSERTV(ti, node, REGION == X.regionSize());
+                ASSERTV(ti, node, 0      == X.numBytesMapped());
+                ASSERTV(ti, node, 0      == X.numFallbacks());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(Obj::e_STANDARD_PAGES, Obj::k_NO_NUMA_NODE));
+            ASSERT_FAIL(Obj(Obj::e_STANDARD_PAGES, Obj::k_NO_NUMA_NODE - 1));
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and free blocks of a few sizes, and verify that they are
+        //:   usable and that the memory is returned to the system.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        void *a = mX.allocate(8);
+        void *b = mX.allocate(100);
+        void *c = mX.allocate(10000000);
+
+        ASSERT(a && b && c);
+        ASSERT(a != b);
+        ASSERT(0 < X.numBytesMapped());
+
+        bsl::memset(a, 1, 8);
+        bsl::memset(b, 2, 100);
+        bsl::memset(c, 3, 10000000);
+
+        mX.deallocate(a);
+        mX.deallocate(b);
+        mX.deallocate(c);
+
+        ASSERT(static_cast<Int64>(X.regionSize()) == X.numBytesMapped());
+
+        mX.release();
+        ASSERT(0 == X.numBytesMapped());
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: RANDOM LOOKUPS IN A LARGE HASH TABLE
+        //
+        // Concerns:
+        //: 1 Backing a pool with huge pages speeds up random accesses to a
+        //:   data structure much larger than the reach of the TLB.
+        //
+        // Plan:
+        //: 1 Fill a 'bsl::unordered_map<Int64, Int64>' having millions of
+        //:   entries, and time lookups of random keys, with the memory of the
+        //:   table obtained from: the 'bslma::NewDeleteAllocator'; a
+        //:   'bdlma::MultipoolAllocator' over 'bslma::NewDeleteAllocator'; and
+        //:   a 'bdlma::MultipoolAllocator' over a 'bdlma::HugePageAllocator'
+        //:   with each page policy.  Optionally specify the number of entries
+        //:   (in millions) and of lookups (in millions) as the second and
+        //:   third arguments.
+        //
+        // Testing:
+        //   PERFORMANCE: RANDOM LOOKUPS IN A LARGE HASH TABLE
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: RANDOM LOOKUPS IN A LARGE HASH TABLE" << endl
+             << "=================================================" << endl;
+
+        const int numEntries = 1000000 * (argc > 2 ? atoi(argv[2]) : 8);
+        const int numLookups = 1000000 * (argc > 3 ? atoi(argv[3]) : 20);
+
+        bslma::Allocator *newDelete = &bslma::NewDeleteAllocator::singleton();
+
+        cout << "entries: " << numEntries << ", lookups: " << numLookups
+             << endl
+             << "nanoseconds per lookup:" << endl;
+
+        cout << "\tNewDeleteAllocator:              "
+             << benchmarkLookups(newDelete, numEntries, numLookups) << endl;
+        {
+            bdlma::MultipoolAllocator allocator(newDelete);
+
+            cout << "\tMultipool over NewDelete:        "
+                 << benchmarkLookups(&allocator, numEntries, numLookups)
+                 << endl;
+        }
+
+        static const char *const NAMES[] = {
+            "\tMultipool over standard pages:   ",
+            "\tMultipool over transparent huge: ",
+            "\tMultipool over 2M huge pages:    ",
+            "\tMultipool over 1G huge pages:    "
+        };
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            Obj                       hugePageAllocator(POLICIES[ti]);
+            bdlma::MultipoolAllocator allocator(&hugePageAllocator);
+
+            cout << NAMES[ti]
+                 << benchmarkLookups(&allocator, numEntries, numLookups)
+                 << " (fallbacks: " << hugePageAllocator.numFallbacks() << ")"
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,527 @@
+// bdlma_threadcachingallocator.cpp                                   -*-C++-*-
+#include <bdlma_threadcachingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadcachingallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstdint.h>
+
+#include <new>  // placement 'new'
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Size class 'i' comprises the blocks of pool 'i' of the multipool, whose
+// size, header included, is '8 << i' bytes.  The header of an allocated block
+// records its size class, or -1 for a block too large to be pooled.  While a
+// block is free, its header and the start of its body hold a 'FreeBlock',
+// which links the block into a list; the first block of a batch in a depot
+// also links the batch to the next batch, and records the number of blocks
+// in the batch.  The smallest block that can be pooled is twice the size of a
+// header, which is large enough to hold a 'FreeBlock'.
+//
+// The cache of a thread holds, for each size class, a "loaded" list, from
+// which blocks are taken and to which they are returned, and a "spare" list,
+// which is either empty or full.  Having two lists ensures that a thread
+// alternately allocating and freeing a block at the boundary of a batch does
+// not go to the depot each time.
+
+namespace BloombergLP {
+namespace bdlma {
+namespace {
+
+enum {
+    k_DEFAULT_NUM_POOLS = 10,         // number of pools if not specified
+
+    k_MIN_BLOCK_SIZE    = 8,          // size of the blocks of pool 0
+
+    k_MIN_BATCH_BLOCKS  = 2,          // minimum number of blocks in a batch
+
+    k_MAX_BATCH_BLOCKS  = 32,         // maximum number of blocks in a batch
+
+    k_MAX_BATCH_BYTES   = 32 * 1024   // maximum number of bytes in a batch,
+                                      // unless 'k_MIN_BATCH_BLOCKS' requires
+                                      // more
+};
+
+union Header {
+    // This 'union' describes the prefix of each allocated block.
+
+    int                                 d_sizeClass;  // size class of block,
+                                                      // or -1 if not pooled
+
+    bsls::AlignmentUtil::MaxAlignedType d_align;      // forces alignment
+};
+
+struct FreeBlock {
+    // This 'struct' overlays the start of a free block.
+
+    FreeBlock *d_next_p;       // next block in the same list
+    FreeBlock *d_nextBatch_p;  // first block of next batch in a depot
+    int        d_numBlocks;    // number of blocks in the batch
+};
+
+BSLMF_ASSERT(sizeof(FreeBlock) <= 2 * sizeof(Header));
+
+struct FreeList {
+    // This 'struct' describes a list of free blocks of one size class.
+
+    FreeBlock *d_head_p;     // first block, or 0 if the list is empty
+    int        d_numBlocks;  // number of blocks in the list
+    int        d_maxBlocks;  // number of blocks in a full list
+};
+
+inline
+int findSizeClass(bsls::Types::size_type size)
+    // Return the size class of the smallest blocks, headers included, of at
+    // least the specified 'size' bytes.  The behavior is undefined unless
+    // '0 < size' and 'size' is at most the largest pooled block size.
+{
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(static_cast<bsl::uint32_t>(
+                                ((size + k_MIN_BLOCK_SIZE - 1) >> 3) * 2 - 1));
+}
+
+int maxBatchBlocks(int sizeClass)
+    // Return the number of blocks in a full list of the specified
+    // 'sizeClass'.
+{
+    const bsls::Types::size_type blockSize =
+                     static_cast<bsls::Types::size_type>(k_MIN_BLOCK_SIZE)
+                                                                 << sizeClass;
+    const bsls::Types::size_type numBlocks = k_MAX_BATCH_BYTES / blockSize;
+
+    return numBlocks < k_MIN_BATCH_BLOCKS
+           ? k_MIN_BATCH_BLOCKS
+           : numBlocks > k_MAX_BATCH_BLOCKS
+           ? k_MAX_BATCH_BLOCKS
+           : static_cast<int>(numBlocks);
+}
+
+inline
+void *popBlock(FreeList *list, int sizeClass)
+    // Remove the first block from the specified 'list', record the specified
+    // 'sizeClass' in its header, and return the address of its body.  The
+    // behavior is undefined unless 'list' is not empty.
+{
+    FreeBlock *block = list->d_head_p;
+    list->d_head_p   = block->d_next_p;
+    --list->d_numBlocks;
+
+    Header *header      = reinterpret_cast<Header *>(block);
+    header->d_sizeClass = sizeClass;
+    return header + 1;
+}
+
+inline
+void pushBlock(FreeList *list, void *header)
+    // Add the block having the specified 'header' to the front of the
+    // specified 'list'.
+{
+    FreeBlock *block = static_cast<FreeBlock *>(header);
+    block->d_next_p  = list->d_head_p;
+    list->d_head_p   = block;
+    ++list->d_numBlocks;
+}
+
+}  // close unnamed namespace
+
+                     // ==================================
+                     // class ThreadCachingAllocator_Depot
+                     // ==================================
+
+class ThreadCachingAllocator_Depot {
+    // This component-private class holds the batches of free blocks of one
+    // size class that are not in the cache of any thread.
+
+    // DATA
+    bslmt::Mutex d_mutex;                                 // protects
+                                                          // 'd_batches_p'
+
+    FreeBlock   *d_batches_p;                             // first block of
+                                                          // first batch
+
+    char         d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                                          // separates the
+                                                          // depots
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingAllocator_Depot(const ThreadCachingAllocator_Depot&);
+    ThreadCachingAllocator_Depot& operator=(
+                                          const ThreadCachingAllocator_Depot&);
+
+  public:
+    // CREATORS
+    ThreadCachingAllocator_Depot()
+        // Create an empty depot.
+    : d_batches_p(0)
+    {
+    }
+
+    // MANIPULATORS
+    void pop(FreeList *list)
+        // Move a batch from this depot to the specified 'list', if this depot
+        // is not empty.  The behavior is undefined unless 'list' is empty.
+    {
+        BSLS_ASSERT(0 == list->d_head_p);
+
+        FreeBlock *batch;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            batch = d_batches_p;
+            if (batch) {
+                d_batches_p = batch->d_nextBatch_p;
+            }
+        }
+
+        if (batch) {
+            list->d_head_p    = batch;
+            list->d_numBlocks = batch->d_numBlocks;
+        }
+    }
+
+    void push(FreeList *list)
+        // Move the blocks of the specified 'list' to this depot as one batch,
+        // leaving 'list' empty.  The behavior is undefined unless 'list' is
+        // not empty.
+    {
+        BSLS_ASSERT(list->d_head_p);
+
+        FreeBlock *batch   = list->d_head_p;
+        batch->d_numBlocks = list->d_numBlocks;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            batch->d_nextBatch_p = d_batches_p;
+            d_batches_p          = batch;
+        }
+
+        list->d_head_p    = 0;
+        list->d_numBlocks = 0;
+    }
+};
+
+                     // ==================================
+                     // struct ThreadCachingAllocator_Cache
+                     // ==================================
+
+struct ThreadCachingAllocator_Cache {
+    // This component-private 'struct' holds the free blocks cached by one
+    // thread for one allocator.  It is followed in memory by its lists.
+
+    // PUBLIC DATA
+    ThreadCachingAllocator *d_allocator_p;  // allocator owning this cache
+    FreeList               *d_loaded_p;     // loaded list of each size class
+    FreeList               *d_spare_p;      // spare list of each size class
+
+    // CLASS METHODS
+    static void releaseOnThreadExit(void *cache)
+        // Return the blocks of the specified 'cache' to the depots, and free
+        // 'cache'.  Note that this function is the cleanup function of the
+        // thread-specific key of the allocator.
+    {
+        if (cache) {
+            ThreadCachingAllocator_Cache *object =
+                           static_cast<ThreadCachingAllocator_Cache *>(cache);
+
+            object->flush();
+            object->d_allocator_p->d_multipool.deallocate(object);
+        }
+    }
+
+    // MANIPULATORS
+    void flush()
+        // Move the blocks of each list of this cache to the depots.
+    {
+        const int numPools = d_allocator_p->d_numPools;
+
+        for (int i = 0; i < numPools; ++i) {
+            if (d_loaded_p[i].d_head_p) {
+                d_allocator_p->d_depots_p[i].push(d_loaded_p + i);
+            }
+            if (d_spare_p[i].d_head_p) {
+                d_allocator_p->d_depots_p[i].push(d_spare_p + i);
+            }
+        }
+    }
+};
+
+                        // ----------------------------
+                        // class ThreadCachingAllocator
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+void *ThreadCachingAllocator::allocateFromDepot(
+                                       int                           sizeClass,
+                                       ThreadCachingAllocator_Cache *cache)
+{
+    if (!cache) {
+        cache = createCache();
+    }
+
+    if (cache) {
+        FreeList *loaded = cache->d_loaded_p + sizeClass;
+        FreeList *spare  = cache->d_spare_p  + sizeClass;
+
+        if (spare->d_head_p) {
+            loaded->d_head_p    = spare->d_head_p;
+            loaded->d_numBlocks = spare->d_numBlocks;
+            spare->d_head_p     = 0;
+            spare->d_numBlocks  = 0;
+        }
+        else {
+            d_depots_p[sizeClass].pop(loaded);
+        }
+
+        if (loaded->d_head_p) {
+            return popBlock(loaded, sizeClass);                       // RETURN
+        }
+    }
+
+    Header *header = static_cast<Header *>(d_multipool.allocate(
+                     static_cast<bsls::Types::size_type>(k_MIN_BLOCK_SIZE)
+                                                                << sizeClass));
+    header->d_sizeClass = sizeClass;
+    return header + 1;
+}
+
+ThreadCachingAllocator_Cache *ThreadCachingAllocator::createCache()
+{
+    if (!d_hasKey) {
+        return 0;                                                     // RETURN
+    }
+
+    ThreadCachingAllocator_Cache *cache =
+        static_cast<ThreadCachingAllocator_Cache *>(d_multipool.allocate(
+                                      sizeof(ThreadCachingAllocator_Cache)
+                                      + 2 * d_numPools * sizeof(FreeList)));
+
+    cache->d_allocator_p = this;
+    cache->d_loaded_p    = reinterpret_cast<FreeList *>(cache + 1);
+    cache->d_spare_p     = cache->d_loaded_p + d_numPools;
+
+    for (int i = 0; i < d_numPools; ++i) {
+        FreeList list = { 0, 0, maxBatchBlocks(i) };
+
+        cache->d_loaded_p[i] = list;
+        cache->d_spare_p[i]  = list;
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_key, cache)) {
+        d_multipool.deallocate(cache);
+        return 0;                                                     // RETURN
+    }
+    return cache;
+}
+
+void ThreadCachingAllocator::deallocateToDepot(
+                                       void                         *header,
+                                       int                           sizeClass,
+                                       ThreadCachingAllocator_Cache *cache)
+{
+    if (!cache) {
+        // 'deallocate' must not throw, so should the cache fail to be
+        // created, the block is returned directly to the multipool.
+
+        BSLS_TRY {
+            cache = createCache();
+        }
+        BSLS_CATCH(...) {
+            cache = 0;
+        }
+
+        if (!cache) {
+            d_multipool.deallocate(header);
+            return;                                                   // RETURN
+        }
+    }
+
+    FreeList *loaded = cache->d_loaded_p + sizeClass;
+    FreeList *spare  = cache->d_spare_p  + sizeClass;
+
+    if (loaded->d_numBlocks == loaded->d_maxBlocks) {
+        if (spare->d_head_p) {
+            d_depots_p[sizeClass].push(spare);
+        }
+        spare->d_head_p     = loaded->d_head_p;
+        spare->d_numBlocks  = loaded->d_numBlocks;
+        loaded->d_head_p    = 0;
+        loaded->d_numBlocks = 0;
+    }
+    pushBlock(loaded, header);
+}
+
+void ThreadCachingAllocator::initialize()
+{
+    BSLS_ASSERT(1 <= d_numPools);
+
+    const bsls::Types::size_type largestBlockSize =
+                     static_cast<bsls::Types::size_type>(k_MIN_BLOCK_SIZE)
+                                                         << (d_numPools - 1);
+
+    d_maxPooledBlockSize = largestBlockSize > sizeof(Header)
+                         ? largestBlockSize - sizeof(Header)
+                         : 0;
+
+    d_depots_p = static_cast<ThreadCachingAllocator_Depot *>(
+                   d_multipool.allocate(
+                          d_numPools * sizeof(ThreadCachingAllocator_Depot)));
+    for (int i = 0; i < d_numPools; ++i) {
+        new (d_depots_p + i) ThreadCachingAllocator_Depot();
+    }
+
+    d_hasKey = 0 == bslmt::ThreadUtil::createKey(
+                          &d_key,
+                          &ThreadCachingAllocator_Cache::releaseOnThreadExit);
+}
+
+// CREATORS
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_multipool(k_DEFAULT_NUM_POOLS, basicAllocator)
+, d_depots_p(0)
+, d_numPools(k_DEFAULT_NUM_POOLS)
+, d_maxPooledBlockSize(0)
+, d_hasKey(false)
+{
+    initialize();
+}
+
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_multipool(numPools, basicAllocator)
+, d_depots_p(0)
+, d_numPools(numPools)
+, d_maxPooledBlockSize(0)
+, d_hasKey(false)
+{
+    initialize();
+}
+
+ThreadCachingAllocator::~ThreadCachingAllocator()
+{
+    // Deleting the key ensures that the cleanup function will not run for
+    // threads exiting later.  The caches, and all the blocks, are freed when
+    // the multipool is destroyed.
+
+    if (d_hasKey) {
+        bslmt::ThreadUtil::deleteKey(d_key);
+    }
+
+    for (int i = 0; i < d_numPools; ++i) {
+        d_depots_p[i].~ThreadCachingAllocator_Depot();
+    }
+}
+
+// MANIPULATORS
+void *ThreadCachingAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size > d_maxPooledBlockSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        Header *header = static_cast<Header *>(
+                                d_multipool.allocate(size + sizeof(Header)));
+        header->d_sizeClass = -1;
+        return header + 1;                                            // RETURN
+    }
+
+    const int sizeClass = findSizeClass(size + sizeof(Header));
+
+    ThreadCachingAllocator_Cache *cache =
+        d_hasKey
+        ? static_cast<ThreadCachingAllocator_Cache *>(
+                                      bslmt::ThreadUtil::getSpecific(d_key))
+        : 0;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(cache)) {
+        FreeList *list = cache->d_loaded_p + sizeClass;
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(list->d_head_p)) {
+            return popBlock(list, sizeClass);                         // RETURN
+        }
+    }
+
+    return allocateFromDepot(sizeClass, cache);
+}
+
+void ThreadCachingAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        return;                                                       // RETURN
+    }
+
+    Header    *header    = static_cast<Header *>(address) - 1;
+    const int  sizeClass = header->d_sizeClass;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 > sizeClass)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        d_multipool.deallocate(header);
+        return;                                                       // RETURN
+    }
+
+    ThreadCachingAllocator_Cache *cache =
+        d_hasKey
+        ? static_cast<ThreadCachingAllocator_Cache *>(
+                                      bslmt::ThreadUtil::getSpecific(d_key))
+        : 0;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(cache)) {
+        FreeList *list = cache->d_loaded_p + sizeClass;
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(list->d_numBlocks <
+                                                       list->d_maxBlocks)) {
+            pushBlock(list, header);
+            return;                                                   // RETURN
+        }
+    }
+
+    deallocateToDepot(header, sizeClass, cache);
+}
+
+void ThreadCachingAllocator::flushThreadCache()
+{
+    if (d_hasKey) {
+        ThreadCachingAllocator_Cache *cache =
+                             static_cast<ThreadCachingAllocator_Cache *>(
+                                       bslmt::ThreadUtil::getSpecific(d_key));
+        if (cache) {
+            cache->flush();
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
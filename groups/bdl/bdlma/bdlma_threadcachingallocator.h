@@ -0,0 +1,310 @@
+// bdlma_threadcachingallocator.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADCACHINGALLOCATOR
+#define INCLUDED_BDLMA_THREADCACHINGALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multipool allocator with per-thread block caches.
+//
+//@CLASSES:
+//  bdlma::ThreadCachingAllocator: allocator caching free blocks per thread
+//
+//@SEE_ALSO: bdlma_concurrentmultipoolallocator, bdlma_concurrentmultipool
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bdlma::ThreadCachingAllocator', that implements the 'bslma::Allocator'
+// protocol.  Like 'bdlma::ConcurrentMultipoolAllocator', it serves small
+// blocks from a set of pools of geometrically increasing block sizes (a
+// 'bdlma::ConcurrentMultipool', which it owns), but it places in front of
+// those pools a cache of free blocks private to each thread.  Most calls to
+// 'allocate' and 'deallocate' touch only the cache of the calling thread, and
+// so involve neither atomic operations nor cache lines shared with other
+// threads:
+//..
+//   ,-----------------------------.
+//  ( bdlma::ThreadCachingAllocator )
+//   `-----------------------------'
+//                 |         ctor/dtor
+//                 |         flushThreadCache
+//                 |         maxPooledBlockSize
+//                 |         numPools
+//                 V
+//        ,----------------.
+//       ( bslma::Allocator )
+//        `----------------'
+//                           allocate
+//                           deallocate
+//..
+// The cache of a thread holds, for each size class, up to two lists of free
+// blocks.  When both lists are full, 'deallocate' moves one of them, in a
+// single operation, to a shared *depot* for that size class; when both are
+// empty, 'allocate' takes a whole list back from the depot, and allocates a
+// block from the multipool only if the depot, too, is empty.  Each exchange
+// with a depot thus moves a batch of blocks under one lock acquisition.  A
+// batch holds up to 32 blocks, and fewer for large size classes, so that a
+// cache holds no more than about 64K bytes of each size class.
+//
+// Blocks are not owned by the thread that allocated them: a block freed by a
+// thread other than the one that allocated it simply joins the cache of the
+// freeing thread, and reaches other threads through the depot.  Programs in
+// which one thread allocates and another frees therefore exchange whole
+// batches rather than individual blocks.
+//
+// When a thread exits, the blocks in its cache are returned to the depots.  A
+// thread that stops using the allocator for a long time, without exiting, may
+// call 'flushThreadCache' to do the same.  Memory is returned to the
+// underlying allocator only when the 'bdlma::ThreadCachingAllocator' is
+// destroyed.
+//
+///Size Classes and Overhead
+///-------------------------
+// Each block carries a header of 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT'
+// bytes recording its size class, and the size of a block, header included,
+// is rounded up to a power of two.  Requests too large for the largest pool
+// (see 'maxPooledBlockSize') are passed, with a header, to the multipool,
+// which serves them from its underlying allocator.  Every block returned by
+// 'allocate' is maximally aligned.
+//
+///Thread Safety
+///-------------
+// 'bdlma::ThreadCachingAllocator' is *fully thread-safe*, meaning that any
+// operation can be called on the *same* object from any number of threads,
+// provided that the allocator supplied at construction is fully thread-safe.
+// The allocator must not be destroyed while another thread is using it or is
+// exiting after having used it.
+//
+// The cache of each thread is found through a thread-specific storage key
+// (see 'bslmt_threadutil') created by the allocator.  Should the platform
+// have no key left to create, the allocator works, but without caching.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Messages in Worker Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that worker threads each build and discard many small messages.  A
+// single 'bdlma::ThreadCachingAllocator' can supply all of them, and blocks
+// freed by a worker are reused by the same worker without synchronization.
+//
+// First, we define a message whose text is held in memory from a supplied
+// allocator:
+//..
+//  class Message {
+//      // This class holds the text of a message.
+//
+//      // DATA
+//      char             *d_text_p;       // text (owned)
+//      bslma::Allocator *d_allocator_p;  // memory allocator (held)
+//
+//    private:
+//      // NOT IMPLEMENTED
+//      Message(const Message&);
+//      Message& operator=(const Message&);
+//
+//    public:
+//      // CREATORS
+//      Message(const char *text, bslma::Allocator *basicAllocator)
+//          // Create a message having a copy of the specified 'text', using
+//          // the specified 'basicAllocator' to supply memory.
+//      : d_allocator_p(basicAllocator)
+//      {
+//          bsl::size_t length = bsl::strlen(text) + 1;
+//          d_text_p = static_cast<char *>(d_allocator_p->allocate(length));
+//          bsl::memcpy(d_text_p, text, length);
+//      }
+//
+//      ~Message()
+//          // Destroy this message.
+//      {
+//          d_allocator_p->deallocate(d_text_p);
+//      }
+//
+//      // ACCESSORS
+//      const char *text() const
+//          // Return the text of this message.
+//      {
+//          return d_text_p;
+//      }
+//  };
+//..
+// Then, we create the allocator that all the workers will share:
+//..
+//  bdlma::ThreadCachingAllocator allocator;
+//..
+// Next, a worker creates and destroys messages.  After the first few
+// iterations every allocation is served from the cache of the thread:
+//..
+//  for (int i = 0; i < 1000; ++i) {
+//      Message message("heartbeat", &allocator);
+//      assert(0 == bsl::strcmp("heartbeat", message.text()));
+//  }
+//..
+// Finally, a worker that is about to sleep for a long time may return its
+// cached blocks so that other threads can use them:
+//..
+//  allocator.flushThreadCache();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_concurrentmultipool.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+class ThreadCachingAllocator_Depot;
+struct ThreadCachingAllocator_Cache;
+
+                        // ============================
+                        // class ThreadCachingAllocator
+                        // ============================
+
+class ThreadCachingAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol to provide a
+    // fully thread-safe allocator that serves blocks from a
+    // 'ConcurrentMultipool' through caches private to each thread.
+
+    // DATA
+    ConcurrentMultipool           d_multipool;           // shared pools and
+                                                         // large blocks
+
+    ThreadCachingAllocator_Depot *d_depots_p;            // one depot per pool
+
+    int                           d_numPools;            // number of pools
+
+    bsls::Types::size_type        d_maxPooledBlockSize;  // largest request
+                                                         // served from a pool
+
+    bslmt::ThreadUtil::Key        d_key;                 // key of the cache of
+                                                         // each thread
+
+    bool                          d_hasKey;              // 'true' if 'd_key'
+                                                         // was created
+
+    // FRIENDS
+    friend struct ThreadCachingAllocator_Cache;
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingAllocator(const ThreadCachingAllocator&);
+    ThreadCachingAllocator& operator=(const ThreadCachingAllocator&);
+
+    // PRIVATE MANIPULATORS
+    void *allocateFromDepot(int                           sizeClass,
+                            ThreadCachingAllocator_Cache *cache);
+        // Return a block of the specified 'sizeClass' taken from the
+        // specified 'cache' after refilling it from the depot, or from the
+        // depot or the multipool if 'cache' is 0.  Create the cache of the
+        // calling thread if 'cache' is 0 and it can be created.
+
+    ThreadCachingAllocator_Cache *createCache();
+        // Create the cache of the calling thread and return its address, or
+        // return 0 if the cache could not be registered.
+
+    void deallocateToDepot(void                         *header,
+                           int                           sizeClass,
+                           ThreadCachingAllocator_Cache *cache);
+        // Return the block having the specified 'header' and 'sizeClass' to
+        // the specified 'cache' after moving a full list of 'cache' to the
+        // depot, or to the multipool if 'cache' is 0 and the cache of the
+        // calling thread cannot be created.
+
+    void initialize();
+        // Create the depots and the thread-specific key of this allocator.
+
+  public:
+    // CREATORS
+    explicit
+    ThreadCachingAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    ThreadCachingAllocator(int numPools, bslma::Allocator *basicAllocator = 0);
+        // Create a thread-caching allocator.  Optionally specify 'numPools',
+        // the number of pools of the underlying 'ConcurrentMultipool', whose
+        // block sizes, headers included, are 8, 16, 32, ... up to
+        // '8 << (numPools - 1)' bytes.  If 'numPools' is not specified, 10
+        // pools are used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '1 <= numPools' and 'basicAllocator' is fully thread-safe.
+
+    virtual ~ThreadCachingAllocator();
+        // Destroy this allocator, releasing all memory allocated through it,
+        // including that held in the caches of threads still running.  The
+        // behavior is undefined if another thread is using this allocator, or
+        // is exiting after having used it.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a maximally-aligned block of memory of at
+        // least the specified 'size' (in bytes).  If 'size' is 0, a null
+        // pointer is returned with no other effect.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to this
+        // allocator.  If 'address' is 0, this function has no effect.  The
+        // behavior is undefined unless 'address' was allocated by this
+        // allocator and has not already been deallocated.
+
+    void flushThreadCache();
+        // Return the blocks held in the cache of the calling thread to the
+        // shared depots, from which any thread may reuse them.  Note that
+        // this is done automatically when a thread exits.
+
+    // ACCESSORS
+    bsls::Types::size_type maxPooledBlockSize() const;
+        // Return the largest request size served from the pools, and hence
+        // cached; larger requests are served by the underlying allocator.
+
+    int numPools() const;
+        // Return the number of pools of the underlying multipool.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class ThreadCachingAllocator
+                        // ----------------------------
+
+// ACCESSORS
+inline
+bsls::Types::size_type ThreadCachingAllocator::maxPooledBlockSize() const
+{
+    return d_maxPooledBlockSize;
+}
+
+inline
+int ThreadCachingAllocator::numPools() const
+{
+    return d_numPools;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
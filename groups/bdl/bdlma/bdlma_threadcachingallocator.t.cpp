@@ -0,0 +1,888 @@
+// bdlma_threadcachingallocator.t.cpp                                 -*-C++-*-
+#include <bdlma_threadcachingallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlma::ThreadCachingAllocator' serves blocks from a per-thread cache in
+// front of a 'bdlma::ConcurrentMultipool'.  The concerns are that every block
+// returned is usable, maximally aligned, and distinct from every other block
+// in use; that blocks freed by a thread are reused by that thread without
+// obtaining more memory; that blocks cached by a thread reach other threads
+// when it exits or flushes its cache, including blocks that it freed on
+// behalf of another thread; that large requests bypass the caches; and that
+// all memory is returned to the underlying allocator on destruction, even if
+// threads holding caches are still running.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingAllocator(Allocator *ba = 0);
+// [ 2] ThreadCachingAllocator(int numPools, Allocator *ba = 0);
+// [ 2] ~ThreadCachingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void flushThreadCache();
+//
+// ACCESSORS
+// [ 2] bsls::Types::size_type maxPooledBlockSize() const;
+// [ 2] int numPools() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: Blocks freed by one thread are reused by other threads.
+// [ 5] CONCERN: The allocator is thread-safe.
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::ThreadCachingAllocator Obj;
+typedef bsls::Types::size_type        size_type;
+
+static const int k_MAX_ALIGNMENT = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                         HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address)
+                                                        % k_MAX_ALIGNMENT;
+}
+
+void fill(void *address, size_type size, unsigned char seed)
+    // Write a pattern derived from the specified 'seed' to the specified
+    // 'size' bytes at the specified 'address'.
+{
+    unsigned char *p = static_cast<unsigned char *>(address);
+    for (size_type i = 0; i < size; ++i) {
+        p[i] = static_cast<unsigned char>(seed + i);
+    }
+}
+
+bool check(const void *address, size_type size, unsigned char seed)
+    // Return 'true' if the specified 'size' bytes at the specified 'address'
+    // hold the pattern written by 'fill' for the specified 'seed', and
+    // 'false' otherwise.
+{
+    const unsigned char *p = static_cast<const unsigned char *>(address);
+    for (size_type i = 0; i < size; ++i) {
+        if (p[i] != static_cast<unsigned char>(seed + i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                            // ===================
+                            // struct ThreadBlocks
+                            // ===================
+
+struct ThreadBlocks {
+    // This 'struct' describes the work of a thread allocating or freeing a
+    // set of blocks.
+
+    Obj                *d_allocator_p;  // allocator under test
+    bsl::vector<void *> *d_blocks_p;    // blocks to allocate or free
+    size_type           d_size;         // size of each block
+    bool                d_flush;        // 'true' if the thread flushes its
+                                        // cache rather than exit to do so
+};
+
+extern "C" void *allocateBlocks(void *arg)
+    // Allocate a block of the size described by the specified 'arg' (the
+    // address of a 'ThreadBlocks') into each element of its vector.
+{
+    ThreadBlocks *work = static_cast<ThreadBlocks *>(arg);
+
+    for (bsl::size_t i = 0; i < work->d_blocks_p->size(); ++i) {
+        (*work->d_blocks_p)[i] = work->d_allocator_p->allocate(work->d_size);
+    }
+    return 0;
+}
+
+extern "C" void *freeBlocks(void *arg)
+    // Free each block of the vector of the specified 'arg' (the address of a
+    // 'ThreadBlocks'), and then flush the cache of the thread if so
+    // described.
+{
+    ThreadBlocks *work = static_cast<ThreadBlocks *>(arg);
+
+    for (bsl::size_t i = 0; i < work->d_blocks_p->size(); ++i) {
+        work->d_allocator_p->deallocate((*work->d_blocks_p)[i]);
+    }
+    if (work->d_flush) {
+        work->d_allocator_p->flushThreadCache();
+    }
+    return 0;
+}
+
+                            // =================
+                            // struct StressTest
+                            // =================
+
+enum { k_STRESS_SLOTS = 64 };
+
+struct StressTest {
+    // This 'struct' describes the shared state of the threads of the stress
+    // test: a table of slots, each owned by one thread at a time, through
+    // which blocks pass between threads.
+
+    Obj            *d_allocator_p;                  // allocator under test
+    bslmt::Barrier *d_barrier_p;                    // starts the threads
+    int             d_numIterations;                // per thread
+    int             d_numThreads;                   // number of threads
+    void           *d_blocks[k_STRESS_SLOTS * 64];  // blocks in flight
+    size_type       d_sizes[k_STRESS_SLOTS * 64];   // sizes of the blocks
+    bsls::AtomicInt d_errors;                       // corrupted blocks found
+    bsls::AtomicInt d_index;                        // next thread index
+};
+
+extern "C" void *stress(void *arg)
+    // Repeatedly free and allocate blocks in slots of the table of the
+    // specified 'arg' (the address of a 'StressTest'), checking the contents
+    // of each block freed.  Each thread starts on its own slots and then
+    // moves to those of the next thread, so that blocks are freed by threads
+    // other than the one that allocated them.
+{
+    StressTest *test  = static_cast<StressTest *>(arg);
+    const int   index = test->d_index++;
+
+    test->d_barrier_p->wait();
+
+    unsigned int seed = 12345u * (index + 1);
+    int          errors = 0;
+
+    for (int round = 0; round < test->d_numThreads; ++round) {
+        const int base = ((index + round) % test->d_numThreads)
+                                                             * k_STRESS_SLOTS;
+
+        for (int i = 0; i < test->d_numIterations; ++i) {
+            seed = seed * 1103515245u + 12345u;
+
+            const int slot = base + static_cast<int>((seed >> 16)
+                                                             % k_STRESS_SLOTS);
+
+            if (test->d_blocks[slot]) {
+                if (!check(test->d_blocks[slot],
+                           test->d_sizes[slot],
+                           static_cast<unsigned char>(slot))) {
+                    ++errors;
+                }
+                test->d_allocator_p->deallocate(test->d_blocks[slot]);
+            }
+
+            const size_type size = 1 + (seed >> 8) % 300;
+            test->d_blocks[slot] = test->d_allocator_p->allocate(size);
+            test->d_sizes[slot]  = size;
+            fill(test->d_blocks[slot], size, static_cast<unsigned char>(slot));
+        }
+
+        test->d_barrier_p->wait();
+    }
+
+    test->d_errors += errors;
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating Messages in Worker Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that worker threads each build and discard many small messages.  A
+// single 'bdlma::ThreadCachingAllocator' can supply all of them, and blocks
+// freed by a worker are reused by the same worker without synchronization.
+//
+// First, we define a message whose text is held in memory from a supplied
+// allocator:
+//..
+    class Message {
+        // This class holds the text of a message.
+
+        // DATA
+        char             *d_text_p;       // text (owned)
+        bslma::Allocator *d_allocator_p;  // memory allocator (held)
+
+      private:
+        // NOT IMPLEMENTED
+        Message(const Message&);
+        Message& operator=(const Message&);
+
+      public:
+        // CREATORS
+        Message(const char *text, bslma::Allocator *basicAllocator)
+            // Create a message having a copy of the specified 'text', using
+            // the specified 'basicAllocator' to supply memory.
+        : d_allocator_p(basicAllocator)
+        {
+            bsl::size_t length = bsl::strlen(text) + 1;
+            d_text_p = static_cast<char *>(d_allocator_p->allocate(length));
+            bsl::memcpy(d_text_p, text, length);
+        }
+
+        ~Message()
+            // Destroy this message.
+        {
+            d_allocator_p->deallocate(d_text_p);
+        }
+
+        // ACCESSORS
+        const char *text() const
+            // Return the text of this message.
+        {
+            return d_text_p;
+        }
+    };
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create the allocator that all the workers will share:
+//..
+    bdlma::ThreadCachingAllocator allocator;
+//..
+// Next, a worker creates and destroys messages.  After the first few
+// iterations every allocation is served from the cache of the thread:
+//..
+    for (int i = 0; i < 1000; ++i) {
+        Message message("heartbeat", &allocator);
+        ASSERT(0 == bsl::strcmp("heartbeat", message.text()));
+    }
+//..
+// Finally, a worker that is about to sleep for a long time may return its
+// cached blocks so that other threads can use them:
+//..
+    allocator.flushThreadCache();
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'allocate' and 'deallocate' never return a
+        //:   block that is in use, whether blocks are freed by the thread that
+        //:   allocated them or by another.
+        //:
+        //: 2 All memory is returned to the underlying allocator when the
+        //:   allocator is destroyed, whether the threads have exited or not.
+        //
+        // Plan:
+        //: 1 Let several threads repeatedly free and reallocate blocks of
+        //:   random sizes held in a shared table, filling each block with a
+        //:   pattern and checking the pattern before freeing it.  After each
+        //:   round, each thread moves to the slots filled by another thread.
+        //:   (C-1)
+        //:
+        //: 2 Free the remaining blocks from the main thread, destroy the
+        //:   allocator, and verify that no memory remains in use.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: The allocator is thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        const int NUM_THREADS[] = { 2, 4, 8 };
+        const int NUM_CONFIGS   = static_cast<int>(sizeof NUM_THREADS
+                                                   / sizeof *NUM_THREADS);
+
+        for (int ti = 0; ti < NUM_CONFIGS; ++ti) {
+            const int THREADS = NUM_THREADS[ti];
+
+            if (veryVerbose) { T_ P(THREADS) }
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj            mX(&ta);
+                bslmt::Barrier barrier(THREADS);
+
+                StressTest test;
+                bsl::memset(test.d_blocks, 0, sizeof test.d_blocks);
+                test.d_allocator_p   = &mX;
+                test.d_barrier_p     = &barrier;
+                test.d_numIterations = 20000;
+                test.d_numThreads    = THREADS;
+
+                bsl::vector<bslmt::ThreadUtil::Handle> handles(THREADS);
+                for (int i = 0; i < THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                          stress,
+                                                          &test));
+                }
+                for (int i = 0; i < THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                }
+                ASSERTV(THREADS, test.d_errors, 0 == test.d_errors);
+
+                for (int i = 0; i < THREADS * k_STRESS_SLOTS; ++i) {
+                    if (test.d_blocks[i]) {
+                        ASSERTV(i, check(test.d_blocks[i],
+                                         test.d_sizes[i],
+                                         static_cast<unsigned char>(i)));
+                        mX.deallocate(test.d_blocks[i]);
+                    }
+                }
+            }
+            ASSERTV(THREADS, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SHARING BLOCKS BETWEEN THREADS
+        //
+        // Concerns:
+        //: 1 The blocks cached by a thread are returned to the depots when the
+        //:   thread exits, and are then reused by other threads.
+        //:
+        //: 2 'flushThreadCache' returns the blocks cached by the calling
+        //:   thread to the depots.
+        //:
+        //: 3 Blocks freed by a thread other than the one that allocated them
+        //:   are reused.
+        //:
+        //: 4 The caches of threads that are still running when the allocator
+        //:   is destroyed are released.
+        //
+        // Plan:
+        //: 1 Allocate blocks in the main thread, free them in another thread
+        //:   that then exits, and allocate the same number of blocks again in
+        //:   the main thread; verify that the underlying allocator supplied no
+        //:   more memory.  (C-1, 3)
+        //:
+        //: 2 Repeat P-1, letting the freeing thread flush its cache instead.
+        //:   (C-2)
+        //:
+        //: 3 Free blocks in the main thread, flush, and allocate them again
+        //:   in another thread.  (C-2)
+        //:
+        //: 4 Destroy an allocator while the main thread holds blocks in its
+        //:   cache, and verify that no memory remains in use.  (C-4)
+        //
+        // Testing:
+        //   void flushThreadCache();
+        //   CONCERN: Blocks freed by one thread are reused by other threads.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SHARING BLOCKS BETWEEN THREADS" << endl
+                          << "==============================" << endl;
+
+        const int       NUM_BLOCKS = 500;
+        const size_type SIZES[]    = { 1, 64, 200, 1000 };
+        const int       NUM_SIZES  = static_cast<int>(sizeof SIZES
+                                                      / sizeof *SIZES);
+
+        if (verbose) cout << "\tFreeing in another thread." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            for (int flush = 0; flush < 2; ++flush) {
+                const size_type SIZE = SIZES[ti];
+
+                bslma::TestAllocator ta("object", veryVeryVerbose);
+                {
+                    Obj mX(&ta);
+
+                    bsl::vector<void *> blocks(NUM_BLOCKS);
+                    ThreadBlocks        work = { &mX, &blocks, SIZE, !!flush };
+
+                    allocateBlocks(&work);
+
+                    const bsls::Types::Int64 NUM_ALLOCATIONS =
+                                                          ta.numBlocksTotal();
+
+                    bslmt::ThreadUtil::Handle handle;
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                          freeBlocks,
+                                                          &work));
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                    // The freeing thread may have allocated its cache, but no
+                    // blocks.
+
+                    const bsls::Types::Int64 NUM_AFTER_FREE =
+                                                          ta.numBlocksTotal();
+                    ASSERTV(SIZE, flush, NUM_AFTER_FREE - NUM_ALLOCATIONS,
+                            NUM_AFTER_FREE - NUM_ALLOCATIONS <= 1);
+
+                    allocateBlocks(&work);
+                    ASSERTV(SIZE, flush,
+                            NUM_AFTER_FREE == ta.numBlocksTotal());
+
+                    freeBlocks(&work);
+                }
+                ASSERTV(SIZE, flush, 0 == ta.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\tAllocating in another thread." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const size_type SIZE = SIZES[ti];
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(&ta);
+
+                bsl::vector<void *> blocks(NUM_BLOCKS);
+                ThreadBlocks        work = { &mX, &blocks, SIZE, true };
+
+                allocateBlocks(&work);
+                freeBlocks(&work);
+
+                const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numBlocksTotal();
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      allocateBlocks,
+                                                      &work));
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                ASSERTV(SIZE, ta.numBlocksTotal() - NUM_ALLOCATIONS,
+                        ta.numBlocksTotal() - NUM_ALLOCATIONS <= 1);
+
+                freeBlocks(&work);
+            }
+            ASSERTV(SIZE, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tDestroying with blocks in a cache." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(&ta);
+
+                bsl::vector<void *> blocks(NUM_BLOCKS);
+                ThreadBlocks        work = { &mX, &blocks, 48, false };
+
+                allocateBlocks(&work);
+                freeBlocks(&work);
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+
+            // A new allocator, whose key may have the same value, must not
+            // find the cache of the destroyed allocator.
+
+            {
+                Obj mX(&ta);
+
+                void *p = mX.allocate(48);
+                ASSERT(p);
+                mX.deallocate(p);
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block of at least the
+        //:   requested size, distinct from every other block in use, for
+        //:   every size, pooled or not.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 A block freed by a thread is returned by the next request of
+        //:   the same size class from that thread, without obtaining memory
+        //:   from the underlying allocator.
+        //:
+        //: 4 A thread that repeatedly allocates and frees many blocks obtains
+        //:   memory from the underlying allocator only while its working set
+        //:   grows.
+        //:
+        //: 5 Requests larger than 'maxPooledBlockSize' are served, and their
+        //:   blocks are returned to the underlying allocator when freed.
+        //
+        // Plan:
+        //: 1 Allocate blocks of every size up to beyond 'maxPooledBlockSize',
+        //:   fill each with a pattern, and verify the alignment and the
+        //:   patterns before freeing them.  (C-1)
+        //:
+        //: 2 Call 'allocate(0)' and 'deallocate(0)'.  (C-2)
+        //:
+        //: 3 Free a block and allocate one of the same size.  (C-3)
+        //:
+        //: 4 Allocate and free a set of blocks repeatedly, and verify that the
+        //:   underlying allocator is not used after the first round.  (C-4)
+        //:
+        //: 5 Allocate a large block and verify the blocks in use of the
+        //:   underlying allocator before and after freeing it.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tAlignment and distinctness." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const size_type MAX_SIZE = X.maxPooledBlockSize() + 100;
+
+            bsl::vector<void *> blocks(&ta);
+            blocks.reserve(MAX_SIZE + 1);
+            for (size_type size = 1; size <= MAX_SIZE; ++size) {
+                void *p = mX.allocate(size);
+                ASSERTV(size, p);
+                ASSERTV(size, isMaximallyAligned(p));
+                fill(p, size, static_cast<unsigned char>(size));
+                blocks.push_back(p);
+            }
+            for (size_type size = 1; size <= MAX_SIZE; ++size) {
+                ASSERTV(size, check(blocks[size - 1],
+                                    size,
+                                    static_cast<unsigned char>(size)));
+                mX.deallocate(blocks[size - 1]);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tZero sizes and null addresses." << endl;
+        {
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+        }
+
+        if (verbose) cout << "\tReuse of freed blocks." << endl;
+        {
+            Obj mX(&ta);
+
+            void *p = mX.allocate(100);
+            mX.deallocate(p);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numBlocksTotal();
+
+            ASSERT(p == mX.allocate(100));
+            ASSERT(NUM_ALLOCATIONS == ta.numBlocksTotal());
+
+            mX.deallocate(p);
+            ASSERT(p == mX.allocate(65));  // same size class
+            mX.deallocate(p);
+        }
+
+        if (verbose) cout << "\tSteady state." << endl;
+        {
+            Obj mX(&ta);
+
+            const int           NUM_BLOCKS = 1000;
+            bsl::vector<void *> blocks(&ta);
+            blocks.resize(NUM_BLOCKS);
+
+            bsls::Types::Int64 numAllocations = 0;
+            for (int round = 0; round < 5; ++round) {
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    blocks[i] = mX.allocate(64 + i % 128);
+                }
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    mX.deallocate(blocks[(i * 7) % NUM_BLOCKS]);
+                }
+                if (0 == round) {
+                    numAllocations = ta.numBlocksTotal();
+                }
+                ASSERTV(round, numAllocations == ta.numBlocksTotal());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tLarge blocks." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const bsls::Types::Int64 NUM_IN_USE = ta.numBlocksInUse();
+
+            void *p = mX.allocate(X.maxPooledBlockSize() + 1);
+            ASSERT(isMaximallyAligned(p));
+            ASSERT(NUM_IN_USE + 1 == ta.numBlocksInUse());
+
+            mX.deallocate(p);
+            ASSERT(NUM_IN_USE == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The allocator uses the supplied allocator, or the default
+        //:   allocator if none is supplied.
+        //:
+        //: 2 'numPools' returns the number of pools supplied, or 10.
+        //:
+        //: 3 'maxPooledBlockSize' is the size of the largest block of the
+        //:   multipool less the size of the header, or 0 if no block is larger
+        //:   than a header.
+        //:
+        //: 4 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 Create allocators with various numbers of pools, allocate from
+        //:   them, and verify the accessors and the memory in use.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   ThreadCachingAllocator(Allocator *ba = 0);
+        //   ThreadCachingAllocator(int numPools, Allocator *ba = 0);
+        //   ~ThreadCachingAllocator();
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        //   int numPools() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(10 == X.numPools());
+            ASSERT(4096 - k_MAX_ALIGNMENT == X.maxPooledBlockSize());
+
+            void *p = mX.allocate(10);
+            mX.deallocate(p);
+            ASSERT(0 < defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        const int NUM_POOLS[] = { 1, 2, 3, 5, 12 };
+        const int NUM_DATA    = static_cast<int>(sizeof NUM_POOLS
+                                                 / sizeof *NUM_POOLS);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int POOLS = NUM_POOLS[ti];
+
+            const size_type LARGEST = static_cast<size_type>(8) << (POOLS - 1);
+            const size_type EXP     = LARGEST > size_type(k_MAX_ALIGNMENT)
+                                    ? LARGEST - k_MAX_ALIGNMENT
+                                    : 0;
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(POOLS, &ta);  const Obj& X = mX;
+
+                ASSERTV(POOLS, POOLS == X.numPools());
+                ASSERTV(POOLS, EXP   == X.maxPooledBlockSize());
+
+                void *p = mX.allocate(1);
+                void *q = mX.allocate(EXP + 1);
+                fill(p, 1, 0);
+                fill(q, EXP + 1, 0);
+                mX.deallocate(p);
+                mX.deallocate(q);
+
+                ASSERTV(POOLS, 0 < ta.numBlocksInUse());
+            }
+            ASSERTV(POOLS, 0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate, write, and free blocks of several sizes.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            void *a = mX.allocate(8);
+            void *b = mX.allocate(100);
+            void *c = mX.allocate(10000);
+
+            ASSERT(a && b && c);
+            ASSERT(a != b);
+
+            bsl::memset(a, 1, 8);
+            bsl::memset(b, 2, 100);
+            bsl::memset(c, 3, 10000);
+
+            mX.deallocate(b);
+            ASSERT(b == mX.allocate(100));
+
+            mX.deallocate(a);
+            mX.deallocate(b);
+            mX.deallocate(c);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
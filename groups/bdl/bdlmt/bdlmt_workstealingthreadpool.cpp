@@ -0,0 +1,808 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_once.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+namespace {
+
+const int k_MAX_BATCH_SIZE = 32;
+    // Maximum number of jobs moved from the injection queue to the deque of a
+    // worker at once.
+
+const int k_NUM_SPINS = 2;
+    // Number of times a worker looks for a job, yielding in between, before
+    // parking.
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void initBlockSet(sigset_t *blockSet)
+{
+    sigfillset(blockSet);
+
+    const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+     #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+      SIGIOT
+     #endif
+    };
+
+    const int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        sigdelset(blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+const bslmt::ThreadUtil::Key& currentWorkerKey()
+    // Return the key of the thread-specific storage holding the address of
+    // the worker executed by the calling thread, if any.
+{
+    static bslmt::ThreadUtil::Key s_key;
+    BSLMT_ONCE_DO {
+        bslmt::ThreadUtil::createKey(&s_key, 0);
+    }
+    return s_key;
+}
+
+}  // close unnamed namespace
+
+                    // ===================================
+                    // struct WorkStealingThreadPool_Worker
+                    // ===================================
+
+struct WorkStealingThreadPool_Worker {
+    // This component-private struct holds the state of a processing thread of
+    // a 'WorkStealingThreadPool'.  All the members but 'd_deque' (which is
+    // designed for concurrent use) and the counters are accessed only by the
+    // processing thread.
+
+    // PUBLIC DATA
+    WorkStealingThreadPool_Deque  d_deque;         // jobs of this worker
+
+    WorkStealingThreadPool       *d_pool_p;        // pool owning this worker
+
+    int                           d_index;         // index of this worker
+
+    unsigned int                  d_randomState;   // state of the generator
+                                                   // choosing steal victims
+
+    bsls::AtomicInt64             d_numSubmitted;  // number of jobs pushed to
+                                                   // 'd_deque' since 'start'
+
+    bsls::AtomicInt64             d_numCompleted;  // number of jobs completed
+                                                   // since 'start'
+
+    bsls::AtomicBool              d_isActive;      // 'true' while a job is
+                                                   // executed
+
+    const char                    d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                                   // padding separating the
+                                                   // data of the workers
+
+    // CREATORS
+    explicit WorkStealingThreadPool_Worker(bslma::Allocator *basicAllocator)
+        // Create a worker.  Use the specified 'basicAllocator' to supply
+        // memory.
+    : d_deque(basicAllocator)
+    , d_pool_p(0)
+    , d_index(0)
+    , d_randomState(0)
+    , d_numSubmitted(0)
+    , d_numCompleted(0)
+    , d_isActive(false)
+    , d_pad()
+    {
+        (void)d_pad;
+    }
+
+    // MANIPULATORS
+    int nextVictim(int numWorkers)
+        // Return a pseudo-random index in the range '[0, numWorkers)'.
+    {
+        // Linear congruential generator: the quality of the sequence is
+        // unimportant, only its low cost.
+
+        d_randomState = d_randomState * 1103515245 + 12345;
+        return static_cast<int>((d_randomState >> 16) % numWorkers);
+    }
+};
+
+                // ----------------------------------------
+                // struct WorkStealingThreadPool_Deque::Array
+                // ----------------------------------------
+
+struct WorkStealingThreadPool_Deque::Array {
+    // This struct holds a circular array of jobs, allocated with a size
+    // depending on its capacity.
+
+    // PUBLIC DATA
+    bsls::Types::Int64        d_capacity;    // number of slots (a power of 2)
+
+    Array                    *d_previous_p;  // array replaced by this one, or
+                                             // 0
+
+    bsls::AtomicPointer<Job>  d_slots[1];    // 'd_capacity' slots
+
+    // CLASS METHODS
+    static Array *create(bsls::Types::Int64  capacity,
+                         Array              *previous,
+                         bslma::Allocator   *allocator)
+        // Return a new array having the specified 'capacity', linked to the
+        // specified 'previous' array, and allocated using the specified
+        // 'allocator'.
+    {
+        Array *array = static_cast<Array *>(allocator->allocate(
+                        sizeof(Array) +
+                        (capacity - 1) * sizeof(bsls::AtomicPointer<Job>)));
+        array->d_capacity   = capacity;
+        array->d_previous_p = previous;
+        for (bsls::Types::Int64 i = 0; i < capacity; ++i) {
+            new (&array->d_slots[i]) bsls::AtomicPointer<Job>(0);
+        }
+        return array;
+    }
+
+    // MANIPULATORS
+    bsls::AtomicPointer<Job>& slot(bsls::Types::Int64 index)
+        // Return a reference providing modifiable access to the slot of this
+        // array holding the job having the specified 'index'.
+    {
+        return d_slots[index & (d_capacity - 1)];
+    }
+};
+
+                    // ----------------------------------
+                    // class WorkStealingThreadPool_Deque
+                    // ----------------------------------
+
+// PRIVATE MANIPULATORS
+WorkStealingThreadPool_Deque::Array *WorkStealingThreadPool_Deque::grow(
+                                                  Array              *array,
+                                                  bsls::Types::Int64  top,
+                                                  bsls::Types::Int64  bottom)
+{
+    Array *newArray = Array::create(array->d_capacity * 2,
+                                    array,
+                                    d_allocator_p);
+    for (bsls::Types::Int64 i = top; i < bottom; ++i) {
+        newArray->slot(i).storeRelaxed(array->slot(i).loadRelaxed());
+    }
+
+    // Thieves loading 'd_bottom' after the job is published observe the new
+    // array.
+
+    d_array_p.storeRelease(newArray);
+    return newArray;
+}
+
+// CREATORS
+WorkStealingThreadPool_Deque::WorkStealingThreadPool_Deque(
+                                              bslma::Allocator *basicAllocator)
+: d_top(0)
+, d_topPad()
+, d_bottom(0)
+, d_array_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    (void)d_topPad;
+
+    d_array_p = Array::create(k_INITIAL_CAPACITY, 0, d_allocator_p);
+}
+
+WorkStealingThreadPool_Deque::~WorkStealingThreadPool_Deque()
+{
+    Array *array = d_array_p;
+    while (array) {
+        Array *previous = array->d_previous_p;
+        d_allocator_p->deallocate(array);
+        array = previous;
+    }
+}
+
+// MANIPULATORS
+WorkStealingThreadPool_Deque::Job *WorkStealingThreadPool_Deque::popBottom()
+{
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed() - 1;
+    Array                    *array = d_array_p.loadRelaxed();
+
+    // The store of 'd_bottom' must be ordered before the load of 'd_top' (the
+    // sequentially consistent operations provide the required fence).
+
+    d_bottom = bottom;
+    const bsls::Types::Int64 top = d_top;
+
+    if (top > bottom) {
+        // The deque was empty.
+
+        d_bottom.storeRelaxed(bottom + 1);
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = array->slot(bottom).loadRelaxed();
+
+    if (top == bottom) {
+        // Last job: race against the thieves.
+
+        if (top != d_top.testAndSwap(top, top + 1)) {
+            job = 0;
+        }
+        d_bottom.storeRelaxed(bottom + 1);
+    }
+    return job;
+}
+
+void WorkStealingThreadPool_Deque::pushBottom(Job *job)
+{
+    BSLS_ASSERT(job);
+
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed();
+    const bsls::Types::Int64 top    = d_top.loadAcquire();
+    Array                    *array = d_array_p.loadRelaxed();
+
+    if (bottom - top >= array->d_capacity) {
+        array = grow(array, top, bottom);
+    }
+
+    array->slot(bottom).storeRelaxed(job);
+    d_bottom.storeRelease(bottom + 1);
+}
+
+WorkStealingThreadPool_Deque::Job *WorkStealingThreadPool_Deque::steal()
+{
+    const bsls::Types::Int64 top    = d_top;
+    const bsls::Types::Int64 bottom = d_bottom;
+
+    if (top >= bottom) {
+        return 0;                                                     // RETURN
+    }
+
+    Array *array = d_array_p.loadAcquire();
+    Job   *job   = array->slot(top).loadRelaxed();
+
+    if (top != d_top.testAndSwap(top, top + 1)) {
+        return 0;                                                     // RETURN
+    }
+    return job;
+}
+
+// ACCESSORS
+bsl::size_t WorkStealingThreadPool_Deque::capacity() const
+{
+    return static_cast<bsl::size_t>(d_array_p.loadAcquire()->d_capacity);
+}
+
+bsl::size_t WorkStealingThreadPool_Deque::size() const
+{
+    const bsls::Types::Int64 bottom = d_bottom;
+    const bsls::Types::Int64 top    = d_top;
+
+    return bottom > top ? static_cast<bsl::size_t>(bottom - top) : 0;
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+void WorkStealingThreadPool::destroyJob(Job *job)
+{
+    d_jobPool.deleteObject(job);
+}
+
+void WorkStealingThreadPool::drainImp()
+{
+    // Workers signal 'd_drainCondition' when they become idle while
+    // 'd_numDrainWaiters' is not 0.  Incrementing 'd_numDrainWaiters' before
+    // checking for quiescence guarantees that the worker completing the last
+    // job either is observed by 'isQuiescent' or observes the waiter.
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_drainMutex);
+
+    d_numDrainWaiters.add(1);
+    while (!isQuiescent()) {
+        d_drainCondition.wait(&d_drainMutex);
+    }
+    d_numDrainWaiters.add(-1);
+}
+
+int WorkStealingThreadPool::enqueueJobImp(Job *job)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_enabled)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        destroyJob(job);
+        return -1;                                                    // RETURN
+    }
+
+    Worker *worker = static_cast<Worker *>(
+                      bslmt::ThreadUtil::getSpecific(currentWorkerKey()));
+
+    // The job is counted as submitted before it can be taken by a worker
+    // (the injection queue is protected by 'd_injectionMutex'), so that the
+    // number of completed jobs never exceeds the number of submitted jobs.
+
+    if (worker && this == worker->d_pool_p) {
+        worker->d_numSubmitted.add(1);
+        worker->d_deque.pushBottom(job);
+    }
+    else {
+        bslma::RawDeleterProctor<Job, bdlma::ConcurrentPool> proctor(
+                                                                  job,
+                                                                  &d_jobPool);
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_injectionMutex);
+
+        d_injectionQueue.push_back(job);
+        proctor.release();
+
+        d_numInjected.add(1);
+        d_injectionSize.add(1);
+    }
+
+    wakeWorker();
+
+    return 0;
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::findJob(Worker *worker)
+{
+    Job *job = worker->d_deque.popBottom();
+    if (job) {
+        return job;                                                   // RETURN
+    }
+
+    job = takeInjectedJobs(worker);
+    if (job) {
+        return job;                                                   // RETURN
+    }
+
+    // Steal from the other workers, starting at a random victim.
+
+    if (1 < d_numThreads) {
+        const int start = worker->nextVictim(d_numThreads);
+        for (int i = 0; i < d_numThreads; ++i) {
+            const int victim = (start + i) % d_numThreads;
+            if (victim == worker->d_index) {
+                continue;
+            }
+            job = d_workers_p[victim].d_deque.steal();
+            if (job) {
+                return job;                                           // RETURN
+            }
+        }
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::init()
+{
+    d_workers_p = static_cast<Worker *>(
+                     d_allocator_p->allocate(d_numThreads * sizeof(Worker)));
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        Worker *worker = new (d_workers_p + i) Worker(d_allocator_p);
+
+        worker->d_pool_p      = this;
+        worker->d_index       = i;
+        worker->d_randomState = static_cast<unsigned int>(i) * 2654435761U + 1;
+    }
+
+    disable();
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+}
+
+void WorkStealingThreadPool::park()
+{
+    // Register as idle, then look for pending jobs again: a job enqueued
+    // concurrently either is observed here, or its producer observes the
+    // registration and posts the semaphore.
+
+    d_numIdle.add(1);
+
+    if (hasPendingJobs() || d_stopping) {
+        // Try to withdraw the registration.  If a producer has claimed it
+        // already, consume the corresponding 'post'.
+
+        int numIdle = d_numIdle;
+        while (0 < numIdle) {
+            const int previous = d_numIdle.testAndSwap(numIdle, numIdle - 1);
+            if (previous == numIdle) {
+                return;                                               // RETURN
+            }
+            numIdle = previous;
+        }
+        d_idleSemaphore.wait();
+        return;                                                       // RETURN
+    }
+
+    if (d_numDrainWaiters) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_drainMutex);
+        d_drainCondition.broadcast();
+    }
+
+    d_idleSemaphore.wait();
+}
+
+void WorkStealingThreadPool::removeAllJobs()
+{
+    for (int i = 0; i < d_numThreads; ++i) {
+        while (Job *job = d_workers_p[i].d_deque.popBottom()) {
+            destroyJob(job);
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_injectionMutex);
+
+    for (bsl::size_t i = 0; i < d_injectionQueue.size(); ++i) {
+        destroyJob(d_injectionQueue[i]);
+    }
+    d_injectionQueue.clear();
+    d_injectionSize = 0;
+}
+
+int WorkStealingThreadPool::startNewThread(Worker *worker)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = d_threadGroup.addThread(
+                   bdlf::BindUtil::bind(&WorkStealingThreadPool::workerThread,
+                                        this,
+                                        worker),
+                   d_threadAttributes);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    return rc;
+}
+
+void WorkStealingThreadPool::stopWorkers()
+{
+    d_stopping = true;
+
+    // Wake up every worker, whether parked or about to park.
+
+    d_idleSemaphore.post(d_numThreads);
+
+    d_threadGroup.joinAll();
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::takeInjectedJobs(
+                                                                Worker *worker)
+{
+    if (0 == d_injectionSize) {
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_injectionMutex);
+
+    if (d_injectionQueue.empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    // Take a share of the queue, so that the other idle workers find jobs in
+    // the injection queue as well, and push all but the first job to the
+    // deque of 'worker', from which they can be stolen.
+
+    const int size    = static_cast<int>(d_injectionQueue.size());
+    int       numJobs = size / d_numThreads + 1;
+    if (numJobs > size) {
+        numJobs = size;
+    }
+    if (numJobs > k_MAX_BATCH_SIZE) {
+        numJobs = k_MAX_BATCH_SIZE;
+    }
+
+    Job *job = d_injectionQueue.front();
+    d_injectionQueue.pop_front();
+
+    for (int i = 1; i < numJobs; ++i) {
+        worker->d_deque.pushBottom(d_injectionQueue.front());
+        d_injectionQueue.pop_front();
+    }
+
+    // The jobs moved to the deque remain counted in 'd_numInjected'.
+
+    d_injectionSize.add(-numJobs);
+
+    return job;
+}
+
+void WorkStealingThreadPool::wakeWorker()
+{
+    // Claim an idle worker, if any, and post the semaphore on its behalf.
+    // Note that the load of 'd_numIdle' is ordered after the publication of
+    // the job.
+
+    int numIdle = d_numIdle;
+    while (0 < numIdle) {
+        const int previous = d_numIdle.testAndSwap(numIdle, numIdle - 1);
+        if (previous == numIdle) {
+            d_idleSemaphore.post();
+            return;                                                   // RETURN
+        }
+        numIdle = previous;
+    }
+}
+
+void WorkStealingThreadPool::workerThread(Worker *worker)
+{
+    bslmt::ThreadUtil::setSpecific(currentWorkerKey(), worker);
+
+    while (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!d_stopping.loadRelaxed())) {
+        Job *job = findJob(worker);
+
+        for (int i = 0; !job && i < k_NUM_SPINS; ++i) {
+            bslmt::ThreadUtil::yield();
+            job = findJob(worker);
+        }
+
+        if (job) {
+            worker->d_isActive.storeRelaxed(true);
+            (*job)();
+            destroyJob(job);
+            worker->d_isActive.storeRelaxed(false);
+
+            worker->d_numCompleted.add(1);
+        }
+        else {
+            park();
+        }
+    }
+
+    bslmt::ThreadUtil::setSpecific(currentWorkerKey(), 0);
+}
+
+// PRIVATE ACCESSORS
+bool WorkStealingThreadPool::hasPendingJobs() const
+{
+    if (d_injectionSize) {
+        return true;                                                  // RETURN
+    }
+    for (int i = 0; i < d_numThreads; ++i) {
+        if (d_workers_p[i].d_deque.size()) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+bool WorkStealingThreadPool::isQuiescent() const
+{
+    // The completed jobs are counted before the submitted jobs: as both
+    // counts only increase and a job is counted as submitted before it is
+    // completed, equal counts imply that, at some point between the two
+    // loops, every submitted job was complete.
+
+    bsls::Types::Int64 numCompleted = 0;
+    for (int i = 0; i < d_numThreads; ++i) {
+        numCompleted += d_workers_p[i].d_numCompleted;
+    }
+
+    bsls::Types::Int64 numSubmitted = d_numInjected;
+    for (int i = 0; i < d_numThreads; ++i) {
+        numSubmitted += d_workers_p[i].d_numSubmitted;
+    }
+
+    return numCompleted == numSubmitted;
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                              int               numThreads,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_jobPool(sizeof(Job), basicAllocator)
+, d_workers_p(0)
+, d_injectionQueue(basicAllocator)
+, d_injectionSize(0)
+, d_numInjected(0)
+, d_idleSemaphore()
+, d_numIdle(0)
+, d_numDrainWaiters(0)
+, d_enabled(false)
+, d_stopping(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_numThreads(numThreads)
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+
+    init();
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                              const bslmt::ThreadAttributes&  threadAttributes,
+                              int                             numThreads,
+                              bslma::Allocator               *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_jobPool(sizeof(Job), basicAllocator)
+, d_workers_p(0)
+, d_injectionQueue(basicAllocator)
+, d_injectionSize(0)
+, d_numInjected(0)
+, d_idleSemaphore()
+, d_numIdle(0)
+, d_numDrainWaiters(0)
+, d_enabled(false)
+, d_stopping(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+
+    init();
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_workers_p[i].~Worker();
+    }
+    d_allocator_p->deallocate(d_workers_p);
+}
+
+// MANIPULATORS
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    BSLS_ASSERT(functor);
+
+    return enqueueJobImp(new (d_jobPool) Job(bsl::allocator_arg,
+                                             d_allocator_p,
+                                             functor));
+}
+
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
+
+    return enqueueJobImp(new (d_jobPool) Job(
+                                        bsl::allocator_arg,
+                                        d_allocator_p,
+                                        bslmf::MovableRefUtil::move(functor)));
+}
+
+int WorkStealingThreadPool::enqueueJob(WorkStealingThreadPoolJobFunc  function,
+                                       void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        drainImp();
+    }
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        disable();
+        stopWorkers();
+        removeAllJobs();
+    }
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        return 0;                                                     // RETURN
+    }
+
+    // No job can be enqueued while the pool is stopped, and no worker is
+    // running: reset the state left by a previous 'stop' or 'shutdown'.
+
+    d_stopping = false;
+    d_numIdle  = 0;
+    d_idleSemaphore.takeAll();
+    d_numInjected = 0;
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_workers_p[i].d_numSubmitted = 0;
+        d_workers_p[i].d_numCompleted = 0;
+    }
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        if (0 != startNewThread(d_workers_p + i)) {
+            stopWorkers();
+            return -1;                                                // RETURN
+        }
+    }
+
+    enable();
+
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        disable();
+        drainImp();
+        stopWorkers();
+    }
+}
+
+// ACCESSORS
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    int numActive = 0;
+    for (int i = 0; i < d_numThreads; ++i) {
+        numActive += d_workers_p[i].d_isActive.loadRelaxed();
+    }
+    return numActive;
+}
+
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    bsl::size_t numJobs = d_injectionSize;
+    for (int i = 0; i < d_numThreads; ++i) {
+        numJobs += d_workers_p[i].d_deque.size();
+    }
+    return static_cast<int>(numJobs);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,651 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size pool of threads using work stealing.
+//
+//@CLASSES:
+//  bdlmt::WorkStealingThreadPool: fixed-size work-stealing thread pool
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that executes user-defined functions
+// ("jobs") on a fixed number of processing threads.  The interface of
+// 'bdlmt::WorkStealingThreadPool' follows that of 'bdlmt::FixedThreadPool'
+// ('enqueueJob', 'tryEnqueueJob', 'drain', 'stop', 'shutdown', etc.), so that
+// one may be substituted for the other, but the distribution of jobs among the
+// threads is designed for workloads consisting of a large number of short
+// jobs, and in particular of jobs that themselves enqueue other jobs.
+//
+// 'bdlmt::FixedThreadPool' and 'bdlmt::ThreadPool' dispatch every job through
+// a single queue shared by all threads, which, when jobs are short, becomes a
+// point of contention limiting the throughput of the pool regardless of the
+// number of threads.  In contrast, each thread of a
+// 'bdlmt::WorkStealingThreadPool' (a "worker") owns a double-ended queue of
+// jobs (a Chase-Lev deque):
+//
+//: o A job enqueued by a job running on a worker is pushed, without any lock,
+//:   at the bottom of the deque of that worker.
+//:
+//: o A worker takes jobs from the bottom of its own deque (i.e., in LIFO
+//:   order), which favors cache locality, for example when recursively
+//:   splitting a problem into smaller jobs.
+//:
+//: o A worker whose deque is empty "steals" a job from the top of the deque
+//:   (i.e., the oldest job) of another worker chosen at random.
+//:
+//: o A job enqueued by a thread that is not a worker of the pool is appended
+//:   to a shared injection queue, from which idle workers take jobs in
+//:   batches.
+//:
+//: o A worker that does not find any job parks on a semaphore, and is woken up
+//:   when a job is enqueued.
+//
+// As a consequence, unlike 'bdlmt::FixedThreadPool', the pool does not
+// execute jobs in the order in which they were enqueued, and the number of
+// pending jobs is not bounded (i.e., 'enqueueJob' never blocks).
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.  Note that 'drain',
+// 'stop', and 'shutdown' must not be called from a job executed by the pool.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As for 'bdlmt::FixedThreadPool', on Unix platforms all the threads in the
+// pool block all asynchronous signals; only the synchronous signals 'SIGBUS',
+// 'SIGFPE', 'SIGILL', 'SIGSEGV', 'SIGSYS', 'SIGABRT', 'SIGTRAP', and 'SIGIOT'
+// are not blocked.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Parallel Sum
+///- - - - - - - - - - - - - - - - -
+// In this example, we compute the sum of the elements of an array by
+// recursively splitting the array into halves, each half being summed by a
+// separate job.  Jobs enqueued by jobs are pushed to the deque of the worker
+// executing them, and are taken by idle workers through work stealing.
+//
+// First, we define a function object, 'SumJob', summing a range of an array
+// into an atomic accumulator and splitting large ranges into two jobs:
+//..
+//  class SumJob {
+//      // This class sums the elements of a range of an array, splitting the
+//      // range into two jobs if it is larger than a threshold.
+//
+//      // DATA
+//      bdlmt::WorkStealingThreadPool *d_pool_p;    // pool executing the job
+//      const int                     *d_begin_p;   // beginning of the range
+//      const int                     *d_end_p;     // end of the range
+//      bsls::AtomicInt64             *d_result_p;  // accumulated sum
+//
+//    public:
+//      // CREATORS
+//      SumJob(bdlmt::WorkStealingThreadPool *pool,
+//             const int                     *begin,
+//             const int                     *end,
+//             bsls::AtomicInt64             *result)
+//      : d_pool_p(pool)
+//      , d_begin_p(begin)
+//      , d_end_p(end)
+//      , d_result_p(result)
+//      {
+//      }
+//
+//      // ACCESSORS
+//      void operator()() const
+//      {
+//          if (d_end_p - d_begin_p > 1024) {
+//              const int *middle = d_begin_p + (d_end_p - d_begin_p) / 2;
+//              d_pool_p->enqueueJob(
+//                           SumJob(d_pool_p, d_begin_p, middle, d_result_p));
+//              d_pool_p->enqueueJob(
+//                           SumJob(d_pool_p, middle, d_end_p, d_result_p));
+//              return;                                               // RETURN
+//          }
+//
+//          bsls::Types::Int64 sum = 0;
+//          for (const int *p = d_begin_p; p != d_end_p; ++p) {
+//              sum += *p;
+//          }
+//          d_result_p->add(sum);
+//      }
+//  };
+//..
+// Then, we create and start a pool of 4 threads:
+//..
+//  bdlmt::WorkStealingThreadPool pool(4);
+//  int                           rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we create the array to be summed:
+//..
+//  bsl::vector<int> values(100000);
+//  for (int i = 0; i < 100000; ++i) {
+//      values[i] = i;
+//  }
+//..
+// Now, we enqueue the job summing the whole array, and wait until all the jobs
+// (including the ones enqueued by the jobs) are complete:
+//..
+//  bsls::AtomicInt64 result(0);
+//
+//  rc = pool.enqueueJob(SumJob(&pool,
+//                              values.data(),
+//                              values.data() + values.size(),
+//                              &result));
+//  assert(0 == rc);
+//
+//  pool.drain();
+//..
+// Finally, we verify the result and stop the pool:
+//..
+//  assert(4999950000LL == result);
+//
+//  pool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_fastpostsemaphore.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+struct WorkStealingThreadPool_Worker;
+
+                    // ==================================
+                    // class WorkStealingThreadPool_Deque
+                    // ==================================
+
+class WorkStealingThreadPool_Deque {
+    // This component-private class implements an unbounded Chase-Lev
+    // work-stealing deque of pointers to jobs.  A single thread (the "owner")
+    // may call 'pushBottom' and 'popBottom', while any thread may call 'steal'
+    // and 'size' concurrently.  The circular array holding the jobs is grown
+    // by the owner when it is full; arrays that are replaced are retained
+    // until the deque is destroyed, as they may still be read by concurrent
+    // calls to 'steal'.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    struct Array;
+
+    enum {
+        k_TOP_PADDING = bslmt::Platform::e_CACHE_LINE_SIZE -
+                                                     sizeof(bsls::AtomicInt64)
+    };
+
+    // DATA
+    bsls::AtomicInt64           d_top;          // index of the oldest job,
+                                                // advanced by 'steal' and the
+                                                // last 'popBottom'
+
+    const char                  d_topPad[k_TOP_PADDING];
+                                                // padding separating the
+                                                // index modified by thieves
+                                                // from the data of the owner
+
+    bsls::AtomicInt64           d_bottom;       // index one past the newest
+                                                // job
+
+    bsls::AtomicPointer<Array>  d_array_p;      // current circular array
+
+    bslma::Allocator           *d_allocator_p;  // memory allocator (held, not
+                                                // owned)
+
+    // PRIVATE MANIPULATORS
+    Array *grow(Array              *array,
+                bsls::Types::Int64  top,
+                bsls::Types::Int64  bottom);
+        // Create an array having twice the capacity of the specified 'array',
+        // copy to it the jobs having indices in the range '[top, bottom)',
+        // make it the current array of this deque, and return it.
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool_Deque(const WorkStealingThreadPool_Deque&);
+    WorkStealingThreadPool_Deque& operator=(
+                                          const WorkStealingThreadPool_Deque&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool_Deque,
+                                   bslma::UsesBslmaAllocator);
+
+    // PUBLIC CONSTANTS
+    enum { k_INITIAL_CAPACITY = 256 };  // capacity of the initial array
+
+    // CREATORS
+    explicit
+    WorkStealingThreadPool_Deque(bslma::Allocator *basicAllocator = 0);
+        // Create an empty deque.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~WorkStealingThreadPool_Deque();
+        // Destroy this deque.  Note that the jobs remaining in the deque, if
+        // any, are not destroyed.
+
+    // MANIPULATORS
+    Job *popBottom();
+        // Remove the newest job from this deque and return it, or return 0 if
+        // this deque is empty.  The behavior is undefined unless this method
+        // is called by the owner of this deque.
+
+    void pushBottom(Job *job);
+        // Append the specified 'job' to this deque.  The behavior is undefined
+        // unless 'job' is not 0 and this method is called by the owner of this
+        // deque.
+
+    Job *steal();
+        // Remove the oldest job from this deque and return it, or return 0 if
+        // this deque is empty or if the job was concurrently removed by
+        // another thread.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the capacity of the current array of this deque.
+
+    bsl::size_t size() const;
+        // Return a snapshot of the number of jobs in this deque.
+};
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a thread pool executing user-defined functions
+    // ("jobs") on a fixed number of threads, using per-thread deques and work
+    // stealing to distribute the jobs.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Worker Worker;
+
+    // DATA
+    bslma::Allocator         *d_allocator_p;       // memory allocator (held,
+                                                   // not owned)
+
+    bdlma::ConcurrentPool     d_jobPool;           // pool of the nodes holding
+                                                   // the enqueued jobs
+
+    Worker                   *d_workers_p;         // array of 'd_numThreads'
+                                                   // workers (owned)
+
+    bslmt::Mutex              d_injectionMutex;    // mutex protecting
+                                                   // 'd_injectionQueue'
+
+    bsl::deque<Job *>         d_injectionQueue;    // jobs enqueued by threads
+                                                   // other than the workers
+
+    bsls::AtomicInt           d_injectionSize;     // number of jobs in
+                                                   // 'd_injectionQueue'
+
+    bsls::AtomicInt64         d_numInjected;       // number of jobs enqueued
+                                                   // in 'd_injectionQueue'
+                                                   // since 'start'
+
+    bslmt::FastPostSemaphore  d_idleSemaphore;     // semaphore on which idle
+                                                   // workers park
+
+    bsls::AtomicInt           d_numIdle;           // number of workers parked,
+                                                   // or about to park, and not
+                                                   // yet claimed by a 'post'
+
+    bslmt::Mutex              d_drainMutex;        // mutex used with
+                                                   // 'd_drainCondition'
+
+    bslmt::Condition          d_drainCondition;    // condition signaled by
+                                                   // idle workers when a
+                                                   // thread is in 'drain'
+
+    bsls::AtomicInt           d_numDrainWaiters;   // number of threads in
+                                                   // 'drain'
+
+    bsls::AtomicBool          d_enabled;           // 'true' if enqueuing is
+                                                   // enabled
+
+    bsls::AtomicBool          d_stopping;          // 'true' if the workers
+                                                   // must exit
+
+    bslmt::Mutex              d_metaMutex;         // mutex ensuring that there
+                                                   // is only one controlling
+                                                   // thread at any time
+
+    bslmt::ThreadGroup        d_threadGroup;       // threads used by this pool
+
+    bslmt::ThreadAttributes   d_threadAttributes;  // attributes of the
+                                                   // processing threads
+
+    const int                 d_numThreads;        // number of configured
+                                                   // processing threads
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                  d_blockSet;          // set of signals to be
+                                                   // blocked in managed
+                                                   // threads
+#endif
+
+    // PRIVATE MANIPULATORS
+    void destroyJob(Job *job);
+        // Destroy the specified 'job' and return its node to the job pool.
+
+    void drainImp();
+        // Wait until all the jobs enqueued since 'start' are complete.
+
+    int enqueueJobImp(Job *job);
+        // Enqueue the specified 'job', allocated from the job pool, to be
+        // executed by the next available thread.  Return 0 if enqueued
+        // successfully, and a non-zero value, after destroying 'job', if
+        // queuing is currently disabled.
+
+    Job *findJob(Worker *worker);
+        // Return a job taken, for the specified 'worker', from its deque, the
+        // injection queue, or the deque of another worker, or return 0 if no
+        // job was found.
+
+    void init();
+        // Initialize the workers and the signal mask of this thread pool.
+        // Note that this method is used by the constructors.
+
+    void park();
+        // Block the calling worker until a job is enqueued or the pool is
+        // stopping, unless a job is found after registering the worker as
+        // idle.
+
+    void removeAllJobs();
+        // Destroy all the jobs remaining in the deques and the injection
+        // queue.  The behavior is undefined unless no worker thread is
+        // running.
+
+    int startNewThread(Worker *worker);
+        // Spawn the processing thread of the specified 'worker'.  Return 0 on
+        // success, and a non-zero value otherwise.
+
+    void stopWorkers();
+        // Make the workers exit and join all processing threads.
+
+    Job *takeInjectedJobs(Worker *worker);
+        // Move a batch of the jobs in the injection queue to the deque of the
+        // specified 'worker', and return another job of the batch, or return
+        // 0 if the injection queue is empty.
+
+    void wakeWorker();
+        // If a worker is idle, claim it and wake it up.
+
+    void workerThread(Worker *worker);
+        // The main function executed by the thread of the specified 'worker'.
+
+    // PRIVATE ACCESSORS
+    bool hasPendingJobs() const;
+        // Return 'true' if a job is in the injection queue or in the deque of
+        // a worker, and 'false' otherwise.
+
+    bool isQuiescent() const;
+        // Return 'true' if all the jobs enqueued since 'start' are complete,
+        // and 'false' otherwise.
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit WorkStealingThreadPool(int               numThreads,
+                                    bslma::Allocator *basicAllocator = 0);
+        // Construct a thread pool with the specified 'numThreads' number of
+        // threads.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '1 <= numThreads'.
+
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           bslma::Allocator               *basicAllocator = 0);
+        // Construct a thread pool with the specified 'threadAttributes' and
+        // 'numThreads' number of threads.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numThreads'.
+
+    ~WorkStealingThreadPool();
+        // Remove all pending jobs without executing them, block until all
+        // currently running jobs complete, and then destroy this thread pool.
+
+    // MANIPULATORS
+    void disable();
+        // Disable queuing into this pool.  Subsequent calls to 'enqueueJob'
+        // or 'tryEnqueueJob' will immediately fail.  Note that this method has
+        // no effect on jobs currently in the pool.
+
+    void enable();
+        // Enable queuing into this pool.
+
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' to be executed by the next available
+        // thread.  Return 0 if enqueued successfully, and a non-zero value if
+        // queuing is currently disabled.  If this method is called by a job
+        // executed by this pool, 'functor' is pushed to the deque of the
+        // calling thread.  The behavior is undefined unless 'functor' is not
+        // "unset".
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by the next
+        // available thread.  The specified 'userData' pointer will be passed
+        // to the function by the processing thread.  Return 0 if enqueued
+        // successfully, and a non-zero value if queuing is currently disabled.
+
+    int tryEnqueueJob(const Job& functor);
+    int tryEnqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' to be executed by the next available
+        // thread.  Return 0 if enqueued successfully, and a non-zero value if
+        // queuing is currently disabled.  The behavior is undefined unless
+        // 'functor' is not "unset".  Note that, as the number of pending jobs
+        // is not bounded, this method is equivalent to 'enqueueJob', and is
+        // provided for compatibility with 'bdlmt::FixedThreadPool'.
+
+    int tryEnqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by the next
+        // available thread.  The specified 'userData' pointer will be passed
+        // to the function by the processing thread.  Return 0 if enqueued
+        // successfully, and a non-zero value if queuing is currently disabled.
+
+    void drain();
+        // Wait until all pending jobs complete, including the jobs enqueued by
+        // these jobs.  Note that if any jobs are submitted concurrently with
+        // this method by other threads, this method may or may not wait until
+        // they have also completed.
+
+    void shutdown();
+        // Disable queuing on this thread pool, cancel all queued jobs, and
+        // after all active jobs have completed, join all processing threads.
+
+    int start();
+        // Spawn 'numThreads()' processing threads.  On success, enable
+        // enqueuing and return 0.  Return a non-zero value otherwise.  If
+        // 'numThreads()' threads were not successfully started, all threads
+        // are stopped.
+
+    void stop();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // complete, then shut down all processing threads.
+
+    // ACCESSORS
+    bool isEnabled() const;
+        // Return 'true' if queuing is enabled on this thread pool, and 'false'
+        // otherwise.
+
+    bool isStarted() const;
+        // Return 'true' if 'numThreads()' are started on this thread pool and
+        // 'false' otherwise (indicating that 0 threads are started on this
+        // thread pool).
+
+    int numActiveThreads() const;
+        // Return a snapshot of the number of threads that are currently
+        // processing a job for this thread pool.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs currently enqueued to be
+        // processed by this thread pool.
+
+    int numThreads() const;
+        // Return the number of threads passed to this thread pool at
+        // construction.
+
+    int numThreadsStarted() const;
+        // Return a snapshot of the number of threads currently started by this
+        // thread pool.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+void WorkStealingThreadPool::disable()
+{
+    d_enabled = false;
+}
+
+inline
+void WorkStealingThreadPool::enable()
+{
+    d_enabled = true;
+}
+
+inline
+int WorkStealingThreadPool::tryEnqueueJob(const Job& functor)
+{
+    return enqueueJob(functor);
+}
+
+inline
+int WorkStealingThreadPool::tryEnqueueJob(bslmf::MovableRef<Job> functor)
+{
+    return enqueueJob(bslmf::MovableRefUtil::move(functor));
+}
+
+inline
+int WorkStealingThreadPool::tryEnqueueJob(
+                                       WorkStealingThreadPoolJobFunc  function,
+                                       void                          *userData)
+{
+    return enqueueJob(function, userData);
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    return d_enabled;
+}
+
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return d_numThreads == d_threadGroup.numThreads();
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_threadGroup.numThreads();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *WorkStealingThreadPool::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
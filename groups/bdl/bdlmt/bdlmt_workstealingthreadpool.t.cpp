@@ -0,0 +1,1257 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_semaphore.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', whose workers each own a Chase-Lev deque,
+// implemented by the component-private class
+// 'bdlmt::WorkStealingThreadPool_Deque'.  We first
+// test the deque in isolation, single-threaded (LIFO 'popBottom', FIFO
+// 'steal', growth, use of the allocator) and with concurrent thieves (every
+// job is removed exactly once).  We then test the life cycle of the pool
+// ('start', 'stop', 'shutdown', 'enable', 'disable'), the execution of the
+// jobs enqueued by external threads and by the jobs themselves, and 'drain'.
+//
+// In addition to the positive test cases, the negative test case -1 compares
+// the throughput of 'bdlmt::WorkStealingThreadPool' with that of
+// 'bdlmt::FixedThreadPool' for jobs of various durations.
+// ----------------------------------------------------------------------------
+// WorkStealingThreadPool_Deque
+// [ 2] explicit WorkStealingThreadPool_Deque(bslma::Allocator *);
+// [ 2] ~WorkStealingThreadPool_Deque();
+// [ 2] Job *popBottom();
+// [ 2] void pushBottom(Job *job);
+// [ 2] Job *steal();
+// [ 2] bsl::size_t capacity() const;
+// [ 2] bsl::size_t size() const;
+//
+// WorkStealingThreadPool
+// CREATORS
+// [ 4] WorkStealingThreadPool(int numThreads, bslma::Allocator *);
+// [ 4] WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+// [ 7] ~WorkStealingThreadPool();
+//
+// MANIPULATORS
+// [ 4] void disable();
+// [ 4] void enable();
+// [ 5] int enqueueJob(const Job& functor);
+// [ 5] int enqueueJob(bslmf::MovableRef<Job> functor);
+// [ 5] int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 5] int tryEnqueueJob(const Job& functor);
+// [ 5] int tryEnqueueJob(bslmf::MovableRef<Job> functor);
+// [ 5] int tryEnqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 5] void drain();
+// [ 7] void shutdown();
+// [ 4] int start();
+// [ 4] void stop();
+//
+// ACCESSORS
+// [ 4] bool isEnabled() const;
+// [ 4] bool isStarted() const;
+// [ 7] int numActiveThreads() const;
+// [ 5] int numPendingJobs() const;
+// [ 4] int numThreads() const;
+// [ 4] int numThreadsStarted() const;
+// [ 4] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCURRENT 'steal' AND 'popBottom'
+// [ 6] JOBS ENQUEUING JOBS
+// [ 8] USAGE EXAMPLE
+// [-1] THROUGHPUT: 'WorkStealingThreadPool' VS 'FixedThreadPool'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlmt::WorkStealingThreadPool       Obj;
+typedef bdlmt::WorkStealingThreadPool_Deque Deque;
+typedef Obj::Job                            Job;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+extern "C" void incrementCounter(void *counter)
+    // Increment the 'bsls::AtomicInt' at the specified 'counter' address.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+struct Counter {
+    // Job incrementing a shared counter.
+
+    bsls::AtomicInt *d_count_p;
+
+    void operator()() const
+        // Increment '*d_count_p'.
+    {
+        ++*d_count_p;
+    }
+};
+
+class SpawnJob {
+    // Job that, if its depth is positive, enqueues two jobs of a lower depth
+    // in the pool executing it, and otherwise increments a counter of leaves.
+
+    // DATA
+    Obj             *d_pool_p;
+    int              d_depth;
+    bsls::AtomicInt *d_numLeaves_p;
+
+  public:
+    // CREATORS
+    SpawnJob(Obj *pool, int depth, bsls::AtomicInt *numLeaves)
+        // Create a job of the specified 'depth' enqueuing jobs in the
+        // specified 'pool' and counting leaves in the specified 'numLeaves'.
+    : d_pool_p(pool)
+    , d_depth(depth)
+    , d_numLeaves_p(numLeaves)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Enqueue two jobs of a lower depth or, if the depth of this job is
+        // 0, increment the counter of leaves.
+    {
+        if (0 == d_depth) {
+            ++*d_numLeaves_p;
+            return;                                                   // RETURN
+        }
+        int rc = d_pool_p->enqueueJob(
+                           SpawnJob(d_pool_p, d_depth - 1, d_numLeaves_p));
+        ASSERTV(d_depth, 0 == rc);
+        rc = d_pool_p->enqueueJob(
+                           SpawnJob(d_pool_p, d_depth - 1, d_numLeaves_p));
+        ASSERTV(d_depth, 0 == rc);
+    }
+};
+
+void waitForRelease(bslmt::Semaphore *started,
+                    bslmt::Semaphore *release,
+                    bsls::AtomicInt  *numCompleted)
+    // Post the specified 'started' semaphore, wait on the specified 'release'
+    // semaphore, and increment the specified 'numCompleted'.
+{
+    started->post();
+    release->wait();
+    ++*numCompleted;
+}
+
+void releaseAfterDelay(bslmt::Semaphore *release)
+    // Post the specified 'release' semaphore after a delay giving the thread
+    // controlling a pool the time to stop its workers.
+{
+    bslmt::ThreadUtil::microSleep(100000);
+    release->post();
+}
+
+void enqueueCounters(Obj *pool, bsls::AtomicInt *counter, int numJobs)
+    // Enqueue the specified 'numJobs' jobs incrementing the specified
+    // 'counter' in the specified 'pool'.
+{
+    Counter job = { counter };
+    for (int i = 0; i < numJobs; ++i) {
+        ASSERTV(i, 0 == pool->enqueueJob(job));
+    }
+}
+
+                        // ==========================
+                        // namespace dequeConcurrency
+                        // ==========================
+
+namespace dequeConcurrency {
+
+enum { k_NUM_JOBS = 100000, k_NUM_THIEVES = 3 };
+
+struct State {
+    // State shared by the owner and the thieves of a deque.
+
+    Deque                         *d_deque_p;
+    Job                           *d_jobs_p;       // 'k_NUM_JOBS' jobs
+    bsl::vector<bsls::AtomicInt>  *d_taken_p;      // times each job is taken
+    bsls::AtomicInt               *d_numTaken_p;   // total number taken
+};
+
+void take(const State& state, Job *job)
+    // Record that the specified 'job' of the specified 'state' was taken.
+{
+    (*state.d_taken_p)[job - state.d_jobs_p].add(1);
+    state.d_numTaken_p->add(1);
+}
+
+void owner(State state)
+    // Push all the jobs of the specified 'state', popping one out of every
+    // three jobs pushed, then pop the remaining jobs.
+{
+    for (int i = 0; i < k_NUM_JOBS; ++i) {
+        state.d_deque_p->pushBottom(state.d_jobs_p + i);
+        if (2 == i % 3) {
+            if (Job *job = state.d_deque_p->popBottom()) {
+                take(state, job);
+            }
+        }
+    }
+    while (Job *job = state.d_deque_p->popBottom()) {
+        take(state, job);
+    }
+}
+
+void thief(State state)
+    // Steal the jobs of the specified 'state' until all jobs are taken.
+{
+    while (*state.d_numTaken_p < k_NUM_JOBS) {
+        if (Job *job = state.d_deque_p->steal()) {
+            take(state, job);
+        }
+        else {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+}  // close namespace dequeConcurrency
+
+                             // ==================
+                             // namespace benchmark
+                             // ==================
+
+namespace benchmark {
+
+void spin(bsls::Types::Int64 nanoseconds)
+    // Busy-wait for the specified 'nanoseconds'.
+{
+    const bsls::Types::Int64 end = bsls::TimeUtil::getTimer() + nanoseconds;
+    while (bsls::TimeUtil::getTimer() < end) {
+    }
+}
+
+template <class POOL>
+struct FanOutJob {
+    // Job that, if its depth is positive, enqueues two jobs of a lower depth
+    // in the pool executing it, then spins for a given duration.
+
+    POOL               *d_pool_p;
+    int                 d_depth;
+    bsls::Types::Int64  d_nanoseconds;
+
+    void operator()() const
+        // Enqueue two jobs of a lower depth if the depth of this job is
+        // positive, then spin.
+    {
+        if (0 < d_depth) {
+            FanOutJob child = { d_pool_p, d_depth - 1, d_nanoseconds };
+            d_pool_p->enqueueJob(child);
+            d_pool_p->enqueueJob(child);
+        }
+        spin(d_nanoseconds);
+    }
+};
+
+template <class POOL>
+double runFlat(POOL *pool, int numJobs, bsls::Types::Int64 nanoseconds)
+    // Enqueue the specified 'numJobs' jobs, each spinning for the specified
+    // 'nanoseconds', from the calling thread into the specified 'pool', wait
+    // until they complete, and return the elapsed time in seconds.
+{
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numJobs; ++i) {
+        pool->enqueueJob(bdlf::BindUtil::bind(&spin, nanoseconds));
+    }
+    pool->drain();
+    return static_cast<double>(bsls::TimeUtil::getTimer() - start) / 1e9;
+}
+
+template <class POOL>
+double runFanOut(POOL *pool, int depth, bsls::Types::Int64 nanoseconds)
+    // Enqueue a tree of jobs of the specified 'depth', each spinning for the
+    // specified 'nanoseconds', into the specified 'pool', wait until they
+    // complete, and return the elapsed time in seconds.
+{
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    FanOutJob<POOL> root = { pool, depth, nanoseconds };
+    pool->enqueueJob(root);
+    pool->drain();
+    return static_cast<double>(bsls::TimeUtil::getTimer() - start) / 1e9;
+}
+
+}  // close namespace benchmark
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Parallel Sum
+///- - - - - - - - - - - - - - - - -
+// In this example, we compute the sum of the elements of an array by
+// recursively splitting the array into halves, each half being summed by a
+// separate job.  Jobs enqueued by jobs are pushed to the deque of the worker
+// executing them, and are taken by idle workers through work stealing.
+//
+// First, we define a function object, 'SumJob', summing a range of an array
+// into an atomic accumulator and splitting large ranges into two jobs:
+//..
+    class SumJob {
+        // This class sums the elements of a range of an array, splitting the
+        // range into two jobs if it is larger than a threshold.
+
+        // DATA
+        bdlmt::WorkStealingThreadPool *d_pool_p;    // pool executing the job
+        const int                     *d_begin_p;   // beginning of the range
+        const int                     *d_end_p;     // end of the range
+        bsls::AtomicInt64             *d_result_p;  // accumulated sum
+
+      public:
+        // CREATORS
+        SumJob(bdlmt::WorkStealingThreadPool *pool,
+               const int                     *begin,
+               const int                     *end,
+               bsls::AtomicInt64             *result)
+        : d_pool_p(pool)
+        , d_begin_p(begin)
+        , d_end_p(end)
+        , d_result_p(result)
+        {
+        }
+
+        // ACCESSORS
+        void operator()() const
+        {
+            if (d_end_p - d_begin_p > 1024) {
+                const int *middle = d_begin_p + (d_end_p - d_begin_p) / 2;
+                d_pool_p->enqueueJob(
+                             SumJob(d_pool_p, d_begin_p, middle, d_result_p));
+                d_pool_p->enqueueJob(
+                             SumJob(d_pool_p, middle, d_end_p, d_result_p));
+                return;                                               // RETURN
+            }
+
+            bsls::Types::Int64 sum = 0;
+            for (const int *p = d_begin_p; p != d_end_p; ++p) {
+                sum += *p;
+            }
+            d_result_p->add(sum);
+        }
+    };
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        // The pool and the array use the default allocator.
+
+        bslma::TestAllocator         ta("usage", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+        using namespace usage;
+
+// Then, we create and start a pool of 4 threads:
+//..
+    bdlmt::WorkStealingThreadPool pool(4);
+    int                           rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we create the array to be summed:
+//..
+    bsl::vector<int> values(100000);
+    for (int i = 0; i < 100000; ++i) {
+        values[i] = i;
+    }
+//..
+// Now, we enqueue the job summing the whole array, and wait until all the jobs
+// (including the ones enqueued by the jobs) are complete:
+//..
+    bsls::AtomicInt64 result(0);
+
+    rc = pool.enqueueJob(SumJob(&pool,
+                                values.data(),
+                                values.data() + values.size(),
+                                &result));
+    ASSERT(0 == rc);
+
+    pool.drain();
+//..
+// Finally, we verify the result and stop the pool:
+//..
+    ASSERT(4999950000LL == result);
+
+    pool.stop();
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'shutdown', 'stop', AND DESTRUCTOR
+        //
+        // Concerns:
+        //: 1 'shutdown' waits for the active jobs to complete, and destroys
+        //:   the pending jobs without executing them.
+        //:
+        //: 2 'stop' executes the pending jobs.
+        //:
+        //: 3 The destructor of a started pool behaves as 'shutdown'.
+        //:
+        //: 4 'numActiveThreads' reports the threads executing a job.
+        //:
+        //: 5 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Start a pool of 1 thread, enqueue a job blocking until released,
+        //:   wait until it is active, and enqueue other jobs.  Call
+        //:   'shutdown' from another thread, release the blocking job after
+        //:   queuing was disabled, and verify that only the blocking job was
+        //:   executed.  (C-1, 4)
+        //:
+        //: 2 Repeat P-1 with 'stop', and verify that all the jobs were
+        //:   executed.  (C-2)
+        //:
+        //: 3 Repeat P-1, destroying the pool instead of calling 'shutdown',
+        //:   and releasing the blocking job from another thread.  (C-3)
+        //:
+        //: 4 Verify that all memory is returned to the test allocator.  (C-5)
+        //
+        // Testing:
+        //   ~WorkStealingThreadPool();
+        //   void shutdown();
+        //   int numActiveThreads() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'shutdown', 'stop', AND DESTRUCTOR" << endl
+                          << "==================================" << endl;
+
+        enum { k_NUM_JOBS = 100 };
+
+        enum Mode { e_SHUTDOWN, e_STOP, e_DESTROY };
+
+        for (int mode = e_SHUTDOWN; mode <= e_DESTROY; ++mode) {
+            if (veryVerbose) { P(mode); }
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bslmt::Semaphore started;
+            bslmt::Semaphore release;
+            bsls::AtomicInt  numBlockingCompleted(0);
+            bsls::AtomicInt  counter(0);
+
+            bslmt::ThreadGroup releaser(&sa);
+            {
+                Obj mX(1, &ta);  const Obj& X = mX;
+
+                int rc = mX.start();
+                ASSERT(0 == rc);
+                ASSERT(0 == X.numActiveThreads());
+
+                rc = mX.enqueueJob(
+                                  bdlf::BindUtil::bind(&waitForRelease,
+                                                       &started,
+                                                       &release,
+                                                       &numBlockingCompleted));
+                ASSERT(0 == rc);
+                started.wait();
+
+                ASSERT(1 == X.numActiveThreads());
+
+                enqueueCounters(&mX, &counter, k_NUM_JOBS);
+
+                ASSERTV(X.numPendingJobs(), k_NUM_JOBS == X.numPendingJobs());
+
+                if (e_DESTROY == mode) {
+                    releaser.addThread(bdlf::BindUtil::bind(&releaseAfterDelay,
+                                                            &release));
+                }
+                else {
+                    bslmt::ThreadGroup controller(&ta);
+
+                    controller.addThread(bdlf::BindUtil::bind(
+                                                       e_STOP == mode
+                                                       ? &Obj::stop
+                                                       : &Obj::shutdown,
+                                                       &mX));
+
+                    while (X.isEnabled()) {
+                        bslmt::ThreadUtil::yield();
+                    }
+                    releaseAfterDelay(&release);
+                    controller.joinAll();
+
+                    ASSERT(!X.isStarted());
+                    ASSERT(0 == X.numPendingJobs());
+                    ASSERT(0 == X.numActiveThreads());
+                }
+            }
+            releaser.joinAll();
+
+            ASSERTV(mode, 1 == numBlockingCompleted);
+            ASSERTV(mode,
+                    counter,
+                    (e_STOP == mode ? k_NUM_JOBS : 0) == counter);
+            ASSERTV(mode, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // JOBS ENQUEUING JOBS
+        //
+        // Concerns:
+        //: 1 Jobs enqueued by a job executed by the pool are executed.
+        //:
+        //: 2 'drain' waits for the jobs enqueued by the jobs being drained.
+        //:
+        //: 3 Jobs may be enqueued concurrently by several external threads
+        //:   and by the workers.
+        //
+        // Plan:
+        //: 1 For pools of 1 to 4 threads, enqueue a job spawning a binary
+        //:   tree of jobs, call 'drain', and verify the number of leaves.
+        //:   (C-1, 2)
+        //:
+        //: 2 Enqueue trees of jobs and counter jobs from several threads
+        //:   concurrently, join the threads, call 'drain', and verify the
+        //:   counters.  (C-3)
+        //
+        // Testing:
+        //   JOBS ENQUEUING JOBS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "JOBS ENQUEUING JOBS" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        enum { k_DEPTH = 12, k_NUM_CLIENTS = 4, k_NUM_JOBS = 5000 };
+
+        for (int numThreads = 1; numThreads <= 4; ++numThreads) {
+            if (veryVerbose) { P(numThreads); }
+
+            Obj mX(numThreads, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            for (int round = 0; round < 3; ++round) {
+                bsls::AtomicInt numLeaves(0);
+
+                ASSERT(0 == mX.enqueueJob(SpawnJob(&mX, k_DEPTH, &numLeaves)));
+                mX.drain();
+
+                ASSERTV(numThreads, round, numLeaves,
+                        (1 << k_DEPTH) == numLeaves);
+                ASSERT(0 == X.numPendingJobs());
+            }
+
+            bsls::AtomicInt    numLeaves(0);
+            bsls::AtomicInt    counter(0);
+            bslmt::ThreadGroup clients(&ta);
+
+            for (int i = 0; i < k_NUM_CLIENTS; ++i) {
+                clients.addThread(bdlf::BindUtil::bind(&enqueueCounters,
+                                                       &mX,
+                                                       &counter,
+                                                       static_cast<int>(
+                                                                k_NUM_JOBS)));
+                ASSERT(0 == mX.enqueueJob(SpawnJob(&mX, 8, &numLeaves)));
+            }
+            clients.joinAll();
+            mX.drain();
+
+            ASSERTV(numThreads,
+                    counter,
+                    k_NUM_CLIENTS * k_NUM_JOBS == counter);
+            ASSERTV(numThreads, numLeaves, k_NUM_CLIENTS * 256 == numLeaves);
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'enqueueJob', 'tryEnqueueJob', AND 'drain'
+        //
+        // Concerns:
+        //: 1 Each overload of 'enqueueJob' and 'tryEnqueueJob' enqueues a job
+        //:   that is executed exactly once.
+        //:
+        //: 2 'drain' returns once all the enqueued jobs are complete, and
+        //:   leaves the pool started and enabled.
+        //:
+        //: 3 'drain' returns immediately if the pool is not started.
+        //:
+        //: 4 'numPendingJobs' is 0 once the pool is drained.
+        //:
+        //: 5 The memory of the jobs is supplied by the allocator of the pool.
+        //
+        // Plan:
+        //: 1 Using each overload, enqueue a large number of jobs incrementing
+        //:   a counter, 'drain' the pool, and verify the counter and the
+        //:   state of the pool.  (C-1, 2, 4)
+        //:
+        //: 2 Call 'drain' on a pool that is not started.  (C-3)
+        //:
+        //: 3 Verify that the default allocator is not used.  (C-5)
+        //
+        // Testing:
+        //   int enqueueJob(const Job& functor);
+        //   int enqueueJob(bslmf::MovableRef<Job> functor);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   int tryEnqueueJob(const Job& functor);
+        //   int tryEnqueueJob(bslmf::MovableRef<Job> functor);
+        //   int tryEnqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   void drain();
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "'enqueueJob', 'tryEnqueueJob', AND 'drain'" << endl
+                      << "==========================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        enum { k_NUM_JOBS = 10000 };
+
+        {
+            Obj mX(3, &ta);  const Obj& X = mX;
+
+            mX.drain();
+
+            ASSERT(0 == mX.start());
+
+            for (int overload = 0; overload < 6; ++overload) {
+                if (veryVerbose) { P(overload); }
+
+                bsls::AtomicInt counter(0);
+                Counter         counterJob = { &counter };
+
+                for (int i = 0; i < k_NUM_JOBS; ++i) {
+                    int rc = -1;
+                    switch (overload) {
+                      case 0: {
+                        rc = mX.enqueueJob(Job(counterJob));
+                      } break;
+                      case 1: {
+                        Job job(counterJob);
+                        rc = mX.enqueueJob(bslmf::MovableRefUtil::move(job));
+                      } break;
+                      case 2: {
+                        rc = mX.enqueueJob(&incrementCounter, &counter);
+                      } break;
+                      case 3: {
+                        rc = mX.tryEnqueueJob(Job(counterJob));
+                      } break;
+                      case 4: {
+                        Job job(counterJob);
+                        rc = mX.tryEnqueueJob(
+                                            bslmf::MovableRefUtil::move(job));
+                      } break;
+                      case 5: {
+                        rc = mX.tryEnqueueJob(&incrementCounter, &counter);
+                      } break;
+                    }
+                    ASSERTV(overload, i, 0 == rc);
+                }
+
+                mX.drain();
+
+                ASSERTV(overload, counter, k_NUM_JOBS == counter);
+                ASSERT(0 == X.numPendingJobs());
+                ASSERT(X.isStarted());
+                ASSERT(X.isEnabled());
+            }
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'start', 'stop', 'enable', AND 'disable'
+        //
+        // Concerns:
+        //: 1 A pool is created with the specified number of threads and
+        //:   allocator, is not started, and is disabled.
+        //:
+        //: 2 'start' starts all the threads and enables queuing.
+        //:
+        //: 3 'stop' joins all the threads and disables queuing.
+        //:
+        //: 4 A pool may be started and stopped repeatedly.
+        //:
+        //: 5 Enqueuing fails, and the job is not executed, when the pool is
+        //:   disabled.
+        //:
+        //: 6 'start', 'stop', and 'shutdown' are idempotent.
+        //
+        // Plan:
+        //: 1 Create pools with both constructors and verify the accessors.
+        //:   (C-1)
+        //:
+        //: 2 Start and stop the pools repeatedly, verifying the accessors and
+        //:   the results of 'enqueueJob' after 'enable' and 'disable'.
+        //:   (C-2..6)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(int numThreads, bslma::Allocator *);
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+        //   void disable();
+        //   void enable();
+        //   int start();
+        //   void stop();
+        //   bool isEnabled() const;
+        //   bool isStarted() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+              << "CREATORS, 'start', 'stop', 'enable', AND 'disable'" << endl
+              << "==================================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        bslmt::ThreadAttributes attributes;
+        attributes.setThreadName("wstest");
+
+        for (int numThreads = 1; numThreads <= 5; numThreads += 2) {
+            for (int ctor = 0; ctor < 2; ++ctor) {
+                if (veryVerbose) { P_(numThreads); P(ctor); }
+
+                bsls::AtomicInt counter(0);
+                Counter         counterJob = { &counter };
+
+                Obj *objPtr = 0 == ctor
+                            ? new (ta) Obj(numThreads, &ta)
+                            : new (ta) Obj(attributes, numThreads, &ta);
+
+                Obj& mX = *objPtr;  const Obj& X = mX;
+
+                ASSERT(numThreads == X.numThreads());
+                ASSERT(&ta        == X.allocator());
+                ASSERT(!X.isStarted());
+                ASSERT(!X.isEnabled());
+                ASSERT(0 == X.numThreadsStarted());
+                ASSERT(0 == X.numActiveThreads());
+                ASSERT(0 == X.numPendingJobs());
+
+                ASSERT(0 != mX.enqueueJob(counterJob));
+                ASSERT(0 != mX.tryEnqueueJob(&incrementCounter, &counter));
+
+                mX.stop();
+                mX.shutdown();
+
+                for (int cycle = 0; cycle < 3; ++cycle) {
+                    ASSERT(0 == mX.start());
+                    ASSERT(0 == mX.start());
+
+                    ASSERT(X.isStarted());
+                    ASSERT(X.isEnabled());
+                    ASSERT(numThreads == X.numThreadsStarted());
+
+                    ASSERT(0 == mX.enqueueJob(counterJob));
+
+                    mX.disable();
+                    ASSERT(!X.isEnabled());
+                    ASSERT(0 != mX.enqueueJob(counterJob));
+                    ASSERT(0 != mX.enqueueJob(&incrementCounter, &counter));
+
+                    mX.enable();
+                    ASSERT(X.isEnabled());
+                    ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+
+                    if (cycle % 2) {
+                        mX.stop();
+                        mX.stop();
+                    }
+                    else {
+                        mX.drain();
+                        mX.shutdown();
+                        mX.shutdown();
+                    }
+
+                    ASSERT(!X.isStarted());
+                    ASSERT(!X.isEnabled());
+                    ASSERT(0 == X.numThreadsStarted());
+
+                    ASSERT(0 != mX.enqueueJob(counterJob));
+
+                    ASSERTV(counter, 2 * (cycle + 1) == counter);
+                }
+
+                ta.deleteObject(objPtr);
+                ASSERT(0 == ta.numBlocksInUse());
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENT 'steal' AND 'popBottom'
+        //
+        // Concerns:
+        //: 1 When the owner of a deque pushes and pops jobs while other
+        //:   threads steal jobs, every job is removed exactly once, including
+        //:   while the deque grows.
+        //
+        // Plan:
+        //: 1 Push a large number of distinct jobs from an owner thread that
+        //:   also pops some of them, while several thieves steal jobs, and
+        //:   count the number of times each job is removed.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT 'steal' AND 'popBottom'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT 'steal' AND 'popBottom'" << endl
+                          << "==================================" << endl;
+
+        using namespace dequeConcurrency;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        for (int round = 0; round < 4; ++round) {
+            Deque                        deque(&ta);
+            bsl::vector<Job>             jobs(k_NUM_JOBS, Job(), &ta);
+            bsl::vector<bsls::AtomicInt> taken(k_NUM_JOBS, &ta);
+            bsls::AtomicInt              numTaken(0);
+
+            State state = { &deque, jobs.data(), &taken, &numTaken };
+
+            bslmt::ThreadGroup threads(&ta);
+            for (int i = 0; i < k_NUM_THIEVES; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(&thief, state));
+            }
+            threads.addThread(bdlf::BindUtil::bind(&owner, state));
+            threads.joinAll();
+
+            ASSERTV(round, numTaken, k_NUM_JOBS == numTaken);
+            ASSERT(0 == deque.size());
+            for (int i = 0; i < k_NUM_JOBS; ++i) {
+                ASSERTV(round, i, taken[i], 1 == taken[i]);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'WorkStealingThreadPool_Deque'
+        //
+        // Concerns:
+        //: 1 'popBottom' removes the newest job and 'steal' the oldest one.
+        //:
+        //: 2 Both return 0 when the deque is empty.
+        //:
+        //: 3 The deque grows, doubling its capacity, when it is full, and
+        //:   retains its jobs in order.
+        //:
+        //: 4 'size' reports the number of jobs.
+        //:
+        //: 5 All memory is supplied by the specified allocator and released
+        //:   on destruction.
+        //
+        // Plan:
+        //: 1 Push jobs, then remove them alternately from both ends, and
+        //:   verify the order, 'size', and 'capacity'.  (C-1..4)
+        //:
+        //: 2 Use a test allocator and verify its use.  (C-5)
+        //
+        // Testing:
+        //   explicit WorkStealingThreadPool_Deque(bslma::Allocator *);
+        //   ~WorkStealingThreadPool_Deque();
+        //   Job *popBottom();
+        //   void pushBottom(Job *job);
+        //   Job *steal();
+        //   bsl::size_t capacity() const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'WorkStealingThreadPool_Deque'" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        const int k_INITIAL = Deque::k_INITIAL_CAPACITY;
+
+        const int NUM_JOBS[] = { 0, 1, 2, k_INITIAL - 1, k_INITIAL,
+                                 k_INITIAL + 1, 4 * k_INITIAL + 3 };
+        const int NUM_DATA = static_cast<int>(sizeof NUM_JOBS /
+                                                          sizeof *NUM_JOBS);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int N = NUM_JOBS[ti];
+
+            if (veryVerbose) { P(N); }
+
+            bsl::vector<Job> jobs(N + 1, Job(), &ta);
+            Job             *JOBS = jobs.data();
+
+            bslma::TestAllocatorMonitor tam(&ta);
+            {
+                Deque mX(&ta);  const Deque& X = mX;
+
+                ASSERT(tam.isInUseUp());
+                ASSERT(k_INITIAL == static_cast<int>(X.capacity()));
+                ASSERT(0 == X.size());
+                ASSERT(0 == mX.popBottom());
+                ASSERT(0 == mX.steal());
+
+                bsl::size_t expectedCapacity = k_INITIAL;
+                for (int i = 0; i < N; ++i) {
+                    mX.pushBottom(JOBS + i);
+                    if (static_cast<bsl::size_t>(i) == expectedCapacity) {
+                        expectedCapacity *= 2;
+                    }
+                    ASSERTV(N, i, expectedCapacity == X.capacity());
+                    ASSERTV(N, i, i + 1 == static_cast<int>(X.size()));
+                }
+
+                int low  = 0;
+                int high = N;
+                for (int i = 0; i < N; ++i) {
+                    if (i % 2) {
+                        ASSERTV(N, i, JOBS + low == mX.steal());
+                        ++low;
+                    }
+                    else {
+                        --high;
+                        ASSERTV(N, i, JOBS + high == mX.popBottom());
+                    }
+                    ASSERTV(N, i, N - i - 1 == static_cast<int>(X.size()));
+                }
+
+                ASSERT(0 == X.size());
+                ASSERT(0 == mX.popBottom());
+                ASSERT(0 == mX.steal());
+                ASSERT(expectedCapacity == X.capacity());
+
+                // The deque remains usable once emptied.
+
+                mX.pushBottom(JOBS + N);
+                ASSERT(1 == X.size());
+                ASSERT(JOBS + N == mX.steal());
+                mX.pushBottom(JOBS + N);
+                ASSERT(JOBS + N == mX.popBottom());
+                ASSERT(0 == X.size());
+            }
+            ASSERTV(N, tam.isInUseSame());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a pool, enqueue a few jobs, drain the pool, verify that the
+        //:   jobs were executed, and stop the pool.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        bsls::AtomicInt counter(0);
+        Counter         counterJob = { &counter };
+
+        Obj mX(2, &ta);  const Obj& X = mX;
+
+        ASSERT(2 == X.numThreads());
+        ASSERT(0 == mX.start());
+        ASSERT(X.isStarted());
+
+        for (int i = 0; i < 10; ++i) {
+            ASSERT(0 == mX.enqueueJob(counterJob));
+        }
+        mX.drain();
+        ASSERTV(counter, 10 == counter);
+
+        bsls::AtomicInt numLeaves(0);
+        ASSERT(0 == mX.enqueueJob(SpawnJob(&mX, 4, &numLeaves)));
+        mX.drain();
+        ASSERTV(numLeaves, 16 == numLeaves);
+
+        mX.stop();
+        ASSERT(!X.isStarted());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT: 'WorkStealingThreadPool' VS 'FixedThreadPool'
+        //
+        // Concerns:
+        //: 1 For short jobs, and in particular for jobs enqueuing jobs, the
+        //:   throughput of 'bdlmt::WorkStealingThreadPool' is higher than
+        //:   that of 'bdlmt::FixedThreadPool'.
+        //
+        // Plan:
+        //: 1 For jobs spinning from 0 to 1ms, measure the time taken by both
+        //:   pools to execute a number of jobs enqueued from the main thread
+        //:   ("flat"), and a binary tree of jobs enqueued by the jobs
+        //:   ("fan-out").  The number of jobs is chosen so that each
+        //:   measurement takes about the same time.
+        //:
+        //: 2 The number of threads may be specified as the second argument
+        //:   (4 by default).
+        //
+        // Testing:
+        //   THROUGHPUT: 'WorkStealingThreadPool' VS 'FixedThreadPool'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "THROUGHPUT: 'WorkStealingThreadPool' VS 'FixedThreadPool'"
+             << endl
+             << "========================================================="
+             << endl;
+
+        using namespace benchmark;
+
+        const int numThreads = argc > 2 && atoi(argv[2]) > 0
+                             ? atoi(argv[2])
+                             : 4;
+
+        bslma::Allocator *alloc = &bslma::NewDeleteAllocator::singleton();
+
+        const bsls::Types::Int64 DURATIONS[] = {
+            0, 100, 1000, 10 * 1000, 100 * 1000, 1000 * 1000
+        };
+        const int NUM_DURATIONS = static_cast<int>(sizeof DURATIONS /
+                                                         sizeof *DURATIONS);
+
+        // Aim at about 0.5s of work per measurement, with at least 2^10 and
+        // at most 2^20 jobs.
+
+        const bsls::Types::Int64 k_TARGET_NS = 500LL * 1000 * 1000 *
+                                                                   numThreads;
+
+        bdlmt::WorkStealingThreadPool wsPool(numThreads, alloc);
+        bdlmt::FixedThreadPool        fixedPool(numThreads,
+                                                1 << 21,
+                                                alloc);
+
+        ASSERT(0 == wsPool.start());
+        ASSERT(0 == fixedPool.start());
+
+        cout << "threads: " << numThreads << "\n\n"
+             << setw(10) << "job (ns)" << setw(10) << "jobs"
+             << setw(16) << "flat WS (j/s)" << setw(16) << "flat FTP (j/s)"
+             << setw(16) << "tree WS (j/s)" << setw(16) << "tree FTP (j/s)"
+             << endl;
+
+        for (int i = 0; i < NUM_DURATIONS; ++i) {
+            const bsls::Types::Int64 NS = DURATIONS[i];
+
+            int depth = 10;
+            while (depth < 20
+                && (NS + 200) * (2LL << depth) < k_TARGET_NS) {
+                ++depth;
+            }
+            const int numJobs = (2 << depth) - 1;
+
+            const double flatWs    = runFlat(&wsPool, numJobs, NS);
+            const double flatFixed = runFlat(&fixedPool, numJobs, NS);
+            const double treeWs    = runFanOut(&wsPool, depth, NS);
+            const double treeFixed = runFanOut(&fixedPool, depth, NS);
+
+            cout << setw(10) << NS << setw(10) << numJobs
+                 << setw(16) << static_cast<int>(numJobs / flatWs)
+                 << setw(16) << static_cast<int>(numJobs / flatFixed)
+                 << setw(16) << static_cast<int>(numJobs / treeWs)
+                 << setw(16) << static_cast<int>(numJobs / treeFixed)
+                 << endl;
+        }
+
+        wsPool.stop();
+        fixedPool.stop();
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (test >= 0) {
+        // CONCERN: In no case does memory come from the default allocator.
+
+        ASSERT(dam.isTotalSame());
+
+        // CONCERN: In no case does memory come from the global allocator.
+
+        ASSERT(gam.isTotalSame());
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,35 @@
+// bsl_flat_hash_set.h                                                -*-C++-*-
+#ifndef INCLUDED_BSL_FLAT_HASH_SET
+#define INCLUDED_BSL_FLAT_HASH_SET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide the open-addressed unordered set container.
+//
+//@SEE_ALSO: bslstl_flathashset
+//
+//@DESCRIPTION: Provide 'bsl::flat_hash_set', an unordered set that, unlike
+// 'bsl::unordered_set', stores its entries in a single contiguous array.
+// There is no corresponding C++ standard header, so this header includes only
+// Bloomberg's implementation, which is available in every language mode.
+
+#include <bslstl_flathashset.h>
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1214 @@
+// bslstl_flathashmap.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATHASHMAP
+#define INCLUDED_BSLSTL_FLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered map container.
+//
+//@CLASSES:
+//  bsl::flat_hash_map: open-addressed unordered map container
+//
+//@SEE_ALSO: bslstl_flathashset, bslstl_flathashtable, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_hash_map', implementing an unordered map of unique keys to values
+// that stores its 'bsl::pair<KEY, VALUE>' entries directly in a single
+// contiguous array (an "open-addressed", or "flat", hash table), rather than
+// in individually allocated nodes as 'bsl::unordered_map' does.  A separate
+// array of one-byte control values, examined a group at a time using SIMD
+// instructions where available, lets nearly every lookup, successful or not,
+// complete with a single key comparison (see 'bslstl_flathashtable').
+//
+// Compared to 'bsl::unordered_map', 'bsl::flat_hash_map' performs fewer
+// allocations (one per growth of the table, rather than one per entry), uses
+// less memory per entry for small entries, and has better locality of
+// reference, which typically makes lookups, insertions, and erasures
+// significantly faster.  In exchange, it provides weaker guarantees:
+//
+//: o Any insertion that causes the table to grow invalidates all iterators,
+//:   pointers, and references to the entries of the map, as do 'rehash' and
+//:   'reserve' (see {Iterator and Reference Invalidation}).
+//:
+//: o The entries are of type 'bsl::pair<KEY, VALUE>' (rather than
+//:   'bsl::pair<const KEY, VALUE>'); the behavior is undefined if the key of
+//:   an entry is modified.
+//:
+//: o There are no bucket inquiries and no way to set the maximum load factor,
+//:   which is fixed at 0.875.
+//
+// Unlike 'bsl::unordered_map', 'bsl::flat_hash_map' uses 'bslh::Hash<>' as its
+// default hash functor, which hashes any type that supports the 'bslh'
+// 'hashAppend' protocol (see 'bslh_hash').  Another hash functor, such as
+// 'bsl::hash<KEY>', may be supplied instead.  Although the table uses the high
+// bits of the hash value to select the initial group of slots to search, and
+// the low bits to filter the slots of a group, a hash functor whose results
+// are poorly distributed (such as the identity hash of integers provided by
+// 'bsl::hash<int>') performs well: the table multiplicatively mixes each hash
+// value before use.
+//
+///Memory Allocation
+///-----------------
+// 'bsl::flat_hash_map' uses a 'bsl::allocator', supplied at construction, to
+// allocate its single block of slots, and passes that allocator's mechanism
+// to each 'KEY' and 'VALUE' that uses 'bslma'-style allocators.  If no
+// allocator is supplied, the currently installed default allocator is used.
+// A map constructed with no capacity allocates no memory.
+//
+///Heterogeneous Lookup
+///--------------------
+// If both the 'HASH' and 'EQUAL' types are *transparent* (i.e., have a nested
+// type named 'is_transparent'), 'find', 'contains', 'count', and
+// 'equal_range' accept a key of any type for which the functors are callable,
+// avoiding the construction of a temporary 'KEY'.  Note that the hash of such
+// a key must equal the hash of any equal 'KEY'.
+//
+///Iterator and Reference Invalidation
+///-----------------------------------
+// Since entries are stored in the table itself, any operation that rebuilds
+// the table (i.e., 'rehash', 'reserve', and any insertion that causes the
+// table to grow) invalidates all iterators, pointers, and references to the
+// entries of the map.  Calling 'reserve' with the number of entries to be
+// inserted beforehand guarantees that those insertions do not rebuild the
+// table.  Erasing an entry invalidates only iterators, pointers, and
+// references to the erased entry.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the occurrences of each word in a text.  We use a
+// 'bsl::flat_hash_map' from word to count.
+//
+// First, we define the text, already split into words:
+//..
+//  const char *WORDS[] = { "the", "quick", "brown", "fox", "jumps", "over",
+//                          "the", "lazy", "dog", "and", "the", "cat" };
+//  const std::size_t NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+//..
+// Then, we create a map, reserving room for as many distinct words as there
+// are words, so that the map is not rebuilt while we count:
+//..
+//  bsl::flat_hash_map<bsl::string, int> counts;
+//  counts.reserve(NUM_WORDS);
+//..
+// Next, we count each word, relying on 'operator[]' to create a count of 0
+// the first time a word is seen:
+//..
+//  for (std::size_t i = 0; i < NUM_WORDS; ++i) {
+//      ++counts[WORDS[i]];
+//  }
+//..
+// Finally, we verify the counts:
+//..
+//  assert(10 == counts.size());
+//  assert( 3 == counts["the"]);
+//  assert( 1 == counts.at("fox"));
+//  assert(false == counts.contains("elephant"));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_equalto.h>
+#include <bslstl_flathashtable.h>
+#include <bslstl_pair.h>
+#include <bslstl_stdexceptutil.h>
+
+#include <bslalg_hasstliterators.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_review.h>
+#include <bsls_util.h>
+
+#include <cstddef>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ============================
+                        // struct FlatHashMap_EntryUtil
+                        // ============================
+
+template <class KEY, class VALUE>
+struct FlatHashMap_EntryUtil {
+    // This 'struct' provides the operations on the 'bsl::pair<KEY, VALUE>'
+    // entries of a 'bsl::flat_hash_map' required by 'FlatHashTable'.
+
+    // CLASS METHODS
+    template <class KEY_TYPE>
+    static void constructFromKey(
+                        bsl::pair<KEY, VALUE>                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+        // Create, at the specified 'entry' address, a pair having the
+        // specified 'key' and a default-constructed value, using the specified
+        // 'allocator' to supply memory.
+
+    template <class ENTRY_TYPE>
+    static const typename ENTRY_TYPE::first_type& key(
+                                                     const ENTRY_TYPE& entry);
+        // Return a reference to the key (i.e., the 'first' member) of the
+        // specified 'entry'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                            // ===================
+                            // class flat_hash_map
+                            // ===================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = BloombergLP::bslh::Hash<>,
+          class EQUAL = bsl::equal_to<KEY> >
+class flat_hash_map {
+    // This class template implements an open-addressed unordered map of
+    // unique keys of the (template parameter) type 'KEY' to values of the
+    // (template parameter) type 'VALUE', using the (template parameter) types
+    // 'HASH' and 'EQUAL' to hash and compare keys.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::FlatHashMap_EntryUtil<KEY, VALUE> EntryUtil;
+
+    typedef BloombergLP::bslstl::FlatHashTable<KEY,
+                                               bsl::pair<KEY, VALUE>,
+                                               EntryUtil,
+                                               HASH,
+                                               EQUAL>              ImplType;
+
+    typedef BloombergLP::bslmf::MovableRefUtil                     MoveUtil;
+
+    // DATA
+    ImplType d_impl;  // underlying flat hash table
+
+    // FRIENDS
+    template <class K, class V, class H, class E>
+    friend bool operator==(const flat_hash_map<K, V, H, E>&,
+                           const flat_hash_map<K, V, H, E>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                    key_type;
+    typedef VALUE                                  mapped_type;
+    typedef bsl::pair<KEY, VALUE>                  value_type;
+    typedef std::size_t                            size_type;
+    typedef std::ptrdiff_t                         difference_type;
+    typedef HASH                                   hasher;
+    typedef EQUAL                                  key_equal;
+    typedef bsl::allocator<value_type>             allocator_type;
+    typedef value_type&                            reference;
+    typedef const value_type&                      const_reference;
+    typedef value_type                            *pointer;
+    typedef const value_type                      *const_pointer;
+    typedef typename ImplType::iterator            iterator;
+    typedef typename ImplType::const_iterator      const_iterator;
+
+    // CREATORS
+    flat_hash_map();
+    explicit flat_hash_map(const allocator_type& basicAllocator);
+    explicit flat_hash_map(size_type capacity);
+    flat_hash_map(size_type capacity, const allocator_type& basicAllocator);
+    flat_hash_map(size_type             capacity,
+                  const HASH&           hash,
+                  const allocator_type& basicAllocator = allocator_type());
+    flat_hash_map(size_type             capacity,
+                  const HASH&           hash,
+                  const EQUAL&          equal,
+                  const allocator_type& basicAllocator = allocator_type());
+        // Create an empty map.  Optionally specify a 'capacity' indicating the
+        // number of entries the map can hold without being rebuilt.  If
+        // 'capacity' is not supplied, or is 0, no memory is allocated.
+        // Optionally specify a 'hash' functor used to hash keys; if 'hash' is
+        // not supplied, a default-constructed 'HASH' is used.  Optionally
+        // specify an 'equal' functor used to compare keys; if 'equal' is not
+        // supplied, a default-constructed 'EQUAL' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, the currently installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    flat_hash_map(INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  const allocator_type& basicAllocator = allocator_type());
+    template <class INPUT_ITERATOR>
+    flat_hash_map(INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  size_type             capacity,
+                  const HASH&           hash = HASH(),
+                  const EQUAL&          equal = EQUAL(),
+                  const allocator_type& basicAllocator = allocator_type());
+        // Create a map containing the entries in the specified range
+        // '[first, last)', ignoring any entry whose key is already present.
+        // Optionally specify a 'capacity' indicating the number of entries
+        // the map can hold without being rebuilt.  Optionally specify a
+        // 'hash' functor used to hash keys; if 'hash' is not supplied, a
+        // default-constructed 'HASH' is used.  Optionally specify an 'equal'
+        // functor used to compare keys; if 'equal' is not supplied, a
+        // default-constructed 'EQUAL' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, the currently installed default allocator is used.  The
+        // behavior is undefined unless '[first, last)' is a valid range of
+        // objects from which 'value_type' can be constructed.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_hash_map(std::initializer_list<value_type> values,
+                  const allocator_type&             basicAllocator =
+                                                             allocator_type());
+        // Create a map containing the specified 'values', ignoring any entry
+        // whose key is already present.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, the currently installed default allocator is used.
+#endif
+
+    flat_hash_map(const flat_hash_map&  original,
+                  const allocator_type& basicAllocator = allocator_type());
+        // Create a map having the same value, hash functor, and key-equality
+        // functor as the specified 'original' map.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, the currently installed default allocator is used.
+
+    flat_hash_map(BloombergLP::bslmf::MovableRef<flat_hash_map> original);
+                                                                    // IMPLICIT
+        // Create a map having the same value, hash functor, key-equality
+        // functor, and allocator as the specified 'original' map, leaving
+        // 'original' empty with no capacity.  No memory is allocated.
+
+    flat_hash_map(
+                 BloombergLP::bslmf::MovableRef<flat_hash_map> original,
+                 const allocator_type&                         basicAllocator);
+        // Create a map having the same value, hash functor, and key-equality
+        // functor as the specified 'original' map, using the specified
+        // 'basicAllocator' to supply memory.  If
+        // 'basicAllocator == original.get_allocator()', the contents of
+        // 'original' are moved (without allocating) and 'original' is left
+        // empty with no capacity; otherwise, 'original' is copied and left
+        // unchanged.
+
+    ~flat_hash_map();
+        // Destroy this object and each of its entries.
+
+    // MANIPULATORS
+    flat_hash_map& operator=(const flat_hash_map& rhs);
+        // Assign to this map the value, hash functor, and key-equality functor
+        // of the specified 'rhs' map, and return a reference providing
+        // modifiable access to this map.
+
+    flat_hash_map& operator=(
+                          BloombergLP::bslmf::MovableRef<flat_hash_map> rhs);
+        // Assign to this map the value, hash functor, and key-equality functor
+        // of the specified 'rhs' map, and return a reference providing
+        // modifiable access to this map.  If this map and 'rhs' use the same
+        // allocator, the contents of 'rhs' are moved (without allocating) and
+        // 'rhs' is left empty with no capacity; otherwise, 'rhs' is copied
+        // and left unchanged.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_hash_map& operator=(std::initializer_list<value_type> values);
+        // Assign to this map the entries of the specified 'values', ignoring
+        // any entry whose key is already present, and return a reference
+        // providing modifiable access to this map.
+#endif
+
+    template <class KEY_TYPE>
+    VALUE& operator[](BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key);
+        // Return a reference providing modifiable access to the value of the
+        // entry in this map having the specified 'key', first creating an
+        // entry having 'key' and a default-constructed value if there is
+        // none.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the value of the
+        // entry in this map having the specified 'key'.  Throw a
+        // 'std::out_of_range' exception if there is no such entry.
+
+    void clear();
+        // Remove all entries from this map.  Note that the capacity of the map
+        // is retained.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the (empty or one-element)
+        // sequence of entries in this map having the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        bsl::pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators defining the (empty or one-element)
+        // sequence of entries in this map having a key equal to the specified
+        // 'key'.  This overload participates in overload resolution only if
+        // both 'HASH' and 'EQUAL' are transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.equal_range(key);
+    }
+
+    size_type erase(const KEY& key);
+        // Remove from this map the entry having the specified 'key', if it
+        // exists, and return the number of entries removed (0 or 1).
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this map the entry referred to by the specified
+        // 'position', and return an iterator referring to the entry following
+        // it, or the past-the-end iterator if there is none.  The behavior is
+        // undefined unless 'position' refers to an entry of this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the entries in the specified range
+        // '[first, last)', and return an iterator having the value of 'last'.
+        // The behavior is undefined unless '[first, last)' is a valid range
+        // of entries of this map.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the entry in this map having the
+        // specified 'key', or the past-the-end iterator if there is none.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator referring to the entry in this map having a key
+        // equal to the specified 'key', or the past-the-end iterator if there
+        // is none.  This overload participates in overload resolution only if
+        // both 'HASH' and 'EQUAL' are transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.find(key);
+    }
+
+    template <class VALUE_TYPE>
+    bsl::pair<iterator, bool>
+    insert(BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value);
+        // Create in this map an entry from the specified 'value' (a pair of
+        // key and value) if no entry has the key of 'value'.  Return a pair
+        // whose 'first' member refers to the entry in this map having that
+        // key, and whose 'second' member is 'true' if the entry was created,
+        // and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Create in this map an entry from each entry in the specified range
+        // '[first, last)' whose key is not already present.  The behavior is
+        // undefined unless '[first, last)' is a valid range of objects from
+        // which 'value_type' can be constructed.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<value_type> values);
+        // Create in this map an entry from each of the specified 'values'
+        // whose key is not already present.
+#endif
+
+    void rehash(size_type minimumCapacity);
+        // Rebuild this map to have the smallest capacity that is at least the
+        // specified 'minimumCapacity' and can hold 'size()' entries without
+        // being rebuilt, discarding the slots of erased entries.  If the
+        // resulting capacity is 0, release all memory.  All iterators,
+        // pointers, and references to entries are invalidated.
+
+    void reserve(size_type numEntries);
+        // Ensure this map can hold at least the specified 'numEntries' entries
+        // without being rebuilt.  If the map is rebuilt, all iterators,
+        // pointers, and references to entries are invalidated.
+
+    void reset();
+        // Remove all entries from this map and release all memory.
+
+    void swap(flat_hash_map& other);
+        // Exchange the value, hash functor, and key-equality functor of this
+        // map with those of the specified 'other' map.  This method provides
+        // the no-throw exception-safety guarantee.  The behavior is undefined
+        // unless this map and 'other' use the same allocator.
+
+                             // Iterators
+
+    iterator begin();
+        // Return an iterator referring to the first entry of this map, or the
+        // past-the-end iterator if this map is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this map.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference providing non-modifiable access to the value of
+        // the entry in this map having the specified 'key'.  Throw a
+        // 'std::out_of_range' exception if there is no such entry.
+
+    size_type capacity() const;
+        // Return the number of slots of this map.  Note that the map can hold
+        // up to 7/8 of its capacity in entries without being rebuilt.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map has an entry having the specified 'key',
+        // and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this map has an entry having a key equal to the
+        // specified 'key', and 'false' otherwise.  This overload participates
+        // in overload resolution only if both 'HASH' and 'EQUAL' are
+        // transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.contains(key);
+    }
+
+    size_type count(const KEY& key) const;
+        // Return the number of entries in this map having the specified 'key'
+        // (0 or 1).
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of entries in this map having a key equal to the
+        // specified 'key' (0 or 1).  This overload participates in overload
+        // resolution only if both 'HASH' and 'EQUAL' are transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.contains(key) ? 1 : 0;
+    }
+
+    bool empty() const;
+        // Return 'true' if this map has no entries, and 'false' otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of iterators defining the (empty or one-element)
+        // sequence of entries in this map having the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        bsl::pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators defining the (empty or one-element)
+        // sequence of entries in this map having a key equal to the specified
+        // 'key'.  This overload participates in overload resolution only if
+        // both 'HASH' and 'EQUAL' are transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.equal_range(key);
+    }
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the entry in this map having the
+        // specified 'key', or the past-the-end iterator if there is none.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator referring to the entry in this map having a key
+        // equal to the specified 'key', or the past-the-end iterator if there
+        // is none.  This overload participates in overload resolution only if
+        // both 'HASH' and 'EQUAL' are transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.find(key);
+    }
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this map.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality functor of this map.
+
+    float load_factor() const;
+        // Return the ratio of the number of entries to the capacity of this
+        // map, or 0 if this map has no capacity.
+
+    float max_load_factor() const;
+        // Return the ratio of entries to capacity at which this map grows.
+
+    size_type size() const;
+        // Return the number of entries in this map.
+
+                             // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first entry of this map, or the
+        // past-the-end iterator if this map is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this map.
+
+                                // Aspects
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used by this map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const flat_hash_map<KEY, VALUE, HASH, EQUAL>& lhs,
+                const flat_hash_map<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps have the same value,
+    // and 'false' otherwise.  Two maps have the same value if they have the
+    // same number of entries and, for each entry of 'lhs', 'rhs' has an entry
+    // having the same key and value.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const flat_hash_map<KEY, VALUE, HASH, EQUAL>& lhs,
+                const flat_hash_map<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps do not have the same
+    // value, and 'false' otherwise.  Two maps do not have the same value if
+    // they do not have the same number of entries or, for some entry of
+    // 'lhs', 'rhs' has no entry having the same key and value.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(flat_hash_map<KEY, VALUE, HASH, EQUAL>& a,
+          flat_hash_map<KEY, VALUE, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' maps.  If 'a' and 'b'
+    // use the same allocator, this function provides the no-throw
+    // exception-safety guarantee; otherwise, copies are made using each map's
+    // allocator.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ----------------------------
+                        // struct FlatHashMap_EntryUtil
+                        // ----------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE>
+template <class KEY_TYPE>
+inline
+void FlatHashMap_EntryUtil<KEY, VALUE>::constructFromKey(
+                        bsl::pair<KEY, VALUE>                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bsls::ObjectBuffer<VALUE> value;
+    bslma::ConstructionUtil::construct(value.address(), allocator);
+    bslma::DestructorGuard<VALUE> guard(value.address());
+
+    bslma::ConstructionUtil::construct(
+                              entry,
+                              allocator,
+                              BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key),
+                              bslmf::MovableRefUtil::move(value.object()));
+}
+
+template <class KEY, class VALUE>
+template <class ENTRY_TYPE>
+inline
+const typename ENTRY_TYPE::first_type&
+FlatHashMap_EntryUtil<KEY, VALUE>::key(const ENTRY_TYPE& entry)
+{
+    return entry.first;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                            // -------------------
+                            // class flat_hash_map
+                            // -------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::flat_hash_map()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::flat_hash_map(
+                                          const allocator_type& basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator.mechanism())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::flat_hash_map(size_type capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::flat_hash_map(
+                                          size_type             capacity,
+                                          const allocator_type& basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator.mechanism())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::flat_hash_map(
+                                          size_type             capacity,
+                                          const HASH&           hash,
+                                          const allocator_type& basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator.mechanism())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::flat_hash_map(
+                                          size_type             capacity,
+                                          const HASH&           hash,
+                                          const EQUAL&          equal,
+                                          const allocator_type& basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator.mechanism())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::flat_hash_map(
+                                          INPUT_ITERATOR        first,
+                                          INPUT_ITERATOR        last,
+                                          const allocator_type& basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator.mechanism())
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::flat_hash_map(
+                                          INPUT_ITERATOR        first,
+                                          INPUT_ITERATOR        last,
+                                          size_type             capacity,
+                                          const HASH&           hash,
+                                          const EQUAL&          equal,
+                                          const allocator_type& basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator.mechanism())
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::flat_hash_map(
+                              std::initializer_list<value_type> values,
+                              const allocator_type&             basicAllocator)
+: d_impl(values.size(), HASH(), EQUAL(), basicAllocator.mechanism())
+{
+    d_impl.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::flat_hash_map(
+                                          const flat_hash_map&  original,
+                                          const allocator_type& basicAllocator)
+: d_impl(original.d_impl, basicAllocator.mechanism())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::flat_hash_map(
+                       BloombergLP::bslmf::MovableRef<flat_hash_map> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::flat_hash_map(
+                  BloombergLP::bslmf::MovableRef<flat_hash_map> original,
+                  const allocator_type&                         basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl),
+         basicAllocator.mechanism())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::~flat_hash_map()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>&
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::operator=(const flat_hash_map& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>&
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::operator=(
+                           BloombergLP::bslmf::MovableRef<flat_hash_map> rhs)
+{
+    d_impl = MoveUtil::move(MoveUtil::access(rhs).d_impl);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+flat_hash_map<KEY, VALUE, HASH, EQUAL>&
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    flat_hash_map tmp(values.begin(),
+                      values.end(),
+                      values.size(),
+                      d_impl.hash_function(),
+                      d_impl.key_eq(),
+                      get_allocator());
+    d_impl.swap(tmp.d_impl);
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class KEY_TYPE>
+inline
+VALUE& flat_hash_map<KEY, VALUE, HASH, EQUAL>::operator[](
+                               BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+{
+    return d_impl.tryEmplace(
+                 BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key)).first->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& flat_hash_map<KEY, VALUE, HASH, EQUAL>::at(const KEY& key)
+{
+    iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                "flat_hash_map<...>::at(key): invalid key");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void flat_hash_map<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::iterator,
+          typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::iterator>
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key)
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::size_type
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::erase(iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::erase(const_iterator first,
+                                              const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VALUE_TYPE>
+inline
+bsl::pair<typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::insert(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+{
+    return d_impl.insert(BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void flat_hash_map<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                    INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void flat_hash_map<KEY, VALUE, HASH, EQUAL>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    d_impl.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void flat_hash_map<KEY, VALUE, HASH, EQUAL>::rehash(size_type minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void flat_hash_map<KEY, VALUE, HASH, EQUAL>::reserve(size_type numEntries)
+{
+    d_impl.reserve(numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void flat_hash_map<KEY, VALUE, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void flat_hash_map<KEY, VALUE, HASH, EQUAL>::swap(flat_hash_map& other)
+{
+    BSLS_ASSERT(get_allocator() == other.get_allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+                             // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return d_impl.end();
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const VALUE& flat_hash_map<KEY, VALUE, HASH, EQUAL>::at(const KEY& key) const
+{
+    const_iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                          "flat_hash_map<...>::at(key) const: invalid key");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::size_type
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool flat_hash_map<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::size_type
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool flat_hash_map<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::const_iterator,
+          typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::const_iterator>
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::const_iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH flat_hash_map<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL flat_hash_map<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float flat_hash_map<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float flat_hash_map<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::size_type
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                             // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::const_iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::const_iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::const_iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::const_iterator
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+                                // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename flat_hash_map<KEY, VALUE, HASH, EQUAL>::allocator_type
+flat_hash_map<KEY, VALUE, HASH, EQUAL>::get_allocator() const
+{
+    return allocator_type(d_impl.allocator());
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bsl::operator==(const bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL>& lhs,
+                     const bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bsl::operator!=(const bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL>& lhs,
+                     const bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void bsl::swap(bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL>& a,
+               bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL>& b)
+{
+    typedef bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL> Map;
+
+    if (a.get_allocator() == b.get_allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    Map futureA(b, a.get_allocator());
+    Map futureB(a, b.get_allocator());
+
+    a = BloombergLP::bslmf::MovableRefUtil::move(futureA);
+    b = BloombergLP::bslmf::MovableRefUtil::move(futureB);
+}
+
+// ============================================================================
+//                              TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'bsl::flat_hash_map':
+//: o A flat hash map defines STL iterators.
+//: o A flat hash map uses 'bslma' allocators.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct HasStlIterators<bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL> >
+: bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bsl::flat_hash_map<KEY, VALUE, HASH, EQUAL> >
+: bsl::true_type
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
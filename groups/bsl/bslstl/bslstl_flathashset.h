@@ -0,0 +1,1047 @@
+// bslstl_flathashset.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATHASHSET
+#define INCLUDED_BSLSTL_FLATHASHSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered set container.
+//
+//@CLASSES:
+//  bsl::flat_hash_set: open-addressed unordered set container
+//
+//@SEE_ALSO: bslstl_flathashmap, bslstl_flathashtable, bslstl_unorderedset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_hash_set', implementing an unordered set of unique keys that
+// stores its keys directly in a single contiguous array (an "open-addressed",
+// or "flat", hash table), rather than in individually allocated nodes as
+// 'bsl::unordered_set' does.  A separate array of one-byte control values,
+// examined a group at a time using SIMD instructions where available, lets
+// nearly every lookup, successful or not, complete with a single key
+// comparison (see 'bslstl_flathashtable').
+//
+// Compared to 'bsl::unordered_set', 'bsl::flat_hash_set' performs fewer
+// allocations (one per growth of the table, rather than one per key), uses
+// less memory per key for small keys, and has better locality of reference,
+// which typically makes lookups, insertions, and erasures significantly
+// faster.  In exchange, it provides weaker guarantees:
+//
+//: o Any insertion that causes the table to grow invalidates all iterators,
+//:   pointers, and references to the keys of the set, as do 'rehash' and
+//:   'reserve' (see {Iterator and Reference Invalidation}).
+//:
+//: o There are no bucket inquiries and no way to set the maximum load factor,
+//:   which is fixed at 0.875.
+//
+// Unlike 'bsl::unordered_set', 'bsl::flat_hash_set' uses 'bslh::Hash<>' as its
+// default hash functor, which hashes any type that supports the 'bslh'
+// 'hashAppend' protocol (see 'bslh_hash').  Another hash functor, such as
+// 'bsl::hash<KEY>', may be supplied instead.  As the table multiplicatively
+// mixes each hash value before use, a hash functor whose results are poorly
+// distributed (such as the identity hash of integers provided by
+// 'bsl::hash<int>') performs well.
+//
+///Memory Allocation
+///-----------------
+// 'bsl::flat_hash_set' uses a 'bsl::allocator', supplied at construction, to
+// allocate its single block of slots, and passes that allocator's mechanism
+// to each 'KEY' that uses 'bslma'-style allocators.  If no allocator is
+// supplied, the currently installed default allocator is used.  A set
+// constructed with no capacity allocates no memory.
+//
+///Heterogeneous Lookup
+///--------------------
+// If both the 'HASH' and 'EQUAL' types are *transparent* (i.e., have a nested
+// type named 'is_transparent'), 'find', 'contains', 'count', and
+// 'equal_range' accept a key of any type for which the functors are callable,
+// avoiding the construction of a temporary 'KEY'.  Note that the hash of such
+// a key must equal the hash of any equal 'KEY'.
+//
+///Iterator and Reference Invalidation
+///-----------------------------------
+// Since keys are stored in the table itself, any operation that rebuilds the
+// table (i.e., 'rehash', 'reserve', and any insertion that causes the table
+// to grow) invalidates all iterators, pointers, and references to the keys of
+// the set.  Calling 'reserve' with the number of keys to be inserted
+// beforehand guarantees that those insertions do not rebuild the table.
+// Erasing a key invalidates only iterators, pointers, and references to the
+// erased key.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates
+///- - - - - - - - - - - - - - -
+// Suppose we receive a sequence of order identifiers, some of which are
+// repeated, and we want to process each distinct identifier once, in the
+// order first received.
+//
+// First, we define the sequence of identifiers:
+//..
+//  const int IDS[]   = { 17, 4, 17, 23, 4, 4, 8, 23, 42 };
+//  const int NUM_IDS = sizeof IDS / sizeof *IDS;
+//..
+// Then, we create a set to record the identifiers seen so far:
+//..
+//  bsl::flat_hash_set<int> seen;
+//..
+// Next, we process each identifier that 'insert' reports was not already
+// present:
+//..
+//  bsl::vector<int> processed;
+//  for (int i = 0; i < NUM_IDS; ++i) {
+//      if (seen.insert(IDS[i]).second) {
+//          processed.push_back(IDS[i]);
+//      }
+//  }
+//..
+// Finally, we verify that each identifier was processed once:
+//..
+//  assert(5  == processed.size());
+//  assert(17 == processed[0]);
+//  assert(42 == processed[4]);
+//  assert(5  == seen.size());
+//  assert(true == seen.contains(23));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_equalto.h>
+#include <bslstl_flathashtable.h>
+#include <bslstl_pair.h>
+
+#include <bslalg_hasstliterators.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_review.h>
+#include <bsls_util.h>
+
+#include <cstddef>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ============================
+                        // struct FlatHashSet_EntryUtil
+                        // ============================
+
+template <class KEY>
+struct FlatHashSet_EntryUtil {
+    // This 'struct' provides the operations on the 'KEY' entries of a
+    // 'bsl::flat_hash_set' required by 'FlatHashTable'.
+
+    // CLASS METHODS
+    template <class KEY_TYPE>
+    static void constructFromKey(
+                        KEY                                         *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+        // Create, at the specified 'entry' address, a 'KEY' from the specified
+        // 'key', using the specified 'allocator' to supply memory.
+
+    template <class ENTRY_TYPE>
+    static const ENTRY_TYPE& key(const ENTRY_TYPE& entry);
+        // Return the specified 'entry', which is its own key.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                            // ===================
+                            // class flat_hash_set
+                            // ===================
+
+template <class KEY,
+          class HASH  = BloombergLP::bslh::Hash<>,
+          class EQUAL = bsl::equal_to<KEY> >
+class flat_hash_set {
+    // This class template implements an open-addressed unordered set of
+    // unique keys of the (template parameter) type 'KEY', using the (template
+    // parameter) types 'HASH' and 'EQUAL' to hash and compare keys.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::FlatHashSet_EntryUtil<KEY> EntryUtil;
+
+    typedef BloombergLP::bslstl::FlatHashTable<KEY,
+                                               KEY,
+                                               EntryUtil,
+                                               HASH,
+                                               EQUAL>       ImplType;
+
+    typedef BloombergLP::bslmf::MovableRefUtil              MoveUtil;
+
+    // DATA
+    ImplType d_impl;  // underlying flat hash table
+
+    // FRIENDS
+    template <class K, class H, class E>
+    friend bool operator==(const flat_hash_set<K, H, E>&,
+                           const flat_hash_set<K, H, E>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                    key_type;
+    typedef KEY                                    value_type;
+    typedef std::size_t                            size_type;
+    typedef std::ptrdiff_t                         difference_type;
+    typedef HASH                                   hasher;
+    typedef EQUAL                                  key_equal;
+    typedef bsl::allocator<value_type>             allocator_type;
+    typedef value_type&                            reference;
+    typedef const value_type&                      const_reference;
+    typedef value_type                            *pointer;
+    typedef const value_type                      *const_pointer;
+    typedef typename ImplType::const_iterator      iterator;
+    typedef typename ImplType::const_iterator      const_iterator;
+
+    // CREATORS
+    flat_hash_set();
+    explicit flat_hash_set(const allocator_type& basicAllocator);
+    explicit flat_hash_set(size_type capacity);
+    flat_hash_set(size_type capacity, const allocator_type& basicAllocator);
+    flat_hash_set(size_type             capacity,
+                  const HASH&           hash,
+                  const allocator_type& basicAllocator = allocator_type());
+    flat_hash_set(size_type             capacity,
+                  const HASH&           hash,
+                  const EQUAL&          equal,
+                  const allocator_type& basicAllocator = allocator_type());
+        // Create an empty set.  Optionally specify a 'capacity' indicating the
+        // number of keys the set can hold without being rebuilt.  If
+        // 'capacity' is not supplied, or is 0, no memory is allocated.
+        // Optionally specify a 'hash' functor used to hash keys; if 'hash' is
+        // not supplied, a default-constructed 'HASH' is used.  Optionally
+        // specify an 'equal' functor used to compare keys; if 'equal' is not
+        // supplied, a default-constructed 'EQUAL' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, the currently installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    flat_hash_set(INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  const allocator_type& basicAllocator = allocator_type());
+    template <class INPUT_ITERATOR>
+    flat_hash_set(INPUT_ITERATOR        first,
+                  INPUT_ITERATOR        last,
+                  size_type             capacity,
+                  const HASH&           hash = HASH(),
+                  const EQUAL&          equal = EQUAL(),
+                  const allocator_type& basicAllocator = allocator_type());
+        // Create a set containing the distinct keys in the specified range
+        // '[first, last)'.  Optionally specify a 'capacity' indicating the
+        // number of keys the set can hold without being rebuilt.  Optionally
+        // specify a 'hash' functor used to hash keys; if 'hash' is not
+        // supplied, a default-constructed 'HASH' is used.  Optionally specify
+        // an 'equal' functor used to compare keys; if 'equal' is not
+        // supplied, a default-constructed 'EQUAL' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, the currently installed default allocator is used.
+        // The behavior is undefined unless '[first, last)' is a valid range of
+        // objects from which 'KEY' can be constructed.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_hash_set(std::initializer_list<KEY> values,
+                  const allocator_type&      basicAllocator =
+                                                             allocator_type());
+        // Create a set containing the distinct keys of the specified
+        // 'values'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is not supplied, the currently
+        // installed default allocator is used.
+#endif
+
+    flat_hash_set(const flat_hash_set&  original,
+                  const allocator_type& basicAllocator = allocator_type());
+        // Create a set having the same value, hash functor, and key-equality
+        // functor as the specified 'original' set.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, the currently installed default allocator is used.
+
+    flat_hash_set(BloombergLP::bslmf::MovableRef<flat_hash_set> original);
+                                                                    // IMPLICIT
+        // Create a set having the same value, hash functor, key-equality
+        // functor, and allocator as the specified 'original' set, leaving
+        // 'original' empty with no capacity.  No memory is allocated.
+
+    flat_hash_set(
+                 BloombergLP::bslmf::MovableRef<flat_hash_set> original,
+                 const allocator_type&                         basicAllocator);
+        // Create a set having the same value, hash functor, and key-equality
+        // functor as the specified 'original' set, using the specified
+        // 'basicAllocator' to supply memory.  If
+        // 'basicAllocator == original.get_allocator()', the contents of
+        // 'original' are moved (without allocating) and 'original' is left
+        // empty with no capacity; otherwise, 'original' is copied and left
+        // unchanged.
+
+    ~flat_hash_set();
+        // Destroy this object and each of its keys.
+
+    // MANIPULATORS
+    flat_hash_set& operator=(const flat_hash_set& rhs);
+        // Assign to this set the value, hash functor, and key-equality functor
+        // of the specified 'rhs' set, and return a reference providing
+        // modifiable access to this set.
+
+    flat_hash_set& operator=(
+                          BloombergLP::bslmf::MovableRef<flat_hash_set> rhs);
+        // Assign to this set the value, hash functor, and key-equality functor
+        // of the specified 'rhs' set, and return a reference providing
+        // modifiable access to this set.  If this set and 'rhs' use the same
+        // allocator, the contents of 'rhs' are moved (without allocating) and
+        // 'rhs' is left empty with no capacity; otherwise, 'rhs' is copied
+        // and left unchanged.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_hash_set& operator=(std::initializer_list<KEY> values);
+        // Assign to this set the distinct keys of the specified 'values', and
+        // return a reference providing modifiable access to this set.
+#endif
+
+    void clear();
+        // Remove all keys from this set.  Note that the capacity of the set is
+        // retained.
+
+    size_type erase(const KEY& key);
+        // Remove the specified 'key' from this set, if it is present, and
+        // return the number of keys removed (0 or 1).
+
+    const_iterator erase(const_iterator position);
+        // Remove from this set the key referred to by the specified
+        // 'position', and return an iterator referring to the key following
+        // it, or the past-the-end iterator if there is none.  The behavior is
+        // undefined unless 'position' refers to a key of this set.
+
+    const_iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the keys in the specified range
+        // '[first, last)', and return an iterator having the value of 'last'.
+        // The behavior is undefined unless '[first, last)' is a valid range
+        // of keys of this set.
+
+    template <class KEY_TYPE>
+    bsl::pair<const_iterator, bool>
+    insert(BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key);
+        // Insert the specified 'key' into this set if it is not already
+        // present.  Return a pair whose 'first' member refers to the key in
+        // this set equal to 'key', and whose 'second' member is 'true' if
+        // 'key' was inserted, and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set each key in the specified range
+        // '[first, last)' that is not already present.  The behavior is
+        // undefined unless '[first, last)' is a valid range of objects from
+        // which 'KEY' can be constructed.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<KEY> values);
+        // Insert into this set each of the specified 'values' that is not
+        // already present.
+#endif
+
+    void rehash(size_type minimumCapacity);
+        // Rebuild this set to have the smallest capacity that is at least the
+        // specified 'minimumCapacity' and can hold 'size()' keys without
+        // being rebuilt, discarding the slots of erased keys.  If the
+        // resulting capacity is 0, release all memory.  All iterators,
+        // pointers, and references to keys are invalidated.
+
+    void reserve(size_type numKeys);
+        // Ensure this set can hold at least the specified 'numKeys' keys
+        // without being rebuilt.  If the set is rebuilt, all iterators,
+        // pointers, and references to keys are invalidated.
+
+    void reset();
+        // Remove all keys from this set and release all memory.
+
+    void swap(flat_hash_set& other);
+        // Exchange the value, hash functor, and key-equality functor of this
+        // set with those of the specified 'other' set.  This method provides
+        // the no-throw exception-safety guarantee.  The behavior is undefined
+        // unless this set and 'other' use the same allocator.
+
+    // ACCESSORS
+    size_type capacity() const;
+        // Return the number of slots of this set.  Note that the set can hold
+        // up to 7/8 of its capacity in keys without being rebuilt.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set contains the specified 'key', and 'false'
+        // otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this set contains a key equal to the specified
+        // 'key', and 'false' otherwise.  This overload participates in
+        // overload resolution only if both 'HASH' and 'EQUAL' are
+        // transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.contains(key);
+    }
+
+    size_type count(const KEY& key) const;
+        // Return the number of keys in this set equal to the specified 'key'
+        // (0 or 1).
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of keys in this set equal to the specified 'key'
+        // (0 or 1).  This overload participates in overload resolution only
+        // if both 'HASH' and 'EQUAL' are transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.contains(key) ? 1 : 0;
+    }
+
+    bool empty() const;
+        // Return 'true' if this set has no keys, and 'false' otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of iterators defining the (empty or one-element)
+        // sequence of keys in this set equal to the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        bsl::pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators defining the (empty or one-element)
+        // sequence of keys in this set equal to the specified 'key'.  This
+        // overload participates in overload resolution only if both 'HASH'
+        // and 'EQUAL' are transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.equal_range(key);
+    }
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the key in this set equal to the
+        // specified 'key', or the past-the-end iterator if there is none.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+     && BloombergLP::bslmf::IsTransparentPredicate<EQUAL, LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator referring to the key in this set equal to the
+        // specified 'key', or the past-the-end iterator if there is none.
+        // This overload participates in overload resolution only if both
+        // 'HASH' and 'EQUAL' are transparent.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_impl.find(key);
+    }
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this set.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality functor of this set.
+
+    float load_factor() const;
+        // Return the ratio of the number of keys to the capacity of this set,
+        // or 0 if this set has no capacity.
+
+    float max_load_factor() const;
+        // Return the ratio of keys to capacity at which this set grows.
+
+    size_type size() const;
+        // Return the number of keys in this set.
+
+                             // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first key of this set, or the
+        // past-the-end iterator if this set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this set.
+
+                                // Aspects
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used by this set to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+bool operator==(const flat_hash_set<KEY, HASH, EQUAL>& lhs,
+                const flat_hash_set<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets have the same value,
+    // and 'false' otherwise.  Two sets have the same value if they have the
+    // same number of keys and each key of 'lhs' is contained in 'rhs'.
+
+template <class KEY, class HASH, class EQUAL>
+bool operator!=(const flat_hash_set<KEY, HASH, EQUAL>& lhs,
+                const flat_hash_set<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets do not have the same
+    // value, and 'false' otherwise.  Two sets do not have the same value if
+    // they do not have the same number of keys or some key of 'lhs' is not
+    // contained in 'rhs'.
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+void swap(flat_hash_set<KEY, HASH, EQUAL>& a,
+          flat_hash_set<KEY, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' sets.  If 'a' and 'b'
+    // use the same allocator, this function provides the no-throw
+    // exception-safety guarantee; otherwise, copies are made using each set's
+    // allocator.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ----------------------------
+                        // struct FlatHashSet_EntryUtil
+                        // ----------------------------
+
+// CLASS METHODS
+template <class KEY>
+template <class KEY_TYPE>
+inline
+void FlatHashSet_EntryUtil<KEY>::constructFromKey(
+                        KEY                                         *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bslma::ConstructionUtil::construct(
+                                 entry,
+                                 allocator,
+                                 BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+}
+
+template <class KEY>
+template <class ENTRY_TYPE>
+inline
+const ENTRY_TYPE& FlatHashSet_EntryUtil<KEY>::key(const ENTRY_TYPE& entry)
+{
+    return entry;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                            // -------------------
+                            // class flat_hash_set
+                            // -------------------
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::flat_hash_set()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::flat_hash_set(
+                                          const allocator_type& basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator.mechanism())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::flat_hash_set(size_type capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::flat_hash_set(
+                                          size_type             capacity,
+                                          const allocator_type& basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator.mechanism())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::flat_hash_set(
+                                          size_type             capacity,
+                                          const HASH&           hash,
+                                          const allocator_type& basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator.mechanism())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::flat_hash_set(
+                                          size_type             capacity,
+                                          const HASH&           hash,
+                                          const EQUAL&          equal,
+                                          const allocator_type& basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator.mechanism())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::flat_hash_set(
+                                          INPUT_ITERATOR        first,
+                                          INPUT_ITERATOR        last,
+                                          const allocator_type& basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator.mechanism())
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::flat_hash_set(
+                                          INPUT_ITERATOR        first,
+                                          INPUT_ITERATOR        last,
+                                          size_type             capacity,
+                                          const HASH&           hash,
+                                          const EQUAL&          equal,
+                                          const allocator_type& basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator.mechanism())
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::flat_hash_set(
+                                     std::initializer_list<KEY> values,
+                                     const allocator_type&      basicAllocator)
+: d_impl(values.size(), HASH(), EQUAL(), basicAllocator.mechanism())
+{
+    d_impl.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::flat_hash_set(
+                                          const flat_hash_set&  original,
+                                          const allocator_type& basicAllocator)
+: d_impl(original.d_impl, basicAllocator.mechanism())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::flat_hash_set(
+                       BloombergLP::bslmf::MovableRef<flat_hash_set> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::flat_hash_set(
+                 BloombergLP::bslmf::MovableRef<flat_hash_set> original,
+                 const allocator_type&                         basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl),
+         basicAllocator.mechanism())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>::~flat_hash_set()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>&
+flat_hash_set<KEY, HASH, EQUAL>::operator=(const flat_hash_set& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>&
+flat_hash_set<KEY, HASH, EQUAL>::operator=(
+                           BloombergLP::bslmf::MovableRef<flat_hash_set> rhs)
+{
+    d_impl = MoveUtil::move(MoveUtil::access(rhs).d_impl);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL>
+inline
+flat_hash_set<KEY, HASH, EQUAL>&
+flat_hash_set<KEY, HASH, EQUAL>::operator=(std::initializer_list<KEY> values)
+{
+    flat_hash_set tmp(values.begin(),
+                      values.end(),
+                      values.size(),
+                      d_impl.hash_function(),
+                      d_impl.key_eq(),
+                      get_allocator());
+    d_impl.swap(tmp.d_impl);
+    return *this;
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void flat_hash_set<KEY, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL>::size_type
+flat_hash_set<KEY, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL>::erase(const_iterator first,
+                                       const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class KEY_TYPE>
+inline
+bsl::pair<typename flat_hash_set<KEY, HASH, EQUAL>::const_iterator, bool>
+flat_hash_set<KEY, HASH, EQUAL>::insert(
+                               BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+{
+    bsl::pair<typename ImplType::iterator, bool> result =
+                  d_impl.insert(BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+
+    return bsl::pair<const_iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void flat_hash_set<KEY, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                             INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL>
+inline
+void flat_hash_set<KEY, HASH, EQUAL>::insert(
+                                             std::initializer_list<KEY> values)
+{
+    d_impl.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void flat_hash_set<KEY, HASH, EQUAL>::rehash(size_type minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void flat_hash_set<KEY, HASH, EQUAL>::reserve(size_type numKeys)
+{
+    d_impl.reserve(numKeys);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void flat_hash_set<KEY, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void flat_hash_set<KEY, HASH, EQUAL>::swap(flat_hash_set& other)
+{
+    BSLS_ASSERT(get_allocator() == other.get_allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL>::size_type
+flat_hash_set<KEY, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool flat_hash_set<KEY, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL>::size_type
+flat_hash_set<KEY, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool flat_hash_set<KEY, HASH, EQUAL>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename flat_hash_set<KEY, HASH, EQUAL>::const_iterator,
+          typename flat_hash_set<KEY, HASH, EQUAL>::const_iterator>
+flat_hash_set<KEY, HASH, EQUAL>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+HASH flat_hash_set<KEY, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+EQUAL flat_hash_set<KEY, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float flat_hash_set<KEY, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float flat_hash_set<KEY, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL>::size_type
+flat_hash_set<KEY, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                             // Iterators
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL>::const_iterator
+flat_hash_set<KEY, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+                                // Aspects
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename flat_hash_set<KEY, HASH, EQUAL>::allocator_type
+flat_hash_set<KEY, HASH, EQUAL>::get_allocator() const
+{
+    return allocator_type(d_impl.allocator());
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bsl::operator==(const bsl::flat_hash_set<KEY, HASH, EQUAL>& lhs,
+                     const bsl::flat_hash_set<KEY, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bsl::operator!=(const bsl::flat_hash_set<KEY, HASH, EQUAL>& lhs,
+                     const bsl::flat_hash_set<KEY, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+inline
+void bsl::swap(bsl::flat_hash_set<KEY, HASH, EQUAL>& a,
+               bsl::flat_hash_set<KEY, HASH, EQUAL>& b)
+{
+    typedef bsl::flat_hash_set<KEY, HASH, EQUAL> Set;
+
+    if (a.get_allocator() == b.get_allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    Set futureA(b, a.get_allocator());
+    Set futureB(a, b.get_allocator());
+
+    a = BloombergLP::bslmf::MovableRefUtil::move(futureA);
+    b = BloombergLP::bslmf::MovableRefUtil::move(futureB);
+}
+
+// ============================================================================
+//                              TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'bsl::flat_hash_set':
+//: o A flat hash set defines STL iterators.
+//: o A flat hash set uses 'bslma' allocators.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class HASH, class EQUAL>
+struct HasStlIterators<bsl::flat_hash_set<KEY, HASH, EQUAL> >
+: bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bsl::flat_hash_set<KEY, HASH, EQUAL> >
+: bsl::true_type
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1273 @@
+// bslstl_flathashset.t.cpp                                           -*-C++-*-
+#include <bslstl_flathashset.h>
+
+#include <bslstl_equalto.h>
+#include <bslstl_hash.h>
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_stringview.h>
+#include <bslstl_unorderedset.h>
+#include <bslstl_vector.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_issame.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <cstddef>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bsl::flat_hash_set' is a thin adapter of 'bslstl::FlatHashTable', which is
+// thoroughly tested in its own component.  The concerns here are that each
+// method forwards correctly, that the set exposes only non-modifiable access
+// to its keys, that heterogeneous lookup is enabled exactly when both
+// functors are transparent, and that the allocator is used and propagated.  A
+// negative test case compares the speed of 'bsl::flat_hash_set' with that of
+// 'bsl::unordered_set'.
+//-----------------------------------------------------------------------------
+// CLASS 'bslstl::FlatHashSet_EntryUtil'
+// [ 2] void constructFromKey(KEY *, Allocator *, KEY_TYPE&&);
+// [ 2] const ENTRY_TYPE& key(const ENTRY_TYPE&);
+//
+// CLASS 'bsl::flat_hash_set'
+// CREATORS
+// [ 3] flat_hash_set();
+// [ 3] flat_hash_set(const A&);
+// [ 3] flat_hash_set(size_t);
+// [ 3] flat_hash_set(size_t, const A&);
+// [ 3] flat_hash_set(size_t, const HASH&, const A& = A());
+// [ 3] flat_hash_set(size_t, const HASH&, const EQUAL&, const A& = A());
+// [ 3] flat_hash_set(INPUT_ITER, INPUT_ITER, const A& = A());
+// [ 3] flat_hash_set(INPUT_ITER, INPUT_ITER, size_t, ...);
+// [ 3] flat_hash_set(initializer_list<KEY>, const A& = A());
+// [ 6] flat_hash_set(const flat_hash_set&, const A& = A());
+// [ 6] flat_hash_set(MovableRef<flat_hash_set>);
+// [ 6] flat_hash_set(MovableRef<flat_hash_set>, const A&);
+// [ 3] ~flat_hash_set();
+//
+// MANIPULATORS
+// [ 6] flat_hash_set& operator=(const flat_hash_set&);
+// [ 6] flat_hash_set& operator=(MovableRef<flat_hash_set>);
+// [ 6] flat_hash_set& operator=(initializer_list<KEY>);
+// [ 4] void clear();
+// [ 4] size_t erase(const KEY&);
+// [ 4] const_iterator erase(const_iterator);
+// [ 4] const_iterator erase(const_iterator, const_iterator);
+// [ 4] pair<const_iterator, bool> insert(KEY_TYPE&&);
+// [ 4] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insert(initializer_list<KEY>);
+// [ 4] void rehash(size_t);
+// [ 4] void reserve(size_t);
+// [ 4] void reset();
+// [ 6] void swap(flat_hash_set&);
+//
+// ACCESSORS
+// [ 3] size_t capacity() const;
+// [ 4] bool contains(const KEY&) const;
+// [ 5] bool contains(const LOOKUP_KEY&) const;
+// [ 4] size_t count(const KEY&) const;
+// [ 5] size_t count(const LOOKUP_KEY&) const;
+// [ 3] bool empty() const;
+// [ 4] pair<CIter, CIter> equal_range(const KEY&) const;
+// [ 5] pair<CIter, CIter> equal_range(const LOOKUP_KEY&) const;
+// [ 4] const_iterator find(const KEY&) const;
+// [ 5] const_iterator find(const LOOKUP_KEY&) const;
+// [ 3] HASH hash_function() const;
+// [ 3] EQUAL key_eq() const;
+// [ 3] float load_factor() const;
+// [ 3] float max_load_factor() const;
+// [ 3] size_t size() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 3] allocator_type get_allocator() const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const flat_hash_set&, const flat_hash_set&);
+// [ 6] bool operator!=(const flat_hash_set&, const flat_hash_set&);
+//
+// FREE FUNCTIONS
+// [ 6] void swap(flat_hash_set&, flat_hash_set&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'bsl::unordered_set'
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsl::flat_hash_set<int>                          Obj;
+typedef bsl::flat_hash_set<bsl::string>                  StringObj;
+typedef bslstl::FlatHashSet_EntryUtil<bsl::string>        StringEntryUtil;
+
+                           // ====================
+                           // struct StringViewHash
+                           // ====================
+
+struct StringViewHash {
+    // This transparent hash functor hashes any string-like key as a
+    // 'bsl::string_view', so that equal strings of different types have equal
+    // hash values.
+
+    typedef void is_transparent;
+
+    std::size_t operator()(const bsl::string_view& key) const
+        // Return the hash value of the specified 'key'.
+    {
+        return bslh::Hash<>()(key);
+    }
+
+    std::size_t operator()(const bsl::string& key) const
+        // Return the hash value of the specified 'key'.
+    {
+        return (*this)(bsl::string_view(key.data(), key.length()));
+    }
+
+    std::size_t operator()(const char *key) const
+        // Return the hash value of the specified null-terminated 'key'.
+    {
+        return (*this)(bsl::string_view(key));
+    }
+};
+
+                          // =====================
+                          // struct StringViewEqual
+                          // =====================
+
+struct StringViewEqual {
+    // This transparent functor compares any string-like keys as
+    // 'bsl::string_view' objects.
+
+    typedef void is_transparent;
+
+    template <class LHS, class RHS>
+    bool operator()(const LHS& lhs, const RHS& rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' strings are equal,
+        // and 'false' otherwise.
+    {
+        return view(lhs) == view(rhs);
+    }
+
+    static bsl::string_view view(const bsl::string_view& value)
+        // Return the specified 'value'.
+    {
+        return value;
+    }
+
+    static bsl::string_view view(const bsl::string& value)
+        // Return a view of the specified 'value'.
+    {
+        return bsl::string_view(value.data(), value.length());
+    }
+
+    static bsl::string_view view(const char *value)
+        // Return a view of the specified null-terminated 'value'.
+    {
+        return bsl::string_view(value);
+    }
+};
+
+typedef bsl::flat_hash_set<bsl::string, StringViewHash, StringViewEqual>
+                                                        TransparentObj;
+
+                          // ========================
+                          // struct StringLengthHash
+                          // ========================
+
+struct StringLengthHash {
+    // This non-transparent hash functor hashes a string to its length, and
+    // counts the number of times it is invoked.
+
+    static int s_numCalls;
+
+    std::size_t operator()(const bsl::string& key) const
+        // Return the length of the specified 'key'.
+    {
+        ++s_numCalls;
+        return key.length();
+    }
+};
+
+int StringLengthHash::s_numCalls = 0;
+
+typedef bsl::flat_hash_set<bsl::string, StringLengthHash> LengthObj;
+
+static bsls::Types::Uint64 s_random = 0x2545f4914f6cdd1dULL;
+
+static bsls::Types::Uint64 nextRandom()
+    // Return the next value of a deterministic pseudo-random sequence.
+{
+    s_random ^= s_random << 13;
+    s_random ^= s_random >> 7;
+    s_random ^= s_random << 17;
+    return s_random;
+}
+
+static void makeKeys(bsl::vector<int> *keys, std::size_t numKeys)
+    // Load into the specified 'keys' the specified 'numKeys' distinct
+    // pseudo-random integers.
+{
+    keys->clear();
+    keys->reserve(numKeys);
+    for (std::size_t i = 0; i < numKeys; ++i) {
+        // Bijective in 'i', so the keys are distinct.
+
+        keys->push_back(static_cast<int>((i * 0x9e3779b1u) ^ 0x5bd1e995u));
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates
+///- - - - - - - - - - - - - - -
+// Suppose we receive a sequence of order identifiers, some of which are
+// repeated, and we want to process each distinct identifier once, in the
+// order first received.
+//
+// First, we define the sequence of identifiers:
+//..
+    const int IDS[]   = { 17, 4, 17, 23, 4, 4, 8, 23, 42 };
+    const int NUM_IDS = sizeof IDS / sizeof *IDS;
+//..
+// Then, we create a set to record the identifiers seen so far:
+//..
+    bsl::flat_hash_set<int> seen;
+//..
+// Next, we process each identifier that 'insert' reports was not already
+// present:
+//..
+    bsl::vector<int> processed;
+    for (int i = 0; i < NUM_IDS; ++i) {
+        if (seen.insert(IDS[i]).second) {
+            processed.push_back(IDS[i]);
+        }
+    }
+//..
+// Finally, we verify that each identifier was processed once:
+//..
+    ASSERT(5  == processed.size());
+    ASSERT(17 == processed[0]);
+    ASSERT(42 == processed[4]);
+    ASSERT(5  == seen.size());
+    ASSERT(true == seen.contains(23));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY
+        //   Ensure the value-semantic operations forward to the table and
+        //   respect allocators.
+        //
+        // Concerns:
+        //: 1 A copy has the value of the original and uses the supplied (or
+        //:   default) allocator.
+        //:
+        //: 2 A move without an allocator, or with the allocator of the
+        //:   original, allocates nothing and leaves the original empty; a
+        //:   move with another allocator copies.
+        //:
+        //: 3 Assignment gives the target the value of the source, and
+        //:   move-assignment between sets with the same allocator allocates
+        //:   nothing.
+        //:
+        //: 4 'swap' exchanges values; the free 'swap' works across
+        //:   allocators.
+        //:
+        //: 5 Sets are equal exactly when they have the same keys, regardless
+        //:   of insertion order or capacity.
+        //
+        // Plan:
+        //: 1 Create sets of strings (which allocate) and apply each operation,
+        //:   checking values and allocator usage.  (C-1..5)
+        //
+        // Testing:
+        //   flat_hash_set(const flat_hash_set&, const A& = A());
+        //   flat_hash_set(MovableRef<flat_hash_set>);
+        //   flat_hash_set(MovableRef<flat_hash_set>, const A&);
+        //   flat_hash_set& operator=(const flat_hash_set&);
+        //   flat_hash_set& operator=(MovableRef<flat_hash_set>);
+        //   flat_hash_set& operator=(initializer_list<KEY>);
+        //   void swap(flat_hash_set&);
+        //   bool operator==(const flat_hash_set&, const flat_hash_set&);
+        //   bool operator!=(const flat_hash_set&, const flat_hash_set&);
+        //   void swap(flat_hash_set&, flat_hash_set&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY"
+                            "\n==========================================\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator za("other",  veryVerbose);
+
+        const char LONG[] = "a string too long for the short string buffer";
+
+        StringObj mW(&oa);  const StringObj& W = mW;
+        for (int i = 0; i < 50; ++i) {
+            mW.insert(bsl::string(LONG) + char('A' + i % 26)
+                                                         + char('0' + i / 26));
+        }
+        ASSERT(50 == W.size());
+
+        if (verbose) printf("\tTesting equality.\n");
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+            ASSERT(  X != W);
+
+            mX.reserve(1000);
+            for (StringObj::const_iterator it = W.begin(); it != W.end();
+                                                                        ++it) {
+                mX.insert(*it);
+            }
+            ASSERT(  X == W);
+            ASSERT(!(X != W));
+
+            mX.erase(X.begin());
+            mX.insert("different");
+            ASSERT(  X != W);
+            ASSERT(!(X == W));
+        }
+
+        if (verbose) printf("\tTesting copy construction.\n");
+        {
+            bsls::Types::Int64 numDefault = defaultAllocator.numBlocksTotal();
+
+            StringObj mX(W, &za);  const StringObj& X = mX;
+            ASSERT(X == W);
+            ASSERT(&za == X.get_allocator().mechanism());
+            ASSERT(&za == X.begin()->get_allocator().mechanism());
+            ASSERT(numDefault == defaultAllocator.numBlocksTotal());
+
+            StringObj mY(W);  const StringObj& Y = mY;
+            ASSERT(Y == W);
+            ASSERT(&defaultAllocator == Y.get_allocator().mechanism());
+        }
+        ASSERT(0 == za.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\tTesting move construction.\n");
+        {
+            StringObj mS(W, &oa);
+
+            bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+
+            StringObj mX(bslmf::MovableRefUtil::move(mS));
+            const StringObj& X = mX;
+            ASSERT(X == W);
+            ASSERT(0 == mS.size());
+            ASSERT(0 == mS.capacity());
+            ASSERT(&oa == X.get_allocator().mechanism());
+            ASSERT(numBlocks == oa.numBlocksTotal());
+
+            StringObj mY(bslmf::MovableRefUtil::move(mX), &oa);
+            const StringObj& Y = mY;
+            ASSERT(Y == W);
+            ASSERT(0 == X.size());
+            ASSERT(numBlocks == oa.numBlocksTotal());
+
+            StringObj mZ(bslmf::MovableRefUtil::move(mY), &za);
+            const StringObj& Z = mZ;
+            ASSERT(Z == W);
+            ASSERT(Y == W);
+            ASSERT(&za == Z.get_allocator().mechanism());
+            ASSERT(0 < za.numBlocksInUse());
+        }
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tTesting assignment.\n");
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+            mX.insert("x");
+
+            mX = W;
+            ASSERT(X == W);
+            ASSERT(&oa == X.get_allocator().mechanism());
+
+            StringObj mY(&oa);  const StringObj& Y = mY;
+
+            bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+
+            mY = bslmf::MovableRefUtil::move(mX);
+            ASSERT(Y == W);
+            ASSERT(numBlocks == oa.numBlocksTotal());
+
+            StringObj mZ(&za);  const StringObj& Z = mZ;
+            mZ = bslmf::MovableRefUtil::move(mY);
+            ASSERT(Z == W);
+            ASSERT(Y == W);
+            ASSERT(&za == Z.get_allocator().mechanism());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mZ = { "a", "b", "a" };
+            ASSERT(2   == Z.size());
+            ASSERT(Z.contains("b"));
+            ASSERT(&za == Z.get_allocator().mechanism());
+#endif
+        }
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tTesting swap.\n");
+        {
+            StringObj mX(W, &oa);  const StringObj& X = mX;
+            StringObj mY(&oa);     const StringObj& Y = mY;
+            mY.insert("only");
+
+            const StringObj YY(Y, &oa);
+
+            bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+
+            mX.swap(mY);
+            ASSERT(X == YY);
+            ASSERT(Y == W);
+
+            swap(mX, mY);
+            ASSERT(X == W);
+            ASSERT(Y == YY);
+            ASSERT(numBlocks == oa.numBlocksTotal());
+
+            StringObj mZ(&za);  const StringObj& Z = mZ;
+            swap(mX, mZ);
+            ASSERT(Z == W);
+            ASSERT(0 == X.size());
+            ASSERT(&za == Z.get_allocator().mechanism());
+            ASSERT(&oa == X.get_allocator().mechanism());
+        }
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            StringObj mX(&oa);
+            StringObj mY(&oa);
+            StringObj mZ(&za);
+
+            ASSERT_PASS(mX.swap(mY));
+            ASSERT_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // HETEROGENEOUS LOOKUP
+        //   Ensure the lookup templates are used exactly when both functors
+        //   are transparent.
+        //
+        // Concerns:
+        //: 1 If 'HASH' and 'EQUAL' are transparent, 'find', 'contains',
+        //:   'count', and 'equal_range' accept a key of another type without
+        //:   creating a 'KEY' (and so without allocating).
+        //:
+        //: 2 If the functors are not transparent, a key of another type is
+        //:   converted to 'KEY' before lookup.
+        //
+        // Plan:
+        //: 1 Look up 'string_view' and 'const char *' keys in a set of
+        //:   strings having transparent functors, using a default allocator
+        //:   that would record the creation of a temporary long string.  (C-1)
+        //:
+        //: 2 Look up 'const char *' keys in a set whose hash functor counts
+        //:   its calls and is not transparent, and verify the default
+        //:   allocator is used for the temporary 'KEY'.  (C-2)
+        //
+        // Testing:
+        //   bool contains(const LOOKUP_KEY&) const;
+        //   size_t count(const LOOKUP_KEY&) const;
+        //   pair<CIter, CIter> equal_range(const LOOKUP_KEY&) const;
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHETEROGENEOUS LOOKUP"
+                            "\n====================\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        const char *KEYS[] = {
+            "the first key, long enough to allocate when copied",
+            "the second key, long enough to allocate when copied",
+            "a third key, which is also long enough to allocate"
+        };
+        const int NUM_KEYS = static_cast<int>(sizeof KEYS / sizeof *KEYS);
+
+        const char MISSING[] = "a missing key, long enough to allocate memory";
+
+        if (verbose) printf("\tTesting transparent functors.\n");
+        {
+            TransparentObj mX(&oa);  const TransparentObj& X = mX;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.insert(KEYS[i]);
+            }
+
+            bsls::Types::Int64 numDefault = defaultAllocator.numBlocksTotal();
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const bsl::string_view KEY(KEYS[i]);
+
+                ASSERTV(i, KEYS[i] == *X.find(KEY));
+                ASSERTV(i, KEYS[i] == *X.find(KEYS[i]));
+                ASSERTV(i, X.contains(KEY));
+                ASSERTV(i, 1 == X.count(KEY));
+
+                bsl::pair<TransparentObj::const_iterator,
+                          TransparentObj::const_iterator> R =
+                                                           X.equal_range(KEY);
+                ASSERTV(i, R.first == X.find(KEY));
+                ASSERTV(i, 1 == bsl::distance(R.first, R.second));
+            }
+
+            const bsl::string_view MISSING_VIEW(MISSING);
+
+            ASSERT(X.end() == X.find(MISSING_VIEW));
+            ASSERT(false   == X.contains(MISSING_VIEW));
+            ASSERT(0       == X.count(MISSING));
+            ASSERT(X.equal_range(MISSING_VIEW).first ==
+                                         X.equal_range(MISSING_VIEW).second);
+
+            ASSERT(numDefault == defaultAllocator.numBlocksTotal());
+        }
+
+        if (verbose) printf("\tTesting non-transparent functors.\n");
+        {
+            LengthObj mX(&oa);  const LengthObj& X = mX;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.insert(KEYS[i]);
+            }
+
+            bsls::Types::Int64 numDefault = defaultAllocator.numBlocksTotal();
+            StringLengthHash::s_numCalls = 0;
+
+            ASSERT(X.contains(KEYS[0]));
+            ASSERT(1 == X.count(KEYS[1]));
+            ASSERT(X.end() == X.find(MISSING));
+
+            ASSERT(3 == StringLengthHash::s_numCalls);
+            ASSERT(numDefault + 3 == defaultAllocator.numBlocksTotal());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND LOOKUP
+        //   Ensure the manipulators and lookup methods behave as specified.
+        //
+        // Concerns:
+        //: 1 'insert' inserts a key only if it is absent, and indicates
+        //:   whether it did.
+        //:
+        //: 2 Each form of 'erase' removes the specified keys and returns the
+        //:   documented result.
+        //:
+        //: 3 'find', 'contains', 'count', and 'equal_range' agree with the
+        //:   contents of the set.
+        //:
+        //: 4 'clear' retains the capacity; 'reset' releases all memory;
+        //:   'reserve' and 'rehash' ensure the requested capacity.
+        //
+        // Plan:
+        //: 1 Apply pseudo-random operations to a set and to a
+        //:   'bsl::unordered_set' oracle, verifying the results of each and
+        //:   periodically verifying the sets have the same contents.
+        //:   (C-1..3)
+        //:
+        //: 2 Directly test the range forms of 'insert' and 'erase', and the
+        //:   capacity-related methods.  (C-1..2, 4)
+        //
+        // Testing:
+        //   void clear();
+        //   size_t erase(const KEY&);
+        //   const_iterator erase(const_iterator);
+        //   const_iterator erase(const_iterator, const_iterator);
+        //   pair<const_iterator, bool> insert(KEY_TYPE&&);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<KEY>);
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        //   bool contains(const KEY&) const;
+        //   size_t count(const KEY&) const;
+        //   pair<CIter, CIter> equal_range(const KEY&) const;
+        //   const_iterator find(const KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS AND LOOKUP"
+                            "\n=======================\n");
+
+        bslma::TestAllocator oa("object",  veryVerbose);
+        bslma::TestAllocator sa("scratch", veryVerbose);
+
+        if (verbose) printf("\tTesting against an oracle.\n");
+        {
+            typedef bsl::unordered_set<int> Oracle;
+
+            Obj    mX(&oa);  const Obj& X = mX;
+            Oracle oracle(&sa);
+
+            for (int op = 0; op < 20000; ++op) {
+                const bsls::Types::Uint64 R   = nextRandom();
+                const int                 KEY = static_cast<int>(R % 500);
+
+                switch ((R >> 32) % 5) {
+                  case 0: {
+                    bsl::pair<Obj::const_iterator, bool> r = mX.insert(KEY);
+                    ASSERTV(op, oracle.insert(KEY).second == r.second);
+                    ASSERTV(op, KEY == *r.first);
+                  } break;
+                  case 1: {
+                    ASSERTV(op, oracle.erase(KEY) == mX.erase(KEY));
+                  } break;
+                  case 2: {
+                    Obj::const_iterator it = X.find(KEY);
+                    ASSERTV(op, (it == X.end()) == (0 == oracle.count(KEY)));
+                    if (it != X.end()) {
+                        ASSERTV(op, KEY == *it);
+
+                        Obj::const_iterator next = it;
+                        ++next;
+                        ASSERTV(op, next == mX.erase(it));
+                        oracle.erase(KEY);
+                    }
+                  } break;
+                  case 3: {
+                    bsl::pair<Obj::const_iterator, Obj::const_iterator> r =
+                                                          X.equal_range(KEY);
+                    ASSERTV(op, oracle.count(KEY) ==
+                               static_cast<std::size_t>(
+                                        bsl::distance(r.first, r.second)));
+                  } break;
+                  default: {
+                    ASSERTV(op, oracle.count(KEY) == X.count(KEY));
+                    ASSERTV(op, (0 != oracle.count(KEY)) == X.contains(KEY));
+                  } break;
+                }
+
+                ASSERTV(op, oracle.size() == X.size());
+                if (0 == op % 100) {
+                    for (Oracle::const_iterator it = oracle.begin();
+                                                 it != oracle.end(); ++it) {
+                        ASSERTV(op, X.contains(*it));
+                    }
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting range 'insert' and 'erase'.\n");
+        {
+            const int KEYS[]   = { 1, 2, 1, 3 };
+            const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.insert(KEYS, KEYS + NUM_KEYS);
+            ASSERT(3 == X.size());
+            ASSERT(X.contains(3));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.insert({ 4, 3 });
+            ASSERT(4 == X.size());
+#else
+            mX.insert(4);
+#endif
+
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(0 == X.size());
+        }
+
+        if (verbose) printf("\tTesting capacity methods.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.reserve(100);
+            const std::size_t CAPACITY = X.capacity();
+            ASSERT(100 <= CAPACITY - CAPACITY / 8);
+
+            bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(numBlocks == oa.numBlocksTotal());
+
+            mX.clear();
+            ASSERT(0        == X.size());
+            ASSERT(CAPACITY == X.capacity());
+
+            mX.insert(1);
+            mX.rehash(0);
+            ASSERT(1 == X.size());
+            ASSERT(CAPACITY > X.capacity());
+
+            mX.rehash(1000);
+            ASSERT(1000 <= X.capacity());
+            ASSERT(X.contains(1));
+
+            mX.reset();
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //   Ensure each constructor creates the documented set, and the basic
+        //   accessors report its state.
+        //
+        // Concerns:
+        //: 1 Each constructor uses the supplied allocator, or the default
+        //:   allocator if none is supplied.
+        //:
+        //: 2 A set constructed with no capacity allocates no memory; one
+        //:   constructed with a capacity can hold that many keys without
+        //:   allocating.
+        //:
+        //: 3 The supplied functors are used, and reported by 'hash_function'
+        //:   and 'key_eq'.  The default hash functor is 'bslh::Hash<>', and
+        //:   'bsl::hash<KEY>' may be supplied instead.
+        //:
+        //: 4 The range constructors insert each distinct key.
+        //:
+        //: 5 The accessors and iterators report the state of the set, and the
+        //:   allocator is propagated to the keys.
+        //
+        // Plan:
+        //: 1 Create sets with each constructor and verify their state and the
+        //:   memory allocated.  (C-1..5)
+        //
+        // Testing:
+        //   flat_hash_set();
+        //   flat_hash_set(const A&);
+        //   flat_hash_set(size_t);
+        //   flat_hash_set(size_t, const A&);
+        //   flat_hash_set(size_t, const HASH&, const A& = A());
+        //   flat_hash_set(size_t, const HASH&, const EQUAL&, const A& = A());
+        //   flat_hash_set(INPUT_ITER, INPUT_ITER, const A& = A());
+        //   flat_hash_set(INPUT_ITER, INPUT_ITER, size_t, ...);
+        //   flat_hash_set(initializer_list<KEY>, const A& = A());
+        //   ~flat_hash_set();
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   allocator_type get_allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND BASIC ACCESSORS"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        if (verbose) printf("\tTesting constructors without a range.\n");
+        {
+            {
+                Obj mX;  const Obj& X = mX;
+                ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+                ASSERT(0 == X.capacity());
+                ASSERT(X.empty());
+                ASSERT(X.begin() == X.end());
+                ASSERT(0.0f == X.load_factor());
+                ASSERT(0.875f == X.max_load_factor());
+            }
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                ASSERT(&oa == X.get_allocator().mechanism());
+                ASSERT(0 == X.capacity());
+            }
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+            {
+                Obj mX(100);  const Obj& X = mX;
+                ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+                ASSERT(100 <= X.capacity());
+                ASSERT(1 == defaultAllocator.numBlocksInUse());
+            }
+            {
+                Obj mX(100, &oa);  const Obj& X = mX;
+                ASSERT(&oa == X.get_allocator().mechanism());
+
+                bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+                for (int i = 0; i < 100; ++i) {
+                    mX.insert(i);
+                }
+                ASSERT(numBlocks == oa.numBlocksTotal());
+                ASSERT(100 == X.size());
+                ASSERT(!X.empty());
+                ASSERT(static_cast<float>(X.size()) /
+                       static_cast<float>(X.capacity()) == X.load_factor());
+            }
+            {
+                LengthObj mX(10, StringLengthHash(), &oa);
+                const LengthObj& X = mX;
+                ASSERT(&oa == X.get_allocator().mechanism());
+
+                StringLengthHash::s_numCalls = 0;
+                mX.insert("abc");
+                X.hash_function()("abcd");
+                ASSERT(2 == StringLengthHash::s_numCalls);
+            }
+            {
+                TransparentObj mX(10,
+                                  StringViewHash(),
+                                  StringViewEqual(),
+                                  &oa);
+                const TransparentObj& X = mX;
+                ASSERT(&oa == X.get_allocator().mechanism());
+                ASSERT(10 <= X.capacity());
+                ASSERT(X.key_eq()("abc", bsl::string("abc")));
+            }
+            {
+                ASSERT((bsl::is_same<Obj::hasher, bslh::Hash<> >::value));
+
+                typedef bsl::flat_hash_set<int, bsl::hash<int> > StdObj;
+
+                StdObj mX(10, bsl::hash<int>(), &oa);  const StdObj& X = mX;
+                for (int i = 0; i < 10; ++i) {
+                    mX.insert(i);
+                }
+                ASSERT(10 == X.size());
+                ASSERT(X.contains(7));
+                ASSERT(3 == X.hash_function()(3));
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tTesting constructors from a range.\n");
+        {
+            const int KEYS[]   = { 1, 2, 1, 3 };
+            const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+            {
+                Obj mX(KEYS, KEYS + NUM_KEYS, &oa);  const Obj& X = mX;
+                ASSERT(&oa == X.get_allocator().mechanism());
+                ASSERT(3 == X.size());
+                ASSERT(X.contains(1));
+                ASSERT(X.contains(3));
+            }
+            {
+                Obj mX(KEYS,
+                       KEYS + NUM_KEYS,
+                       100,
+                       bslh::Hash<>(),
+                       bsl::equal_to<int>(),
+                       &oa);
+                const Obj& X = mX;
+                ASSERT(&oa == X.get_allocator().mechanism());
+                ASSERT(100 <= X.capacity());
+                ASSERT(3 == X.size());
+            }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            {
+                Obj mX({ 1, 2, 1 }, &oa);  const Obj& X = mX;
+                ASSERT(&oa == X.get_allocator().mechanism());
+                ASSERT(2 == X.size());
+                ASSERT(X.contains(2));
+            }
+#endif
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tTesting iteration and allocator use.\n");
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(bsl::string(40, char('A' + i % 26))
+                                                         + char('0' + i / 26));
+            }
+            ASSERT(100 == X.size());
+
+            std::size_t count = 0;
+            for (StringObj::const_iterator it = X.begin(); it != X.end();
+                                                                        ++it) {
+                ASSERT(&oa == it->get_allocator().mechanism());
+                ++count;
+            }
+            ASSERT(100 == count);
+
+            count = 0;
+            for (StringObj::const_iterator it = X.cbegin(); it != X.cend();
+                                                                        ++it) {
+                ++count;
+            }
+            ASSERT(100 == count);
+            ASSERT(X.begin() == X.cbegin());
+            ASSERT(X.end()   == X.cend());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'FlatHashSet_EntryUtil'
+        //   Ensure the entry utility creates entries and extracts keys.
+        //
+        // Concerns:
+        //: 1 'constructFromKey' creates a copy of the key using the supplied
+        //:   allocator.
+        //:
+        //: 2 'constructFromKey' accepts a key of a type convertible to 'KEY'.
+        //:
+        //: 3 'key' returns a reference to the entry itself.
+        //
+        // Plan:
+        //: 1 Create entries from keys of type 'string' and 'const char *',
+        //:   and verify their value and allocator.  (C-1..3)
+        //
+        // Testing:
+        //   void constructFromKey(KEY *, Allocator *, KEY_TYPE&&);
+        //   const ENTRY_TYPE& key(const ENTRY_TYPE&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'FlatHashSet_EntryUtil'"
+                            "\n=======================\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        const char LONG[] = "a key long enough not to fit in a short string";
+
+        {
+            bsls::ObjectBuffer<bsl::string> buffer;
+
+            const bsl::string KEY(LONG, &oa);
+            StringEntryUtil::constructFromKey(buffer.address(), &oa, KEY);
+            const bsl::string& ENTRY = buffer.object();
+
+            ASSERT(KEY == ENTRY);
+            ASSERT(&oa == ENTRY.get_allocator().mechanism());
+            ASSERT(&ENTRY == &StringEntryUtil::key(ENTRY));
+
+            buffer.object().~basic_string();
+        }
+        {
+            bsls::ObjectBuffer<bsl::string> buffer;
+
+            StringEntryUtil::constructFromKey(buffer.address(), &oa, LONG);
+            const bsl::string& ENTRY = buffer.object();
+
+            ASSERT(LONG == ENTRY);
+            ASSERT(&oa == ENTRY.get_allocator().mechanism());
+
+            buffer.object().~basic_string();
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a set, insert, find, and erase a few keys.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(X.empty());
+        ASSERT(X.end() == X.find(1));
+
+        ASSERT(true  == mX.insert(1).second);
+        ASSERT(true  == mX.insert(2).second);
+        ASSERT(false == mX.insert(1).second);
+        ASSERT(2     == X.size());
+        ASSERT(1     == *X.find(1));
+        ASSERT(0     == X.count(3));
+
+        ASSERT(1 == mX.erase(1));
+        ASSERT(0 == mX.erase(1));
+        ASSERT(1 == X.size());
+
+        for (int i = 0; i < 1000; ++i) {
+            mX.insert(i + 100);
+        }
+        ASSERT(1001 == X.size());
+        for (int i = 0; i < 1000; ++i) {
+            ASSERTV(i, X.contains(i + 100));
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bsl::unordered_set'
+        //   Compare the time taken by common operations on 'flat_hash_set' and
+        //   'bsl::unordered_set'.
+        //
+        // Plan:
+        //: 1 For sets of 'int' of several sizes, time inserting distinct
+        //:   pseudo-random keys, looking up each key, looking up absent keys,
+        //:   and erasing each key, and report the time per operation.
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'bsl::unordered_set'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: COMPARISON WITH 'bsl::unordered_set'"
+               "\n=================================================\n");
+
+        typedef bsl::unordered_set<int> UnorderedSet;
+
+        const std::size_t SIZES[] = { 1000, 100000, 1000000 };
+        const int         NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        bsl::vector<int> keys;
+        bsl::vector<int> absentKeys;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const std::size_t SIZE = SIZES[ti];
+            const int         REPS = static_cast<int>(10000000 / SIZE);
+
+            makeKeys(&keys, 2 * SIZE);
+            absentKeys.assign(keys.begin() + SIZE, keys.end());
+            keys.resize(SIZE);
+
+            double flat[4]  = { 0, 0, 0, 0 };
+            double node[4]  = { 0, 0, 0, 0 };
+            std::size_t sum = 0;
+
+            for (int rep = 0; rep < REPS; ++rep) {
+                bsls::Stopwatch timer;
+                {
+                    Obj mX;
+
+                    timer.start();
+                    for (std::size_t i = 0; i < SIZE; ++i) {
+                        mX.insert(keys[i]);
+                    }
+                    timer.stop();
+                    flat[0] += timer.accumulatedWallTime();
+
+                    timer.reset();
+                    timer.start();
+                    for (std::size_t i = 0; i < SIZE; ++i) {
+                        sum += mX.count(keys[i]);
+                    }
+                    timer.stop();
+                    flat[1] += timer.accumulatedWallTime();
+
+                    timer.reset();
+                    timer.start();
+                    for (std::size_t i = 0; i < SIZE; ++i) {
+                        sum += mX.count(absentKeys[i]);
+                    }
+                    timer.stop();
+                    flat[2] += timer.accumulatedWallTime();
+
+                    timer.reset();
+                    timer.start();
+                    for (std::size_t i = 0; i < SIZE; ++i) {
+                        sum += mX.erase(keys[i]);
+                    }
+                    timer.stop();
+                    flat[3] += timer.accumulatedWallTime();
+                    timer.reset();
+                }
+                {
+                    UnorderedSet mX;
+
+                    timer.start();
+                    for (std::size_t i = 0; i < SIZE; ++i) {
+                        mX.insert(keys[i]);
+                    }
+                    timer.stop();
+                    node[0] += timer.accumulatedWallTime();
+
+                    timer.reset();
+                    timer.start();
+                    for (std::size_t i = 0; i < SIZE; ++i) {
+                        sum += mX.count(keys[i]);
+                    }
+                    timer.stop();
+                    node[1] += timer.accumulatedWallTime();
+
+                    timer.reset();
+                    timer.start();
+                    for (std::size_t i = 0; i < SIZE; ++i) {
+                        sum += mX.count(absentKeys[i]);
+                    }
+                    timer.stop();
+                    node[2] += timer.accumulatedWallTime();
+
+                    timer.reset();
+                    timer.start();
+                    for (std::size_t i = 0; i < SIZE; ++i) {
+                        sum += mX.erase(keys[i]);
+                    }
+                    timer.stop();
+                    node[3] += timer.accumulatedWallTime();
+                }
+            }
+
+            const char *NAMES[] = { "insert", "find (hit)", "find (miss)",
+                                    "erase" };
+            const double NS_PER_OP = 1e9 / (static_cast<double>(SIZE) * REPS);
+
+            printf("\nsize = %u (checksum %u)\n",
+                   static_cast<unsigned>(SIZE),
+                   static_cast<unsigned>(sum));
+            for (int i = 0; i < 4; ++i) {
+                printf("\t%s:\tflat_hash_set %g ns/op, "
+                       "unordered_set %g ns/op\n",
+                       NAMES[i],
+                       flat[i] * NS_PER_OP,
+                       node[i] * NS_PER_OP);
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1445 @@
+// bslstl_flathashtable.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATHASHTABLE
+#define INCLUDED_BSLSTL_FLATHASHTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered container.
+//
+//@CLASSES:
+//  bslstl::FlatHashTable: open-addressed unordered container of entries
+//  bslstl::FlatHashTable_IteratorImp: iterator core for a flat hash table
+//
+//@SEE_ALSO: bslstl_flathashmap, bslstl_flathashset
+//
+//@DESCRIPTION: This component provides the implementation of the
+// open-addressed hash table underlying 'bsl::flat_hash_map' and
+// 'bsl::flat_hash_set': a class template, 'bslstl::FlatHashTable', that stores
+// its entries directly in a single contiguous array of slots (rather than in
+// individually allocated nodes, as 'bsl::unordered_map' does), together with
+// an array holding one byte of metadata, a "control value", per slot.
+//
+// The hash value of a key is first mixed (by a multiplication with a 64-bit
+// odd constant) so that its high bits depend on all of its bits.  The highest
+// 7 bits of the mixed value, the "hashlet", are stored in the control value
+// of the slot holding the entry; the next bits select the "group" of
+// 'bslstl::FlatHashTable_GroupControl::k_SIZE' contiguous slots at which the
+// search for the key starts.  A search examines all the control values of a
+// group at once (using SIMD instructions where available), compares the key
+// of only those entries whose hashlet matches, and stops at the first group
+// having a slot that has never held an entry since the table was last
+// rebuilt.  Otherwise, the search proceeds to other groups following a
+// triangular-number sequence, which visits every group of the table exactly
+// once.  Consequently, nearly all searches, successful or not, complete
+// after examining a single group, with a single key comparison, and touching
+// at most two cache lines of the table.
+//
+// The table grows (by doubling its capacity) when it is 7/8 full.  Erasing
+// an entry leaves an "erased" marker in the slot unless its group has never
+// been full; erased slots are reused by later insertions and discarded by the
+// next rebuild of the table.  When erased slots rather than entries make up
+// much of a full table, the table is rebuilt at the same capacity instead of
+// growing.
+//
+///Requirements on 'ENTRY_UTIL'
+///----------------------------
+// The (template parameter) type 'ENTRY_UTIL' specifies how an entry is
+// created from a key and how the key of an entry is obtained.  It must
+// provide the following two static member function templates:
+//..
+//  template <class KEY_TYPE>
+//  static void constructFromKey(ENTRY            *entry,
+//                               bslma::Allocator *allocator,
+//                               KEY_TYPE&&        key);
+//      // Create, at the specified 'entry' address, an entry having the
+//      // specified 'key' and default values for its other attributes, using
+//      // the specified 'allocator' to supply memory.
+//
+//  template <class ENTRY_TYPE>
+//  static const KEY& key(const ENTRY_TYPE& entry);
+//      // Return a reference to the key of the specified 'entry', where
+//      // 'ENTRY_TYPE' is 'ENTRY' or a type from which 'ENTRY' can be
+//      // constructed.  (The return type may be any type convertible to
+//      // 'const KEY&'.)
+//..
+//
+///Iterator and Reference Invalidation
+///-----------------------------------
+// Since entries are stored in the table itself, any operation that rebuilds
+// the table (i.e., 'rehash', 'reserve', and any insertion that causes the
+// table to grow) invalidates all iterators, pointers, and references to its
+// entries.  Erasing an entry invalidates only iterators, pointers, and
+// references to the erased entry.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bslstl_flathashmap' and
+// 'bslstl_flathashset', and is *not* intended for direct client use.  It is
+// subject to change without notice.  See those components for usage
+// examples.
+
+#include <bslscm_version.h>
+
+#include <bslstl_flathashtable_groupcontrol.h>
+#include <bslstl_forwarditerator.h>
+#include <bslstl_pair.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_util.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_performancehint.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+#include <bsls_util.h>
+
+#include <cstddef>
+#include <cstring>
+
+namespace BloombergLP {
+namespace bslstl {
+
+                      // ===============================
+                      // class FlatHashTable_IteratorImp
+                      // ===============================
+
+template <class ENTRY>
+class FlatHashTable_IteratorImp {
+    // This class provides the core iterator functionality required by
+    // 'bslstl::ForwardIterator' for the entries of a 'FlatHashTable'.  A
+    // default-constructed iterator has the past-the-end value.
+
+    // DATA
+    ENTRY               *d_entry_p;           // current entry, or 0 at end
+
+    const unsigned char *d_control_p;         // control value of current
+                                              // entry, or 0 at end
+
+    std::size_t          d_additionalLength;  // number of slots after the
+                                              // current one
+
+    // FRIENDS
+    template <class OTHER_ENTRY>
+    friend bool operator==(const FlatHashTable_IteratorImp<OTHER_ENTRY>&,
+                           const FlatHashTable_IteratorImp<OTHER_ENTRY>&);
+
+  public:
+    // CREATORS
+    FlatHashTable_IteratorImp();
+        // Create an iterator having the past-the-end value.
+
+    FlatHashTable_IteratorImp(ENTRY               *entry,
+                              const unsigned char *control,
+                              std::size_t          additionalLength);
+        // Create an iterator referring to the specified 'entry', whose
+        // control value is at the specified 'control' address, and followed
+        // by the specified 'additionalLength' slots.  The behavior is
+        // undefined unless 'entry' is in use.
+
+    //! FlatHashTable_IteratorImp(const FlatHashTable_IteratorImp&) = default;
+    //! ~FlatHashTable_IteratorImp() = default;
+
+    // MANIPULATORS
+    //! FlatHashTable_IteratorImp& operator=(
+    //!                            const FlatHashTable_IteratorImp&) = default;
+
+    void operator++();
+        // Advance this iterator to the next entry in use, or to the
+        // past-the-end value if there is none.  The behavior is undefined
+        // unless this iterator refers to an entry.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the entry referred to by this iterator.  The
+        // behavior is undefined unless this iterator refers to an entry.
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same entry or both have the past-the-end value, and 'false' otherwise.
+
+                            // ===================
+                            // class FlatHashTable
+                            // ===================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+class FlatHashTable {
+    // This class template implements an open-addressed hash table of unique
+    // keys with entries of the (template parameter) type 'ENTRY', whose keys
+    // of the (template parameter) type 'KEY' are obtained, and from whose
+    // keys entries are created, using the (template parameter) type
+    // 'ENTRY_UTIL' (see {Requirements on 'ENTRY_UTIL'}).  Keys are hashed
+    // with the (template parameter) type 'HASH' and compared with the
+    // (template parameter) type 'EQUAL'.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl       GroupControl;
+    typedef FlatHashTable_IteratorImp<ENTRY> IteratorImp;
+    typedef bsls::Types::Uint64              Uint64;
+
+    // PRIVATE CONSTANTS
+    static const Uint64 k_HASH_MULTIPLIER = 0x9e3779b97f4a7c15ULL;
+                                 // odd constant used to mix the hash value
+
+    static const int    k_HASHLET_SHIFT   = 57;
+                                 // shift that yields the hashlet from the
+                                 // mixed hash value
+
+    // DATA
+    ENTRY            *d_entries_p;    // array of 'd_capacity' slots, or 0
+
+    unsigned char    *d_controls_p;   // array of 'd_capacity' control
+                                      // values, following the slots in the
+                                      // same block of memory, or 0
+
+    std::size_t       d_size;         // number of entries
+
+    std::size_t       d_capacity;     // number of slots; 0 or a power of two
+                                      // multiple of 'GroupControl::k_SIZE'
+
+    std::size_t       d_growthLeft;   // number of empty slots that may
+                                      // receive an entry before the table
+                                      // must be rebuilt
+
+    int               d_groupShift;   // shift that yields the group index
+                                      // (above the hashlet) from the mixed
+                                      // hash value
+
+    HASH              d_hasher;       // hash functor
+
+    EQUAL             d_equal;        // key-equality functor
+
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static std::size_t maxLoad(std::size_t capacity);
+        // Return the maximum number of slots that may be other than empty in
+        // a table having the specified 'capacity'.
+
+    static std::size_t capacityForSize(std::size_t minimumSize);
+        // Return the smallest valid capacity of a table that can hold the
+        // specified 'minimumSize' entries without being rebuilt, or 0 if
+        // 'minimumSize' is 0.
+
+    // PRIVATE MANIPULATORS
+    void commitInsert(std::size_t index, unsigned char hashlet);
+        // Record the entry that has just been created at the specified slot
+        // 'index' as being in use, having the specified 'hashlet'.
+
+    void destroyEntries();
+        // Destroy all the entries of this table, without updating any control
+        // value or the size.
+
+    void eraseAt(std::size_t index);
+        // Destroy the entry at the specified slot 'index' and mark the slot as
+        // available.  The behavior is undefined unless the slot is in use.
+
+    std::size_t findAvailable(Uint64 mixedHash) const;
+        // Return the index of the first available slot on the probe sequence
+        // of the specified 'mixedHash'.  The behavior is undefined unless
+        // '0 < d_capacity'.
+
+    bool findSlot(std::size_t *index, const KEY& key, Uint64 mixedHash) const;
+        // Search this table for the specified 'key' having the specified
+        // 'mixedHash'.  If found, load into the specified 'index' the slot
+        // holding 'key' and return 'true'; otherwise, load into 'index' the
+        // first available slot on the probe sequence of 'mixedHash' and
+        // return 'false'.  The behavior is undefined unless '0 < d_capacity'.
+
+    IteratorImp iteratorAt(std::size_t index);
+        // Return an iterator referring to the entry at the specified slot
+        // 'index', or the past-the-end iterator if 'd_capacity == index'.
+
+    bool prepareInsert(std::size_t   *index,
+                       unsigned char *hashlet,
+                       const KEY&     key);
+        // Search this table for the specified 'key', first allocating or
+        // rebuilding the table as necessary to ensure an entry having 'key'
+        // can be inserted.  If found, load into the specified 'index' the slot
+        // holding 'key' and return 'true'; otherwise, load into 'index' an
+        // available slot at which an entry having 'key' is to be created, load
+        // into the specified 'hashlet' the hashlet of 'key', and return
+        // 'false'.
+
+    void rehashRaw(std::size_t newCapacity);
+        // Rebuild this table to have the specified 'newCapacity', moving its
+        // entries to their new slots.  If an exception is thrown, this table
+        // is left empty, with capacity 'newCapacity'.  The behavior is
+        // undefined unless 'newCapacity' is a valid capacity and
+        // 'd_size <= maxLoad(newCapacity)'.
+
+    void swapContents(FlatHashTable& other);
+        // Exchange the value, hasher, and key-equality functor of this table
+        // with those of the specified 'other' table.
+
+    // PRIVATE ACCESSORS
+    template <class LOOKUP_KEY>
+    std::size_t indexOf(const LOOKUP_KEY& key) const;
+        // Return the slot holding the specified 'key', or 'd_capacity' if
+        // there is none.
+
+    template <class LOOKUP_KEY>
+    Uint64 mixedHash(const LOOKUP_KEY& key) const;
+        // Return the mixed hash value of the specified 'key'.
+
+  public:
+    // TYPES
+    typedef KEY         key_type;
+    typedef ENTRY       value_type;
+    typedef std::size_t size_type;
+    typedef HASH        hasher;
+    typedef EQUAL       key_equal;
+
+    typedef bslstl::ForwardIterator<ENTRY, IteratorImp>       iterator;
+    typedef bslstl::ForwardIterator<const ENTRY, IteratorImp> const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashTable, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashTable(std::size_t       capacity,
+                  const HASH&       hash,
+                  const EQUAL&      equal,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty table that can hold at least the specified
+        // 'capacity' entries without being rebuilt, using the specified
+        // 'hash' and 'equal' functors.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  Note that no memory is
+        // allocated if 'capacity' is 0.
+
+    FlatHashTable(const FlatHashTable&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a table having the same value, hasher, and key-equality
+        // functor as the specified 'original' table.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable> original);
+        // Create a table having the same value, hasher, key-equality functor,
+        // and allocator as the specified 'original' table, leaving 'original'
+        // empty with no capacity.  No memory is allocated.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable>  original,
+                  bslma::Allocator                 *basicAllocator);
+        // Create a table having the same value, hasher, and key-equality
+        // functor as the specified 'original' table, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  If
+        // 'basicAllocator' is the allocator of 'original', its contents are
+        // moved (without allocating) and 'original' is left empty with no
+        // capacity; otherwise, 'original' is copied and left unchanged.
+
+    ~FlatHashTable();
+        // Destroy this object and each of its entries.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this table the value, hasher, and key-equality functor of
+        // the specified 'rhs' table, and return a reference providing
+        // modifiable access to this table.
+
+    FlatHashTable& operator=(bslmf::MovableRef<FlatHashTable> rhs);
+        // Assign to this table the value, hasher, and key-equality functor of
+        // the specified 'rhs' table, and return a reference providing
+        // modifiable access to this table.  If this table and 'rhs' use the
+        // same allocator, the contents of 'rhs' are moved (without
+        // allocating) and 'rhs' is left empty with no capacity; otherwise,
+        // 'rhs' is copied and left unchanged.
+
+    void clear();
+        // Remove all entries from this table.  Note that the capacity is
+        // retained.
+
+    template <class LOOKUP_KEY>
+    bsl::pair<iterator, iterator> equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators defining the (empty or one-element)
+        // sequence of entries in this table having the specified 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        iterator it(iteratorAt(indexOf(key)));
+        iterator next = it;
+        if (it != end()) {
+            ++next;
+        }
+        return bsl::pair<iterator, iterator>(it, next);
+    }
+
+    std::size_t erase(const KEY& key);
+        // Remove from this table the entry having the specified 'key', if it
+        // exists, and return the number of entries removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove from this table the entry referred to by the specified
+        // 'position', and return an iterator referring to the entry following
+        // it, or the past-the-end iterator if there is none.  The behavior is
+        // undefined unless 'position' refers to an entry of this table.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this table the entries in the specified range
+        // '[first, last)', and return an iterator having the value of 'last'.
+        // The behavior is undefined unless '[first, last)' is a valid range
+        // of entries of this table.
+
+    template <class LOOKUP_KEY>
+    iterator find(const LOOKUP_KEY& key)
+        // Return an iterator referring to the entry in this table having the
+        // specified 'key', or the past-the-end iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return iterator(iteratorAt(indexOf(key)));
+    }
+
+    template <class ENTRY_TYPE>
+    bsl::pair<iterator, bool>
+    insert(BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry)
+        // Create in this table an entry from the specified 'entry' if no
+        // entry has the key of 'entry'.  Return a pair whose 'first' member
+        // refers to the entry in this table having that key, and whose
+        // 'second' member is 'true' if the entry was created, and 'false'
+        // otherwise.  If a rebuild of the table is required, all iterators
+        // and references to entries are invalidated.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        std::size_t  index;
+        unsigned char hashlet;
+        if (prepareInsert(&index, &hashlet, ENTRY_UTIL::key(entry))) {
+            return bsl::pair<iterator, bool>(iterator(iteratorAt(index)),
+                                             false);
+                                                                      // RETURN
+        }
+        bslma::ConstructionUtil::construct(
+                                d_entries_p + index,
+                                d_allocator_p,
+                                BSLS_COMPILERFEATURES_FORWARD(ENTRY_TYPE,
+                                                              entry));
+        commitInsert(index, hashlet);
+        return bsl::pair<iterator, bool>(iterator(iteratorAt(index)), true);
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Create in this table an entry from each entry in the specified
+        // range '[first, last)' whose key is not already in this table.
+
+    void rehash(std::size_t minimumCapacity);
+        // Rebuild this table to have the smallest valid capacity that is at
+        // least the specified 'minimumCapacity' and can hold 'size()' entries
+        // without being rebuilt, freeing the slots of erased entries.  If the
+        // resulting capacity is 0, release all memory.  If an exception is
+        // thrown, this table is left empty.
+
+    void reserve(std::size_t numEntries);
+        // Ensure this table can hold at least the specified 'numEntries'
+        // entries without being rebuilt.  If an exception is thrown, this
+        // table is left empty.
+
+    void reset();
+        // Remove all entries from this table and release all memory.
+
+    template <class KEY_TYPE>
+    bsl::pair<iterator, bool>
+    tryEmplace(BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+        // Create in this table an entry from the specified 'key', with default
+        // values for its other attributes, if no entry has 'key'.  Return a
+        // pair whose 'first' member refers to the entry in this table having
+        // 'key', and whose 'second' member is 'true' if the entry was created,
+        // and 'false' otherwise.  If a rebuild of the table is required, all
+        // iterators and references to entries are invalidated.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        std::size_t  index;
+        unsigned char hashlet;
+        if (prepareInsert(&index, &hashlet, key)) {
+            return bsl::pair<iterator, bool>(iterator(iteratorAt(index)),
+                                             false);
+                                                                      // RETURN
+        }
+        ENTRY_UTIL::constructFromKey(d_entries_p + index,
+                                     d_allocator_p,
+                                     BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE,
+                                                                   key));
+        commitInsert(index, hashlet);
+        return bsl::pair<iterator, bool>(iterator(iteratorAt(index)), true);
+    }
+
+    void swap(FlatHashTable& other);
+        // Exchange the value, hasher, and key-equality functor of this table
+        // with those of the specified 'other' table.  The behavior is
+        // undefined unless this table and 'other' use the same allocator.
+
+                             // Iterators
+
+    iterator begin();
+        // Return an iterator referring to the first entry of this table, or
+        // the past-the-end iterator if this table is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this table.
+
+    // ACCESSORS
+    std::size_t capacity() const;
+        // Return the number of slots of this table.
+
+    template <class LOOKUP_KEY>
+    bool contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this table has an entry having the specified 'key',
+        // and 'false' otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return indexOf(key) != d_capacity;
+    }
+
+    template <class LOOKUP_KEY>
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                  const LOOKUP_KEY& key) const
+        // Return a pair of iterators defining the (empty or one-element)
+        // sequence of entries in this table having the specified 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        bsl::pair<iterator, iterator> range =
+                          const_cast<FlatHashTable *>(this)->equal_range(key);
+        return bsl::pair<const_iterator, const_iterator>(range.first,
+                                                         range.second);
+    }
+
+    template <class LOOKUP_KEY>
+    const_iterator find(const LOOKUP_KEY& key) const
+        // Return an iterator referring to the entry in this table having the
+        // specified 'key', or the past-the-end iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return const_iterator(
+                  const_cast<FlatHashTable *>(this)->iteratorAt(indexOf(key)));
+    }
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this table.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality functor of this table.
+
+    float load_factor() const;
+        // Return the ratio of the number of entries to the number of slots of
+        // this table, or 0 if this table has no slots.
+
+    float max_load_factor() const;
+        // Return the ratio of entries to slots at which this table grows.
+
+    std::size_t size() const;
+        // Return the number of entries in this table.
+
+                             // Iterators
+
+    const_iterator begin() const;
+        // Return an iterator referring to the first entry of this table, or
+        // the past-the-end iterator if this table is empty.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this table.
+
+                                // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator==(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables have the same
+    // value, and 'false' otherwise.  Two tables have the same value if they
+    // have the same number of entries and each entry of 'lhs' has a key found
+    // in 'rhs' whose entry compares equal to it using 'operator=='.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator!=(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables do not have the
+    // same value, and 'false' otherwise.  Two tables have the same value if
+    // they have the same number of entries and each entry of 'lhs' has a key
+    // found in 'rhs' whose entry compares equal to it using 'operator=='.
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' tables.  If 'a' and
+    // 'b' use the same allocator, no memory is allocated and no exception is
+    // thrown; otherwise, copies are made using each table's allocator.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class FlatHashTable_IteratorImp
+                      // -------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp()
+: d_entry_p(0)
+, d_control_p(0)
+, d_additionalLength(0)
+{
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp(
+                                         ENTRY               *entry,
+                                         const unsigned char *control,
+                                         std::size_t          additionalLength)
+: d_entry_p(entry)
+, d_control_p(control)
+, d_additionalLength(additionalLength)
+{
+    BSLS_ASSERT_SAFE(entry);
+    BSLS_ASSERT_SAFE(control);
+    BSLS_ASSERT_SAFE(0 == (*control & 0x80));
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+void FlatHashTable_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_entry_p);
+
+    do {
+        if (0 == d_additionalLength) {
+            d_entry_p   = 0;
+            d_control_p = 0;
+            return;                                                   // RETURN
+        }
+        ++d_entry_p;
+        ++d_control_p;
+        --d_additionalLength;
+    } while (*d_control_p & 0x80);
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& FlatHashTable_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_entry_p);
+
+    return *d_entry_p;
+}
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs)
+{
+    return lhs.d_entry_p == rhs.d_entry_p;
+}
+
+                            // -------------------
+                            // class FlatHashTable
+                            // -------------------
+
+// PRIVATE CONSTANTS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+const typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::Uint64
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::k_HASH_MULTIPLIER;
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+const int FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::k_HASHLET_SHIFT;
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+std::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::maxLoad(
+                                                         std::size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+std::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacityForSize(
+                                                      std::size_t minimumSize)
+{
+    if (0 == minimumSize) {
+        return 0;                                                     // RETURN
+    }
+
+    std::size_t capacity = GroupControl::k_SIZE;
+    while (maxLoad(capacity) < minimumSize) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::commitInsert(
+                                                     std::size_t   index,
+                                                     unsigned char hashlet)
+{
+    if (GroupControl::k_EMPTY == d_controls_p[index]) {
+        --d_growthLeft;
+    }
+    d_controls_p[index] = hashlet;
+    ++d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::destroyEntries()
+{
+    if (0 == d_size) {
+        return;                                                       // RETURN
+    }
+    for (std::size_t i = 0; i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & 0x80)) {
+            bslma::DestructionUtil::destroy(d_entries_p + i);
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::eraseAt(
+                                                             std::size_t index)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(0 == (d_controls_p[index] & 0x80));
+
+    bslma::DestructionUtil::destroy(d_entries_p + index);
+    --d_size;
+
+    // If the group of the slot has never been full, no search has continued
+    // past it, so the slot can be made empty again.
+
+    const std::size_t group = index & ~(GroupControl::k_SIZE - 1);
+    if (GroupControl(d_controls_p + group).neverFull()) {
+        d_controls_p[index] = GroupControl::k_EMPTY;
+        ++d_growthLeft;
+    }
+    else {
+        d_controls_p[index] = GroupControl::k_ERASED;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+std::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
+                                                        Uint64 mixedHash) const
+{
+    BSLS_ASSERT_SAFE(0 < d_capacity);
+
+    const std::size_t mask  = d_capacity / GroupControl::k_SIZE - 1;
+    std::size_t       group = static_cast<std::size_t>(
+                                             mixedHash >> d_groupShift) & mask;
+
+    for (std::size_t probe = 1; ; ++probe) {
+        const std::size_t   base = group * GroupControl::k_SIZE;
+        const unsigned int available =
+                              GroupControl(d_controls_p + base).available();
+        if (available) {
+            return base + GroupControl::firstIndex(available);
+                                                                      // RETURN
+        }
+        group = (group + probe) & mask;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findSlot(
+                                                 std::size_t *index,
+                                                 const KEY&   key,
+                                                 Uint64       mixedHash) const
+{
+    BSLS_ASSERT_SAFE(index);
+    BSLS_ASSERT_SAFE(0 < d_capacity);
+
+    const unsigned char hashlet   = static_cast<unsigned char>(
+                                                mixedHash >> k_HASHLET_SHIFT);
+    const std::size_t   mask      = d_capacity / GroupControl::k_SIZE - 1;
+    std::size_t         group     = static_cast<std::size_t>(
+                                             mixedHash >> d_groupShift) & mask;
+    std::size_t         available = d_capacity;
+
+    // The table always has an empty slot, so the search terminates.
+
+    for (std::size_t probe = 1; ; ++probe) {
+        const std::size_t  base = group * GroupControl::k_SIZE;
+        const GroupControl control(d_controls_p + base);
+
+        for (unsigned int matches = control.match(hashlet);
+             matches;
+             matches &= matches - 1) {
+            const std::size_t i = base + GroupControl::firstIndex(matches);
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                 d_equal(ENTRY_UTIL::key(d_entries_p[i]),
+                                         key))) {
+                *index = i;
+                return true;                                          // RETURN
+            }
+        }
+
+        if (d_capacity == available) {
+            const unsigned int availableMask = control.available();
+            if (availableMask) {
+                available = base + GroupControl::firstIndex(availableMask);
+            }
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(control.neverFull())) {
+            *index = available;
+            return false;                                             // RETURN
+        }
+        group = (group + probe) & mask;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::IteratorImp
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iteratorAt(
+                                                             std::size_t index)
+{
+    if (index == d_capacity) {
+        return IteratorImp();                                         // RETURN
+    }
+    return IteratorImp(d_entries_p + index,
+                       d_controls_p + index,
+                       d_capacity - index - 1);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::prepareInsert(
+                                                    std::size_t   *index,
+                                                    unsigned char *hashlet,
+                                                    const KEY&     key)
+{
+    BSLS_ASSERT_SAFE(index);
+    BSLS_ASSERT_SAFE(hashlet);
+
+    const Uint64 hash = mixedHash(key);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_capacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        rehashRaw(capacityForSize(1));
+        *index = findAvailable(hash);
+    }
+    else if (findSlot(index, key, hash)) {
+        return true;                                                  // RETURN
+    }
+    else if (0 == d_growthLeft
+          && GroupControl::k_EMPTY == d_controls_p[*index]) {
+        // Rebuild the table in place if erased slots make up a significant
+        // part (at least 3/32) of its capacity, and otherwise at twice the
+        // capacity.
+
+        rehashRaw(static_cast<Uint64>(d_size) * 32 <=
+                                          static_cast<Uint64>(d_capacity) * 25
+                  ? d_capacity
+                  : 2 * d_capacity);
+        *index = findAvailable(hash);
+    }
+
+    *hashlet = static_cast<unsigned char>(hash >> k_HASHLET_SHIFT);
+    return false;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
+                                                   std::size_t newCapacity)
+{
+    BSLS_ASSERT(d_size <= maxLoad(newCapacity));
+    BSLS_ASSERT(0 == newCapacity % GroupControl::k_SIZE);
+
+    ENTRY         *oldEntries  = d_entries_p;
+    unsigned char *oldControls = d_controls_p;
+    std::size_t    oldCapacity = d_capacity;
+
+    if (newCapacity) {
+        d_entries_p  = static_cast<ENTRY *>(d_allocator_p->allocate(
+                               newCapacity * (sizeof(ENTRY) + 1)));
+        d_controls_p = reinterpret_cast<unsigned char *>(
+                                                  d_entries_p + newCapacity);
+        std::memset(d_controls_p, GroupControl::k_EMPTY, newCapacity);
+    }
+    else {
+        d_entries_p  = 0;
+        d_controls_p = 0;
+    }
+    d_capacity   = newCapacity;
+    d_growthLeft = maxLoad(newCapacity) - d_size;
+    d_groupShift = k_HASHLET_SHIFT;
+    for (std::size_t numGroups = newCapacity / GroupControl::k_SIZE;
+         1 < numGroups;
+         numGroups >>= 1) {
+        --d_groupShift;  // 'numGroups' is a power of two
+    }
+
+    if (0 == oldCapacity) {
+        return;                                                       // RETURN
+    }
+
+    std::size_t i = 0;
+    BSLS_TRY {
+        if (d_size) {
+            for (; i < oldCapacity; ++i) {
+                if (0 == (oldControls[i] & 0x80)) {
+                    const Uint64      hash  =
+                                   mixedHash(ENTRY_UTIL::key(oldEntries[i]));
+                    const std::size_t index = findAvailable(hash);
+
+                    bslma::ConstructionUtil::destructiveMove(
+                                                           d_entries_p + index,
+                                                           d_allocator_p,
+                                                           oldEntries + i);
+                    d_controls_p[index] = static_cast<unsigned char>(
+                                                    hash >> k_HASHLET_SHIFT);
+                }
+            }
+        }
+    }
+    BSLS_CATCH(...) {
+        // Destroy the entries already moved to the new slots and those not
+        // yet moved, and leave the table empty.
+
+        for (std::size_t j = 0; j < d_capacity; ++j) {
+            if (0 == (d_controls_p[j] & 0x80)) {
+                bslma::DestructionUtil::destroy(d_entries_p + j);
+            }
+        }
+        for (std::size_t j = i; j < oldCapacity; ++j) {
+            if (0 == (oldControls[j] & 0x80)) {
+                bslma::DestructionUtil::destroy(oldEntries + j);
+            }
+        }
+        d_allocator_p->deallocate(oldEntries);
+
+        std::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+        d_size       = 0;
+        d_growthLeft = maxLoad(d_capacity);
+        BSLS_RETHROW;
+    }
+
+    d_allocator_p->deallocate(oldEntries);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swapContents(
+                                                          FlatHashTable& other)
+{
+    bslalg::SwapUtil::swap(&d_entries_p,  &other.d_entries_p);
+    bslalg::SwapUtil::swap(&d_controls_p, &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_size,       &other.d_size);
+    bslalg::SwapUtil::swap(&d_capacity,   &other.d_capacity);
+    bslalg::SwapUtil::swap(&d_growthLeft, &other.d_growthLeft);
+    bslalg::SwapUtil::swap(&d_groupShift, &other.d_groupShift);
+    bslalg::SwapUtil::swap(&d_hasher,     &other.d_hasher);
+    bslalg::SwapUtil::swap(&d_equal,      &other.d_equal);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
+std::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::indexOf(
+                                                  const LOOKUP_KEY& key) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_size)) {
+        return d_capacity;                                            // RETURN
+    }
+
+    const Uint64        hash    = mixedHash(key);
+    const unsigned char hashlet = static_cast<unsigned char>(
+                                                     hash >> k_HASHLET_SHIFT);
+    const std::size_t   mask    = d_capacity / GroupControl::k_SIZE - 1;
+    std::size_t         group   = static_cast<std::size_t>(
+                                                  hash >> d_groupShift) & mask;
+
+    for (std::size_t probe = 1; ; ++probe) {
+        const std::size_t  base = group * GroupControl::k_SIZE;
+        const GroupControl control(d_controls_p + base);
+
+        for (unsigned int matches = control.match(hashlet);
+             matches;
+             matches &= matches - 1) {
+            const std::size_t i = base + GroupControl::firstIndex(matches);
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                 d_equal(ENTRY_UTIL::key(d_entries_p[i]),
+                                         key))) {
+                return i;                                             // RETURN
+            }
+        }
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(control.neverFull())) {
+            return d_capacity;                                        // RETURN
+        }
+        group = (group + probe) & mask;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::Uint64
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::mixedHash(
+                                                  const LOOKUP_KEY& key) const
+{
+    return static_cast<Uint64>(d_hasher(key)) * k_HASH_MULTIPLIER;
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                            std::size_t       capacity,
+                                            const HASH&       hash,
+                                            const EQUAL&      equal,
+                                            bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_growthLeft(0)
+, d_groupShift(k_HASHLET_SHIFT)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (capacity) {
+        rehashRaw(capacityForSize(capacity));
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                         const FlatHashTable&  original,
+                                         bslma::Allocator     *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_growthLeft(0)
+, d_groupShift(k_HASHLET_SHIFT)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (0 == original.d_size) {
+        return;                                                       // RETURN
+    }
+
+    // Copy the slots as laid out in 'original', so that no hashing is needed.
+
+    rehashRaw(original.d_capacity);
+
+    std::size_t i = 0;
+    BSLS_TRY {
+        for (; i < d_capacity; ++i) {
+            if (0 == (original.d_controls_p[i] & 0x80)) {
+                bslma::ConstructionUtil::construct(d_entries_p + i,
+                                                   d_allocator_p,
+                                                   original.d_entries_p[i]);
+                d_controls_p[i] = original.d_controls_p[i];
+            }
+        }
+    }
+    BSLS_CATCH(...) {
+        for (std::size_t j = 0; j < i; ++j) {
+            if (0 == (d_controls_p[j] & 0x80)) {
+                bslma::DestructionUtil::destroy(d_entries_p + j);
+            }
+        }
+        d_allocator_p->deallocate(d_entries_p);
+        BSLS_RETHROW;
+    }
+    std::memcpy(d_controls_p, original.d_controls_p, d_capacity);
+    d_size       = original.d_size;
+    d_growthLeft = original.d_growthLeft;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                     bslmf::MovableRef<FlatHashTable> original)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_growthLeft(0)
+, d_groupShift(k_HASHLET_SHIFT)
+, d_hasher(bslmf::MovableRefUtil::access(original).d_hasher)
+, d_equal(bslmf::MovableRefUtil::access(original).d_equal)
+, d_allocator_p(bslmf::MovableRefUtil::access(original).d_allocator_p)
+{
+    swapContents(bslmf::MovableRefUtil::access(original));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                              bslmf::MovableRef<FlatHashTable>  original,
+                              bslma::Allocator                 *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_growthLeft(0)
+, d_groupShift(k_HASHLET_SHIFT)
+, d_hasher(bslmf::MovableRefUtil::access(original).d_hasher)
+, d_equal(bslmf::MovableRefUtil::access(original).d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    FlatHashTable& lvalue = original;
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        swapContents(lvalue);
+    }
+    else {
+        FlatHashTable other(lvalue, d_allocator_p);
+        swapContents(other);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+{
+    BSLS_ASSERT_OPT(d_allocator_p);
+
+    destroyEntries();
+    if (d_entries_p) {
+        d_allocator_p->deallocate(d_entries_p);
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable other(rhs, d_allocator_p);
+        swapContents(other);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                          bslmf::MovableRef<FlatHashTable> rhs)
+{
+    FlatHashTable& lvalue = rhs;
+
+    if (this != &lvalue) {
+        FlatHashTable other(bslmf::MovableRefUtil::move(lvalue),
+                            d_allocator_p);
+        swapContents(other);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+{
+    destroyEntries();
+    if (d_capacity) {
+        std::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+    }
+    d_size       = 0;
+    d_growthLeft = maxLoad(d_capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+std::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                                const KEY& key)
+{
+    const std::size_t index = indexOf(key);
+    if (index == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+    eraseAt(index);
+    return 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    const std::size_t index = &*position - d_entries_p;
+
+    iterator next(iteratorAt(index));
+    ++next;
+    eraseAt(index);
+    return next;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(const_iterator first,
+                                                          const_iterator last)
+{
+    while (first != last) {
+        first = erase(first);
+    }
+    return iterator(last.imp());
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        insert(*first);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+                                                   std::size_t minimumCapacity)
+{
+    std::size_t newCapacity = capacityForSize(d_size);
+    if (newCapacity < minimumCapacity) {
+        if (0 == newCapacity) {
+            newCapacity = GroupControl::k_SIZE;
+        }
+        while (newCapacity < minimumCapacity) {
+            newCapacity *= 2;
+        }
+    }
+
+    if (newCapacity || d_capacity) {
+        rehashRaw(newCapacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+                                                        std::size_t numEntries)
+{
+    if (numEntries > d_size + d_growthLeft) {
+        rehashRaw(capacityForSize(numEntries));
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reset()
+{
+    FlatHashTable other(0, d_hasher, d_equal, d_allocator_p);
+    swapContents(other);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+                                                          FlatHashTable& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    swapContents(other);
+}
+
+                             // Iterators
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+{
+    if (0 == d_size) {
+        return iterator();                                            // RETURN
+    }
+
+    std::size_t index = 0;
+    while (d_controls_p[index] & 0x80) {
+        ++index;
+    }
+    return iterator(iteratorAt(index));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+{
+    return iterator();
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+std::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacity()
+                                                                          const
+{
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+HASH FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+EQUAL FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::key_eq() const
+{
+    return d_equal;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::load_factor() const
+{
+    return d_capacity ? static_cast<float>(d_size) /
+                                              static_cast<float>(d_capacity)
+                      : 0.0f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::max_load_factor()
+                                                                          const
+{
+    return 0.875f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+std::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+{
+    return d_size;
+}
+
+                             // Iterators
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+{
+    return const_cast<FlatHashTable *>(this)->begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+{
+    return const_iterator();
+}
+
+                                // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool bslstl::operator==(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    typedef typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                  const_iterator ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (ConstIterator it = lhs.begin(); it != lhs.end(); ++it) {
+        ConstIterator match = rhs.find(ENTRY_UTIL::key(*it));
+        if (match == rhs.end() || !(*match == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool bslstl::operator!=(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void bslstl::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+                FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b)
+{
+    typedef FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> Table;
+
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    Table futureA(b, a.allocator());
+    Table futureB(a, b.allocator());
+
+    a = bslmf::MovableRefUtil::move(futureA);
+    b = bslmf::MovableRefUtil::move(futureB);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
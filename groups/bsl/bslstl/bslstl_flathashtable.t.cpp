@@ -0,0 +1,1142 @@
+// bslstl_flathashtable.t.cpp                                         -*-C++-*-
+#include <bslstl_flathashtable.h>
+
+#include <bslstl_deque.h>
+#include <bslstl_equalto.h>
+#include <bslstl_hash.h>
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_unorderedmap.h>
+#include <bslstl_vector.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <cstddef>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bslstl::FlatHashTable' is a container template whose behavior is determined
+// by its contents, so the primary test technique is to apply long sequences
+// of pseudo-random operations to a table and to an oracle
+// ('bsl::unordered_map'), verifying after each operation that the two agree
+// and that the table's internal bookkeeping is consistent.  Poor hash
+// functors are used to force long probe sequences, collisions of hashlets,
+// and erased slots.  Memory usage and exception safety are verified with
+// 'bslma::TestAllocator'.
+//-----------------------------------------------------------------------------
+// CLASS 'bslstl::FlatHashTable_IteratorImp'
+// [ 2] FlatHashTable_IteratorImp();
+// [ 2] FlatHashTable_IteratorImp(ENTRY *, const uint8_t *, size_t);
+// [ 2] void operator++();
+// [ 2] ENTRY& operator*() const;
+// [ 2] bool operator==(const IteratorImp& lhs, const IteratorImp& rhs);
+//
+// CLASS 'bslstl::FlatHashTable'
+// CREATORS
+// [ 3] FlatHashTable(size_t, const HASH&, const EQUAL&, Allocator * = 0);
+// [ 5] FlatHashTable(const FlatHashTable&, Allocator * = 0);
+// [ 5] FlatHashTable(MovableRef<FlatHashTable>);
+// [ 5] FlatHashTable(MovableRef<FlatHashTable>, Allocator *);
+// [ 3] ~FlatHashTable();
+//
+// MANIPULATORS
+// [ 5] FlatHashTable& operator=(const FlatHashTable&);
+// [ 5] FlatHashTable& operator=(MovableRef<FlatHashTable>);
+// [ 4] void clear();
+// [ 4] pair<iterator, iterator> equal_range(const LOOKUP_KEY&);
+// [ 4] size_t erase(const KEY&);
+// [ 4] iterator erase(const_iterator);
+// [ 4] iterator erase(const_iterator, const_iterator);
+// [ 4] iterator find(const LOOKUP_KEY&);
+// [ 4] pair<iterator, bool> insert(ENTRY_TYPE&&);
+// [ 4] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void rehash(size_t);
+// [ 4] void reserve(size_t);
+// [ 4] void reset();
+// [ 4] pair<iterator, bool> tryEmplace(KEY_TYPE&&);
+// [ 5] void swap(FlatHashTable&);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+//
+// ACCESSORS
+// [ 3] size_t capacity() const;
+// [ 4] bool contains(const LOOKUP_KEY&) const;
+// [ 4] pair<CIter, CIter> equal_range(const LOOKUP_KEY&) const;
+// [ 4] const_iterator find(const LOOKUP_KEY&) const;
+// [ 3] HASH hash_function() const;
+// [ 3] EQUAL key_eq() const;
+// [ 3] float load_factor() const;
+// [ 3] float max_load_factor() const;
+// [ 3] size_t size() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator end() const;
+// [ 3] Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const FlatHashTable&, const FlatHashTable&);
+// [ 5] bool operator!=(const FlatHashTable&, const FlatHashTable&);
+//
+// FREE FUNCTIONS
+// [ 5] void swap(FlatHashTable&, FlatHashTable&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] EXCEPTION SAFETY
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+                            // ===============
+                            // struct PairUtil
+                            // ===============
+
+struct PairUtil {
+    // This 'struct' provides the 'ENTRY_UTIL' operations for a table whose
+    // entries are 'bsl::pair' objects keyed by 'first'.
+
+    template <class ENTRY, class KEY_TYPE>
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const KEY_TYPE&   key)
+        // Create at the specified 'entry' address a pair having the specified
+        // 'key' and a default-constructed 'second' member, using the specified
+        // 'allocator'.
+    {
+        bslma::ConstructionUtil::construct(entry,
+                                           allocator,
+                                           key,
+                                           typename ENTRY::second_type());
+    }
+
+    template <class ENTRY_TYPE>
+    static const typename ENTRY_TYPE::first_type& key(const ENTRY_TYPE& entry)
+        // Return a reference to the key of the specified 'entry'.
+    {
+        return entry.first;
+    }
+};
+
+                            // ==============
+                            // class PoorHash
+                            // ==============
+
+class PoorHash {
+    // This class provides a hash functor whose results have only the number
+    // of distinct values specified at construction, so as to force
+    // collisions.
+
+    // DATA
+    std::size_t d_modulus;  // number of distinct hash values
+
+  public:
+    // CREATORS
+    explicit PoorHash(std::size_t modulus = 0)
+        // Create a hash functor producing the specified 'modulus' distinct
+        // values, or producing the identity if 'modulus' is 0.
+    : d_modulus(modulus)
+    {
+    }
+
+    // ACCESSORS
+    std::size_t operator()(int key) const
+        // Return the hash value of the specified 'key'.
+    {
+        const std::size_t k = static_cast<unsigned int>(key);
+        return d_modulus ? k % d_modulus : k;
+    }
+
+    std::size_t modulus() const
+        // Return the number of distinct values produced by this functor.
+    {
+        return d_modulus;
+    }
+};
+
+typedef bsl::pair<int, int>                                  IntPair;
+typedef bslstl::FlatHashTable<int, IntPair, PairUtil, PoorHash,
+                            bsl::equal_to<int> >             Obj;
+
+typedef bsl::pair<bsl::string, bsl::string>                  StringPair;
+typedef bslstl::FlatHashTable<bsl::string,
+                            StringPair,
+                            PairUtil,
+                            bslh::Hash<>,
+                            bsl::equal_to<bsl::string> >     StringObj;
+
+typedef bsl::unordered_map<int, int>                         Oracle;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static unsigned int nextRandom(unsigned int *state)
+    // Return the next value of the linear congruential generator having the
+    // specified 'state', and update 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+template <class TABLE>
+bool isConsistent(const TABLE& table)
+    // Return 'true' if iterating over the specified 'table' visits exactly
+    // 'size()' entries, each of which can be found, and the size and capacity
+    // are consistent, and 'false' otherwise.
+{
+    typedef typename TABLE::const_iterator ConstIterator;
+
+    std::size_t count = 0;
+    for (ConstIterator it = table.begin(); it != table.end(); ++it) {
+        ConstIterator found = table.find(it->first);
+        if (found != it) {
+            return false;                                             // RETURN
+        }
+        ++count;
+    }
+
+    const std::size_t capacity = table.capacity();
+    return count == table.size()
+        && table.size() <= capacity - capacity / 8
+        && 0 == capacity % bslstl::FlatHashTable_GroupControl::k_SIZE
+        && 0 == (capacity & (capacity - 1)) >> 4;
+}
+
+bool isEqual(const Obj& table, const Oracle& oracle)
+    // Return 'true' if the specified 'table' and 'oracle' have the same
+    // contents, and 'false' otherwise.
+{
+    if (table.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+    for (Oracle::const_iterator it = oracle.begin(); it != oracle.end();
+                                                                        ++it) {
+        Obj::const_iterator found = table.find(it->first);
+        if (found == table.end() || found->second != it->second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test    = argc > 1 ? atoi(argv[1]) : 0;
+    verbose     = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //   Ensure the table neither leaks nor corrupts itself when an
+        //   allocation fails.
+        //
+        // Concerns:
+        //: 1 If the creation of an entry throws, the table is unchanged.
+        //:
+        //: 2 If a rebuild of the table throws, the table is left empty and
+        //:   valid, and no memory is leaked.
+        //:
+        //: 3 If a copy throws, no memory is leaked.
+        //
+        // Plan:
+        //: 1 Using 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*', insert into,
+        //:   rehash, and copy tables of string pairs whose strings allocate,
+        //:   verifying the table and the allocator afterwards.  (C-1..3)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY"
+                            "\n================\n");
+
+        const char *LONG = "a string long enough to require an allocation";
+
+        for (int n = 0; n < 40; ++n) {
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            {
+                StringObj mX(0, bslh::Hash<>(), bsl::equal_to<bsl::string>(),
+                             &oa);
+                const StringObj& X = mX;
+
+                for (int i = 0; i < n; ++i) {
+                    bsl::string key(LONG, &oa);
+                    key += static_cast<char>('A' + i);
+                    mX.insert(StringPair(key, key));
+                }
+
+                bsl::string key(LONG);
+                key += '*';
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    const std::size_t SIZE = X.size();
+
+                    bool inserted = false;
+                    BSLS_TRY {
+                        inserted = mX.insert(StringPair(key, key)).second;
+                    }
+                    BSLS_CATCH(...) {
+                        ASSERTV(n, isConsistent(X));
+                        ASSERTV(n, X.size(), SIZE == X.size() ||
+                                                                0 == X.size());
+                        BSLS_RETHROW;
+                    }
+                    ASSERTV(n, inserted);
+                    ASSERTV(n, isConsistent(X));
+                    ASSERTV(n, SIZE + 1 == X.size());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    BSLS_TRY {
+                        mX.rehash(4 * X.capacity());
+                    }
+                    BSLS_CATCH(...) {
+                        ASSERTV(n, isConsistent(X));
+                        BSLS_RETHROW;
+                    }
+                    ASSERTV(n, isConsistent(X));
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    StringObj mY(X, &oa);
+                    ASSERTV(n, X == mY);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+
+            ASSERTV(n, 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY
+        //   Ensure value-semantic operations behave as expected.
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original and uses the supplied
+        //:   allocator.
+        //:
+        //: 2 A move with the same allocator allocates nothing and leaves the
+        //:   original empty; a move with a different allocator copies.
+        //:
+        //: 3 Assignment (copy and move) gives the target the value of the
+        //:   source, including after self-assignment.
+        //:
+        //: 4 Member 'swap' exchanges values without allocating; free 'swap'
+        //:   works with different allocators.
+        //:
+        //: 5 Equality depends only on the entries, not on their order,
+        //:   capacity, or history of erasures.
+        //
+        // Plan:
+        //: 1 For tables of varying sizes, apply each operation and verify the
+        //:   resulting values and the allocators' usage.  (C-1..5)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable&, Allocator * = 0);
+        //   FlatHashTable(MovableRef<FlatHashTable>);
+        //   FlatHashTable(MovableRef<FlatHashTable>, Allocator *);
+        //   FlatHashTable& operator=(const FlatHashTable&);
+        //   FlatHashTable& operator=(MovableRef<FlatHashTable>);
+        //   void swap(FlatHashTable&);
+        //   bool operator==(const FlatHashTable&, const FlatHashTable&);
+        //   bool operator!=(const FlatHashTable&, const FlatHashTable&);
+        //   void swap(FlatHashTable&, FlatHashTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY"
+                            "\n==========================================\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+        bslma::TestAllocator za("other",  veryVerbose);
+
+        for (int n = 0; n < 100; n += 1 + n / 4) {
+            Obj mX(0, PoorHash(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            for (int i = 0; i < n; ++i) {
+                mX.insert(IntPair(i, i * i));
+            }
+
+            // Copy.
+
+            {
+                Obj mY(X, &za);  const Obj& Y = mY;
+                ASSERTV(n, X == Y);
+                ASSERTV(n, !(X != Y));
+                ASSERTV(n, &za == Y.allocator());
+                ASSERTV(n, X.capacity() == Y.capacity());
+                ASSERTV(n, isConsistent(Y));
+
+                // The copy can grow as much as the original without being
+                // rebuilt.
+
+                const std::size_t CAPACITY = Y.capacity();
+                for (int i = n; i < static_cast<int>(CAPACITY -
+                                                     CAPACITY / 8); ++i) {
+                    mY.insert(IntPair(i, i * i));
+                }
+                ASSERTV(n, CAPACITY == Y.capacity());
+                for (int i = n; i < static_cast<int>(CAPACITY -
+                                                     CAPACITY / 8); ++i) {
+                    mY.erase(i);
+                }
+
+                if (n) {
+                    mY.erase(0);
+                    ASSERTV(n, X != Y);
+                    mY.insert(IntPair(0, 1));
+                    ASSERTV(n, X != Y);
+                    mY.begin()->second = 0;
+                    mY.find(0)->second = 0;
+                    ASSERTV(n, X == Y);
+                }
+            }
+
+            // Equality does not depend on capacity or history.
+
+            {
+                Obj mY(1000, PoorHash(), bsl::equal_to<int>(), &za);
+                const Obj& Y = mY;
+                for (int i = n - 1; i >= 0; --i) {
+                    mY.insert(IntPair(i + 1000, 0));
+                    mY.insert(IntPair(i, i * i));
+                    mY.erase(i + 1000);
+                }
+                ASSERTV(n, X == Y);
+            }
+
+            // Move with the same allocator.
+
+            {
+                Obj mY(X, &oa);  const Obj& Y = mY;
+
+                const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+
+                Obj mZ(bslmf::MovableRefUtil::move(mY));  const Obj& Z = mZ;
+
+                ASSERTV(n, NUM_ALLOCS == oa.numAllocations());
+                ASSERTV(n, X == Z);
+                ASSERTV(n, 0 == Y.size());
+                ASSERTV(n, 0 == Y.capacity());
+                ASSERTV(n, &oa == Z.allocator());
+
+                Obj mW(bslmf::MovableRefUtil::move(mZ), &oa);
+                const Obj& W = mW;
+
+                ASSERTV(n, NUM_ALLOCS == oa.numAllocations());
+                ASSERTV(n, X == W);
+                ASSERTV(n, 0 == Z.size());
+
+                mY.insert(IntPair(-1, -1));  // moved-from object is usable
+                ASSERTV(n, 1 == Y.size());
+            }
+
+            // Move with a different allocator.
+
+            {
+                Obj mY(X, &oa);  const Obj& Y = mY;
+
+                Obj mZ(bslmf::MovableRefUtil::move(mY), &za);
+                const Obj& Z = mZ;
+
+                ASSERTV(n, X == Z);
+                ASSERTV(n, &za == Z.allocator());
+                ASSERTV(n, &oa == Y.allocator());
+            }
+
+            // Copy and move assignment.
+
+            {
+                Obj mY(5, PoorHash(), bsl::equal_to<int>(), &za);
+                const Obj& Y = mY;
+                mY.insert(IntPair(-5, -5));
+
+                mY = X;
+                ASSERTV(n, X == Y);
+                ASSERTV(n, &za == Y.allocator());
+
+                mY = Y;
+                ASSERTV(n, X == Y);
+
+                Obj mZ(0, PoorHash(), bsl::equal_to<int>(), &oa);
+                mZ.insert(IntPair(-7, -7));
+                mZ = bslmf::MovableRefUtil::move(mY);
+                ASSERTV(n, X == mZ);
+
+                Obj mW(X, &oa);
+                Obj mV(0, PoorHash(), bsl::equal_to<int>(), &oa);
+
+                const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+                mV = bslmf::MovableRefUtil::move(mW);
+                ASSERTV(n, NUM_ALLOCS == oa.numAllocations());
+                ASSERTV(n, X == mV);
+            }
+
+            // Swap.
+
+            {
+                Obj mY(X, &oa);  const Obj& Y = mY;
+                Obj mZ(0, PoorHash(), bsl::equal_to<int>(), &oa);
+                const Obj& Z = mZ;
+                mZ.insert(IntPair(-1, -1));
+
+                const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+                mY.swap(mZ);
+                ASSERTV(n, NUM_ALLOCS == oa.numAllocations());
+                ASSERTV(n, X == Z);
+                ASSERTV(n, 1 == Y.size());
+
+                swap(mY, mZ);
+                ASSERTV(n, X == Y);
+
+                Obj mW(0, PoorHash(), bsl::equal_to<int>(), &za);
+                const Obj& W = mW;
+                mW.insert(IntPair(-1, -1));
+
+                swap(mY, mW);
+                ASSERTV(n, X == W);
+                ASSERTV(n, 1 == Y.size());
+                ASSERTV(n, &oa == Y.allocator());
+                ASSERTV(n, &za == W.allocator());
+            }
+        }
+
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(0, PoorHash(), bsl::equal_to<int>(), &oa);
+            Obj mY(0, PoorHash(), bsl::equal_to<int>(), &oa);
+            Obj mZ(0, PoorHash(), bsl::equal_to<int>(), &za);
+
+            ASSERT_PASS(mX.swap(mY));
+            ASSERT_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RANDOM OPERATIONS AGAINST AN ORACLE
+        //   Ensure the manipulators and lookups behave as expected.
+        //
+        // Concerns:
+        //: 1 'insert' and 'tryEmplace' create an entry only if its key is
+        //:   absent, and return an iterator to the entry having the key.
+        //:
+        //: 2 'erase' (by key, position, and range) removes exactly the
+        //:   specified entries and returns the expected result.
+        //:
+        //: 3 'find', 'contains', and 'equal_range' find exactly the entries
+        //:   present, including when many keys share a hash value or a
+        //:   hashlet, and after many erasures have left erased slots.
+        //:
+        //: 4 'clear', 'rehash', 'reserve', and 'reset' preserve or remove the
+        //:   entries as documented, and adjust the capacity as documented.
+        //:
+        //: 5 Erased slots left in full groups do not cause a table whose size
+        //:   is constant to grow.
+        //:
+        //: 6 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 For a number of hash functors of decreasing quality, apply a
+        //:   long pseudo-random sequence of operations to a table and to an
+        //:   oracle 'bsl::unordered_map', verifying after each operation that
+        //:   the results agree and the table is consistent.  (C-1..4)
+        //:
+        //: 2 Fill a table to its maximum load, erase most entries, then
+        //:   repeatedly insert and erase distinct keys keeping the size
+        //:   constant, and verify the capacity does not change.  (C-5)
+        //:
+        //: 3 Verify the default allocator is unused.  (C-6)
+        //
+        // Testing:
+        //   void clear();
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY&);
+        //   size_t erase(const KEY&);
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   iterator find(const LOOKUP_KEY&);
+        //   pair<iterator, bool> insert(ENTRY_TYPE&&);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        //   pair<iterator, bool> tryEmplace(KEY_TYPE&&);
+        //   bool contains(const LOOKUP_KEY&) const;
+        //   pair<CIter, CIter> equal_range(const LOOKUP_KEY&) const;
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANDOM OPERATIONS AGAINST AN ORACLE"
+                            "\n===================================\n");
+
+        bslma::TestAllocator oa("object",  veryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        static const std::size_t MODULI[] = { 0, 1000, 37, 3, 1 };
+        const int NUM_MODULI = static_cast<int>(sizeof MODULI /
+                                                sizeof *MODULI);
+
+        for (int mi = 0; mi < NUM_MODULI; ++mi) {
+            const std::size_t MODULUS   = MODULI[mi];
+            const int         KEY_RANGE = MODULUS && MODULUS < 10 ? 60 : 600;
+            const int         NUM_OPS   = MODULUS && MODULUS < 10
+                                        ? 5000
+                                        : 50000;
+
+            if (verbose) { T_ P(MODULUS) }
+
+            Obj    mX(0, PoorHash(MODULUS), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+            Oracle oracle(&sa);
+
+            unsigned int state = static_cast<unsigned int>(mi) + 1;
+
+            for (int op = 0; op < NUM_OPS; ++op) {
+                const unsigned int r     = nextRandom(&state);
+                const int          key   = static_cast<int>(
+                                                 (r >> 4) % KEY_RANGE) - 10;
+                const int          value = static_cast<int>(r % 1000);
+
+                switch (r % 16) {
+                  case 0: case 1: case 2: case 3: {
+                    bsl::pair<Obj::iterator, bool> rv =
+                                             mX.insert(IntPair(key, value));
+                    const bool EXP = oracle.insert(IntPair(key, value)).second;
+                    ASSERTV(MODULUS, op, EXP == rv.second);
+                    ASSERTV(MODULUS, op, key == rv.first->first);
+                    ASSERTV(MODULUS, op, oracle[key] == rv.first->second);
+                  } break;
+                  case 4: case 5: {
+                    bsl::pair<Obj::iterator, bool> rv = mX.tryEmplace(key);
+                    const bool EXP = oracle.insert(IntPair(key, 0)).second;
+                    ASSERTV(MODULUS, op, EXP == rv.second);
+                    ASSERTV(MODULUS, op, key == rv.first->first);
+                    rv.first->second  = value;
+                    oracle[key]       = value;
+                  } break;
+                  case 6: case 7: case 8: {
+                    const std::size_t EXP = oracle.erase(key);
+                    ASSERTV(MODULUS, op, EXP == mX.erase(key));
+                  } break;
+                  case 9: {
+                    Obj::iterator it = mX.find(key);
+                    if (it != mX.end()) {
+                        Obj::iterator next = it;
+                        ++next;
+                        oracle.erase(key);
+                        ASSERTV(MODULUS, op, next == mX.erase(it));
+                    }
+                  } break;
+                  case 10: {
+                    // Erase a range of up to 3 entries.
+
+                    Obj::iterator first = mX.find(key);
+                    Obj::iterator last  = first;
+                    for (int i = 0; i < 3 && last != mX.end(); ++i) {
+                        oracle.erase(last->first);
+                        ++last;
+                    }
+                    ASSERTV(MODULUS, op, last == mX.erase(first, last));
+                  } break;
+                  case 11: {
+                    bsl::pair<Obj::iterator, Obj::iterator> range =
+                                                          mX.equal_range(key);
+                    bsl::pair<Obj::const_iterator, Obj::const_iterator>
+                                                 cRange = X.equal_range(key);
+                    ASSERTV(MODULUS, op, range.first  == cRange.first);
+                    ASSERTV(MODULUS, op, range.second == cRange.second);
+                    if (oracle.count(key)) {
+                        ASSERTV(MODULUS, op, range.first != range.second);
+                        ASSERTV(MODULUS, op, key == range.first->first);
+                        Obj::iterator next = range.first;
+                        ASSERTV(MODULUS, op, ++next == range.second);
+                    }
+                    else {
+                        ASSERTV(MODULUS, op, range.first  == mX.end());
+                        ASSERTV(MODULUS, op, range.second == mX.end());
+                    }
+                  } break;
+                  case 12: {
+                    const std::size_t CAPACITY = X.capacity();
+                    switch (op % 3) {
+                      case 0: {
+                        mX.reserve(X.size() + value);
+                        ASSERTV(MODULUS, op, CAPACITY <= X.capacity());
+                      } break;
+                      case 1: {
+                        mX.rehash(0);
+                        ASSERTV(MODULUS, op, CAPACITY >= X.capacity());
+                      } break;
+                      default: {
+                        mX.rehash(value);
+                        ASSERTV(MODULUS, op,
+                                    static_cast<std::size_t>(value) <=
+                                                                X.capacity());
+                      }
+                    }
+                  } break;
+                  case 13: {
+                    if (0 == value % 50) {
+                        const std::size_t CAPACITY = X.capacity();
+                        if (value % 100) {
+                            mX.clear();
+                            ASSERTV(MODULUS, op, CAPACITY == X.capacity());
+                        }
+                        else {
+                            mX.reset();
+                            ASSERTV(MODULUS, op, 0 == X.capacity());
+                        }
+                        oracle.clear();
+                    }
+                  } break;
+                  case 14: {
+                    IntPair pairs[3] = { IntPair(key,     value),
+                                         IntPair(key + 1, value),
+                                         IntPair(key,     value + 1) };
+                    mX.insert(pairs, pairs + 3);
+                    oracle.insert(pairs, pairs + 3);
+                  } break;
+                  default: {
+                    ASSERTV(MODULUS, op, (0 != oracle.count(key)) ==
+                                                            X.contains(key));
+                  } break;
+                }
+
+                ASSERTV(MODULUS, op, isEqual(X, oracle));
+                if (0 == op % 97) {
+                    ASSERTV(MODULUS, op, isConsistent(X));
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting erased slots do not grow the table.\n");
+        {
+            // Fill the table to its maximum load, so that many groups are
+            // full and erasures from them leave erased slots, erase most of
+            // the entries, then insert and erase entries at a constant size.
+
+            Obj mX(1000, PoorHash(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            const std::size_t CAPACITY = X.capacity();
+            const int         MAX_LOAD =
+                                 static_cast<int>(CAPACITY - CAPACITY / 8);
+
+            for (int i = 0; i < MAX_LOAD; ++i) {
+                mX.insert(IntPair(i, i));
+            }
+            bsl::deque<int> keys(&sa);
+            for (int i = 0; i < MAX_LOAD; ++i) {
+                if (i % 4) {
+                    mX.erase(i);
+                }
+                else {
+                    keys.push_back(i);
+                }
+            }
+
+            const std::size_t SIZE = X.size();
+
+            for (int i = MAX_LOAD; i < 40 * MAX_LOAD; ++i) {
+                mX.insert(IntPair(i, i));
+                keys.push_back(i);
+                mX.erase(keys.front());
+                keys.pop_front();
+                ASSERTV(i, SIZE == X.size());
+            }
+            ASSERTV(CAPACITY, X.capacity(), CAPACITY == X.capacity());
+            ASSERT(isConsistent(X));
+        }
+
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //   Ensure a table can be created, populated, and inspected.
+        //
+        // Concerns:
+        //: 1 A table created with 0 capacity allocates no memory; one created
+        //:   with a non-zero capacity has a power-of-two capacity that is a
+        //:   multiple of the group size, and can hold that many entries
+        //:   without growing.
+        //:
+        //: 2 The table grows by doubling when its load would exceed 7/8.
+        //:
+        //: 3 Iteration visits every entry exactly once, and 'const' and
+        //:   non-'const' iterators agree.
+        //:
+        //: 4 The accessors return the expected values, and the supplied
+        //:   allocator is used for the table and propagated to the entries.
+        //:
+        //: 5 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 Create tables with various capacities and insert entries,
+        //:   verifying the accessors after each insertion.  (C-1..5)
+        //
+        // Testing:
+        //   FlatHashTable(size_t, const HASH&, const EQUAL&, Allocator * = 0);
+        //   ~FlatHashTable();
+        //   iterator begin();
+        //   iterator end();
+        //   size_t capacity() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                            "\n========================================\n");
+
+        const std::size_t GROUP = bslstl::FlatHashTable_GroupControl::k_SIZE;
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        {
+            Obj mX(0, PoorHash(7), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            ASSERT(0     == oa.numBlocksTotal());
+            ASSERT(0     == X.capacity());
+            ASSERT(0     == X.size());
+            ASSERT(0.0f  == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(7     == X.hash_function().modulus());
+            ASSERT(true  == X.key_eq()(3, 3));
+            ASSERT(&oa   == X.allocator());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end()   == X.find(5));
+        }
+        {
+            Obj mX(0, PoorHash(), bsl::equal_to<int>());
+            ASSERT(&defaultAllocator == mX.allocator());
+        }
+
+        for (std::size_t capacity = 1; capacity < 300; capacity += 7) {
+            Obj mX(capacity, PoorHash(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            const std::size_t CAPACITY = X.capacity();
+            ASSERTV(capacity, 0 == CAPACITY % GROUP);
+            ASSERTV(capacity, 0 == (CAPACITY & (CAPACITY - 1)));
+            ASSERTV(capacity, capacity <= CAPACITY - CAPACITY / 8);
+            ASSERTV(capacity, CAPACITY == GROUP ||
+                              capacity > (CAPACITY / 2) - (CAPACITY / 16));
+            ASSERTV(capacity, 1 == oa.numBlocksInUse());
+
+            for (std::size_t i = 0; i < capacity; ++i) {
+                mX.insert(IntPair(static_cast<int>(i * 7919), 0));
+            }
+            ASSERTV(capacity, CAPACITY == X.capacity());
+            ASSERTV(capacity, 1 == oa.numBlocksInUse());
+            ASSERTV(capacity, isConsistent(X));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting growth and iteration.\n");
+        {
+            Obj mX(0, PoorHash(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            std::size_t capacity = 0;
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(IntPair(i * 3, i));
+
+                ASSERTV(i, static_cast<std::size_t>(i + 1) == X.size());
+                if (X.capacity() != capacity) {
+                    ASSERTV(i, 0 == capacity ? GROUP == X.capacity()
+                                             : 2 * capacity == X.capacity());
+                    ASSERTV(i, 0 == capacity ||
+                               capacity - capacity / 8 == X.size() - 1);
+                    capacity = X.capacity();
+                }
+                ASSERTV(i, static_cast<float>(X.size()) /
+                          static_cast<float>(X.capacity()) == X.load_factor());
+                ASSERTV(i, 1 == oa.numBlocksInUse());
+            }
+
+            bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+            bsl::vector<int> seen(1000, 0, &sa);
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ASSERT(0 == it->first % 3);
+                ASSERT(it->first / 3 == it->second);
+                ++seen[it->second];
+                ++it->second;
+            }
+            for (Obj::const_iterator it = X.begin(); it != X.end(); it++) {
+                ASSERT(it->first / 3 + 1 == it->second);
+            }
+            for (int i = 0; i < 1000; ++i) {
+                ASSERTV(i, 1 == seen[i]);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) printf("\nTesting allocator propagation.\n");
+        {
+            StringObj mX(0, bslh::Hash<>(), bsl::equal_to<bsl::string>(),
+                         &oa);
+
+            const bsl::string LONG(
+                       "a string long enough to require an allocation");
+            const bsl::string OTHER = "another " + LONG;
+
+            mX.insert(StringPair(LONG, LONG));
+            mX.tryEmplace(OTHER);
+
+            for (StringObj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ASSERT(&oa == it->first.get_allocator().mechanism());
+                ASSERT(&oa == it->second.get_allocator().mechanism());
+            }
+            ASSERT(mX.contains(LONG));
+            ASSERT(mX.find(OTHER)->second.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'FlatHashTable_IteratorImp'
+        //   Ensure the iterator core skips slots that are not in use.
+        //
+        // Concerns:
+        //: 1 A default-constructed iterator has the past-the-end value.
+        //:
+        //: 2 'operator++' advances to the next slot in use, skipping empty and
+        //:   erased slots, and reaches the past-the-end value after the last
+        //:   slot in use.
+        //:
+        //: 3 'operator*' refers to the current entry.
+        //:
+        //: 4 'operator==' compares the referred-to entries.
+        //
+        // Plan:
+        //: 1 Iterate over a hand-built array of slots and control values.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   FlatHashTable_IteratorImp();
+        //   FlatHashTable_IteratorImp(ENTRY *, const uint8_t *, size_t);
+        //   void operator++();
+        //   ENTRY& operator*() const;
+        //   bool operator==(const IteratorImp& lhs, const IteratorImp& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'FlatHashTable_IteratorImp'"
+                            "\n===========================\n");
+
+        typedef bslstl::FlatHashTable_IteratorImp<int> Imp;
+        typedef bslstl::FlatHashTable_GroupControl     GroupControl;
+
+        int           entries[8]  = { 0, 1, 2, 3, 4, 5, 6, 7 };
+        unsigned char controls[8] = { 0x01,
+                                      GroupControl::k_EMPTY,
+                                      GroupControl::k_ERASED,
+                                      0x7f,
+                                      0x00,
+                                      GroupControl::k_EMPTY,
+                                      0x22,
+                                      GroupControl::k_ERASED };
+
+        const Imp END;
+
+        Imp mX(entries, controls, 7);  const Imp& X = mX;
+
+        ASSERT(0 == *X);
+        ASSERT(!(X == END));
+
+        Imp mY(X);  const Imp& Y = mY;
+        ASSERT(X == Y);
+
+        ++mX;  ASSERT(3 == *X);
+        ASSERT(!(X == Y));
+        ++mX;  ASSERT(4 == *X);
+        ++mX;  ASSERT(6 == *X);
+        *X = 60;
+        ASSERT(60 == entries[6]);
+        ++mX;  ASSERT(X == END);
+
+        Imp mZ(entries + 6, controls + 6, 1);
+        ASSERT(X == END);
+        ASSERT(60 == *mZ);
+        ++mZ;
+        ASSERT(mZ == END);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a table, insert, find, and erase a few entries.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVerbose);
+
+        Obj mX(0, PoorHash(), bsl::equal_to<int>(), &oa);
+        const Obj& X = mX;
+
+        ASSERT(0 == X.size());
+        ASSERT(X.end() == X.find(1));
+
+        ASSERT(true  == mX.insert(IntPair(1, 10)).second);
+        ASSERT(true  == mX.insert(IntPair(2, 20)).second);
+        ASSERT(false == mX.insert(IntPair(1, 11)).second);
+        ASSERT(2     == X.size());
+        ASSERT(10    == X.find(1)->second);
+        ASSERT(20    == X.find(2)->second);
+        ASSERT(X.end() == X.find(3));
+
+        ASSERT(1 == mX.erase(1));
+        ASSERT(0 == mX.erase(1));
+        ASSERT(1 == X.size());
+        ASSERT(X.end() == X.find(1));
+
+        mX.tryEmplace(3).first->second = 30;
+        ASSERT(30 == X.find(3)->second);
+
+        for (int i = 0; i < 100; ++i) {
+            mX.insert(IntPair(i + 100, i));
+        }
+        ASSERT(102 == X.size());
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, i == X.find(i + 100)->second);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
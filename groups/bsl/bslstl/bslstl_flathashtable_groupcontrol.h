@@ -0,0 +1,308 @@
+// bslstl_flathashtable_groupcontrol.h                                -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATHASHTABLE_GROUPCONTROL
+#define INCLUDED_BSLSTL_FLATHASHTABLE_GROUPCONTROL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide inquiries to a flat hash table group of control values.
+//
+//@CLASSES:
+//  bslstl::FlatHashTable_GroupControl: flat hash table group control inquiries
+//
+//@SEE_ALSO: bslstl_flathashtable
+//
+//@DESCRIPTION: This component provides an implementation detail of
+// 'bslstl::FlatHashTable': a class, 'bslstl::FlatHashTable_GroupControl', that
+// answers inquiries about a contiguous group of 'k_SIZE' control values of
+// the table.  Each slot of the table has one control value, which is either
+// 'k_EMPTY' (the slot has never held an element since the table was last
+// rebuilt), 'k_ERASED' (the slot held an element that was removed), or, for
+// a slot holding an element, the 7-bit "hashlet" (a part of the hash value of
+// the element's key that is not used to select the slot's group).
+//
+// The results of the inquiries are bit masks in which bit 'i' (counting from
+// the least significant bit) corresponds to the control value at offset 'i'
+// within the group.  On platforms supporting SSE2, 'k_SIZE' is 16 and each
+// inquiry is a handful of vector instructions; otherwise, 'k_SIZE' is 8 and
+// the inquiries are computed on a 64-bit word.  The class method 'firstIndex'
+// returns the offset of the first slot selected by such a mask.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Querying a Group of Control Values
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a group of control values has been populated as follows:
+//..
+//  typedef bslstl::FlatHashTable_GroupControl GroupControl;
+//
+//  unsigned char controls[GroupControl::k_SIZE];
+//  std::memset(controls, GroupControl::k_EMPTY, sizeof controls);
+//
+//  controls[1] = 0x35;
+//  controls[2] = GroupControl::k_ERASED;
+//  controls[5] = 0x35;
+//  controls[6] = 0x12;
+//..
+// First, we create a 'GroupControl' object for the group:
+//..
+//  GroupControl group(controls);
+//..
+// Then, we find the slots whose hashlet is '0x35':
+//..
+//  assert(((1u << 1) | (1u << 5)) == group.match(0x35));
+//..
+// Next, we find the slots that are in use:
+//..
+//  assert(((1u << 1) | (1u << 5) | (1u << 6)) == group.inUse());
+//..
+// Finally, we observe that the group has at least one slot that has never
+// been used, so a search for a key need not continue past this group:
+//..
+//  assert(true == group.neverFull());
+//..
+
+#include <bslscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <cstddef>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define BSLSTL_FLATHASHTABLE_GROUPCONTROL_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                      // ================================
+                      // class FlatHashTable_GroupControl
+                      // ================================
+
+class FlatHashTable_GroupControl {
+    // This class provides inquiries about a group of 'k_SIZE' contiguous
+    // control values of a flat hash table.  Note that the group is loaded on
+    // construction, so modifications to the control values made after an
+    // object of this class is created are not reflected in its results.
+
+  public:
+    // CONSTANTS
+    static const unsigned char k_EMPTY  = 0x80;  // control value of a slot
+                                                 // that has never been used
+
+    static const unsigned char k_ERASED = 0xfe;  // control value of a slot
+                                                 // whose element was removed
+
+#if defined(BSLSTL_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
+    static const std::size_t   k_SIZE   = 16;    // number of control values
+                                                 // in a group
+#else
+    static const std::size_t   k_SIZE   = 8;
+#endif
+
+  private:
+    // DATA
+#if defined(BSLSTL_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
+    __m128i             d_value;  // the control values of the group
+#else
+    bsls::Types::Uint64 d_value;  // the control values of the group, the
+                                  // first at the least significant byte
+#endif
+
+    // NOT IMPLEMENTED
+    FlatHashTable_GroupControl();
+    FlatHashTable_GroupControl(const FlatHashTable_GroupControl&);
+    FlatHashTable_GroupControl& operator=(const FlatHashTable_GroupControl&);
+
+  public:
+    // CLASS METHODS
+    static int firstIndex(unsigned int mask);
+        // Return the index of the least significant set bit of the specified
+        // 'mask' (i.e., the offset within a group of the first slot selected
+        // by 'mask').  The behavior is undefined unless '0 != mask'.
+
+    // CREATORS
+    explicit
+    FlatHashTable_GroupControl(const unsigned char *data);
+        // Create a group control object for the 'k_SIZE' control values
+        // starting at the specified 'data' address.  The behavior is
+        // undefined unless 'data' refers to at least 'k_SIZE' values.
+
+    //! ~FlatHashTable_GroupControl() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    unsigned int available() const;
+        // Return a bit mask of the slots of this group that are either empty
+        // or erased (i.e., not in use).
+
+    unsigned int inUse() const;
+        // Return a bit mask of the slots of this group that hold an element.
+
+    unsigned int match(unsigned char value) const;
+        // Return a bit mask of the slots of this group whose control value is
+        // the specified 'value'.  The behavior is undefined unless
+        // '0x80 > value' (i.e., 'value' is a hashlet).
+
+    bool neverFull() const;
+        // Return 'true' if at least one slot of this group is empty (i.e., it
+        // has not held an element since the table was last rebuilt), and
+        // 'false' otherwise.  Note that a search for a key that reaches a
+        // group that has never been full need not continue to the next group.
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class FlatHashTable_GroupControl
+                      // --------------------------------
+
+// CLASS METHODS
+inline
+int FlatHashTable_GroupControl::firstIndex(unsigned int mask)
+{
+    BSLS_ASSERT_SAFE(0 != mask);
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return __builtin_ctz(mask);
+#else
+    int index = 0;
+    while (0 == (mask & 1u)) {
+        mask >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+#if defined(BSLSTL_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                     const unsigned char *data)
+: d_value(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data)))
+{
+    BSLS_ASSERT_SAFE(data);
+}
+
+// ACCESSORS
+inline
+unsigned int FlatHashTable_GroupControl::available() const
+{
+    // Only 'k_EMPTY' and 'k_ERASED' have the high bit set.
+
+    return static_cast<unsigned int>(_mm_movemask_epi8(d_value));
+}
+
+inline
+unsigned int FlatHashTable_GroupControl::inUse() const
+{
+    return ~available() & 0xffffu;
+}
+
+inline
+unsigned int FlatHashTable_GroupControl::match(unsigned char value) const
+{
+    BSLS_ASSERT_SAFE(0x80 > value);
+
+    return static_cast<unsigned int>(_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(d_value,
+                                   _mm_set1_epi8(static_cast<char>(value)))));
+}
+
+inline
+bool FlatHashTable_GroupControl::neverFull() const
+{
+    return 0 != _mm_movemask_epi8(
+                   _mm_cmpeq_epi8(d_value,
+                                  _mm_set1_epi8(static_cast<char>(k_EMPTY))));
+}
+
+#else  // BSLSTL_FLATHASHTABLE_GROUPCONTROL_USE_SSE2
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                     const unsigned char *data)
+: d_value(0)
+{
+    BSLS_ASSERT_SAFE(data);
+
+    for (std::size_t i = 0; i < k_SIZE; ++i) {
+        d_value |= static_cast<bsls::Types::Uint64>(data[i]) << (8 * i);
+    }
+}
+
+// ACCESSORS
+inline
+unsigned int FlatHashTable_GroupControl::available() const
+{
+    // Gather the high bit of each byte into the low 8 bits of the result.
+
+    const bsls::Types::Uint64 highBits = d_value & 0x8080808080808080ULL;
+
+    return static_cast<unsigned int>(
+                                 (highBits * 0x0002040810204081ULL) >> 56);
+}
+
+inline
+unsigned int FlatHashTable_GroupControl::inUse() const
+{
+    return ~available() & 0xffu;
+}
+
+inline
+unsigned int FlatHashTable_GroupControl::match(unsigned char value) const
+{
+    BSLS_ASSERT_SAFE(0x80 > value);
+
+    // Set the high bit of exactly the bytes of 'd_value' equal to 'value'
+    // (i.e., the zero bytes of 'x'), then gather those bits.
+
+    const bsls::Types::Uint64 x = d_value ^ (0x0101010101010101ULL * value);
+    const bsls::Types::Uint64 zeros =
+             ~(((x & 0x7f7f7f7f7f7f7f7fULL) + 0x7f7f7f7f7f7f7f7fULL) | x)
+                                                       & 0x8080808080808080ULL;
+
+    return static_cast<unsigned int>((zeros * 0x0002040810204081ULL) >> 56);
+}
+
+inline
+bool FlatHashTable_GroupControl::neverFull() const
+{
+    // Only 'k_EMPTY' has the high bit set and the second-highest bit clear.
+
+    return 0 != (d_value & ~(d_value << 1) & 0x8080808080808080ULL);
+}
+
+#endif  // BSLSTL_FLATHASHTABLE_GROUPCONTROL_USE_SSE2
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
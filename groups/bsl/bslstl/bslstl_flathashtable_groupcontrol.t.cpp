@@ -0,0 +1,466 @@
+// bslstl_flathashtable_groupcontrol.t.cpp                            -*-C++-*-
+#include <bslstl_flathashtable_groupcontrol.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <cstddef>
+#include <cstring>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an in-core value-semantic-free inquiry class.
+// Each accessor is tested against a simple byte-by-byte oracle over a large
+// number of pseudo-randomly populated groups, and over tabulated groups that
+// exercise the boundary control values.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int firstIndex(unsigned int mask);
+//
+// CREATORS
+// [ 2] explicit FlatHashTable_GroupControl(const unsigned char *data);
+//
+// ACCESSORS
+// [ 2] unsigned int available() const;
+// [ 2] unsigned int inUse() const;
+// [ 2] unsigned int match(unsigned char value) const;
+// [ 2] bool neverFull() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslstl::FlatHashTable_GroupControl Obj;
+
+const std::size_t SIZE = Obj::k_SIZE;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static unsigned int nextRandom(unsigned int *state)
+    // Return the next value of the linear congruential generator having the
+    // specified 'state', and update 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+static unsigned int oracleMatch(const unsigned char *data, unsigned char value)
+    // Return a bit mask of the 'SIZE' control values starting at the
+    // specified 'data' that are equal to the specified 'value'.
+{
+    unsigned int mask = 0;
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        if (value == data[i]) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+static unsigned int oracleAvailable(const unsigned char *data)
+    // Return a bit mask of the 'SIZE' control values starting at the
+    // specified 'data' that are either 'k_EMPTY' or 'k_ERASED'.
+{
+    return oracleMatch(data, Obj::k_EMPTY) | oracleMatch(data, Obj::k_ERASED);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test    = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Querying a Group of Control Values
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a group of control values has been populated as follows:
+//..
+    typedef bslstl::FlatHashTable_GroupControl GroupControl;
+
+    unsigned char controls[GroupControl::k_SIZE];
+    std::memset(controls, GroupControl::k_EMPTY, sizeof controls);
+
+    controls[1] = 0x35;
+    controls[2] = GroupControl::k_ERASED;
+    controls[5] = 0x35;
+    controls[6] = 0x12;
+//..
+// First, we create a 'GroupControl' object for the group:
+//..
+    GroupControl group(controls);
+//..
+// Then, we find the slots whose hashlet is '0x35':
+//..
+    ASSERT(((1u << 1) | (1u << 5)) == group.match(0x35));
+//..
+// Next, we find the slots that are in use:
+//..
+    ASSERT(((1u << 1) | (1u << 5) | (1u << 6)) == group.inUse());
+//..
+// Finally, we observe that the group has at least one slot that has never
+// been used, so a search for a key need not continue past this group:
+//..
+    ASSERT(true == group.neverFull());
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING ACCESSORS
+        //   Ensure each accessor returns the expected bit mask, and that
+        //   'firstIndex' returns the offset of the first slot of a mask.
+        //
+        // Concerns:
+        //: 1 'available' reports exactly the 'k_EMPTY' and 'k_ERASED' slots.
+        //:
+        //: 2 'inUse' reports exactly the slots holding a hashlet, and no bit
+        //:   at or above 'k_SIZE' is set.
+        //:
+        //: 3 'match' reports exactly the slots equal to the hashlet, for every
+        //:   hashlet value, including when a neighbouring byte differs from
+        //:   the hashlet by one bit (i.e., there are no false positives from
+        //:   carries between bytes).
+        //:
+        //: 4 'neverFull' is 'true' if and only if a slot is 'k_EMPTY'.
+        //:
+        //: 5 The group need not be aligned.
+        //:
+        //: 6 'firstIndex' returns the index of the lowest set bit of any mask
+        //:   of a group.
+        //:
+        //: 7 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a table of groups exercising each kind of control value in
+        //:   the first and last slots, compare each accessor against a
+        //:   byte-by-byte oracle.  (C-1..4)
+        //:
+        //: 2 Populate a large number of groups at varying offsets in a buffer
+        //:   with pseudo-random control values, drawn mostly from a small set
+        //:   of hashlets, and compare each accessor against the oracle for
+        //:   every hashlet.  (C-1..5)
+        //:
+        //: 3 For every non-zero mask of 'k_SIZE' bits, compare 'firstIndex'
+        //:   against a bit-by-bit oracle.  (C-6)
+        //:
+        //: 4 Verify defensive checks are triggered for invalid values.  (C-7)
+        //
+        // Testing:
+        //   static int firstIndex(unsigned int mask);
+        //   explicit FlatHashTable_GroupControl(const unsigned char *data);
+        //   unsigned int available() const;
+        //   unsigned int inUse() const;
+        //   unsigned int match(unsigned char value) const;
+        //   bool neverFull() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING ACCESSORS"
+                            "\n=================\n");
+
+        const unsigned int ALL = (1u << SIZE) - 1;
+
+        if (verbose) printf("\nTesting tabulated groups.\n");
+        {
+            static const struct {
+                int           d_line;   // source line number
+                unsigned char d_first;  // control value of the first slot
+                unsigned char d_fill;   // control value of the middle slots
+                unsigned char d_last;   // control value of the last slot
+            } DATA[] = {
+                //LINE  FIRST  FILL   LAST
+                //----  -----  -----  -----
+                { L_,   0x80,  0x80,  0x80 },
+                { L_,   0xfe,  0xfe,  0xfe },
+                { L_,   0x00,  0x00,  0x00 },
+                { L_,   0x7f,  0x7f,  0x7f },
+                { L_,   0x80,  0x00,  0x00 },
+                { L_,   0x00,  0x00,  0x80 },
+                { L_,   0xfe,  0x00,  0x00 },
+                { L_,   0x00,  0x00,  0xfe },
+                { L_,   0x80,  0xfe,  0xfe },
+                { L_,   0xfe,  0xfe,  0x80 },
+                { L_,   0x01,  0x00,  0x01 },
+                { L_,   0x00,  0x01,  0x00 },
+                { L_,   0x7e,  0x7f,  0x7e },
+                { L_,   0x7f,  0xfe,  0x80 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                unsigned char data[SIZE];
+                std::memset(data, DATA[ti].d_fill, SIZE);
+                data[0]        = DATA[ti].d_first;
+                data[SIZE - 1] = DATA[ti].d_last;
+
+                const Obj X(data);
+
+                const unsigned int EXP_AVAILABLE = oracleAvailable(data);
+
+                ASSERTV(LINE, EXP_AVAILABLE == X.available());
+                ASSERTV(LINE, (ALL & ~EXP_AVAILABLE) == X.inUse());
+                ASSERTV(LINE, (0 != oracleMatch(data, Obj::k_EMPTY)) ==
+                                                              X.neverFull());
+
+                for (int v = 0; v < 0x80; ++v) {
+                    const unsigned char VALUE = static_cast<unsigned char>(v);
+
+                    ASSERTV(LINE, v, oracleMatch(data, VALUE) ==
+                                                              X.match(VALUE));
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting pseudo-random groups.\n");
+        {
+            static const unsigned char VALUES[] = {
+                0x80, 0xfe, 0x00, 0x01, 0x02, 0x03, 0x40, 0x41, 0x7e, 0x7f
+            };
+            const unsigned int NUM_VALUES =
+                              static_cast<unsigned int>(sizeof VALUES);
+
+            unsigned int state = 12345;
+            unsigned char buffer[SIZE + 16];
+
+            for (int i = 0; i < 20000; ++i) {
+                for (std::size_t j = 0; j < sizeof buffer; ++j) {
+                    const unsigned int r = nextRandom(&state);
+                    buffer[j] = 0 == r % 4
+                              ? static_cast<unsigned char>(r % 0x80)
+                              : VALUES[(r >> 4) % NUM_VALUES];
+                }
+
+                const std::size_t    offset = i % 16;
+                const unsigned char *data   = buffer + offset;
+
+                const Obj X(data);
+
+                const unsigned int EXP_AVAILABLE = oracleAvailable(data);
+
+                ASSERTV(i, EXP_AVAILABLE == X.available());
+                ASSERTV(i, (ALL & ~EXP_AVAILABLE) == X.inUse());
+                ASSERTV(i, (0 != oracleMatch(data, Obj::k_EMPTY)) ==
+                                                              X.neverFull());
+
+                for (std::size_t j = 0; j < SIZE; ++j) {
+                    if (0x80 > data[j]) {
+                        ASSERTV(i, j, oracleMatch(data, data[j]) ==
+                                                            X.match(data[j]));
+                    }
+                }
+                ASSERTV(i, oracleMatch(data, 0x11) == X.match(0x11));
+            }
+        }
+
+        if (verbose) printf("\nTesting 'firstIndex'.\n");
+        {
+            for (unsigned int mask = 1; mask <= ALL; ++mask) {
+                int expected = 0;
+                while (0 == (mask & (1u << expected))) {
+                    ++expected;
+                }
+
+                ASSERTV(mask, expected == Obj::firstIndex(mask));
+            }
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            unsigned char data[SIZE];
+            std::memset(data, Obj::k_EMPTY, SIZE);
+
+            const Obj X(data);
+
+            ASSERT_SAFE_PASS(X.match(0x7f));
+            ASSERT_SAFE_FAIL(X.match(0x80));
+            ASSERT_SAFE_FAIL(X.match(Obj::k_ERASED));
+
+            ASSERT_SAFE_PASS(Obj::firstIndex(1));
+            ASSERT_SAFE_FAIL(Obj::firstIndex(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object for a group of empty slots and one for a group
+        //:   of full slots, and verify the results of each accessor.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        ASSERT(0x80 == Obj::k_EMPTY);
+        ASSERT(0xfe == Obj::k_ERASED);
+        ASSERT(8 == SIZE || 16 == SIZE);
+
+        const unsigned int ALL = (1u << SIZE) - 1;
+
+        unsigned char data[SIZE];
+
+        std::memset(data, Obj::k_EMPTY, SIZE);
+        {
+            const Obj X(data);
+
+            ASSERT(ALL  == X.available());
+            ASSERT(0    == X.inUse());
+            ASSERT(0    == X.match(0));
+            ASSERT(true == X.neverFull());
+        }
+
+        std::memset(data, 0x2a, SIZE);
+        {
+            const Obj X(data);
+
+            ASSERT(0     == X.available());
+            ASSERT(ALL   == X.inUse());
+            ASSERT(ALL   == X.match(0x2a));
+            ASSERT(0     == X.match(0x2b));
+            ASSERT(false == X.neverFull());
+        }
+
+        data[3] = Obj::k_ERASED;
+        {
+            const Obj X(data);
+
+            ASSERT((1u << 3)         == X.available());
+            ASSERT((ALL & ~(1u << 3)) == X.inUse());
+            ASSERT(false             == X.neverFull());
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
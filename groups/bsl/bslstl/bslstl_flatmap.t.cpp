@@ -0,0 +1,1187 @@
+// bslstl_flatmap.t.cpp                                               -*-C++-*-
+#include <bslstl_flatmap.h>
+
+#include <bslstl_map.h>
+#include <bslstl_pair.h>
+#include <bslstl_stdexceptutil.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a value-semantic container, 'bsl::flat_map',
+// implemented in terms of 'bslstl::FlatTree', whose algorithms are tested
+// thoroughly in 'bslstl_flattree.t.cpp'.  We therefore concentrate on the
+// forwarding of each method, the 'sorted_unique' overloads, the element
+// access methods, heterogeneous lookup, allocator propagation, and the free
+// operators.  Case -1 compares the lookup and iteration performance of
+// 'flat_map' with that of 'bsl::map'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_map();
+// [ 2] flat_map(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_map(const ALLOCATOR&);
+// [ 2] flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+// [ 2] flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+// [ 2] flat_map(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+// [ 2] flat_map(initializer_list<value_type>, ...);
+// [ 6] flat_map(const flat_map&);
+// [ 6] flat_map(MovableRef<flat_map>);
+// [ 6] flat_map(const flat_map&, const ALLOCATOR&);
+// [ 6] flat_map(MovableRef<flat_map>, const ALLOCATOR&);
+//
+// MANIPULATORS
+// [ 6] flat_map& operator=(const flat_map&);
+// [ 6] flat_map& operator=(MovableRef<flat_map>);
+// [ 4] mapped_type& operator[](const key_type&);
+// [ 4] mapped_type& at(const key_type&);
+// [ 3] pair<iterator, bool> insert(const value_type&);
+// [ 3] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 3] pair<iterator, bool> insert(ALT_VALUE_TYPE&&);
+// [ 3] iterator insert(const_iterator, const value_type&);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] iterator erase(const_iterator);
+// [ 3] size_type erase(const key_type&);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 3] void clear();
+// [ 3] container_type extract();
+// [ 3] void replace(MovableRef<container_type>);
+// [ 3] void reserve(size_type);
+// [ 3] void shrink_to_fit();
+// [ 6] void swap(flat_map&);
+//
+// ACCESSORS
+// [ 4] const mapped_type& at(const key_type&) const;
+// [ 2] allocator_type get_allocator() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 2] const container_type& container() const;
+// [ 5] bool contains(const key_type&) const;
+// [ 5] size_type count(const key_type&) const;
+// [ 5] const_iterator find(const key_type&) const;
+// [ 5] const_iterator lower_bound(const key_type&) const;
+// [ 5] const_iterator upper_bound(const key_type&) const;
+// [ 5] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 5] const_iterator find(const LOOKUP_KEY&) const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const flat_map&, const flat_map&);
+// [ 6] bool operator!=(const flat_map&, const flat_map&);
+// [ 6] bool operator<(const flat_map&, const flat_map&);
+// [ 6] bool operator>(const flat_map&, const flat_map&);
+// [ 6] bool operator<=(const flat_map&, const flat_map&);
+// [ 6] bool operator>=(const flat_map&, const flat_map&);
+// [ 6] void swap(flat_map&, flat_map&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] ALLOCATOR PROPAGATION AND EXCEPTION SAFETY
+// [ 7] TYPE TRAITS
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'bsl::map'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                GLOBAL TYPEDEFS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+
+typedef bsl::flat_map<int, int>             Obj;
+typedef Obj::value_type                     Value;
+typedef bsl::flat_map<bsl::string, bsl::string>
+                                            StringMap;
+typedef StringMap::value_type               StringValue;
+
+                       // ===========================
+                       // struct TransparentComparator
+                       // ===========================
+
+struct TransparentComparator
+    // This class can be used as a comparator for containers.  It has a nested
+    // type 'is_transparent', so it is classified as transparent by the
+    // 'bslmf::IsTransparentPredicate' metafunction and can be used for
+    // heterogeneous comparison.
+{
+    typedef void is_transparent;
+
+    template <class LHS, class RHS>
+    bool operator()(const LHS& lhs, const RHS& rhs) const
+        // Return 'true' if the specified 'lhs' is less than the specified
+        // 'rhs' and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+};
+
+                       // =============================
+                       // class TransparentlyComparable
+                       // =============================
+
+class TransparentlyComparable {
+    // This class holds an 'int' value that is comparable with 'int' without
+    // conversion, and convertible to 'int'.  It counts the conversions.
+
+    // DATA
+    int d_conversionCount;  // number of times 'operator int' has been called
+    int d_value;            // the value
+
+    // NOT IMPLEMENTED
+    TransparentlyComparable(const TransparentlyComparable&);  // = delete
+
+  public:
+    // CREATORS
+    explicit TransparentlyComparable(int value)
+        // Create an object having the specified 'value'.
+    : d_conversionCount(0)
+    , d_value(value)
+    {
+    }
+
+    // MANIPULATORS
+    operator int()
+        // Return the current value of this object.
+    {
+        ++d_conversionCount;
+        return d_value;
+    }
+
+    // ACCESSORS
+    int conversionCount() const
+        // Return the number of times 'operator int' has been called.
+    {
+        return d_conversionCount;
+    }
+
+    friend bool operator<(const TransparentlyComparable& lhs, int rhs)
+        // Return 'true' if the value of the specified 'lhs' is less than the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.d_value < rhs;
+    }
+
+    friend bool operator<(int lhs, const TransparentlyComparable& rhs)
+        // Return 'true' if the specified 'lhs' is less than the value of the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs < rhs.d_value;
+    }
+};
+
+static
+bool isValid(const Obj& map)
+    // Return 'true' if the keys of the specified 'map' are strictly
+    // increasing, and 'false' otherwise.
+{
+    for (Obj::const_iterator it = map.begin(); it != map.end(); ++it) {
+        if (it != map.begin() && !((it - 1)->first < it->first)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+static
+int makeKey(int index)
+    // Return a pseudo-random key for the specified 'index'.  Distinct indices
+    // in '[0, 65536)' yield distinct keys.
+{
+    return (index * 40503) & 0xffff;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test        = argc > 1 ? atoi(argv[1]) : 0;
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building a Lookup Table
+/// - - - - - - - - - - - - - - - - -
+// Suppose we load a table of security identifiers and prices once, and then
+// look prices up many times.  A 'flat_map' is a good fit.
+//
+// First, we create a vector of unsorted entries, as they arrive:
+//..
+        typedef bsl::pair<int, double> Entry;
+
+        bsl::vector<Entry> entries;
+        entries.push_back(Entry(300,  1.25));
+        entries.push_back(Entry(100, 10.50));
+        entries.push_back(Entry(200,  7.75));
+//..
+// Then, we build the map from the entries in a single pass:
+//..
+        bsl::flat_map<int, double> prices(entries.begin(), entries.end());
+        ASSERT(3 == prices.size());
+//..
+// Next, we look up a price:
+//..
+        bsl::flat_map<int, double>::const_iterator it = prices.find(200);
+        ASSERT(prices.end() != it);
+        ASSERT(7.75 == it->second);
+//..
+// Then, we append a batch of entries that we know to be sorted and unique,
+// avoiding the sort:
+//..
+        const Entry MORE[] = { Entry(400, 2.0), Entry(500, 3.0) };
+        prices.insert(bsl::sorted_unique, MORE, MORE + 2);
+        ASSERT(5 == prices.size());
+//..
+// Finally, we observe that iteration visits the entries in key order:
+//..
+        int previous = 0;
+        for (it = prices.begin(); it != prices.end(); ++it) {
+            ASSERT(previous < it->first);
+            previous = it->first;
+        }
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // ALLOCATOR PROPAGATION AND EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 The map, its buffer, and its elements use the allocator supplied
+        //:   at construction, and the default allocator is not used.
+        //:
+        //: 2 If 'operator[]' or a range 'insert' throws, no memory is leaked
+        //:   and the map is left in a valid state.
+        //:
+        //: 3 The map has the 'UsesBslmaAllocator' trait, and is bitwise
+        //:   moveable exactly when its comparator and allocator are.
+        //
+        // Plan:
+        //: 1 Populate a map of strings with a test allocator, and verify that
+        //:   each element uses it.  (C-1)
+        //:
+        //: 2 Repeat the operations under the 'bslma' exception test macros.
+        //:   (C-2)
+        //:
+        //: 3 Check the traits.  (C-3)
+        //
+        // Testing:
+        //   ALLOCATOR PROPAGATION AND EXCEPTION SAFETY
+        //   TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nALLOCATOR PROPAGATION AND EXCEPTION SAFETY"
+                            "\n==========================================\n");
+
+        const char *LONG = "a string long enough to require an allocation";
+
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+        const bsl::string    LONG_KEY(LONG, &sa);
+
+        bsl::vector<StringValue> values(&sa);
+        for (int i = 0; i < 20; ++i) {
+            char key[64];
+            sprintf(key, "%s %d", LONG, (i * 7) % 20);
+            values.push_back(StringValue(bsl::string(key, &sa),
+                                         bsl::string(LONG, &sa)));
+        }
+
+        // In C++03, 'std::stable_sort' copies values into temporaries that
+        // use the default allocator, so we check only that no default memory
+        // outlives each operation.
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        const bool CHECK_TOTAL = true;
+#else
+        const bool CHECK_TOTAL = false;
+#endif
+        const bsls::Types::Int64 NUM_DEFAULT = da.numBlocksTotal();
+
+        if (veryVerbose) printf("\tAllocator propagation.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            StringMap mX(values.begin(), values.end(), &oa);
+            const StringMap& X = mX;
+
+            mX[LONG_KEY] = LONG;
+            ASSERT(21 == X.size());
+
+            for (StringMap::const_iterator it = X.begin();
+                                                       it != X.end(); ++it) {
+                ASSERT(&oa == it->first.get_allocator().mechanism());
+                ASSERT(&oa == it->second.get_allocator().mechanism());
+            }
+            ASSERT(&oa == X.get_allocator().mechanism());
+            ASSERT(!CHECK_TOTAL || NUM_DEFAULT == da.numBlocksTotal());
+            ASSERT(0 == da.numBlocksInUse());
+        }
+
+        if (veryVerbose) printf("\tException safety.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StringMap mX(&oa);  const StringMap& X = mX;
+
+                mX.insert(values.begin(), values.begin() + 10);
+                mX.insert(values.begin() + 5, values.end());
+                mX[LONG_KEY] = LONG;
+                ASSERT(21 == X.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(0 == oa.numBlocksInUse());
+            ASSERT(!CHECK_TOTAL || NUM_DEFAULT == da.numBlocksTotal());
+            ASSERT(0 == da.numBlocksInUse());
+        }
+
+        if (veryVerbose) printf("\tType traits.\n");
+        {
+            ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+            ASSERT(bslma::UsesBslmaAllocator<StringMap>::value);
+            ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+            ASSERT(bslmf::IsBitwiseMoveable<StringMap>::value);
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copy and move construction and assignment produce a map having
+        //:   the original value, using the intended allocator.
+        //:
+        //: 2 Moving with the same allocator does not allocate.
+        //:
+        //: 3 'swap' exchanges values.
+        //:
+        //: 4 The comparison operators compare lexicographically.
+        //
+        // Plan:
+        //: 1 Exercise each operation with test allocators.  (C-1..3)
+        //:
+        //: 2 Compare maps in a table of values with each operator.  (C-4)
+        //
+        // Testing:
+        //   flat_map(const flat_map&);
+        //   flat_map(MovableRef<flat_map>);
+        //   flat_map(const flat_map&, const ALLOCATOR&);
+        //   flat_map(MovableRef<flat_map>, const ALLOCATOR&);
+        //   flat_map& operator=(const flat_map&);
+        //   flat_map& operator=(MovableRef<flat_map>);
+        //   void swap(flat_map&);
+        //   bool operator==(const flat_map&, const flat_map&);
+        //   bool operator!=(const flat_map&, const flat_map&);
+        //   bool operator<(const flat_map&, const flat_map&);
+        //   bool operator>(const flat_map&, const flat_map&);
+        //   bool operator<=(const flat_map&, const flat_map&);
+        //   bool operator>=(const flat_map&, const flat_map&);
+        //   void swap(flat_map&, flat_map&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, SWAP, AND COMPARISON"
+                            "\n================================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < 10; ++i) {
+            mX[makeKey(i)] = i;
+        }
+
+        if (veryVerbose) printf("\tCopy and move.\n");
+        {
+            Obj mY(X, &sa);  const Obj& Y = mY;
+            ASSERT(X   == Y);
+            ASSERT(&sa == Y.get_allocator().mechanism());
+
+            const bsls::Types::Int64 numAllocations = sa.numAllocations();
+            Obj mZ(MoveUtil::move(mY));  const Obj& Z = mZ;
+            ASSERT(X              == Z);
+            ASSERT(numAllocations == sa.numAllocations());
+            ASSERT(&sa            == Z.get_allocator().mechanism());
+
+            Obj mW(MoveUtil::move(mZ), &oa);  const Obj& W = mW;
+            ASSERT(X   == W);
+            ASSERT(&oa == W.get_allocator().mechanism());
+
+            Obj mV(&sa);  const Obj& V = mV;
+            mV = W;
+            ASSERT(X   == V);
+            ASSERT(&sa == V.get_allocator().mechanism());
+
+            Obj mU(&sa);  const Obj& U = mU;
+            mU = MoveUtil::move(mV);
+            ASSERT(X   == U);
+        }
+
+        if (veryVerbose) printf("\tSwap.\n");
+        {
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            Obj mZ(&oa);     const Obj& Z = mZ;
+            mZ[1] = 1;
+            const Obj ZZ(Z, &sa);
+
+            mY.swap(mZ);
+            ASSERT(ZZ == Y);
+            ASSERT(X  == Z);
+
+            swap(mY, mZ);
+            ASSERT(X  == Y);
+            ASSERT(ZZ == Z);
+        }
+
+        if (veryVerbose) printf("\tComparison.\n");
+        {
+            const struct {
+                int         d_line;
+                const char *d_spec;  // keys; each value equals its key
+            } DATA[] = {
+                { L_, ""    },
+                { L_, "1"   },
+                { L_, "12"  },
+                { L_, "123" },
+                { L_, "13"  },
+                { L_, "2"   },
+                { L_, "23"  },
+                { L_, "3"   },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                Obj mU(&oa);  const Obj& U = mU;
+                for (const char *p = DATA[i].d_spec; *p; ++p) {
+                    mU[*p - '0'] = *p - '0';
+                }
+                for (int j = 0; j < NUM_DATA; ++j) {
+                    Obj mV(&oa);  const Obj& V = mV;
+                    for (const char *p = DATA[j].d_spec; *p; ++p) {
+                        mV[*p - '0'] = *p - '0';
+                    }
+
+                    // 'DATA' is in increasing lexicographical order.
+
+                    ASSERTV(i, j, (i == j) == (U == V));
+                    ASSERTV(i, j, (i != j) == (U != V));
+                    ASSERTV(i, j, (i <  j) == (U <  V));
+                    ASSERTV(i, j, (i >  j) == (U >  V));
+                    ASSERTV(i, j, (i <= j) == (U <= V));
+                    ASSERTV(i, j, (i >= j) == (U >= V));
+                }
+            }
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        //
+        // Concerns:
+        //: 1 'find', 'contains', 'count', 'lower_bound', 'upper_bound', and
+        //:   'equal_range' locate the correct elements, in both 'const' and
+        //:   non-'const' maps.
+        //:
+        //: 2 With a transparent comparator, the lookup methods accept a key
+        //:   of another type without converting it to 'key_type'; otherwise,
+        //:   the key is converted.
+        //
+        // Plan:
+        //: 1 Populate a map with even keys and look up every key in and
+        //:   around its range.  (C-1)
+        //:
+        //: 2 Look up 'TransparentlyComparable' keys in maps with transparent
+        //:   and non-transparent comparators and count the conversions.
+        //:   (C-2)
+        //
+        // Testing:
+        //   bool contains(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   const_iterator find(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        Obj mX;  const Obj& X = mX;
+        for (int i = 0; i < 20; ++i) {
+            mX[2 * i] = i;
+        }
+
+        for (int key = -2; key <= 42; ++key) {
+            const bool PRESENT = 0 <= key && key < 40 && 0 == key % 2;
+            const int  LB      = key < 0 ? 0 : key > 40 ? 20 : (key + 1) / 2;
+            const int  UB      = PRESENT ? LB + 1 : LB;
+
+            ASSERTV(key, PRESENT == X.contains(key));
+            ASSERTV(key, (PRESENT ? 1u : 0u) == X.count(key));
+            ASSERTV(key, X.begin() + LB == X.lower_bound(key));
+            ASSERTV(key, X.begin() + UB == X.upper_bound(key));
+            ASSERTV(key, mX.begin() + LB == mX.lower_bound(key));
+            ASSERTV(key, mX.begin() + UB == mX.upper_bound(key));
+            ASSERTV(key, (PRESENT ? X.begin() + LB : X.end()) == X.find(key));
+            ASSERTV(key, X.find(key) == Obj::const_iterator(mX.find(key)));
+            ASSERTV(key, X.begin() + LB == X.equal_range(key).first);
+            ASSERTV(key, X.begin() + UB == X.equal_range(key).second);
+            ASSERTV(key, mX.begin() + UB == mX.equal_range(key).second);
+        }
+
+        if (veryVerbose) printf("\tHeterogeneous lookup.\n");
+        {
+            typedef bsl::flat_map<int, int, TransparentComparator>
+                                                                TransparentMap;
+
+            TransparentMap mT;  const TransparentMap& T = mT;
+            for (int i = 0; i < 5; ++i) {
+                mT[i] = i;
+            }
+
+            TransparentlyComparable present(3);
+            TransparentlyComparable absent(7);
+
+            ASSERT(T.begin() + 3 == T.find(present));
+            ASSERT(T.end()       == T.find(absent));
+            ASSERT(mT.begin() + 3 == mT.find(present));
+            ASSERT(T.contains(present));
+            ASSERT(1 == T.count(present));
+            ASSERT(T.begin() + 3 == T.lower_bound(present));
+            ASSERT(T.begin() + 4 == T.upper_bound(present));
+            ASSERT(T.begin() + 4 == T.equal_range(present).second);
+            ASSERT(0 == present.conversionCount());
+            ASSERT(0 == absent.conversionCount());
+
+            TransparentlyComparable even(4);
+
+            ASSERT(X.begin() + 2 == X.find(even));
+            ASSERT(1 == even.conversionCount());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS
+        //
+        // Concerns:
+        //: 1 'operator[]' returns a reference to the mapped value of an
+        //:   existing key, and otherwise inserts a default-constructed value.
+        //:
+        //: 2 'at' returns a reference to the mapped value of an existing key,
+        //:   and otherwise throws 'std::out_of_range'.
+        //
+        // Plan:
+        //: 1 Insert keys with 'operator[]' in pseudo-random order and read
+        //:   them back with 'operator[]' and 'at'.  (C-1..2)
+        //
+        // Testing:
+        //   mapped_type& operator[](const key_type&);
+        //   mapped_type& at(const key_type&);
+        //   const mapped_type& at(const key_type&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nELEMENT ACCESS"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, 0 == mX[makeKey(i)]);
+            mX[makeKey(i)] = i;
+            ASSERTV(i, static_cast<Obj::size_type>(i + 1) == X.size());
+            ASSERTV(i, isValid(X));
+        }
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, i == mX[makeKey(i)]);
+            ASSERTV(i, i == X.at(makeKey(i)));
+            ++mX.at(makeKey(i));
+            ASSERTV(i, i + 1 == X.at(makeKey(i)));
+        }
+        ASSERT(100 == X.size());
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        bool caught = false;
+        try {
+            X.at(makeKey(100));
+        }
+        catch (const std::out_of_range&) {
+            caught = true;
+        }
+        ASSERT(caught);
+
+        caught = false;
+        try {
+            mX.at(makeKey(100));
+        }
+        catch (const std::out_of_range&) {
+            caught = true;
+        }
+        ASSERT(caught);
+        ASSERT(100 == X.size());
+#endif
+
+        if (veryVerbose) printf("\tString keys and values.\n");
+        {
+            StringMap mS(&oa);  const StringMap& S = mS;
+            mS["banana"] = "yellow";
+            mS["apple"]  = "red";
+            mS["cherry"] = "red";
+            mS["apple"]  = "green";
+
+            ASSERT(3       == S.size());
+            ASSERT("apple" == S.begin()->first);
+            ASSERT("green" == S.at("apple"));
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERTION AND ERASURE
+        //
+        // Concerns:
+        //: 1 Each 'insert' overload inserts a value only if its key is absent,
+        //:   and returns the position of the element having the key (and
+        //:   whether an insertion took place).
+        //:
+        //: 2 Range 'insert' retains the first of several values having
+        //:   equivalent keys, and the elements already in the map.
+        //:
+        //: 3 Each 'erase' overload removes the indicated elements and returns
+        //:   the position following them (or the number removed).
+        //:
+        //: 4 'extract' leaves the map empty and returns its elements;
+        //:   'replace' installs a sorted sequence.
+        //:
+        //: 5 'reserve' and 'shrink_to_fit' adjust the capacity only.
+        //
+        // Plan:
+        //: 1 Exercise each method and verify the result.  (C-1..5)
+        //
+        // Testing:
+        //   pair<iterator, bool> insert(const value_type&);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   pair<iterator, bool> insert(ALT_VALUE_TYPE&&);
+        //   iterator insert(const_iterator, const value_type&);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   void clear();
+        //   container_type extract();
+        //   void replace(MovableRef<container_type>);
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERTION AND ERASURE"
+                            "\n=====================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        if (veryVerbose) printf("\tSingle-value 'insert'.\n");
+        {
+            bsl::pair<Obj::iterator, bool> rv = mX.insert(Value(5, 50));
+            ASSERT(rv.second);
+            ASSERT(Value(5, 50) == *rv.first);
+
+            rv = mX.insert(Value(5, 51));
+            ASSERT(!rv.second);
+            ASSERT(Value(5, 50) == *rv.first);
+
+            Value v(3, 30);
+            rv = mX.insert(MoveUtil::move(v));
+            ASSERT(rv.second);
+            ASSERT(X.begin() == rv.first);
+
+            rv = mX.insert(bsl::pair<short, long>(7, 70));
+            ASSERT(rv.second);
+            ASSERT(Value(7, 70) == *rv.first);
+
+            Obj::iterator it = mX.insert(X.end(), Value(9, 90));
+            ASSERT(Value(9, 90) == *it);
+            it = mX.insert(X.begin(), Value(8, 80));  // bad hint
+            ASSERT(Value(8, 80) == *it);
+            it = mX.insert(X.begin(), Value(5, 52));  // existing key
+            ASSERT(Value(5, 50) == *it);
+
+            ASSERT(5 == X.size());
+            ASSERT(isValid(X));
+        }
+
+        if (veryVerbose) printf("\tRange 'insert'.\n");
+        {
+            const Value VALUES[] = {
+                Value(6, 60), Value(1, 10), Value(6, 61), Value(3, 31)
+            };
+            mX.insert(VALUES, VALUES + 4);
+            ASSERT(7  == X.size());
+            ASSERT(10 == X.at(1));
+            ASSERT(30 == X.at(3));
+            ASSERT(60 == X.at(6));
+            ASSERT(isValid(X));
+
+            const Value SORTED[] = { Value(0, 0), Value(4, 40), Value(12, 0) };
+            mX.insert(bsl::sorted_unique, SORTED, SORTED + 3);
+            ASSERT(10 == X.size());
+            ASSERT(0  == X.begin()->first);
+            ASSERT(12 == (X.end() - 1)->first);
+            ASSERT(isValid(X));
+
+            Obj mY(SORTED, SORTED + 3, &oa);
+            ASSERT(3 == mY.size());
+            Obj mZ(bsl::sorted_unique, SORTED, SORTED + 3, &oa);
+            ASSERT(mY == mZ);
+        }
+
+        if (veryVerbose) printf("\tErasure.\n");
+        {
+            Obj mY(X, &oa);  const Obj& Y = mY;  // 0 1 3 4 5 6 7 8 9 12
+
+            ASSERT(1 == mY.erase(4));
+            ASSERT(0 == mY.erase(4));
+            ASSERT(9 == Y.size());
+
+            Obj::iterator it = mY.erase(Y.find(5));
+            ASSERT(6 == it->first);
+
+            it = mY.erase(Y.find(6), Y.find(9));
+            ASSERT(9 == it->first);
+            ASSERT(5 == Y.size());
+
+            it = mY.erase(mY.begin());
+            ASSERT(1 == it->first);
+
+            mY.clear();
+            ASSERT(Y.empty());
+        }
+
+        if (veryVerbose) printf("\t'extract' and 'replace'.\n");
+        {
+            Obj mY(X, &oa);  const Obj& Y = mY;
+
+            Obj::container_type values = mY.extract();
+            ASSERT(Y.empty());
+            ASSERT(X.size() == values.size());
+            ASSERT(&oa == values.get_allocator().mechanism());
+
+            values.erase(values.begin());
+            mY.replace(MoveUtil::move(values));
+            ASSERT(X.size() - 1 == Y.size());
+            ASSERT(1 == Y.begin()->first);
+        }
+
+        if (veryVerbose) printf("\tCapacity.\n");
+        {
+            Obj mY(X, &oa);  const Obj& Y = mY;
+
+            mY.reserve(100);
+            ASSERT(100 <= Y.capacity());
+            ASSERT(X   == Y);
+
+            mY.shrink_to_fit();
+            ASSERT(X   == Y);
+            ASSERT(Y.size() <= Y.capacity());
+            ASSERT(Y.size() <= Y.max_size());
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a map having the specified comparator,
+        //:   allocator, and elements, sorted and without duplicate keys.
+        //:
+        //: 2 A map created from a range retains the first of several values
+        //:   having equivalent keys.
+        //:
+        //: 3 'key_comp', 'value_comp', and 'container' return the comparator
+        //:   and elements.
+        //
+        // Plan:
+        //: 1 Create maps with each constructor and verify the state using the
+        //:   basic accessors.  (C-1..3)
+        //
+        // Testing:
+        //   flat_map();
+        //   flat_map(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_map(const ALLOCATOR&);
+        //   flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+        //   flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+        //   flat_map(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+        //   flat_map(initializer_list<value_type>, ...);
+        //   allocator_type get_allocator() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   const container_type& container() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND BASIC ACCESSORS"
+                            "\n================================\n");
+
+        typedef bsl::flat_map<int, int, std::greater<int> > ReverseMap;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const Value VALUES[] = {
+            Value(4, 40), Value(2, 20), Value(4, 41), Value(1, 10)
+        };
+        const Value SORTED[] = { Value(1, 10), Value(2, 20), Value(4, 40) };
+
+        {
+            const Obj X;
+            ASSERT(X.empty());
+            ASSERT(&da == X.get_allocator().mechanism());
+        }
+        {
+            const Obj X(&oa);
+            ASSERT(X.empty());
+            ASSERT(&oa == X.get_allocator().mechanism());
+        }
+        {
+            const ReverseMap X(std::greater<int>(), &oa);
+            ASSERT(X.empty());
+            ASSERT(X.key_comp()(2, 1));
+            ASSERT(X.value_comp()(Value(2, 0), Value(1, 0)));
+            ASSERT(&oa == X.get_allocator().mechanism());
+        }
+        {
+            const Obj X(VALUES, VALUES + 4, &oa);
+            ASSERT(3  == X.size());
+            ASSERT(40 == X.at(4));
+            ASSERT(std::equal(X.begin(), X.end(), SORTED));
+            ASSERT(X.container().begin() == X.begin());
+            ASSERT(&oa == X.get_allocator().mechanism());
+        }
+        {
+            const ReverseMap X(VALUES, VALUES + 4, std::greater<int>(), &oa);
+            ASSERT(3 == X.size());
+            ASSERT(4 == X.begin()->first);
+            ASSERT(1 == (X.end() - 1)->first);
+            ASSERT(40 == X.at(4));
+        }
+        {
+            const Obj X(bsl::sorted_unique, SORTED, SORTED + 3, &oa);
+            ASSERT(3 == X.size());
+            ASSERT(std::equal(X.begin(), X.end(), SORTED));
+            ASSERT(&oa == X.get_allocator().mechanism());
+        }
+        {
+            const Obj X(bsl::sorted_unique,
+                        SORTED,
+                        SORTED + 3,
+                        std::less<int>(),
+                        &oa);
+            ASSERT(3 == X.size());
+            ASSERT(&oa == X.get_allocator().mechanism());
+        }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            const Obj X({ Value(3, 30), Value(1, 10), Value(3, 31) }, &oa);
+            ASSERT(2  == X.size());
+            ASSERT(30 == X.at(3));
+            ASSERT(&oa == X.get_allocator().mechanism());
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            mY = { Value(2, 20) };
+            ASSERT(1 == Y.size());
+            mY.insert({ Value(1, 10), Value(2, 21) });
+            ASSERT(2  == Y.size());
+            ASSERT(20 == Y.at(2));
+        }
+#endif
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, iterate, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        mX[3] = 30;
+        mX[1] = 10;
+        mX.insert(Value(2, 20));
+        ASSERT(3  == X.size());
+        ASSERT(1  == X.begin()->first);
+        ASSERT(3  == X.rbegin()->first);
+        ASSERT(20 == X.find(2)->second);
+
+        int sum = 0;
+        for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+            sum += it->second;
+        }
+        ASSERT(60 == sum);
+
+        mX.erase(2);
+        ASSERT(X.end() == X.find(2));
+        ASSERT(2 == X.size());
+
+        const Obj Y(X, &oa);
+        ASSERT(X == Y);
+
+        ASSERT(0 <  oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bsl::map'
+        //   Compare the time taken to look up keys in, and to iterate over,
+        //   'flat_map' and 'bsl::map'.
+        //
+        // Plan:
+        //: 1 For maps of 'int' to 'int' of several sizes, time finding each
+        //:   key in pseudo-random order, and iterating over all elements, and
+        //:   report the time per operation.
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'bsl::map'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: COMPARISON WITH 'bsl::map'"
+                            "\n=======================================\n");
+
+        typedef bsl::map<int, int> Map;
+
+        const int SIZES[] = { 10, 100, 1000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        printf("%8s %14s %14s %14s %14s\n",
+               "size",
+               "flat find",
+               "map find",
+               "flat iterate",
+               "map iterate");
+
+        long sum = 0;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+            const int REPS = 10000000 / SIZE;
+
+            Obj mX;
+            Map mY;
+            bsl::vector<int> keys;
+            for (int i = 0; i < SIZE; ++i) {
+                mX[makeKey(i)] = i;
+                mY[makeKey(i)] = i;
+                keys.push_back(makeKey(i));
+            }
+
+            double seconds[4] = { 0, 0, 0, 0 };
+
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int rep = 0; rep < REPS; ++rep) {
+                for (int i = 0; i < SIZE; ++i) {
+                    sum += mX.find(keys[i])->second;
+                }
+            }
+            timer.stop();
+            seconds[0] = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (int rep = 0; rep < REPS; ++rep) {
+                for (int i = 0; i < SIZE; ++i) {
+                    sum += mY.find(keys[i])->second;
+                }
+            }
+            timer.stop();
+            seconds[1] = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (int rep = 0; rep < REPS; ++rep) {
+                for (Obj::const_iterator it = mX.begin();
+                                                       it != mX.end(); ++it) {
+                    sum += it->second;
+                }
+            }
+            timer.stop();
+            seconds[2] = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (int rep = 0; rep < REPS; ++rep) {
+                for (Map::const_iterator it = mY.begin();
+                                                       it != mY.end(); ++it) {
+                    sum += it->second;
+                }
+            }
+            timer.stop();
+            seconds[3] = timer.accumulatedWallTime();
+
+            const double NUM_OPS = static_cast<double>(REPS) * SIZE;
+
+            printf("%8d %11.2f ns %11.2f ns %11.2f ns %11.2f ns\n",
+                   SIZE,
+                   seconds[0] / NUM_OPS * 1e9,
+                   seconds[1] / NUM_OPS * 1e9,
+                   seconds[2] / NUM_OPS * 1e9,
+                   seconds[3] / NUM_OPS * 1e9);
+        }
+
+        if (veryVerbose) {
+            P(sum);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
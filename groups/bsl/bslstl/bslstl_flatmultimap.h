@@ -0,0 +1,1483 @@
+// bslstl_flatmultimap.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMULTIMAP
+#define INCLUDED_BSLSTL_FLATMULTIMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered multimap held in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_multimap: sorted-vector container of key-value pairs
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatset, bslstl_multimap, bslstl_flattree
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_multimap', implementing an ordered associative container of
+// key-value pairs whose keys need not be unique, in the manner of the C++23
+// standard 'std::flat_multimap'.  The pairs are held in a single
+// 'bsl::vector', sorted by key, with pairs having equivalent keys kept in the
+// order in which they were inserted.
+//
+// 'flat_multimap' makes the same trade-offs against 'bsl::multimap' as
+// 'bsl::flat_map' makes against 'bsl::map' (see 'bslstl_flatmap'): lookup and
+// iteration over contiguous memory are fast, while inserting or erasing a
+// single element takes linear time and invalidates all iterators.  Insert a
+// range with a single call to 'insert' to sort and merge it in
+// 'O(N * log(N))' time, or pass the 'bsl::sorted_equivalent' tag to indicate
+// that the range is already sorted by key and skip the sort.
+//
+///Deviations from 'std::flat_multimap'
+///------------------------------------
+// As for 'bsl::flat_map', the elements are held in a single vector of
+// 'bsl::pair<KEY, VALUE>' and iterators are pointers into that vector.
+// Modifying the key of an element through an iterator results in undefined
+// behavior.  The 'emplace' methods are not provided; use 'insert' instead.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing Trades by Security
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we hold a day's trades, several per security, and want to visit
+// the trades of one security at a time.
+//
+// First, we build the index from the unsorted trades in a single pass:
+//..
+//  typedef bsl::pair<int, double> Trade;  // (security, price)
+//
+//  const Trade TRADES[] = { Trade(200, 7.5),
+//                           Trade(100, 1.0),
+//                           Trade(200, 7.25),
+//                           Trade(100, 1.5) };
+//
+//  bsl::flat_multimap<int, double> index(TRADES, TRADES + 4);
+//  assert(4 == index.size());
+//  assert(2 == index.count(200));
+//..
+// Then, we visit the trades of security 200, which appear in the order in
+// which they were inserted:
+//..
+//  typedef bsl::flat_multimap<int, double>::const_iterator Iterator;
+//
+//  bsl::pair<Iterator, Iterator> range = index.equal_range(200);
+//  assert(2    == range.second - range.first);
+//  assert(7.5  == range.first[0].second);
+//  assert(7.25 == range.first[1].second);
+//..
+// Finally, we remove every trade of security 100:
+//..
+//  assert(2 == index.erase(100));
+//  assert(2 == index.size());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_flattree.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_rangecompare.h>
+
+#include <bslma_destructorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <initializer_list>
+#endif
+
+namespace bsl {
+
+                            // ===================
+                            // class flat_multimap
+                            // ===================
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = bsl::allocator<bsl::pair<KEY, VALUE> > >
+class flat_multimap {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs, possibly having equivalent
+    // keys, stored contiguously in a 'bsl::vector'.
+
+    // PRIVATE TYPES
+    typedef bsl::pair<KEY, VALUE>                                  ValueType;
+
+    typedef BloombergLP::bslstl::UnorderedMapKeyConfiguration<KEY, ValueType>
+                                                                   KeyConfig;
+
+    typedef BloombergLP::bslstl::FlatTree<KEY,
+                                          ValueType,
+                                          KeyConfig,
+                                          COMPARATOR,
+                                          ALLOCATOR>               Tree;
+
+    typedef bsl::allocator_traits<ALLOCATOR>                 AllocatorTraits;
+
+    typedef BloombergLP::bslmf::MovableRefUtil                     MoveUtil;
+
+    // DATA
+    Tree d_tree;  // sorted vector of key-value pairs
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                         key_type;
+    typedef VALUE                                       mapped_type;
+    typedef ValueType                                   value_type;
+    typedef COMPARATOR                                  key_compare;
+    typedef ALLOCATOR                                   allocator_type;
+    typedef typename Tree::ContainerType                container_type;
+    typedef value_type&                                 reference;
+    typedef const value_type&                           const_reference;
+
+    typedef typename container_type::size_type          size_type;
+    typedef typename container_type::difference_type    difference_type;
+    typedef typename container_type::pointer            pointer;
+    typedef typename container_type::const_pointer      const_pointer;
+
+    typedef typename container_type::iterator           iterator;
+    typedef typename container_type::const_iterator     const_iterator;
+    typedef bsl::reverse_iterator<iterator>             reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>       const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // type 'value_type' by comparing their keys using 'COMPARATOR'.
+
+        // FRIENDS
+        friend class flat_multimap;
+
+      protected:
+        // PROTECTED DATA
+        COMPARATOR comp;  // we would not have elected to make this data
+                          // member 'protected', but we are constrained by
+                          // the standard
+
+        // PROTECTED CREATORS
+        value_compare(COMPARATOR comparator);                       // IMPLICIT
+            // Create a 'value_compare' object that uses the specified
+            // 'comparator'.
+
+      public:
+        // PUBLIC TYPES
+        typedef bool       result_type;
+        typedef value_type first_argument_type;
+        typedef value_type second_argument_type;
+
+        // ACCESSORS
+        bool operator()(const value_type& x, const value_type& y) const;
+            // Return 'true' if the key of the specified 'x' is ordered before
+            // the key of the specified 'y', and 'false' otherwise.
+    };
+
+  public:
+    // CREATORS
+    flat_multimap();
+    explicit flat_multimap(const COMPARATOR& comparator,
+                           const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    explicit flat_multimap(const ALLOCATOR& basicAllocator);
+        // Create an empty flat multimap.  Optionally specify a 'comparator'
+        // used to order keys.  If 'comparator' is not supplied, a
+        // default-constructed 'COMPARATOR' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default), then 'basicAllocator', if supplied,
+        // shall be convertible to 'bslma::Allocator *'.  If the type
+        // 'ALLOCATOR' is 'bsl::allocator' and 'basicAllocator' is not
+        // supplied, the currently installed default allocator is used.
+
+    flat_multimap(const flat_multimap& original);
+        // Create a flat multimap having the same value and comparator as the
+        // specified 'original' object, using the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())'.
+
+    flat_multimap(
+              BloombergLP::bslmf::MovableRef<flat_multimap> original);
+                                                                    // IMPLICIT
+        // Create a flat multimap having the same value, comparator, and
+        // allocator as the specified 'original' object, leaving 'original'
+        // empty.  No memory is allocated.
+
+    flat_multimap(const flat_multimap& original,
+                  const ALLOCATOR&     basicAllocator);
+        // Create a flat multimap having the same value and comparator as the
+        // specified 'original' object, using the specified 'basicAllocator'
+        // to supply memory.
+
+    flat_multimap(
+                 BloombergLP::bslmf::MovableRef<flat_multimap> original,
+                 const ALLOCATOR&                              basicAllocator);
+        // Create a flat multimap having the same value and comparator as the
+        // specified 'original' object, using the specified 'basicAllocator'
+        // to supply memory.  The elements of 'original' are moved if
+        // 'basicAllocator == original.get_allocator()' (leaving 'original'
+        // empty), and move-inserted otherwise (leaving 'original' in a valid
+        // but unspecified state).
+
+    template <class INPUT_ITERATOR>
+    flat_multimap(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator     = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multimap(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const ALLOCATOR&  basicAllocator);
+        // Create a flat multimap holding the elements in the specified range
+        // '[first, last)'.  Optionally specify a 'comparator' used to order
+        // keys, and a 'basicAllocator' used to supply memory, as for the
+        // default constructor.  The range is sorted (stably, so that elements
+        // having equivalent keys retain their relative order) in
+        // 'O(N * log(N))' time, where 'N' is 'distance(first, last)'.  The
+        // (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator, and 'value_type' shall be
+        // constructible from '*first'.
+
+    template <class INPUT_ITERATOR>
+    flat_multimap(sorted_equivalent_t,
+                  INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator     = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multimap(sorted_equivalent_t,
+                  INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const ALLOCATOR&  basicAllocator);
+        // Create a flat multimap holding the elements in the specified range
+        // '[first, last)', which is sorted by key, in linear time.
+        // Optionally specify a 'comparator' and a 'basicAllocator', as for
+        // the default constructor.  The behavior is undefined unless the range
+        // is sorted by key.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multimap(
+              std::initializer_list<value_type> values,
+              const COMPARATOR&                 comparator     = COMPARATOR(),
+              const ALLOCATOR&                  basicAllocator = ALLOCATOR());
+    flat_multimap(std::initializer_list<value_type> values,
+                  const ALLOCATOR&                  basicAllocator);
+        // Create a flat multimap holding the specified 'values'.  Optionally
+        // specify a 'comparator' and a 'basicAllocator', as for the default
+        // constructor.
+#endif
+
+    //! ~flat_multimap() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_multimap& operator=(const flat_multimap& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    flat_multimap& operator=(
+                           BloombergLP::bslmf::MovableRef<flat_multimap> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  The elements of 'rhs' are moved if the allocators of
+        // the two objects are equal, and move-inserted otherwise.  'rhs' is
+        // left in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multimap& operator=(std::initializer_list<value_type> values);
+        // Assign to this object the specified 'values', and return a
+        // reference providing modifiable access to this object.
+#endif
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator referring to the first element of this multimap,
+        // or the past-the-end iterator if this multimap is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator of this multimap.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator referring to the last element of this
+        // multimap, or the past-the-end reverse iterator if this multimap is
+        // empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator of this multimap.
+
+    iterator insert(const value_type& value);
+    iterator insert(BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multimap after any elements
+        // having an equivalent key, and return an iterator referring to the
+        // inserted element.  All iterators are invalidated.
+
+    template <class ALT_VALUE_TYPE>
+    typename enable_if<is_convertible<ALT_VALUE_TYPE, value_type>::value,
+                       iterator>::type
+    insert(BSLS_COMPILERFEATURES_FORWARD_REF(ALT_VALUE_TYPE) value)
+        // Insert into this multimap a 'value_type' object created from the
+        // specified 'value', after any elements having an equivalent key, and
+        // return an iterator referring to the inserted element.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        // Construct the value first, as its key is needed to find the
+        // position, and 'ALT_VALUE_TYPE' need not provide it.
+
+        BloombergLP::bsls::ObjectBuffer<value_type> temp;
+        ALLOCATOR alloc = get_allocator();
+        AllocatorTraits::construct(
+                         alloc,
+                         temp.address(),
+                         BSLS_COMPILERFEATURES_FORWARD(ALT_VALUE_TYPE, value));
+        BloombergLP::bslma::DestructorGuard<value_type> guard(temp.address());
+
+        return d_tree.insertMulti(temp.object().first,
+                                  MoveUtil::move(temp.object()));
+    }
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multimap as close as
+        // possible to the position just prior to the specified 'hint', and
+        // return an iterator referring to the inserted element.  The behavior
+        // is undefined unless 'hint' is a valid iterator into this multimap.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this multimap the elements in the specified range
+        // '[first, last)', each after any existing elements having an
+        // equivalent key.  The range is appended, sorted, and merged in a
+        // single pass.  If an exception is thrown, this multimap is left
+        // either unchanged or empty.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_equivalent_t,
+                INPUT_ITERATOR first,
+                INPUT_ITERATOR last);
+        // Insert into this multimap the elements in the specified range
+        // '[first, last)', each after any existing elements having an
+        // equivalent key, without sorting the range.  If an exception is
+        // thrown, this multimap is left either unchanged or empty.  The
+        // behavior is undefined unless the range is sorted by key.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<value_type> values);
+        // Insert into this multimap the specified 'values'.
+#endif
+
+    iterator erase(iterator position);
+    iterator erase(const_iterator position);
+        // Remove from this multimap the element at the specified 'position',
+        // and return an iterator referring to the element that followed it.
+        // The behavior is undefined unless 'position' refers to an element of
+        // this multimap.
+
+    size_type erase(const key_type& key);
+        // Remove from this multimap the elements having the specified 'key',
+        // and return the number of elements removed.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this multimap the elements in the specified range
+        // '[first, last)', and return an iterator referring to the element
+        // that followed them.  The behavior is undefined unless
+        // '[first, last)' is a valid range of elements of this multimap.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all elements from this multimap.  Note that the capacity of
+        // the underlying vector is retained.
+
+    container_type extract();
+        // Return the sorted vector of elements of this multimap, leaving this
+        // multimap empty.
+
+    void replace(BloombergLP::bslmf::MovableRef<container_type> values);
+        // Replace the elements of this multimap with the specified 'values',
+        // which are moved as for the move assignment of 'bsl::vector'.  The
+        // behavior is undefined unless 'values' is sorted by key.
+
+    void reserve(size_type numElements);
+        // Change the capacity of this multimap to at least the specified
+        // 'numElements', so that that many elements can be held without
+        // reallocation.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this multimap to its size, if possible.
+
+    void swap(flat_multimap& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  The allocators are exchanged if
+        // 'propagate_on_container_swap' is 'true' for 'ALLOCATOR'; otherwise,
+        // the behavior is undefined unless the allocators are equal.
+
+    iterator find(const key_type& key);
+        // Return an iterator referring to the first element of this multimap
+        // having the specified 'key', or the past-the-end iterator if there
+        // is none.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator referring to the first element of this multimap
+        // having a key equivalent to the specified 'key', or the past-the-end
+        // iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.find(key);
+    }
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator referring to the first element of this multimap
+        // whose key is not ordered before the specified 'key', or the
+        // past-the-end iterator if there is none.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    lower_bound(const LOOKUP_KEY& key)
+        // Return an iterator referring to the first element of this multimap
+        // whose key is not ordered before the specified 'key', or the
+        // past-the-end iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.lowerBound(key);
+    }
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator referring to the first element of this multimap
+        // whose key is ordered after the specified 'key', or the past-the-end
+        // iterator if there is none.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    upper_bound(const LOOKUP_KEY& key)
+        // Return an iterator referring to the first element of this multimap
+        // whose key is ordered after the specified 'key', or the past-the-end
+        // iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.upperBound(key);
+    }
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators delimiting the elements of this multimap
+        // having the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators delimiting the elements of this multimap
+        // having a key equivalent to the specified 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return pair<iterator, iterator>(d_tree.lowerBound(key),
+                                        d_tree.upperBound(key));
+    }
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used to supply memory.
+
+    key_compare key_comp() const;
+        // Return (a copy of) the comparator used to order keys.
+
+    value_compare value_comp() const;
+        // Return a functor comparing elements of this multimap by key.
+
+    const container_type& container() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reference providing non-modifiable access to the sorted
+        // vector of elements of this multimap.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator referring to the first element of this multimap,
+        // or the past-the-end iterator if this multimap is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator of this multimap.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator referring to the last element of this
+        // multimap, or the past-the-end reverse iterator if this multimap is
+        // empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator of this multimap.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this multimap has no elements, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this multimap.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the number of elements this
+        // multimap can hold.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements this multimap can hold without
+        // reallocation.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this multimap has an element having the specified
+        // 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this multimap has an element having a key
+        // equivalent to the specified 'key', and 'false' otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.find(key) != end();
+    }
+
+    size_type count(const key_type& key) const;
+        // Return the number of elements of this multimap having the specified
+        // 'key'.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of elements of this multimap having a key
+        // equivalent to the specified 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.count(key);
+    }
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator referring to the first element of this multimap
+        // having the specified 'key', or the past-the-end iterator if there
+        // is none.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator referring to the first element of this multimap
+        // having a key equivalent to the specified 'key', or the past-the-end
+        // iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.find(key);
+    }
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator referring to the first element of this multimap
+        // whose key is not ordered before the specified 'key', or the
+        // past-the-end iterator if there is none.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator referring to the first element of this multimap
+        // whose key is not ordered before the specified 'key', or the
+        // past-the-end iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.lowerBound(key);
+    }
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator referring to the first element of this multimap
+        // whose key is ordered after the specified 'key', or the past-the-end
+        // iterator if there is none.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator referring to the first element of this multimap
+        // whose key is ordered after the specified 'key', or the past-the-end
+        // iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_tree.upperBound(key);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators delimiting the elements of this multimap
+        // having the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators delimiting the elements of this multimap
+        // having a key equivalent to the specified 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return pair<const_iterator, const_iterator>(d_tree.lowerBound(key),
+                                                    d_tree.upperBound(key));
+    }
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_multimap' objects have the
+    // same value if they have the same number of elements, and each element
+    // of 'lhs' has the same value as the corresponding element of 'rhs'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return the result of the lexicographical comparison of the elements of
+    // the specified 'lhs' and 'rhs' multimaps, using 'operator<' on
+    // 'value_type'.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the values and comparators of the specified 'a' and 'b'
+    // objects, as for the 'swap' member.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                    // ----------------------------------
+                    // class flat_multimap::value_compare
+                    // ----------------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare::value_compare(
+                                                         COMPARATOR comparator)
+: comp(comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare::operator()(
+                                                     const value_type& x,
+                                                     const value_type& y) const
+{
+    return comp(x.first, y.first);
+}
+
+                            // -------------------
+                            // class flat_multimap
+                            // -------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap()
+: d_tree(COMPARATOR(), ALLOCATOR())
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                              const COMPARATOR& comparator,
+                                              const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                               const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                                 const flat_multimap& original)
+: d_tree(original.d_tree,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                  original.get_allocator()))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                        BloombergLP::bslmf::MovableRef<flat_multimap> original)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                          const flat_multimap&  original,
+                                          const ALLOCATOR&      basicAllocator)
+: d_tree(original.d_tree, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                  BloombergLP::bslmf::MovableRef<flat_multimap> original,
+                  const ALLOCATOR&                              basicAllocator)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              const COMPARATOR& comparator,
+                                              const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertRange(first, last, false, false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                               INPUT_ITERATOR   first,
+                                               INPUT_ITERATOR   last,
+                                               const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertRange(first, last, false, false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                              sorted_equivalent_t,
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              const COMPARATOR& comparator,
+                                              const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertRange(first, last, false, true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                               sorted_equivalent_t,
+                                               INPUT_ITERATOR   first,
+                                               INPUT_ITERATOR   last,
+                                               const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertRange(first, last, false, true);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                              std::initializer_list<value_type> values,
+                              const COMPARATOR&                 comparator,
+                              const ALLOCATOR&                  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insertRange(values.begin(), values.end(), false, false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                              std::initializer_list<value_type> values,
+                              const ALLOCATOR&                  basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insertRange(values.begin(), values.end(), false, false);
+}
+#endif
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                                      const flat_multimap& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                             BloombergLP::bslmf::MovableRef<flat_multimap> rhs)
+{
+    d_tree = MoveUtil::move(MoveUtil::access(rhs).d_tree);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    d_tree.container().clear();
+    d_tree.insertRange(values.begin(), values.end(), false, false);
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container().begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container().end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                       const value_type& value)
+{
+    return d_tree.insertMulti(value.first, value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type& lvalue = value;
+    return d_tree.insertMulti(lvalue.first, MoveUtil::move(lvalue));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                       const_iterator    hint,
+                                                       const value_type& value)
+{
+    return d_tree.insertMulti(hint, value.first, value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                              const_iterator                             hint,
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type& lvalue = value;
+    return d_tree.insertMulti(hint, lvalue.first, MoveUtil::move(lvalue));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    d_tree.insertRange(first, last, false, false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                          sorted_equivalent_t,
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    d_tree.insertRange(first, last, false, true);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    d_tree.insertRange(values.begin(), values.end(), false, false);
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(iterator position)
+{
+    return d_tree.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    return d_tree.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const iterator first = d_tree.lowerBound(key);
+    const iterator last  = d_tree.upperBound(key);
+    const size_type numErased = last - first;
+    d_tree.erase(first, last);
+    return numErased;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                        const_iterator last)
+{
+    return d_tree.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    d_tree.container().clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::container_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::extract()
+{
+    container_type result(MoveUtil::move(d_tree.container()));
+    d_tree.container().clear();
+    return result;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::replace(
+                         BloombergLP::bslmf::MovableRef<container_type> values)
+{
+    d_tree.replace(MoveUtil::move(values), false, true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reserve(
+                                                         size_type numElements)
+{
+    d_tree.container().reserve(numElements);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_tree.container().shrink_to_fit();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(
+                                                          flat_multimap& other)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                           const key_type& key)
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                           const key_type& key)
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+     typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                           const key_type& key)
+{
+    return pair<iterator, iterator>(d_tree.lowerBound(key),
+                                    d_tree.upperBound(key));
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container().get_allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(d_tree.comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                                container_type&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::container() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container().begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container().end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                        const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                        const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                        const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                        const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container().empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container().size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container().max_size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::capacity() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_tree.container().capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::contains(
+                                                     const key_type& key) const
+{
+    return d_tree.find(key) != end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(
+                                                     const key_type& key) const
+{
+    return d_tree.count(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(
+                                                     const key_type& key) const
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                     const key_type& key) const
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    return pair<const_iterator, const_iterator>(d_tree.lowerBound(key),
+                                                d_tree.upperBound(key));
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                              TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+//: o A flat container is bitwise movable if its allocator and comparator are
+//:   bitwise movable, as it holds only a 'bsl::vector' and a comparator.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+: bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<
+                        bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+: bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+namespace bslmf {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct IsBitwiseMoveable<
+                        bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+: bsl::integral_constant<bool, IsBitwiseMoveable<ALLOCATOR>::value
+                            && IsBitwiseMoveable<COMPARATOR>::value>
+{};
+
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,637 @@
+// bslstl_flatmultimap.t.cpp                                          -*-C++-*-
+#include <bslstl_flatmultimap.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a value-semantic container,
+// 'bsl::flat_multimap', implemented in terms of 'bslstl::FlatTree', whose
+// algorithms are tested thoroughly in 'bslstl_flattree.t.cpp'.  We therefore
+// concentrate on the forwarding of each method, the order in which elements
+// having equivalent keys are kept, the 'sorted_equivalent' overloads,
+// allocator propagation, and the free operators.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_multimap();
+// [ 2] flat_multimap(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_multimap(const ALLOCATOR&);
+// [ 2] flat_multimap(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+// [ 2] flat_multimap(sorted_equivalent_t, INPUT_ITERATOR, ...);
+// [ 4] flat_multimap(const flat_multimap&, const ALLOCATOR&);
+// [ 4] flat_multimap(MovableRef<flat_multimap>);
+//
+// MANIPULATORS
+// [ 4] flat_multimap& operator=(const flat_multimap&);
+// [ 2] iterator insert(const value_type&);
+// [ 2] iterator insert(MovableRef<value_type>);
+// [ 2] iterator insert(ALT_VALUE_TYPE&&);
+// [ 2] iterator insert(const_iterator, const value_type&);
+// [ 2] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 2] void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] iterator erase(const_iterator);
+// [ 3] size_type erase(const key_type&);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 3] container_type extract();
+// [ 3] void replace(MovableRef<container_type>);
+// [ 4] void swap(flat_multimap&);
+//
+// ACCESSORS
+// [ 3] bool contains(const key_type&) const;
+// [ 3] size_type count(const key_type&) const;
+// [ 3] const_iterator find(const key_type&) const;
+// [ 3] const_iterator lower_bound(const key_type&) const;
+// [ 3] const_iterator upper_bound(const key_type&) const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(const key_type&);
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const flat_multimap&, const flat_multimap&);
+// [ 4] bool operator<(const flat_multimap&, const flat_multimap&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] ALLOCATOR PROPAGATION AND TYPE TRAITS
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                GLOBAL TYPEDEFS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+
+typedef bsl::flat_multimap<int, int>                  Obj;
+typedef Obj::value_type                               Value;
+typedef bsl::flat_multimap<bsl::string, bsl::string>  StringMap;
+typedef StringMap::value_type                         StringValue;
+
+static
+bool isValid(const Obj& map)
+    // Return 'true' if the keys of the specified 'map' are non-decreasing,
+    // and 'false' otherwise.
+{
+    for (Obj::const_iterator it = map.begin(); it != map.end(); ++it) {
+        if (it != map.begin() && it->first < (it - 1)->first) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test        = argc > 1 ? atoi(argv[1]) : 0;
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing Trades by Security
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we hold a day's trades, several per security, and want to visit
+// the trades of one security at a time.
+//
+// First, we build the index from the unsorted trades in a single pass:
+//..
+        typedef bsl::pair<int, double> Trade;  // (security, price)
+
+        const Trade TRADES[] = { Trade(200, 7.5),
+                                 Trade(100, 1.0),
+                                 Trade(200, 7.25),
+                                 Trade(100, 1.5) };
+
+        bsl::flat_multimap<int, double> index(TRADES, TRADES + 4);
+        ASSERT(4 == index.size());
+        ASSERT(2 == index.count(200));
+//..
+// Then, we visit the trades of security 200, which appear in the order in
+// which they were inserted:
+//..
+        typedef bsl::flat_multimap<int, double>::const_iterator Iterator;
+
+        bsl::pair<Iterator, Iterator> range = index.equal_range(200);
+        ASSERT(2    == range.second - range.first);
+        ASSERT(7.5  == range.first[0].second);
+        ASSERT(7.25 == range.first[1].second);
+//..
+// Finally, we remove every trade of security 100:
+//..
+        ASSERT(2 == index.erase(100));
+        ASSERT(2 == index.size());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // VALUE SEMANTICS AND ALLOCATORS
+        //
+        // Concerns:
+        //: 1 Copy and move construction and assignment produce a map having
+        //:   the original value, using the intended allocator.
+        //:
+        //: 2 'swap' exchanges values.
+        //:
+        //: 3 The comparison operators compare lexicographically, including
+        //:   the mapped values.
+        //:
+        //: 4 Elements use the map's allocator, no memory is leaked if an
+        //:   insertion throws, and the traits are as documented.
+        //
+        // Plan:
+        //: 1 Exercise each operation with test allocators.  (C-1..3)
+        //:
+        //: 2 Insert string values under the 'bslma' exception test macros,
+        //:   and check the allocator of each element.  (C-4)
+        //
+        // Testing:
+        //   flat_multimap(const flat_multimap&, const ALLOCATOR&);
+        //   flat_multimap(MovableRef<flat_multimap>);
+        //   flat_multimap& operator=(const flat_multimap&);
+        //   void swap(flat_multimap&);
+        //   bool operator==(const flat_multimap&, const flat_multimap&);
+        //   bool operator<(const flat_multimap&, const flat_multimap&);
+        //   ALLOCATOR PROPAGATION AND TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nVALUE SEMANTICS AND ALLOCATORS"
+                            "\n==============================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        const Value VALUES[] = {
+            Value(2, 0), Value(1, 1), Value(2, 2), Value(1, 3), Value(2, 4)
+        };
+
+        Obj mX(VALUES, VALUES + 5, &oa);  const Obj& X = mX;
+
+        {
+            Obj mY(X, &sa);  const Obj& Y = mY;
+            ASSERT(X   == Y);
+            ASSERT(&sa == Y.get_allocator().mechanism());
+
+            Obj mZ(MoveUtil::move(mY));  const Obj& Z = mZ;
+            ASSERT(X   == Z);
+            ASSERT(&sa == Z.get_allocator().mechanism());
+
+            Obj mW(&oa);  const Obj& W = mW;
+            mW = Z;
+            ASSERT(X == W);
+
+            mW.insert(Value(0, 0));
+            mW.swap(mZ);
+            ASSERT(X == W);
+            ASSERT(6 == Z.size());
+        }
+
+        {
+            Obj mY(X, &oa);  const Obj& Y = mY;
+
+            mY.insert(Y.lower_bound(2), Value(2, -1));  // differs in value
+            ASSERT(X != Y);
+            ASSERT(Y <  X);
+            ASSERT(X >  Y);
+            ASSERT(!(X < X));
+            ASSERT(X <= X);
+            ASSERT(X >= X);
+        }
+
+        if (veryVerbose) printf("\tAllocators.\n");
+        {
+            const char *LONG = "a string long enough to require an allocation";
+
+            bsl::vector<StringValue> values(&sa);
+            for (int i = 0; i < 10; ++i) {
+                values.push_back(StringValue(bsl::string(i % 2 ? "b" : "a",
+                                                         &sa),
+                                             bsl::string(LONG, &sa)));
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StringMap mS(&oa);  const StringMap& S = mS;
+
+                mS.insert(values.begin(), values.begin() + 5);
+                mS.insert(values.begin() + 5, values.end());
+                ASSERT(10 == S.size());
+
+                for (StringMap::const_iterator it = S.begin();
+                                                       it != S.end(); ++it) {
+                    ASSERT(&oa == it->first.get_allocator().mechanism());
+                    ASSERT(&oa == it->second.get_allocator().mechanism());
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(0 == da.numBlocksInUse());
+        }
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // LOOKUP AND ERASURE
+        //
+        // Concerns:
+        //: 1 'count', 'contains', 'find', 'lower_bound', 'upper_bound', and
+        //:   'equal_range' locate every element having a key, and 'find'
+        //:   returns the first of them.
+        //:
+        //: 2 'erase(key)' removes every element having the key and returns
+        //:   their number; the other 'erase' overloads remove the indicated
+        //:   elements.
+        //:
+        //: 3 'extract' and 'replace' transfer the underlying sequence.
+        //
+        // Plan:
+        //: 1 Populate a map where key 'k' occurs 'k' times, and look up and
+        //:   erase every key in and around its range.  (C-1..3)
+        //
+        // Testing:
+        //   bool contains(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   const_iterator find(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   container_type extract();
+        //   void replace(MovableRef<container_type>);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP AND ERASURE"
+                            "\n==================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int k = 1; k <= 6; ++k) {
+            for (int i = 0; i < k; ++i) {
+                mX.insert(Value(k, i));
+            }
+        }
+        ASSERT(21 == X.size());
+
+        for (int k = 0; k <= 7; ++k) {
+            const Obj::size_type COUNT = 1 <= k && k <= 6 ? k : 0;
+            const Obj::size_type FIRST = k <= 0 ? 0
+                                       : k >= 7 ? 21
+                                       : (k - 1) * k / 2;
+
+            ASSERTV(k, COUNT == X.count(k));
+            ASSERTV(k, (0 != COUNT) == X.contains(k));
+            ASSERTV(k, X.begin() + FIRST == X.lower_bound(k));
+            ASSERTV(k, X.begin() + FIRST + COUNT == X.upper_bound(k));
+            ASSERTV(k, mX.begin() + FIRST == mX.lower_bound(k));
+            ASSERTV(k, (COUNT ? X.begin() + FIRST : X.end()) == X.find(k));
+            ASSERTV(k, X.begin() + FIRST == X.equal_range(k).first);
+            ASSERTV(k, X.begin() + FIRST + COUNT == X.equal_range(k).second);
+            if (COUNT) {
+                ASSERTV(k, 0 == X.find(k)->second);
+            }
+        }
+
+        {
+            Obj mY(X, &oa);  const Obj& Y = mY;
+
+            ASSERT(4 == mY.erase(4));
+            ASSERT(0 == mY.erase(4));
+            ASSERT(17 == Y.size());
+
+            Obj::iterator it = mY.erase(Y.find(3));
+            ASSERT(Value(3, 1) == *it);
+
+            it = mY.erase(Y.lower_bound(5), Y.upper_bound(5));
+            ASSERT(Value(6, 0) == *it);
+            ASSERT(11 == Y.size());
+            ASSERT(isValid(Y));
+        }
+
+        {
+            Obj mY(X, &oa);  const Obj& Y = mY;
+
+            Obj::container_type values = mY.extract();
+            ASSERT(Y.empty());
+            ASSERT(21 == values.size());
+
+            values.erase(values.begin());
+            mY.replace(MoveUtil::move(values));
+            ASSERT(20 == Y.size());
+            ASSERT(2  == Y.begin()->first);
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND INSERTION
+        //
+        // Concerns:
+        //: 1 Each constructor creates a map having the specified comparator,
+        //:   allocator, and elements, sorted by key.
+        //:
+        //: 2 Elements having equivalent keys keep their order of insertion:
+        //:   an unhinted 'insert' places a value after the elements having an
+        //:   equivalent key, and a hinted 'insert' places it as close as
+        //:   possible before the hint.
+        //:
+        //: 3 A range 'insert' keeps the existing elements before new elements
+        //:   having equivalent keys.
+        //
+        // Plan:
+        //: 1 Create maps with each constructor and insert values having
+        //:   repeated keys, tagging each value with a sequence number.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   flat_multimap();
+        //   flat_multimap(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_multimap(const ALLOCATOR&);
+        //   flat_multimap(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+        //   flat_multimap(sorted_equivalent_t, INPUT_ITERATOR, ...);
+        //   iterator insert(const value_type&);
+        //   iterator insert(MovableRef<value_type>);
+        //   iterator insert(ALT_VALUE_TYPE&&);
+        //   iterator insert(const_iterator, const value_type&);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND INSERTION"
+                            "\n==========================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        {
+            const Obj X;
+            ASSERT(X.empty());
+            ASSERT(&da == X.get_allocator().mechanism());
+        }
+        {
+            typedef bsl::flat_multimap<int, int, std::greater<int> > Reverse;
+
+            const Value VALUES[] = { Value(1, 0), Value(3, 1), Value(1, 2) };
+
+            Reverse mX(std::greater<int>(), &oa);  const Reverse& X = mX;
+            mX.insert(VALUES, VALUES + 3);
+            ASSERT(3           == X.size());
+            ASSERT(Value(3, 1) == X.begin()[0]);
+            ASSERT(Value(1, 0) == X.begin()[1]);
+            ASSERT(Value(1, 2) == X.begin()[2]);
+            ASSERT(X.key_comp()(2, 1));
+            ASSERT(X.value_comp()(Value(2, 0), Value(1, 0)));
+        }
+        {
+            const Value VALUES[] = {
+                Value(2, 0), Value(1, 1), Value(2, 2), Value(1, 3)
+            };
+            const Obj X(VALUES, VALUES + 4, &oa);
+            ASSERT(4           == X.size());
+            ASSERT(Value(1, 1) == X.begin()[0]);
+            ASSERT(Value(1, 3) == X.begin()[1]);
+            ASSERT(Value(2, 0) == X.begin()[2]);
+            ASSERT(Value(2, 2) == X.begin()[3]);
+            ASSERT(&oa         == X.get_allocator().mechanism());
+            ASSERT(X.container().begin() == X.begin());
+
+            const Obj Y(bsl::sorted_equivalent,
+                        X.begin(),
+                        X.end(),
+                        std::less<int>(),
+                        &oa);
+            ASSERT(X == Y);
+        }
+
+        if (veryVerbose) printf("\tSingle-value 'insert'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            Obj::iterator it = mX.insert(Value(5, 0));
+            ASSERT(Value(5, 0) == *it);
+
+            it = mX.insert(Value(5, 1));
+            ASSERT(X.begin() + 1 == it);
+
+            Value v(5, 2);
+            it = mX.insert(MoveUtil::move(v));
+            ASSERT(X.begin() + 2 == it);
+
+            it = mX.insert(bsl::pair<short, long>(5, 3));
+            ASSERT(X.begin() + 3 == it);
+
+            it = mX.insert(X.begin(), Value(5, 4));  // valid hint
+            ASSERT(X.begin() == it);
+
+            it = mX.insert(X.begin() + 2, Value(5, 5));  // valid hint
+            ASSERT(X.begin() + 2 == it);
+
+            it = mX.insert(X.begin(), Value(6, 6));  // invalid hint
+            ASSERT(X.end() - 1 == it);
+
+            const int EXP[] = { 4, 0, 5, 1, 2, 3, 6 };
+            ASSERT(7 == X.size());
+            for (int i = 0; i < 7; ++i) {
+                ASSERTV(i, EXP[i] == X.begin()[i].second);
+            }
+        }
+
+        if (veryVerbose) printf("\tRange 'insert'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.insert(Value(2, 0));
+            mX.insert(Value(4, 1));
+
+            const Value VALUES[] = { Value(4, 2), Value(2, 3), Value(3, 4) };
+            mX.insert(VALUES, VALUES + 3);
+
+            const int EXP[] = { 0, 3, 4, 1, 2 };
+            ASSERT(5 == X.size());
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, EXP[i] == X.begin()[i].second);
+            }
+
+            const Value SORTED[] = { Value(1, 5), Value(4, 6), Value(4, 7) };
+            mX.insert(bsl::sorted_equivalent, SORTED, SORTED + 3);
+            ASSERT(8 == X.size());
+            ASSERT(Value(1, 5) == X.begin()[0]);
+            ASSERT(Value(4, 7) == X.end()[-1]);
+            ASSERT(isValid(X));
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, iterate, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        mX.insert(Value(3, 30));
+        mX.insert(Value(1, 10));
+        mX.insert(Value(3, 31));
+        ASSERT(3  == X.size());
+        ASSERT(2  == X.count(3));
+        ASSERT(1  == X.begin()->first);
+        ASSERT(31 == X.rbegin()->second);
+        ASSERT(30 == X.find(3)->second);
+
+        ASSERT(2 == mX.erase(3));
+        ASSERT(1 == X.size());
+
+        const Obj Y(X, &oa);
+        ASSERT(X == Y);
+
+        ASSERT(0 <  oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
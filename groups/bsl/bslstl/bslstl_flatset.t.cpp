@@ -0,0 +1,652 @@
+// bslstl_flatset.t.cpp                                               -*-C++-*-
+#include <bslstl_flatset.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a value-semantic container, 'bsl::flat_set',
+// implemented in terms of 'bslstl::FlatTree', whose algorithms are tested
+// thoroughly in 'bslstl_flattree.t.cpp'.  We therefore concentrate on the
+// forwarding of each method, the 'sorted_unique' overloads, heterogeneous
+// lookup, allocator propagation, and the free operators.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_set();
+// [ 2] flat_set(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_set(const ALLOCATOR&);
+// [ 2] flat_set(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+// [ 2] flat_set(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+// [ 4] flat_set(const flat_set&, const ALLOCATOR&);
+// [ 4] flat_set(MovableRef<flat_set>);
+//
+// MANIPULATORS
+// [ 4] flat_set& operator=(const flat_set&);
+// [ 2] pair<iterator, bool> insert(const value_type&);
+// [ 2] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 2] iterator insert(const_iterator, const value_type&);
+// [ 2] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 2] void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] iterator erase(const_iterator);
+// [ 3] size_type erase(const key_type&);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 3] container_type extract();
+// [ 3] void replace(MovableRef<container_type>);
+// [ 4] void swap(flat_set&);
+//
+// ACCESSORS
+// [ 3] bool contains(const key_type&) const;
+// [ 3] size_type count(const key_type&) const;
+// [ 3] const_iterator find(const key_type&) const;
+// [ 3] const_iterator lower_bound(const key_type&) const;
+// [ 3] const_iterator upper_bound(const key_type&) const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 3] const_iterator find(const LOOKUP_KEY&) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const flat_set&, const flat_set&);
+// [ 4] bool operator<(const flat_set&, const flat_set&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] ALLOCATOR PROPAGATION AND TYPE TRAITS
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                GLOBAL TYPEDEFS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+
+typedef bsl::flat_set<int>          Obj;
+typedef bsl::flat_set<bsl::string>  StringSet;
+
+                       // ===========================
+                       // struct TransparentComparator
+                       // ===========================
+
+struct TransparentComparator
+    // This class can be used as a comparator for containers.  It has a nested
+    // type 'is_transparent', so it is classified as transparent by the
+    // 'bslmf::IsTransparentPredicate' metafunction and can be used for
+    // heterogeneous comparison.
+{
+    typedef void is_transparent;
+
+    template <class LHS, class RHS>
+    bool operator()(const LHS& lhs, const RHS& rhs) const
+        // Return 'true' if the specified 'lhs' is less than the specified
+        // 'rhs' and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+};
+
+                         // ======================
+                         // struct ModuloTenLookup
+                         // ======================
+
+struct ModuloTenLookup {
+    // This 'struct' is a lookup key that is equivalent to every 'int' in
+    // '[10 * d_decade, 10 * d_decade + 10)', and is not convertible to 'int'.
+
+    // DATA
+    int d_decade;  // decade of the equivalent values
+
+    // FRIENDS
+    friend bool operator<(const ModuloTenLookup& lhs, int rhs)
+        // Return 'true' if the specified 'lhs' is ordered before the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.d_decade < rhs / 10;
+    }
+
+    friend bool operator<(int lhs, const ModuloTenLookup& rhs)
+        // Return 'true' if the specified 'lhs' is ordered before the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs / 10 < rhs.d_decade;
+    }
+};
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test        = argc > 1 ? atoi(argv[1]) : 0;
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Checking Membership in a Fixed Set
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to check, many times, whether a port number is in a fixed
+// set of blocked ports.
+//
+// First, we build the set from an unsorted array having a duplicate:
+//..
+        const int PORTS[] = { 8080, 22, 443, 22, 80 };
+
+        bsl::flat_set<int> blocked(PORTS, PORTS + 5);
+        ASSERT(4 == blocked.size());
+//..
+// Then, we check membership:
+//..
+        ASSERT( blocked.contains(443));
+        ASSERT(!blocked.contains(8443));
+//..
+// Finally, we observe that the underlying vector is sorted, so that it can be
+// passed to a function expecting a sorted sequence:
+//..
+        const bsl::vector<int>& ports = blocked.container();
+        ASSERT(22   == ports.front());
+        ASSERT(8080 == ports.back());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // VALUE SEMANTICS AND ALLOCATORS
+        //
+        // Concerns:
+        //: 1 Copy and move construction and assignment produce a set having
+        //:   the original value, using the intended allocator.
+        //:
+        //: 2 'swap' exchanges values.
+        //:
+        //: 3 The comparison operators compare lexicographically.
+        //:
+        //: 4 Elements use the set's allocator, no memory is leaked if an
+        //:   insertion throws, and the traits are as documented.
+        //
+        // Plan:
+        //: 1 Exercise each operation with test allocators.  (C-1..3)
+        //:
+        //: 2 Insert strings under the 'bslma' exception test macros, and
+        //:   check the allocator of each element.  (C-4)
+        //
+        // Testing:
+        //   flat_set(const flat_set&, const ALLOCATOR&);
+        //   flat_set(MovableRef<flat_set>);
+        //   flat_set& operator=(const flat_set&);
+        //   void swap(flat_set&);
+        //   bool operator==(const flat_set&, const flat_set&);
+        //   bool operator<(const flat_set&, const flat_set&);
+        //   ALLOCATOR PROPAGATION AND TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nVALUE SEMANTICS AND ALLOCATORS"
+                            "\n==============================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        const int VALUES[] = { 5, 1, 4, 2, 3 };
+
+        Obj mX(VALUES, VALUES + 5, &oa);  const Obj& X = mX;
+
+        {
+            Obj mY(X, &sa);  const Obj& Y = mY;
+            ASSERT(X   == Y);
+            ASSERT(&sa == Y.get_allocator().mechanism());
+
+            Obj mZ(MoveUtil::move(mY));  const Obj& Z = mZ;
+            ASSERT(X   == Z);
+            ASSERT(&sa == Z.get_allocator().mechanism());
+
+            Obj mW(&oa);  const Obj& W = mW;
+            mW = Z;
+            ASSERT(X == W);
+
+            mW.insert(0);
+            mW.swap(mZ);
+            ASSERT(X == W);
+            ASSERT(6 == Z.size());
+
+            ASSERT(Z <  X);  // 0 1 2 3 4 5 < 1 2 3 4 5
+            ASSERT(X >  Z);
+            ASSERT(Z != X);
+            ASSERT(X <= W);
+            ASSERT(X >= W);
+        }
+
+        if (veryVerbose) printf("\tAllocators.\n");
+        {
+            const char *LONG = "a string long enough to require an allocation";
+
+            bsl::vector<bsl::string> values(&sa);
+            for (int i = 0; i < 10; ++i) {
+                values.push_back(bsl::string(LONG, &sa));
+                values.back().push_back(static_cast<char>('a' + (i * 3) % 7));
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StringSet mS(&oa);  const StringSet& S = mS;
+
+                mS.insert(values.begin(), values.begin() + 5);
+                mS.insert(values.begin() + 5, values.end());
+                ASSERT(7 == S.size());
+
+                for (StringSet::const_iterator it = S.begin();
+                                                       it != S.end(); ++it) {
+                    ASSERT(&oa == it->get_allocator().mechanism());
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(0 == da.numBlocksInUse());
+        }
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // LOOKUP AND ERASURE
+        //
+        // Concerns:
+        //: 1 'count', 'contains', 'find', 'lower_bound', 'upper_bound', and
+        //:   'equal_range' locate the correct element.
+        //:
+        //: 2 With a transparent comparator, the lookup methods accept a key of
+        //:   another type, which may be equivalent to several elements.
+        //:
+        //: 3 Each 'erase' overload removes the indicated elements.
+        //:
+        //: 4 'extract' and 'replace' transfer the underlying sequence.
+        //
+        // Plan:
+        //: 1 Populate a set with even keys and look up every key in and
+        //:   around its range.  (C-1)
+        //:
+        //: 2 Look up 'ModuloTenLookup' keys in a set having a transparent
+        //:   comparator.  (C-2)
+        //:
+        //: 3 Erase, extract, and replace elements.  (C-3..4)
+        //
+        // Testing:
+        //   bool contains(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   const_iterator find(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   container_type extract();
+        //   void replace(MovableRef<container_type>);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP AND ERASURE"
+                            "\n==================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < 20; ++i) {
+            mX.insert(2 * i);
+        }
+
+        for (int key = -2; key <= 42; ++key) {
+            const bool PRESENT = 0 <= key && key < 40 && 0 == key % 2;
+            const int  LB      = key < 0 ? 0 : key > 40 ? 20 : (key + 1) / 2;
+            const int  UB      = PRESENT ? LB + 1 : LB;
+
+            ASSERTV(key, PRESENT == X.contains(key));
+            ASSERTV(key, (PRESENT ? 1u : 0u) == X.count(key));
+            ASSERTV(key, X.begin() + LB == X.lower_bound(key));
+            ASSERTV(key, X.begin() + UB == X.upper_bound(key));
+            ASSERTV(key, mX.begin() + LB == mX.lower_bound(key));
+            ASSERTV(key, (PRESENT ? X.begin() + LB : X.end()) == X.find(key));
+            ASSERTV(key, X.begin() + LB == X.equal_range(key).first);
+            ASSERTV(key, X.begin() + UB == X.equal_range(key).second);
+        }
+
+        if (veryVerbose) printf("\tHeterogeneous lookup.\n");
+        {
+            typedef bsl::flat_set<int, TransparentComparator> TransparentSet;
+
+            TransparentSet mT(X.begin(), X.end(), &oa);
+            const TransparentSet& T = mT;
+
+            const ModuloTenLookup SECOND = { 1 };
+            const ModuloTenLookup FIFTH  = { 4 };
+
+            ASSERT(5 == T.count(SECOND));
+            ASSERT(T.contains(SECOND));
+            ASSERT(!T.contains(FIFTH));
+            ASSERT(T.end() == T.find(FIFTH));
+            ASSERT(10 == *T.find(SECOND));
+            ASSERT(10 == *T.lower_bound(SECOND));
+            ASSERT(20 == *T.upper_bound(SECOND));
+            bsl::pair<TransparentSet::const_iterator,
+                      TransparentSet::const_iterator> range =
+                                                       T.equal_range(SECOND);
+            ASSERT(5  == range.second - range.first);
+            ASSERT(T.end() == mT.lower_bound(FIFTH));
+        }
+
+        {
+            Obj mY(X, &oa);  const Obj& Y = mY;
+
+            ASSERT(1 == mY.erase(4));
+            ASSERT(0 == mY.erase(4));
+            ASSERT(19 == Y.size());
+
+            Obj::iterator it = mY.erase(Y.find(6));
+            ASSERT(8 == *it);
+
+            it = mY.erase(Y.find(10), Y.find(20));
+            ASSERT(20 == *it);
+            ASSERT(13 == Y.size());
+        }
+
+        {
+            Obj mY(X, &oa);  const Obj& Y = mY;
+
+            Obj::container_type values = mY.extract();
+            ASSERT(Y.empty());
+            ASSERT(20 == values.size());
+
+            values.erase(values.begin());
+            mY.replace(MoveUtil::move(values));
+            ASSERT(19 == Y.size());
+            ASSERT(2  == *Y.begin());
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND INSERTION
+        //
+        // Concerns:
+        //: 1 Each constructor creates a set having the specified comparator,
+        //:   allocator, and elements, sorted and without duplicates.
+        //:
+        //: 2 Each 'insert' overload inserts a value only if it is absent, and
+        //:   returns the position of the equivalent element.
+        //
+        // Plan:
+        //: 1 Create sets with each constructor and insert values, some of
+        //:   which are already present.  (C-1..2)
+        //
+        // Testing:
+        //   flat_set();
+        //   flat_set(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_set(const ALLOCATOR&);
+        //   flat_set(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+        //   flat_set(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+        //   pair<iterator, bool> insert(const value_type&);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   iterator insert(const_iterator, const value_type&);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND INSERTION"
+                            "\n==========================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        {
+            const Obj X;
+            ASSERT(X.empty());
+            ASSERT(&da == X.get_allocator().mechanism());
+        }
+        {
+            typedef bsl::flat_set<int, std::greater<int> > Reverse;
+
+            const int VALUES[] = { 1, 3, 2, 3 };
+
+            Reverse mX(std::greater<int>(), &oa);  const Reverse& X = mX;
+            mX.insert(VALUES, VALUES + 4);
+            ASSERT(3 == X.size());
+            ASSERT(3 == X.begin()[0]);
+            ASSERT(1 == X.begin()[2]);
+            ASSERT(X.key_comp()(2, 1));
+            ASSERT(X.value_comp()(2, 1));
+        }
+        {
+            const int VALUES[] = { 3, 1, 2, 1 };
+            const int SORTED[] = { 1, 2, 3 };
+
+            const Obj X(VALUES, VALUES + 4, &oa);
+            ASSERT(3   == X.size());
+            ASSERT(&oa == X.get_allocator().mechanism());
+            ASSERT(X.container().begin() == X.begin());
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, SORTED[i] == X.begin()[i]);
+            }
+
+            const Obj Y(bsl::sorted_unique, SORTED, SORTED + 3, &oa);
+            ASSERT(X == Y);
+
+            const Obj Z(bsl::sorted_unique,
+                        SORTED,
+                        SORTED + 3,
+                        std::less<int>(),
+                        &oa);
+            ASSERT(X == Z);
+        }
+
+        if (veryVerbose) printf("\tSingle-value 'insert'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bsl::pair<Obj::iterator, bool> rv = mX.insert(5);
+            ASSERT(rv.second);
+            ASSERT(5 == *rv.first);
+
+            rv = mX.insert(5);
+            ASSERT(!rv.second);
+            ASSERT(X.begin() == rv.first);
+
+            int v = 3;
+            rv = mX.insert(MoveUtil::move(v));
+            ASSERT(rv.second);
+            ASSERT(X.begin() == rv.first);
+
+            Obj::iterator it = mX.insert(X.end(), 9);
+            ASSERT(9 == *it);
+            it = mX.insert(X.begin(), 7);  // bad hint
+            ASSERT(7 == *it);
+            it = mX.insert(X.begin(), 5);  // existing value
+            ASSERT(X.begin() + 1 == it);
+
+            ASSERT(4 == X.size());
+        }
+
+        if (veryVerbose) printf("\tRange 'insert'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.insert(4);
+
+            const int VALUES[] = { 8, 2, 4, 6, 2 };
+            mX.insert(VALUES, VALUES + 5);
+            ASSERT(4 == X.size());
+            ASSERT(2 == *X.begin());
+
+            const int SORTED[] = { 1, 3, 10 };
+            mX.insert(bsl::sorted_unique, SORTED, SORTED + 3);
+            ASSERT(7  == X.size());
+            ASSERT(1  == X.begin()[0]);
+            ASSERT(10 == X.end()[-1]);
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, iterate, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        mX.insert(3);
+        mX.insert(1);
+        mX.insert(3);
+        mX.insert(2);
+        ASSERT(3 == X.size());
+        ASSERT(1 == *X.begin());
+        ASSERT(3 == *X.rbegin());
+        ASSERT(X.contains(2));
+
+        ASSERT(1 == mX.erase(2));
+        ASSERT(!X.contains(2));
+
+        const Obj Y(X, &oa);
+        ASSERT(X == Y);
+
+        ASSERT(0 <  oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
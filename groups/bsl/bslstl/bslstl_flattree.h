@@ -0,0 +1,953 @@
+// bslstl_flattree.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATTREE
+#define INCLUDED_BSLSTL_FLATTREE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sorted-vector implementation of an ordered container.
+//
+//@CLASSES:
+//  bslstl::FlatTree: sorted 'bsl::vector' of values ordered by key
+//  bsl::sorted_unique_t: tag type for sorted input having unique keys
+//  bsl::sorted_equivalent_t: tag type for sorted input
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatmultimap, bslstl_flatset
+//
+//@DESCRIPTION: This component provides a class template, 'bslstl::FlatTree',
+// that implements the operations shared by the "flat" ordered containers
+// ('bsl::flat_map', 'bsl::flat_multimap', and 'bsl::flat_set'): a sequence of
+// values, held in a 'bsl::vector' and kept sorted by the keys extracted from
+// them, supporting binary-search lookup and ordered insertion and erasure.
+// The (template parameter) type 'KEY_CONFIG' extracts the key of a value
+// through a static 'extractKey' method (see
+// 'bslstl_unorderedmapkeyconfiguration' and
+// 'bslstl_unorderedsetkeyconfiguration').
+//
+// Because the values are held contiguously, lookup and iteration touch far
+// fewer cache lines than in a node-based tree, and the container allocates a
+// single block of memory rather than one node per value.  Insertion and
+// erasure of a single value take time linear in the number of values that
+// follow it, but relocate those values using 'bsl::vector', which moves
+// bitwise-movable types (see 'bslmf_isbitwisemoveable') with 'memmove'.
+//
+// Inserting a range of values appends them to the vector, sorts the appended
+// values (unless the caller indicates they are already sorted), and merges
+// them with the existing values in a single linear pass, so that building a
+// container of 'N' values from a range takes 'O(N * log(N))' time rather than
+// the 'O(N^2)' time of 'N' individual insertions.
+//
+// This component also defines the tag types 'bsl::sorted_unique_t' and
+// 'bsl::sorted_equivalent_t', and the tag objects 'bsl::sorted_unique' and
+// 'bsl::sorted_equivalent', with which a client of a flat container indicates
+// that a range of values is already sorted by key (and, for
+// 'sorted_unique', has no two values with equivalent keys).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Maintaining a Sorted Sequence of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// 'bslstl::FlatTree' is an implementation detail of the flat containers, but
+// it can be used directly.  Suppose we want a sorted set of integers.
+//
+// First, we define the 'FlatTree' type, using the set key configuration:
+//..
+//  typedef bslstl::FlatTree<int,
+//                           int,
+//                           bslstl::UnorderedSetKeyConfiguration<int>,
+//                           std::less<int>,
+//                           bsl::allocator<int> > IntTree;
+//..
+// Then, we create a tree and insert some values:
+//..
+//  std::less<int> comparator;
+//  IntTree        tree(comparator, bsl::allocator<int>());
+//
+//  assert(true  == tree.insertUnique(5, 5).second);
+//  assert(true  == tree.insertUnique(1, 1).second);
+//  assert(false == tree.insertUnique(5, 5).second);
+//..
+// Next, we insert a range of unsorted values in one pass:
+//..
+//  const int MORE[] = { 9, 3, 1, 7 };
+//  tree.insertRange(MORE, MORE + 4, true, false);
+//..
+// Finally, we observe that the values are sorted and unique:
+//..
+//  const int EXPECTED[] = { 1, 3, 5, 7, 9 };
+//  assert(5 == tree.container().size());
+//  assert(std::equal(tree.container().begin(),
+//                    tree.container().end(),
+//                    EXPECTED));
+//  assert(tree.container().end() != tree.find(7));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslma_stdallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_util.h>
+
+#include <algorithm>
+
+namespace bsl {
+
+                         // ======================
+                         // struct sorted_unique_t
+                         // ======================
+
+struct sorted_unique_t {
+    // This empty 'struct' is a tag type indicating that a range of values is
+    // sorted by key and has no two values having equivalent keys.
+
+    // CREATORS
+    explicit sorted_unique_t();
+        // Create a 'sorted_unique_t' object.
+};
+
+extern const sorted_unique_t sorted_unique;
+    // The tag object indicating that a range is sorted and has unique keys.
+
+                       // ==========================
+                       // struct sorted_equivalent_t
+                       // ==========================
+
+struct sorted_equivalent_t {
+    // This empty 'struct' is a tag type indicating that a range of values is
+    // sorted by key (but may have values having equivalent keys).
+
+    // CREATORS
+    explicit sorted_equivalent_t();
+        // Create a 'sorted_equivalent_t' object.
+};
+
+extern const sorted_equivalent_t sorted_equivalent;
+    // The tag object indicating that a range is sorted.
+
+}  // close namespace bsl
+
+namespace BloombergLP {
+namespace bslstl {
+
+                              // ==============
+                              // class FlatTree
+                              // ==============
+
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+class FlatTree {
+    // This class template implements a sequence of values of the (template
+    // parameter) type 'VALUE_TYPE', held in a 'bsl::vector' and sorted by the
+    // keys of type 'KEY' extracted by 'KEY_CONFIG', using 'COMPARATOR' to
+    // order keys.  The behavior is undefined if the sequence, accessed
+    // directly through 'container', is modified so that it is no longer
+    // sorted.
+
+  public:
+    // TYPES
+    typedef bsl::vector<VALUE_TYPE, ALLOCATOR>          ContainerType;
+    typedef typename ContainerType::iterator            iterator;
+    typedef typename ContainerType::const_iterator      const_iterator;
+    typedef typename ContainerType::size_type           size_type;
+
+  private:
+    // PRIVATE TYPES
+    typedef BloombergLP::bslmf::MovableRefUtil          MoveUtil;
+
+    class ValueComparator {
+        // This class adapts a key comparator to compare values by key.
+
+        // DATA
+        const COMPARATOR *d_comparator_p;  // compares keys (held, not owned)
+
+      public:
+        // CREATORS
+        explicit ValueComparator(const COMPARATOR& comparator)
+            // Create a value comparator that uses the specified
+            // 'comparator', which must outlive this object, to compare keys.
+        : d_comparator_p(&comparator)
+        {
+        }
+
+        // ACCESSORS
+        bool operator()(const VALUE_TYPE& lhs, const VALUE_TYPE& rhs) const
+            // Return 'true' if the key of the specified 'lhs' is ordered
+            // before the key of the specified 'rhs', and 'false' otherwise.
+        {
+            return (*d_comparator_p)(KEY_CONFIG::extractKey(lhs),
+                                     KEY_CONFIG::extractKey(rhs));
+        }
+    };
+
+    // DATA
+    ContainerType d_container;   // sorted values
+    COMPARATOR    d_comparator;  // orders keys
+
+    // PRIVATE CLASS METHODS
+    static const KEY& keyOf(const VALUE_TYPE& value);
+        // Return a reference to the key of the specified 'value'.
+
+    // PRIVATE MANIPULATORS
+    void mergeTail(size_type numSorted, bool unique, bool tailIsSorted);
+        // Restore the ordering of the values of this tree after values have
+        // been appended to the specified first 'numSorted' sorted values,
+        // sorting the appended values first unless the specified
+        // 'tailIsSorted' is 'true', and removing each value whose key is
+        // equivalent to that of a preceding value if the specified 'unique'
+        // is 'true'.  Equivalent values retain their relative order, and the
+        // first of a run of equivalent values is the one retained.  If an
+        // exception is thrown, this tree is left empty.  The behavior is
+        // undefined unless the first 'numSorted' values are sorted (and, if
+        // 'unique', have unique keys).
+
+    void removeDuplicates(iterator first);
+        // Remove from this tree each value, at or after the specified 'first'
+        // position, whose key is equivalent to that of the value preceding
+        // it.  The behavior is undefined unless the values from 'first' to
+        // the end are sorted.
+
+    // PRIVATE ACCESSORS
+    bool isSorted(const_iterator first,
+                  const_iterator last,
+                  bool           unique) const;
+        // Return 'true' if the values in the specified range '[first, last)'
+        // are sorted (with no two equivalent keys if the specified 'unique' is
+        // 'true'), and 'false' otherwise.
+
+  public:
+    // CREATORS
+    FlatTree(const COMPARATOR& comparator, const ALLOCATOR& basicAllocator);
+        // Create an empty tree that uses a copy of the specified 'comparator'
+        // to order keys and a copy of the specified 'basicAllocator' to
+        // supply memory.
+
+    FlatTree(const FlatTree& original, const ALLOCATOR& basicAllocator);
+        // Create a tree having the same values and comparator as the specified
+        // 'original' tree, using a copy of the specified 'basicAllocator' to
+        // supply memory.
+
+    FlatTree(bslmf::MovableRef<FlatTree> original);                 // IMPLICIT
+        // Create a tree having the same values, comparator, and allocator as
+        // the specified 'original' tree, leaving 'original' empty.
+
+    FlatTree(bslmf::MovableRef<FlatTree> original,
+             const ALLOCATOR&            basicAllocator);
+        // Create a tree having the same values and comparator as the specified
+        // 'original' tree, using a copy of the specified 'basicAllocator' to
+        // supply memory.  If 'basicAllocator' equals the allocator of
+        // 'original', the values are moved without allocation and 'original'
+        // is left empty; otherwise, each value is move-inserted and
+        // 'original' is left in a valid but unspecified state.
+
+    //! ~FlatTree() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatTree& operator=(const FlatTree& rhs);
+        // Assign to this tree the values and comparator of the specified
+        // 'rhs' tree, and return a reference providing modifiable access to
+        // this tree.
+
+    FlatTree& operator=(bslmf::MovableRef<FlatTree> rhs);
+        // Assign to this tree the values and comparator of the specified
+        // 'rhs' tree, and return a reference providing modifiable access to
+        // this tree.  The values of 'rhs' are moved as for the move
+        // assignment of 'bsl::vector'.
+
+    ContainerType& container();
+        // Return a reference providing modifiable access to the sorted
+        // sequence of values of this tree.  The behavior is undefined if the
+        // sequence is modified so that it is no longer sorted.
+
+    template <class VALUE_ARG>
+    bsl::pair<iterator, bool>
+    insertUnique(const KEY&                                    key,
+                 BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_ARG)  value)
+        // Insert into this tree a value constructed from the specified
+        // 'value', whose key is the specified 'key', if no value has an
+        // equivalent key.  Return a pair whose 'first' member refers to the
+        // value having that key, and whose 'second' member is 'true' if the
+        // value was inserted, and 'false' otherwise.  The behavior is
+        // undefined unless 'key' remains valid until 'value' is consumed.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        iterator position = lowerBound(key);
+        if (position != d_container.end()
+         && !d_comparator(key, keyOf(*position))) {
+            return bsl::pair<iterator, bool>(position, false);        // RETURN
+        }
+        return bsl::pair<iterator, bool>(
+                 d_container.emplace(
+                         position,
+                         BSLS_COMPILERFEATURES_FORWARD(VALUE_ARG, value)),
+                 true);
+    }
+
+    template <class VALUE_ARG>
+    bsl::pair<iterator, bool>
+    insertUnique(const_iterator                                hint,
+                 const KEY&                                    key,
+                 BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_ARG)  value)
+        // Insert into this tree a value constructed from the specified
+        // 'value', whose key is the specified 'key', if no value has an
+        // equivalent key, using the specified 'hint' (which refers to the
+        // value that would follow the inserted value) to avoid a search if
+        // it is correct.  Return a pair whose 'first' member refers to the
+        // value having that key, and whose 'second' member is 'true' if the
+        // value was inserted, and 'false' otherwise.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator begin = d_container.begin();
+        const_iterator end   = d_container.end();
+
+        if ((hint == begin || d_comparator(keyOf(*(hint - 1)), key))
+         && (hint == end   || d_comparator(key, keyOf(*hint)))) {
+            return bsl::pair<iterator, bool>(                         // RETURN
+                 d_container.emplace(
+                         hint,
+                         BSLS_COMPILERFEATURES_FORWARD(VALUE_ARG, value)),
+                 true);
+        }
+        return insertUnique(key,
+                            BSLS_COMPILERFEATURES_FORWARD(VALUE_ARG, value));
+    }
+
+    template <class VALUE_ARG>
+    iterator insertMulti(const KEY&                                    key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_ARG)  value)
+        // Insert into this tree a value constructed from the specified
+        // 'value', whose key is the specified 'key', after any values having
+        // an equivalent key, and return an iterator referring to the inserted
+        // value.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_container.emplace(
+                             upperBound(key),
+                             BSLS_COMPILERFEATURES_FORWARD(VALUE_ARG, value));
+    }
+
+    template <class VALUE_ARG>
+    iterator insertMulti(const_iterator                                hint,
+                         const KEY&                                    key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_ARG)  value)
+        // Insert into this tree a value constructed from the specified
+        // 'value', whose key is the specified 'key', as close as possible to
+        // the position just prior to the specified 'hint', and return an
+        // iterator referring to the inserted value.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator begin = d_container.begin();
+        const_iterator end   = d_container.end();
+
+        if ((hint == begin || !d_comparator(key, keyOf(*(hint - 1))))
+         && (hint == end   || !d_comparator(keyOf(*hint), key))) {
+            return d_container.emplace(                               // RETURN
+                             hint,
+                             BSLS_COMPILERFEATURES_FORWARD(VALUE_ARG, value));
+        }
+        return insertMulti(key,
+                           BSLS_COMPILERFEATURES_FORWARD(VALUE_ARG, value));
+    }
+
+    template <class INPUT_ITERATOR>
+    void insertRange(INPUT_ITERATOR first,
+                     INPUT_ITERATOR last,
+                     bool           unique,
+                     bool           sorted)
+        // Insert into this tree the values in the specified range
+        // '[first, last)'.  If the specified 'unique' is 'true', insert only
+        // the first value of the range having each key, and only if this tree
+        // has no value having an equivalent key.  If 'unique' is 'false',
+        // insert each value after any existing values having an equivalent
+        // key, preserving the relative order of the values of the range.  If
+        // the specified 'sorted' is 'true', the range is assumed to be
+        // sorted (and, if 'unique', to have no equivalent keys), and is not
+        // sorted again.  If an exception is thrown, this tree is left either
+        // unchanged or empty.  The behavior is undefined if 'sorted' is 'true'
+        // and the range is not so sorted.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const size_type numSorted = d_container.size();
+        BSLS_TRY {
+            d_container.insert(d_container.end(), first, last);
+        }
+        BSLS_CATCH(...) {
+            // Remove any values appended from an input iterator range before
+            // the exception, restoring the sorted sequence.
+
+            d_container.erase(d_container.begin() + numSorted,
+                              d_container.end());
+            BSLS_RETHROW;
+        }
+
+        BSLS_ASSERT_SAFE(!sorted
+                      || isSorted(d_container.begin() + numSorted,
+                                  d_container.end(),
+                                  unique));
+
+        mergeTail(numSorted, unique, sorted);
+    }
+
+    void replace(bslmf::MovableRef<ContainerType> values,
+                 bool                             unique,
+                 bool                             sorted);
+        // Replace the values of this tree with the specified 'values', sorted
+        // unless the specified 'sorted' is 'true', and with the second and
+        // subsequent of each run of values having equivalent keys removed if
+        // the specified 'unique' is 'true'.  'values' is moved as for the
+        // move assignment of 'bsl::vector'.  If an exception is thrown, this
+        // tree is left empty.  The behavior is undefined if 'sorted' is
+        // 'true' and 'values' is not so sorted.
+
+    iterator erase(const_iterator position);
+        // Remove from this tree the value at the specified 'position', and
+        // return an iterator referring to the value following it.  The
+        // behavior is undefined unless 'position' refers to a value of this
+        // tree.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this tree the values in the specified range
+        // '[first, last)', and return an iterator referring to the value
+        // following the removed values.  The behavior is undefined unless
+        // '[first, last)' is a valid range of values of this tree.
+
+    template <class LOOKUP_KEY>
+    iterator lowerBound(const LOOKUP_KEY& key)
+        // Return an iterator referring to the first value of this tree whose
+        // key is not ordered before the specified 'key', or the past-the-end
+        // iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_container.begin() +
+               (static_cast<const FlatTree&>(*this).lowerBound(key) -
+                                                       d_container.cbegin());
+    }
+
+    template <class LOOKUP_KEY>
+    iterator upperBound(const LOOKUP_KEY& key)
+        // Return an iterator referring to the first value of this tree whose
+        // key is ordered after the specified 'key', or the past-the-end
+        // iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_container.begin() +
+               (static_cast<const FlatTree&>(*this).upperBound(key) -
+                                                       d_container.cbegin());
+    }
+
+    template <class LOOKUP_KEY>
+    iterator find(const LOOKUP_KEY& key)
+        // Return an iterator referring to the first value of this tree whose
+        // key is equivalent to the specified 'key', or the past-the-end
+        // iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        return d_container.begin() +
+               (static_cast<const FlatTree&>(*this).find(key) -
+                                                       d_container.cbegin());
+    }
+
+    void swap(FlatTree& other);
+        // Exchange the values and comparator of this tree with those of the
+        // specified 'other' tree, as for the 'swap' method of 'bsl::vector'.
+
+    // ACCESSORS
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the
+        // comparator of this tree.
+
+    const ContainerType& container() const;
+        // Return a reference providing non-modifiable access to the sorted
+        // sequence of values of this tree.
+
+    template <class LOOKUP_KEY>
+    size_type count(const LOOKUP_KEY& key) const
+        // Return the number of values of this tree whose key is equivalent to
+        // the specified 'key'.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator first = lowerBound(key);
+        if (first == d_container.end() || d_comparator(key, keyOf(*first))) {
+            return 0;                                                 // RETURN
+        }
+        return upperBound(key) - first;
+    }
+
+    template <class LOOKUP_KEY>
+    const_iterator find(const LOOKUP_KEY& key) const
+        // Return an iterator referring to the first value of this tree whose
+        // key is equivalent to the specified 'key', or the past-the-end
+        // iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        const_iterator position = lowerBound(key);
+        if (position != d_container.end()
+         && d_comparator(key, keyOf(*position))) {
+            return d_container.end();                                 // RETURN
+        }
+        return position;
+    }
+
+    template <class LOOKUP_KEY>
+    const_iterator lowerBound(const LOOKUP_KEY& key) const
+        // Return an iterator referring to the first value of this tree whose
+        // key is not ordered before the specified 'key', or the past-the-end
+        // iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        // The search narrows '[first, first + count]', which always contains
+        // the result, by a branch-free step that compilers typically emit as
+        // a conditional move, avoiding a mispredicted branch per probe.
+
+        const_iterator first = d_container.begin();
+        size_type      count = d_container.size();
+        if (0 == count) {
+            return first;                                             // RETURN
+        }
+        while (1 < count) {
+            const size_type half = count / 2;
+            first += d_comparator(keyOf(first[half]), key) ? half : 0;
+            count -= half;
+        }
+        return first + (d_comparator(keyOf(*first), key) ? 1 : 0);
+    }
+
+    template <class LOOKUP_KEY>
+    const_iterator upperBound(const LOOKUP_KEY& key) const
+        // Return an iterator referring to the first value of this tree whose
+        // key is ordered after the specified 'key', or the past-the-end
+        // iterator if there is none.
+        //
+        // Note: implemented inline due to Sun CC compilation error.
+    {
+        // See 'lowerBound'.
+
+        const_iterator first = d_container.begin();
+        size_type      count = d_container.size();
+        if (0 == count) {
+            return first;                                             // RETURN
+        }
+        while (1 < count) {
+            const size_type half = count / 2;
+            first += d_comparator(key, keyOf(first[half])) ? 0 : half;
+            count -= half;
+        }
+        return first + (d_comparator(key, keyOf(*first)) ? 0 : 1);
+    }
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                              // --------------
+                              // class FlatTree
+                              // --------------
+
+// PRIVATE CLASS METHODS
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+const KEY&
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::keyOf(
+                                                      const VALUE_TYPE& value)
+{
+    return KEY_CONFIG::extractKey(value);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+void FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::mergeTail(
+                                                   size_type numSorted,
+                                                   bool      unique,
+                                                   bool      tailIsSorted)
+{
+    BSLS_ASSERT_SAFE(numSorted <= d_container.size());
+
+    if (numSorted == d_container.size()) {
+        return;                                                       // RETURN
+    }
+
+    BSLS_TRY {
+        const iterator middle = d_container.begin() + numSorted;
+
+        if (!tailIsSorted) {
+            // A stable sort keeps the first of the values having equivalent
+            // keys (for 'unique') and the order of insertion (otherwise).
+
+            std::stable_sort(middle,
+                             d_container.end(),
+                             ValueComparator(d_comparator));
+        }
+
+        if (0 == numSorted
+         || !d_comparator(keyOf(*middle), keyOf(*(middle - 1)))) {
+            // The appended values follow the existing values, so no merge is
+            // needed (a leading duplicate is removed below).
+
+            if (unique) {
+                removeDuplicates(middle);
+            }
+            return;                                                   // RETURN
+        }
+
+        // Merge into a new vector supplied by the same allocator, taking the
+        // existing value first when keys are equivalent.
+
+        ContainerType merged(d_container.get_allocator());
+        merged.reserve(d_container.size());
+
+        iterator a    = d_container.begin();
+        iterator b    = middle;
+        iterator aEnd = middle;
+        iterator bEnd = d_container.end();
+
+        while (a != aEnd || b != bEnd) {
+            iterator& next = (b == bEnd
+                           || (a != aEnd
+                            && !d_comparator(keyOf(*b), keyOf(*a))))
+                           ? a
+                           : b;
+
+            if (!unique
+             || merged.empty()
+             || d_comparator(keyOf(merged.back()), keyOf(*next))) {
+                merged.push_back(MoveUtil::move(*next));
+            }
+            ++next;
+        }
+
+        d_container.swap(merged);
+    }
+    BSLS_CATCH(...) {
+        d_container.clear();
+        BSLS_RETHROW;
+    }
+}
+
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+void
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::removeDuplicates(
+                                                                iterator first)
+{
+    const iterator end = d_container.end();
+
+    if (first == end) {
+        return;                                                       // RETURN
+    }
+
+    // If 'first' is not the beginning, compare it with its predecessor too.
+
+    iterator last = first;
+    if (first != d_container.begin()) {
+        --last;
+    }
+    else {
+        ++first;
+    }
+
+    for (; first != end; ++first) {
+        if (d_comparator(keyOf(*last), keyOf(*first))) {
+            ++last;
+            if (last != first) {
+                *last = MoveUtil::move(*first);
+            }
+        }
+    }
+    d_container.erase(last + 1, end);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+bool FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::isSorted(
+                                                   const_iterator first,
+                                                   const_iterator last,
+                                                   bool           unique) const
+{
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+    for (const_iterator next = first + 1; next != last; ++first, ++next) {
+        if (d_comparator(keyOf(*next), keyOf(*first))
+         || (unique && !d_comparator(keyOf(*first), keyOf(*next)))) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+// CREATORS
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                             const COMPARATOR& comparator,
+                                             const ALLOCATOR&  basicAllocator)
+: d_container(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                             const FlatTree&   original,
+                                             const ALLOCATOR&  basicAllocator)
+: d_container(original.d_container, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                         bslmf::MovableRef<FlatTree> original)
+: d_container(MoveUtil::move(MoveUtil::access(original).d_container))
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::FlatTree(
+                                  bslmf::MovableRef<FlatTree> original,
+                                  const ALLOCATOR&            basicAllocator)
+: d_container(MoveUtil::move(MoveUtil::access(original).d_container),
+              basicAllocator)
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(
+                                                           const FlatTree& rhs)
+{
+    d_container  = rhs.d_container;
+    d_comparator = rhs.d_comparator;
+    return *this;
+}
+
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>&
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::operator=(
+                                              bslmf::MovableRef<FlatTree> rhs)
+{
+    FlatTree& lvalue = rhs;
+
+    d_container  = MoveUtil::move(lvalue.d_container);
+    d_comparator = lvalue.d_comparator;
+    return *this;
+}
+
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::
+                                                                 ContainerType&
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::container()
+{
+    return d_container;
+}
+
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+void FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::replace(
+                              bslmf::MovableRef<ContainerType> values,
+                              bool                             unique,
+                              bool                             sorted)
+{
+    d_container = MoveUtil::move(values);
+
+    BSLS_ASSERT_SAFE(!sorted
+                  || isSorted(d_container.begin(), d_container.end(), unique));
+
+    mergeTail(0, unique, sorted);
+}
+
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    return d_container.erase(position);
+}
+
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
+{
+    return d_container.erase(first, last);
+}
+
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+void FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::swap(
+                                                               FlatTree& other)
+{
+    d_container.swap(other.d_container);
+    BloombergLP::bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+// ACCESSORS
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+const COMPARATOR&
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::comparator()
+                                                                          const
+{
+    return d_comparator;
+}
+
+template <class KEY,
+          class VALUE_TYPE,
+          class KEY_CONFIG,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+const typename FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::
+                                                                 ContainerType&
+FlatTree<KEY, VALUE_TYPE, KEY_CONFIG, COMPARATOR, ALLOCATOR>::container() const
+{
+    return d_container;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                         // ----------------------
+                         // struct sorted_unique_t
+                         // ----------------------
+
+// CREATORS
+inline
+sorted_unique_t::sorted_unique_t()
+{
+}
+
+                       // --------------------------
+                       // struct sorted_equivalent_t
+                       // --------------------------
+
+// CREATORS
+inline
+sorted_equivalent_t::sorted_equivalent_t()
+{
+}
+
+}  // close namespace bsl
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
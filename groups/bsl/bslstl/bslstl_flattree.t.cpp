@@ -0,0 +1,840 @@
+// bslstl_flattree.t.cpp                                              -*-C++-*-
+#include <bslstl_flattree.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a mechanism, 'bslstl::FlatTree', holding a
+// 'bsl::vector' of values sorted by key.  We test it with values of type
+// 'bsl::pair<int, int>' keyed by 'first', using 'second' as a sequence number
+// so that the relative order of values having equivalent keys (for the multi
+// operations) and the identity of the value retained (for the unique
+// operations) can be observed.  Results are compared against an oracle
+// computed with 'std::stable_sort' on a copy of the input.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 6] FlatTree(const COMPARATOR&, const ALLOCATOR&);
+// [ 6] FlatTree(const FlatTree&, const ALLOCATOR&);
+// [ 6] FlatTree(MovableRef<FlatTree>);
+// [ 6] FlatTree(MovableRef<FlatTree>, const ALLOCATOR&);
+//
+// MANIPULATORS
+// [ 6] FlatTree& operator=(const FlatTree&);
+// [ 6] FlatTree& operator=(MovableRef<FlatTree>);
+// [ 2] pair<iterator, bool> insertUnique(const KEY&, VALUE_ARG&&);
+// [ 2] pair<iterator, bool> insertUnique(const_iterator, const KEY&, V&&);
+// [ 2] iterator insertMulti(const KEY&, VALUE_ARG&&);
+// [ 2] iterator insertMulti(const_iterator, const KEY&, VALUE_ARG&&);
+// [ 3] void insertRange(INPUT_ITERATOR, INPUT_ITERATOR, bool, bool);
+// [ 6] void replace(MovableRef<ContainerType>, bool, bool);
+// [ 2] iterator erase(const_iterator);
+// [ 2] iterator erase(const_iterator, const_iterator);
+// [ 6] void swap(FlatTree&);
+//
+// ACCESSORS
+// [ 4] const_iterator lowerBound(const LOOKUP_KEY&) const;
+// [ 4] const_iterator upperBound(const LOOKUP_KEY&) const;
+// [ 4] const_iterator find(const LOOKUP_KEY&) const;
+// [ 4] size_type count(const LOOKUP_KEY&) const;
+// [ 1] const ContainerType& container() const;
+// [ 1] const COMPARATOR& comparator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] EXCEPTION SAFETY AND ALLOCATOR PROPAGATION
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//                GLOBAL TYPEDEFS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+
+typedef bsl::pair<int, int>                                      Value;
+typedef bslstl::UnorderedMapKeyConfiguration<int, Value>         KeyConfig;
+typedef bsl::allocator<Value>                                    Alloc;
+typedef bslstl::FlatTree<int, Value, KeyConfig, std::less<int>, Alloc>
+                                                                 Obj;
+typedef Obj::ContainerType                                       Container;
+
+static const std::less<int> COMP = std::less<int>();
+
+typedef bslstl::FlatTree<int,
+                         int,
+                         bslstl::UnorderedSetKeyConfiguration<int>,
+                         std::less<int>,
+                         bsl::allocator<int> >                   IntTree;
+
+struct KeyLess {
+    // This 'struct' orders 'Value' objects by key only.
+
+    bool operator()(const Value& lhs, const Value& rhs) const
+        // Return 'true' if the key of the specified 'lhs' is less than that of
+        // the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+struct KeyEqual {
+    // This 'struct' compares 'Value' objects by key only.
+
+    bool operator()(const Value& lhs, const Value& rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same key,
+        // and 'false' otherwise.
+    {
+        return lhs.first == rhs.first;
+    }
+};
+
+static
+Container oracle(const Container& existing,
+                 const Container& appended,
+                 bool             unique)
+    // Return the expected contents of a tree holding the specified 'existing'
+    // sorted values after the specified 'appended' values are inserted into
+    // it, retaining only the first value of each key if the specified 'unique'
+    // is 'true'.
+{
+    Container tail(appended);
+    std::stable_sort(tail.begin(), tail.end(), KeyLess());
+
+    Container result(existing);
+    result.insert(result.end(), tail.begin(), tail.end());
+    std::stable_sort(result.begin(), result.end(), KeyLess());
+
+    if (unique) {
+        result.erase(std::unique(result.begin(), result.end(), KeyEqual()),
+                     result.end());
+    }
+    return result;
+}
+
+static
+bool isSortedByKey(const Container& values, bool unique)
+    // Return 'true' if the specified 'values' are sorted by key (with no two
+    // equal keys if the specified 'unique' is 'true'), and 'false' otherwise.
+{
+    for (Container::size_type i = 1; i < values.size(); ++i) {
+        if (values[i].first < values[i - 1].first
+         || (unique && values[i].first == values[i - 1].first)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+static
+Container randomValues(int numValues, int keyRange, int firstSequence)
+    // Return a vector of the specified 'numValues' values having keys drawn
+    // pseudo-randomly from '[0, keyRange)' and sequence numbers starting at
+    // the specified 'firstSequence'.
+{
+    Container result;
+    for (int i = 0; i < numValues; ++i) {
+        result.push_back(Value(rand() % keyRange, firstSequence + i));
+    }
+    return result;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test        = argc > 1 ? atoi(argv[1]) : 0;
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Maintaining a Sorted Sequence of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// 'bslstl::FlatTree' is an implementation detail of the flat containers, but
+// it can be used directly.  Suppose we want a sorted set of integers.
+//
+// First, we define the 'FlatTree' type, using the set key configuration (see
+// 'IntTree' above).
+//
+// Then, we create a tree and insert some values:
+//..
+        std::less<int> comparator;
+        IntTree        tree(comparator, bsl::allocator<int>());
+
+        ASSERT(true  == tree.insertUnique(5, 5).second);
+        ASSERT(true  == tree.insertUnique(1, 1).second);
+        ASSERT(false == tree.insertUnique(5, 5).second);
+//..
+// Next, we insert a range of unsorted values in one pass:
+//..
+        const int MORE[] = { 9, 3, 1, 7 };
+        tree.insertRange(MORE, MORE + 4, true, false);
+//..
+// Finally, we observe that the values are sorted and unique:
+//..
+        const int EXPECTED[] = { 1, 3, 5, 7, 9 };
+        ASSERT(5 == tree.container().size());
+        ASSERT(std::equal(tree.container().begin(),
+                          tree.container().end(),
+                          EXPECTED));
+        ASSERT(tree.container().end() != tree.find(7));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND REPLACE
+        //
+        // Concerns:
+        //: 1 Copies have the same value and use the supplied allocator.
+        //:
+        //: 2 Moving with the same allocator transfers the buffer without
+        //:   allocating; moving with a different allocator copies the values
+        //:   into memory from the new allocator.
+        //:
+        //: 3 'swap' exchanges the values.
+        //:
+        //: 4 'replace' sorts (and, if unique, deduplicates) the replacement
+        //:   values unless told they are sorted.
+        //
+        // Plan:
+        //: 1 Build trees with test allocators and exercise each operation,
+        //:   checking values and allocator usage.  (C-1..4)
+        //
+        // Testing:
+        //   FlatTree(const COMPARATOR&, const ALLOCATOR&);
+        //   FlatTree(const FlatTree&, const ALLOCATOR&);
+        //   FlatTree(MovableRef<FlatTree>);
+        //   FlatTree(MovableRef<FlatTree>, const ALLOCATOR&);
+        //   FlatTree& operator=(const FlatTree&);
+        //   FlatTree& operator=(MovableRef<FlatTree>);
+        //   void replace(MovableRef<ContainerType>, bool, bool);
+        //   void swap(FlatTree&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, SWAP, AND REPLACE"
+                            "\n=============================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        const Container VALUES = randomValues(50, 20, 0);
+
+        Obj mX(COMP, &oa);  const Obj& X = mX;
+        mX.insertRange(VALUES.begin(), VALUES.end(), true, false);
+        const Container EXP = oracle(Container(), VALUES, true);
+        ASSERT(EXP == X.container());
+
+        if (veryVerbose) printf("\tCopy construction.\n");
+        {
+            Obj mY(X, &sa);  const Obj& Y = mY;
+            ASSERT(EXP == Y.container());
+            ASSERT(&sa == Y.container().get_allocator().mechanism());
+        }
+
+        if (veryVerbose) printf("\tMove construction.\n");
+        {
+            Obj mY(X, &oa);
+
+            const bsls::Types::Int64 numAllocations = oa.numAllocations();
+            Obj mZ(MoveUtil::move(mY));  const Obj& Z = mZ;
+            ASSERT(numAllocations == oa.numAllocations());
+            ASSERT(EXP == Z.container());
+            ASSERT(mY.container().empty());
+
+            Obj mW(MoveUtil::move(mZ), &sa);  const Obj& W = mW;
+            ASSERT(EXP == W.container());
+            ASSERT(&sa == W.container().get_allocator().mechanism());
+        }
+
+        if (veryVerbose) printf("\tAssignment.\n");
+        {
+            Obj mY(COMP, &sa);  const Obj& Y = mY;
+            mY = X;
+            ASSERT(EXP == Y.container());
+            ASSERT(&sa == Y.container().get_allocator().mechanism());
+
+            Obj mZ(COMP, &sa);  const Obj& Z = mZ;
+            mZ = MoveUtil::move(mY);
+            ASSERT(EXP == Z.container());
+        }
+
+        if (veryVerbose) printf("\tSwap.\n");
+        {
+            Obj mY(COMP, &oa);  const Obj& Y = mY;
+            mY.insertUnique(100, Value(100, 0));
+
+            Obj mZ(X, &oa);  const Obj& Z = mZ;
+            mY.swap(mZ);
+            ASSERT(EXP == Y.container());
+            ASSERT(1   == Z.container().size());
+        }
+
+        if (veryVerbose) printf("\tReplace.\n");
+        {
+            Obj mY(COMP, &oa);  const Obj& Y = mY;
+
+            Container unsorted(VALUES, &oa);
+            mY.replace(MoveUtil::move(unsorted), true, false);
+            ASSERT(EXP == Y.container());
+
+            Container multi(VALUES, &oa);
+            mY.replace(MoveUtil::move(multi), false, false);
+            ASSERT(oracle(Container(), VALUES, false) == Y.container());
+
+            Container sorted(EXP, &oa);
+            mY.replace(MoveUtil::move(sorted), true, true);
+            ASSERT(EXP == Y.container());
+        }
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY AND ALLOCATOR PROPAGATION
+        //
+        // Concerns:
+        //: 1 All memory, including the temporary buffer used to merge a range,
+        //:   is supplied by the tree's allocator.
+        //:
+        //: 2 If an allocation fails during 'insertRange', the tree is left
+        //:   either unchanged or empty, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Insert ranges that force the merge path with the default
+        //:   allocator guarded, and verify that it is not used.  (C-1)
+        //:
+        //: 2 Repeat the insertions under the 'bslma' exception test macros,
+        //:   verifying the state of the tree on each exception.  (C-2)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY AND ALLOCATOR PROPAGATION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY AND ALLOCATOR PROPAGATION"
+                            "\n==========================================\n");
+
+        for (int unique = 0; unique < 2; ++unique) {
+            const Container EXISTING = oracle(Container(),
+                                              randomValues(40, 30, 0),
+                                              unique);
+            const Container APPENDED = randomValues(40, 30, 1000);
+            const Container EXP      = oracle(EXISTING, APPENDED, unique);
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj mX(COMP, &oa);  const Obj& X = mX;
+                Container existing(EXISTING, &oa);
+                mX.replace(bslmf::MovableRefUtil::move(existing),
+                           unique,
+                           true);
+
+                const bsls::Types::Int64 numDefault = da.numBlocksTotal();
+
+                BSLS_TRY {
+                    mX.insertRange(APPENDED.begin(),
+                                   APPENDED.end(),
+                                   unique,
+                                   false);
+                }
+                BSLS_CATCH(...) {
+                    ASSERTV(unique,
+                            X.container().empty()
+                         || EXISTING == X.container());
+                    BSLS_RETHROW;
+                }
+                ASSERTV(unique, EXP == X.container());
+                ASSERTV(unique, numDefault == da.numBlocksTotal());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(unique, 0 == oa.numBlocksInUse());
+        }
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        //
+        // Concerns:
+        //: 1 'lowerBound', 'upperBound', 'find', and 'count' agree with the
+        //:   standard algorithms for every key in and around the range of
+        //:   keys held, for empty, unique, and multi trees.
+        //
+        // Plan:
+        //: 1 Build trees of several sizes and compare each lookup with
+        //:   'std::lower_bound' and 'std::upper_bound'.  (C-1)
+        //
+        // Testing:
+        //   const_iterator lowerBound(const LOOKUP_KEY&) const;
+        //   const_iterator upperBound(const LOOKUP_KEY&) const;
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        //   size_type count(const LOOKUP_KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        const int SIZES[] = { 0, 1, 2, 3, 7, 8, 9, 31, 64, 100 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            for (int unique = 0; unique < 2; ++unique) {
+                const int SIZE = SIZES[ti];
+
+                Obj mX(COMP, Alloc());  const Obj& X = mX;
+                const Container VALUES = randomValues(SIZE, SIZE + 1, 0);
+                mX.insertRange(VALUES.begin(), VALUES.end(), unique, false);
+
+                const Container& C        = X.container();
+                const KeyLess    KEY_LESS = KeyLess();
+
+                for (int key = -1; key <= SIZE + 1; ++key) {
+                    const Value PROBE(key, 0);
+
+                    Obj::const_iterator EXP_LB =
+                        std::lower_bound(C.begin(), C.end(), PROBE, KEY_LESS);
+                    Obj::const_iterator EXP_UB =
+                        std::upper_bound(C.begin(), C.end(), PROBE, KEY_LESS);
+
+                    ASSERTV(SIZE, key, EXP_LB == X.lowerBound(key));
+                    ASSERTV(SIZE, key, EXP_UB == X.upperBound(key));
+                    ASSERTV(SIZE, key,
+                            static_cast<Obj::size_type>(EXP_UB - EXP_LB) ==
+                                                                X.count(key));
+                    ASSERTV(SIZE, key,
+                            (EXP_LB == EXP_UB ? C.end() : EXP_LB) ==
+                                                                 X.find(key));
+                    ASSERTV(SIZE, key,
+                            X.find(key) == static_cast<Obj::const_iterator>(
+                                                               mX.find(key)));
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'insertRange'
+        //
+        // Concerns:
+        //: 1 The resulting sequence is sorted, and matches the oracle: for
+        //:   unique trees, the first value of each key (existing before
+        //:   appended) is retained; for multi trees, values of equivalent
+        //:   keys keep their insertion order.
+        //:
+        //: 2 Both the append-only fast path (all new keys follow the existing
+        //:   keys) and the merge path produce the correct result.
+        //:
+        //: 3 Passing 'sorted' skips the sort but yields the same result for a
+        //:   sorted range.
+        //:
+        //: 4 In SAFE mode, passing 'sorted' with an unsorted range asserts.
+        //
+        // Plan:
+        //: 1 For a range of sizes and key ranges, insert pseudo-random ranges
+        //:   into pseudo-random trees and compare with the oracle.  (C-1)
+        //:
+        //: 2 Insert ranges whose keys all exceed the existing keys.  (C-2)
+        //:
+        //: 3 Insert pre-sorted ranges with 'sorted' set.  (C-3)
+        //:
+        //: 4 Verify defensive checks using 'bsls_asserttest'.  (C-4)
+        //
+        // Testing:
+        //   void insertRange(INPUT_ITERATOR, INPUT_ITERATOR, bool, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insertRange'"
+                            "\n=============\n");
+
+        const int SIZES[] = { 0, 1, 2, 5, 16, 100 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        if (veryVerbose) printf("\tPseudo-random ranges.\n");
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            for (int j = 0; j < NUM_SIZES; ++j) {
+                for (int unique = 0; unique < 2; ++unique) {
+                    const int N = SIZES[i];
+                    const int M = SIZES[j];
+                    const int K = (N + M) / 2 + 1;
+
+                    const Container EXISTING =
+                           oracle(Container(), randomValues(N, K, 0), unique);
+                    const Container APPENDED = randomValues(M, K, 1000);
+
+                    Obj mX(COMP, Alloc());  const Obj& X = mX;
+                    Container existing(EXISTING);
+                    mX.replace(bslmf::MovableRefUtil::move(existing),
+                               unique,
+                               true);
+                    mX.insertRange(APPENDED.begin(),
+                                   APPENDED.end(),
+                                   unique,
+                                   false);
+
+                    ASSERTV(N, M, unique,
+                            oracle(EXISTING, APPENDED, unique) ==
+                                                               X.container());
+                    ASSERTV(N, M, unique,
+                            isSortedByKey(X.container(), unique));
+                }
+            }
+        }
+
+        if (veryVerbose) printf("\tAppend-only fast path.\n");
+
+        for (int unique = 0; unique < 2; ++unique) {
+            Container existing, appended;
+            for (int k = 0; k < 10; ++k) {
+                existing.push_back(Value(k, k));
+                appended.push_back(Value(19 - k, 100 + k));
+            }
+            appended.push_back(Value(9, 200));  // equal to the last key
+
+            Obj mX(COMP, Alloc());  const Obj& X = mX;
+            Container copy(existing);
+            mX.replace(bslmf::MovableRefUtil::move(copy), unique, true);
+            mX.insertRange(appended.begin(), appended.end(), unique, false);
+
+            ASSERTV(unique,
+                    oracle(existing, appended, unique) == X.container());
+        }
+
+        if (veryVerbose) printf("\tPre-sorted ranges.\n");
+
+        for (int unique = 0; unique < 2; ++unique) {
+            const Container EXISTING =
+                          oracle(Container(), randomValues(30, 40, 0), unique);
+            const Container SORTED =
+                       oracle(Container(), randomValues(30, 40, 1000), unique);
+
+            Obj mX(COMP, Alloc());  const Obj& X = mX;
+            Container existing(EXISTING);
+            mX.replace(bslmf::MovableRefUtil::move(existing), unique, true);
+            mX.insertRange(SORTED.begin(), SORTED.end(), unique, true);
+
+            ASSERTV(unique,
+                    oracle(EXISTING, SORTED, unique) == X.container());
+        }
+
+        if (veryVerbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Value UNSORTED[] = { Value(2, 0), Value(1, 1) };
+            const Value DUPLICATE[] = { Value(1, 0), Value(1, 1) };
+
+            Obj mX(COMP, Alloc());
+
+            ASSERT_SAFE_FAIL(mX.insertRange(UNSORTED, UNSORTED + 2,
+                                            false, true));
+            mX.container().clear();
+            ASSERT_SAFE_FAIL(mX.insertRange(DUPLICATE, DUPLICATE + 2,
+                                            true, true));
+            mX.container().clear();
+            ASSERT_SAFE_PASS(mX.insertRange(DUPLICATE, DUPLICATE + 2,
+                                            false, true));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SINGLE-VALUE INSERTION AND ERASURE
+        //
+        // Concerns:
+        //: 1 'insertUnique' inserts a value only if its key is absent, and
+        //:   returns the position of the value having the key.
+        //:
+        //: 2 'insertMulti' inserts after existing values having an equivalent
+        //:   key or, given a valid hint, immediately before the hint.
+        //:
+        //: 3 Correct hints are used, and incorrect hints are ignored.
+        //:
+        //: 4 'erase' removes the indicated values.
+        //
+        // Plan:
+        //: 1 Insert pseudo-random values one at a time, with no hint, with the
+        //:   correct hint, and with the 'begin' and 'end' hints, comparing
+        //:   with a model vector after each insertion.  (C-1..3)
+        //:
+        //: 2 Erase values and ranges and verify the result.  (C-4)
+        //
+        // Testing:
+        //   pair<iterator, bool> insertUnique(const KEY&, VALUE_ARG&&);
+        //   pair<iterator,bool> insertUnique(const_iterator, const KEY&, V&&);
+        //   iterator insertMulti(const KEY&, VALUE_ARG&&);
+        //   iterator insertMulti(const_iterator, const KEY&, VALUE_ARG&&);
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSINGLE-VALUE INSERTION AND ERASURE"
+                            "\n==================================\n");
+
+        for (int hintMode = 0; hintMode < 4; ++hintMode) {
+            for (int unique = 0; unique < 2; ++unique) {
+                const Container VALUES = randomValues(60, 25, 0);
+
+                Obj mX(COMP, Alloc());  const Obj& X = mX;
+                Container expected;
+
+                for (Container::size_type i = 0; i < VALUES.size(); ++i) {
+                    const Value& V = VALUES[i];
+
+                    Obj::const_iterator hint;
+                    switch (hintMode) {
+                      case 1: {
+                        hint = unique ? X.lowerBound(V.first)
+                                      : X.upperBound(V.first);
+                      } break;
+                      case 2: {
+                        hint = X.container().begin();
+                      } break;
+                      default: {
+                        hint = X.container().end();
+                      } break;
+                    }
+
+                    // Compute the expected position of 'V' in the model.
+
+                    const Obj::const_iterator BEGIN = X.container().begin();
+
+                    const Obj::size_type HINT_INDEX = hint - BEGIN;
+                    const Obj::size_type LB_INDEX   =
+                                                 X.lowerBound(V.first) - BEGIN;
+                    const Obj::size_type UB_INDEX   =
+                                                 X.upperBound(V.first) - BEGIN;
+                    const bool VALID_HINT = LB_INDEX <= HINT_INDEX
+                                         && HINT_INDEX <= UB_INDEX;
+                    const Obj::size_type EXP_INDEX =
+                                   unique ? LB_INDEX
+                                          : hintMode && VALID_HINT ? HINT_INDEX
+                                                                   : UB_INDEX;
+                    if (!unique || LB_INDEX == UB_INDEX) {
+                        expected.insert(expected.begin() + EXP_INDEX, V);
+                    }
+
+                    Obj::iterator position;
+                    if (unique) {
+                        const bool WAS_PRESENT =
+                                     X.container().end() != X.find(V.first);
+                        bsl::pair<Obj::iterator, bool> rv =
+                                hintMode
+                                ? mX.insertUnique(hint, V.first, V)
+                                : mX.insertUnique(V.first, V);
+                        ASSERTV(hintMode, i, WAS_PRESENT != rv.second);
+                        position = rv.first;
+                    }
+                    else {
+                        position = hintMode
+                                 ? mX.insertMulti(hint, V.first, V)
+                                 : mX.insertMulti(V.first, V);
+                        ASSERTV(hintMode, i, V == *position);
+                    }
+                    ASSERTV(hintMode, i, V.first == position->first);
+                    ASSERTV(hintMode, i,
+                            EXP_INDEX == static_cast<Obj::size_type>(
+                                            position - X.container().begin()));
+                    ASSERTV(hintMode, i, unique, expected == X.container());
+                }
+            }
+        }
+
+        if (veryVerbose) printf("\tErasure.\n");
+        {
+            Obj mX(COMP, Alloc());  const Obj& X = mX;
+            for (int k = 0; k < 10; ++k) {
+                mX.insertUnique(k, Value(k, k));
+            }
+
+            Obj::iterator it = mX.erase(X.find(3));
+            ASSERT(4 == it->first);
+            ASSERT(9 == X.container().size());
+
+            it = mX.erase(X.lowerBound(5), X.lowerBound(8));
+            ASSERT(8 == it->first);
+            ASSERT(6 == X.container().size());
+            ASSERT(X.container().end() == X.find(6));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(COMP, &oa);  const Obj& X = mX;
+        ASSERT(X.container().empty());
+        ASSERT(&oa == X.container().get_allocator().mechanism());
+        ASSERT(false == X.comparator()(1, 1));
+
+        ASSERT(true  == mX.insertUnique(3, Value(3, 0)).second);
+        ASSERT(true  == mX.insertUnique(1, Value(1, 1)).second);
+        ASSERT(false == mX.insertUnique(3, Value(3, 2)).second);
+        mX.insertMulti(3, Value(3, 3));
+
+        ASSERT(3 == X.container().size());
+        ASSERT(2 == X.count(3));
+        ASSERT(Value(1, 1) == X.container()[0]);
+        ASSERT(Value(3, 0) == X.container()[1]);
+        ASSERT(Value(3, 3) == X.container()[2]);
+
+        const Value MORE[] = { Value(2, 4), Value(0, 5), Value(3, 6) };
+        mX.insertRange(MORE, MORE + 3, false, false);
+        ASSERT(6 == X.container().size());
+        ASSERT(0 == X.container().front().first);
+
+        mX.erase(X.find(2));
+        ASSERT(X.container().end() == X.find(2));
+
+        ASSERT(0 <  oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
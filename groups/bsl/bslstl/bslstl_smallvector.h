@@ -0,0 +1,2053 @@
+// bslstl_smallvector.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SMALLVECTOR
+#define INCLUDED_BSLSTL_SMALLVECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector that holds a few elements without allocating.
+//
+//@CLASSES:
+//   bsl::small_vector: vector with inline storage for 'N' elements
+//
+//@SEE_ALSO: bslstl_vector, bslalg_arrayprimitives
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::small_vector', implementing a contiguous sequence container, having
+// the interface of 'bsl::vector', that embeds storage for a fixed number,
+// 'INLINE_CAPACITY', of elements in the object itself.  While the number of
+// elements does not exceed 'INLINE_CAPACITY', a 'small_vector' allocates no
+// memory at all; once it grows beyond that, the elements are moved to a
+// buffer obtained from the allocator and the container then behaves as a
+// 'bsl::vector' would, doubling its capacity as it grows.
+//
+// 'small_vector' is intended for short sequences created and destroyed in
+// performance-critical code, e.g., the fields of a parsed record or the
+// children of a node, where the common case is small and bounded but the
+// rare case is not.  Avoiding the allocator for the common case saves both
+// the cost of the allocation and the cost of the indirection on every access.
+// The price is a larger 'sizeof' and, unlike 'bsl::vector', a 'swap' or move
+// that may need to move the elements themselves (in linear time) when either
+// container uses its inline storage.
+//
+///Relation to 'bslalg::ArrayPrimitives'
+///-------------------------------------
+// All element construction, insertion, erasure, and relocation is delegated
+// to 'bslalg::ArrayPrimitives', exactly as it is for 'bsl::vector'.  In
+// particular, relocating the elements from the inline storage to the heap
+// (and back, in 'shrink_to_fit') uses 'ArrayPrimitives::destructiveMove',
+// which is a single 'memcpy' for types having the 'bslmf::IsBitwiseMoveable'
+// trait.  Elements are constructed using 'allocator_traits<ALLOCATOR>', so
+// that, for the default 'bsl::allocator', the allocator of the container is
+// passed to each element that uses 'bslma' allocators, whether the element
+// lives in the inline storage or on the heap.
+//
+///Iterator Invalidation
+///---------------------
+// The rules of 'bsl::vector' apply, with one addition: since the inline
+// storage moves with the object, moving or swapping a 'small_vector' whose
+// elements are held inline invalidates all iterators, pointers, and
+// references to its elements.
+//
+///Allocator Propagation
+///---------------------
+// 'small_vector' honors the 'propagate_on_container_copy_assignment',
+// 'propagate_on_container_move_assignment', and
+// 'propagate_on_container_swap' traits of 'ALLOCATOR' as 'bsl::vector' does.
+// Note that none of these traits is 'true' for 'bsl::allocator'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Splitting a Path Without Allocating
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to find the positions of the separators in file system
+// paths, most of which have few components.
+//
+// First, we define a function that records the offset of each '/' in a
+// 'small_vector' having room for eight offsets inline:
+//..
+//  typedef bsl::small_vector<int, 8> Offsets;
+//
+//  void findSeparators(Offsets *result, const char *path)
+//      // Load into the specified 'result' the offset of each '/' in the
+//      // specified null-terminated 'path'.
+//  {
+//      result->clear();
+//      for (int i = 0; path[i]; ++i) {
+//          if ('/' == path[i]) {
+//              result->push_back(i);
+//          }
+//      }
+//  }
+//..
+// Then, we create a 'small_vector' supplied with a test allocator, so that we
+// can observe its use of memory:
+//..
+//  bslma::TestAllocator ta;
+//  Offsets              offsets(&ta);
+//..
+// Next, we split a typical path, and observe that no memory was allocated:
+//..
+//  findSeparators(&offsets, "/usr/local/include/bsl_vector.h");
+//  assert(4 == offsets.size());
+//  assert(10 == offsets[2]);
+//  assert(0 == ta.numBlocksTotal());
+//..
+// Finally, we split an unusually deep path, and observe that the elements
+// have moved to a single block obtained from the allocator:
+//..
+//  findSeparators(&offsets, "/a/b/c/d/e/f/g/h/i/j");
+//  assert(10 == offsets.size());
+//  assert(!offsets.is_inline());
+//  assert(1 == ta.numBlocksInUse());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_stdexceptutil.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+#include <bslalg_autoarraydestructor.h>
+#include <bslalg_arrayprimitives.h>
+#include <bslalg_containerbase.h>
+#include <bslalg_hasstliterators.h>
+#include <bslalg_rangecompare.h>
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_enableif.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_isfundamental.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_performancehint.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <initializer_list>
+#endif
+
+namespace bsl {
+
+                            // ==================
+                            // class small_vector
+                            // ==================
+
+template <class VALUE_TYPE,
+          std::size_t INLINE_CAPACITY,
+          class ALLOCATOR = bsl::allocator<VALUE_TYPE> >
+class small_vector : private BloombergLP::bslalg::ContainerBase<ALLOCATOR> {
+    // This class template implements a value-semantic container type holding
+    // a contiguous sequence of elements of the (template parameter) type
+    // 'VALUE_TYPE', having storage for 'INLINE_CAPACITY' elements embedded in
+    // the object and obtaining memory from the (template parameter) type
+    // 'ALLOCATOR' only when the size of the sequence exceeds
+    // 'INLINE_CAPACITY'.  The behavior is undefined unless
+    // 'allocator_traits<ALLOCATOR>::pointer' is 'VALUE_TYPE *'.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslalg::ContainerBase<ALLOCATOR>  ContainerBase;
+        // Container base type, containing the allocator and applying the empty
+        // base class optimization (EBO) whenever appropriate.
+
+    typedef BloombergLP::bslalg::ArrayPrimitives           ArrayPrimitives;
+    typedef BloombergLP::bslalg::ArrayDestructionPrimitives
+                                                           DestructionUtil;
+    typedef BloombergLP::bslmf::MovableRefUtil             MoveUtil;
+    typedef bsl::allocator_traits<ALLOCATOR>               AllocatorTraits;
+
+    typedef BloombergLP::bsls::AlignedBuffer<
+               INLINE_CAPACITY * sizeof(VALUE_TYPE),
+               BloombergLP::bsls::AlignmentFromType<VALUE_TYPE>::VALUE>
+                                                           InlineBuffer;
+        // Uninitialized storage for 'INLINE_CAPACITY' elements.
+
+    class Proctor {
+        // This class provides a proctor for deallocating an array of
+        // 'VALUE_TYPE' objects obtained from the allocator of a
+        // 'small_vector'.
+
+        // DATA
+        VALUE_TYPE    *d_data_p;       // array pointer (or 0)
+        std::size_t    d_capacity;     // capacity of the array
+        ContainerBase *d_container_p;  // container base pointer
+
+      private:
+        // NOT IMPLEMENTED
+        Proctor(const Proctor&);
+        Proctor& operator=(const Proctor&);
+
+      public:
+        // CREATORS
+        Proctor(VALUE_TYPE    *data,
+                std::size_t    capacity,
+                ContainerBase *container);
+            // Create a proctor for the specified 'data' array of the specified
+            // 'capacity', using the 'deallocateN' method of the specified
+            // 'container' to return 'data' to its allocator upon destruction,
+            // unless 'data' is 0 or this proctor's 'release' is called prior.
+
+        ~Proctor();
+            // Destroy this proctor, deallocating any data under management.
+
+        // MANIPULATORS
+        void release();
+            // Release the data from management by this proctor.
+    };
+
+    BSLMF_ASSERT(0 < INLINE_CAPACITY);
+
+    // DATA
+    VALUE_TYPE   *d_begin_p;   // first element (inline or on the heap)
+    VALUE_TYPE   *d_end_p;     // one past the last element
+    std::size_t   d_capacity;  // 'INLINE_CAPACITY' or size of the heap array
+    InlineBuffer  d_inline;    // storage for the elements while they fit
+
+  public:
+    // PUBLIC TYPES
+    typedef VALUE_TYPE                                   value_type;
+    typedef ALLOCATOR                                    allocator_type;
+    typedef VALUE_TYPE&                                  reference;
+    typedef const VALUE_TYPE&                            const_reference;
+
+    typedef typename AllocatorTraits::size_type          size_type;
+    typedef typename AllocatorTraits::difference_type    difference_type;
+    typedef typename AllocatorTraits::pointer            pointer;
+    typedef typename AllocatorTraits::const_pointer      const_pointer;
+
+    typedef VALUE_TYPE                                  *iterator;
+    typedef const VALUE_TYPE                            *const_iterator;
+    typedef bsl::reverse_iterator<iterator>             reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>       const_reverse_iterator;
+
+  private:
+    // PRIVATE MANIPULATORS
+    VALUE_TYPE *inlineData();
+        // Return the address of the inline storage of this object.
+
+    void privateAdopt(VALUE_TYPE *data,
+                      size_type   numElements,
+                      size_type   capacity);
+        // Return the heap storage of this object (if any) to the allocator,
+        // and take ownership of the specified 'data' array, having the
+        // specified 'capacity' and holding the specified 'numElements'
+        // elements.  The behavior is undefined unless this object holds no
+        // elements, and 'data' was obtained from the allocator of this object
+        // or is the inline storage of this object.
+
+    template <class INPUT_ITER>
+    void privateInsert(size_type                       index,
+                       INPUT_ITER                      first,
+                       INPUT_ITER                      last,
+                       const std::input_iterator_tag&);
+    template <class FWD_ITER>
+    void privateInsert(size_type                         index,
+                       FWD_ITER                          first,
+                       FWD_ITER                          last,
+                       const std::forward_iterator_tag&);
+        // Insert at the specified 'index' the elements in the range
+        // '[first .. last)'.  The last argument is used only for overload
+        // resolution.  The behavior is undefined unless 'index <= size()'.
+
+    void privateReallocate(size_type newCapacity);
+        // Move the elements of this object to newly allocated storage having
+        // the specified 'newCapacity', or to the inline storage if
+        // 'newCapacity <= INLINE_CAPACITY', and release the current heap
+        // storage (if any).  The behavior is undefined unless
+        // 'size() <= newCapacity', and either 'INLINE_CAPACITY < newCapacity'
+        // or the elements are currently on the heap.
+
+    void privateReserveEmpty(size_type numElements);
+        // Make this object, which must be empty and use its inline storage,
+        // able to hold the specified 'numElements' without reallocating,
+        // throwing 'std::length_error' if 'max_size() < numElements'.
+
+    void privateSwapStorage(small_vector *other);
+        // Exchange the elements and storage of this object with those of the
+        // specified 'other' object, leaving both allocators unchanged.  The
+        // behavior is undefined unless the elements of each object may be
+        // owned by the allocator of the other, i.e., unless the allocators
+        // compare equal or the caller will subsequently exchange them.
+
+    // PRIVATE ACCESSORS
+    const VALUE_TYPE *inlineData() const;
+        // Return the address of the inline storage of this object.
+
+    VALUE_TYPE *heapData() const;
+        // Return the address of the heap storage of this object, or 0 if the
+        // elements are inline.
+
+    size_type privateGrowCapacity(size_type   numExtra,
+                                  const char *message) const;
+        // Return the capacity to allocate in order to add the specified
+        // 'numExtra' elements, which must not fit in the current capacity, to
+        // this object, growing geometrically as 'bsl::vector' does.  Throw
+        // 'std::length_error', having the specified 'message', if
+        // 'max_size() - size() < numExtra'.
+
+  public:
+    // CREATORS
+    small_vector() BSLS_KEYWORD_NOEXCEPT;
+    explicit small_vector(const ALLOCATOR& basicAllocator)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+        // Create an empty vector.  Optionally specify a 'basicAllocator' used
+        // to supply memory once the vector outgrows its inline storage.  If
+        // 'basicAllocator' is not specified, a default-constructed object of
+        // the (template parameter) type 'ALLOCATOR' is used.  If the type
+        // 'ALLOCATOR' is 'bsl::allocator' (the default), then
+        // 'basicAllocator', if supplied, shall be convertible to
+        // 'bslma::Allocator *', and if not supplied, the currently installed
+        // default allocator is used.  Note that no memory is allocated.
+
+    explicit small_vector(size_type        initialSize,
+                          const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create a vector of the specified 'initialSize' default-constructed
+        // elements.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  Throw 'std::length_error' if 'initialSize > max_size()'.
+
+    small_vector(size_type         initialSize,
+                 const VALUE_TYPE& value,
+                 const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create a vector of the specified 'initialSize' copies of the
+        // specified 'value'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  Throw 'std::length_error' if
+        // 'initialSize > max_size()'.
+
+    template <class INPUT_ITER>
+    small_vector(INPUT_ITER       first,
+                 INPUT_ITER       last,
+                 const ALLOCATOR& basicAllocator = ALLOCATOR(),
+                 typename enable_if<
+                     !bsl::is_fundamental<INPUT_ITER>::value, int>::type = 0);
+        // Create a vector holding copies of the elements in the range
+        // '[first .. last)'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last'.  Note that the last parameter is used only for
+        // overload resolution.
+
+    small_vector(const small_vector& original);
+        // Create a vector having the same value as the specified 'original'
+        // object, using the allocator returned by 'bsl::allocator_traits<
+        // ALLOCATOR>::select_on_container_copy_construction(
+        // original.get_allocator())' to supply memory.
+
+    small_vector(const small_vector& original,
+                 const ALLOCATOR&    basicAllocator);
+        // Create a vector having the same value as the specified 'original'
+        // object, using the specified 'basicAllocator' to supply memory.
+
+    small_vector(BloombergLP::bslmf::MovableRef<small_vector> original);
+        // Create a vector having the same value as the specified 'original'
+        // object by moving the contents of 'original' to the new vector, and
+        // leave 'original' empty.  The allocator associated with 'original'
+        // is propagated for use in the newly-created vector.  If 'original'
+        // holds its elements on the heap, this operation takes ownership of
+        // that storage, has 'O[1]' complexity, and does not throw; otherwise,
+        // the elements are moved to the inline storage of the new vector,
+        // which, for types having the 'bslmf::IsBitwiseMoveable' trait, is a
+        // single 'memcpy'.
+
+    small_vector(BloombergLP::bslmf::MovableRef<small_vector> original,
+                 const ALLOCATOR&                             basicAllocator);
+        // Create a vector having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // If 'basicAllocator == original.get_allocator()', the contents of
+        // 'original' are moved as by the move constructor; otherwise, the
+        // elements are moved one at a time, and 'original' is left in a valid
+        // but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    small_vector(std::initializer_list<VALUE_TYPE> values,
+                 const ALLOCATOR&                  basicAllocator =
+                                                                  ALLOCATOR());
+        // Create a vector holding copies of the specified 'values'.
+        // Optionally specify a 'basicAllocator' used to supply memory.
+#endif
+
+    ~small_vector();
+        // Destroy this vector.
+
+    // MANIPULATORS
+    small_vector& operator=(const small_vector& rhs);
+        // Assign to this object the value of the specified 'rhs' object,
+        // propagate to this object the allocator of 'rhs' if the 'ALLOCATOR'
+        // type has trait 'propagate_on_container_copy_assignment', and return
+        // a reference providing modifiable access to this object.
+
+    small_vector& operator=(BloombergLP::bslmf::MovableRef<small_vector> rhs);
+        // Assign to this object the value of the specified 'rhs' object,
+        // propagate to this object the allocator of 'rhs' if the 'ALLOCATOR'
+        // type has trait 'propagate_on_container_move_assignment', and return
+        // a reference providing modifiable access to this object.  The
+        // contents of 'rhs' are moved (in constant time if they are on the
+        // heap) to this vector if the two allocators compare equal or the
+        // allocator propagates; otherwise, each element is moved
+        // individually.  'rhs' is left in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    small_vector& operator=(std::initializer_list<VALUE_TYPE> values);
+        // Assign to this object copies of the specified 'values', and return
+        // a reference providing modifiable access to this object.
+#endif
+
+    void assign(size_type numElements, const VALUE_TYPE& value);
+        // Assign to this object the specified 'numElements' copies of the
+        // specified 'value'.  Throw 'std::length_error' if
+        // 'numElements > max_size()'.
+
+    template <class INPUT_ITER>
+    typename enable_if<!bsl::is_fundamental<INPUT_ITER>::value>::type
+    assign(INPUT_ITER first, INPUT_ITER last);
+        // Assign to this object copies of the elements in the range
+        // '[first .. last)'.  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values, none of which is an
+        // element of this vector, where 'first' is at a position at or before
+        // 'last'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void assign(std::initializer_list<VALUE_TYPE> values);
+        // Assign to this object copies of the specified 'values'.
+#endif
+
+                             // *** iteration ***
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the first element
+        // of this vector, or the past-the-end iterator if it is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator providing modifiable access to
+        // this vector.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing modifiable access to the last
+        // element of this vector, or the past-the-end reverse iterator if it
+        // is empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator providing modifiable
+        // access to this vector.
+
+                            // *** element access ***
+
+    reference operator[](size_type position);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'position'.  The behavior is undefined unless
+        // 'position < size()'.
+
+    reference at(size_type position);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'position'.  Throw 'std::out_of_range' if
+        // 'position >= size()'.
+
+    reference front();
+        // Return a reference providing modifiable access to the first element
+        // of this vector.  The behavior is undefined unless this vector is
+        // not empty.
+
+    reference back();
+        // Return a reference providing modifiable access to the last element
+        // of this vector.  The behavior is undefined unless this vector is
+        // not empty.
+
+    VALUE_TYPE *data() BSLS_KEYWORD_NOEXCEPT;
+        // Return the address of the modifiable first element of this vector.
+
+                               // *** capacity ***
+
+    void reserve(size_type newCapacity);
+        // Change the capacity of this vector to at least the specified
+        // 'newCapacity', moving the elements to the heap if necessary.  Throw
+        // 'std::length_error' if 'newCapacity > max_size()'.  This method has
+        // no effect if 'newCapacity <= capacity()'.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this vector to its size, or, if the size
+        // does not exceed 'INLINE_CAPACITY', move the elements back to the
+        // inline storage and release the heap storage.
+
+    void resize(size_type newSize);
+        // Change the size of this vector to the specified 'newSize', erasing
+        // elements at the end or appending default-constructed elements as
+        // needed.  Throw 'std::length_error' if 'newSize > max_size()'.
+
+    void resize(size_type newSize, const VALUE_TYPE& value);
+        // Change the size of this vector to the specified 'newSize', erasing
+        // elements at the end or appending copies of the specified 'value' as
+        // needed.  Throw 'std::length_error' if 'newSize > max_size()'.
+
+                              // *** modifiers ***
+
+    void push_back(const VALUE_TYPE& value);
+        // Append to the end of this vector a copy of the specified 'value'.
+        // If an exception is thrown, this vector is unchanged.  Throw
+        // 'std::length_error' if 'size() == max_size()'.
+
+    void push_back(BloombergLP::bslmf::MovableRef<VALUE_TYPE> value);
+        // Append to the end of this vector the specified move-insertable
+        // 'value', which is left in a valid but unspecified state.  If an
+        // exception is thrown, this vector is unchanged.  Throw
+        // 'std::length_error' if 'size() == max_size()'.
+
+    void pop_back();
+        // Erase the last element from this vector.  The behavior is undefined
+        // if this vector is empty.
+
+    iterator insert(const_iterator position, const VALUE_TYPE& value);
+        // Insert at the specified 'position' a copy of the specified 'value',
+        // and return an iterator referring to the newly inserted element.
+        // The behavior is undefined unless 'position' is an iterator in the
+        // range '[cbegin() .. cend()]'.
+
+    iterator insert(const_iterator                             position,
+                    BloombergLP::bslmf::MovableRef<VALUE_TYPE> value);
+        // Insert at the specified 'position' the specified move-insertable
+        // 'value', which is left in a valid but unspecified state, and return
+        // an iterator referring to the newly inserted element.  The behavior
+        // is undefined unless 'position' is an iterator in the range
+        // '[cbegin() .. cend()]'.
+
+    iterator insert(const_iterator    position,
+                    size_type         numElements,
+                    const VALUE_TYPE& value);
+        // Insert at the specified 'position' the specified 'numElements'
+        // copies of the specified 'value', and return an iterator referring
+        // to the first newly inserted element, or 'position' if
+        // 'numElements' is 0.  The behavior is undefined unless 'position' is
+        // an iterator in the range '[cbegin() .. cend()]'.
+
+    template <class INPUT_ITER>
+    typename enable_if<!bsl::is_fundamental<INPUT_ITER>::value,
+                       iterator>::type
+    insert(const_iterator position, INPUT_ITER first, INPUT_ITER last);
+        // Insert at the specified 'position' copies of the elements in the
+        // range '[first .. last)', and return an iterator referring to the
+        // first newly inserted element, or 'position' if the range is empty.
+        // The behavior is undefined unless 'position' is an iterator in the
+        // range '[cbegin() .. cend()]', and 'first' and 'last' refer to a
+        // sequence of valid values, none of which is an element of this
+        // vector, where 'first' is at a position at or before 'last'.  Note
+        // that, if 'INPUT_ITER' is merely an input iterator, only the basic
+        // exception-safety guarantee is provided.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    iterator insert(const_iterator                    position,
+                    std::initializer_list<VALUE_TYPE> values);
+        // Insert at the specified 'position' copies of the specified
+        // 'values', and return an iterator referring to the first newly
+        // inserted element, or 'position' if 'values' is empty.
+#endif
+
+    iterator erase(const_iterator position);
+        // Erase the element at the specified 'position', and return an
+        // iterator referring to the element that followed it.  The behavior
+        // is undefined unless 'position' is an iterator in the range
+        // '[cbegin() .. cend())'.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Erase the elements in the range '[first .. last)', and return an
+        // iterator referring to the element that followed them.  The behavior
+        // is undefined unless 'first' and 'last' are iterators in the range
+        // '[cbegin() .. cend()]' and 'first <= last'.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Erase all elements from this vector, retaining its capacity.
+
+    void swap(small_vector& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value of this object with that of the specified
+        // 'other' object.  Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object.  If both objects hold their elements on the heap
+        // and either the allocator propagates or the allocators compare
+        // equal, this method has 'O[1]' complexity and does not throw;
+        // otherwise, elements are moved individually (in 'O[n + m]' time) and
+        // both objects are left in valid but unspecified states if an
+        // exception is thrown.
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used by this vector.
+
+                             // *** iteration ***
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // element of this vector, or the past-the-end iterator if it is
+        // empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator providing non-modifiable access to
+        // this vector.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last element of this vector, or the past-the-end reverse iterator
+        // if it is empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator providing non-modifiable
+        // access to this vector.
+
+                               // *** capacity ***
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this vector.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements this vector can hold without
+        // allocating memory.  Note that this is 'INLINE_CAPACITY' while the
+        // elements are held inline.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this vector has no elements, and 'false'
+        // otherwise.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this vector could hold.
+
+    bool is_inline() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if the elements of this vector are held in its inline
+        // storage, and 'false' if they are held in memory obtained from the
+        // allocator.
+
+                            // *** element access ***
+
+    const_reference operator[](size_type position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position'.  The behavior is undefined unless
+        // 'position < size()'.
+
+    const_reference at(size_type position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position'.  Throw 'std::out_of_range' if
+        // 'position >= size()'.
+
+    const_reference front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    const_reference back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    const VALUE_TYPE *data() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the address of the non-modifiable first element of this
+        // vector.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator==(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'small_vector' objects have the same
+    // value if they have the same number of elements, and each element of
+    // 'lhs' has the same value as the corresponding element of 'rhs'.  Note
+    // that whether the elements are held inline does not affect the value.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator!=(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator<(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator>(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator<=(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator>=(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return the result of the lexicographical comparison of the elements of
+    // the specified 'lhs' and 'rhs' vectors, using 'operator<' on
+    // 'VALUE_TYPE'.
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void swap(small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& a,
+          small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the values of the specified 'a' and 'b' objects, as for the
+    // 'swap' member.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+          // ---------------------------------------------------------
+          // class small_vector<VALUE_TYPE, INLINE_CAPACITY>::Proctor
+          // ---------------------------------------------------------
+
+// CREATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::Proctor::Proctor(
+                                                    VALUE_TYPE    *data,
+                                                    std::size_t    capacity,
+                                                    ContainerBase *container)
+: d_data_p(data)
+, d_capacity(capacity)
+, d_container_p(container)
+{
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::Proctor::~Proctor()
+{
+    if (d_data_p) {
+        d_container_p->deallocateN(d_data_p, d_capacity);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::Proctor::release()
+{
+    d_data_p = 0;
+}
+
+                            // ------------------
+                            // class small_vector
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::inlineData()
+{
+    return reinterpret_cast<VALUE_TYPE *>(d_inline.buffer());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateAdopt(
+                                                     VALUE_TYPE *data,
+                                                     size_type   numElements,
+                                                     size_type   capacity)
+{
+    BSLS_ASSERT_SAFE(d_begin_p == d_end_p);
+
+    if (VALUE_TYPE *heap = heapData()) {
+        ContainerBase::deallocateN(heap, d_capacity);
+    }
+    d_begin_p  = data;
+    d_end_p    = data + numElements;
+    d_capacity = capacity;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateInsert(
+                                      size_type                       index,
+                                      INPUT_ITER                      first,
+                                      INPUT_ITER                      last,
+                                      const std::input_iterator_tag&)
+{
+    // The length of the range is not known in advance, so append each element
+    // and then rotate the appended elements into place.
+
+    const size_type oldSize = size();
+
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+    ArrayPrimitives::rotate(d_begin_p + index,
+                            d_begin_p + oldSize,
+                            d_end_p);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class FWD_ITER>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateInsert(
+                                    size_type                         index,
+                                    FWD_ITER                          first,
+                                    FWD_ITER                          last,
+                                    const std::forward_iterator_tag&)
+{
+    VALUE_TYPE      *pos = d_begin_p + index;
+    const size_type  n   = bsl::distance(first, last);
+
+    if (n <= d_capacity - size()) {
+        ArrayPrimitives::insert(pos,
+                                d_end_p,
+                                first,
+                                last,
+                                n,
+                                ContainerBase::allocator());
+        d_end_p += n;
+        return;                                                       // RETURN
+    }
+
+    const size_type newCapacity = privateGrowCapacity(
+                  n, "small_vector<...>::insert(pos,first,last): too long");
+    const size_type newSize     = size() + n;
+
+    VALUE_TYPE *newData = ContainerBase::allocateN(d_begin_p, newCapacity);
+    Proctor     proctor(newData, newCapacity, this);
+
+    ArrayPrimitives::destructiveMoveAndInsert(newData,
+                                              &d_end_p,
+                                              d_begin_p,
+                                              pos,
+                                              d_end_p,
+                                              first,
+                                              last,
+                                              n,
+                                              ContainerBase::allocator());
+    proctor.release();
+    privateAdopt(newData, newSize, newCapacity);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateReallocate(
+                                                         size_type newCapacity)
+{
+    BSLS_ASSERT_SAFE(size() <= newCapacity);
+    BSLS_ASSERT_SAFE(INLINE_CAPACITY < newCapacity || !is_inline());
+
+    VALUE_TYPE *newData;
+    if (newCapacity <= INLINE_CAPACITY) {
+        newData     = inlineData();
+        newCapacity = INLINE_CAPACITY;
+    }
+    else {
+        newData = ContainerBase::allocateN(d_begin_p, newCapacity);
+    }
+    Proctor proctor(newData == inlineData() ? 0 : newData,
+                    newCapacity,
+                    this);
+
+    const size_type numElements = size();
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_begin_p,
+                                     d_end_p,
+                                     ContainerBase::allocator());
+    proctor.release();
+
+    d_end_p = d_begin_p;
+    privateAdopt(newData, numElements, newCapacity);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateReserveEmpty(
+                                                         size_type numElements)
+{
+    BSLS_ASSERT_SAFE(empty());
+    BSLS_ASSERT_SAFE(is_inline());
+
+    if (numElements <= INLINE_CAPACITY) {
+        return;                                                       // RETURN
+    }
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                              "small_vector<...>::reserve(n): input too long");
+    }
+    d_begin_p  = ContainerBase::allocateN(d_begin_p, numElements);
+    d_end_p    = d_begin_p;
+    d_capacity = numElements;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateSwapStorage(
+                                                           small_vector *other)
+{
+    const bool thisInline  = is_inline();
+    const bool otherInline = other->is_inline();
+
+    if (!thisInline && !otherInline) {
+        BloombergLP::bslalg::SwapUtil::swap(&d_begin_p,  &other->d_begin_p);
+        BloombergLP::bslalg::SwapUtil::swap(&d_end_p,    &other->d_end_p);
+        BloombergLP::bslalg::SwapUtil::swap(&d_capacity, &other->d_capacity);
+        return;                                                       // RETURN
+    }
+
+    if (thisInline && otherInline) {
+        // Swap the common prefix in place, then move the remaining elements
+        // of the longer vector to the end of the shorter one.
+
+        small_vector *longer  = size() < other->size() ? other : this;
+        small_vector *shorter = longer == this ? other : this;
+
+        const size_type common = shorter->size();
+        for (size_type i = 0; i < common; ++i) {
+            BloombergLP::bslalg::SwapUtil::swap(longer->d_begin_p + i,
+                                                shorter->d_begin_p + i);
+        }
+
+        const size_type numMoved = longer->size() - common;
+        ArrayPrimitives::destructiveMove(
+                                       shorter->d_end_p,
+                                       longer->d_begin_p + common,
+                                       longer->d_end_p,
+                                       shorter->ContainerBase::allocator());
+        shorter->d_end_p += numMoved;
+        longer->d_end_p   = longer->d_begin_p + common;
+        return;                                                       // RETURN
+    }
+
+    // Exactly one of the two vectors is on the heap: move the inline elements
+    // into the inline storage of the other, which then takes over the heap
+    // storage.
+
+    small_vector *inl  = thisInline ? this  : other;
+    small_vector *heap = thisInline ? other : this;
+
+    VALUE_TYPE      *heapBegin    = heap->d_begin_p;
+    VALUE_TYPE      *heapEnd      = heap->d_end_p;
+    const size_type  heapCapacity = heap->d_capacity;
+    const size_type  numInline    = inl->size();
+
+    ArrayPrimitives::destructiveMove(heap->inlineData(),
+                                     inl->d_begin_p,
+                                     inl->d_end_p,
+                                     heap->ContainerBase::allocator());
+
+    heap->d_begin_p  = heap->inlineData();
+    heap->d_end_p    = heap->d_begin_p + numInline;
+    heap->d_capacity = INLINE_CAPACITY;
+
+    inl->d_begin_p   = heapBegin;
+    inl->d_end_p     = heapEnd;
+    inl->d_capacity  = heapCapacity;
+}
+
+// PRIVATE ACCESSORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+const VALUE_TYPE *
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::inlineData() const
+{
+    return reinterpret_cast<const VALUE_TYPE *>(d_inline.buffer());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+VALUE_TYPE *
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::heapData() const
+{
+    return is_inline() ? 0 : d_begin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateGrowCapacity(
+                                                   size_type   numExtra,
+                                                   const char *message) const
+{
+    const size_type maxSize = max_size();
+    const size_type oldSize = size();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numExtra > maxSize - oldSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(message);
+    }
+
+    const size_type newSize     = oldSize + numExtra;
+    const size_type newCapacity = d_capacity < maxSize / 2
+                                ? d_capacity * 2
+                                : maxSize;
+    return newCapacity < newSize ? newSize : newCapacity;
+}
+
+// CREATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector()
+                                                          BSLS_KEYWORD_NOEXCEPT
+: ContainerBase(ALLOCATOR())
+, d_capacity(INLINE_CAPACITY)
+{
+    d_begin_p = d_end_p = inlineData();
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                    const ALLOCATOR& basicAllocator) BSLS_KEYWORD_NOEXCEPT
+: ContainerBase(basicAllocator)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_begin_p = d_end_p = inlineData();
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                              size_type        initialSize,
+                                              const ALLOCATOR& basicAllocator)
+: ContainerBase(basicAllocator)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_begin_p = d_end_p = inlineData();
+
+    privateReserveEmpty(initialSize);
+    Proctor proctor(heapData(), d_capacity, this);
+
+    ArrayPrimitives::defaultConstruct(d_begin_p,
+                                      initialSize,
+                                      ContainerBase::allocator());
+    proctor.release();
+    d_end_p += initialSize;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                             size_type         initialSize,
+                                             const VALUE_TYPE& value,
+                                             const ALLOCATOR&  basicAllocator)
+: ContainerBase(basicAllocator)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_begin_p = d_end_p = inlineData();
+
+    privateReserveEmpty(initialSize);
+    Proctor proctor(heapData(), d_capacity, this);
+
+    ArrayPrimitives::uninitializedFillN(d_begin_p,
+                                        initialSize,
+                                        value,
+                                        ContainerBase::allocator());
+    proctor.release();
+    d_end_p += initialSize;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+    INPUT_ITER       first,
+    INPUT_ITER       last,
+    const ALLOCATOR& basicAllocator,
+    typename enable_if<!bsl::is_fundamental<INPUT_ITER>::value, int>::type)
+: ContainerBase(basicAllocator)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_begin_p = d_end_p = inlineData();
+
+    // Build the sequence in a temporary, whose destructor cleans up should an
+    // element fail to copy, and then take over its contents.
+
+    small_vector temp(basicAllocator);
+    temp.insert(temp.end(), first, last);
+    privateSwapStorage(&temp);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                                  const small_vector& original)
+: ContainerBase(AllocatorTraits::select_on_container_copy_construction(
+                                     original.ContainerBase::allocator()))
+, d_capacity(INLINE_CAPACITY)
+{
+    d_begin_p = d_end_p = inlineData();
+
+    const size_type numElements = original.size();
+    privateReserveEmpty(numElements);
+    Proctor proctor(heapData(), d_capacity, this);
+
+    ArrayPrimitives::copyConstruct(d_begin_p,
+                                   original.d_begin_p,
+                                   original.d_end_p,
+                                   ContainerBase::allocator());
+    proctor.release();
+    d_end_p += numElements;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                          const small_vector& original,
+                                          const ALLOCATOR&    basicAllocator)
+: ContainerBase(basicAllocator)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_begin_p = d_end_p = inlineData();
+
+    const size_type numElements = original.size();
+    privateReserveEmpty(numElements);
+    Proctor proctor(heapData(), d_capacity, this);
+
+    ArrayPrimitives::copyConstruct(d_begin_p,
+                                   original.d_begin_p,
+                                   original.d_end_p,
+                                   ContainerBase::allocator());
+    proctor.release();
+    d_end_p += numElements;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                        BloombergLP::bslmf::MovableRef<small_vector> original)
+: ContainerBase(MoveUtil::access(original).ContainerBase::allocator())
+, d_capacity(INLINE_CAPACITY)
+{
+    d_begin_p = d_end_p = inlineData();
+
+    privateSwapStorage(&MoveUtil::access(original));
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                  BloombergLP::bslmf::MovableRef<small_vector> original,
+                  const ALLOCATOR&                             basicAllocator)
+: ContainerBase(basicAllocator)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_begin_p = d_end_p = inlineData();
+
+    small_vector& lvalue = original;
+
+    if (lvalue.get_allocator() == basicAllocator) {
+        privateSwapStorage(&lvalue);
+        return;                                                       // RETURN
+    }
+
+    const size_type numElements = lvalue.size();
+    privateReserveEmpty(numElements);
+    Proctor proctor(heapData(), d_capacity, this);
+
+    ArrayPrimitives::moveConstruct(d_begin_p,
+                                   lvalue.d_begin_p,
+                                   lvalue.d_end_p,
+                                   ContainerBase::allocator());
+    proctor.release();
+    d_end_p += numElements;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                            std::initializer_list<VALUE_TYPE> values,
+                            const ALLOCATOR&                  basicAllocator)
+: ContainerBase(basicAllocator)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_begin_p = d_end_p = inlineData();
+
+    const size_type numElements = values.size();
+    privateReserveEmpty(numElements);
+    Proctor proctor(heapData(), d_capacity, this);
+
+    ArrayPrimitives::copyConstruct(d_begin_p,
+                                   values.begin(),
+                                   values.end(),
+                                   ContainerBase::allocator());
+    proctor.release();
+    d_end_p += numElements;
+}
+#endif
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::~small_vector()
+{
+    DestructionUtil::destroy(d_begin_p, d_end_p, ContainerBase::allocator());
+    if (VALUE_TYPE *heap = heapData()) {
+        ContainerBase::deallocateN(heap, d_capacity);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>&
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator=(
+                                                       const small_vector& rhs)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &rhs)) {
+        if (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+            small_vector other(rhs, rhs.get_allocator());
+            clear();
+            privateSwapStorage(&other);
+            using std::swap;
+            swap(ContainerBase::allocator(), other.ContainerBase::allocator());
+        }
+        else {
+            clear();
+            insert(d_begin_p, rhs.d_begin_p, rhs.d_end_p);
+        }
+    }
+    return *this;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>&
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator=(
+                              BloombergLP::bslmf::MovableRef<small_vector> rhs)
+{
+    small_vector& lvalue = rhs;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &lvalue)) {
+        if (get_allocator() == lvalue.get_allocator()) {
+            clear();
+            privateSwapStorage(&lvalue);
+        }
+        else if (
+              AllocatorTraits::propagate_on_container_move_assignment::value) {
+            small_vector other(MoveUtil::move(lvalue));
+            clear();
+            privateSwapStorage(&other);
+            using std::swap;
+            swap(ContainerBase::allocator(), other.ContainerBase::allocator());
+        }
+        else {
+            small_vector other(MoveUtil::move(lvalue), get_allocator());
+            clear();
+            privateSwapStorage(&other);
+        }
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>&
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator=(
+                                      std::initializer_list<VALUE_TYPE> values)
+{
+    assign(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::assign(
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    // 'value' may be an element of this vector, so assign to the existing
+    // elements before erasing or inserting any.
+
+    if (numElements <= size()) {
+        std::fill_n(d_begin_p, numElements, value);
+        erase(d_begin_p + numElements, d_end_p);
+    }
+    else {
+        std::fill(d_begin_p, d_end_p, value);
+        insert(d_end_p, numElements - size(), value);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+typename enable_if<!bsl::is_fundamental<INPUT_ITER>::value>::type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::assign(INPUT_ITER first,
+                                                             INPUT_ITER last)
+{
+    clear();
+    insert(d_begin_p, first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::assign(
+                                      std::initializer_list<VALUE_TYPE> values)
+{
+    assign(values.begin(), values.end());
+}
+#endif
+
+                             // *** iteration ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::begin()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_begin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::end()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_end_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rbegin()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(d_end_p);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rend()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(d_begin_p);
+}
+
+                            // *** element access ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator[](
+                                                            size_type position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_begin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::at(size_type position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                 "small_vector<...>::at(n): invalid position");
+    }
+    return d_begin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_begin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_end_p - 1);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::data()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_begin_p;
+}
+
+                               // *** capacity ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reserve(
+                                                         size_type newCapacity)
+{
+    if (newCapacity <= d_capacity) {
+        return;                                                       // RETURN
+    }
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newCapacity > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                              "small_vector<...>::reserve(n): input too long");
+    }
+    privateReallocate(newCapacity);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::shrink_to_fit()
+{
+    if (!is_inline() && size() < d_capacity) {
+        privateReallocate(size());
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::resize(
+                                                             size_type newSize)
+{
+    const size_type oldSize = size();
+
+    if (newSize <= oldSize) {
+        erase(d_begin_p + newSize, d_end_p);
+        return;                                                       // RETURN
+    }
+    if (newSize > d_capacity) {
+        privateReallocate(privateGrowCapacity(
+                                  newSize - oldSize,
+                                  "small_vector<...>::resize(n): too long"));
+    }
+    ArrayPrimitives::defaultConstruct(d_end_p,
+                                      newSize - oldSize,
+                                      ContainerBase::allocator());
+    d_end_p = d_begin_p + newSize;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::resize(
+                                                     size_type         newSize,
+                                                     const VALUE_TYPE& value)
+{
+    const size_type oldSize = size();
+
+    if (newSize <= oldSize) {
+        erase(d_begin_p + newSize, d_end_p);
+    }
+    else {
+        insert(d_end_p, newSize - oldSize, value);
+    }
+}
+
+                              // *** modifiers ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::push_back(
+                                                       const VALUE_TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                        d_end_p != d_begin_p + d_capacity)) {
+        AllocatorTraits::construct(ContainerBase::allocator(), d_end_p, value);
+        ++d_end_p;
+        return;                                                       // RETURN
+    }
+
+    const size_type newCapacity = privateGrowCapacity(
+                      1, "small_vector<...>::push_back(lvalue): too long");
+    const size_type oldSize     = size();
+
+    VALUE_TYPE *newData = ContainerBase::allocateN(d_begin_p, newCapacity);
+    Proctor     proctor(newData, newCapacity, this);
+
+    // Construct before we risk invalidating the reference.
+
+    VALUE_TYPE *pos = newData + oldSize;
+    AllocatorTraits::construct(ContainerBase::allocator(), pos, value);
+
+    BloombergLP::bslalg::AutoArrayDestructor<VALUE_TYPE, ALLOCATOR> guard(
+                                                   pos,
+                                                   pos + 1,
+                                                   ContainerBase::allocator());
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_begin_p,
+                                     d_end_p,
+                                     ContainerBase::allocator());
+    guard.release();
+    proctor.release();
+
+    d_end_p = d_begin_p;
+    privateAdopt(newData, oldSize + 1, newCapacity);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::push_back(
+                              BloombergLP::bslmf::MovableRef<VALUE_TYPE> value)
+{
+    VALUE_TYPE& lvalue = value;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                        d_end_p != d_begin_p + d_capacity)) {
+        AllocatorTraits::construct(ContainerBase::allocator(),
+                                   d_end_p,
+                                   MoveUtil::move(lvalue));
+        ++d_end_p;
+        return;                                                       // RETURN
+    }
+
+    const size_type newCapacity = privateGrowCapacity(
+                      1, "small_vector<...>::push_back(rvalue): too long");
+    const size_type oldSize     = size();
+
+    VALUE_TYPE *newData = ContainerBase::allocateN(d_begin_p, newCapacity);
+    Proctor     proctor(newData, newCapacity, this);
+
+    // Construct before we risk invalidating the reference.
+
+    VALUE_TYPE *pos = newData + oldSize;
+    AllocatorTraits::construct(ContainerBase::allocator(),
+                               pos,
+                               MoveUtil::move(lvalue));
+
+    BloombergLP::bslalg::AutoArrayDestructor<VALUE_TYPE, ALLOCATOR> guard(
+                                                   pos,
+                                                   pos + 1,
+                                                   ContainerBase::allocator());
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_begin_p,
+                                     d_end_p,
+                                     ContainerBase::allocator());
+    guard.release();
+    proctor.release();
+
+    d_end_p = d_begin_p;
+    privateAdopt(newData, oldSize + 1, newCapacity);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    --d_end_p;
+    AllocatorTraits::destroy(ContainerBase::allocator(), d_end_p);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                                    const_iterator    position,
+                                                    const VALUE_TYPE& value)
+{
+    return insert(position, size_type(1), value);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                          const_iterator                             position,
+                          BloombergLP::bslmf::MovableRef<VALUE_TYPE> value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    VALUE_TYPE&      lvalue = value;
+    const size_type  index  = position - d_begin_p;
+    VALUE_TYPE      *pos    = const_cast<VALUE_TYPE *>(position);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                        d_end_p != d_begin_p + d_capacity)) {
+        ArrayPrimitives::insert(pos,
+                                d_end_p,
+                                MoveUtil::move(lvalue),
+                                ContainerBase::allocator());
+        ++d_end_p;
+        return d_begin_p + index;                                     // RETURN
+    }
+
+    const size_type newCapacity = privateGrowCapacity(
+                        1, "small_vector<...>::insert(pos,rv): too long");
+    const size_type newSize     = size() + 1;
+
+    VALUE_TYPE *newData = ContainerBase::allocateN(d_begin_p, newCapacity);
+    Proctor     proctor(newData, newCapacity, this);
+
+    ArrayPrimitives::destructiveMoveAndEmplace(newData,
+                                               &d_end_p,
+                                               d_begin_p,
+                                               pos,
+                                               d_end_p,
+                                               ContainerBase::allocator(),
+                                               MoveUtil::move(lvalue));
+    proctor.release();
+    privateAdopt(newData, newSize, newCapacity);
+    return d_begin_p + index;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                                 const_iterator    position,
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    const size_type  index = position - d_begin_p;
+    VALUE_TYPE      *pos   = const_cast<VALUE_TYPE *>(position);
+
+    if (numElements <= d_capacity - size()) {
+        ArrayPrimitives::insert(pos,
+                                d_end_p,
+                                value,
+                                numElements,
+                                ContainerBase::allocator());
+        d_end_p += numElements;
+        return d_begin_p + index;                                     // RETURN
+    }
+
+    const size_type newCapacity = privateGrowCapacity(
+                 numElements, "small_vector<...>::insert(pos,n,v): too long");
+    const size_type newSize     = size() + numElements;
+
+    VALUE_TYPE *newData = ContainerBase::allocateN(d_begin_p, newCapacity);
+    Proctor     proctor(newData, newCapacity, this);
+
+    ArrayPrimitives::destructiveMoveAndInsert(newData,
+                                              &d_end_p,
+                                              d_begin_p,
+                                              pos,
+                                              d_end_p,
+                                              value,
+                                              numElements,
+                                              ContainerBase::allocator());
+    proctor.release();
+    privateAdopt(newData, newSize, newCapacity);
+    return d_begin_p + index;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+typename enable_if<
+    !bsl::is_fundamental<INPUT_ITER>::value,
+    typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator>::
+    type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                                       const_iterator position,
+                                                       INPUT_ITER     first,
+                                                       INPUT_ITER     last)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    const size_type index = position - d_begin_p;
+
+    privateInsert(index,
+                  first,
+                  last,
+                  typename bsl::iterator_traits<INPUT_ITER>::
+                                                        iterator_category());
+    return d_begin_p + index;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                    const_iterator                    position,
+                                    std::initializer_list<VALUE_TYPE> values)
+{
+    return insert(position, values.begin(), values.end());
+}
+#endif
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <  cend());
+
+    return erase(position, position + 1);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= first);
+    BSLS_ASSERT_SAFE(first    <= last);
+    BSLS_ASSERT_SAFE(last     <= cend());
+
+    VALUE_TYPE *pos = const_cast<VALUE_TYPE *>(first);
+
+    if (first != last) {
+        const size_type n = last - first;
+        ArrayPrimitives::erase(pos,
+                               const_cast<VALUE_TYPE *>(last),
+                               d_end_p,
+                               ContainerBase::allocator());
+        d_end_p -= n;
+    }
+    return pos;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::clear()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    DestructionUtil::destroy(d_begin_p, d_end_p, ContainerBase::allocator());
+    d_end_p = d_begin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::swap(
+                                                          small_vector& other)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    if (AllocatorTraits::propagate_on_container_swap::value) {
+        privateSwapStorage(&other);
+        using std::swap;
+        swap(ContainerBase::allocator(), other.ContainerBase::allocator());
+    }
+    else if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                   get_allocator() == other.get_allocator())) {
+        privateSwapStorage(&other);
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        small_vector toOtherCopy(MoveUtil::move(*this),
+                                 other.get_allocator());
+        small_vector toThisCopy( MoveUtil::move(other), get_allocator());
+
+        other.privateSwapStorage(&toOtherCopy);
+        privateSwapStorage(&toThisCopy);
+    }
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::allocator_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return ContainerBase::allocator();
+}
+
+                             // *** iteration ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::begin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_begin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::cbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_begin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::end() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_end_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::cend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_end_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                                                         const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(d_end_p);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                                                         const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::crbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(d_end_p);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                                                         const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(d_begin_p);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+                                                         const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::crend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(d_begin_p);
+}
+
+                               // *** capacity ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_end_p - d_begin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::capacity() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_capacity;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_end_p == d_begin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return AllocatorTraits::max_size(ContainerBase::allocator());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::is_inline() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_begin_p == inlineData();
+}
+
+                            // *** element access ***
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator[](
+                                                      size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_begin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::at(
+                                                      size_type position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                 "small_vector<...>::at(n): invalid position");
+    }
+    return d_begin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_begin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_end_p - 1);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+const VALUE_TYPE *
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::data() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_begin_p;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator==(
+          const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+          const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+          const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+          const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator<(
+          const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+          const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator>(
+          const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+          const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+          const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+          const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+          const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+          const bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void bsl::swap(bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& a,
+               bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                              TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'small_vector':
+//: o A 'small_vector' defines STL iterators.
+//: o A 'small_vector' uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+//: o A 'small_vector' is *not* bitwise movable, as it may point into its own
+//:   inline storage.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+struct HasStlIterators<bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY,
+                                         ALLOCATOR> >
+: bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY,
+                                            ALLOCATOR> >
+: bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
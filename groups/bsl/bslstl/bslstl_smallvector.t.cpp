@@ -0,0 +1,1497 @@
+// bslstl_smallvector.t.cpp                                           -*-C++-*-
+#include <bslstl_smallvector.h>
+
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a value-semantic container, 'bsl::small_vector',
+// whose element manipulation is delegated to 'bslalg::ArrayPrimitives'.  We
+// therefore concentrate on the transitions between the inline storage and the
+// heap, on the number of allocations made, on allocator propagation to the
+// container and its elements, and on exception safety at the transitions.
+// Sequences of insertions and erasures are checked against 'bsl::vector' as
+// an oracle.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] small_vector();
+// [ 2] small_vector(const ALLOCATOR&);
+// [ 4] small_vector(size_type, const ALLOCATOR&);
+// [ 4] small_vector(size_type, const VALUE_TYPE&, const ALLOCATOR&);
+// [ 4] small_vector(INPUT_ITER, INPUT_ITER, const ALLOCATOR&);
+// [ 5] small_vector(const small_vector&);
+// [ 5] small_vector(const small_vector&, const ALLOCATOR&);
+// [ 5] small_vector(MovableRef<small_vector>);
+// [ 5] small_vector(MovableRef<small_vector>, const ALLOCATOR&);
+// [ 2] ~small_vector();
+//
+// MANIPULATORS
+// [ 5] small_vector& operator=(const small_vector&);
+// [ 5] small_vector& operator=(MovableRef<small_vector>);
+// [ 4] void assign(size_type, const VALUE_TYPE&);
+// [ 4] void assign(INPUT_ITER, INPUT_ITER);
+// [ 4] void reserve(size_type);
+// [ 4] void shrink_to_fit();
+// [ 4] void resize(size_type);
+// [ 4] void resize(size_type, const VALUE_TYPE&);
+// [ 2] void push_back(const VALUE_TYPE&);
+// [ 2] void push_back(MovableRef<VALUE_TYPE>);
+// [ 2] void pop_back();
+// [ 3] iterator insert(const_iterator, const VALUE_TYPE&);
+// [ 3] iterator insert(const_iterator, MovableRef<VALUE_TYPE>);
+// [ 3] iterator insert(const_iterator, size_type, const VALUE_TYPE&);
+// [ 3] iterator insert(const_iterator, INPUT_ITER, INPUT_ITER);
+// [ 3] iterator erase(const_iterator);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 2] void clear();
+// [ 5] void swap(small_vector&);
+//
+// ACCESSORS
+// [ 2] size_type size() const;
+// [ 2] size_type capacity() const;
+// [ 2] bool is_inline() const;
+// [ 2] const_reference operator[](size_type) const;
+// [ 7] const_reference at(size_type) const;
+//
+// FREE OPERATORS
+// [ 7] bool operator==(const small_vector&, const small_vector&);
+// [ 7] bool operator<(const small_vector&, const small_vector&);
+// [ 5] void swap(small_vector&, small_vector&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] EXCEPTION SAFETY
+// [ 7] TYPE TRAITS
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'bsl::vector'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                GLOBAL TYPEDEFS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+
+typedef bsl::small_vector<int, 4>          Obj;
+typedef bsl::small_vector<bsl::string, 2>  StrObj;
+typedef bslmf::MovableRefUtil              MoveUtil;
+
+static const char LONG_PREFIX[] =
+                           "a string too long for the short-string buffer #";
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+bsl::string makeString(int value, bslma::Allocator *basicAllocator)
+    // Return a string, too long for the short-string optimization of
+    // 'bsl::string', that encodes the specified 'value' and uses the
+    // specified 'basicAllocator' to supply memory.
+{
+    char buffer[16];
+    sprintf(buffer, "%d", value);
+
+    bsl::string result(LONG_PREFIX, basicAllocator);
+    result += buffer;
+    return result;
+}
+
+template <class TYPE>
+struct ValueMaker;
+    // This 'struct' template provides a namespace for a function creating a
+    // test value of the (template parameter) 'TYPE' from an integer.
+
+template <>
+struct ValueMaker<int> {
+    static int make(int value, bslma::Allocator *)
+        // Return the specified 'value'.
+    {
+        return value;
+    }
+};
+
+template <>
+struct ValueMaker<bsl::string> {
+    static bsl::string make(int value, bslma::Allocator *basicAllocator)
+        // Return a long string encoding the specified 'value' that uses the
+        // specified 'basicAllocator' to supply memory.
+    {
+        return makeString(value, basicAllocator);
+    }
+};
+
+static
+unsigned nextRandom(unsigned *state)
+    // Advance the specified linear-congruential generator 'state' and return
+    // the next pseudo-random value in '[0 .. 32767]'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return (*state >> 16) & 0x7fff;
+}
+
+template <class OBJ, class VECTOR>
+bool isEqual(const OBJ& x, const VECTOR& y)
+    // Return 'true' if the specified 'x' and 'y' hold equal sequences, and
+    // 'false' otherwise.
+{
+    if (x.size() != y.size()) {
+        return false;                                                 // RETURN
+    }
+    for (std::size_t i = 0; i < y.size(); ++i) {
+        if (!(x[i] == y[i])) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <std::size_t N>
+bool usesAllocator(const bsl::small_vector<int, N>&  x,
+                   bslma::Allocator                 *allocator)
+    // Return 'true' if the specified 'x' uses the specified 'allocator', and
+    // 'false' otherwise.
+{
+    return x.get_allocator().mechanism() == allocator;
+}
+
+template <std::size_t N>
+bool usesAllocator(const bsl::small_vector<bsl::string, N>&  x,
+                   bslma::Allocator                         *allocator)
+    // Return 'true' if the specified 'x' and each of its elements use the
+    // specified 'allocator', and 'false' otherwise.
+{
+    if (x.get_allocator().mechanism() != allocator) {
+        return false;                                                 // RETURN
+    }
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        if (x[i].get_allocator().mechanism() != allocator) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                        // ==========================
+                        // class AllocationLimitGuard
+                        // ==========================
+
+class AllocationLimitGuard {
+    // This class suspends the allocation limit of a test allocator for its
+    // lifetime, so that the set-up of an exception test does not throw.
+
+    // DATA
+    bslma::TestAllocator *d_allocator_p;  // allocator (held, not owned)
+    bsls::Types::Int64    d_limit;        // allocation limit to restore
+
+  private:
+    // NOT IMPLEMENTED
+    AllocationLimitGuard(const AllocationLimitGuard&);
+    AllocationLimitGuard& operator=(const AllocationLimitGuard&);
+
+  public:
+    // CREATORS
+    explicit AllocationLimitGuard(bslma::TestAllocator *allocator)
+        // Suspend the allocation limit of the specified 'allocator'.
+    : d_allocator_p(allocator)
+    , d_limit(allocator->allocationLimit())
+    {
+        d_allocator_p->setAllocationLimit(-1);
+    }
+
+    ~AllocationLimitGuard()
+        // Restore the allocation limit of the allocator.
+    {
+        d_allocator_p->setAllocationLimit(d_limit);
+    }
+};
+
+                            // ===================
+                            // class InputIterator
+                            // ===================
+
+class InputIterator {
+    // This class provides an input iterator over an array of 'int', used to
+    // exercise the single-pass overloads of 'small_vector'.
+
+    // DATA
+    const int *d_ptr_p;  // current position
+
+  public:
+    // TYPES
+    typedef std::input_iterator_tag  iterator_category;
+    typedef int                      value_type;
+    typedef std::ptrdiff_t           difference_type;
+    typedef const int               *pointer;
+    typedef const int&               reference;
+
+    // CREATORS
+    explicit InputIterator(const int *ptr)
+        // Create an iterator referring to the specified 'ptr'.
+    : d_ptr_p(ptr)
+    {
+    }
+
+    // MANIPULATORS
+    InputIterator& operator++()
+        // Advance this iterator and return a reference to it.
+    {
+        ++d_ptr_p;
+        return *this;
+    }
+
+    // ACCESSORS
+    const int& operator*() const
+        // Return the element at the position of this iterator.
+    {
+        return *d_ptr_p;
+    }
+
+    bool operator==(const InputIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' refer to the
+        // same position, and 'false' otherwise.
+    {
+        return d_ptr_p == rhs.d_ptr_p;
+    }
+
+    bool operator!=(const InputIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' refer to
+        // different positions, and 'false' otherwise.
+    {
+        return d_ptr_p != rhs.d_ptr_p;
+    }
+};
+
+template <class VALUE_TYPE, std::size_t N>
+void testInsertErase(unsigned seed)
+    // Apply a pseudo-random sequence, determined by the specified 'seed', of
+    // insertions and erasures to a 'small_vector' of the (template parameter)
+    // 'VALUE_TYPE' having inline capacity of the (template parameter) 'N' and
+    // to a 'bsl::vector', and verify after each that they hold the same
+    // elements, that the object owns a heap block exactly when it is not
+    // inline, and that the elements use the allocator of the object.
+{
+    typedef bsl::small_vector<VALUE_TYPE, N>  OBJ;
+    typedef VALUE_TYPE                        ValueType;
+    typedef bsl::vector<ValueType>            Oracle;
+
+    bslma::TestAllocator oa("object",  veryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+    const bool ELEMENTS_ALLOCATE =
+                               bslma::UsesBslmaAllocator<ValueType>::value;
+    {
+        OBJ mX(&oa);  const OBJ& X = mX;
+        Oracle mY(&sa);
+
+        unsigned state = seed;
+        for (int op = 0; op < 500; ++op) {
+            const std::size_t SIZE = X.size();
+            const std::size_t POS  = nextRandom(&state) % (SIZE + 1);
+            const int         OP   = nextRandom(&state) % 10;
+
+            const ValueType V = ValueMaker<ValueType>::make(op, &sa);
+
+            typename OBJ::iterator result = mX.end();
+            bool                   check  = false;
+
+            switch (OP) {
+              case 0: {
+                mX.push_back(V);
+                mY.push_back(V);
+              } break;
+              case 1: {
+                result = mX.insert(X.begin() + POS, V);
+                mY.insert(mY.begin() + POS, V);
+                check  = true;
+              } break;
+              case 2: {
+                ValueType v(V);
+                result = mX.insert(X.begin() + POS, MoveUtil::move(v));
+                mY.insert(mY.begin() + POS, V);
+                check  = true;
+              } break;
+              case 3: {
+                const std::size_t NUM = nextRandom(&state) % 6;
+                result = mX.insert(X.begin() + POS, NUM, V);
+                mY.insert(mY.begin() + POS, NUM, V);
+                check  = true;
+              } break;
+              case 4: {
+                // Insert copies of an element of the object itself.
+
+                if (SIZE) {
+                    const std::size_t K = nextRandom(&state) % SIZE;
+                    const ValueType   W = X[K];
+                    result = mX.insert(X.begin() + POS, 3, X[K]);
+                    mY.insert(mY.begin() + POS, 3, W);
+                    check  = true;
+                }
+              } break;
+              case 5: {
+                if (SIZE) {
+                    const std::size_t K = nextRandom(&state) % SIZE;
+                    const ValueType   W = X[K];
+                    mX.push_back(X[K]);
+                    mY.push_back(W);
+                }
+              } break;
+              case 6: {
+                Oracle source(&sa);
+                const int NUM = nextRandom(&state) % 7;
+                for (int i = 0; i < NUM; ++i) {
+                    source.push_back(ValueMaker<ValueType>::make(op + i,
+                                                                 &sa));
+                }
+                result = mX.insert(X.begin() + POS,
+                                   source.begin(),
+                                   source.end());
+                mY.insert(mY.begin() + POS, source.begin(), source.end());
+                check  = true;
+              } break;
+              case 7: {
+                if (POS < SIZE) {
+                    result = mX.erase(X.begin() + POS);
+                    mY.erase(mY.begin() + POS);
+                    check  = true;
+                }
+              } break;
+              case 8: {
+                const std::size_t LAST =
+                              POS + nextRandom(&state) % (SIZE - POS + 1);
+                result = mX.erase(X.begin() + POS, X.begin() + LAST);
+                mY.erase(mY.begin() + POS, mY.begin() + LAST);
+                check  = true;
+              } break;
+              case 9: {
+                // Occasionally shrink back to a small size.
+
+                if (0 == nextRandom(&state) % 4) {
+                    const std::size_t LEN = nextRandom(&state) % 3;
+                    mX.resize(LEN < SIZE ? LEN : SIZE);
+                    mY.resize(LEN < SIZE ? LEN : SIZE);
+                    mX.shrink_to_fit();
+                }
+                else if (SIZE) {
+                    mX.pop_back();
+                    mY.pop_back();
+                }
+              } break;
+            }
+
+            ASSERTV(seed, op, OP, isEqual(X, mY));
+            ASSERTV(seed, op, OP, !check || result - X.begin() == (int)POS);
+            ASSERTV(seed, op, X.is_inline() == (N == X.capacity()));
+            ASSERTV(seed, op, X.size() <= X.capacity());
+            ASSERTV(seed, op, usesAllocator(X, &oa));
+            if (!ELEMENTS_ALLOCATE) {
+                ASSERTV(seed, op, X.is_inline(), oa.numBlocksInUse(),
+                        (X.is_inline() ? 0 : 1) == oa.numBlocksInUse());
+            }
+        }
+    }
+    ASSERTV(seed, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test        = argc > 1 ? atoi(argv[1]) : 0;
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Splitting a Path Without Allocating
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to find the positions of the separators in file system
+// paths, most of which have few components.
+//
+// First, we define a function that records the offset of each '/' in a
+// 'small_vector' having room for eight offsets inline:
+//..
+    typedef bsl::small_vector<int, 8> Offsets;
+
+    struct Local {
+        static
+        void findSeparators(Offsets *result, const char *path)
+            // Load into the specified 'result' the offset of each '/' in the
+            // specified null-terminated 'path'.
+        {
+            result->clear();
+            for (int i = 0; path[i]; ++i) {
+                if ('/' == path[i]) {
+                    result->push_back(i);
+                }
+            }
+        }
+    };
+//..
+// Then, we create a 'small_vector' supplied with a test allocator, so that we
+// can observe its use of memory:
+//..
+    bslma::TestAllocator ta;
+    Offsets              offsets(&ta);
+//..
+// Next, we split a typical path, and observe that no memory was allocated:
+//..
+    Local::findSeparators(&offsets, "/usr/local/include/bsl_vector.h");
+    ASSERT(4 == offsets.size());
+    ASSERT(10 == offsets[2]);
+    ASSERT(0 == ta.numBlocksTotal());
+//..
+// Finally, we split an unusually deep path, and observe that the elements
+// have moved to a single block obtained from the allocator:
+//..
+    Local::findSeparators(&offsets, "/a/b/c/d/e/f/g/h/i/j");
+    ASSERT(10 == offsets.size());
+    ASSERT(!offsets.is_inline());
+    ASSERT(1 == ta.numBlocksInUse());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // FREE OPERATORS, 'at', AND TYPE TRAITS
+        //
+        // Concerns:
+        //: 1 The equality and relational operators compare the elements, and
+        //:   not where they are stored.
+        //:
+        //: 2 'at' returns the element at a valid position, and throws
+        //:   'std::out_of_range' otherwise.
+        //:
+        //: 3 'small_vector' declares the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits, and is not bitwise movable.
+        //
+        // Plan:
+        //: 1 Compare objects of equal value, one inline and one on the heap,
+        //:   and objects of different values.  (C-1)
+        //:
+        //: 2 Call 'at' with valid and invalid positions.  (C-2)
+        //:
+        //: 3 Check the traits.  (C-3)
+        //
+        // Testing:
+        //   bool operator==(const small_vector&, const small_vector&);
+        //   bool operator<(const small_vector&, const small_vector&);
+        //   const_reference at(size_type) const;
+        //   TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nFREE OPERATORS, 'at', AND TYPE TRAITS"
+                            "\n=====================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        Obj mY(&oa);  const Obj& Y = mY;
+
+        for (int i = 0; i < 3; ++i) {
+            mX.push_back(i);
+            mY.push_back(i);
+        }
+        mY.reserve(100);
+        ASSERT( X.is_inline());
+        ASSERT(!Y.is_inline());
+
+        ASSERT(  X == Y);
+        ASSERT(!(X != Y));
+        ASSERT(!(X <  Y));
+        ASSERT(  X <= Y);
+        ASSERT(  X >= Y);
+
+        mY.push_back(0);
+        ASSERT(X != Y);
+        ASSERT(X <  Y);
+        ASSERT(Y >  X);
+
+        mX[2] = 9;
+        ASSERT(Y <  X);
+        ASSERT(X >= Y);
+
+        ASSERT(9 == X.at(2));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        bool caught = false;
+        BSLS_TRY {
+            X.at(3);
+        }
+        BSLS_CATCH(const std::out_of_range&) {
+            caught = true;
+        }
+        ASSERT(caught);
+#endif
+
+        ASSERT( bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT( bslalg::HasStlIterators<Obj>::value);
+        ASSERT(!bslmf::IsBitwiseMoveable<Obj>::value);
+        ASSERT( bslmf::IsBitwiseMoveable<int>::value);
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 'push_back', 'reserve', and 'shrink_to_fit' leave the object
+        //:   unchanged, and still inline or on the heap as before, if an
+        //:   allocation fails while moving between the inline storage and the
+        //:   heap.
+        //:
+        //: 2 The constructors and 'insert' release all memory if an element
+        //:   fails to copy, whether the elements are inline or on the heap.
+        //
+        // Plan:
+        //: 1 For vectors of long strings, whose copies allocate, perform each
+        //:   operation at the boundary between inline and heap storage under
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*', and verify the state of
+        //:   the object when an exception propagates.  (C-1..2)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY"
+                            "\n================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        const bsl::string A = makeString(1, &sa);
+        const bsl::string B = makeString(2, &sa);
+        const bsl::string C = makeString(3, &sa);
+
+        if (verbose) printf("\t'push_back' spilling to the heap\n");
+        {
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StrObj mX(&oa);  const StrObj& X = mX;
+                {
+                    AllocationLimitGuard guard(&oa);
+                    mX.push_back(A);
+                    mX.push_back(B);
+                }
+                ASSERT(X.is_inline());
+
+                BSLS_TRY {
+                    mX.push_back(C);
+                }
+                BSLS_CATCH(...) {
+                    ASSERT(X.is_inline());
+                    ASSERT(2 == X.size());
+                    ASSERT(A == X[0] && B == X[1]);
+                    BSLS_RETHROW;
+                }
+                ASSERT(!X.is_inline());
+                ASSERT(3 == X.size());
+                ASSERT(C == X[2]);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\t'reserve' and 'shrink_to_fit'\n");
+        {
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StrObj mX(&oa);  const StrObj& X = mX;
+                {
+                    AllocationLimitGuard guard(&oa);
+                    mX.push_back(A);
+                }
+
+                BSLS_TRY {
+                    mX.reserve(10);
+                }
+                BSLS_CATCH(...) {
+                    ASSERT(X.is_inline());
+                    ASSERT(1 == X.size() && A == X[0]);
+                    BSLS_RETHROW;
+                }
+                ASSERT(!X.is_inline());
+                ASSERT(10 == X.capacity());
+
+                BSLS_TRY {
+                    mX.shrink_to_fit();
+                }
+                BSLS_CATCH(...) {
+                    ASSERT(!X.is_inline());
+                    ASSERT(1 == X.size() && A == X[0]);
+                    BSLS_RETHROW;
+                }
+                ASSERT(X.is_inline());
+                ASSERT(1 == X.size() && A == X[0]);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tConstructors\n");
+        {
+            bsl::vector<bsl::string> source(&sa);
+            for (int n = 0; n < 6; ++n) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    StrObj mX(source.begin(), source.end(), &oa);
+                    ASSERTV(n, isEqual(mX, source));
+
+                    StrObj mY(mX, &oa);
+                    ASSERTV(n, isEqual(mY, source));
+
+                    StrObj mZ(source.size(), A, &oa);
+                    ASSERTV(n, source.size() == mZ.size());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+                ASSERTV(n, 0 == oa.numBlocksInUse());
+
+                source.push_back(makeString(n, &sa));
+            }
+        }
+
+        if (verbose) printf("\t'insert' spilling to the heap\n");
+        {
+            bsl::vector<bsl::string> source(&sa);
+            source.push_back(B);
+            source.push_back(C);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StrObj mX(&oa);  const StrObj& X = mX;
+                {
+                    AllocationLimitGuard guard(&oa);
+                    mX.push_back(A);
+                }
+
+                mX.insert(X.begin(), source.begin(), source.end());
+                ASSERT(3 == X.size());
+                ASSERT(B == X[0] && C == X[1] && A == X[2]);
+
+                mX.insert(X.begin() + 1, 2, X[2]);
+                ASSERT(5 == X.size());
+                ASSERT(A == X[1] && A == X[2] && C == X[3]);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, AND SWAP
+        //
+        // Concerns:
+        //: 1 Copying yields an equal object whose elements use the allocator
+        //:   of the copy.
+        //:
+        //: 2 Moving an object whose elements are on the heap transfers the
+        //:   heap block without allocating; moving an inline object moves the
+        //:   elements.  Either way the source is left empty and inline.
+        //:
+        //: 3 Moving to an object with a different allocator copies the
+        //:   elements into memory from that allocator.
+        //:
+        //: 4 Assignment and 'swap' work for every combination of inline and
+        //:   heap objects, with equal and with different allocators, and do
+        //:   not change the allocators.
+        //
+        // Plan:
+        //: 1 For vectors of long strings of sizes straddling the inline
+        //:   capacity, perform each operation and verify the values, the
+        //:   allocators of the objects and their elements, and the number of
+        //:   allocations made.  (C-1..4)
+        //
+        // Testing:
+        //   small_vector(const small_vector&);
+        //   small_vector(const small_vector&, const ALLOCATOR&);
+        //   small_vector(MovableRef<small_vector>);
+        //   small_vector(MovableRef<small_vector>, const ALLOCATOR&);
+        //   small_vector& operator=(const small_vector&);
+        //   small_vector& operator=(MovableRef<small_vector>);
+        //   void swap(small_vector&);
+        //   void swap(small_vector&, small_vector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, AND SWAP"
+                            "\n====================\n");
+
+        const int SIZES[]   = { 0, 1, 2, 3, 5 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\tConstruction\n");
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            bslma::TestAllocator za("other",  veryVeryVerbose);
+
+            bsl::vector<bsl::string> exp(&sa);
+            for (int i = 0; i < SIZE; ++i) {
+                exp.push_back(makeString(i, &sa));
+            }
+
+            StrObj mX(exp.begin(), exp.end(), &oa);  const StrObj& X = mX;
+            ASSERTV(SIZE, X.is_inline() == (SIZE <= 2));
+
+            {
+                bslma::TestAllocator         ca("copy", veryVeryVerbose);
+                bslma::DefaultAllocatorGuard guard(&ca);
+
+                const StrObj Y(X);
+                ASSERTV(SIZE, isEqual(Y, exp));
+                ASSERTV(SIZE, usesAllocator(Y, &ca));
+            }
+            {
+                const StrObj Y(X, &za);
+                ASSERTV(SIZE, isEqual(Y, exp));
+                ASSERTV(SIZE, usesAllocator(Y, &za));
+            }
+            {
+                StrObj mY(X, &oa);  const StrObj& Y = mY;
+
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+                const StrObj Z(MoveUtil::move(mY));
+                ASSERTV(SIZE, isEqual(Z, exp));
+                ASSERTV(SIZE, usesAllocator(Z, &oa));
+                ASSERTV(SIZE, Y.empty());
+                ASSERTV(SIZE, Y.is_inline());
+                ASSERTV(SIZE, Z.is_inline() == (SIZE <= 2));
+                ASSERTV(SIZE, NUM_BLOCKS == oa.numBlocksTotal());
+            }
+            {
+                StrObj mY(X, &oa);
+
+                const StrObj Z(MoveUtil::move(mY), &za);
+                ASSERTV(SIZE, isEqual(Z, exp));
+                ASSERTV(SIZE, usesAllocator(Z, &za));
+            }
+            {
+                StrObj mY(X, &oa);  const StrObj& Y = mY;
+
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+                const StrObj Z(MoveUtil::move(mY), &oa);
+                ASSERTV(SIZE, isEqual(Z, exp));
+                ASSERTV(SIZE, Y.empty());
+                ASSERTV(SIZE, NUM_BLOCKS == oa.numBlocksTotal());
+            }
+            ASSERTV(SIZE, 0 == za.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tAssignment and 'swap'\n");
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                for (int same = 0; same < 2; ++same) {
+                    const int LHS_SIZE = SIZES[ti];
+                    const int RHS_SIZE = SIZES[tj];
+
+                    bslma::TestAllocator oa("object", veryVeryVerbose);
+                    bslma::TestAllocator za("other",  veryVeryVerbose);
+
+                    bslma::TestAllocator& ra = same ? oa : za;
+
+                    bsl::vector<bsl::string> lhsExp(&sa), rhsExp(&sa);
+                    for (int i = 0; i < LHS_SIZE; ++i) {
+                        lhsExp.push_back(makeString(i, &sa));
+                    }
+                    for (int i = 0; i < RHS_SIZE; ++i) {
+                        rhsExp.push_back(makeString(100 + i, &sa));
+                    }
+
+                    // copy assignment
+
+                    {
+                        StrObj mX(lhsExp.begin(), lhsExp.end(), &oa);
+                        StrObj mY(rhsExp.begin(), rhsExp.end(), &ra);
+
+                        mX = mY;
+                        ASSERTV(ti, tj, same, isEqual(mX, rhsExp));
+                        ASSERTV(ti, tj, same, isEqual(mY, rhsExp));
+                        ASSERTV(ti, tj, same, usesAllocator(mX, &oa));
+                    }
+
+                    // move assignment
+
+                    {
+                        StrObj mX(lhsExp.begin(), lhsExp.end(), &oa);
+                        StrObj mY(rhsExp.begin(), rhsExp.end(), &ra);
+
+                        mX = MoveUtil::move(mY);
+                        ASSERTV(ti, tj, same, isEqual(mX, rhsExp));
+                        ASSERTV(ti, tj, same, usesAllocator(mX, &oa));
+                        ASSERTV(ti, tj, same, usesAllocator(mY, &ra));
+                        if (same) {
+                            ASSERTV(ti, tj, mY.empty());
+                        }
+                    }
+
+                    // member and free 'swap'
+
+                    {
+                        StrObj mX(lhsExp.begin(), lhsExp.end(), &oa);
+                        StrObj mY(rhsExp.begin(), rhsExp.end(), &ra);
+
+                        mX.swap(mY);
+                        ASSERTV(ti, tj, same, isEqual(mX, rhsExp));
+                        ASSERTV(ti, tj, same, isEqual(mY, lhsExp));
+                        ASSERTV(ti, tj, same, usesAllocator(mX, &oa));
+                        ASSERTV(ti, tj, same, usesAllocator(mY, &ra));
+
+                        swap(mX, mY);
+                        ASSERTV(ti, tj, same, isEqual(mX, lhsExp));
+                        ASSERTV(ti, tj, same, isEqual(mY, rhsExp));
+                        ASSERTV(ti, tj, same, usesAllocator(mX, &oa));
+                        ASSERTV(ti, tj, same, usesAllocator(mY, &ra));
+                    }
+
+                    // self-assignment
+
+                    {
+                        StrObj mX(lhsExp.begin(), lhsExp.end(), &oa);
+
+                        mX = *&mX;
+                        ASSERTV(ti, isEqual(mX, lhsExp));
+                    }
+
+                    ASSERTV(ti, tj, same, 0 == oa.numBlocksInUse());
+                    ASSERTV(ti, tj, same, 0 == za.numBlocksInUse());
+                }
+            }
+        }
+
+        if (verbose) printf("\tSwapping heap vectors allocates nothing\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(10, 1, &oa);
+            Obj mY(20, 2, &oa);
+            const int *const X_DATA = mX.data();
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+            mX.swap(mY);
+            ASSERT(NUM_BLOCKS == oa.numBlocksTotal());
+            ASSERT(20 == mX.size() && 10 == mY.size());
+            ASSERT(X_DATA == mY.data());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // VALUE CONSTRUCTORS, 'assign', AND CAPACITY
+        //
+        // Concerns:
+        //: 1 The value constructors allocate exactly once if the requested
+        //:   size exceeds the inline capacity, and not at all otherwise.
+        //:
+        //: 2 'reserve' moves the elements to the heap only if the requested
+        //:   capacity exceeds the current capacity.
+        //:
+        //: 3 'shrink_to_fit' moves the elements back to the inline storage,
+        //:   releasing the heap block, if they fit, and otherwise reduces the
+        //:   heap block to the size of the vector.
+        //:
+        //: 4 'resize' and 'assign' produce the expected values, including
+        //:   when the value supplied is an element of the vector itself.
+        //:
+        //: 5 The range constructor accepts input iterators.
+        //
+        // Plan:
+        //: 1 Exercise each method on either side of the inline capacity, and
+        //:   verify the values and the allocations made.  (C-1..5)
+        //
+        // Testing:
+        //   small_vector(size_type, const ALLOCATOR&);
+        //   small_vector(size_type, const VALUE_TYPE&, const ALLOCATOR&);
+        //   small_vector(INPUT_ITER, INPUT_ITER, const ALLOCATOR&);
+        //   void assign(size_type, const VALUE_TYPE&);
+        //   void assign(INPUT_ITER, INPUT_ITER);
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        //   void resize(size_type);
+        //   void resize(size_type, const VALUE_TYPE&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nVALUE CONSTRUCTORS, 'assign', AND CAPACITY"
+                            "\n==========================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        if (verbose) printf("\tValue constructors\n");
+        for (int n = 0; n < 10; ++n) {
+            const Obj X(n, &oa);
+            ASSERTV(n, n == static_cast<int>(X.size()));
+            ASSERTV(n, (n <= 4 ? 0 : 1) == oa.numBlocksInUse());
+            for (int i = 0; i < n; ++i) {
+                ASSERTV(n, i, 0 == X[i]);
+            }
+
+            const Obj Y(n, 7, &oa);
+            ASSERTV(n, n == static_cast<int>(Y.size()));
+            for (int i = 0; i < n; ++i) {
+                ASSERTV(n, i, 7 == Y[i]);
+            }
+            ASSERTV(n, Y.is_inline() == (n <= 4));
+            ASSERTV(n, Y.capacity() == (n <= 4 ? 4u : std::size_t(n)));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tRange constructor\n");
+        {
+            const int DATA[]   = { 1, 2, 3, 4, 5, 6, 7 };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int n = 0; n <= NUM_DATA; ++n) {
+                const Obj X(DATA, DATA + n, &oa);
+                const Obj Y(InputIterator(DATA), InputIterator(DATA + n), &oa);
+
+                ASSERTV(n, n == static_cast<int>(X.size()));
+                ASSERTV(n, X == Y);
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, DATA[i] == X[i]);
+                }
+            }
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.push_back(0);
+            mX.insert(X.begin(), InputIterator(DATA), InputIterator(DATA + 6));
+            ASSERT(7 == X.size());
+            ASSERT(1 == X[0] && 6 == X[5] && 0 == X[6]);
+
+            mX.assign(InputIterator(DATA), InputIterator(DATA + 2));
+            ASSERT(2 == X.size());
+            ASSERT(1 == X[0] && 2 == X[1]);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\t'reserve' and 'shrink_to_fit'\n");
+        {
+            bslma::TestAllocator ra("reserve", veryVeryVerbose);
+
+            Obj mX(&ra);  const Obj& X = mX;
+            mX.push_back(1);
+            mX.push_back(2);
+
+            mX.reserve(3);
+            ASSERT(X.is_inline());
+            ASSERT(0 == ra.numBlocksTotal());
+
+            mX.reserve(20);
+            ASSERT(!X.is_inline());
+            ASSERT(20 == X.capacity());
+            ASSERT(1  == ra.numBlocksInUse());
+            ASSERT(2  == X.size() && 1 == X[0] && 2 == X[1]);
+
+            mX.reserve(10);
+            ASSERT(20 == X.capacity());
+            ASSERT(1  == ra.numBlocksTotal());
+
+            mX.resize(6);
+            mX.shrink_to_fit();
+            ASSERT(!X.is_inline());
+            ASSERT(6 == X.capacity());
+            ASSERT(1 == ra.numBlocksInUse());
+            ASSERT(2 == ra.numBlocksTotal());
+
+            mX.resize(3);
+            mX.shrink_to_fit();
+            ASSERT(X.is_inline());
+            ASSERT(4 == X.capacity());
+            ASSERT(0 == ra.numBlocksInUse());
+            ASSERT(3 == X.size() && 1 == X[0] && 2 == X[1] && 0 == X[2]);
+
+            mX.shrink_to_fit();
+            ASSERT(X.is_inline());
+            ASSERT(2 == ra.numBlocksTotal());
+        }
+
+        if (verbose) printf("\t'resize' and 'assign'\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.resize(3, 5);
+            ASSERT(3 == X.size() && 5 == X[2]);
+
+            mX[0] = 1;
+            mX.resize(6, X[0]);
+            ASSERT(6 == X.size());
+            ASSERT(1 == X[0] && 5 == X[1] && 1 == X[3] && 1 == X[5]);
+
+            mX.resize(2);
+            ASSERT(2 == X.size() && 1 == X[0] && 5 == X[1]);
+
+            mX.assign(5, X[1]);
+            ASSERT(5 == X.size());
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, 5 == X[i]);
+            }
+
+            mX[0] = 8;
+            mX.assign(2, X[0]);
+            ASSERT(2 == X.size() && 8 == X[0] && 8 == X[1]);
+
+            const int DATA[] = { 4, 3, 2, 1, 0, 9 };
+            mX.assign(DATA, DATA + 6);
+            ASSERT(6 == X.size() && 4 == X[0] && 9 == X[5]);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX = { 7, 8 };
+            ASSERT(2 == X.size() && 7 == X[0] && 8 == X[1]);
+
+            const Obj Y({ 1, 2, 3, 4, 5 }, &oa);
+            ASSERT(5 == Y.size() && 5 == Y[4]);
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'insert' AND 'erase'
+        //
+        // Concerns:
+        //: 1 Every form of 'insert' and 'erase' produces the same sequence as
+        //:   the corresponding operation on 'bsl::vector', whether the
+        //:   elements are inline or on the heap, and whether or not the
+        //:   operation moves them from one to the other.
+        //:
+        //: 2 'insert' returns an iterator to the first inserted element, and
+        //:   'erase' an iterator to the element following those erased.
+        //:
+        //: 3 Inserting copies of an element of the vector itself works, even
+        //:   when the insertion moves the elements to the heap.
+        //:
+        //: 4 The vector owns a heap block exactly when it is not inline, and
+        //:   its elements always use its allocator.
+        //
+        // Plan:
+        //: 1 Using the 'testInsertErase' helper, apply pseudo-random sequences
+        //:   of operations to vectors of 'int' and of long strings having
+        //:   several inline capacities, and compare with 'bsl::vector' after
+        //:   each operation.  (C-1..4)
+        //
+        // Testing:
+        //   iterator insert(const_iterator, const VALUE_TYPE&);
+        //   iterator insert(const_iterator, MovableRef<VALUE_TYPE>);
+        //   iterator insert(const_iterator, size_type, const VALUE_TYPE&);
+        //   iterator insert(const_iterator, INPUT_ITER, INPUT_ITER);
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insert' AND 'erase'"
+                            "\n====================\n");
+
+        for (unsigned seed = 1; seed <= 20; ++seed) {
+            testInsertErase<int, 1>(seed);
+            testInsertErase<int, 4>(seed);
+            testInsertErase<int, 16>(seed);
+            testInsertErase<bsl::string, 1>(seed);
+            testInsertErase<bsl::string, 3>(seed);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND ALLOCATION
+        //
+        // Concerns:
+        //: 1 A default-constructed vector is empty and inline, uses the
+        //:   default allocator, and allocates nothing.
+        //:
+        //: 2 'push_back' allocates nothing until the size exceeds the inline
+        //:   capacity, then allocates a single block, and thereafter grows
+        //:   geometrically.
+        //:
+        //: 3 'push_back' of an element of the vector itself works, even when
+        //:   the push moves the elements to the heap.
+        //:
+        //: 4 Elements use the allocator of the vector, whether inline or on
+        //:   the heap.
+        //:
+        //: 5 'pop_back' and 'clear' destroy elements but retain capacity.
+        //:
+        //: 6 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 Push and pop elements across the inline capacity, and check the
+        //:   size, capacity, 'is_inline', and the allocations made after each
+        //:   operation.  (C-1..6)
+        //
+        // Testing:
+        //   small_vector();
+        //   small_vector(const ALLOCATOR&);
+        //   ~small_vector();
+        //   void push_back(const VALUE_TYPE&);
+        //   void push_back(MovableRef<VALUE_TYPE>);
+        //   void pop_back();
+        //   void clear();
+        //   size_type size() const;
+        //   size_type capacity() const;
+        //   bool is_inline() const;
+        //   const_reference operator[](size_type) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS AND ALLOCATION"
+                            "\n===================================\n");
+
+        if (verbose) printf("\tDefault construction\n");
+        {
+            const Obj X;
+            ASSERT(X.empty());
+            ASSERT(X.is_inline());
+            ASSERT(4 == X.capacity());
+            ASSERT(&da == X.get_allocator().mechanism());
+            ASSERT(0 == da.numBlocksTotal());
+        }
+
+        if (verbose) printf("\t'push_back' across the inline capacity\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(&oa == X.get_allocator().mechanism());
+
+            for (int i = 0; i < 4; ++i) {
+                mX.push_back(i);
+                ASSERTV(i, X.is_inline());
+                ASSERTV(i, 4 == X.capacity());
+            }
+            ASSERT(0 == oa.numBlocksTotal());
+
+            mX.push_back(X[0]);
+            ASSERT(!X.is_inline());
+            ASSERT(8 == X.capacity());
+            ASSERT(5 == X.size());
+            ASSERT(0 == X[4]);
+            ASSERT(1 == oa.numBlocksInUse());
+
+            for (int i = 5; i < 8; ++i) {
+                mX.push_back(i);
+            }
+            ASSERT(1 == oa.numBlocksTotal());
+
+            mX.push_back(X[7]);
+            ASSERT(16 == X.capacity());
+            ASSERT(7  == X[8]);
+            ASSERT(2  == oa.numBlocksTotal());
+            ASSERT(1  == oa.numBlocksInUse());
+
+            for (int i = 0; i < 9; ++i) {
+                ASSERTV(i, X[i] == (8 == i ? 7 : 4 == i ? 0 : i));
+            }
+
+            mX.pop_back();
+            ASSERT(8 == X.size());
+            ASSERT(16 == X.capacity());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(!X.is_inline());
+            ASSERT(16 == X.capacity());
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tElements use the allocator\n");
+        {
+            bslma::TestAllocator oa("object",  veryVeryVerbose);
+            bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+            {
+                StrObj mX(&oa);  const StrObj& X = mX;
+
+                mX.push_back(makeString(0, &sa));
+                ASSERT(X.is_inline());
+                ASSERT(usesAllocator(X, &oa));
+                ASSERT(1 == oa.numBlocksInUse());
+
+                bsl::string s = makeString(1, &oa);
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+                mX.push_back(MoveUtil::move(s));
+                ASSERT(NUM_BLOCKS == oa.numBlocksTotal());
+
+                mX.push_back(X[0]);
+                ASSERT(!X.is_inline());
+                ASSERT(3 == X.size());
+                ASSERT(makeString(0, &sa) == X[2]);
+                ASSERT(usesAllocator(X, &oa));
+
+                mX.pop_back();
+                ASSERT(2 == X.size());
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a vector, fill it past its inline capacity, insert, erase,
+        //:   copy, and compare.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+        ASSERT(X.is_inline());
+
+        for (int i = 0; i < 3; ++i) {
+            mX.push_back(i * 10);
+        }
+        ASSERT(3 == X.size());
+        ASSERT(X.is_inline());
+        ASSERT(0 == oa.numBlocksTotal());
+
+        mX.insert(X.begin(), 5);
+        mX.insert(X.end(), 2, 7);
+        ASSERT(6 == X.size());
+        ASSERT(!X.is_inline());
+        ASSERT(5 == X.front());
+        ASSERT(7 == X.back());
+
+        mX.erase(X.begin(), X.begin() + 3);
+        ASSERT(3 == X.size());
+        ASSERT(20 == X[0]);
+
+        int sum = 0;
+        for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+            sum += *it;
+        }
+        ASSERT(34 == sum);
+
+        const Obj Y(X, &oa);
+        ASSERT(X == Y);
+        ASSERT(Y.is_inline());
+
+        mX.shrink_to_fit();
+        ASSERT(X.is_inline());
+        ASSERT(X == Y);
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'bsl::vector'
+        //
+        // Concerns:
+        //: 1 For sizes within the inline capacity, building, iterating, and
+        //:   destroying a 'small_vector' is faster than doing the same with
+        //:   'bsl::vector', and makes no allocations.
+        //
+        // Plan:
+        //: 1 For several sizes, time the construction of a vector by repeated
+        //:   'push_back', a pass summing its elements, and its destruction,
+        //:   for 'small_vector<int, 8>' and 'bsl::vector<int>', using the
+        //:   default (new/delete) allocator, and report the time per vector
+        //:   and the allocations per vector.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'bsl::vector'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: COMPARISON WITH 'bsl::vector'"
+                            "\n==========================================\n");
+
+        typedef bsl::small_vector<int, 8> SmallVec;
+        typedef bsl::vector<int>          Vec;
+
+        const int SIZES[]   = { 2, 4, 8, 16 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        bslma::Allocator *nda = &bslma::NewDeleteAllocator::singleton();
+
+        printf("%6s %14s %14s %12s %12s\n",
+               "size", "small (ns)", "vector (ns)", "small allocs",
+               "vec allocs");
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+            const int REPS = 10 * 1000 * 1000 / SIZE;
+
+            bsls::Types::Int64 sink = 0;
+            bsls::Stopwatch    timer;
+
+            timer.start();
+            for (int r = 0; r < REPS; ++r) {
+                SmallVec mX(nda);
+                for (int i = 0; i < SIZE; ++i) {
+                    mX.push_back(i + r);
+                }
+                for (SmallVec::const_iterator it = mX.begin();
+                                              it != mX.end();
+                                              ++it) {
+                    sink += *it;
+                }
+            }
+            timer.stop();
+            const double smallTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int r = 0; r < REPS; ++r) {
+                Vec mX(nda);
+                for (int i = 0; i < SIZE; ++i) {
+                    mX.push_back(i + r);
+                }
+                for (Vec::const_iterator it = mX.begin();
+                                         it != mX.end();
+                                         ++it) {
+                    sink += *it;
+                }
+            }
+            timer.stop();
+            const double vecTime = timer.elapsedTime();
+
+            bslma::TestAllocator sa("small",  veryVeryVerbose);
+            bslma::TestAllocator va("vector", veryVeryVerbose);
+            {
+                SmallVec mX(&sa);
+                Vec      mY(&va);
+                for (int i = 0; i < SIZE; ++i) {
+                    mX.push_back(i);
+                    mY.push_back(i);
+                }
+            }
+
+            printf("%6d %14.2f %14.2f %12lld %12lld\n",
+                   SIZE,
+                   smallTime * 1.0e9 / REPS,
+                   vecTime   * 1.0e9 / REPS,
+                   sa.numBlocksTotal(),
+                   va.numBlocksTotal());
+
+            if (veryVerbose) {
+                printf("\tchecksum: %lld\n", sink);
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------